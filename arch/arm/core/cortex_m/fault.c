@@ -486,10 +486,22 @@ static int bus_fault(struct arch_esf *esf, int from_hard_fault, bool *recoverabl
  *
  * @return error code to identify the fatal error reason
  */
-static uint32_t usage_fault(const struct arch_esf *esf)
+static uint32_t usage_fault(const struct arch_esf *esf, bool *recoverable)
 {
 	uint32_t reason = K_ERR_ARM_USAGE_GENERIC;
 
+#if defined(CONFIG_FPU_SHARING_DEMOTION)
+	/* A demoted thread touched the FPU again: restore its FP context
+	 * and retry the faulting instruction instead of treating this as
+	 * an error.
+	 */
+	if (((SCB->CFSR & SCB_CFSR_NOCP_Msk) != 0) && z_arm_fpu_promote()) {
+		SCB->CFSR |= SCB_CFSR_NOCP_Msk;
+		*recoverable = true;
+		return reason;
+	}
+#endif /* CONFIG_FPU_SHARING_DEMOTION */
+
 	PR_FAULT_INFO("***** USAGE FAULT *****");
 
 	/* bits are sticky: they stack and must be reset */
@@ -737,7 +749,7 @@ static uint32_t hard_fault(struct arch_esf *esf, bool *recoverable)
 		} else if ((SCB->CFSR & SCB_CFSR_BUSFAULTSR_Msk) != 0) {
 			reason = bus_fault(esf, 1, recoverable);
 		} else if ((SCB->CFSR & SCB_CFSR_USGFAULTSR_Msk) != 0) {
-			reason = usage_fault(esf);
+			reason = usage_fault(esf, recoverable);
 #if defined(CONFIG_ARM_SECURE_FIRMWARE)
 		} else if (SAU->SFSR != 0) {
 			reason = secure_fault(esf);
@@ -792,7 +804,7 @@ static uint32_t fault_handle(struct arch_esf *esf, int fault, bool *recoverable)
 		reason = bus_fault(esf, 0, recoverable);
 		break;
 	case 6:
-		reason = usage_fault(esf);
+		reason = usage_fault(esf, recoverable);
 		break;
 #if defined(CONFIG_ARM_SECURE_FIRMWARE)
 	case 7:
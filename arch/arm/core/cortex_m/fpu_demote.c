@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/barrier.h>
+#include <string.h>
+#include <cmsis_core.h>
+
+/**
+ * @file
+ * @brief Demotion of inactive FP contexts
+ *
+ * Under CONFIG_FPU_SHARING a thread that executes a single FP instruction
+ * sets CONTROL.FPCA and, from then on, stacks an extended exception frame
+ * and saves/restores s16-s31 at every context switch. The routines in this
+ * file demote the FP context of threads that keep it active for
+ * CONFIG_FPU_SHARING_DEMOTION_SWITCHES consecutive switch-outs: the
+ * caller-saved half of the context is lifted out of the stacked extended
+ * frame, the frame is converted to a basic one, and FPU access is disabled
+ * via CPACR while the thread runs. The first FP instruction the thread
+ * executes afterwards raises a NOCP UsageFault; z_arm_fpu_promote()
+ * restores the full FP context from memory and the faulting instruction is
+ * retried.
+ */
+
+/* Word offsets within the extended exception stack frame */
+#define ESF_FPU_S0_OFFSET    8U  /* s0-s15 follow the 8 basic frame words */
+#define ESF_FPU_FPSCR_OFFSET 24U
+#define ESF_EXT_WORDS        26U /* basic frame, s0-s15, FPSCR, reserved */
+#define ESF_BASIC_WORDS      8U
+
+#if defined(CONFIG_USERSPACE)
+#define FPU_ACCESS_BITS (CPACR_CP10_FULL_ACCESS | CPACR_CP11_FULL_ACCESS)
+#else
+#define FPU_ACCESS_BITS (CPACR_CP10_PRIV_ACCESS | CPACR_CP11_PRIV_ACCESS)
+#endif
+
+static void fpu_access_update(bool enable)
+{
+	uint32_t cpacr = SCB->CPACR;
+	uint32_t access = enable ? FPU_ACCESS_BITS : 0U;
+
+	if ((cpacr & (CPACR_CP10_Msk | CPACR_CP11_Msk)) != access) {
+		SCB->CPACR = (cpacr & ~(CPACR_CP10_Msk | CPACR_CP11_Msk)) | access;
+		barrier_isync_fence_full();
+	}
+}
+
+/* Called from the PendSV handler after the callee-saved FP registers of the
+ * switched-out thread have been stored (which also flushed any pending lazy
+ * FP state to the thread's extended exception frame).
+ */
+void z_arm_fpu_switch_out(struct k_thread *thread)
+{
+	uint32_t *frame;
+
+	if ((thread->arch.mode_exc_return & _EXC_RETURN_FTYPE_Msk) != 0U) {
+		/* No FP context was stacked for this switch. A thread that
+		 * was re-promoted by a NOCP fault but preempted before
+		 * executing an FP instruction stays demoted and will simply
+		 * fault and restore again.
+		 */
+		return;
+	}
+
+	thread->arch.fpu_stack_count++;
+	/* An active FP context supersedes any earlier demotion */
+	thread->arch.fpu_demoted = 0U;
+
+	if (++thread->arch.fpu_active_switches < CONFIG_FPU_SHARING_DEMOTION_SWITCHES) {
+		return;
+	}
+	thread->arch.fpu_active_switches = 0U;
+
+	/* Demote: lift s0-s15 and FPSCR out of the stacked extended frame
+	 * (s16-s31 have just been stored to preempt_float), convert the
+	 * frame to a basic one and mark the thread as having no FP context.
+	 */
+	frame = (uint32_t *)thread->callee_saved.psp;
+
+	(void)memcpy(thread->arch.demoted_fp_caller, &frame[ESF_FPU_S0_OFFSET],
+		     sizeof(thread->arch.demoted_fp_caller));
+	thread->arch.demoted_fpscr = frame[ESF_FPU_FPSCR_OFFSET];
+
+	/* The basic frame moves up over the FP area; the stack alignment
+	 * recorded in the stacked xPSR remains valid, as the frame shrinks
+	 * by a multiple of 8 bytes.
+	 */
+	(void)memcpy(&frame[ESF_EXT_WORDS - ESF_BASIC_WORDS], frame,
+		     ESF_BASIC_WORDS * sizeof(uint32_t));
+	thread->callee_saved.psp += (ESF_EXT_WORDS - ESF_BASIC_WORDS) * sizeof(uint32_t);
+
+	thread->arch.mode_exc_return |= _EXC_RETURN_FTYPE_Msk;
+	thread->arch.fpu_demoted = 1U;
+}
+
+/* Called from the PendSV handler before any FP context is restored for the
+ * switched-in thread. Returns non-zero if the thread's FP context is
+ * demoted, in which case FPU access has been disabled and the handler must
+ * not execute FP instructions on the thread's behalf.
+ */
+uint32_t z_arm_fpu_switch_in(struct k_thread *thread)
+{
+	fpu_access_update(thread->arch.fpu_demoted == 0U);
+
+	return thread->arch.fpu_demoted;
+}
+
+/* Called on a NOCP UsageFault; returns true if the fault was a demoted
+ * thread touching the FPU again, in which case its FP context has been
+ * restored and the faulting instruction can be retried.
+ */
+bool z_arm_fpu_promote(void)
+{
+	struct k_thread *thread = _current;
+
+	if (thread->arch.fpu_demoted == 0U) {
+		return false;
+	}
+
+	/* Only faults taken directly from Thread mode are FP accesses of
+	 * the demoted thread itself; the FPU may not be used from ISRs.
+	 */
+	if ((SCB->ICSR & SCB_ICSR_RETTOBASE_Msk) == 0U) {
+		return false;
+	}
+
+	fpu_access_update(true);
+
+	/* Reload the saved FP context directly into the FP unit. The
+	 * fpu_demoted flag remains set until the thread is next switched
+	 * out with an active FP context, so if it is preempted before the
+	 * retried instruction executes (leaving the registers unpreserved),
+	 * the next FP access simply faults and restores again.
+	 */
+	__asm__ volatile("vldmia %0, {s0-s15}\n"
+			 "vldmia %1, {s16-s31}\n" ::"r"(thread->arch.demoted_fp_caller),
+			 "r"(&thread->arch.preempt_float)
+			 :);
+	__set_FPSCR(thread->arch.demoted_fpscr);
+
+	thread->arch.fpu_trap_count++;
+	thread->arch.fpu_active_switches = 0U;
+
+	return true;
+}
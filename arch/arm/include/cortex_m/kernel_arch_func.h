@@ -37,6 +37,11 @@ extern int z_arm_mpu_init(void);
 #ifdef CONFIG_ARM_AARCH32_MMU
 extern int z_arm_mmu_init(void);
 #endif /* CONFIG_ARM_AARCH32_MMU */
+#ifdef CONFIG_FPU_SHARING_DEMOTION
+extern void z_arm_fpu_switch_out(struct k_thread *thread);
+extern uint32_t z_arm_fpu_switch_in(struct k_thread *thread);
+extern bool z_arm_fpu_promote(void);
+#endif /* CONFIG_FPU_SHARING_DEMOTION */
 
 static ALWAYS_INLINE void arch_kernel_init(void)
 {
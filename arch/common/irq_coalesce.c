@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/irq.h>
+#include <zephyr/irq_coalesce.h>
+#include <zephyr/kernel.h>
+
+static void irq_coalesce_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct irq_coalesce *ic = CONTAINER_OF(dwork, struct irq_coalesce, work);
+	k_spinlock_key_t key;
+	uint32_t events;
+	bool masked;
+
+	key = k_spin_lock(&ic->lock);
+
+	events = ic->pending;
+	ic->pending = 0;
+	masked = ic->masked;
+	ic->masked = false;
+
+	ic->stats.batches++;
+	ic->stats.max_batch = MAX(ic->stats.max_batch, events);
+
+	k_spin_unlock(&ic->lock, key);
+
+	if (events > 0) {
+		ic->cb(ic->user_data, events);
+	}
+
+	/* Unmask only after the device has been drained, otherwise the line
+	 * would fire again right away.
+	 */
+	if (masked) {
+		irq_enable(ic->irq);
+	}
+}
+
+void irq_coalesce_init(struct irq_coalesce *ic, unsigned int irq, uint32_t max_events,
+		       k_timeout_t max_latency, irq_coalesce_cb_t cb, void *user_data)
+{
+	__ASSERT(max_events > 0, "event threshold must be non-zero");
+
+	ic->irq = irq;
+	ic->max_events = max_events;
+	ic->max_latency = max_latency;
+	ic->cb = cb;
+	ic->user_data = user_data;
+	ic->pending = 0;
+	ic->masked = false;
+	ic->stats = (struct irq_coalesce_stats){0};
+
+	k_work_init_delayable(&ic->work, irq_coalesce_work_handler);
+}
+
+void irq_coalesce_event(struct irq_coalesce *ic)
+{
+	k_spinlock_key_t key = k_spin_lock(&ic->lock);
+
+	ic->pending++;
+	ic->stats.events++;
+
+	if (ic->pending >= ic->max_events) {
+		/* Batch is full: stop taking interrupts for this line and
+		 * process it as soon as the workqueue runs.
+		 */
+		if (!ic->masked) {
+			irq_disable(ic->irq);
+			ic->masked = true;
+		}
+		k_work_reschedule(&ic->work, K_NO_WAIT);
+	} else if (ic->pending == 1) {
+		/* First event of a batch starts the latency budget */
+		k_work_schedule(&ic->work, ic->max_latency);
+	}
+
+	k_spin_unlock(&ic->lock, key);
+}
+
+void irq_coalesce_flush(struct irq_coalesce *ic)
+{
+	k_work_reschedule(&ic->work, K_NO_WAIT);
+}
+
+void irq_coalesce_stats_get(struct irq_coalesce *ic, struct irq_coalesce_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&ic->lock);
+
+	*stats = ic->stats;
+
+	k_spin_unlock(&ic->lock, key);
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <string.h>
+
+/**
+ * @file
+ * @brief Optimized string routines
+ *
+ * Replacements for the generic minimal libc memcpy(), memset() and
+ * memcmp(), selected with CONFIG_RISCV_OPTIMIZED_STRING_FUNCS.
+ *
+ * Bulk copies and fills use vector-length agnostic loops from the "V"
+ * extension. The kernel does not preserve vector state across context
+ * switches, so interrupts are masked around each vsetvli plus
+ * load/store sequence; neither the vector registers nor vl/vtype carry
+ * live data outside that window. Word-wise compares rely on the Zbb
+ * count-trailing-zeros instruction to locate the first differing byte.
+ */
+
+#if defined(CONFIG_RISCV_ISA_EXT_V)
+
+void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
+{
+	unsigned char *dst = d;
+	const unsigned char *src = s;
+
+	if (n == 0) {
+		return d;
+	}
+
+	/* Byte-element accesses have no alignment requirement. LMUL=8
+	 * moves up to eight vector registers per iteration. Interrupts
+	 * are masked before vsetvli so that a nested memcpy()/memset()
+	 * in an ISR cannot rewrite vl/vtype between the configuration
+	 * and the load/store pair that relies on it.
+	 */
+	__asm__ volatile(
+		"1:\n\t"
+		"csrrci t1, mstatus, %[ien]\n\t"
+		"vsetvli t0, %2, e8, m8, ta, ma\n\t"
+		"vle8.v v0, (%1)\n\t"
+		"vse8.v v0, (%0)\n\t"
+		"andi t1, t1, %[ien]\n\t"
+		"beqz t1, 2f\n\t"
+		"csrsi mstatus, %[ien]\n\t"
+		"2:\n\t"
+		"add %0, %0, t0\n\t"
+		"add %1, %1, t0\n\t"
+		"sub %2, %2, t0\n\t"
+		"bnez %2, 1b"
+		: "+r"(dst), "+r"(src), "+r"(n)
+		: [ien] "i"(MSTATUS_IEN)
+		: "t0", "t1", "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7",
+		  "memory");
+
+	return d;
+}
+
+void *memset(void *buf, int c, size_t n)
+{
+	unsigned char *dst = buf;
+
+	if (n == 0) {
+		return buf;
+	}
+
+	__asm__ volatile(
+		"1:\n\t"
+		"csrrci t1, mstatus, %[ien]\n\t"
+		"vsetvli t0, %1, e8, m8, ta, ma\n\t"
+		"vmv.v.x v0, %2\n\t"
+		"vse8.v v0, (%0)\n\t"
+		"andi t1, t1, %[ien]\n\t"
+		"beqz t1, 2f\n\t"
+		"csrsi mstatus, %[ien]\n\t"
+		"2:\n\t"
+		"add %0, %0, t0\n\t"
+		"sub %1, %1, t0\n\t"
+		"bnez %1, 1b"
+		: "+r"(dst), "+r"(n)
+		: "r"(c), [ien] "i"(MSTATUS_IEN)
+		: "t0", "t1", "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7",
+		  "memory");
+
+	return buf;
+}
+
+#else /* CONFIG_RISCV_ISA_EXT_V */
+
+void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
+{
+	unsigned char *dst = d;
+	const unsigned char *src = s;
+	const uintptr_t mask = sizeof(unsigned long) - 1;
+
+	/* Word-sized copying when the buffers have identical alignment */
+	if ((((uintptr_t)dst ^ (uintptr_t)src) & mask) == 0) {
+		while ((((uintptr_t)dst & mask) != 0) && (n > 0)) {
+			*dst++ = *src++;
+			n--;
+		}
+
+		while (n >= sizeof(unsigned long)) {
+			*(unsigned long *)dst = *(const unsigned long *)src;
+			dst += sizeof(unsigned long);
+			src += sizeof(unsigned long);
+			n -= sizeof(unsigned long);
+		}
+	}
+
+	while (n > 0) {
+		*dst++ = *src++;
+		n--;
+	}
+
+	return d;
+}
+
+void *memset(void *buf, int c, size_t n)
+{
+	unsigned char *dst = buf;
+	const uintptr_t mask = sizeof(unsigned long) - 1;
+	unsigned long word = (unsigned char)c;
+
+	word |= word << 8;
+	word |= word << 16;
+#ifdef CONFIG_64BIT
+	word |= word << 32;
+#endif
+
+	while ((((uintptr_t)dst & mask) != 0) && (n > 0)) {
+		*dst++ = (unsigned char)c;
+		n--;
+	}
+
+	while (n >= sizeof(unsigned long)) {
+		*(unsigned long *)dst = word;
+		dst += sizeof(unsigned long);
+		n -= sizeof(unsigned long);
+	}
+
+	while (n > 0) {
+		*dst++ = (unsigned char)c;
+		n--;
+	}
+
+	return buf;
+}
+
+#endif /* CONFIG_RISCV_ISA_EXT_V */
+
+int memcmp(const void *m1, const void *m2, size_t n)
+{
+	const unsigned char *c1 = m1;
+	const unsigned char *c2 = m2;
+
+#if defined(CONFIG_RISCV_ISA_EXT_ZBB)
+	const uintptr_t mask = sizeof(unsigned long) - 1;
+
+	/* Word-wise compare when both operands share alignment */
+	if ((((uintptr_t)c1 ^ (uintptr_t)c2) & mask) == 0) {
+		while ((((uintptr_t)c1 & mask) != 0) && (n > 0)) {
+			if (*c1 != *c2) {
+				return *c1 - *c2;
+			}
+			c1++;
+			c2++;
+			n--;
+		}
+
+		while (n >= sizeof(unsigned long)) {
+			unsigned long w1 = *(const unsigned long *)c1;
+			unsigned long w2 = *(const unsigned long *)c2;
+
+			if (w1 != w2) {
+				/* Little-endian: the lowest differing byte
+				 * decides the result; ctz finds it in one
+				 * instruction.
+				 */
+				unsigned int shift =
+					(unsigned int)__builtin_ctzl(w1 ^ w2) & ~7U;
+
+				return (int)((w1 >> shift) & 0xffU) -
+				       (int)((w2 >> shift) & 0xffU);
+			}
+			c1 += sizeof(unsigned long);
+			c2 += sizeof(unsigned long);
+			n -= sizeof(unsigned long);
+		}
+	}
+#endif /* CONFIG_RISCV_ISA_EXT_ZBB */
+
+	while (n > 0) {
+		if (*c1 != *c2) {
+			return *c1 - *c2;
+		}
+		c1++;
+		c2++;
+		n--;
+	}
+
+	return 0;
+}
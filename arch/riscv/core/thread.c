@@ -73,6 +73,14 @@ void arch_new_thread(struct k_thread *thread, k_thread_stack_t *stack,
 	stack_init->mstatus |= MSTATUS_FS_INIT;
 #endif
 
+#if defined(CONFIG_RISCV_ISA_EXT_V)
+	/* The vector unit is enabled for every thread; vector state is not
+	 * preserved across context switches, so in-kernel users must keep
+	 * vector register liveness confined to an interrupt-locked window.
+	 */
+	stack_init->mstatus |= MSTATUS_VS_INIT;
+#endif
+
 #if defined(CONFIG_USERSPACE)
 	/* Clear user thread context */
 	z_riscv_pmp_usermode_init(thread);
@@ -24,6 +24,10 @@ zephyr_linker_section(NAME device_states GROUP DATA_REGION NOINPUT ${XIP_ALIGN_W
 zephyr_linker_section_configure(SECTION device_states
   KEEP INPUT ".z_devstate" ".z_devstate.*"
 )
+# Driver data tagged __hot_device_data, kept contiguous with the device states.
+zephyr_linker_section_configure(SECTION device_states
+  INPUT ".device_hot_data" ".device_hot_data.*"
+)
 
 if(CONFIG_PM_DEVICE)
   zephyr_iterable_section(NAME pm_device_slots GROUP DATA_REGION ${XIP_ALIGN_WITH_INPUT} SUBALIGN ${CONFIG_LINKER_ITERABLE_SUBALIGN})
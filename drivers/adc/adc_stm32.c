@@ -175,6 +175,13 @@ struct adc_stm32_data {
 #ifdef CONFIG_ADC_STM32_DMA
 	volatile int dma_error;
 	struct stream dma;
+#ifdef CONFIG_ADC_CONTINUOUS
+	adc_continuous_callback continuous_callback;
+	void *continuous_user_data;
+	uint8_t *continuous_buffer;
+	size_t continuous_half_size;
+	volatile bool continuous_active;
+#endif /* CONFIG_ADC_CONTINUOUS */
 #endif
 };
 
@@ -194,10 +201,13 @@ struct adc_stm32_cfg {
 };
 
 #ifdef CONFIG_ADC_STM32_DMA
-static void adc_stm32_enable_dma_support(ADC_TypeDef *adc)
+static void adc_stm32_enable_dma_support(ADC_TypeDef *adc, bool circular)
 {
-	/* Allow ADC to create DMA request and set to one-shot mode as implemented in HAL drivers */
+	/* Allow ADC to create DMA request, in one-shot mode as implemented in
+	 * HAL drivers, or in unlimited mode when the DMA channel is circular.
+	 */
 #if DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc)
+	ARG_UNUSED(circular);
 	LL_ADC_REG_SetDMATransfer(adc, LL_ADC_REG_DMA_TRANSFER_UNLIMITED);
 #elif defined(CONFIG_SOC_SERIES_STM32H7X) || \
 	defined(CONFIG_SOC_SERIES_STM32N6X) || \
@@ -205,15 +215,17 @@ static void adc_stm32_enable_dma_support(ADC_TypeDef *adc)
 	/* H72x ADC3 and U5 ADC4 are different from the rest, but this call works also for them,
 	 * so no need to call their specific function
 	 */
-	LL_ADC_REG_SetDataTransferMode(adc, LL_ADC_REG_DMA_TRANSFER_LIMITED);
+	LL_ADC_REG_SetDataTransferMode(adc, circular ? LL_ADC_REG_DMA_TRANSFER_UNLIMITED
+						     : LL_ADC_REG_DMA_TRANSFER_LIMITED);
 #else
 	/* Default mechanism for other MCUs */
-	LL_ADC_REG_SetDMATransfer(adc, LL_ADC_REG_DMA_TRANSFER_LIMITED);
+	LL_ADC_REG_SetDMATransfer(adc, circular ? LL_ADC_REG_DMA_TRANSFER_UNLIMITED
+						: LL_ADC_REG_DMA_TRANSFER_LIMITED);
 #endif
 }
 
 static int adc_stm32_dma_start(const struct device *dev,
-			       void *buffer, size_t channel_count)
+			       void *buffer, size_t sample_count, bool circular)
 {
 	const struct adc_stm32_cfg *config = dev->config;
 	ADC_TypeDef *adc = config->base;
@@ -226,16 +238,18 @@ static int adc_stm32_dma_start(const struct device *dev,
 	blk_cfg = &dma->dma_blk_cfg;
 
 	/* prepare the block */
-	blk_cfg->block_size = channel_count * sizeof(adc_data_size_t);
+	blk_cfg->block_size = sample_count * sizeof(adc_data_size_t);
 
-	/* Source and destination */
+	/* Source and destination; reloading both addresses makes the DMA
+	 * channel circular, so the block is transferred over and over again
+	 */
 	blk_cfg->source_address = (uint32_t)LL_ADC_DMA_GetRegAddr(adc, LL_ADC_DMA_REG_REGULAR_DATA);
 	blk_cfg->source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
-	blk_cfg->source_reload_en = 0;
+	blk_cfg->source_reload_en = circular ? 1 : 0;
 
 	blk_cfg->dest_address = (uint32_t)buffer;
 	blk_cfg->dest_addr_adj = DMA_ADDR_ADJ_INCREMENT;
-	blk_cfg->dest_reload_en = 0;
+	blk_cfg->dest_reload_en = circular ? 1 : 0;
 
 	/* Manually set the FIFO threshold to 1/4 because the
 	 * dmamux DTS entry does not contain fifo threshold
@@ -253,7 +267,7 @@ static int adc_stm32_dma_start(const struct device *dev,
 		return ret;
 	}
 
-	adc_stm32_enable_dma_support(adc);
+	adc_stm32_enable_dma_support(adc, circular);
 
 	data->dma_error = 0;
 	ret = dma_start(data->dma.dma_dev, data->dma.channel);
@@ -773,6 +787,69 @@ static int adc_stm32_oversampling(const struct device *dev, uint8_t ratio)
 #endif /* CONFIG_SOC_SERIES_STM32xxx */
 
 #ifdef CONFIG_ADC_STM32_DMA
+#ifdef CONFIG_ADC_CONTINUOUS
+/* Stop the hardware side of a continuous sampling. Does not release the
+ * context lock, as this is also called from the DMA error path where the
+ * lock must be released with the error status.
+ */
+static void adc_stm32_continuous_stop_hw(const struct device *dev)
+{
+	const struct adc_stm32_cfg *config = dev->config;
+	struct adc_stm32_data *data = dev->data;
+	__maybe_unused ADC_TypeDef *adc = config->base;
+
+	data->continuous_active = false;
+
+#if !DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc) && \
+	!DT_HAS_COMPAT_STATUS_OKAY(st_stm32f4_adc)
+	if (LL_ADC_REG_IsConversionOngoing(adc)) {
+		LL_ADC_REG_StopConversion(adc);
+		while (LL_ADC_REG_IsConversionOngoing(adc)) {
+		}
+	}
+#endif
+
+	LL_ADC_REG_SetContinuousMode(adc, LL_ADC_REG_CONV_SINGLE);
+
+	dma_stop(data->dma.dma_dev, data->dma.channel);
+
+	pm_policy_state_lock_put(PM_STATE_SUSPEND_TO_IDLE, PM_ALL_SUBSTATES);
+	if (IS_ENABLED(CONFIG_PM_S2RAM)) {
+		pm_policy_state_lock_put(PM_STATE_SUSPEND_TO_RAM,
+					 PM_ALL_SUBSTATES);
+	}
+}
+
+/* Called from the DMA callback after each filled half of the ring buffer
+ * (DMA_STATUS_BLOCK for the first half, DMA_STATUS_COMPLETE for the second
+ * one, as the channel is configured as circular) or on a DMA error.
+ */
+static void adc_stm32_continuous_sampling_done(const struct device *dev,
+					       int status)
+{
+	struct adc_stm32_data *data = dev->data;
+	struct adc_continuous_event event = {
+		.timestamp = k_cycle_get_32(),
+	};
+
+	if (status < 0) {
+		LOG_ERR("DMA error %d during continuous sampling", status);
+		event.error = status;
+		adc_stm32_continuous_stop_hw(dev);
+		adc_context_release(&data->ctx, status);
+	} else if (status == DMA_STATUS_BLOCK) {
+		event.samples = data->continuous_buffer;
+		event.size = data->continuous_half_size;
+	} else {
+		event.samples = data->continuous_buffer +
+				data->continuous_half_size;
+		event.size = data->continuous_half_size;
+	}
+
+	data->continuous_callback(dev, &event, data->continuous_user_data);
+}
+#endif /* CONFIG_ADC_CONTINUOUS */
+
 static void dma_callback(const struct device *dev, void *user_data,
 			 uint32_t channel, int status)
 {
@@ -791,8 +868,22 @@ static void dma_callback(const struct device *dev, void *user_data,
 			LL_ADC_ClearFlag_OVR(adc);
 			LOG_ERR("ADC overrun error occurred. Reduce clock source frequency, "
 				"increase prescaler value or increase sampling times.");
+#ifdef CONFIG_ADC_CONTINUOUS
+			if (data->continuous_active && status >= 0) {
+				/* Samples were lost, the ring buffer content
+				 * is no longer contiguous in time.
+				 */
+				status = -EIO;
+			}
+#endif /* CONFIG_ADC_CONTINUOUS */
 		}
 #endif /* !DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc) */
+#ifdef CONFIG_ADC_CONTINUOUS
+		if (data->continuous_active) {
+			adc_stm32_continuous_sampling_done(data->dev, status);
+			return;
+		}
+#endif /* CONFIG_ADC_CONTINUOUS */
 		if (status >= 0) {
 			data->samples_count = data->channel_count;
 			data->buffer += data->channel_count;
@@ -1090,7 +1181,7 @@ static void adc_context_start_sampling(struct adc_context *ctx)
 	/* Make sure DMA bit of ADC register CR2 is set to 0 before starting a DMA transfer */
 	LL_ADC_REG_SetDMATransfer(adc, LL_ADC_REG_DMA_TRANSFER_NONE);
 #endif
-	adc_stm32_dma_start(dev, data->buffer, data->channel_count);
+	adc_stm32_dma_start(dev, data->buffer, data->channel_count, false);
 #endif
 	adc_stm32_start_conversion(dev);
 }
@@ -1203,6 +1294,154 @@ static int adc_stm32_read_async(const struct device *dev,
 }
 #endif
 
+#if defined(CONFIG_ADC_CONTINUOUS) && defined(CONFIG_ADC_STM32_DMA)
+static int adc_stm32_continuous_start(const struct device *dev,
+				      const struct adc_sequence *sequence,
+				      adc_continuous_callback callback,
+				      void *user_data)
+{
+	const struct adc_stm32_cfg *config = dev->config;
+	struct adc_stm32_data *data = dev->data;
+	ADC_TypeDef *adc = config->base;
+	size_t sampling_size;
+	int err;
+
+	if (callback == NULL || sequence->options != NULL) {
+		return -EINVAL;
+	}
+
+	adc_context_lock(&data->ctx, false, NULL);
+
+	data->channels = sequence->channels;
+	data->channel_count = POPCOUNT(data->channels);
+	data->samples_count = 0;
+
+	if (data->channel_count == 0) {
+		LOG_ERR("No channels selected");
+		err = -EINVAL;
+		goto error;
+	}
+
+#if ANY_ADC_SEQUENCER_TYPE_IS(FULLY_CONFIGURABLE)
+	if (data->channel_count > ARRAY_SIZE(table_seq_len)) {
+		LOG_ERR("Too many channels for sequencer. Max: %d", ARRAY_SIZE(table_seq_len));
+		err = -EINVAL;
+		goto error;
+	}
+#endif /* ANY_ADC_SEQUENCER_TYPE_IS(FULLY_CONFIGURABLE) */
+
+	/* Each half of the ring buffer must hold a whole number of samplings */
+	sampling_size = data->channel_count * sizeof(adc_data_size_t);
+	if (sequence->buffer_size == 0 ||
+	    sequence->buffer_size % (2 * sampling_size) != 0) {
+		LOG_ERR("Ring buffer size %u is not a multiple of two samplings",
+			sequence->buffer_size);
+		err = -EINVAL;
+		goto error;
+	}
+
+#if defined(CONFIG_SOC_SERIES_STM32H7X)
+	/* Buffer is forced to be in non-cacheable SRAM region to avoid cache maintenance */
+	if (!buf_in_nocache((uintptr_t)sequence->buffer, sequence->buffer_size)) {
+		LOG_ERR("Supplied buffer is not in a non-cacheable region according to DTS.");
+		err = -EINVAL;
+		goto error;
+	}
+#endif
+
+	err = set_resolution(dev, sequence);
+	if (err < 0) {
+		goto error;
+	}
+
+	err = set_sequencer(dev);
+	if (err < 0) {
+		goto error;
+	}
+
+#ifdef HAS_OVERSAMPLING
+	err = adc_stm32_oversampling(dev, sequence->oversampling);
+	if (err) {
+		goto error;
+	}
+#else
+	if (sequence->oversampling) {
+		LOG_ERR("Oversampling not supported");
+		err = -ENOTSUP;
+		goto error;
+	}
+#endif /* HAS_OVERSAMPLING */
+
+	if (sequence->calibrate) {
+#if defined(HAS_CALIBRATION)
+		adc_stm32_calibrate(dev);
+#else
+		LOG_ERR("Calibration not supported");
+		err = -ENOTSUP;
+		goto error;
+#endif
+	}
+
+	adc_stm32_enable(adc);
+
+#if !DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc)
+	LL_ADC_ClearFlag_OVR(adc);
+#endif /* !DT_HAS_COMPAT_STATUS_OKAY(st_stm32f1_adc) */
+
+	data->continuous_callback = callback;
+	data->continuous_user_data = user_data;
+	data->continuous_buffer = sequence->buffer;
+	data->continuous_half_size = sequence->buffer_size / 2;
+	data->continuous_active = true;
+
+	/* Restart the sequence from hardware as soon as it completes */
+	LL_ADC_REG_SetContinuousMode(adc, LL_ADC_REG_CONV_CONTINUOUS);
+
+#if DT_HAS_COMPAT_STATUS_OKAY(st_stm32f4_adc)
+	/* Make sure DMA bit of ADC register CR2 is set to 0 before starting a DMA transfer */
+	LL_ADC_REG_SetDMATransfer(adc, LL_ADC_REG_DMA_TRANSFER_NONE);
+#endif
+	err = adc_stm32_dma_start(dev, sequence->buffer,
+				  sequence->buffer_size / sizeof(adc_data_size_t),
+				  true);
+	if (err < 0) {
+		data->continuous_active = false;
+		LL_ADC_REG_SetContinuousMode(adc, LL_ADC_REG_CONV_SINGLE);
+		goto error;
+	}
+
+	pm_policy_state_lock_get(PM_STATE_SUSPEND_TO_IDLE, PM_ALL_SUBSTATES);
+	if (IS_ENABLED(CONFIG_PM_S2RAM)) {
+		pm_policy_state_lock_get(PM_STATE_SUSPEND_TO_RAM, PM_ALL_SUBSTATES);
+	}
+
+	adc_stm32_start_conversion(dev);
+
+	/* Keep the context locked, the ADC stays busy until
+	 * adc_stm32_continuous_stop() or an error in the DMA callback.
+	 */
+	return 0;
+
+error:
+	adc_context_release(&data->ctx, err);
+	return err;
+}
+
+static int adc_stm32_continuous_stop(const struct device *dev)
+{
+	struct adc_stm32_data *data = dev->data;
+
+	if (!data->continuous_active) {
+		return -EINVAL;
+	}
+
+	adc_stm32_continuous_stop_hw(dev);
+	adc_context_release(&data->ctx, 0);
+
+	return 0;
+}
+#endif /* CONFIG_ADC_CONTINUOUS && CONFIG_ADC_STM32_DMA */
+
 static int adc_stm32_sampling_time_check(const struct device *dev, uint16_t acq_time)
 {
 	const struct adc_stm32_cfg *config =
@@ -1746,6 +1985,10 @@ static DEVICE_API(adc, api_stm32_driver_api) = {
 	.read = adc_stm32_read,
 #ifdef CONFIG_ADC_ASYNC
 	.read_async = adc_stm32_read_async,
+#endif
+#if defined(CONFIG_ADC_CONTINUOUS) && defined(CONFIG_ADC_STM32_DMA)
+	.continuous_start = adc_stm32_continuous_start,
+	.continuous_stop = adc_stm32_continuous_stop,
 #endif
 	.ref_internal = STM32_ADC_VREF_MV, /* VREF is usually connected to VDD */
 };
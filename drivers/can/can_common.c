@@ -449,3 +449,204 @@ int z_impl_can_set_bitrate_data(const struct device *dev, uint32_t bitrate_data)
 	return can_set_timing_data(dev, &timing_data);
 }
 #endif /* CONFIG_CAN_FD_MODE */
+
+#ifdef CONFIG_CAN_TX_QUEUE
+
+/* Map the arbitration field of a CAN frame to a single comparable value
+ * reflecting CAN bus arbitration: the base ID goes into the most significant
+ * bits, followed by the IDE bit (standard frames win over extended frames
+ * with an identical base ID), the extended ID bits and the RTR bit (data
+ * frames win over RTR frames). A lower value means a higher priority.
+ */
+static uint32_t can_tx_queue_frame_prio(const struct can_frame *frame)
+{
+	uint32_t prio;
+
+	if ((frame->flags & CAN_FRAME_IDE) != 0U) {
+		prio = ((frame->id >> 18) << 21) | BIT(20) |
+		       ((frame->id & BIT_MASK(18)) << 2);
+	} else {
+		prio = frame->id << 21;
+	}
+
+	if ((frame->flags & CAN_FRAME_RTR) != 0U) {
+		prio |= BIT(1);
+	}
+
+	return prio;
+}
+
+static void can_tx_queue_insert_locked(struct can_tx_queue *queue,
+				       struct can_tx_queue_frame *entry)
+{
+	uint32_t prio = can_tx_queue_frame_prio(&entry->frame);
+	struct can_tx_queue_frame *pos;
+	sys_snode_t *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->frames, pos, node) {
+		if (can_tx_queue_frame_prio(&pos->frame) > prio) {
+			break;
+		}
+
+		prev = &pos->node;
+	}
+
+	if (prev == NULL) {
+		sys_slist_prepend(&queue->frames, &entry->node);
+	} else {
+		sys_slist_insert(&queue->frames, prev, &entry->node);
+	}
+}
+
+static void can_tx_queue_done_cb(const struct device *dev, int error, void *user_data)
+{
+	struct can_tx_queue_frame *entry = user_data;
+	struct can_tx_queue *queue = entry->queue;
+	k_spinlock_key_t key;
+	bool more;
+
+	key = k_spin_lock(&queue->lock);
+	queue->pending--;
+	if (error == 0) {
+		queue->stats.sent++;
+	} else {
+		queue->stats.errors++;
+	}
+	more = !sys_slist_is_empty(&queue->frames);
+	k_spin_unlock(&queue->lock, key);
+
+	if (entry->callback != NULL) {
+		entry->callback(dev, error, entry->user_data);
+	}
+
+	/* Refill the freed mailbox from the queue */
+	if (more) {
+		k_work_submit(&queue->work);
+	}
+}
+
+static void can_tx_queue_work_handler(struct k_work *work)
+{
+	struct can_tx_queue *queue = CONTAINER_OF(work, struct can_tx_queue, work);
+	struct can_tx_queue_frame *entry;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+	int err;
+
+	key = k_spin_lock(&queue->lock);
+
+	while ((node = sys_slist_get(&queue->frames)) != NULL) {
+		entry = CONTAINER_OF(node, struct can_tx_queue_frame, node);
+		k_spin_unlock(&queue->lock, key);
+
+		err = can_send(queue->dev, &entry->frame, K_NO_WAIT,
+			       can_tx_queue_done_cb, entry);
+
+		key = k_spin_lock(&queue->lock);
+
+		if (err == -EAGAIN) {
+			/* All TX mailboxes in use, put the frame back and
+			 * wait for a transmit completion.
+			 */
+			can_tx_queue_insert_locked(queue, entry);
+			break;
+		}
+
+		if (err != 0) {
+			/* Rejected by the driver, drop the frame */
+			queue->pending--;
+			queue->stats.errors++;
+			k_spin_unlock(&queue->lock, key);
+
+			if (entry->callback != NULL) {
+				entry->callback(queue->dev, err, entry->user_data);
+			}
+
+			key = k_spin_lock(&queue->lock);
+		}
+	}
+
+	k_spin_unlock(&queue->lock, key);
+}
+
+void can_tx_queue_init(struct can_tx_queue *queue, const struct device *dev)
+{
+	__ASSERT_NO_MSG(queue != NULL);
+	__ASSERT_NO_MSG(dev != NULL);
+
+	queue->dev = dev;
+	queue->pending = 0U;
+	sys_slist_init(&queue->frames);
+	k_work_init(&queue->work, can_tx_queue_work_handler);
+	memset(&queue->stats, 0, sizeof(queue->stats));
+}
+
+int can_tx_queue_put(struct can_tx_queue *queue, struct can_tx_queue_frame *entry,
+		     const struct can_frame *frame, can_tx_callback_t callback,
+		     void *user_data)
+{
+	k_spinlock_key_t key;
+
+	CHECKIF(queue == NULL || entry == NULL || frame == NULL) {
+		return -EINVAL;
+	}
+
+	entry->queue = queue;
+	entry->frame = *frame;
+	entry->callback = callback;
+	entry->user_data = user_data;
+
+	key = k_spin_lock(&queue->lock);
+	can_tx_queue_insert_locked(queue, entry);
+	queue->pending++;
+	queue->stats.enqueued++;
+	queue->stats.max_pending = MAX(queue->stats.max_pending, queue->pending);
+	k_spin_unlock(&queue->lock, key);
+
+	k_work_submit(&queue->work);
+
+	return 0;
+}
+
+uint32_t can_tx_queue_purge(struct can_tx_queue *queue)
+{
+	struct can_tx_queue_frame *entry;
+	k_spinlock_key_t key;
+	sys_slist_t purged;
+	sys_snode_t *node;
+	uint32_t num = 0U;
+
+	sys_slist_init(&purged);
+
+	key = k_spin_lock(&queue->lock);
+
+	while ((node = sys_slist_get(&queue->frames)) != NULL) {
+		sys_slist_append(&purged, node);
+		queue->pending--;
+		queue->stats.errors++;
+		num++;
+	}
+
+	k_spin_unlock(&queue->lock, key);
+
+	while ((node = sys_slist_get(&purged)) != NULL) {
+		entry = CONTAINER_OF(node, struct can_tx_queue_frame, node);
+
+		if (entry->callback != NULL) {
+			entry->callback(queue->dev, -ECANCELED, entry->user_data);
+		}
+	}
+
+	return num;
+}
+
+void can_tx_queue_stats_get(struct can_tx_queue *queue, struct can_tx_queue_stats *stats)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&queue->lock);
+	*stats = queue->stats;
+	k_spin_unlock(&queue->lock, key);
+}
+
+#endif /* CONFIG_CAN_TX_QUEUE */
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/crypto/crypto.h>
+#include <zephyr/crypto/crypto_job.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(crypto_job, CONFIG_CRYPTO_LOG_LEVEL);
+
+/* queue of submitted crypto jobs */
+static sys_slist_t crypto_job_queue = SYS_SLIST_STATIC_INIT(&crypto_job_queue);
+
+static struct k_spinlock crypto_job_lock;
+
+static K_SEM_DEFINE(crypto_job_sem, 0, K_SEM_MAX_LIMIT);
+
+static int crypto_job_run_cipher(struct crypto_job *job)
+{
+	struct cipher_ctx *ctx = job->cipher.ctx;
+
+	switch (ctx->ops.cipher_mode) {
+	case CRYPTO_CIPHER_MODE_ECB:
+		return cipher_block_op(ctx, job->cipher.pkt);
+	case CRYPTO_CIPHER_MODE_CBC:
+		return cipher_cbc_op(ctx, job->cipher.pkt, job->cipher.iv);
+	case CRYPTO_CIPHER_MODE_CTR:
+		return cipher_ctr_op(ctx, job->cipher.pkt, job->cipher.iv);
+	case CRYPTO_CIPHER_MODE_CCM:
+		return cipher_ccm_op(ctx, job->cipher.aead_pkt, job->cipher.iv);
+	case CRYPTO_CIPHER_MODE_GCM:
+		return cipher_gcm_op(ctx, job->cipher.aead_pkt, job->cipher.iv);
+	default:
+		return -EINVAL;
+	}
+}
+
+static int crypto_job_run(struct crypto_job *job)
+{
+	switch (job->type) {
+	case CRYPTO_JOB_CIPHER:
+		return crypto_job_run_cipher(job);
+	case CRYPTO_JOB_HASH:
+		return hash_compute(job->hash.ctx, job->hash.pkt);
+	case CRYPTO_JOB_HASH_UPDATE:
+		return hash_update(job->hash.ctx, job->hash.pkt);
+	default:
+		return -EINVAL;
+	}
+}
+
+static void crypto_job_thread(void *p1, void *p2, void *p3)
+{
+	struct crypto_job *job;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+	int ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&crypto_job_sem, K_FOREVER);
+
+		key = k_spin_lock(&crypto_job_lock);
+		node = sys_slist_get(&crypto_job_queue);
+		k_spin_unlock(&crypto_job_lock, key);
+		if (node == NULL) {
+			continue;
+		}
+
+		job = CONTAINER_OF(node, struct crypto_job, node);
+		ret = crypto_job_run(job);
+		job->cb(job, ret);
+	}
+}
+
+K_THREAD_DEFINE(crypto_job_tid, CONFIG_CRYPTO_JOB_QUEUE_STACK_SIZE,
+		crypto_job_thread, NULL, NULL, NULL,
+		CONFIG_CRYPTO_JOB_QUEUE_THREAD_PRIORITY, 0, 0);
+
+int crypto_job_submit(struct crypto_job *job)
+{
+	k_spinlock_key_t key;
+
+	if ((job == NULL) || (job->cb == NULL)) {
+		return -EINVAL;
+	}
+
+	switch (job->type) {
+	case CRYPTO_JOB_CIPHER:
+		if ((job->cipher.ctx == NULL) || (job->cipher.pkt == NULL)) {
+			return -EINVAL;
+		}
+		break;
+	case CRYPTO_JOB_HASH:
+	case CRYPTO_JOB_HASH_UPDATE:
+		if ((job->hash.ctx == NULL) || (job->hash.pkt == NULL)) {
+			return -EINVAL;
+		}
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&crypto_job_lock);
+	sys_slist_append(&crypto_job_queue, &job->node);
+	k_spin_unlock(&crypto_job_lock, key);
+	k_sem_give(&crypto_job_sem);
+
+	return 0;
+}
@@ -485,6 +485,7 @@ DMA_STM32_EXPORT_API int dma_stm32_configure(const struct device *dev,
 		DMA_InitStruct.NbData = config->head_block->block_size /
 					config->dest_data_size;
 	}
+	stream->nb_data = DMA_InitStruct.NbData;
 
 #if DT_HAS_COMPAT_STATUS_OKAY(st_stm32_dma_v2) || DT_HAS_COMPAT_STATUS_OKAY(st_stm32_dmamux)
 	/* With dma V2 and dmamux,the request ID is stored in the dma_slot */
@@ -547,12 +548,11 @@ DMA_STM32_EXPORT_API int dma_stm32_reload(const struct device *dev, uint32_t id,
 	}
 
 	if (stream->source_periph) {
-		LL_DMA_SetDataLength(dma, dma_stm32_id_to_stream(id),
-				     size / stream->src_size);
+		stream->nb_data = size / stream->src_size;
 	} else {
-		LL_DMA_SetDataLength(dma, dma_stm32_id_to_stream(id),
-				     size / stream->dst_size);
+		stream->nb_data = size / stream->dst_size;
 	}
+	LL_DMA_SetDataLength(dma, dma_stm32_id_to_stream(id), stream->nb_data);
 
 	/* When reloading the dma, the stream is busy again before enabling */
 	stream->busy = true;
@@ -562,6 +562,44 @@ DMA_STM32_EXPORT_API int dma_stm32_reload(const struct device *dev, uint32_t id,
 	return 0;
 }
 
+DMA_STM32_EXPORT_API int dma_stm32_resubmit(const struct device *dev, uint32_t id)
+{
+	const struct dma_stm32_config *config = dev->config;
+	DMA_TypeDef *dma = (DMA_TypeDef *)(config->base);
+	struct dma_stm32_stream *stream;
+
+	/* Give channel from index 0 */
+	id = id - STM32_DMA_STREAM_OFFSET;
+
+	if (id >= config->max_streams) {
+		return -EINVAL;
+	}
+
+	stream = &config->streams[id];
+
+	if (stream->nb_data == 0) {
+		/* The channel has never been configured */
+		return -EINVAL;
+	}
+
+	if (dma_stm32_disable_stream(dma, id) != 0) {
+		return -EBUSY;
+	}
+
+	/* The address registers keep their programmed values across a
+	 * transfer, only the data count has to be rewritten as the hardware
+	 * counts it down to 0.
+	 */
+	LL_DMA_SetDataLength(dma, dma_stm32_id_to_stream(id), stream->nb_data);
+
+	stream->busy = true;
+
+	dma_stm32_clear_stream_irq(dev, id);
+	stm32_dma_enable_stream(dma, id);
+
+	return 0;
+}
+
 DMA_STM32_EXPORT_API int dma_stm32_start(const struct device *dev, uint32_t id)
 {
 	const struct dma_stm32_config *config = dev->config;
@@ -688,6 +726,7 @@ DMA_STM32_EXPORT_API int dma_stm32_get_status(const struct device *dev,
 
 static DEVICE_API(dma, dma_funcs) = {
 	.reload		 = dma_stm32_reload,
+	.resubmit	 = dma_stm32_resubmit,
 	.config		 = dma_stm32_configure,
 	.start		 = dma_stm32_start,
 	.stop		 = dma_stm32_stop,
@@ -25,6 +25,11 @@ struct dma_stm32_stream {
 	volatile bool busy;
 	uint32_t src_size;
 	uint32_t dst_size;
+	/* Number of data items of the configured transfer, kept for
+	 * resubmitting it: the hardware counts the register down to 0
+	 * while the transfer runs.
+	 */
+	uint32_t nb_data;
 	void *user_data; /* holds the client data */
 	dma_callback_t dma_callback;
 	bool cyclic;
@@ -115,6 +120,7 @@ int dma_stm32_configure(const struct device *dev, uint32_t id,
 				struct dma_config *config);
 int dma_stm32_reload(const struct device *dev, uint32_t id,
 			uint32_t src, uint32_t dst, size_t size);
+int dma_stm32_resubmit(const struct device *dev, uint32_t id);
 int dma_stm32_start(const struct device *dev, uint32_t id);
 int dma_stm32_stop(const struct device *dev, uint32_t id);
 int dma_stm32_get_status(const struct device *dev, uint32_t id,
@@ -63,6 +63,7 @@ typedef int (*dma_reload_fn)(const struct device *dev, uint32_t id,
 			uint32_t src, uint32_t dst, size_t size);
 typedef int (*dma_status_fn)(const struct device *dev, uint32_t id,
 				struct dma_status *stat);
+typedef int (*dma_resubmit_fn)(const struct device *dev, uint32_t id);
 
 struct dmamux_stm32_dma_fops {
 	dma_configure_fn configure;
@@ -70,6 +71,8 @@ struct dmamux_stm32_dma_fops {
 	dma_stop_fn stop;
 	dma_reload_fn reload;
 	dma_status_fn get_status;
+	/* optional, may be NULL when the dma does not support resubmit */
+	dma_resubmit_fn resubmit;
 };
 
 #if (defined(CONFIG_DMA_STM32_V1) || defined(CONFIG_DMA_STM32_V2)) && \
@@ -80,6 +83,7 @@ static const struct dmamux_stm32_dma_fops dmamux1 = {
 	dma_stm32_stop,
 	dma_stm32_reload,
 	dma_stm32_get_status,
+	dma_stm32_resubmit,
 };
 #endif
 
@@ -224,6 +228,25 @@ int dmamux_stm32_reload(const struct device *dev, uint32_t id,
 	return 0;
 }
 
+int dmamux_stm32_resubmit(const struct device *dev, uint32_t id)
+{
+	const struct dmamux_stm32_config *dev_config = dev->config;
+	const struct dmamux_stm32_dma_fops *dma_device = get_dma_fops(dev_config);
+
+	if (dma_device->resubmit == NULL) {
+		return -ENOSYS;
+	}
+
+	/* check if this channel is valid */
+	if (id >= dev_config->channel_nb) {
+		LOG_ERR("channel ID %d is too big.", id);
+		return -EINVAL;
+	}
+
+	return dma_device->resubmit(dev_config->mux_channels[id].dev_dma,
+				    dev_config->mux_channels[id].dma_id);
+}
+
 int dmamux_stm32_get_status(const struct device *dev, uint32_t id,
 				struct dma_status *stat)
 {
@@ -292,6 +315,7 @@ static int dmamux_stm32_init(const struct device *dev)
 
 static DEVICE_API(dma, dma_funcs) = {
 	.reload		 = dmamux_stm32_reload,
+	.resubmit	 = dmamux_stm32_resubmit,
 	.config		 = dmamux_stm32_configure,
 	.start		 = dmamux_stm32_start,
 	.stop		 = dmamux_stm32_stop,
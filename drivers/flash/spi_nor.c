@@ -165,6 +165,16 @@ struct spi_nor_data {
 	uint32_t ts_enter_dpd;
 #endif
 
+#if defined(CONFIG_SPI_NOR_ERASE_SUSPEND)
+	/* Number of readers waiting to acquire the device */
+	atomic_t read_waiters;
+
+	/* The in-progress erase is suspended and the device handed over
+	 * to readers.
+	 */
+	bool erase_suspended;
+#endif
+
 	/* Miscellaneous flags */
 
 	/* If set addressed operations should use 32-bit rather than
@@ -601,6 +611,32 @@ static void release_device(const struct device *dev)
 	}
 }
 
+#if defined(CONFIG_SPI_NOR_ERASE_SUSPEND)
+/* Acquire owning access for an operation that modifies the flash.
+ *
+ * If the device was handed over to readers while an erase is suspended
+ * the flash must not be modified; hand it back until the erase has been
+ * resumed and completed.
+ */
+static void acquire_device_for_modify(const struct device *dev)
+{
+	struct spi_nor_data *const data = dev->data;
+
+	acquire_device(dev);
+
+	while (data->erase_suspended) {
+		release_device(dev);
+		k_msleep(1);
+		acquire_device(dev);
+	}
+}
+#else
+static inline void acquire_device_for_modify(const struct device *dev)
+{
+	acquire_device(dev);
+}
+#endif /* CONFIG_SPI_NOR_ERASE_SUSPEND */
+
 /**
  * @brief Read the status register.
  *
@@ -801,7 +837,18 @@ static int spi_nor_read(const struct device *dev, off_t addr, void *dest,
 		return -EIO;
 	}
 
+#if defined(CONFIG_SPI_NOR_ERASE_SUSPEND)
+	struct spi_nor_data *const data = dev->data;
+
+	/* Let an in-progress erase know it should be suspended so that
+	 * the read is served without waiting for the erase to complete.
+	 */
+	atomic_inc(&data->read_waiters);
 	acquire_device(dev);
+	atomic_dec(&data->read_waiters);
+#else
+	acquire_device(dev);
+#endif
 
 	if (IS_ENABLED(ANY_INST_USE_4B_ADDR_OPCODES) && DEV_CFG(dev)->use_4b_addr_opcodes) {
 		if (addr > SPI_NOR_3B_ADDR_MAX) {
@@ -871,7 +918,7 @@ static int spi_nor_write(const struct device *dev, off_t addr,
 		return -EIO;
 	}
 
-	acquire_device(dev);
+	acquire_device_for_modify(dev);
 	ret = spi_nor_write_protection_set(dev, false);
 	if (ret == 0) {
 		while (size > 0) {
@@ -936,6 +983,68 @@ static int spi_nor_write(const struct device *dev, off_t addr,
 	return ret;
 }
 
+#if defined(CONFIG_SPI_NOR_ERASE_SUSPEND)
+/* Wait for an in-progress erase to complete, suspending the erase
+ * whenever readers are waiting for the device.
+ *
+ * @note The device must be externally acquired before invoking this
+ * function and is owned again on return, even though it is temporarily
+ * handed over to readers while the erase is suspended.
+ */
+static int spi_nor_wait_erase_complete(const struct device *dev)
+{
+	struct spi_nor_data *const data = dev->data;
+	uint8_t reg;
+	int ret;
+
+	while (true) {
+		ret = spi_nor_cmd_read(dev, SPI_NOR_CMD_RDSR, &reg, sizeof(reg));
+		/* Exit on error or no longer WIP */
+		if (ret || !(reg & SPI_NOR_WIP_BIT)) {
+			break;
+		}
+
+		if (atomic_get(&data->read_waiters) > 0) {
+			ret = spi_nor_cmd_write(dev, SPI_NOR_CMD_PE_SUSPEND);
+			if (ret) {
+				break;
+			}
+
+			/* Suspend latency is tens of microseconds */
+			ret = spi_nor_wait_until_ready(dev, WAIT_READY_REGISTER);
+			if (ret) {
+				(void)spi_nor_cmd_write(dev, SPI_NOR_CMD_PE_RESUME);
+				break;
+			}
+
+			/* Hand the device over to the waiting readers.
+			 * They are already pending on the semaphore so
+			 * they are served before we get it back.
+			 */
+			data->erase_suspended = true;
+			release_device(dev);
+			acquire_device(dev);
+			data->erase_suspended = false;
+
+			ret = spi_nor_cmd_write(dev, SPI_NOR_CMD_PE_RESUME);
+			if (ret) {
+				break;
+			}
+		} else {
+			/* Don't monopolise the CPU while waiting for ready */
+			k_sleep(WAIT_READY_ERASE);
+		}
+	}
+
+	return ret;
+}
+#else
+static inline int spi_nor_wait_erase_complete(const struct device *dev)
+{
+	return spi_nor_wait_until_ready(dev, WAIT_READY_ERASE);
+}
+#endif /* CONFIG_SPI_NOR_ERASE_SUSPEND */
+
 static int spi_nor_erase(const struct device *dev, off_t addr, size_t size)
 {
 	const size_t flash_size = dev_flash_size(dev);
@@ -961,7 +1070,7 @@ static int spi_nor_erase(const struct device *dev, off_t addr, size_t size)
 		return -EIO;
 	}
 
-	acquire_device(dev);
+	acquire_device_for_modify(dev);
 	ret = spi_nor_write_protection_set(dev, false);
 
 	while ((size > 0) && (ret == 0)) {
@@ -971,9 +1080,15 @@ static int spi_nor_erase(const struct device *dev, off_t addr, size_t size)
 		}
 
 		if (size == flash_size) {
-			/* chip erase */
+			/* Chip erase; cannot be suspended */
 			ret = spi_nor_cmd_write(dev, SPI_NOR_CMD_CE);
 			size -= flash_size;
+
+			if (ret == 0) {
+				ret = spi_nor_wait_until_ready(dev,
+							       WAIT_READY_ERASE);
+			}
+			break;
 		} else {
 			const struct jesd216_erase_type *erase_types =
 				dev_erase_types(dev);
@@ -1011,7 +1126,7 @@ static int spi_nor_erase(const struct device *dev, off_t addr, size_t size)
 			break;
 		}
 
-		ret = spi_nor_wait_until_ready(dev, WAIT_READY_ERASE);
+		ret = spi_nor_wait_erase_complete(dev);
 	}
 
 	int ret2 = spi_nor_write_protection_set(dev, true);
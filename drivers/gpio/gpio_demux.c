@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/util.h>
+
+static void gpio_pin_demux_dispatch(const struct device *port,
+				    struct gpio_callback *cb,
+				    gpio_port_pins_t pins)
+{
+	struct gpio_pin_demux *demux =
+		CONTAINER_OF(cb, struct gpio_pin_demux, callback);
+
+	/* gpio_fire_callbacks() masks pins with the callback pin_mask, so
+	 * every bit left set has a handler registered.
+	 */
+	while (pins != 0U) {
+		gpio_pin_t pin = (gpio_pin_t)(find_lsb_set(pins) - 1);
+
+		demux->handlers[pin](port, pin, demux->user_data[pin]);
+		pins &= ~(gpio_port_pins_t)BIT(pin);
+	}
+}
+
+void gpio_pin_demux_init(struct gpio_pin_demux *demux)
+{
+	__ASSERT(demux, "Demultiplexer pointer should not be NULL");
+
+	(void)memset(demux, 0, sizeof(*demux));
+	gpio_init_callback(&demux->callback, gpio_pin_demux_dispatch, 0);
+}
+
+int gpio_pin_demux_add_handler(const struct device *port,
+			       struct gpio_pin_demux *demux, gpio_pin_t pin,
+			       gpio_pin_handler_t handler, void *user_data)
+{
+	int ret = 0;
+
+	__ASSERT(handler, "Handler pointer should not be NULL");
+
+	if (pin >= GPIO_MAX_PINS_PER_PORT) {
+		return -EINVAL;
+	}
+
+	if (demux->handlers[pin] != NULL) {
+		return -EBUSY;
+	}
+
+	/* Publish the handler before the mask bit so that the dispatch
+	 * never selects a NULL handler.
+	 */
+	demux->handlers[pin] = handler;
+	demux->user_data[pin] = user_data;
+
+	if (demux->callback.pin_mask == 0U) {
+		demux->callback.pin_mask = (gpio_port_pins_t)BIT(pin);
+		ret = gpio_add_callback(port, &demux->callback);
+		if (ret != 0) {
+			demux->callback.pin_mask = 0U;
+			demux->handlers[pin] = NULL;
+			demux->user_data[pin] = NULL;
+		}
+	} else {
+		demux->callback.pin_mask |= (gpio_port_pins_t)BIT(pin);
+	}
+
+	return ret;
+}
+
+int gpio_pin_demux_remove_handler(const struct device *port,
+				  struct gpio_pin_demux *demux, gpio_pin_t pin)
+{
+	int ret = 0;
+
+	if (pin >= GPIO_MAX_PINS_PER_PORT) {
+		return -EINVAL;
+	}
+
+	if (demux->handlers[pin] == NULL) {
+		return -ENOENT;
+	}
+
+	demux->callback.pin_mask &= ~(gpio_port_pins_t)BIT(pin);
+	if (demux->callback.pin_mask == 0U) {
+		ret = gpio_remove_callback(port, &demux->callback);
+	}
+
+	demux->handlers[pin] = NULL;
+	demux->user_data[pin] = NULL;
+
+	return ret;
+}
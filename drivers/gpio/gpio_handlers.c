@@ -18,6 +18,17 @@ static inline int z_vrfy_gpio_pin_configure(const struct device *port,
 }
 #include <zephyr/syscalls/gpio_pin_configure_mrsh.c>
 
+static inline int z_vrfy_gpio_port_configure(const struct device *port,
+					     gpio_port_pins_t pins,
+					     gpio_flags_t flags)
+{
+	K_OOPS(K_SYSCALL_DRIVER_GPIO(port, pin_configure));
+	return z_impl_gpio_port_configure((const struct device *)port,
+					   pins,
+					   flags);
+}
+#include <zephyr/syscalls/gpio_port_configure_mrsh.c>
+
 #ifdef CONFIG_GPIO_GET_CONFIG
 static inline int z_vrfy_gpio_pin_get_config(const struct device *port,
 					     gpio_pin_t pin,
@@ -56,3 +56,51 @@ int z_impl_i2s_buf_write(const struct device *dev, void *buf, size_t size)
 
 	return ret;
 }
+
+int i2s_relay(const struct device *rx_dev, const struct device *tx_dev,
+	      i2s_process_cb_t process, void *user_data)
+{
+	const struct i2s_config *rx_cfg;
+	const struct i2s_config *tx_cfg;
+	void *mem_block;
+	size_t size;
+	int ret;
+
+	rx_cfg = i2s_config_get(rx_dev, I2S_DIR_RX);
+	tx_cfg = i2s_config_get(tx_dev, I2S_DIR_TX);
+	if (!rx_cfg || !tx_cfg) {
+		return -EIO;
+	}
+
+	/* The TX stream releases the block to its own slab once it has
+	 * been transmitted, so the handoff is only safe when both streams
+	 * share one.
+	 */
+	if (rx_cfg->mem_slab != tx_cfg->mem_slab) {
+		return -EINVAL;
+	}
+
+	ret = i2s_read(rx_dev, &mem_block, &size);
+	if (ret != 0) {
+		return ret;
+	}
+
+	if (process) {
+		ret = process(mem_block, &size, user_data);
+		if (ret == 0 && size > tx_cfg->block_size) {
+			ret = -EINVAL;
+		}
+
+		if (ret != 0) {
+			k_mem_slab_free(rx_cfg->mem_slab, mem_block);
+			return ret;
+		}
+	}
+
+	ret = i2s_write(tx_dev, mem_block, size);
+	if (ret != 0) {
+		k_mem_slab_free(rx_cfg->mem_slab, mem_block);
+	}
+
+	return ret;
+}
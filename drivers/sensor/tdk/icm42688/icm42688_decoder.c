@@ -324,6 +324,8 @@ static int icm42688_fifo_decode(const uint8_t *buffer, struct sensor_chan_spec c
 {
 	const struct icm42688_fifo_data *edata = (const struct icm42688_fifo_data *)buffer;
 	const uint8_t *buffer_end = buffer + sizeof(struct icm42688_fifo_data) + edata->fifo_count;
+	const uint64_t accel_period = accel_period_ns[edata->accel_odr];
+	const uint64_t gyro_period = gyro_period_ns[edata->gyro_odr];
 	int accel_frame_count = 0;
 	int gyro_frame_count = 0;
 	int count = 0;
@@ -335,6 +337,22 @@ static int icm42688_fifo_decode(const uint8_t *buffer, struct sensor_chan_spec c
 
 	((struct sensor_data_header *)data_out)->base_timestamp_ns = edata->header.timestamp;
 
+	/* The scale shift only depends on the full-scale settings stored in the
+	 * buffer header, so compute it once for the whole burst instead of once
+	 * per decoded frame.
+	 */
+	if (chan_spec.chan_type == SENSOR_CHAN_DIE_TEMP) {
+		((struct sensor_q31_data *)data_out)->shift = 9;
+	} else if (IS_ACCEL(chan_spec.chan_type)) {
+		icm42688_get_shift(SENSOR_CHAN_ACCEL_XYZ, edata->header.accel_fs,
+				   edata->header.gyro_fs,
+				   &((struct sensor_three_axis_data *)data_out)->shift);
+	} else if (IS_GYRO(chan_spec.chan_type)) {
+		icm42688_get_shift(SENSOR_CHAN_GYRO_XYZ, edata->header.accel_fs,
+				   edata->header.gyro_fs,
+				   &((struct sensor_three_axis_data *)data_out)->shift);
+	}
+
 	buffer += sizeof(struct icm42688_fifo_data);
 	while (count < max_count && buffer < buffer_end) {
 		const bool is_20b = FIELD_GET(FIFO_HEADER_20, buffer[0]) == 1;
@@ -364,13 +382,12 @@ static int icm42688_fifo_decode(const uint8_t *buffer, struct sensor_chan_spec c
 		if (chan_spec.chan_type == SENSOR_CHAN_DIE_TEMP) {
 			struct sensor_q31_data *data = (struct sensor_q31_data *)data_out;
 
-			data->shift = 9;
 			if (has_accel) {
 				data->readings[count].timestamp_delta =
-					accel_period_ns[edata->accel_odr] * (accel_frame_count - 1);
+					accel_period * (accel_frame_count - 1);
 			} else {
 				data->readings[count].timestamp_delta =
-					gyro_period_ns[edata->gyro_odr] * (gyro_frame_count - 1);
+					gyro_period * (gyro_frame_count - 1);
 			}
 			data->readings[count].temperature =
 				icm42688_read_temperature_from_packet(buffer);
@@ -378,12 +395,9 @@ static int icm42688_fifo_decode(const uint8_t *buffer, struct sensor_chan_spec c
 			/* Decode accel */
 			struct sensor_three_axis_data *data =
 				(struct sensor_three_axis_data *)data_out;
-			uint64_t period_ns = accel_period_ns[edata->accel_odr];
 
-			icm42688_get_shift(SENSOR_CHAN_ACCEL_XYZ, edata->header.accel_fs,
-					   edata->header.gyro_fs, &data->shift);
-
-			data->readings[count].timestamp_delta = (accel_frame_count - 1) * period_ns;
+			data->readings[count].timestamp_delta =
+				(accel_frame_count - 1) * accel_period;
 			rc = icm42688_read_imu_from_packet(buffer, true, edata->header.accel_fs, 0,
 							   &data->readings[count].x);
 			rc |= icm42688_read_imu_from_packet(buffer, true, edata->header.accel_fs, 1,
@@ -399,12 +413,9 @@ static int icm42688_fifo_decode(const uint8_t *buffer, struct sensor_chan_spec c
 			/* Decode gyro */
 			struct sensor_three_axis_data *data =
 				(struct sensor_three_axis_data *)data_out;
-			uint64_t period_ns = gyro_period_ns[edata->gyro_odr];
-
-			icm42688_get_shift(SENSOR_CHAN_GYRO_XYZ, edata->header.accel_fs,
-					   edata->header.gyro_fs, &data->shift);
 
-			data->readings[count].timestamp_delta = (gyro_frame_count - 1) * period_ns;
+			data->readings[count].timestamp_delta =
+				(gyro_frame_count - 1) * gyro_period;
 			rc = icm42688_read_imu_from_packet(buffer, false, edata->header.gyro_fs, 0,
 							   &data->readings[count].x);
 			rc |= icm42688_read_imu_from_packet(buffer, false, edata->header.gyro_fs, 1,
@@ -1129,6 +1129,10 @@ static inline void async_evt_rx_rdy(struct uart_stm32_data *data)
 		.data.rx.offset = data->dma_rx.offset
 	};
 
+#ifdef CONFIG_UART_ASYNC_RX_TIMESTAMP
+	event.data.rx.timestamp = data->rx_timestamp;
+#endif
+
 	/* When cyclic DMA is used, buffer positions are not updated - call callback every time*/
 	if (data->dma_rx.dma_cfg.cyclic == 0) {
 		/* update the current pos for new data */
@@ -1336,6 +1340,13 @@ static void uart_stm32_isr(const struct device *dev)
 
 		LOG_DBG("idle interrupt occurred");
 
+#ifdef CONFIG_UART_ASYNC_RX_TIMESTAMP
+		/* Latch the end-of-chunk time now, the RX_RDY event may only
+		 * be generated later from the RX timeout work item.
+		 */
+		data->rx_timestamp = k_cycle_get_32();
+#endif
+
 #ifdef CONFIG_PM
 		if (data->rx_woken) {
 			/* Allow SoC to enter STOP mode now that RX is IDLE */
@@ -1482,6 +1493,10 @@ static int uart_stm32_async_rx_disable(const struct device *dev)
 
 	LL_USART_DisableIT_IDLE(usart);
 
+#ifdef CONFIG_UART_ASYNC_RX_TIMESTAMP
+	data->rx_timestamp = k_cycle_get_32();
+#endif
+
 	uart_stm32_dma_rx_flush(dev, STM32_ASYNC_STATUS_TIMEOUT);
 
 	async_evt_rx_buf_release(data);
@@ -1580,6 +1595,10 @@ void uart_stm32_dma_rx_cb(const struct device *dma_dev, void *user_data,
 		return;
 	}
 
+#ifdef CONFIG_UART_ASYNC_RX_TIMESTAMP
+	data->rx_timestamp = k_cycle_get_32();
+#endif
+
 	(void)k_work_cancel_delayable(&data->dma_rx.timeout_work);
 
 	/* If we are in NORMAL MODE */
@@ -98,6 +98,9 @@ struct uart_stm32_data {
 	struct uart_dma_stream dma_tx;
 	uint8_t *rx_next_buffer;
 	size_t rx_next_buffer_len;
+#ifdef CONFIG_UART_ASYNC_RX_TIMESTAMP
+	uint32_t rx_timestamp;
+#endif
 #endif
 #ifdef CONFIG_PM
 	bool tx_poll_stream_on;
@@ -83,7 +83,33 @@ struct spi_context {
 static inline bool spi_context_configured(struct spi_context *ctx,
 					  const struct spi_config *config)
 {
-	return !!(ctx->config == config);
+	if (ctx->config == config) {
+		return true;
+	}
+
+	if ((ctx->config == NULL) || (config == NULL)) {
+		return false;
+	}
+
+	/* Fall back to a field-wise comparison so that an identical
+	 * configuration held in a different object, e.g. rebuilt on the
+	 * stack for every transfer, still hits the fast path. Fields are
+	 * compared explicitly to avoid reading padding bytes. On a match
+	 * the stored pointer is refreshed since the previous object may
+	 * no longer be valid.
+	 */
+	if ((ctx->config->frequency == config->frequency) &&
+	    (ctx->config->operation == config->operation) &&
+	    (ctx->config->slave == config->slave) &&
+	    (ctx->config->cs.gpio.port == config->cs.gpio.port) &&
+	    (ctx->config->cs.gpio.pin == config->cs.gpio.pin) &&
+	    (ctx->config->cs.gpio.dt_flags == config->cs.gpio.dt_flags) &&
+	    (ctx->config->cs.delay == config->cs.delay)) {
+		ctx->config = config;
+		return true;
+	}
+
+	return false;
 }
 
 /* Returns true if the spi configuration stored for this context
@@ -94,6 +94,7 @@ struct udc_stm32_msg {
 	uint8_t type;
 	uint8_t ep;
 	uint16_t rx_count;
+	struct net_buf *buf;
 };
 
 static void udc_stm32_lock(const struct device *dev)
@@ -280,6 +281,7 @@ void HAL_PCD_DataOutStageCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
 {
 	uint32_t rx_count = HAL_PCD_EP_GetRxCount(hpcd, epnum);
 	struct udc_stm32_data *priv = hpcd2data(hpcd);
+	uint8_t ep = epnum | USB_EP_DIR_OUT;
 	struct udc_stm32_msg msg = {
 		.type = UDC_STM32_MSG_DATA_OUT,
 		.ep = epnum,
@@ -287,6 +289,32 @@ void HAL_PCD_DataOutStageCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
 	};
 	int err;
 
+	if (ep != USB_CONTROL_EP_OUT) {
+		const struct device *dev = priv->dev;
+		struct udc_ep_config *epcfg = udc_get_ep_cfg(dev, ep);
+		struct net_buf *buf;
+
+		/* Complete the transfer and start the next queued one here,
+		 * a round trip through the driver thread would leave the
+		 * endpoint NAKing for at least one more (micro-)frame.
+		 */
+		udc_ep_set_busy(epcfg, false);
+
+		buf = udc_buf_get(epcfg);
+		if (unlikely(buf == NULL)) {
+			LOG_ERR("ep 0x%02x queue is empty", ep);
+			return;
+		}
+
+		net_buf_add(buf, rx_count);
+		msg.buf = buf;
+
+		buf = udc_buf_peek(epcfg);
+		if (buf) {
+			udc_stm32_rx(dev, epcfg, buf);
+		}
+	}
+
 	err = k_msgq_put(&priv->msgq_data, &msg, K_NO_WAIT);
 	if (err != 0) {
 		LOG_ERR("UDC Message queue overrun");
@@ -296,27 +324,62 @@ void HAL_PCD_DataOutStageCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
 void HAL_PCD_DataInStageCallback(PCD_HandleTypeDef *hpcd, uint8_t epnum)
 {
 	struct udc_stm32_data *priv = hpcd2data(hpcd);
+	uint8_t ep = epnum | USB_EP_DIR_IN;
 	struct udc_stm32_msg msg = {
 		.type = UDC_STM32_MSG_DATA_IN,
 		.ep = epnum,
 	};
 	int err;
 
+	if (ep != USB_CONTROL_EP_IN) {
+		const struct device *dev = priv->dev;
+		struct udc_ep_config *epcfg = udc_get_ep_cfg(dev, ep);
+		struct net_buf *buf;
+
+		udc_ep_set_busy(epcfg, false);
+
+		buf = udc_buf_peek(epcfg);
+		if (unlikely(buf == NULL)) {
+			return;
+		}
+
+		if (udc_ep_buf_has_zlp(buf)) {
+			udc_ep_buf_clear_zlp(buf);
+			HAL_PCD_EP_Transmit(&priv->pcd, ep, buf->data, 0);
+
+			return;
+		}
+
+		udc_buf_get(epcfg);
+		msg.buf = buf;
+
+		buf = udc_buf_peek(epcfg);
+		if (buf) {
+			udc_stm32_tx(dev, epcfg, buf);
+		}
+	}
+
 	err = k_msgq_put(&priv->msgq_data, &msg, K_NO_WAIT);
 	if (err != 0) {
 		LOG_ERR("UDC Message queue overrun");
 	}
 }
 
-static void handle_msg_data_out(struct udc_stm32_data *priv, uint8_t epnum, uint16_t rx_count)
+static void handle_msg_data_out(struct udc_stm32_data *priv, uint8_t epnum,
+				uint16_t rx_count, struct net_buf *buf)
 {
 	const struct device *dev = priv->dev;
 	struct udc_ep_config *epcfg;
 	uint8_t ep = epnum | USB_EP_DIR_OUT;
-	struct net_buf *buf;
 
 	LOG_DBG("DataOut ep 0x%02x",  ep);
 
+	if (ep != USB_CONTROL_EP_OUT) {
+		/* Completed and re-armed in HAL_PCD_DataOutStageCallback() */
+		udc_submit_ep_event(dev, buf, 0);
+		return;
+	}
+
 	epcfg = udc_get_ep_cfg(dev, ep);
 	udc_ep_set_busy(epcfg, false);
 
@@ -328,19 +391,15 @@ static void handle_msg_data_out(struct udc_stm32_data *priv, uint8_t epnum, uint
 
 	net_buf_add(buf, rx_count);
 
-	if (ep == USB_CONTROL_EP_OUT) {
-		if (udc_ctrl_stage_is_status_out(dev)) {
-			udc_ctrl_update_stage(dev, buf);
-			udc_ctrl_submit_status(dev, buf);
-		} else {
-			udc_ctrl_update_stage(dev, buf);
-		}
-
-		if (udc_ctrl_stage_is_status_in(dev)) {
-			udc_ctrl_submit_s_out_status(dev, buf);
-		}
+	if (udc_ctrl_stage_is_status_out(dev)) {
+		udc_ctrl_update_stage(dev, buf);
+		udc_ctrl_submit_status(dev, buf);
 	} else {
-		udc_submit_ep_event(dev, buf, 0);
+		udc_ctrl_update_stage(dev, buf);
+	}
+
+	if (udc_ctrl_stage_is_status_in(dev)) {
+		udc_ctrl_submit_s_out_status(dev, buf);
 	}
 
 	buf = udc_buf_peek(epcfg);
@@ -349,15 +408,21 @@ static void handle_msg_data_out(struct udc_stm32_data *priv, uint8_t epnum, uint
 	}
 }
 
-static void handle_msg_data_in(struct udc_stm32_data *priv, uint8_t epnum)
+static void handle_msg_data_in(struct udc_stm32_data *priv, uint8_t epnum,
+			       struct net_buf *buf)
 {
 	const struct device *dev = priv->dev;
 	struct udc_ep_config *epcfg;
 	uint8_t ep = epnum | USB_EP_DIR_IN;
-	struct net_buf *buf;
 
 	LOG_DBG("DataIn ep 0x%02x",  ep);
 
+	if (ep != USB_CONTROL_EP_IN) {
+		/* Completed and re-armed in HAL_PCD_DataInStageCallback() */
+		udc_submit_ep_event(dev, buf, 0);
+		return;
+	}
+
 	epcfg = udc_get_ep_cfg(dev, ep);
 	udc_ep_set_busy(epcfg, false);
 
@@ -366,7 +431,7 @@ static void handle_msg_data_in(struct udc_stm32_data *priv, uint8_t epnum)
 		return;
 	}
 
-	if (ep == USB_CONTROL_EP_IN && buf->len) {
+	if (buf->len) {
 		const struct udc_stm32_config *cfg = dev->config;
 		uint32_t len = MIN(cfg->ep0_mps, buf->len);
 
@@ -387,32 +452,21 @@ static void handle_msg_data_in(struct udc_stm32_data *priv, uint8_t epnum)
 
 	udc_buf_get(epcfg);
 
-	if (ep == USB_CONTROL_EP_IN) {
-		if (udc_ctrl_stage_is_status_in(dev) ||
-		    udc_ctrl_stage_is_no_data(dev)) {
-			/* Status stage finished, notify upper layer */
-			udc_ctrl_submit_status(dev, buf);
-		}
-
-		/* Update to next stage of control transfer */
-		udc_ctrl_update_stage(dev, buf);
-
-		if (udc_ctrl_stage_is_status_out(dev)) {
-			/*
-			 * IN transfer finished, release buffer,
-			 * control OUT buffer should be already fed.
-			 */
-			net_buf_unref(buf);
-		}
-
-		return;
+	if (udc_ctrl_stage_is_status_in(dev) ||
+	    udc_ctrl_stage_is_no_data(dev)) {
+		/* Status stage finished, notify upper layer */
+		udc_ctrl_submit_status(dev, buf);
 	}
 
-	udc_submit_ep_event(dev, buf, 0);
+	/* Update to next stage of control transfer */
+	udc_ctrl_update_stage(dev, buf);
 
-	buf = udc_buf_peek(epcfg);
-	if (buf) {
-		udc_stm32_tx(dev, epcfg, buf);
+	if (udc_ctrl_stage_is_status_out(dev)) {
+		/*
+		 * IN transfer finished, release buffer,
+		 * control OUT buffer should be already fed.
+		 */
+		net_buf_unref(buf);
 	}
 }
 
@@ -470,10 +524,10 @@ static void udc_stm32_thread_handler(void *arg1, void *arg2, void *arg3)
 			handle_msg_setup(priv);
 			break;
 		case UDC_STM32_MSG_DATA_IN:
-			handle_msg_data_in(priv, msg.ep);
+			handle_msg_data_in(priv, msg.ep, msg.buf);
 			break;
 		case UDC_STM32_MSG_DATA_OUT:
-			handle_msg_data_out(priv, msg.ep, msg.rx_count);
+			handle_msg_data_out(priv, msg.ep, msg.rx_count, msg.buf);
 			break;
 		}
 	}
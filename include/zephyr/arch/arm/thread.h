@@ -77,6 +77,26 @@ struct _thread_arch {
 	struct _preempt_float  preempt_float;
 #endif
 
+#if defined(CONFIG_FPU_SHARING_DEMOTION)
+	/*
+	 * Caller-saved FP context, captured from the thread's exception
+	 * stack frame when the FP context is demoted. The callee-saved
+	 * registers remain in preempt_float.
+	 */
+	uint32_t demoted_fp_caller[16];
+	uint32_t demoted_fpscr;
+
+	/* Consecutive switch-outs with an active FP context */
+	uint32_t fpu_active_switches;
+
+	/* Statistics: FP context stackings and re-promotion faults */
+	uint32_t fpu_stack_count;
+	uint32_t fpu_trap_count;
+
+	/* FP context is demoted: FPU access is disabled for the thread */
+	uint8_t fpu_demoted;
+#endif
+
 #if defined(CONFIG_CPU_AARCH32_CORTEX_A) || defined(CONFIG_CPU_AARCH32_CORTEX_R)
 	int8_t exception_depth;
 #endif
@@ -1398,6 +1398,65 @@ struct bt_gatt_notify_params {
 int bt_gatt_notify_cb(struct bt_conn *conn,
 		      struct bt_gatt_notify_params *params);
 
+/** @brief Prepared notification context.
+ *
+ *  Caches the attribute lookups needed to send a notification. The context
+ *  is filled in by bt_gatt_notify_prepare() and shall be treated as
+ *  read-only afterwards.
+ */
+struct bt_gatt_notify_prepared {
+	/** Characteristic Value attribute. */
+	const struct bt_gatt_attr *attr;
+	/** Client Characteristic Configuration descriptor of the characteristic. */
+	const struct bt_gatt_attr *ccc;
+	/** Characteristic Value handle. */
+	uint16_t handle;
+};
+
+/** @brief Prepare repeated notifications of an attribute.
+ *
+ *  Resolves the Characteristic Value handle and the Client Characteristic
+ *  Configuration descriptor of a characteristic once, so that
+ *  bt_gatt_notify_prepared_cb() can send notifications without searching
+ *  the attribute database on every call.
+ *
+ *  The prepared context stays valid as long as the service the attribute
+ *  belongs to remains registered.
+ *
+ *  @param prepared Prepared notification context to fill.
+ *  @param attr Characteristic or Characteristic Value attribute.
+ *
+ *  @retval 0 Success.
+ *  @retval -EINVAL The characteristic does not support notification or has
+ *          no CCC descriptor.
+ *  @retval -ENOENT The attribute is not part of the attribute database.
+ */
+int bt_gatt_notify_prepare(struct bt_gatt_notify_prepared *prepared,
+			   const struct bt_gatt_attr *attr);
+
+/** @brief Notify attribute value change using a prepared context.
+ *
+ *  This function works in the same way as @ref bt_gatt_notify_cb, except
+ *  that the attribute references cached by bt_gatt_notify_prepare() are
+ *  reused instead of being looked up again, leaving only the subscription
+ *  check and the buffer handling on the notification path.
+ *
+ *  Unlike @ref bt_gatt_notify_cb the connection object must not be NULL,
+ *  use bt_gatt_notify_cb() to notify all subscribed peers.
+ *
+ *  The attribute of @p params is set from the prepared context, the uuid
+ *  must not be set.
+ *
+ *  @param conn Connection object.
+ *  @param prepared Context filled in by bt_gatt_notify_prepare().
+ *  @param params Notification parameters.
+ *
+ *  @return 0 in case of success or negative value in case of error.
+ */
+int bt_gatt_notify_prepared_cb(struct bt_conn *conn,
+			       const struct bt_gatt_notify_prepared *prepared,
+			       struct bt_gatt_notify_params *params);
+
 /** @brief Send multiple notifications in a single PDU.
  *
  *  The GATT Server will send a single ATT_MULTIPLE_HANDLE_VALUE_NTF PDU
@@ -943,7 +943,9 @@ int bt_iso_chan_disconnect(struct bt_iso_chan *chan);
  * @brief Send data to ISO channel without timestamp
  *
  * Send data from buffer to the channel. If credits are not available, buf will
- * be queued and sent as and when credits are received from peer.
+ * be queued and sent as and when credits are received from peer. If
+ * @kconfig{CONFIG_BT_ISO_TX_MAX_STAGED_SDUS} is set and that many SDUs are
+ * already queued on the channel, -ENOBUFS is returned.
  * Regarding to first input parameter, to get details see reference description
  * to bt_iso_chan_connect() API.
  *
@@ -201,6 +201,24 @@ struct bt_l2cap_le_endpoint {
 	uint16_t				mps;
 	/** Endpoint credits */
 	atomic_t			credits;
+	/** @brief Credits granted to the peer on connection (RX only).
+	 *
+	 *  Each credit allows the peer to send one PDU of up to MPS bytes
+	 *  before waiting for credits to be returned. If zero, the stack
+	 *  uses @kconfig{CONFIG_BT_L2CAP_RX_CREDITS}. Only used on the
+	 *  Receiving Endpoint of dynamic channels.
+	 */
+	uint16_t			init_credits;
+	/** @brief Watermark at which consumed credits are returned (RX only).
+	 *
+	 *  Consumed credits are accumulated and returned to the peer in a
+	 *  single L2CAP_FLOW_CONTROL_CREDIT_IND once at least this many are
+	 *  pending, reducing the number of credit PDUs on the air. If zero,
+	 *  the stack uses @kconfig{CONFIG_BT_L2CAP_RX_CREDITS_WATERMARK}.
+	 *  Clamped to init_credits so the peer cannot run out of credits
+	 *  waiting for a return that would never come.
+	 */
+	uint16_t			credits_watermark;
 };
 
 /** @brief LE L2CAP Channel structure. */
@@ -245,6 +263,9 @@ struct bt_l2cap_le_chan {
 	struct k_work			rx_work;
 	struct k_fifo			rx_queue;
 
+	/** @internal Consumed RX credits not yet returned to the peer */
+	atomic_t			_pending_rx_credits;
+
 	bt_l2cap_chan_state_t		state;
 	/** Remote PSM to be connected */
 	uint16_t			psm;
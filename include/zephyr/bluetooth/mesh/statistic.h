@@ -47,6 +47,10 @@ struct bt_mesh_statistic {
 	uint32_t tx_friend_planned;
 	/** Counter of frames that succeeded to send over friend bearer. */
 	uint32_t tx_friend_succeeded;
+	/** Network message cache lookups that found a duplicate. */
+	uint32_t msg_cache_hit;
+	/** Network message cache lookups that did not find a match. */
+	uint32_t msg_cache_miss;
 };
 
 /** @brief Get mesh frame handling statistic.
@@ -543,6 +543,96 @@ static ALWAYS_INLINE void *sys_cache_uncached_ptr_get(void __sparse_cache *ptr)
 }
 
 
+#if defined(CONFIG_CACHE_BATCH_OPS) || defined(__DOXYGEN__)
+
+/**
+ * @brief Batch of address ranges for d-cache maintenance
+ *
+ * Collects address ranges so that one cache maintenance operation can be
+ * issued over all of them at commit time, instead of one operation (and one
+ * synchronization barrier) per range. All fields are internal and must only
+ * be manipulated through the sys_cache_data_batch API.
+ */
+struct sys_cache_batch {
+	/** Pending disjoint address ranges, aligned to cache lines */
+	struct {
+		uintptr_t start;
+		uintptr_t end;
+	} ranges[CONFIG_CACHE_BATCH_OPS_RANGE_COUNT];
+	/** Number of valid entries in ranges */
+	uint8_t count;
+};
+
+/**
+ * @brief Initialize a cache operation batch
+ *
+ * @param batch Batch to initialize.
+ */
+void sys_cache_data_batch_init(struct sys_cache_batch *batch);
+
+/**
+ * @brief Add an address range to a cache operation batch
+ *
+ * The range is extended to cache line boundaries and merged with any already
+ * queued range it overlaps or abuts. Disjoint ranges are never merged across
+ * the gap between them, so committing the batch operates on exactly the
+ * lines the queued ranges cover.
+ *
+ * @param batch Batch to add the range to.
+ * @param addr Starting address of the range.
+ * @param size Range size.
+ *
+ * @retval 0 If the range was queued.
+ * @retval -ENOSPC If the batch is full and the range could not be merged;
+ *	   commit the batch and retry.
+ */
+int sys_cache_data_batch_add(struct sys_cache_batch *batch, void *addr,
+			     size_t size);
+
+/**
+ * @brief Flush all ranges queued in a cache operation batch
+ *
+ * The batch is emptied and can be reused afterwards, regardless of the
+ * return value.
+ *
+ * @param batch Batch to commit.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+int sys_cache_data_batch_flush(struct sys_cache_batch *batch);
+
+/**
+ * @brief Invalidate all ranges queued in a cache operation batch
+ *
+ * The batch is emptied and can be reused afterwards, regardless of the
+ * return value.
+ *
+ * @param batch Batch to commit.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+int sys_cache_data_batch_invd(struct sys_cache_batch *batch);
+
+/**
+ * @brief Flush and invalidate all ranges queued in a cache operation batch
+ *
+ * The batch is emptied and can be reused afterwards, regardless of the
+ * return value.
+ *
+ * @param batch Batch to commit.
+ *
+ * @retval 0 If succeeded.
+ * @retval -ENOTSUP If not supported.
+ * @retval -errno Negative errno for other failures.
+ */
+int sys_cache_data_batch_flush_and_invd(struct sys_cache_batch *batch);
+
+#endif /* CONFIG_CACHE_BATCH_OPS || __DOXYGEN__ */
+
 #ifdef CONFIG_LIBMETAL
 static ALWAYS_INLINE void sys_cache_flush(void *addr, size_t size)
 {
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file crypto_job.h
+ *
+ * @brief Asynchronous job queue on top of the crypto device APIs.
+ *
+ * The job queue allows crypto operations to be submitted without waiting
+ * for their completion. Jobs are executed in submission order by a
+ * dedicated thread and completion is reported through a callback, so the
+ * submitter can continue with other work (e.g. protocol processing) while
+ * a bulk operation runs on a hardware accelerator.
+ */
+
+#ifndef ZEPHYR_INCLUDE_CRYPTO_JOB_H_
+#define ZEPHYR_INCLUDE_CRYPTO_JOB_H_
+
+#include <zephyr/sys/slist.h>
+#include <zephyr/crypto/cipher.h>
+#include <zephyr/crypto/hash.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup crypto
+ * @{
+ */
+
+/** Type of an asynchronous crypto job */
+enum crypto_job_type {
+	/** Cipher operation, dispatched on the cipher mode of the session */
+	CRYPTO_JOB_CIPHER,
+	/** Hash computation finishing the session digest */
+	CRYPTO_JOB_HASH,
+	/** Incremental hash update */
+	CRYPTO_JOB_HASH_UPDATE,
+};
+
+struct crypto_job;
+
+/**
+ * @brief Crypto job completion callback
+ *
+ * Invoked from the crypto job thread when a job has been executed.
+ *
+ * @param job     Completed job.
+ * @param status  Return value of the underlying crypto operation.
+ */
+typedef void (*crypto_job_cb_t)(struct crypto_job *job, int status);
+
+/**
+ * @brief Asynchronous crypto job
+ *
+ * Describes one crypto operation submitted with crypto_job_submit().
+ * The structure, the session context and the packet must remain valid
+ * until the completion callback has been invoked.
+ */
+struct crypto_job {
+	/** @cond INTERNAL_HIDDEN */
+	/** Entry in the job queue */
+	sys_snode_t node;
+	/** @endcond */
+	/** Type of the operation */
+	enum crypto_job_type type;
+	union {
+		/** Cipher operation, valid for CRYPTO_JOB_CIPHER */
+		struct {
+			/** Session context from cipher_begin_session() */
+			struct cipher_ctx *ctx;
+			union {
+				/** Packet for ECB/CBC/CTR mode sessions */
+				struct cipher_pkt *pkt;
+				/** Packet for CCM/GCM mode sessions */
+				struct cipher_aead_pkt *aead_pkt;
+			};
+			/** IV, counter or nonce, unused for ECB mode */
+			uint8_t *iv;
+		} cipher;
+		/** Hash operation, valid for CRYPTO_JOB_HASH[_UPDATE] */
+		struct {
+			/** Session context from hash_begin_session() */
+			struct hash_ctx *ctx;
+			/** Packet describing input and digest buffers */
+			struct hash_pkt *pkt;
+		} hash;
+	};
+	/** Completion callback */
+	crypto_job_cb_t cb;
+	/** User data, not touched by the job queue */
+	void *user_data;
+};
+
+/**
+ * @brief Submit a crypto job for asynchronous execution
+ *
+ * Queues the job for execution by the crypto job thread and returns
+ * without waiting. Jobs are executed in submission order, serializing
+ * access to the underlying crypto devices.
+ *
+ * @param job  Job to submit.
+ *
+ * @return 0 on success, -EINVAL if the job is malformed.
+ */
+int crypto_job_submit(struct crypto_job *job);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_CRYPTO_JOB_H_ */
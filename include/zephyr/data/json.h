@@ -811,6 +811,122 @@ int json_obj_encode(const struct json_obj_descr *descr, size_t descr_len,
 int json_arr_encode(const struct json_obj_descr *descr, const void *val,
 		    json_append_bytes_t append_bytes, void *data);
 
+/**
+ * @brief Event types emitted by the streaming parser.
+ */
+enum json_stream_event {
+	/** Start of an object */
+	JSON_STREAM_OBJECT_START,
+	/** End of an object */
+	JSON_STREAM_OBJECT_END,
+	/** Start of an array */
+	JSON_STREAM_ARRAY_START,
+	/** End of an array */
+	JSON_STREAM_ARRAY_END,
+	/** Object member key, data points to the key characters */
+	JSON_STREAM_KEY,
+	/** String value, data points to the string characters with escape
+	 * sequences left encoded
+	 */
+	JSON_STREAM_STRING,
+	/** Number value, data points to the number characters */
+	JSON_STREAM_NUMBER,
+	/** Boolean true value */
+	JSON_STREAM_TRUE,
+	/** Boolean false value */
+	JSON_STREAM_FALSE,
+	/** Null value */
+	JSON_STREAM_NULL,
+};
+
+/**
+ * @brief Function pointer type to receive streaming parser events.
+ *
+ * For key, string and number events, @a data points either into the chunk
+ * passed to json_stream_feed() (valid only for the duration of the callback)
+ * or into the parser scratch buffer when the token spanned a chunk boundary.
+ * For the remaining events @a data is NULL and @a len is 0.
+ *
+ * @param event Event type
+ * @param data Token characters, NULL when the event carries no data
+ * @param len Number of token characters
+ * @param user_data User-provided pointer
+ *
+ * @return 0 to continue parsing, any other value aborts the parse and is
+ * returned from json_stream_feed()
+ */
+typedef int (*json_stream_cb_t)(enum json_stream_event event, const char *data,
+				size_t len, void *user_data);
+
+/**
+ * @brief Streaming parser state.
+ *
+ * All fields are internal to the implementation.
+ */
+struct json_stream {
+	json_stream_cb_t cb;
+	void *user_data;
+	char *scratch;
+	size_t scratch_size;
+	size_t scratch_len;
+	uint32_t stack;
+	uint8_t depth;
+	uint8_t state;
+	uint8_t esc;
+	uint8_t literal_pos;
+	uint8_t literal_event;
+	const char *literal;
+};
+
+/**
+ * @brief Initialize a streaming (SAX-style) JSON parser.
+ *
+ * The streaming parser emits one callback per syntactic element as input is
+ * fed to it in arbitrarily sized chunks, so a payload never has to be
+ * contiguous in memory: memory usage is bounded by the scratch buffer, which
+ * only needs to hold the largest single token (key, string or number), not
+ * the document.
+ *
+ * @param stream Streaming parser state
+ * @param cb Callback receiving the parse events
+ * @param user_data User pointer passed to the callback
+ * @param scratch Buffer used to assemble tokens spanning chunk boundaries
+ * @param scratch_size Size of the scratch buffer, in bytes
+ */
+void json_stream_init(struct json_stream *stream, json_stream_cb_t cb,
+		      void *user_data, char *scratch, size_t scratch_size);
+
+/**
+ * @brief Feed a chunk of JSON input to a streaming parser.
+ *
+ * May be called repeatedly as input arrives; events are emitted from within
+ * this call.
+ *
+ * @param stream Streaming parser state
+ * @param data Chunk of JSON input, not necessarily aligned to any token
+ * boundary
+ * @param len Number of bytes in the chunk
+ *
+ * @return 0 on success, -EINVAL on malformed input, -ENOMEM if a token
+ * spanning a chunk boundary does not fit in the scratch buffer, -E2BIG if
+ * the nesting depth exceeds the supported maximum, or the non-zero value
+ * returned from the callback.
+ */
+int json_stream_feed(struct json_stream *stream, const char *data, size_t len);
+
+/**
+ * @brief Signal end of input to a streaming parser.
+ *
+ * Emits the event for a pending top-level number, which is only delimited
+ * by the end of the document.
+ *
+ * @param stream Streaming parser state
+ *
+ * @return 0 if a complete JSON value has been parsed, -EINVAL otherwise,
+ * or the non-zero value returned from the callback.
+ */
+int json_stream_finish(struct json_stream *stream);
+
 #ifdef __cplusplus
 }
 #endif
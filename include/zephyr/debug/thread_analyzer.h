@@ -80,6 +80,50 @@ void thread_analyzer_run(thread_analyzer_cb cb, unsigned int cpu);
  */
 void thread_analyzer_print(unsigned int cpu);
 
+#if defined(CONFIG_THREAD_ANALYZER_CONTINUOUS) || defined(__DOXYGEN__)
+
+/** Continuous analysis event types */
+enum thread_analyzer_event_type {
+	/** Stack usage of a thread reached the configured threshold */
+	THREAD_ANALYZER_EVENT_STACK_HIGH,
+	/** CPU share of a thread changed by at least the configured threshold */
+	THREAD_ANALYZER_EVENT_CPU_CHANGE,
+};
+
+/** @brief Continuous analysis threshold event */
+struct thread_analyzer_event {
+	/** Event type */
+	enum thread_analyzer_event_type type;
+	/** The name of the thread or stringified address of the thread handle
+	 * if name is not set.
+	 */
+	const char *name;
+	/** Current value in percent */
+	unsigned int value;
+	/** Value in percent when the thread was last sampled */
+	unsigned int previous;
+};
+
+/** @brief Thread analyzer event callback function
+ *
+ *  Called from the system work queue when a sampled thread crossed one of
+ *  the configured thresholds. The event is only valid during the call.
+ *
+ *  @param evt Threshold event.
+ */
+typedef void (*thread_analyzer_event_cb_t)(const struct thread_analyzer_event *evt);
+
+/** @brief Register a callback for continuous analysis threshold events
+ *
+ *  Replaces any previously registered callback. While no callback is
+ *  registered, events are logged as warnings instead.
+ *
+ *  @param cb The callback function handler, NULL to unregister.
+ */
+void thread_analyzer_event_cb_set(thread_analyzer_event_cb_t cb);
+
+#endif /* CONFIG_THREAD_ANALYZER_CONTINUOUS */
+
 /** @} */
 
 #ifdef __cplusplus
@@ -462,6 +462,15 @@ struct device_state {
 	 * invoked.
 	 */
 	bool initialized : 1;
+
+#if defined(CONFIG_DEVICE_INIT_ON_DEMAND) || defined(__DOXYGEN__)
+	/**
+	 * Duration of the device initialization function in hardware
+	 * cycles. Only available if @kconfig{CONFIG_DEVICE_INIT_ON_DEMAND}
+	 * is enabled.
+	 */
+	uint32_t init_cycles;
+#endif /* CONFIG_DEVICE_INIT_ON_DEMAND */
 };
 
 struct pm_device_base;
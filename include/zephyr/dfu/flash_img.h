@@ -17,6 +17,14 @@
 
 #include <zephyr/storage/stream_flash.h>
 
+#ifdef CONFIG_IMG_STREAM_HASH
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+#include <psa/crypto.h>
+#else
+#include <mbedtls/sha256.h>
+#endif
+#endif /* CONFIG_IMG_STREAM_HASH */
+
 /**
  * @brief Abstraction layer to write firmware images to flash
  *
@@ -33,6 +41,16 @@ struct flash_img_context {
 	uint8_t buf[CONFIG_IMG_BLOCK_BUF_SIZE];
 	const struct flash_area *flash_area;
 	struct stream_flash_ctx stream;
+#ifdef CONFIG_IMG_STREAM_HASH
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+	psa_hash_operation_t hash_ctx;
+#else
+	mbedtls_sha256_context hash_ctx;
+#endif
+	size_t hash_bytes;	/* Number of bytes fed into the streamed hash */
+	uint8_t hash_digest[32]; /* Digest of the streamed data, valid when finished */
+	bool hash_finished;
+#endif /* CONFIG_IMG_STREAM_HASH */
 };
 
 /**
@@ -671,6 +671,60 @@ struct adc_sequence {
 	bool calibrate;
 };
 
+/**
+ * @brief Structure describing samples delivered by a continuous sampling.
+ *
+ * One event is generated each time the driver fills half of the ring
+ * buffer supplied to adc_continuous_start(), and once more if sampling
+ * stops due to an error.
+ */
+struct adc_continuous_event {
+	/**
+	 * Pointer to the half of the ring buffer that has just been filled
+	 * with samples, laid out as in adc_sequence::buffer (one sample per
+	 * selected channel, lowest channel ID first, repeated for
+	 * consecutive samplings). NULL when @a error is set.
+	 */
+	void *samples;
+
+	/**
+	 * Number of valid bytes pointed to by @a samples (half of the ring
+	 * buffer size). Zero when @a error is set.
+	 */
+	size_t size;
+
+	/**
+	 * Value of k_cycle_get_32() captured when the last sample of this
+	 * half was transferred. Timestamps of individual samples can be
+	 * derived from it using the known sampling rate.
+	 */
+	uint32_t timestamp;
+
+	/**
+	 * Zero for a regular watermark event, or a negative error code when
+	 * the sampling was stopped by the driver, e.g. due to an overrun or
+	 * a DMA transfer failure.
+	 */
+	int error;
+};
+
+/**
+ * @brief Type definition of the callback function delivering continuous
+ *        sampling events.
+ *
+ * The callback is executed in interrupt context, so it must not block.
+ * Typically it only hands the filled half of the ring buffer over to
+ * a processing thread.
+ *
+ * @param dev       Pointer to the device structure for the driver instance.
+ * @param event     Event describing the newly filled samples or the error
+ *                  that stopped the sampling. The pointed structure is only
+ *                  valid for the duration of the callback.
+ * @param user_data Pointer passed to adc_continuous_start().
+ */
+typedef void (*adc_continuous_callback)(const struct device *dev,
+					const struct adc_continuous_event *event,
+					void *user_data);
 
 /**
  * @brief Type definition of ADC API function for configuring a channel.
@@ -695,6 +749,23 @@ typedef int (*adc_api_read_async)(const struct device *dev,
 				  const struct adc_sequence *sequence,
 				  struct k_poll_signal *async);
 
+/**
+ * @brief Type definition of ADC API function for starting a continuous
+ *        sampling.
+ * See adc_continuous_start() for argument descriptions.
+ */
+typedef int (*adc_api_continuous_start)(const struct device *dev,
+					const struct adc_sequence *sequence,
+					adc_continuous_callback callback,
+					void *user_data);
+
+/**
+ * @brief Type definition of ADC API function for stopping a continuous
+ *        sampling.
+ * See adc_continuous_stop() for argument descriptions.
+ */
+typedef int (*adc_api_continuous_stop)(const struct device *dev);
+
 /**
  * @brief ADC driver API
  *
@@ -705,6 +776,10 @@ __subsystem struct adc_driver_api {
 	adc_api_read          read;
 #ifdef CONFIG_ADC_ASYNC
 	adc_api_read_async    read_async;
+#endif
+#ifdef CONFIG_ADC_CONTINUOUS
+	adc_api_continuous_start continuous_start;
+	adc_api_continuous_stop  continuous_stop;
 #endif
 	uint16_t ref_internal;	/* mV */
 };
@@ -827,6 +902,85 @@ static inline int z_impl_adc_read_async(const struct device *dev,
 }
 #endif /* CONFIG_ADC_ASYNC */
 
+#if defined(CONFIG_ADC_CONTINUOUS) || defined(__DOXYGEN__)
+/**
+ * @brief Start a continuous sampling.
+ *
+ * The driver cycles conversions of the channels selected in the sequence
+ * into the buffer pointed by adc_sequence::buffer, treating it as a ring
+ * buffer that is refilled indefinitely. Each time half of the ring buffer
+ * is filled, the supplied callback is invoked from interrupt context with
+ * a pointer to the samples that are ready for processing; the other half
+ * is being overwritten with new samples in the meantime, so the callback
+ * data must be consumed before the ring wraps around again.
+ *
+ * The buffer size must be a multiple of twice the size of one sampling
+ * (one sample per selected channel), so that each half of the ring holds
+ * a whole number of samplings. The adc_sequence::options field must be
+ * NULL - the sampling interval is determined by the hardware conversion
+ * rate, not by the sequence options machinery.
+ *
+ * The sampling runs until adc_continuous_stop() is called or an error
+ * (e.g. an overrun or a DMA failure) occurs. Errors are reported through
+ * the callback with a non-zero adc_continuous_event::error value, after
+ * which the sampling is already stopped and the device can be used again.
+ *
+ * If another read operation is in progress, this call blocks until that
+ * operation completes.
+ *
+ * @note This function is not available from user mode threads, as the
+ *       callback is executed in interrupt context.
+ *
+ * @param dev       Pointer to the device structure for the driver instance.
+ * @param sequence  Structure specifying requested sequence of samplings.
+ * @param callback  Function called each time half of the ring buffer has
+ *                  been filled, and on errors.
+ * @param user_data Pointer passed to the callback, can be NULL.
+ *
+ * @retval 0        On success.
+ * @retval -ENOSYS  If the driver does not implement continuous sampling.
+ * @retval -EINVAL  If a parameter with an invalid value has been provided.
+ * @retval -ENOTSUP If the requested mode of operation is not supported.
+ */
+static inline int adc_continuous_start(const struct device *dev,
+				       const struct adc_sequence *sequence,
+				       adc_continuous_callback callback,
+				       void *user_data)
+{
+	const struct adc_driver_api *api = DEVICE_API_GET(adc, dev);
+
+	if (api->continuous_start == NULL) {
+		return -ENOSYS;
+	}
+
+	return api->continuous_start(dev, sequence, callback, user_data);
+}
+
+/**
+ * @brief Stop a continuous sampling.
+ *
+ * Stops the conversions started with adc_continuous_start() and makes the
+ * device available for other read operations. No further callbacks are
+ * invoked after this function returns.
+ *
+ * @param dev Pointer to the device structure for the driver instance.
+ *
+ * @retval 0        On success.
+ * @retval -ENOSYS  If the driver does not implement continuous sampling.
+ * @retval -EINVAL  If no continuous sampling is currently active.
+ */
+static inline int adc_continuous_stop(const struct device *dev)
+{
+	const struct adc_driver_api *api = DEVICE_API_GET(adc, dev);
+
+	if (api->continuous_stop == NULL) {
+		return -ENOSYS;
+	}
+
+	return api->continuous_stop(dev);
+}
+#endif /* CONFIG_ADC_CONTINUOUS */
+
 /**
  * @brief Get the internal reference voltage.
  *
@@ -1278,6 +1278,126 @@ __syscall int can_send(const struct device *dev, const struct can_frame *frame,
 		       k_timeout_t timeout, can_tx_callback_t callback,
 		       void *user_data);
 
+#if defined(CONFIG_CAN_TX_QUEUE) || defined(__DOXYGEN__)
+
+/**
+ * @brief CAN TX queue statistics
+ *
+ * @see can_tx_queue_stats_get()
+ */
+struct can_tx_queue_stats {
+	/** Number of frames accepted by @a can_tx_queue_put(). */
+	uint32_t enqueued;
+	/** Number of frames successfully transmitted. */
+	uint32_t sent;
+	/** Number of frames that failed transmission or were purged. */
+	uint32_t errors;
+	/** Maximum number of frames pending (queued plus in flight) at any time. */
+	uint32_t max_pending;
+};
+
+struct can_tx_queue;
+
+/**
+ * @brief CAN TX queue frame container
+ *
+ * Caller-provided storage for one queued CAN frame. The container must remain
+ * valid and unmodified from @a can_tx_queue_put() until the frame has been
+ * transmitted, failed or was purged.
+ */
+struct can_tx_queue_frame {
+	/** @cond INTERNAL_HIDDEN */
+	sys_snode_t node;
+	struct can_tx_queue *queue;
+	/** @endcond */
+	/** CAN frame to transmit. */
+	struct can_frame frame;
+	/** Optional completion callback. Can be ``NULL``. */
+	can_tx_callback_t callback;
+	/** User data to pass to the completion callback. */
+	void *user_data;
+};
+
+/**
+ * @brief Prioritized software CAN TX queue
+ *
+ * Accepts bursts of CAN frames beyond the number of hardware TX mailboxes of
+ * the CAN controller. Frames are handed to the controller in CAN arbitration
+ * priority order as mailboxes become available, driven by the transmit
+ * completion callbacks, keeping the mailboxes saturated without blocking the
+ * submitting thread.
+ *
+ * All members are internal, use @a can_tx_queue_init() for initialization.
+ */
+struct can_tx_queue {
+	/** @cond INTERNAL_HIDDEN */
+	const struct device *dev;
+	struct k_spinlock lock;
+	sys_slist_t frames;
+	struct k_work work;
+	uint32_t pending;
+	struct can_tx_queue_stats stats;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a CAN TX queue
+ *
+ * @param queue CAN TX queue to initialize.
+ * @param dev   Pointer to the device structure for the CAN controller driver
+ *              instance the queue transmits on.
+ */
+void can_tx_queue_init(struct can_tx_queue *queue, const struct device *dev);
+
+/**
+ * @brief Queue a CAN frame for prioritized transmission
+ *
+ * Copies @a frame into @a entry and inserts it into the TX queue according to
+ * its CAN arbitration priority (see @a can_send() for the priority rules).
+ * Frames with equal priority are transmitted in submission order. This
+ * function does not block and can be called from interrupt context.
+ *
+ * Transmission errors are reported through @a callback; frames rejected by
+ * the CAN controller driver (e.g. when the controller is in stopped or
+ * bus-off state) are dropped from the queue after the callback was invoked.
+ *
+ * @param queue     CAN TX queue to submit to.
+ * @param entry     Caller-provided frame container.
+ * @param frame     CAN frame to transmit.
+ * @param callback  Optional callback for when the frame was sent or a
+ *                  transmission error occurred. Can be ``NULL``.
+ * @param user_data User data to pass to callback function.
+ *
+ * @retval 0 if successful.
+ * @retval -EINVAL if an invalid parameter was passed to the function.
+ */
+int can_tx_queue_put(struct can_tx_queue *queue, struct can_tx_queue_frame *entry,
+		     const struct can_frame *frame, can_tx_callback_t callback,
+		     void *user_data);
+
+/**
+ * @brief Purge all frames not yet handed to the CAN controller
+ *
+ * Removes all queued frames which have not yet been handed to a hardware TX
+ * mailbox. The completion callback of each purged frame is invoked with
+ * ``-ECANCELED``. Frames already in a mailbox are not affected.
+ *
+ * @param queue CAN TX queue to purge.
+ *
+ * @return Number of frames purged.
+ */
+uint32_t can_tx_queue_purge(struct can_tx_queue *queue);
+
+/**
+ * @brief Get the statistics of a CAN TX queue
+ *
+ * @param queue      CAN TX queue to get the statistics for.
+ * @param[out] stats Statistics are written into the provided struct.
+ */
+void can_tx_queue_stats_get(struct can_tx_queue *queue, struct can_tx_queue_stats *stats);
+
+#endif /* CONFIG_CAN_TX_QUEUE */
+
 /** @} */
 
 /**
@@ -323,6 +323,8 @@ typedef int (*dma_api_reload)(const struct device *dev, uint32_t channel,
 			      uint32_t src, uint32_t dst, size_t size);
 #endif
 
+typedef int (*dma_api_resubmit)(const struct device *dev, uint32_t channel);
+
 typedef int (*dma_api_start)(const struct device *dev, uint32_t channel);
 
 typedef int (*dma_api_stop)(const struct device *dev, uint32_t channel);
@@ -369,6 +371,7 @@ typedef void (*dma_api_chan_release)(const struct device *dev,
 __subsystem struct dma_driver_api {
 	dma_api_config config;
 	dma_api_reload reload;
+	dma_api_resubmit resubmit;
 	dma_api_start start;
 	dma_api_stop stop;
 	dma_api_suspend suspend;
@@ -433,6 +436,39 @@ static inline int dma_reload(const struct device *dev, uint32_t channel,
 	return -ENOSYS;
 }
 
+/**
+ * @brief Resubmit the transfer last configured on a DMA channel
+ *
+ * Re-triggers the channel with the source, destination and size it was
+ * last configured with (via dma_config() or dma_reload()), skipping the
+ * full channel reconfiguration. This is considerably cheaper than calling
+ * dma_config() again when the same transfer is issued repeatedly, e.g.
+ * when feeding a display or a SPI peripheral from the same buffers.
+ *
+ * The channel must have been configured beforehand and must not have a
+ * transfer in progress.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param dev     Pointer to the device structure for the driver instance.
+ * @param channel Numeric identification of the channel to resubmit
+ *
+ * @retval 0 if successful.
+ * @retval -ENOSYS if the driver does not implement this operation.
+ * @retval Negative errno code on other failure.
+ */
+static inline int dma_resubmit(const struct device *dev, uint32_t channel)
+{
+	const struct dma_driver_api *api =
+		(const struct dma_driver_api *)dev->api;
+
+	if (api->resubmit) {
+		return api->resubmit(dev, channel);
+	}
+
+	return -ENOSYS;
+}
+
 /**
  * @brief Enables DMA channel and starts the transfer, the channel must be
  *        configured beforehand.
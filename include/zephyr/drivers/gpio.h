@@ -17,6 +17,7 @@
 
 #include <errno.h>
 
+#include <zephyr/arch/common/ffs.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/slist.h>
 #include <zephyr/tracing/tracing.h>
@@ -820,6 +821,10 @@ __subsystem struct gpio_driver_api {
 	int (*port_get_direction)(const struct device *port, gpio_port_pins_t map,
 				  gpio_port_pins_t *inputs, gpio_port_pins_t *outputs);
 #endif /* CONFIG_GPIO_GET_DIRECTION */
+#ifdef CONFIG_GPIO_PORT_CONFIGURE
+	int (*port_configure)(const struct device *port, gpio_port_pins_t pins,
+			      gpio_flags_t flags);
+#endif /* CONFIG_GPIO_PORT_CONFIGURE */
 };
 
 /**
@@ -1050,6 +1055,100 @@ static inline int gpio_pin_configure_dt(const struct gpio_dt_spec *spec,
 				  spec->dt_flags | extra_flags);
 }
 
+/**
+ * @brief Configure multiple pins in a port with identical settings.
+ *
+ * Every pin set in @p pins is configured with the same @p flags, as if
+ * gpio_pin_configure() was called for each of them. When
+ * @kconfig{CONFIG_GPIO_PORT_CONFIGURE} is enabled and the driver implements
+ * the operation, all pins are reconfigured with a single register-level
+ * update, otherwise the pins are configured one by one.
+ *
+ * @param port Pointer to device structure for the driver instance.
+ * @param pins Mask of pins to configure.
+ * @param flags Flags for pin configuration: 'GPIO input/output configuration
+ *        flags', 'GPIO pin drive flags', 'GPIO pin bias flags'.
+ *
+ * @retval 0 If successful.
+ * @retval -ENOTSUP if any of the configuration options is not supported
+ *                  (unless otherwise directed by flag documentation).
+ * @retval -EINVAL Invalid argument.
+ * @retval -EIO I/O error when accessing an external GPIO chip.
+ * @retval -EWOULDBLOCK if operation would block.
+ */
+__syscall int gpio_port_configure(const struct device *port,
+				  gpio_port_pins_t pins,
+				  gpio_flags_t flags);
+
+static inline int z_impl_gpio_port_configure(const struct device *port,
+					     gpio_port_pins_t pins,
+					     gpio_flags_t flags)
+{
+#ifdef CONFIG_GPIO_PORT_CONFIGURE
+	const struct gpio_driver_api *api =
+		(const struct gpio_driver_api *)port->api;
+	__unused const struct gpio_driver_config *const cfg =
+		(const struct gpio_driver_config *)port->config;
+	struct gpio_driver_data *data =
+		(struct gpio_driver_data *)port->data;
+
+	if (api->port_configure != NULL) {
+		__ASSERT((flags & GPIO_INT_MASK) == 0,
+			 "Interrupt flags are not supported");
+
+		__ASSERT((flags & (GPIO_PULL_UP | GPIO_PULL_DOWN)) !=
+			 (GPIO_PULL_UP | GPIO_PULL_DOWN),
+			 "Pull Up and Pull Down should not be enabled simultaneously");
+
+		__ASSERT(!((flags & GPIO_INPUT) && !(flags & GPIO_OUTPUT) &&
+			   (flags & GPIO_SINGLE_ENDED)),
+			 "Input cannot be enabled for 'Open Drain', 'Open Source' modes without Output");
+
+		__ASSERT_NO_MSG((flags & GPIO_SINGLE_ENDED) != 0 ||
+				(flags & GPIO_LINE_OPEN_DRAIN) == 0);
+
+		__ASSERT((flags & (GPIO_OUTPUT_INIT_LOW | GPIO_OUTPUT_INIT_HIGH)) == 0
+			 || (flags & GPIO_OUTPUT) != 0,
+			 "Output needs to be enabled to be initialized low or high");
+
+		__ASSERT((flags & (GPIO_OUTPUT_INIT_LOW | GPIO_OUTPUT_INIT_HIGH))
+			 != (GPIO_OUTPUT_INIT_LOW | GPIO_OUTPUT_INIT_HIGH),
+			 "Output cannot be initialized low and high");
+
+		if (((flags & GPIO_OUTPUT_INIT_LOGICAL) != 0)
+		    && ((flags & (GPIO_OUTPUT_INIT_LOW | GPIO_OUTPUT_INIT_HIGH)) != 0)
+		    && ((flags & GPIO_ACTIVE_LOW) != 0)) {
+			flags ^= GPIO_OUTPUT_INIT_LOW | GPIO_OUTPUT_INIT_HIGH;
+		}
+
+		flags &= ~GPIO_OUTPUT_INIT_LOGICAL;
+
+		__ASSERT((pins & ~cfg->port_pin_mask) == 0U,
+			 "Unsupported pins");
+
+		if ((flags & GPIO_ACTIVE_LOW) != 0) {
+			data->invert |= pins;
+		} else {
+			data->invert &= ~pins;
+		}
+
+		return api->port_configure(port, pins, flags);
+	}
+#endif /* CONFIG_GPIO_PORT_CONFIGURE */
+
+	while (pins != 0U) {
+		gpio_pin_t pin = (gpio_pin_t)(find_lsb_set(pins) - 1);
+		int ret = gpio_pin_configure(port, pin, flags);
+
+		if (ret != 0) {
+			return ret;
+		}
+		pins &= ~(gpio_port_pins_t)BIT(pin);
+	}
+
+	return 0;
+}
+
 /**
  * @brief Get direction of select pins in a port.
  *
@@ -1861,6 +1960,90 @@ static inline int gpio_remove_callback_dt(const struct gpio_dt_spec *spec,
 	return gpio_remove_callback(spec->port, callback);
 }
 
+/**
+ * @typedef gpio_pin_handler_t
+ * @brief Define the per-pin handler function signature
+ *
+ * @param port Device struct for the GPIO device.
+ * @param pin Pin number that triggered the handler
+ * @param user_data Pointer registered for the pin
+ */
+typedef void (*gpio_pin_handler_t)(const struct device *port, gpio_pin_t pin,
+				   void *user_data);
+
+/**
+ * @brief GPIO per-pin callback demultiplexer
+ *
+ * Routes interrupts of a port directly to a handler registered for each
+ * pin. The demultiplexer registers a single callback on the port and
+ * selects the handler of every pending pin by its number, so the dispatch
+ * cost does not grow with the number of handlers the way a list of
+ * individual callbacks does.
+ *
+ * All fields are internal, set the structure up through
+ * gpio_pin_demux_init() and gpio_pin_demux_add_handler(). Beware such
+ * structure should not be allocated on stack.
+ *
+ * Available only when @kconfig{CONFIG_GPIO_PIN_DEMUX} is enabled.
+ */
+struct gpio_pin_demux {
+	/** Callback registered on the port on behalf of the handlers. */
+	struct gpio_callback callback;
+
+	/** Handler of each pin, NULL when the pin has no handler. */
+	gpio_pin_handler_t handlers[GPIO_MAX_PINS_PER_PORT];
+
+	/** Pointer passed to the handler of each pin. */
+	void *user_data[GPIO_MAX_PINS_PER_PORT];
+};
+
+/**
+ * @brief Initialize a per-pin callback demultiplexer.
+ *
+ * @param demux A valid demultiplexer structure pointer.
+ */
+void gpio_pin_demux_init(struct gpio_pin_demux *demux);
+
+/**
+ * @brief Register a handler for one pin of a port.
+ *
+ * Adding the first handler registers the demultiplexer callback on the
+ * port. The selected pin must be configured to trigger an interrupt.
+ *
+ * @note Handlers may not be added or removed concurrently with each
+ * other on the same demultiplexer.
+ *
+ * @param port Pointer to the device structure for the driver instance.
+ * @param demux A demultiplexer initialized with gpio_pin_demux_init().
+ * @param pin Pin number the handler is called for.
+ * @param handler A valid handler function pointer.
+ * @param user_data Pointer passed to the handler, may be NULL.
+ * @retval 0 If successful
+ * @retval -EINVAL If the pin number is invalid
+ * @retval -EBUSY If the pin already has a handler
+ * @retval -errno Other negative errno code from gpio_add_callback()
+ */
+int gpio_pin_demux_add_handler(const struct device *port,
+			       struct gpio_pin_demux *demux, gpio_pin_t pin,
+			       gpio_pin_handler_t handler, void *user_data);
+
+/**
+ * @brief Remove the handler of one pin of a port.
+ *
+ * Removing the last handler removes the demultiplexer callback from the
+ * port.
+ *
+ * @param port Pointer to the device structure for the driver instance.
+ * @param demux A demultiplexer initialized with gpio_pin_demux_init().
+ * @param pin Pin number the handler was added for.
+ * @retval 0 If successful
+ * @retval -EINVAL If the pin number is invalid
+ * @retval -ENOENT If the pin has no handler
+ * @retval -errno Other negative errno code from gpio_remove_callback()
+ */
+int gpio_pin_demux_remove_handler(const struct device *port,
+				  struct gpio_pin_demux *demux, gpio_pin_t pin);
+
 /**
  * @brief Function to get pending interrupts
  *
@@ -836,6 +836,62 @@ static inline int z_impl_i2c_transfer(const struct device *dev,
 	return res;
 }
 
+/**
+ * @brief A set of messages for one target within a multi-target transfer.
+ */
+struct i2c_msg_set {
+	/** Array of messages to transfer to the target. */
+	struct i2c_msg *msgs;
+	/** Number of messages to transfer. */
+	uint8_t num_msgs;
+	/** Address of the I2C target device. */
+	uint16_t addr;
+};
+
+/**
+ * @brief Perform data transfers to multiple I2C targets back-to-back.
+ *
+ * This routine executes a batch of message sets, each addressed to a
+ * possibly different target on the same bus, in order and without
+ * returning to the caller in between. It is a convenience wrapper
+ * around i2c_transfer() for periodic multi-target polling loops.
+ *
+ * By default each message set is a separate bus transaction terminated
+ * by a STOP condition. When @kconfig{CONFIG_I2C_ALLOW_NO_STOP_TRANSACTIONS}
+ * is enabled and the last message of a set does not request a STOP, a
+ * driver supporting such transactions will chain into the next set with
+ * a repeated START carrying the new target address.
+ *
+ * For asynchronous batching without per-transfer call overhead, bind
+ * each target to an iodev with I2C_DT_IODEV_DEFINE() and submit the
+ * whole batch through RTIO.
+ *
+ * Processing stops at the first message set that fails.
+ *
+ * @param dev Pointer to the device structure for an I2C controller
+ * driver configured in controller mode.
+ * @param sets Array of message sets to transfer.
+ * @param num_sets Number of message sets to transfer.
+ *
+ * @retval 0 If successful.
+ * @retval -EIO General input / output error.
+ */
+static inline int i2c_transfer_multi(const struct device *dev,
+				     const struct i2c_msg_set *sets,
+				     size_t num_sets)
+{
+	for (size_t i = 0; i < num_sets; i++) {
+		int res = i2c_transfer(dev, sets[i].msgs, sets[i].num_msgs,
+				       sets[i].addr);
+
+		if (res != 0) {
+			return res;
+		}
+	}
+
+	return 0;
+}
+
 #if defined(CONFIG_I2C_CALLBACK) || defined(__DOXYGEN__)
 
 /**
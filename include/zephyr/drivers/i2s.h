@@ -506,6 +506,60 @@ static inline int i2s_write(const struct device *dev, void *mem_block,
  */
 __syscall int i2s_buf_write(const struct device *dev, void *buf, size_t size);
 
+/**
+ * @brief In-place block processing callback for i2s_relay().
+ *
+ * Called with a memory block removed from the RX queue before it is handed
+ * over to the TX queue. The callback may modify the data in place, e.g. to
+ * perform sample rate conversion or filtering, and may shrink or grow the
+ * number of valid bytes by updating @a size, as long as the result does not
+ * exceed the block size configured for the TX stream.
+ *
+ * @param mem_block Pointer to the memory block containing received data.
+ * @param size Pointer to the number of valid bytes in the block. May be
+ *        updated by the callback.
+ * @param user_data User data pointer passed to i2s_relay().
+ *
+ * @retval 0 If successful, the block is queued for transmission.
+ * @retval Negative errno code on failure, the block is dropped and the
+ *         error is returned from i2s_relay().
+ */
+typedef int (*i2s_process_cb_t)(void *mem_block, size_t *size,
+				void *user_data);
+
+/**
+ * @brief Relay one memory block from an RX queue to a TX queue.
+ *
+ * Remove the next memory block from the RX queue of @a rx_dev, optionally
+ * process it in place, and hand it over to the TX queue of @a tx_dev
+ * without copying the data. In a duplex audio pipeline this replaces an
+ * i2s_read()/i2s_write() pair that would otherwise shuttle each block
+ * through an intermediate buffer, saving one allocation, one free and one
+ * copy per block.
+
+ * Both streams have to be configured with the same memory slab, since the
+ * TX stream will release the block to its own slab once transmitted.
+ *
+ * Blocking behaviour and valid states are those of i2s_read() and
+ * i2s_write().
+ *
+ * @param rx_dev Pointer to the device structure providing the RX stream.
+ * @param tx_dev Pointer to the device structure providing the TX stream.
+ *        May be the same device as @a rx_dev.
+ * @param process Optional in-place processing callback, may be NULL.
+ * @param user_data User data passed to the processing callback.
+ *
+ * @retval 0 If successful.
+ * @retval -EIO One of the streams is not configured or is in a state that
+ *         does not permit the transfer.
+ * @retval -EINVAL The streams do not share a memory slab, or the processed
+ *         size exceeds the TX block size.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval Other negative errno code returned by the processing callback.
+ */
+int i2s_relay(const struct device *rx_dev, const struct device *tx_dev,
+	      i2s_process_cb_t process, void *user_data);
+
 /**
  * @brief Send a trigger command.
  *
@@ -383,9 +383,15 @@ typedef uint16_t spi_operation_t;
 /**
  * @brief SPI controller configuration structure
  *
- * @warning Most drivers use pointer comparison to determine whether a passed
- * configuration is different from one used in a previous transaction.
- * Changes to fields in the structure may not be detected.
+ * Most drivers cache the configuration applied in a previous transaction
+ * and skip peripheral reprogramming when the same (or a field-wise equal)
+ * configuration is passed again. For best performance on repeated
+ * transactions, reuse a persistent configuration object, or bind one to an
+ * iodev with SPI_DT_IODEV_DEFINE() and submit through RTIO.
+ *
+ * @warning Drivers compare against the previously used configuration by
+ * pointer first. Changes made to fields of that same object between
+ * transactions may not be detected.
  */
 struct spi_config {
 	/** @brief Bus frequency in Hertz. */
@@ -271,6 +271,14 @@ struct uart_event_rx {
 	size_t offset;
 	/** @brief Number of new bytes received. */
 	size_t len;
+#ifdef CONFIG_UART_ASYNC_RX_TIMESTAMP
+	/**
+	 * @brief Cycle counter value, as returned by k_cycle_get_32(),
+	 * latched by the driver when the end of the chunk was detected in
+	 * hardware, e.g. on an idle line interrupt or buffer completion.
+	 */
+	uint32_t timestamp;
+#endif
 };
 
 /** @brief UART RX buffer released event data. */
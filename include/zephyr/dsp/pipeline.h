@@ -0,0 +1,141 @@
+/* Copyright (c) 2025 Intel Corporation
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file zephyr/dsp/pipeline.h
+ *
+ * @brief Fixed processing chains built from DSP operations.
+ */
+
+#ifndef ZEPHYR_INCLUDE_DSP_PIPELINE_H_
+#define ZEPHYR_INCLUDE_DSP_PIPELINE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/__assert.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @ingroup math_dsp
+ * @defgroup math_dsp_pipeline DSP Pipeline
+ *
+ * A pipeline is a fixed sequence of processing stages executed back to back
+ * on each batch of samples. Intermediate results ping-pong between two
+ * caller-provided scratch buffers, so a chain of any length needs only two
+ * intermediate buffers sized for the widest stage output, and each batch is
+ * processed with a single call instead of one call plus one buffer per stage.
+ *
+ * @since 4.2
+ * @{
+ */
+
+/**
+ * @brief Pipeline stage processing function.
+ *
+ * A stage reads @p block_size samples from @p src, writes its result to
+ * @p dst and returns the number of samples produced. Stages that keep the
+ * sample count (element-wise operations) return @p block_size unchanged;
+ * rate-changing stages such as decimators return the reduced count, which
+ * becomes the input count of the next stage.
+ *
+ * @p src and @p dst never overlap.
+ *
+ * @param[in]  src        points to the stage input samples
+ * @param[out] dst        points to the stage output buffer
+ * @param[in]  block_size number of input samples
+ * @param[in]  ctx        stage context given at pipeline definition
+ *
+ * @return number of samples written to @p dst
+ */
+typedef uint32_t (*zdsp_pipeline_stage_fn)(const void *src, void *dst, uint32_t block_size,
+					   void *ctx);
+
+/** @brief One stage of a pipeline. */
+struct zdsp_pipeline_stage {
+	/** Stage processing function */
+	zdsp_pipeline_stage_fn process;
+	/** Opaque context passed to @ref zdsp_pipeline_stage.process */
+	void *ctx;
+};
+
+/** @brief A fixed chain of processing stages. */
+struct zdsp_pipeline {
+	/** Array of stages, executed in order */
+	const struct zdsp_pipeline_stage *stages;
+	/** Number of entries in @ref zdsp_pipeline.stages */
+	size_t num_stages;
+	/** Ping-pong buffers holding intermediate stage results */
+	void *scratch[2];
+};
+
+/**
+ * @brief Initialize a pipeline.
+ *
+ * Each scratch buffer must be large enough to hold the largest output any
+ * intermediate stage can produce. With @p num_stages of one, no intermediate
+ * results exist and both scratch pointers may be NULL.
+ *
+ * @param[out] pipeline   pipeline to initialize
+ * @param[in]  stages     array of stages, executed in order
+ * @param[in]  num_stages number of entries in @p stages, at least one
+ * @param[in]  scratch_a  first intermediate buffer
+ * @param[in]  scratch_b  second intermediate buffer
+ */
+static inline void zdsp_pipeline_init(struct zdsp_pipeline *pipeline,
+				      const struct zdsp_pipeline_stage *stages, size_t num_stages,
+				      void *scratch_a, void *scratch_b)
+{
+	__ASSERT_NO_MSG(num_stages > 0);
+	__ASSERT_NO_MSG(num_stages == 1 || (scratch_a != NULL && scratch_b != NULL));
+
+	pipeline->stages = stages;
+	pipeline->num_stages = num_stages;
+	pipeline->scratch[0] = scratch_a;
+	pipeline->scratch[1] = scratch_b;
+}
+
+/**
+ * @brief Run one batch of samples through a pipeline.
+ *
+ * The first stage reads from @p src and the last stage writes to @p dst;
+ * all intermediate results alternate between the two scratch buffers.
+ * @p src and @p dst may be the same buffer only for single-stage pipelines
+ * whose stage tolerates in-place operation.
+ *
+ * @param[in]  pipeline   pipeline to run
+ * @param[in]  src        points to the input samples
+ * @param[out] dst        points to the output buffer
+ * @param[in]  block_size number of input samples
+ *
+ * @return number of samples written to @p dst
+ */
+static inline uint32_t zdsp_pipeline_run(const struct zdsp_pipeline *pipeline, const void *src,
+					 void *dst, uint32_t block_size)
+{
+	const void *in = src;
+
+	for (size_t i = 0; i < pipeline->num_stages; i++) {
+		const struct zdsp_pipeline_stage *stage = &pipeline->stages[i];
+		void *out = (i == pipeline->num_stages - 1) ? dst : pipeline->scratch[i % 2];
+
+		block_size = stage->process(in, out, block_size, stage->ctx);
+		in = out;
+	}
+
+	return block_size;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DSP_PIPELINE_H_ */
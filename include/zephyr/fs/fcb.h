@@ -59,6 +59,15 @@ struct fcb_entry {
 	/**< Offset from the start of the sector to the start of element. */
 
 	uint16_t fe_data_len; /**< Size of data area in fcb entry*/
+
+#ifdef CONFIG_FCB_ENTRY_CACHE
+	uint32_t fe_cache_seq;
+	/**< Sequence number + 1 of the entry within the entry location
+	 * cache, 0 when the location was not served from the cache.
+	 * Internal state used by fcb_getnext to continue iteration
+	 * without re-reading preceding entries from flash.
+	 */
+#endif
 };
 
 /**
@@ -84,6 +93,25 @@ struct fcb_entry_ctx {
  */
 #define FCB_FLAGS_CRC_DISABLED BIT(0)
 
+#ifdef CONFIG_FCB_ENTRY_CACHE
+/**
+ * @brief Cached FCB entry location.
+ *
+ * Compact in-RAM form of an entry location. An array of these is handed
+ * to @ref fcb_cache_init to serve as the entry location cache of an FCB
+ * instance.
+ */
+struct fcb_cache_entry {
+	uint32_t ce_loc;
+	/**< Index of the sector within fcb->f_sectors in the top byte,
+	 * offset of the element from the sector start in the lower three
+	 * bytes.
+	 */
+
+	uint16_t ce_data_len; /**< Length of the entry payload */
+};
+#endif
+
 /**
  * @brief FCB instance structure
  *
@@ -141,6 +169,25 @@ struct fcb {
 	const uint8_t f_flags;
 	/**< Flags for configuring the FCB. */
 #endif
+
+#ifdef CONFIG_FCB_ENTRY_CACHE
+	struct {
+		struct fcb_cache_entry *entries;
+		/**< Caller-provided entry location ring */
+
+		uint16_t capacity; /**< Number of elements in entries */
+		uint16_t cnt; /**< Number of cached entry locations */
+		uint16_t head; /**< Ring index of the oldest cached entry */
+		uint32_t seq_oldest;
+		/**< Sequence number of the oldest cached entry */
+
+		bool valid;
+		/**< Cache holds locations of all entries in flash */
+	} f_cache;
+	/**< Entry location cache attached with fcb_cache_init,
+	 * internal state
+	 */
+#endif
 };
 
 /**
@@ -191,6 +238,39 @@ int fcb_append(struct fcb *fcbp, uint16_t len, struct fcb_entry *loc);
  */
 int fcb_append_finish(struct fcb *fcbp, struct fcb_entry *append_loc);
 
+/**
+ * @brief Descriptor of a single entry for @ref fcb_append_batch.
+ */
+struct fcb_batch_entry {
+	const void *data; /**< Entry payload */
+	uint16_t len; /**< Length of the entry payload */
+};
+
+/**
+ * Appends multiple entries to circular buffer in one go.
+ *
+ * The entries are serialized, together with their length headers and
+ * endmarkers, into the caller-provided work buffer and contiguous runs
+ * are programmed with a single flash write each. This reduces the number
+ * of flash operations compared to looping over fcb_append() and
+ * fcb_append_finish(). Each appended entry is complete; no separate
+ * finish call is needed.
+ *
+ * On failure, entries appended before the error occurred remain
+ * committed.
+ *
+ * @param[in] fcbp     FCB instance structure.
+ * @param[in] entries  Array of entry descriptors to append.
+ * @param[in] cnt      Number of elements in @p entries.
+ * @param[in] buf      Work buffer used to serialize the entries.
+ * @param[in] buf_size Size of @p buf; must fit at least the largest
+ *                     entry including its length header and endmarker.
+ *
+ * @return 0 on success, non-zero on failure.
+ */
+int fcb_append_batch(struct fcb *fcbp, const struct fcb_batch_entry *entries, uint16_t cnt,
+		     uint8_t *buf, size_t buf_size);
+
 /**
  * FCB Walk callback function type.
  *
@@ -303,6 +383,28 @@ int fcb_offset_last_n(struct fcb *fcbp, uint8_t entries, struct fcb_entry *last_
  */
 int fcb_clear(struct fcb *fcbp);
 
+#ifdef CONFIG_FCB_ENTRY_CACHE
+/**
+ * Attach an entry location cache to fcb instance.
+ *
+ * Scans the locations of existing entries into the cache; afterwards
+ * fcb_getnext() and fcb_walk() are served from RAM without re-reading
+ * and CRC-checking preceding entries from flash. The cache is kept up
+ * to date by fcb_append_finish(), fcb_append_batch() and fcb_rotate().
+ * When the number of stored entries exceeds the cache capacity, the
+ * cache is disabled and lookups transparently fall back to walking the
+ * flash contents.
+ *
+ * @param[in] fcbp     FCB instance structure.
+ * @param[in] entries  Array used to store the cached entry locations.
+ * @param[in] capacity Number of elements in @p entries.
+ *
+ * @return 0 on success, -ENOMEM when the stored entries do not fit in
+ *         the cache, other non-zero on failure.
+ */
+int fcb_cache_init(struct fcb *fcbp, struct fcb_cache_entry *entries, uint16_t capacity);
+#endif
+
 /**
  * @}
  */
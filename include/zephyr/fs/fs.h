@@ -84,6 +84,12 @@ enum {
  * callback for the file system should set the flag on success.
  */
 #define FS_MOUNT_FLAG_USE_DISK_ACCESS BIT(3)
+/** Flag enables the file read cache for files opened on the mount point.
+ * Requires CONFIG_FILE_SYSTEM_CACHE to be enabled, otherwise the flag
+ * is ignored. The cache pages are shared between all mount points with
+ * the flag set.
+ */
+#define FS_MOUNT_FLAG_CACHE BIT(4)
 
 /**
  * @brief File system mount info structure
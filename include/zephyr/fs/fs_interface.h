@@ -78,6 +78,10 @@ struct fs_file_t {
 	void *filep;
 	/** Pointer to mount point structure */
 	const struct fs_mount_t *mp;
+#if defined(CONFIG_FILE_SYSTEM_CACHE) || defined(__DOXYGEN__)
+	/** Pointer to file cache state, NULL if the file is not cached */
+	void *cache_filep;
+#endif
 	/** Open/create flags */
 	fs_mode_t flags;
 };
@@ -33,6 +33,18 @@ extern "C" {
  */
 #define FS_LITTLEFS_DISK_VERSION_MINOR_GET(disk_version) FIELD_GET(GENMASK(15, 0), disk_version)
 
+#ifdef CONFIG_FS_LITTLEFS_MAINTENANCE
+/** @brief Counters for littlefs maintenance passes */
+struct fs_littlefs_stats {
+	/** Number of completed maintenance passes */
+	uint32_t gc_runs;
+	/** Accumulated duration of all maintenance passes, in milliseconds */
+	uint32_t gc_total_ms;
+	/** Duration of the longest single maintenance pass, in milliseconds */
+	uint32_t gc_max_ms;
+};
+#endif /* CONFIG_FS_LITTLEFS_MAINTENANCE */
+
 /** @brief Filesystem info structure for LittleFS mount */
 struct fs_littlefs {
 	/* Defaulted in driver, customizable before mount. */
@@ -53,6 +65,24 @@ struct fs_littlefs {
 	struct lfs lfs;
 	void *backend;
 	struct k_mutex mutex;
+
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	/* Block cache state, initialized automatically at mount. */
+	uint32_t cache_offset[CONFIG_FS_LITTLEFS_BLOCK_CACHE_LINE_COUNT];
+	uint32_t cache_next_offset;
+	uint8_t cache_next_victim;
+	uint8_t cache_data[CONFIG_FS_LITTLEFS_BLOCK_CACHE_LINE_COUNT]
+			  [CONFIG_FS_LITTLEFS_BLOCK_CACHE_LINE_SIZE];
+#endif
+
+#ifdef CONFIG_FS_LITTLEFS_MAINTENANCE
+	/* Maintenance counters and buffer capacities recorded at the
+	 * first mount, filled automatically.
+	 */
+	struct fs_littlefs_stats stats;
+	lfs_size_t cache_capacity;
+	lfs_size_t lookahead_capacity;
+#endif
 };
 
 /** @brief Define a littlefs configuration with customized size
@@ -117,6 +147,71 @@ struct fs_littlefs {
 					  CONFIG_FS_LITTLEFS_CACHE_SIZE, \
 					  CONFIG_FS_LITTLEFS_LOOKAHEAD_SIZE)
 
+#if defined(CONFIG_FS_LITTLEFS_MAINTENANCE) || defined(__DOXYGEN__)
+
+/** @brief Runtime tuning parameters for a LittleFS mount
+ *
+ * Used with @ref fs_littlefs_tune. A zero value keeps the current
+ * setting of the corresponding parameter.
+ */
+struct fs_littlefs_tuning {
+	/** New cache size; must not exceed the capacity of the buffers
+	 * the mount was declared with.
+	 */
+	lfs_size_t cache_size;
+	/** New lookahead size; must not exceed the capacity of the buffer
+	 * the mount was declared with.
+	 */
+	lfs_size_t lookahead_size;
+	/** Maximum size of files stored inline in their directory metadata */
+	lfs_size_t inline_max;
+	/** Metadata compaction threshold in bytes; set to a negative value
+	 * to defer all compaction to @ref fs_littlefs_gc.
+	 */
+	lfs_ssize_t compact_thresh;
+};
+
+/** @brief Run pending littlefs janitorial work
+ *
+ * Performs metadata compaction and other garbage collection that would
+ * otherwise run lazily during an unlucky write, adding latency to it.
+ * Calling this from known-idle windows moves that cost out of the
+ * application's critical paths. The call blocks other operations on the
+ * mount until it completes; the maintenance counters record how long.
+ *
+ * @param mountp Mount point of a mounted littlefs filesystem
+ *
+ * @retval 0 on success, negative errno code on fail.
+ */
+int fs_littlefs_gc(struct fs_mount_t *mountp);
+
+/** @brief Retune a mounted littlefs filesystem
+ *
+ * Applies new cache, lookahead, inline file and compaction threshold
+ * parameters by remounting the filesystem internally. All files and
+ * directories on the mount must be closed before calling this; open
+ * handles are invalidated by the remount.
+ *
+ * @param mountp Mount point of a mounted littlefs filesystem
+ * @param tuning Parameters to apply, zero fields keep current settings
+ *
+ * @retval 0 on success, negative errno code on fail.
+ */
+int fs_littlefs_tune(struct fs_mount_t *mountp,
+		     const struct fs_littlefs_tuning *tuning);
+
+/** @brief Read the maintenance counters of a littlefs mount
+ *
+ * @param mountp Mount point of a mounted littlefs filesystem
+ * @param stats Destination for a snapshot of the counters
+ *
+ * @retval 0 on success, negative errno code on fail.
+ */
+int fs_littlefs_stats_get(struct fs_mount_t *mountp,
+			  struct fs_littlefs_stats *stats);
+
+#endif /* CONFIG_FS_LITTLEFS_MAINTENANCE */
+
 #ifdef __cplusplus
 }
 #endif
@@ -33,6 +33,20 @@ extern "C" {
  * @{
  */
 
+#if defined(CONFIG_NVS_DATA_CACHE) || defined(__DOXYGEN__)
+/**
+ * @brief Cached copy of a recently accessed NVS entry
+ */
+struct nvs_data_cache_entry {
+	/** Id of the cached entry, 0xFFFF when the slot is unused */
+	uint16_t id;
+	/** Length of the cached data */
+	uint16_t len;
+	/** Copy of the entry data */
+	uint8_t data[CONFIG_NVS_DATA_CACHE_ENTRY_SIZE];
+};
+#endif
+
 /**
  * @brief Non-volatile Storage File system structure
  */
@@ -61,6 +75,14 @@ struct nvs_fs {
 	const struct flash_parameters *flash_parameters;
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+#if CONFIG_NVS_LOOKUP_CACHE_FULL
+	/** Ids owning the cached ATE addresses, used for exact-match lookup */
+	uint16_t lookup_cache_id[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+#endif
+#endif
+#if CONFIG_NVS_DATA_CACHE
+	/** Cached data of recently accessed entries */
+	struct nvs_data_cache_entry data_cache[CONFIG_NVS_DATA_CACHE_SIZE];
 #endif
 };
 
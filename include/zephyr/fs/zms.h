@@ -31,6 +31,18 @@ extern "C" {
  * @{
  */
 
+#ifdef CONFIG_ZMS_WRITE_CACHE
+/** Write-behind cache entry holding the most recent unflushed write of an ID */
+struct zms_wc_entry {
+	/** Buffered data; only the first `len` bytes are valid */
+	uint8_t data[CONFIG_ZMS_WRITE_CACHE_DATA_SIZE];
+	/** ID of the buffered entry */
+	uint32_t id;
+	/** Buffered data length; a zero length buffers a delete */
+	uint16_t len;
+};
+#endif
+
 /** Zephyr Memory Storage file system structure */
 struct zms_fs {
 	/** File system offset in flash */
@@ -65,6 +77,29 @@ struct zms_fs {
 	/** Lookup table used to cache ATE addresses of written IDs */
 	uint64_t lookup_cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
 #endif
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	/** Work item used to run garbage collection outside of the write path */
+	struct k_work gc_work;
+	/** Number of garbage collection passes since mount */
+	uint32_t gc_count;
+	/** Largest amount of live data (in bytes) moved by a single garbage collection
+	 *  pass since mount. A value close to the sector size means that the sectors are
+	 *  nearly full of live data and that the partition should be enlarged.
+	 */
+	uint32_t gc_max_copied;
+#endif
+#ifdef CONFIG_ZMS_WRITE_CACHE
+	/** Write-behind cache entries, kept in the order they were first buffered */
+	struct zms_wc_entry wc_entry[CONFIG_ZMS_WRITE_CACHE_ENTRIES];
+	/** Number of used write-behind cache entries */
+	uint8_t wc_count;
+	/** Work item used to flush the write-behind cache periodically */
+	struct k_work_delayable wc_flush_work;
+#endif
+#ifdef CONFIG_ZMS_WEAR_STATS
+	/** Per-sector erase counts since mount */
+	uint32_t erase_count[CONFIG_ZMS_WEAR_STATS_SECTORS];
+#endif
 };
 
 /**
@@ -142,6 +177,35 @@ ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len);
  */
 int zms_delete(struct zms_fs *fs, uint32_t id);
 
+/**
+ * @brief Flush all buffered writes to the storage.
+ *
+ * Writes out every entry held in the write-behind cache, in the order the entries were first
+ * buffered. Does nothing when `CONFIG_ZMS_WRITE_CACHE` is disabled.
+ *
+ * @param fs Pointer to the file system.
+ *
+ * @retval 0 on success.
+ * @retval -EACCES if `fs` is not mounted.
+ * @retval -ENOSPC if there is no space to flush a buffered entry. Unflushed entries are kept.
+ * @retval -EIO if there is a memory read/write error.
+ */
+int zms_sync(struct zms_fs *fs);
+
+#ifdef CONFIG_ZMS_WEAR_STATS
+/**
+ * @brief Get the number of times a sector was erased since mount.
+ *
+ * @param fs Pointer to the file system.
+ * @param sector Sector number (0-based).
+ *
+ * @retval Erase count of the sector (>= 0) on success.
+ * @retval -EACCES if `fs` is not mounted.
+ * @retval -EINVAL if `sector` does not exist or is beyond `CONFIG_ZMS_WEAR_STATS_SECTORS`.
+ */
+ssize_t zms_sector_erase_count(struct zms_fs *fs, uint32_t sector);
+#endif
+
 /**
  * @brief Read an entry from the file system.
  *
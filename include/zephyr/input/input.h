@@ -158,6 +158,54 @@ struct input_callback {
 #define INPUT_CALLBACK_DEFINE(_dev, _callback, _user_data)                     \
 	INPUT_CALLBACK_DEFINE_NAMED(_dev, _callback, _user_data, _callback)
 
+/**
+ * @brief Input frame callback structure.
+ */
+struct input_frame_callback {
+	/** @ref device pointer or NULL. */
+	const struct device *dev;
+	/** The callback function. */
+	void (*callback)(struct input_event *evts, uint16_t count,
+			 void *user_data);
+	/** User data pointer. */
+	void *user_data;
+};
+
+/**
+ * @brief Register a callback structure for input event frames with a custom
+ * name.
+ *
+ * Same as @ref INPUT_FRAME_CALLBACK_DEFINE but allows specifying a custom
+ * name for the callback structure. Useful if multiple callbacks are used for
+ * the same callback function.
+ */
+#define INPUT_FRAME_CALLBACK_DEFINE_NAMED(_dev, _callback, _user_data, name)   \
+	static const STRUCT_SECTION_ITERABLE(input_frame_callback,             \
+					     _input_frame_callback__##name) = {\
+		.dev = _dev,                                                   \
+		.callback = _callback,                                         \
+		.user_data = _user_data,                                       \
+	}
+
+/**
+ * @brief Register a callback structure for input event frames.
+ *
+ * The callback is invoked with the whole sequence of events up to and
+ * including the one with the synchronization bit set, so that a frame
+ * reported as multiple events (for example X, Y and pressure of a touch
+ * event) only causes a single callback invocation. Per-event callbacks
+ * registered with @ref INPUT_CALLBACK_DEFINE are not affected.
+ *
+ * Frame callbacks are only invoked when @kconfig{CONFIG_INPUT_EVENT_FRAMES}
+ * is enabled.
+ *
+ * @param _dev @ref device pointer or NULL.
+ * @param _callback The callback function.
+ * @param _user_data Pointer to user specified data.
+ */
+#define INPUT_FRAME_CALLBACK_DEFINE(_dev, _callback, _user_data)               \
+	INPUT_FRAME_CALLBACK_DEFINE_NAMED(_dev, _callback, _user_data, _callback)
+
 #ifdef __cplusplus
 }
 #endif
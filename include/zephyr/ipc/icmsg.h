@@ -97,6 +97,10 @@ struct icmsg_data_t {
 	const struct icmsg_config_t *cfg;
 #ifdef CONFIG_MULTITHREADING
 	struct k_work mbox_work;
+#endif
+#ifdef CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE
+	struct k_work_delayable tx_coalesce_work;
+	atomic_t tx_coalesce_pending;
 #endif
 	uint16_t remote_sid;
 	uint16_t local_sid;
@@ -217,6 +217,36 @@ int pbuf_rx_init(struct pbuf *pb);
 
 int pbuf_write(struct pbuf *pb, const char *buf, uint16_t len);
 
+/**
+ * @brief Write data to the packet buffer without publishing it.
+ *
+ * This function behaves like pbuf_write() except that the shared write index
+ * is not updated, so the reader does not see the message yet. Several
+ * messages can be staged this way and published together with a single
+ * pbuf_write_commit() call, amortizing the write index cache flush over the
+ * whole batch.
+ *
+ * @param pb	A buffer to which to write.
+ * @param buf	Pointer to the data to be written to the buffer.
+ * @param len	Number of bytes to be written to the buffer. Must be positive.
+ * @retval int	Number of bytes written, negative error code on fail.
+ *		-EINVAL, if any of input parameter is incorrect.
+ *		-ENOMEM, if len is bigger than the buffer can fit.
+ */
+int pbuf_write_stage(struct pbuf *pb, const char *buf, uint16_t len);
+
+/**
+ * @brief Publish messages staged with pbuf_write_stage().
+ *
+ * Updates the shared write index so that all previously staged messages
+ * become visible to the reader. Does nothing if there is no staged data.
+ *
+ * @param pb	A buffer to which staged data was written.
+ * @retval 0 on success.
+ * @retval -EINVAL, if the input parameter is incorrect.
+ */
+int pbuf_write_commit(struct pbuf *pb);
+
 /**
  * @brief Read specified amount of data from the packet buffer.
  *
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Interrupt coalescing helper
+ *
+ * Helper for drivers servicing high-rate interrupt sources. Instead of
+ * running its processing from every interrupt, a driver reports each
+ * hardware event with irq_coalesce_event() and gets a batched callback in
+ * thread context once either the configured number of events accumulated
+ * or the configured latency budget expired. When the event threshold is
+ * reached the interrupt line is masked until the batch has been processed,
+ * bounding the interrupt rate under load.
+ */
+
+#ifndef ZEPHYR_INCLUDE_IRQ_COALESCE_H_
+#define ZEPHYR_INCLUDE_IRQ_COALESCE_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup irq_coalesce_apis Interrupt coalescing APIs
+ * @ingroup isr_apis
+ * @{
+ */
+
+/** Interrupt coalescing statistics */
+struct irq_coalesce_stats {
+	/** Total number of events reported */
+	uint32_t events;
+	/** Number of batched callback invocations */
+	uint32_t batches;
+	/** Largest number of events handed to a single callback */
+	uint32_t max_batch;
+};
+
+/**
+ * @brief Batched event callback
+ *
+ * Invoked from the system workqueue with the interrupt line still masked
+ * if the event threshold was reached, so the device can be drained without
+ * further interrupts arriving.
+ *
+ * @param user_data User data passed to irq_coalesce_init().
+ * @param events Number of events accumulated since the previous callback.
+ */
+typedef void (*irq_coalesce_cb_t)(void *user_data, uint32_t events);
+
+/** Interrupt coalescing state. Initialize with irq_coalesce_init(). */
+struct irq_coalesce {
+	/** Work item running the batched callback */
+	struct k_work_delayable work;
+	/** Batched event callback */
+	irq_coalesce_cb_t cb;
+	/** User data passed to the callback */
+	void *user_data;
+	/** Lock protecting the event count */
+	struct k_spinlock lock;
+	/** Interrupt line being moderated */
+	unsigned int irq;
+	/** Number of events that forces an immediate batch */
+	uint32_t max_events;
+	/** Longest time an event may wait for its batch */
+	k_timeout_t max_latency;
+	/** Events accumulated since the last batch */
+	uint32_t pending;
+	/** Whether the interrupt line is currently masked by the helper */
+	bool masked;
+	/** Statistics */
+	struct irq_coalesce_stats stats;
+};
+
+/**
+ * @brief Initialize an interrupt coalescing helper
+ *
+ * @param ic Coalescing state to initialize.
+ * @param irq Interrupt line to moderate.
+ * @param max_events Number of pending events at which the line is masked and
+ *                   the callback is scheduled immediately.
+ * @param max_latency Longest time an event may be held back; the callback runs
+ *                    at the latest this long after the first event of a batch.
+ * @param cb Callback processing a batch of events.
+ * @param user_data User data passed to the callback.
+ */
+void irq_coalesce_init(struct irq_coalesce *ic, unsigned int irq, uint32_t max_events,
+		       k_timeout_t max_latency, irq_coalesce_cb_t cb, void *user_data);
+
+/**
+ * @brief Report one hardware event
+ *
+ * Meant to be called from the driver's ISR after acknowledging the device.
+ * Schedules the batched callback according to the moderation policy.
+ *
+ * @param ic Coalescing state.
+ */
+void irq_coalesce_event(struct irq_coalesce *ic);
+
+/**
+ * @brief Run the batched callback as soon as possible
+ *
+ * Cuts the latency budget of the current batch short, e.g. before entering
+ * a low power state.
+ *
+ * @param ic Coalescing state.
+ */
+void irq_coalesce_flush(struct irq_coalesce *ic);
+
+/**
+ * @brief Get a consistent snapshot of the coalescing statistics
+ *
+ * @param ic Coalescing state.
+ * @param stats Destination for the snapshot.
+ */
+void irq_coalesce_stats_get(struct irq_coalesce *ic, struct irq_coalesce_stats *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_IRQ_COALESCE_H_ */
@@ -1867,6 +1867,22 @@ static inline void *z_impl_k_timer_user_data_get(const struct k_timer *timer)
  */
 __syscall int64_t k_uptime_ticks(void);
 
+#if defined(CONFIG_SYS_CLOCK_UPTIME_FASTPATH) || defined(__DOXYGEN__)
+/**
+ * @brief Get system uptime, in system ticks, without a system call.
+ *
+ * This routine computes the uptime from the cycle counter and a time
+ * anchor maintained by the system clock, so calling it from user mode
+ * does not enter the kernel. It requires the z_uptime_partition memory
+ * partition in the calling thread's memory domain and a cycle counter
+ * that is readable from unprivileged code, and may differ from
+ * k_uptime_ticks() by one tick.
+ *
+ * @return Current uptime in ticks.
+ */
+int64_t k_uptime_ticks_fast(void);
+#endif /* CONFIG_SYS_CLOCK_UPTIME_FASTPATH */
+
 /**
  * @brief Get system uptime.
  *
@@ -2778,6 +2794,130 @@ struct k_fifo {
 
 /** @} */
 
+struct k_fifo_bounded {
+	atomic_t put_head;
+	atomic_t get_tail;
+	uint32_t mask;
+	atomic_ptr_t *buf;
+	Z_DECL_POLL_EVENT
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_FIFO_BOUNDED_INITIALIZER(obj, buffer, size) \
+	{ \
+	.put_head = ATOMIC_INIT(0), \
+	.get_tail = ATOMIC_INIT(0), \
+	.mask = (size) - 1U, \
+	.buf = (buffer), \
+	Z_POLL_EVENT_OBJ_INIT(obj) \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @defgroup fifo_bounded_apis Bounded FIFO APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Initialize a bounded FIFO.
+ *
+ * This routine initializes a bounded FIFO, prior to its first use. A
+ * bounded FIFO is a fixed-capacity lock-free ring of pointer-sized
+ * items with any number of producers and a single consumer, intended
+ * for ISR to thread handoff.
+ *
+ * @param fifo Address of the bounded FIFO.
+ * @param buffer Backing slot buffer.
+ * @param size Number of slots in @a buffer, must be a power of two.
+ */
+void k_fifo_bounded_init(struct k_fifo_bounded *fifo, atomic_ptr_t *buffer,
+			 uint32_t size);
+
+/**
+ * @brief Add an element to a bounded FIFO.
+ *
+ * This routine adds a data item to @a fifo without taking a lock; any
+ * number of threads and ISRs may put concurrently. @a data must not be
+ * NULL as NULL marks free slots.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param fifo Address of the bounded FIFO.
+ * @param data Address of the data item.
+ *
+ * @retval 0 on success
+ * @retval -ENOMEM if the FIFO is full
+ */
+int k_fifo_bounded_put(struct k_fifo_bounded *fifo, void *data);
+
+/**
+ * @brief Get an element from a bounded FIFO.
+ *
+ * This routine removes the head data item from @a fifo. Only a single
+ * consumer thread may get at any given time. Waiting sleeps through
+ * k_poll() and thus requires @kconfig{CONFIG_POLL}; without it only
+ * K_NO_WAIT may be used.
+ *
+ * @param fifo Address of the bounded FIFO.
+ * @param timeout Waiting period to obtain a data item,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Head data item, or NULL if the FIFO is empty and the timeout
+ *	   expired.
+ */
+void *k_fifo_bounded_get(struct k_fifo_bounded *fifo, k_timeout_t timeout);
+
+/**
+ * @brief Query a bounded FIFO to see if it has data available.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param fifo Address of the bounded FIFO.
+ *
+ * @return true if the FIFO has no retrievable data item.
+ */
+static inline bool k_fifo_bounded_is_empty(struct k_fifo_bounded *fifo)
+{
+	atomic_val_t tail = atomic_get(&fifo->get_tail);
+
+	/* Test the head slot pointer rather than comparing the indices:
+	 * between a producer's index claim and its pointer store the
+	 * indices differ but nothing is retrievable yet, and that window
+	 * lasts arbitrarily long if the producer is preempted. k_poll()
+	 * readiness builds on this check, so it must not report data
+	 * before a get can succeed; the producer raises the poll event
+	 * only after publishing the pointer.
+	 */
+	return atomic_ptr_get(&fifo->buf[(uint32_t)tail & fifo->mask]) == NULL;
+}
+
+/**
+ * @brief Statically define and initialize a bounded FIFO.
+ *
+ * The bounded FIFO can be accessed outside the module where it is
+ * defined using:
+ *
+ * @code extern struct k_fifo_bounded <name>; @endcode
+ *
+ * @param name Name of the bounded FIFO.
+ * @param size Number of slots, must be a power of two.
+ */
+#define K_FIFO_BOUNDED_DEFINE(name, size) \
+	BUILD_ASSERT(((size) & ((size) - 1U)) == 0U, \
+		     "size must be a power of two"); \
+	static atomic_ptr_t _k_fifo_bounded_buf_##name[size]; \
+	struct k_fifo_bounded name = \
+		Z_FIFO_BOUNDED_INITIALIZER(name, _k_fifo_bounded_buf_##name, \
+					   size)
+
+/** @} */
+
 struct k_lifo {
 	struct k_queue _queue;
 #ifdef CONFIG_OBJ_CORE_LIFO
@@ -2865,6 +3005,31 @@ struct k_lifo {
 	lap_ret; \
 	})
 
+/**
+ * @brief Atomically add a list of elements to a LIFO queue.
+ *
+ * This routine adds a list of data items to @a lifo in one operation.
+ * The data items must be in a singly-linked list, with the first word of
+ * each data item pointing to the next data item; the list must be
+ * NULL-terminated. Threads waiting on @a lifo are woken in a single pass,
+ * each receiving one of the data items.
+ *
+ * Note that unlike repeated @ref k_lifo_put calls, the remaining items
+ * become available for retrieval in list order rather than in reverse.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param lifo Address of the LIFO queue.
+ * @param head Pointer to first node in singly-linked list.
+ * @param tail Pointer to last node in singly-linked list.
+ */
+#define k_lifo_put_list(lifo, head, tail) \
+	({ \
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_lifo, put_list, lifo, head, tail); \
+	k_queue_append_list(&(lifo)->_queue, head, tail); \
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_lifo, put_list, lifo, head, tail); \
+	})
+
 /**
  * @brief Get an element from a LIFO queue.
  *
@@ -3625,6 +3790,36 @@ void k_work_queue_start(struct k_work_q *queue,
 			k_thread_stack_t *stack, size_t stack_size,
 			int prio, const struct k_work_queue_config *cfg);
 
+#ifdef CONFIG_WORK_QUEUE_POOL
+/** @brief Add an additional worker thread to a started work queue.
+ *
+ * Each thread added this way services the same pending list as the
+ * queue's original thread, turning the queue into a worker pool:
+ * independent work items submitted to the queue may then execute in
+ * parallel on SMP. The submission, scheduling, drain, flush and cancel
+ * APIs are unchanged; only k_work_queue_stop() is not supported on a
+ * queue with more than one thread.
+ *
+ * Ordering guarantees are relaxed on such a queue: work items are
+ * still started in submission order, but items may run concurrently
+ * and complete in any order.
+ *
+ * @param queue pointer to a started queue structure.
+ *
+ * @param thread caller-provided storage for the worker thread.
+ *
+ * @param stack pointer to the worker thread stack area.
+ *
+ * @param stack_size size of the worker thread stack area, in bytes.
+ *
+ * @param prio initial thread priority.
+ */
+void k_work_queue_add_thread(struct k_work_q *queue,
+			     struct k_thread *thread,
+			     k_thread_stack_t *stack, size_t stack_size,
+			     int prio);
+#endif /* CONFIG_WORK_QUEUE_POOL */
+
 /** @brief Access the thread that animates a work queue.
  *
  * This is necessary to grant a work queue thread access to things the work
@@ -3967,6 +4162,41 @@ int k_work_cancel_delayable(struct k_work_delayable *dwork);
 bool k_work_cancel_delayable_sync(struct k_work_delayable *dwork,
 				  struct k_work_sync *sync);
 
+/** @brief Cancel a set of delayable work items and wait.
+ *
+ * Equivalent to invoking k_work_cancel_delayable_sync() on every item in @p
+ * dworks, except that all cancellations are initiated in a single pass before
+ * any waiting is done.  This takes the work lock once for the whole set, and
+ * handlers that are running on different work queues drain in parallel rather
+ * than one after the other.
+ *
+ * @note Canceling delayable work does not prevent rescheduling it.  It does
+ * prevent submitting it until the cancellation completes.
+ *
+ * @note Be careful of caller and work queue thread relative priority.  If
+ * this function sleeps it will not return until the work queue threads
+ * complete the tasks that allow this thread to resume.
+ *
+ * @note Behavior is undefined if this function is invoked from a work queue
+ * running any of the items in @p dworks.
+ *
+ * @param dworks pointer to an array of pointers to delayable work items.
+ *
+ * @param count number of entries in @p dworks.
+ *
+ * @param sync pointer to an opaque item containing state related to the
+ * pending cancellations.  The object must persist until the call returns, and
+ * be accessible from both the caller thread and the work queue threads.  The
+ * object must not be used for any other flush or cancel operation until this
+ * one completes.  On architectures with CONFIG_KERNEL_COHERENCE the object
+ * must be allocated in coherent memory.
+ *
+ * @return the number of items that were not idle when cancellation was
+ * initiated.
+ */
+size_t k_work_cancel_delayable_bulk(struct k_work_delayable **dworks, size_t count,
+				    struct k_work_sync *sync);
+
 enum {
 /**
  * @cond INTERNAL_HIDDEN
@@ -4219,6 +4449,17 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORK_QUEUE_POOL
+	/* Number of work items currently being processed, used instead
+	 * of the single busy bit when more than one thread services the
+	 * queue.
+	 */
+	uint16_t busy_cnt;
+
+	/* Number of threads servicing the queue. */
+	uint16_t nthreads;
+#endif
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4616,6 +4857,15 @@ struct k_msgq {
 
 	Z_DECL_POLL_EVENT
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	/** Lock-free mode producer cursor */
+	atomic_t enq_pos;
+	/** Lock-free mode consumer cursor */
+	atomic_t deq_pos;
+	/** Lock-free mode: consumer announced it is pending on wait_q */
+	atomic_t consumer_waiting;
+#endif
+
 	/** Message queue */
 	uint8_t flags;
 
@@ -4651,6 +4901,7 @@ struct k_msgq {
 
 
 #define K_MSGQ_FLAG_ALLOC	BIT(0)
+#define K_MSGQ_FLAG_LOCKFREE	BIT(1)
 
 /**
  * @brief Message Queue Attributes
@@ -4707,6 +4958,42 @@ struct k_msgq_attrs {
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs);
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+/**
+ * @brief Ring buffer size needed by a lock-free message queue.
+ *
+ * Each slot carries an atomic sequence word in addition to the
+ * (atomic-word aligned) message payload.
+ *
+ * @param q_msg_size Message size (in bytes).
+ * @param q_max_msgs Maximum number of messages (power of 2).
+ */
+#define K_MSGQ_LOCKFREE_BUF_SIZE(q_msg_size, q_max_msgs) \
+	((q_max_msgs) * (sizeof(atomic_t) + ROUND_UP(q_msg_size, sizeof(atomic_t))))
+
+/**
+ * @brief Initialize a message queue in lock-free MPSC mode.
+ *
+ * Initializes a message queue whose put path uses a bounded lock-free
+ * multi-producer ring instead of the queue spinlock, so ISR producers
+ * (on any CPU) never spin on a lock held by another context.
+ *
+ * Restrictions compared to a regular message queue: @a max_msgs must
+ * be a power of two, @a buffer must be atomic-word aligned and sized
+ * with K_MSGQ_LOCKFREE_BUF_SIZE(), k_msgq_put() never blocks (a full
+ * queue returns -ENOMSG regardless of the timeout), only a single
+ * thread may call k_msgq_get(), and peek/purge/k_poll are not
+ * supported.
+ *
+ * @param msgq Address of the message queue.
+ * @param buffer Pointer to ring buffer that holds queued messages.
+ * @param msg_size Message size (in bytes).
+ * @param max_msgs Maximum number of messages that can be queued.
+ */
+void k_msgq_lockfree_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
+			  uint32_t max_msgs);
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 /**
  * @brief Initialize a message queue.
  *
@@ -4900,6 +5187,10 @@ struct k_mbox_msg {
 	k_tid_t tx_target_thread;
 	/** internal use only - thread waiting on send (may be a dummy) */
 	k_tid_t _syncing_thread;
+#ifdef CONFIG_MBOX_DIRECT_COPY
+	/** internal use only - waiting receiver's retrieval buffer */
+	void *_rx_buffer;
+#endif
 #if (CONFIG_NUM_MBOX_ASYNC_MSGS > 0)
 	/** internal use only - semaphore used during asynchronous send */
 	struct k_sem *_async_sem;
@@ -5343,6 +5634,80 @@ __syscall int k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len,
 __syscall int k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len,
 			  k_timeout_t timeout);
 
+/**
+ * @brief Claim a contiguous part of the pipe buffer for writing
+ *
+ * This routine claims up to @a size contiguous bytes of the pipe's ring buffer so the caller can
+ * produce data directly in place, avoiding the copy made by k_pipe_write(). The claimed region is
+ * not visible to readers until it is committed with k_pipe_write_finish(). The claim may be
+ * smaller than requested when the pipe is nearly full or when the ring buffer wraps; commit what
+ * was produced and claim again to use the space beyond the wrap point.
+ *
+ * This routine does not block and may not be called from user mode. The claim interface assumes a
+ * single producer: k_pipe_write(..) must not be called while a write claim is outstanding.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Pointer set to the start of the claimed region.
+ * @param size Requested region size (in bytes).
+ *
+ * @retval number of bytes claimed, possibly zero or less than @a size
+ * @retval -ECANCELED if the pipe is resetting
+ * @retval -EPIPE if the pipe was closed
+ */
+int k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t size);
+
+/**
+ * @brief Commit bytes produced in a claimed part of the pipe buffer
+ *
+ * This routine makes @a size bytes of the region claimed with k_pipe_write_claim() available to
+ * readers and wakes up any threads blocked in k_pipe_read(..). Committing fewer bytes than were
+ * claimed releases the remainder of the claim.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes written to the claimed region.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @a size exceeds the claimed region
+ */
+int k_pipe_write_finish(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Claim a contiguous part of the pipe buffer for reading
+ *
+ * This routine claims up to @a size contiguous bytes of data in the pipe's ring buffer so the
+ * caller can consume it in place, avoiding the copy made by k_pipe_read(). The data remains in
+ * the pipe until released with k_pipe_read_finish(). The claim may be smaller than requested when
+ * less data is available or when the ring buffer wraps; release what was consumed and claim again
+ * to get the data beyond the wrap point.
+ *
+ * This routine does not block and may not be called from user mode. The claim interface assumes a
+ * single consumer: k_pipe_read(..) must not be called while a read claim is outstanding.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Pointer set to the start of the claimed data.
+ * @param size Requested data size (in bytes).
+ *
+ * @retval number of bytes claimed, possibly zero or less than @a size
+ * @retval -ECANCELED if the pipe is resetting
+ * @retval -EPIPE if the pipe was closed and no data is left in it
+ */
+int k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t size);
+
+/**
+ * @brief Release bytes consumed from a claimed part of the pipe buffer
+ *
+ * This routine removes @a size bytes of the data claimed with k_pipe_read_claim() from the pipe
+ * and wakes up any threads blocked in k_pipe_write(..). Releasing fewer bytes than were claimed
+ * keeps the remainder of the data in the pipe.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes consumed from the claimed data.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @a size exceeds the claimed data
+ */
+int k_pipe_read_finish(struct k_pipe *pipe, size_t size);
+
 /**
  * @brief Reset a pipe
  * This routine resets the pipe, discarding any unread data and unblocking any threads waiting to
@@ -5378,6 +5743,17 @@ struct k_mem_slab_info {
 #endif
 };
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+struct k_mem_slab_cpu_cache {
+	uint8_t count;
+	char *blocks[CONFIG_MEM_SLAB_PERCPU_CACHE_SIZE];
+};
+
+struct k_mem_slab_percpu_cache {
+	struct k_mem_slab_cpu_cache cpu[CONFIG_MP_MAX_NUM_CPUS];
+};
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
@@ -5385,6 +5761,11 @@ struct k_mem_slab {
 	char *free_list;
 	struct k_mem_slab_info info;
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	/* NULL unless defined via K_MEM_SLAB_DEFINE_PERCPU() */
+	struct k_mem_slab_percpu_cache *percpu_cache;
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
@@ -5402,6 +5783,26 @@ struct k_mem_slab {
 	.info = {_slab_num_blocks, _slab_block_size, 0}               \
 	}
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+#define Z_MEM_SLAB_PERCPU_INITIALIZER(_slab, _slab_buffer,            \
+				      _slab_block_size,               \
+				      _slab_num_blocks, _slab_cache)  \
+	{                                                             \
+	.wait_q = Z_WAIT_Q_INIT(&(_slab).wait_q),                     \
+	.lock = {},                                                   \
+	.buffer = _slab_buffer,                                       \
+	.free_list = NULL,                                            \
+	.info = {_slab_num_blocks, _slab_block_size, 0},              \
+	.percpu_cache = _slab_cache,                                  \
+	}
+
+#if defined(CONFIG_DCACHE_LINE_SIZE) && (CONFIG_DCACHE_LINE_SIZE > 0)
+#define Z_MEM_SLAB_CL_ALIGN CONFIG_DCACHE_LINE_SIZE
+#else
+#define Z_MEM_SLAB_CL_ALIGN sizeof(void *)
+#endif
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
+
 
 /**
  * INTERNAL_HIDDEN @endcond
@@ -5466,6 +5867,42 @@ struct k_mem_slab {
 		Z_MEM_SLAB_INITIALIZER(name, _k_mem_slab_buf_##name, \
 					WB_UP(slab_block_size), slab_num_blocks)
 
+/**
+ * @brief Statically define and initialize a memory slab with per-CPU caching.
+ *
+ * Like K_MEM_SLAB_DEFINE(), but each block is padded and aligned to the
+ * data cache line size, and each CPU keeps a small private cache of free
+ * blocks (CONFIG_MEM_SLAB_PERCPU_CACHE_SIZE entries) in front of the
+ * shared free list.  Allocation and free served from the local cache
+ * only mask interrupts and never contend on the slab spinlock, which
+ * avoids lock and cache line ping-pong for per-packet allocation
+ * patterns on SMP.
+ *
+ * Blocks held in a remote CPU's cache are not available to allocators
+ * until that cache spills back to the shared pool, so size the slab
+ * with CONFIG_MEM_SLAB_PERCPU_CACHE_SIZE * CONFIG_MP_MAX_NUM_CPUS
+ * blocks of headroom and prefer K_NO_WAIT allocations.
+ *
+ * Only available with CONFIG_MEM_SLAB_PERCPU_CACHE.
+ *
+ * @param name Name of the memory slab.
+ * @param slab_block_size Size of each memory block (in bytes).
+ * @param slab_num_blocks Number memory blocks.
+ */
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+#define K_MEM_SLAB_DEFINE_PERCPU(name, slab_block_size, slab_num_blocks) \
+	char __noinit_named(k_mem_slab_buf_##name) \
+	   __aligned(Z_MEM_SLAB_CL_ALIGN) \
+	   _k_mem_slab_buf_##name[(slab_num_blocks) * \
+				  ROUND_UP(slab_block_size, Z_MEM_SLAB_CL_ALIGN)]; \
+	static struct k_mem_slab_percpu_cache _k_mem_slab_cache_##name; \
+	STRUCT_SECTION_ITERABLE(k_mem_slab, name) = \
+		Z_MEM_SLAB_PERCPU_INITIALIZER(name, _k_mem_slab_buf_##name, \
+					ROUND_UP(slab_block_size, Z_MEM_SLAB_CL_ALIGN), \
+					slab_num_blocks, \
+					&_k_mem_slab_cache_##name)
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
+
 /**
  * @brief Initialize a memory slab.
  *
@@ -5929,6 +6366,9 @@ enum _poll_types_bits {
 	/* pipe data availability */
 	_POLL_TYPE_PIPE_DATA_AVAILABLE,
 
+	/* bounded FIFO data availability */
+	_POLL_TYPE_FIFO_BOUNDED_DATA_AVAILABLE,
+
 	_POLL_NUM_TYPES
 };
 
@@ -5957,6 +6397,9 @@ enum _poll_states_bits {
 	/* data is available to read from a pipe */
 	_POLL_STATE_PIPE_DATA_AVAILABLE,
 
+	/* data is available to read on a bounded FIFO */
+	_POLL_STATE_FIFO_BOUNDED_DATA_AVAILABLE,
+
 	_POLL_NUM_STATES
 };
 
@@ -5991,6 +6434,8 @@ enum _poll_states_bits {
 #define K_POLL_TYPE_FIFO_DATA_AVAILABLE K_POLL_TYPE_DATA_AVAILABLE
 #define K_POLL_TYPE_MSGQ_DATA_AVAILABLE Z_POLL_TYPE_BIT(_POLL_TYPE_MSGQ_DATA_AVAILABLE)
 #define K_POLL_TYPE_PIPE_DATA_AVAILABLE Z_POLL_TYPE_BIT(_POLL_TYPE_PIPE_DATA_AVAILABLE)
+#define K_POLL_TYPE_FIFO_BOUNDED_DATA_AVAILABLE \
+	Z_POLL_TYPE_BIT(_POLL_TYPE_FIFO_BOUNDED_DATA_AVAILABLE)
 
 /* public - polling modes */
 enum k_poll_modes {
@@ -6008,6 +6453,8 @@ enum k_poll_modes {
 #define K_POLL_STATE_FIFO_DATA_AVAILABLE K_POLL_STATE_DATA_AVAILABLE
 #define K_POLL_STATE_MSGQ_DATA_AVAILABLE Z_POLL_STATE_BIT(_POLL_STATE_MSGQ_DATA_AVAILABLE)
 #define K_POLL_STATE_PIPE_DATA_AVAILABLE Z_POLL_STATE_BIT(_POLL_STATE_PIPE_DATA_AVAILABLE)
+#define K_POLL_STATE_FIFO_BOUNDED_DATA_AVAILABLE \
+	Z_POLL_STATE_BIT(_POLL_STATE_FIFO_BOUNDED_DATA_AVAILABLE)
 #define K_POLL_STATE_CANCELLED Z_POLL_STATE_BIT(_POLL_STATE_CANCELLED)
 
 /* public - poll signal object */
@@ -6069,6 +6516,8 @@ struct k_poll_event {
 		struct k_queue *queue, *typed_K_POLL_TYPE_DATA_AVAILABLE;
 		struct k_msgq *msgq, *typed_K_POLL_TYPE_MSGQ_DATA_AVAILABLE;
 		struct k_pipe *pipe, *typed_K_POLL_TYPE_PIPE_DATA_AVAILABLE;
+		struct k_fifo_bounded *fifo_bounded,
+			*typed_K_POLL_TYPE_FIFO_BOUNDED_DATA_AVAILABLE;
 	};
 };
 
@@ -6161,6 +6610,72 @@ void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 __syscall int k_poll(struct k_poll_event *events, int num_events,
 		     k_timeout_t timeout);
 
+/**
+ * @brief Persistent set of poll events
+ *
+ * Keeps the event registrations made by k_poll_set_wait() alive between
+ * waits so that repeatedly polling the same events does not pay for
+ * registering and unregistering every event on every call.
+ */
+struct k_poll_set {
+	/** Array of events to be polled for */
+	struct k_poll_event *events;
+	/** Number of events in the array */
+	int num_events;
+};
+
+/**
+ * @brief Initialize a persistent set of poll events
+ *
+ * Ready a poll set for use with k_poll_set_wait(). The events array must
+ * have been initialized the same way as for k_poll() and must remain
+ * valid, and must not be passed to k_poll(), until the set is torn down
+ * with k_poll_set_deinit().
+ *
+ * @param set A poll set.
+ * @param events An array of events to be polled for.
+ * @param num_events The number of events in the array.
+ */
+void k_poll_set_init(struct k_poll_set *set, struct k_poll_event *events,
+		     int num_events);
+
+/**
+ * @brief Wait for an event of a persistent poll set to be ready.
+ *
+ * Behaves like k_poll() on the events of the set, but the registrations
+ * made on the polled objects are left in place when the call returns and
+ * are reused by the next wait; only registrations consumed by an event
+ * becoming ready are re-armed. A thread polling the same events in a
+ * loop thus avoids most of the per-call registration cost of k_poll().
+ *
+ * The set must always be waited on by the same thread, and the same
+ * rules apply as for k_poll(): the caller has to reset the state field
+ * of ready events to K_POLL_STATE_NOT_READY before the next wait. While
+ * the set holds registrations the owning thread must not also call
+ * k_poll(), as a set event becoming ready would terminate that poll
+ * early. This function is not available from user mode.
+ *
+ * @param set A poll set initialized with k_poll_set_init().
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 One or more events are ready.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINTR Polling has been interrupted, e.g. with
+ *         k_queue_cancel_wait().
+ */
+int k_poll_set_wait(struct k_poll_set *set, k_timeout_t timeout);
+
+/**
+ * @brief Tear down a persistent set of poll events
+ *
+ * Clears all event registrations still held by the set. The events array
+ * may be reused, including with k_poll(), afterwards.
+ *
+ * @param set A poll set initialized with k_poll_set_init().
+ */
+void k_poll_set_deinit(struct k_poll_set *set);
+
 /**
  * @brief Initialize a poll signal object.
  *
@@ -144,6 +144,11 @@ struct _thread_base {
 	void *slice_data;
 #endif /* CONFIG_TIMESLICE_PER_THREAD */
 
+#ifdef CONFIG_TIMESLICE_ADAPTIVE
+	/* saturating count of consecutive end-of-slice preemptions */
+	uint8_t slice_score;
+#endif /* CONFIG_TIMESLICE_ADAPTIVE */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	struct k_cycle_stats  usage;   /* Track thread usage statistics */
 #endif /* CONFIG_SCHED_THREAD_USAGE */
@@ -320,6 +325,11 @@ struct k_thread {
 	struct _thread_stack_info stack_info;
 #endif /* CONFIG_THREAD_STACK_INFO */
 
+#if defined(CONFIG_THREAD_STACK_WATERMARK)
+	/** cached unused stack space from the last stack space query */
+	size_t stack_unused;
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
 #if defined(CONFIG_USERSPACE)
 	/** memory domain info of the thread */
 	struct _mem_domain_info mem_domain_info;
@@ -122,9 +122,7 @@ struct _priq_rb {
 struct _priq_mq {
 	sys_dlist_t queues[K_NUM_THREAD_PRIO];
 	unsigned long bitmask[PRIQ_BITMAP_SIZE];
-#ifndef CONFIG_SMP
 	unsigned int cached_queue_index;
-#endif
 };
 
 struct _ready_q {
@@ -157,7 +155,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -178,6 +176,14 @@ struct _cpu {
 	uint8_t swap_ok;
 #endif
 
+#ifdef CONFIG_IPI_OPTIMIZE
+	/* Bitmask of reasons for pending scheduler IPIs (see IPI_CAUSE_*),
+	 * so that the IPI handler knows what work triggered the interrupt
+	 * without scanning. Multiple causes coalesce into one interrupt.
+	 */
+	atomic_t pending_ipi_causes;
+#endif
+
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	/*
 	 * [usage0] is used as a timestamp to mark the beginning of an
@@ -213,7 +219,7 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if !defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) && !defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
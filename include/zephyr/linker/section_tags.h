@@ -59,6 +59,20 @@
 #define __nocache_noinit __noinit
 #endif /* CONFIG_NOCACHE_MEMORY */
 
+/* Attribute macro to group frequently accessed driver data.
+ *
+ * Marked objects are collected next to the device states in RAM so that
+ * interrupt-heavy devices share cache lines with their own state instead
+ * of being scattered between unrelated data. With
+ * CONFIG_DEVICE_HOT_DATA_DTCM the marked objects are placed in the
+ * tightly coupled data memory instead.
+ */
+#if defined(CONFIG_DEVICE_HOT_DATA_DTCM)
+#define __hot_device_data __dtcm_data_section
+#else
+#define __hot_device_data Z_GENERIC_SECTION(.device_hot_data)
+#endif /* CONFIG_DEVICE_HOT_DATA_DTCM */
+
 #if defined(CONFIG_KERNEL_COHERENCE)
 #define __incoherent __in_section_unique(cached)
 #if defined(CONFIG_USERSPACE)
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_LOG_BACKEND_RETENTION_H_
+#define ZEPHYR_LOG_BACKEND_RETENTION_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Callback invoked for every valid message found in the ring buffer
+ *
+ * @param data     Dictionary-encoded log message.
+ * @param len      Length of the message in bytes.
+ * @param ctx      User context passed to log_backend_retention_dump().
+ */
+typedef void (*log_backend_retention_cb_t)(const uint8_t *data, size_t len,
+					   void *ctx);
+
+/**
+ * @brief Dump all messages stored in the retained ring buffer
+ *
+ * @details Walks the ring buffer from the oldest to the newest message and
+ *          invokes the callback for every message whose CRC matches its
+ *          contents. Messages with a CRC mismatch, typically a frame torn
+ *          by a reset during the write, are skipped. The walk stops early
+ *          if a frame header is found to be corrupted. The caller must
+ *          ensure the backend is not concurrently writing to the ring
+ *          buffer, e.g. by dumping before the logging subsystem is started
+ *          or after deactivating the backend.
+ *
+ * @param cb       Callback invoked for every valid message.
+ * @param ctx      User context passed to the callback.
+ *
+ * @return Number of messages delivered to the callback on success,
+ *         negative errno code on failure.
+ */
+int log_backend_retention_dump(log_backend_retention_cb_t cb, void *ctx);
+
+/**
+ * @brief Discard all messages stored in the retained ring buffer
+ *
+ * @return 0 on success, negative errno code on failure.
+ */
+int log_backend_retention_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_LOG_BACKEND_RETENTION_H_ */
@@ -104,6 +104,12 @@ uint8_t z_log_ext_domain_count(void);
 /** @brief Initialize module for handling logging message. */
 void z_log_msg_init(void);
 
+/** @brief Initialize the user mode log staging buffer. */
+void z_log_user_staging_init(void);
+
+/** @brief Convert staged user mode records into regular log messages. */
+void z_log_user_staging_drain(void);
+
 /** @brief Commit log message.
  *
  * @param msg Message.
@@ -351,7 +351,11 @@ do { \
 					   (uint32_t)_plen, _dlen); \
 	LOG_MSG_DBG("creating message on stack: package len: %d, data len: %d\n", \
 			_plen, (int)(_dlen)); \
-	z_log_msg_static_create((void *)(_source), _desc, _msg->data, (_data)); \
+	if (IS_ENABLED(CONFIG_LOG_USER_STAGING) && k_is_user_context()) { \
+		z_log_msg_user_stage((void *)(_source), _desc, _msg->data, (_data)); \
+	} else { \
+		z_log_msg_static_create((void *)(_source), _desc, _msg->data, (_data)); \
+	} \
 } while (false)
 
 #ifdef CONFIG_LOG_SPEED
@@ -651,6 +655,32 @@ __syscall void z_log_msg_static_create(const void *source,
 					const struct log_msg_desc desc,
 					uint8_t *package, const void *data);
 
+/** @brief Memory partition holding the user mode log staging buffer.
+ *
+ * When CONFIG_LOG_USER_STAGING is enabled it must be added to the memory
+ * domain of every user mode thread that logs.
+ */
+extern struct k_mem_partition log_user_staging_partition;
+
+/** @brief Create a log message from user mode without entering the kernel.
+ *
+ * Message is staged in a shared lock-free buffer and turned into a regular
+ * log message when log processing drains the buffer. Falls back to
+ * z_log_msg_static_create() when the message does not fit into the staging
+ * buffer slot limit or another user thread is currently staging a message.
+ * Available when CONFIG_LOG_USER_STAGING is enabled.
+ *
+ * @param source Source.
+ *
+ * @param desc Message descriptor.
+ *
+ * @param package Package.
+ *
+ * @param data Data.
+ */
+void z_log_msg_user_stage(const void *source, const struct log_msg_desc desc,
+			  uint8_t *package, const void *data);
+
 /** @brief Create message at runtime.
  *
  * Function allows to build any log message based on input data. Processing
@@ -12,6 +12,8 @@
 #ifndef ZEPHYR_INCLUDE_MULTI_HEAP_MANAGER_SMH_H_
 #define ZEPHYR_INCLUDE_MULTI_HEAP_MANAGER_SMH_H_
 
+#include <zephyr/sys/mem_stats.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -83,6 +85,26 @@ enum shared_multi_heap_attr {
 /** Maximum number of standard attributes. */
 #define MAX_SHARED_MULTI_HEAP_ATTR SMH_REG_ATTR_NUM
 
+/**
+ * @brief SMH allocation policy enumeration type.
+ *
+ * Policy used to select the region to allocate from when several regions
+ * share the requested attribute.
+ */
+enum shared_multi_heap_policy {
+	/** Try the regions in the order they were added (default) */
+	SMH_ALLOC_POLICY_FIRST_FIT,
+
+	/** Try the regions in ascending order of their cost value */
+	SMH_ALLOC_POLICY_PREFER_FAST,
+
+	/**
+	 * Try the regions in descending order of free bytes. Only available
+	 * when CONFIG_SYS_HEAP_RUNTIME_STATS is enabled.
+	 */
+	SMH_ALLOC_POLICY_PREFER_LARGEST_FREE,
+};
+
 /**
  * @brief SMH region struct
  *
@@ -98,6 +120,12 @@ struct shared_multi_heap_region {
 
 	/** Memory heap size in bytes */
 	size_t size;
+
+	/** Relative cost of the region's memory among the regions sharing
+	 *  the same attribute (lower is faster), used by
+	 *  @ref SMH_ALLOC_POLICY_PREFER_FAST. Leave zero when unused.
+	 */
+	uint16_t cost;
 };
 
 /**
@@ -176,6 +204,78 @@ void shared_multi_heap_free(void *block);
  */
 int shared_multi_heap_add(struct shared_multi_heap_region *region, void *user_data);
 
+/**
+ * @brief Set the allocation policy
+ *
+ * Selects how the framework picks the region to allocate from when several
+ * regions carry the requested attribute. The policy applies to all the
+ * subsequent allocations and is expected to be set once at init time.
+ *
+ * @param policy	allocation policy to use.
+ *
+ * @retval 0		on success.
+ * @retval -EINVAL	when the policy is unknown.
+ * @retval -ENOTSUP	when the policy needs CONFIG_SYS_HEAP_RUNTIME_STATS
+ *			and that option is disabled.
+ */
+int shared_multi_heap_policy_set(enum shared_multi_heap_policy policy);
+
+/**
+ * @brief Allocate memory from a specific region
+ *
+ * Same as @ref shared_multi_heap_aligned_alloc but pinned to a single region:
+ * only the region added as the `idx`-th one (starting from 0) with the given
+ * attribute is tried, regardless of the allocation policy.
+ *
+ * @param attr		capability / attribute requested for the memory block.
+ * @param idx		index of the region among the ones with that attribute,
+ *			in the order they were added.
+ * @param align		power of two alignment for the returned pointer, in bytes.
+ * @param bytes		requested size of the allocation in bytes.
+ *
+ * @retval ptr		a valid pointer to heap memory.
+ * @retval err		NULL if the region does not exist or has no memory.
+ */
+void *shared_multi_heap_alloc_pinned(enum shared_multi_heap_attr attr, unsigned int idx,
+				     size_t align, size_t bytes);
+
+/**
+ * @brief Move a block to a region with another attribute
+ *
+ * Allocates a new block with the requested attribute, copies the usable
+ * content of the passed block into it and frees the old block. Useful to
+ * rehome long-lived buffers out of scarce fast memory. The new block is
+ * naturally aligned by the heap; callers with stricter alignment needs must
+ * handle the move themselves.
+ *
+ * @param block		block to move, allocated from the shared multi-heap pool.
+ * @param attr		capability / attribute requested for the new block.
+ *
+ * @retval ptr		a valid pointer to the new block; the old one is freed.
+ * @retval err		NULL if no memory is available; the old block is left
+ *			untouched.
+ */
+void *shared_multi_heap_migrate(void *block, enum shared_multi_heap_attr attr);
+
+/**
+ * @brief Get the runtime statistics of a region
+ *
+ * Reports the occupancy statistics of a single region: allocated bytes, free
+ * bytes and the maximum of allocated bytes seen so far. Only available when
+ * CONFIG_SYS_HEAP_RUNTIME_STATS is enabled.
+ *
+ * @param attr		capability / attribute of the region.
+ * @param idx		index of the region among the ones with that attribute,
+ *			in the order they were added.
+ * @param stats		pointer to the destination statistics structure.
+ *
+ * @retval 0		on success.
+ * @retval -EINVAL	when the attribute or the index is out-of-bound.
+ * @retval -ENOTSUP	when CONFIG_SYS_HEAP_RUNTIME_STATS is disabled.
+ */
+int shared_multi_heap_runtime_stats_get(enum shared_multi_heap_attr attr, unsigned int idx,
+					struct sys_memory_stats *stats);
+
 /**
  * @}
  */
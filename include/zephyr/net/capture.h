@@ -333,6 +333,66 @@ static inline void net_capture_data(struct net_capture_cooked *ctx,
 }
 #endif
 
+/**
+ * @typedef net_capture_passive_cb_t
+ * @brief Callback used to deliver captured packets in passive mode
+ *
+ * @details The packet is only valid during the callback and is freed
+ *          when the callback returns, so the callback must copy out
+ *          any data it wants to keep.
+ *
+ * @param pkt Cloned and possibly truncated captured network packet
+ * @param user_data A valid pointer to user data or NULL
+ */
+typedef void (*net_capture_passive_cb_t)(struct net_pkt *pkt, void *user_data);
+
+/**
+ * @brief Enable passive network packet capturing.
+ *
+ * @details In passive mode the captured packets are not sent to a
+ *          tunnel peer. Each captured packet is cloned, queued and
+ *          delivered to the given callback from the system workqueue.
+ *
+ * @param iface Network interface to capture packets from. If set to NULL,
+ *              then packets from all network interfaces are captured.
+ * @param cb Callback to call for each captured packet
+ * @param user_data User supplied data passed to the callback
+ *
+ * @return 0 if ok, <0 if passive capture could not be enabled
+ */
+#if defined(CONFIG_NET_CAPTURE_PASSIVE)
+int net_capture_passive_enable(struct net_if *iface,
+			       net_capture_passive_cb_t cb, void *user_data);
+#else
+static inline int net_capture_passive_enable(struct net_if *iface,
+					     net_capture_passive_cb_t cb,
+					     void *user_data)
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(cb);
+	ARG_UNUSED(user_data);
+
+	return -ENOTSUP;
+}
+#endif
+
+/**
+ * @brief Disable passive network packet capturing.
+ *
+ * @details Any captured packets that are still queued but not yet
+ *          delivered to the callback are dropped.
+ *
+ * @return 0 if ok, <0 if passive capture was not enabled
+ */
+#if defined(CONFIG_NET_CAPTURE_PASSIVE)
+int net_capture_passive_disable(void);
+#else
+static inline int net_capture_passive_disable(void)
+{
+	return -ENOTSUP;
+}
+#endif
+
 struct net_capture_info {
 	const struct device *capture_dev;
 	struct net_if *capture_iface;
@@ -89,6 +89,20 @@ struct coap_client_option {
 };
 
 /** @cond INTERNAL_HIDDEN */
+#if (CONFIG_COAP_CLIENT_BLOCK_PIPELINE > 1)
+/* Tracking and reordering buffer for one pipelined block request. */
+struct coap_client_block_slot {
+	bool used;
+	bool received;
+	bool more;
+	uint16_t mid;
+	uint16_t len;
+	uint32_t block_num;
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	uint8_t payload[CONFIG_COAP_CLIENT_BLOCK_SIZE];
+};
+#endif
+
 struct coap_client_internal_request {
 	uint8_t request_token[COAP_TOKEN_MAX_LEN];
 	uint32_t offset;
@@ -106,6 +120,10 @@ struct coap_client_internal_request {
 	/* For GETs with observe option set */
 	bool is_observe;
 	int last_response_id;
+
+#if (CONFIG_COAP_CLIENT_BLOCK_PIPELINE > 1)
+	struct coap_client_block_slot block_slots[CONFIG_COAP_CLIENT_BLOCK_PIPELINE - 1];
+#endif
 };
 
 struct coap_client {
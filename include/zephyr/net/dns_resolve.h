@@ -589,6 +589,32 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 		     void *user_data,
 		     int32_t timeout);
 
+/**
+ * @brief Prefetch or refresh the DNS cache entry for a name.
+ *
+ * @details This function sends the query to the server even if the name is
+ * already cached, and the response replaces any existing cache entry. It can
+ * be used to warm up the cache before the name is actually needed, or to
+ * refresh an entry that is about to expire, so that a later
+ * dns_resolve_name() call is served from the cache without a network round
+ * trip. The call is asynchronous and the result is not delivered to the
+ * caller. Only useful when CONFIG_DNS_RESOLVER_CACHE is enabled.
+ *
+ * @param ctx DNS context
+ * @param query Name to resolve.
+ * @param type What kind of data the caller wants to get.
+ * @param timeout The timeout value for the query. Possible values:
+ * SYS_FOREVER_MS: the query is tried forever, user needs to cancel it
+ *            manually if it takes too long time to finish
+ * >0: start the query and let the system timeout it after specified ms
+ *
+ * @return 0 if the query was started ok, < 0 otherwise
+ */
+int dns_resolve_prefetch(struct dns_resolve_context *ctx,
+			 const char *query,
+			 enum dns_query_type type,
+			 int32_t timeout);
+
 /**
  * @brief Get default DNS context.
  *
@@ -285,6 +285,41 @@ void gptp_call_phase_dis_cb(void);
  */
 int gptp_event_capture(struct net_ptp_time *slave_time, bool *gm_present);
 
+/**
+ * @brief Convert a hardware cycle counter value to gPTP time.
+ *
+ * @details Interpolates from a correlation anchor that is refreshed on
+ * every received sync, using a lock-free sequence counter so the
+ * conversion is safe from any context, including ISRs, and costs only
+ * a few multiplications. Needs CONFIG_NET_GPTP_TIMEBASE.
+ *
+ * @param cycles Cycle counter value (as returned by k_cycle_get_32() or
+ *        k_cycle_get_64()) to convert.
+ * @param ptp_ns A pointer where the gPTP time in nanoseconds is saved.
+ *
+ * @retval 0 on success.
+ * @retval -EAGAIN if no sync has been received yet.
+ * @retval -ERANGE if the value is too far from the correlation anchor
+ *         for bounded-drift interpolation.
+ */
+int gptp_timebase_cycles_to_ns(uint64_t cycles, uint64_t *ptp_ns);
+
+/**
+ * @brief Convert gPTP time to a hardware cycle counter value.
+ *
+ * @details Counterpart of gptp_timebase_cycles_to_ns(), with the same
+ * locking and accuracy properties.
+ *
+ * @param ptp_ns gPTP time in nanoseconds to convert.
+ * @param cycles A pointer where the cycle counter value is saved.
+ *
+ * @retval 0 on success.
+ * @retval -EAGAIN if no sync has been received yet.
+ * @retval -ERANGE if the value is too far from the correlation anchor
+ *         for bounded-drift interpolation.
+ */
+int gptp_timebase_ns_to_cycles(uint64_t ptp_ns, uint64_t *cycles);
+
 /**
  * @brief Utility function to print clock id to a user supplied buffer.
  *
@@ -129,6 +129,52 @@ struct http_hpack_header_buf {
 
 /** @cond INTERNAL_HIDDEN */
 
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+
+/* Number of entries in the HPACK static table, RFC 7541, Appendix A. */
+#define HTTP_HPACK_STATIC_TABLE_SIZE 61
+
+/* Per-entry overhead in the dynamic table size accounting, RFC 7541,
+ * ch 4.1. As every entry consumes at least the overhead, this also
+ * bounds the number of entries the table can hold.
+ */
+#define HTTP_HPACK_DYNAMIC_ENTRY_OVERHEAD 32
+#define HTTP_HPACK_MAX_DYNAMIC_ENTRIES                 \
+	(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE / \
+	 HTTP_HPACK_DYNAMIC_ENTRY_OVERHEAD)
+
+/** HPACK encoder dynamic table (RFC 7541, ch 2.3.2). */
+struct http_hpack_enc_table {
+	/** Entry name/value strings, oldest entry first. */
+	uint8_t buf[CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE];
+
+	/** Entry string lengths, in the same order as the strings. */
+	struct {
+		uint16_t name_len;
+		uint16_t value_len;
+	} entries[HTTP_HPACK_MAX_DYNAMIC_ENTRIES];
+
+	/** Number of entries in the table. */
+	uint16_t count;
+
+	/** Current table size (RFC 7541 size accounting). */
+	uint16_t size;
+
+	/** Maximum table size currently in use. */
+	uint16_t max_size;
+
+	/** A table size update needs to be emitted in the next header block. */
+	bool size_update;
+};
+
+void http_hpack_enc_table_init(struct http_hpack_enc_table *table);
+void http_hpack_enc_table_resize(struct http_hpack_enc_table *table,
+				 uint16_t max_size);
+int http_hpack_encode_header_dyn(uint8_t *buf, size_t buflen,
+				 struct http_hpack_header_buf *header,
+				 struct http_hpack_enc_table *table);
+#endif /* CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE */
+
 int http_hpack_huffman_decode(const uint8_t *encoded_buf, size_t encoded_len,
 			      uint8_t *buf, size_t buflen);
 int http_hpack_huffman_encode(const uint8_t *str, size_t str_len,
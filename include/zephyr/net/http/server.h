@@ -108,6 +108,8 @@ BUILD_ASSERT(NUM_BITS(
 	     >= (HTTP_METHOD_END_VALUE - 1));
 /** @endcond */
 
+struct http_resource_precompressed;
+
 /**
  * @brief Representation of a static server resource.
  */
@@ -120,6 +122,17 @@ struct http_resource_detail_static {
 
 	/** Size of the static resource. */
 	size_t static_data_len;
+
+#if defined(CONFIG_HTTP_SERVER_COMPRESSION) || defined(__DOXYGEN__)
+	/** Optional precompressed representations of the resource. The best
+	 *  one accepted by the request's Accept-Encoding header is served,
+	 *  falling back to @ref static_data.
+	 */
+	const struct http_resource_precompressed *precompressed;
+
+	/** Number of precompressed representations. */
+	size_t num_precompressed;
+#endif
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -148,6 +161,20 @@ enum http_compression {
 	HTTP_ZSTD = 5      /**< ZSTD */
 };
 
+/**
+ * @brief Precompressed representation of a static server resource.
+ */
+struct http_resource_precompressed {
+	/** Compression used for the data. */
+	enum http_compression compression;
+
+	/** Compressed content of the static resource. */
+	const void *static_data;
+
+	/** Size of the compressed content. */
+	size_t static_data_len;
+};
+
 /** @cond INTERNAL_HIDDEN */
 /* Make sure that the common is the first in the struct. */
 BUILD_ASSERT(offsetof(struct http_resource_detail_static_fs, common) == 0);
@@ -440,6 +467,19 @@ struct http_client_ctx {
 	/** HTTP/2 header parser context. */
 	struct http_hpack_header_buf header_field;
 
+/** @cond INTERNAL_HIDDEN */
+	/** HPACK dynamic table for response header encoding. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE,
+		   (struct http_hpack_enc_table hpack_enc_table));
+
+	/** Buffer for coalescing outgoing data into fewer send calls. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_TX_COALESCING,
+		   (uint8_t tx_buffer[CONFIG_HTTP_SERVER_TX_BUFFER_SIZE]));
+
+	/** Amount of data pending in the TX buffer. */
+	IF_ENABLED(CONFIG_HTTP_SERVER_TX_COALESCING, (size_t tx_buffer_len));
+/** @endcond */
+
 	/** HTTP/2 streams context. */
 	struct http2_stream_ctx streams[HTTP_SERVER_MAX_STREAMS];
 
@@ -877,6 +877,13 @@ struct mqtt_internal {
 	/** Internal. Remaining payload length to read. */
 	uint32_t remaining_payload;
 
+#if defined(CONFIG_MQTT_QOS0_TX_COALESCE) || defined(__DOXYGEN__)
+	/** Internal. Number of bytes of coalesced QoS 0 publishes queued
+	 *  at the beginning of the tx_buf, awaiting transmission.
+	 */
+	uint32_t tx_pending;
+#endif /* CONFIG_MQTT_QOS0_TX_COALESCE */
+
 #if defined(CONFIG_MQTT_VERSION_5_0) || defined(__DOXYGEN__)
 	/** Internal. MQTT 5.0 topic alias mapping. */
 	struct mqtt_topic_alias topic_aliases[CONFIG_MQTT_TOPIC_ALIAS_MAX];
@@ -300,6 +300,19 @@ __net_socket struct net_context {
 	int can_filter_id;
 #endif /* CONFIG_NET_SOCKETS_CAN */
 
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE)
+	/** Cached IP + UDP header bytes for a connected UDP context */
+	struct {
+		/** Header bytes of the previously sent packet */
+		uint8_t data[IS_ENABLED(CONFIG_NET_IPV6) ?
+			     NET_IPV6UDPH_LEN : NET_IPV4UDPH_LEN];
+		/** Number of cached bytes */
+		uint8_t len;
+		/** True when the cached bytes match the context state */
+		bool valid;
+	} udp_hdr_template;
+#endif /* CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE */
+
 	/** Option values */
 	struct {
 #if defined(CONFIG_NET_CONTEXT_PRIORITY)
@@ -401,6 +414,10 @@ __net_socket struct net_context {
 #if defined(CONFIG_NET_CONTEXT_TIMESTAMPING)
 		/** Enable RX, TX or both timestamps of packets send through sockets. */
 		uint8_t timestamping;
+#endif
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+		/** Send datagrams directly from the user buffers (SO_ZEROCOPY). */
+		bool zerocopy;
 #endif
 	} options;
 
@@ -1399,6 +1416,7 @@ enum net_context_option {
 	NET_OPT_LOCAL_PORT_RANGE  = 21, /**< Clamp local port range */
 	NET_OPT_IPV6_MCAST_LOOP	  = 22, /**< IPV6 multicast loop */
 	NET_OPT_IPV4_MCAST_LOOP	  = 23, /**< IPV4 multicast loop */
+	NET_OPT_ZEROCOPY          = 24, /**< Zero-copy datagram send */
 };
 
 /**
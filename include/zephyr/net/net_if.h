@@ -544,6 +544,11 @@ struct net_if_dhcpv4 {
 	/** NTP server address */
 	struct in_addr ntp_addr;
 #endif
+
+#ifdef CONFIG_NET_DHCPV4_LEASE_CACHE
+	/** Reclaiming a cached lease with INIT-REBOOT */
+	bool init_reboot;
+#endif
 };
 #endif /* CONFIG_NET_DHCPV4 */
 
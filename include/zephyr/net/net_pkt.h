@@ -231,6 +231,12 @@ struct net_pkt {
 				   * preserved. Useful only if
 				   * defined(CONFIG_NET_ETHERNET_BRIDGE).
 				   */
+	uint8_t eth_fast_resp : 1; /* Set to 1 if this packet is a reply
+				    * generated by the Ethernet fast
+				    * responder and already contains its L2
+				    * header. Useful only if
+				    * defined(CONFIG_NET_ETHERNET_FAST_RESPONDER).
+				    */
 	uint8_t l2_processed : 1; /* Set to 1 if this packet has already been
 				   * processed by the L2
 				   */
@@ -553,6 +559,20 @@ static inline void net_pkt_set_l2_bridged(struct net_pkt *pkt, bool is_l2_bridge
 	}
 }
 
+static inline bool net_pkt_is_eth_fast_resp(struct net_pkt *pkt)
+{
+	return IS_ENABLED(CONFIG_NET_ETHERNET_FAST_RESPONDER) ?
+		!!(pkt->eth_fast_resp) : 0;
+}
+
+static inline void net_pkt_set_eth_fast_resp(struct net_pkt *pkt,
+					     bool is_fast_resp)
+{
+	if (IS_ENABLED(CONFIG_NET_ETHERNET_FAST_RESPONDER)) {
+		pkt->eth_fast_resp = is_fast_resp;
+	}
+}
+
 static inline bool net_pkt_is_l2_processed(struct net_pkt *pkt)
 {
 	return !!(pkt->l2_processed);
@@ -1539,6 +1559,21 @@ static inline bool net_pkt_filter_local_in_recv_ok(struct net_pkt *pkt)
 
 #endif /* CONFIG_NET_PKT_FILTER && CONFIG_NET_PKT_FILTER_LOCAL_IN_HOOK */
 
+#if defined(CONFIG_NET_PKT_FILTER) && defined(CONFIG_NET_PKT_FILTER_CAPTURE_HOOK)
+
+bool net_pkt_filter_capture_ok(struct net_pkt *pkt);
+
+#else
+
+static inline bool net_pkt_filter_capture_ok(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return true;
+}
+
+#endif /* CONFIG_NET_PKT_FILTER && CONFIG_NET_PKT_FILTER_CAPTURE_HOOK */
+
 #if defined(CONFIG_NET_OFFLOAD) || defined(CONFIG_NET_L2_IPIP)
 static inline struct sockaddr *net_pkt_remote_address(struct net_pkt *pkt)
 {
@@ -2147,6 +2182,34 @@ struct net_pkt *net_pkt_rx_alloc_with_buffer(struct net_if *iface,
 
 #endif
 
+/**
+ * @brief Allocate an RX packet over driver-loaned buffer memory
+ *
+ * Wraps an externally owned data buffer (typically a driver's DMA
+ * receive buffer) into a freshly allocated RX net_pkt without copying
+ * the payload, so the packet can be passed to net_recv_data() and
+ * travel through the stack zero-copy.
+ *
+ * The loaned memory is tracked through @p pool, which the driver
+ * defines with a destroy callback (see NET_BUF_POOL_FIXED_DEFINE()):
+ * when the stack drops the last reference to the packet, the callback
+ * runs and the driver can hand the buffer back to its RX descriptor
+ * ring.  The data must remain valid and cache-coherent until then.
+ *
+ * @param iface   The network interface the packet was received on.
+ * @param pool    Driver-owned buffer pool used to track the loan.
+ *                Must be usable with net_buf_alloc_with_data().
+ * @param data    Pointer to the received frame.
+ * @param size    Length of the received frame.
+ * @param timeout Maximum time to wait for an allocation.
+ *
+ * @return a pointer to a newly allocated net_pkt on success, NULL otherwise.
+ */
+struct net_pkt *net_pkt_rx_alloc_with_ext_data(struct net_if *iface,
+					       struct net_buf_pool *pool,
+					       void *data, size_t size,
+					       k_timeout_t timeout);
+
 /**
  * @brief Append a buffer in packet
  *
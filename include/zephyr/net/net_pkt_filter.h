@@ -108,6 +108,8 @@ extern struct npf_rule_list npf_send_rules;
 extern struct npf_rule_list npf_recv_rules;
 /** @brief rule list applied for local incoming packets */
 extern struct npf_rule_list npf_local_in_recv_rules;
+/** @brief rule list applied to packets considered for capture */
+extern struct npf_rule_list npf_capture_rules;
 /** @brief rule list applied for IPv4 incoming packets */
 extern struct npf_rule_list npf_ipv4_recv_rules;
 /** @brief rule list applied for IPv6 incoming packets */
@@ -896,6 +896,9 @@ struct ifreq {
 /** Socket TX time (same as SO_TXTIME) */
 #define SCM_TXTIME SO_TXTIME
 
+/** Send datagrams directly from the user buffers without copying */
+#define SO_ZEROCOPY 62
+
 /** Timestamp generation flags */
 
 /** Request RX timestamps generated by network adapter. */
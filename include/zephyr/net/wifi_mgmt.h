@@ -133,6 +133,8 @@ enum net_request_wifi_cmd {
 	NET_REQUEST_WIFI_CMD_CANDIDATE_SCAN,
 	/** AP WPS config */
 	NET_REQUEST_WIFI_CMD_AP_WPS_CONFIG,
+	/** Set or get data path configuration */
+	NET_REQUEST_WIFI_CMD_DATA_PATH,
 	/** @cond INTERNAL_HIDDEN */
 	NET_REQUEST_WIFI_CMD_MAX
 	/** @endcond */
@@ -317,6 +319,12 @@ NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_WIFI_START_ROAMING);
 
 NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_WIFI_NEIGHBOR_REP_COMPLETE);
 
+/** Request a Wi-Fi data path configuration */
+#define NET_REQUEST_WIFI_DATA_PATH				\
+	(NET_WIFI_BASE | NET_REQUEST_WIFI_CMD_DATA_PATH)
+
+NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_WIFI_DATA_PATH);
+
 /** @brief Wi-Fi management events */
 enum net_event_wifi_cmd {
 	/** Scan results available */
@@ -355,6 +363,11 @@ enum net_event_wifi_cmd {
 	NET_EVENT_WIFI_CMD_AP_STA_DISCONNECTED,
 	/** Supplicant specific event */
 	NET_EVENT_WIFI_CMD_SUPPLICANT,
+	/** Power save sleep state: awake or sleeping, can be used by the
+	 * stack or application to pause TX pacing instead of timing out
+	 * while the radio sleeps.
+	 */
+	NET_EVENT_WIFI_CMD_PS_SLEEP_STATE,
 };
 
 /** Event emitted for Wi-Fi scan result */
@@ -417,6 +430,10 @@ enum net_event_wifi_cmd {
 #define NET_EVENT_WIFI_AP_STA_DISCONNECTED			\
 	(NET_WIFI_EVENT | NET_EVENT_WIFI_CMD_AP_STA_DISCONNECTED)
 
+/** Event emitted for Wi-Fi power save sleep state */
+#define NET_EVENT_WIFI_PS_SLEEP_STATE				\
+	(NET_WIFI_EVENT | NET_EVENT_WIFI_CMD_PS_SLEEP_STATE)
+
 /** @brief Wi-Fi version */
 struct wifi_version {
 	/** Driver version */
@@ -918,6 +935,32 @@ enum wifi_twt_sleep_state {
 	WIFI_TWT_STATE_AWAKE = 1,
 };
 
+/** @brief Wi-Fi power save sleep states */
+enum wifi_ps_sleep_state {
+	/** Power save sleep state: sleeping */
+	WIFI_PS_STATE_SLEEP = 0,
+	/** Power save sleep state: awake */
+	WIFI_PS_STATE_AWAKE = 1,
+};
+
+/** @brief Wi-Fi data path parameters */
+struct wifi_data_path_params {
+	/** Get or set operation, see enum wifi_mgmt_op */
+	enum wifi_mgmt_op oper;
+	/** Enable TX A-MPDU aggregation */
+	bool ampdu_tx_enabled;
+	/** Enable TX A-MSDU aggregation */
+	bool amsdu_tx_enabled;
+	/** Aggregation hint: number of frames the stack hands over
+	 * back-to-back per traffic class, 0 if unknown
+	 */
+	uint8_t tx_batch_hint;
+	/** Frames currently queued in the driver for TX, filled on get */
+	uint16_t tx_queue_depth;
+	/** Driver TX queue capacity in frames, filled on get */
+	uint16_t tx_queue_limit;
+};
+
 #if defined(CONFIG_WIFI_MGMT_RAW_SCAN_RESULTS) || defined(__DOXYGEN__)
 /** @brief Wi-Fi raw scan result */
 struct wifi_raw_scan_result {
@@ -1404,6 +1447,14 @@ struct wifi_mgmt_ops {
 	 * @return 0 if ok, < 0 if error
 	 */
 	int (*get_power_save_config)(const struct device *dev, struct wifi_ps_config *config);
+	/** Set or get the data path configuration
+	 *
+	 * @param dev Pointer to the device structure for the driver instance.
+	 * @param params Data path parameters
+	 *
+	 * @return 0 if ok, < 0 if error
+	 */
+	int (*data_path)(const struct device *dev, struct wifi_data_path_params *params);
 	/** Set or get regulatory domain
 	 *
 	 * @param dev Pointer to the device structure for the driver instance.
@@ -1633,6 +1684,13 @@ void wifi_mgmt_raise_twt_event(struct net_if *iface,
  */
 void wifi_mgmt_raise_twt_sleep_state(struct net_if *iface, int twt_sleep_state);
 
+/** Wi-Fi management power save sleep state event
+ *
+ * @param iface Network interface
+ * @param ps_sleep_state Power save sleep state
+ */
+void wifi_mgmt_raise_ps_sleep_state(struct net_if *iface, int ps_sleep_state);
+
 #if defined(CONFIG_WIFI_MGMT_RAW_SCAN_RESULTS) || defined(__DOXYGEN__)
 /** Wi-Fi management raw scan result event
  *
@@ -65,6 +65,10 @@ struct zperf_upload_params {
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		int thread_priority;
 		bool wait_for_start;
+		/* CPU to pin the session thread to, or -1 for no pinning.
+		 * Needs CONFIG_SCHED_CPU_MASK.
+		 */
+		int thread_cpu;
 #endif
 		uint32_t report_interval_ms;
 	} options;
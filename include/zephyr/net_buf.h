@@ -1091,6 +1091,19 @@ struct net_buf_pool {
 	/** Size of user data allocated to this pool */
 	uint8_t user_data_size;
 
+	/** Alignment of each buffer in the storage array; zero for the
+	 *  natural alignment of struct net_buf.
+	 */
+	const uint16_t buf_align;
+
+#if defined(CONFIG_NET_BUF_POOL_PERCPU_CACHE)
+	/** Per-CPU cache holding the most recently freed buffer */
+	atomic_ptr_t free_cache[CONFIG_MP_MAX_NUM_CPUS];
+
+	/** Number of allocators about to block on the free LIFO */
+	atomic_t free_waiters;
+#endif /* CONFIG_NET_BUF_POOL_PERCPU_CACHE */
+
 #if defined(CONFIG_NET_BUF_POOL_USAGE)
 	/** Amount of available buffers in the pool. */
 	atomic_t avail_count;
@@ -1121,19 +1134,24 @@ struct net_buf_pool {
 	IF_ENABLED(CONFIG_NET_BUF_POOL_USAGE, (.max_used = 0,)) \
 	IF_ENABLED(CONFIG_NET_BUF_POOL_USAGE, (.name = STRINGIFY(_pool),))
 
-#define NET_BUF_POOL_INITIALIZER(_pool, _alloc, _bufs, _count, _ud_size, _destroy) \
+#define Z_NET_BUF_POOL_INITIALIZER(_pool, _alloc, _bufs, _count, _ud_size, _align, _destroy) \
 	{                                                                          \
 		.free = Z_LIFO_INITIALIZER(_pool.free),                            \
 		.lock = { },                                                       \
 		.buf_count = _count,                                               \
 		.uninit_count = _count,                                            \
 		.user_data_size = _ud_size,                                        \
+		.buf_align = _align,                                               \
 		NET_BUF_POOL_USAGE_INIT(_pool, _count)                             \
 		.destroy = _destroy,                                               \
 		.alloc = _alloc,                                                   \
 		.__bufs = (struct net_buf *)_bufs,                                 \
 	}
 
+#define NET_BUF_POOL_INITIALIZER(_pool, _alloc, _bufs, _count, _ud_size, _destroy) \
+	Z_NET_BUF_POOL_INITIALIZER(_pool, _alloc, _bufs, _count, _ud_size, 0,      \
+				   _destroy)
+
 #define _NET_BUF_ARRAY_DEFINE(_name, _count, _ud_size)					       \
 	struct _net_buf_##_name { uint8_t b[sizeof(struct net_buf)];			       \
 				  uint8_t ud[_ud_size]; } __net_buf_align;		       \
@@ -1147,6 +1165,18 @@ struct net_buf_pool {
 		     "Size cannot be determined");					       \
 	static struct _net_buf_##_name _net_buf_##_name[_count] __noinit
 
+#define _NET_BUF_ARRAY_ALIGNED_DEFINE(_name, _count, _ud_size, _align)			       \
+	struct _net_buf_##_name { uint8_t b[sizeof(struct net_buf)];			       \
+				  uint8_t ud[_ud_size]; } __aligned(_align);		       \
+	BUILD_ASSERT(_ud_size <= UINT8_MAX);						       \
+	BUILD_ASSERT((_align) >= __alignof__(struct net_buf), "Invalid alignment");	       \
+	BUILD_ASSERT(offsetof(struct net_buf, user_data) ==				       \
+		     offsetof(struct _net_buf_##_name, ud), "Invalid offset");		       \
+	BUILD_ASSERT(sizeof(struct _net_buf_##_name) ==					       \
+		     ROUND_UP(sizeof(struct net_buf) + _ud_size, _align),		       \
+		     "Size cannot be determined");					       \
+	static struct _net_buf_##_name _net_buf_##_name[_count] __noinit
+
 extern const struct net_buf_data_alloc net_buf_heap_alloc;
 /** @endcond */
 
@@ -1238,6 +1268,47 @@ extern const struct net_buf_data_cb net_buf_fixed_cb;
 					 _net_buf_##_name, _count, _ud_size,   \
 					 _destroy)
 
+/**
+ *
+ * @brief Define a new pool for buffers based on aligned fixed-size data
+ *
+ * Behaves like NET_BUF_POOL_FIXED_DEFINE(), but pads each struct net_buf
+ * in the buffer storage array, as well as each fixed-size data chunk, to
+ * a multiple of the given alignment. Aligning to the data cache line size
+ * prevents the buffer metadata, e.g. the reference count and the length,
+ * of neighboring buffers from sharing a cache line, which would otherwise
+ * cause false sharing when the buffers are manipulated concurrently from
+ * several CPUs.
+ *
+ * If provided with a custom destroy callback, this callback is
+ * responsible for eventually calling net_buf_destroy() to complete the
+ * process of returning the buffer to the pool.
+ *
+ * @param _name      Name of the pool variable.
+ * @param _count     Number of buffers in the pool.
+ * @param _data_size Maximum data payload per buffer.
+ * @param _ud_size   User data space to reserve per buffer.
+ * @param _align     Alignment, in bytes, of each buffer and data chunk.
+ * @param _destroy   Optional destroy callback when buffer is freed.
+ */
+#define NET_BUF_POOL_ALIGNED_DEFINE(_name, _count, _data_size, _ud_size, _align, _destroy) \
+	_NET_BUF_ARRAY_ALIGNED_DEFINE(_name, _count, _ud_size, _align);        \
+	static uint8_t __noinit                                                \
+		net_buf_data_##_name[_count][ROUND_UP(_data_size, _align)]     \
+		__aligned(_align);                                             \
+	static const struct net_buf_pool_fixed net_buf_fixed_##_name = {       \
+		.data_pool = (uint8_t *)net_buf_data_##_name,                  \
+	};                                                                     \
+	static const struct net_buf_data_alloc net_buf_fixed_alloc_##_name = { \
+		.cb = &net_buf_fixed_cb,                                       \
+		.alloc_data = (void *)&net_buf_fixed_##_name,                  \
+		.max_alloc_size = ROUND_UP(_data_size, _align),                \
+	};                                                                     \
+	static STRUCT_SECTION_ITERABLE(net_buf_pool, _name) =                  \
+		Z_NET_BUF_POOL_INITIALIZER(_name, &net_buf_fixed_alloc_##_name, \
+					   _net_buf_##_name, _count, _ud_size, \
+					   _align, _destroy)
+
 /** @cond INTERNAL_HIDDEN */
 extern const struct net_buf_data_cb net_buf_var_cb;
 /** @endcond */
@@ -1279,6 +1350,117 @@ extern const struct net_buf_data_cb net_buf_var_cb;
 					 _net_buf_##_name, _count, _ud_size,   \
 					 _destroy)
 
+/** @cond INTERNAL_HIDDEN */
+
+struct net_buf_pool_segmented_class {
+	/** Backing storage of this class: data_count chunks of data_size bytes */
+	uint8_t *data_pool;
+	/** One bit per chunk, set while the chunk is allocated */
+	atomic_t *in_use;
+	/** Data payload size of each chunk in this class */
+	uint16_t data_size;
+	/** Number of chunks in this class */
+	uint16_t data_count;
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	/** Number of chunks currently allocated from this class */
+	atomic_t used_count;
+	/** Maximum number of chunks ever allocated from this class */
+	uint16_t max_used;
+	/** Allocations that fit this class but were served by a larger
+	 *  class because this one was exhausted.
+	 */
+	atomic_t borrow_count;
+#endif /* CONFIG_NET_BUF_POOL_USAGE */
+};
+
+struct net_buf_pool_segmented {
+	struct net_buf_pool_segmented_class *classes;
+	uint8_t class_count;
+};
+
+extern const struct net_buf_data_cb net_buf_segmented_cb;
+
+#define _NET_BUF_SEG_SIZE(_class) GET_ARG_N(1, __DEBRACKET _class)
+#define _NET_BUF_SEG_COUNT(_class) GET_ARG_N(2, __DEBRACKET _class)
+
+#define _NET_BUF_SEG_STORAGE_DEFINE(_idx, _class, _name)                       \
+	static uint8_t __noinit UTIL_CAT(net_buf_seg_data_##_name##_, _idx)    \
+		[_NET_BUF_SEG_COUNT(_class) * _NET_BUF_SEG_SIZE(_class)]       \
+		__net_buf_align;                                               \
+	static ATOMIC_DEFINE(UTIL_CAT(net_buf_seg_bits_##_name##_, _idx),      \
+			     _NET_BUF_SEG_COUNT(_class));
+
+#define _NET_BUF_SEG_CLASS_INIT(_idx, _class, _name)                           \
+	{                                                                      \
+		.data_pool = UTIL_CAT(net_buf_seg_data_##_name##_, _idx),      \
+		.in_use = UTIL_CAT(net_buf_seg_bits_##_name##_, _idx),         \
+		.data_size = _NET_BUF_SEG_SIZE(_class),                        \
+		.data_count = _NET_BUF_SEG_COUNT(_class),                      \
+	},
+
+/** @endcond */
+
+/**
+ *
+ * @brief Define a new pool for buffers with size-class segmented data
+ *
+ * Defines a net_buf_pool struct and the necessary memory storage (array of
+ * structs) for the needed amount of buffers, where the data payloads are
+ * carved from a set of fixed-size chunk classes instead of a single chunk
+ * size. Each allocation is served from the smallest class its requested
+ * length fits in, so a pool mixing e.g. short acknowledgments and full-MTU
+ * data frames does not spend a large chunk on every small buffer. When the
+ * best-fitting class runs out, the allocation borrows a chunk from the next
+ * larger class.
+ *
+ * The classes are given as (data size, chunk count) pairs in ascending data
+ * size order, and the total number of buffers in the pool is the sum of the
+ * chunk counts. With @kconfig{CONFIG_NET_BUF_POOL_USAGE} enabled, per-class
+ * occupancy and borrow counters are maintained, which can be used to tune
+ * the class sizes and ratios to the actual traffic mix.
+ *
+ * This kind of pool does not support blocking on the data allocation, so
+ * the timeout passed to net_buf_alloc_len will be always treated as
+ * K_NO_WAIT when trying to allocate the data. This means that allocation
+ * failures, i.e. NULL returns, must always be handled cleanly.
+ *
+ * If provided with a custom destroy callback, this callback is
+ * responsible for eventually calling net_buf_destroy() to complete the
+ * process of returning the buffer to the pool.
+ *
+ * @param _name      Name of the pool variable.
+ * @param _ud_size   User data space to reserve per buffer.
+ * @param _destroy   Optional destroy callback when buffer is freed.
+ * @param ...        List of (data size, chunk count) pairs, in ascending
+ *                   data size order, e.g. (128, 8), (512, 4), (1536, 4).
+ */
+#define NET_BUF_POOL_SEGMENTED_DEFINE(_name, _ud_size, _destroy, ...)          \
+	_NET_BUF_ARRAY_DEFINE(_name,                                           \
+			      (FOR_EACH(_NET_BUF_SEG_COUNT, (+), __VA_ARGS__)), \
+			      _ud_size);                                       \
+	FOR_EACH_IDX_FIXED_ARG(_NET_BUF_SEG_STORAGE_DEFINE, (), _name,         \
+			       __VA_ARGS__)                                    \
+	static struct net_buf_pool_segmented_class                             \
+		net_buf_seg_classes_##_name[] = {                              \
+		FOR_EACH_IDX_FIXED_ARG(_NET_BUF_SEG_CLASS_INIT, (), _name,     \
+				       __VA_ARGS__)                            \
+	};                                                                     \
+	static const struct net_buf_pool_segmented net_buf_seg_##_name = {     \
+		.classes = net_buf_seg_classes_##_name,                        \
+		.class_count = ARRAY_SIZE(net_buf_seg_classes_##_name),        \
+	};                                                                     \
+	static const struct net_buf_data_alloc net_buf_seg_alloc_##_name = {   \
+		.cb = &net_buf_segmented_cb,                                   \
+		.alloc_data = (void *)&net_buf_seg_##_name,                    \
+		.max_alloc_size = 0,                                           \
+	};                                                                     \
+	static STRUCT_SECTION_ITERABLE(net_buf_pool, _name) =                  \
+		NET_BUF_POOL_INITIALIZER(_name, &net_buf_seg_alloc_##_name,    \
+					 _net_buf_##_name,                     \
+					 (FOR_EACH(_NET_BUF_SEG_COUNT, (+),    \
+						   __VA_ARGS__)),              \
+					 _ud_size, _destroy)
+
 /**
  *
  * @brief Define a new pool for buffers
@@ -1423,6 +1605,12 @@ struct net_buf * __must_check net_buf_alloc_with_data(struct net_buf_pool *pool,
 						      k_timeout_t timeout);
 #endif
 
+/** @cond INTERNAL_HIDDEN */
+#if defined(CONFIG_NET_BUF_POOL_PERCPU_CACHE)
+bool net_buf_pool_cache_put(struct net_buf_pool *pool, struct net_buf *buf);
+#endif
+/** @endcond */
+
 /**
  * @brief Destroy buffer from custom destroy callback
  *
@@ -1443,6 +1631,12 @@ static inline void net_buf_destroy(struct net_buf *buf)
 		buf->__buf = NULL;
 	}
 
+#if defined(CONFIG_NET_BUF_POOL_PERCPU_CACHE)
+	if (net_buf_pool_cache_put(pool, buf)) {
+		return;
+	}
+#endif
+
 	k_lifo_put(&pool->free, buf);
 }
 
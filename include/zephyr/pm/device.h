@@ -172,6 +172,16 @@ struct pm_device {
 	struct k_event event;
 	/** Work object for asynchronous calls */
 	struct k_work_delayable work;
+	/** Autosuspend delay applied by pm_device_runtime_put() */
+	k_timeout_t autosuspend_delay;
+#if defined(CONFIG_PM_DEVICE_RUNTIME_ASYNC_GET) || defined(__DOXYGEN__)
+	/** Work object for asynchronous resume requests */
+	struct k_work get_work;
+	/** Completion callback for asynchronous resume requests */
+	void (*get_cb)(const struct device *dev, int status, void *user_data);
+	/** User data passed to the completion callback */
+	void *get_cb_arg;
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC_GET */
 #endif /* CONFIG_PM_DEVICE_RUNTIME */
 };
 
@@ -96,6 +96,61 @@ int pm_device_runtime_disable(const struct device *dev);
  */
 int pm_device_runtime_get(const struct device *dev);
 
+#if defined(CONFIG_PM_DEVICE_RUNTIME_ASYNC_GET) || defined(__DOXYGEN__)
+/**
+ * @brief Resume a device based on usage count (asynchronously).
+ *
+ * This function queues the resume operation on the system work queue instead
+ * of blocking the caller while the device resumes. Once the device has been
+ * resumed (or resuming it failed), @p cb is invoked from the work queue with
+ * the result pm_device_runtime_get() would have returned. On success the
+ * caller owns one usage count and must balance it with a put call, just as
+ * with a successful pm_device_runtime_get().
+ *
+ * Only one asynchronous resume request can be in flight per device; requests
+ * issued from multiple contexts must be serialized by the caller.
+ *
+ * @param dev Device instance.
+ * @param cb Callback invoked with the resume result.
+ * @param user_data Opaque pointer passed to @p cb.
+ *
+ * @retval 0 If the request was queued (or, with device runtime PM not
+ * enabled, @p cb was invoked immediately).
+ * @retval -EINVAL If @p cb is NULL.
+ * @retval -EBUSY If an asynchronous resume request is already in flight.
+ *
+ * @see pm_device_runtime_get()
+ */
+int pm_device_runtime_get_async(const struct device *dev,
+				void (*cb)(const struct device *dev,
+					   int status, void *user_data),
+				void *user_data);
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC_GET */
+
+/**
+ * @brief Set the autosuspend delay applied by pm_device_runtime_put().
+ *
+ * When a non-zero delay is configured, pm_device_runtime_put() defers the
+ * suspend operation by that amount instead of suspending immediately, as if
+ * pm_device_runtime_put_async() had been called with the configured delay. A
+ * get call arriving within the delay window cancels the pending suspend, so
+ * devices used at a regular cadence (e.g. once per frame) avoid a full
+ * suspend/resume cycle between uses.
+ *
+ * The delay should be configured before the device is in active use; it is
+ * not synchronized against concurrent put calls.
+ *
+ * @param dev Device instance.
+ * @param delay Delay before suspending on the last put, or K_NO_WAIT to
+ * suspend immediately (the default).
+ *
+ * @retval 0 If the delay was set.
+ * @retval -ENOTSUP If the device does not support runtime PM or suspends
+ * synchronously from the put call (ISR safe devices).
+ */
+int pm_device_runtime_autosuspend_delay_set(const struct device *dev,
+					    k_timeout_t delay);
+
 /**
  * @brief Suspend a device based on usage count.
  *
@@ -195,6 +250,28 @@ static inline int pm_device_runtime_get(const struct device *dev)
 	return 0;
 }
 
+static inline int pm_device_runtime_get_async(const struct device *dev,
+					      void (*cb)(const struct device *dev,
+							 int status, void *user_data),
+					      void *user_data)
+{
+	if (cb == NULL) {
+		return -EINVAL;
+	}
+
+	/* no PM, the device is always active */
+	cb(dev, 0, user_data);
+	return 0;
+}
+
+static inline int pm_device_runtime_autosuspend_delay_set(const struct device *dev,
+							  k_timeout_t delay)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(delay);
+	return -ENOTSUP;
+}
+
 static inline int pm_device_runtime_put(const struct device *dev)
 {
 	ARG_UNUSED(dev);
@@ -59,6 +59,18 @@ struct pm_policy_latency_request {
 	/** @endcond */
 };
 
+struct pm_policy_event;
+
+/**
+ * @brief Callback to notify that an event wake-up deadline has been reached.
+ *
+ * Invoked from the system timer interrupt. The event has already been
+ * unregistered when the callback runs and may be re-registered from it.
+ *
+ * @param evt Event whose deadline has been reached.
+ */
+typedef void (*pm_policy_event_cb_t)(struct pm_policy_event *evt);
+
 /**
  * @brief Event.
  *
@@ -68,6 +80,9 @@ struct pm_policy_event {
 	/** @cond INTERNAL_HIDDEN */
 	sys_snode_t node;
 	int64_t uptime_ticks;
+#if defined(CONFIG_PM_POLICY_EVENT_WAKEUP) || defined(__DOXYGEN__)
+	pm_policy_event_cb_t cb;
+#endif
 	/** @endcond */
 };
 
@@ -182,6 +197,30 @@ bool pm_policy_state_any_active(void);
  */
 void pm_policy_event_register(struct pm_policy_event *evt, int64_t uptime_ticks);
 
+/**
+ * @brief Register an event woken up by the system timer.
+ *
+ * Like pm_policy_event_register(), but additionally the system timer
+ * comparator is programmed to cover the event deadline and @p cb is invoked
+ * when it is reached, so the registering subsystem does not need to arm a
+ * hardware timer of its own. Deadlines of multiple such events are served by
+ * a single comparator programming: events falling within
+ * CONFIG_PM_POLICY_EVENT_WAKEUP_COALESCE_US of a wake-up share it, which
+ * means a callback can run up to that window ahead of its deadline.
+ *
+ * The event is unregistered before the callback is invoked.
+ *
+ * @note Requires CONFIG_PM_POLICY_EVENT_WAKEUP.
+ *
+ * @param evt Event.
+ * @param uptime_ticks When the event will occur, in uptime ticks.
+ * @param cb Callback invoked when the deadline is reached.
+ *
+ * @see pm_policy_event_register()
+ */
+void pm_policy_event_register_wakeup(struct pm_policy_event *evt, int64_t uptime_ticks,
+				     pm_policy_event_cb_t cb);
+
 /**
  * @brief Update an event.
  *
@@ -269,6 +308,14 @@ static inline void pm_policy_event_register(struct pm_policy_event *evt, uint32_
 	ARG_UNUSED(cycle);
 }
 
+static inline void pm_policy_event_register_wakeup(struct pm_policy_event *evt,
+						   int64_t uptime_ticks, pm_policy_event_cb_t cb)
+{
+	ARG_UNUSED(evt);
+	ARG_UNUSED(uptime_ticks);
+	ARG_UNUSED(cb);
+}
+
 static inline void pm_policy_event_update(struct pm_policy_event *evt, uint32_t cycle)
 {
 	ARG_UNUSED(evt);
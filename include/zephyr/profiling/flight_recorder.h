@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_PROFILING_FLIGHT_RECORDER_H_
+#define ZEPHYR_INCLUDE_PROFILING_FLIGHT_RECORDER_H_
+
+#include <stdint.h>
+#include <zephyr/sys/util_macro.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup flight_recorder Flight recorder
+ *  @ingroup debug
+ *  @brief Always-on per-CPU event ring
+ *
+ *  The flight recorder keeps a small per-CPU ring of cycle-stamped events.
+ *  It is meant to stay enabled in production builds: recording an event is a
+ *  few loads and stores under a local interrupt lock and the rings live in
+ *  statically allocated memory that survives a crash. The rings are frozen
+ *  and appended to the core dump when a fatal error is reported, so the last
+ *  moments before a crash can be reconstructed offline.
+ *  @{
+ */
+
+/** Thread switched in, argument is the thread pointer. */
+#define SYS_FR_EVT_SWITCH_IN	1U
+/** Thread switched out, argument is the thread pointer. */
+#define SYS_FR_EVT_SWITCH_OUT	2U
+/** Interrupt entry. */
+#define SYS_FR_EVT_ISR_ENTER	3U
+/** Interrupt exit. */
+#define SYS_FR_EVT_ISR_EXIT	4U
+/** CPU entered idle. */
+#define SYS_FR_EVT_IDLE		5U
+
+/** First event id available for application use. */
+#define SYS_FR_EVT_USER_BASE	0x100U
+
+/** Flag marking the end of a span event. */
+#define SYS_FR_SPAN_END_FLAG	BIT(15)
+
+/** @brief Record the beginning of an application span.
+ *
+ * @param id	application span id, 0 based.
+ * @param arg	argument stored with the event.
+ */
+#define SYS_FR_SPAN_BEGIN(id, arg) \
+	sys_fr_record(SYS_FR_EVT_USER_BASE + (id), (arg))
+
+/** @brief Record the end of an application span.
+ *
+ * @param id	application span id, 0 based.
+ * @param arg	argument stored with the event.
+ */
+#define SYS_FR_SPAN_END(id, arg) \
+	sys_fr_record((SYS_FR_EVT_USER_BASE + (id)) | SYS_FR_SPAN_END_FLAG, (arg))
+
+/** @brief Record an event
+ *
+ * Store an event in the ring of the current CPU, stamped with
+ * k_cycle_get_32(). Safe to call from any context, including ISRs. The
+ * oldest event is overwritten when the ring is full. Does nothing once the
+ * recorder is frozen.
+ *
+ * @param id	event id.
+ * @param arg	argument stored with the event.
+ */
+void sys_fr_record(uint16_t id, uint32_t arg);
+
+/** @brief Freeze the recorder
+ *
+ * Stop recording on all CPUs so the rings keep the events leading up to the
+ * point of interest. Called automatically from the core dump path; may also
+ * be called by the application, e.g. when an anomaly is detected at runtime.
+ */
+void sys_fr_freeze(void);
+
+/** @brief Resume a frozen recorder */
+void sys_fr_resume(void);
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Dump the rings into the core dump being generated. */
+void sys_fr_coredump(void);
+
+/** @endcond */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_PROFILING_FLIGHT_RECORDER_H_ */
@@ -1136,6 +1136,43 @@ static inline struct rtio_cqe *rtio_cqe_consume(struct rtio *r)
 	return cqe;
 }
 
+/**
+ * @brief Consume a batch of completion queue events if available
+ *
+ * Consumes up to @p cqe_count completion queue events without waiting in a
+ * single call, amortizing the consume cost over the whole batch. Each consumed
+ * event must be released with rtio_cqe_release() at some point to release the
+ * cqe spot for the cqe producer.
+ *
+ * @param r RTIO context
+ * @param cqes Array where consumed completion queue event pointers are stored
+ * @param cqe_count Capacity of the @p cqes array
+ *
+ * @retval n Count of consumed completion queue events (0 to cqe_count)
+ */
+static inline int rtio_cqe_consume_n(struct rtio *r, struct rtio_cqe *cqes[], size_t cqe_count)
+{
+	struct mpsc_node *node;
+	size_t consumed = 0;
+
+	while (consumed < cqe_count) {
+#ifdef CONFIG_RTIO_CONSUME_SEM
+		if (k_sem_take(r->consume_sem, K_NO_WAIT) != 0) {
+			break;
+		}
+#endif
+
+		node = mpsc_pop(&r->cq);
+		if (node == NULL) {
+			break;
+		}
+
+		cqes[consumed++] = CONTAINER_OF(node, struct rtio_cqe, q);
+	}
+
+	return consumed;
+}
+
 /**
  * @brief Wait for and consume a single completion queue event
  *
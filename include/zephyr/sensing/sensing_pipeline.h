@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2025 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SENSING_PIPELINE_H_
+#define ZEPHYR_INCLUDE_SENSING_PIPELINE_H_
+
+#include <zephyr/device.h>
+#include <zephyr/sensing/sensing_datatypes.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef CONFIG_CMSIS_DSP_FILTERING
+#include <arm_math.h>
+#endif
+
+/**
+ * @brief Shared Sample Processing Pipeline
+ *
+ * Processing stages registered on a sensor run once per decoded sample
+ * batch in the dispatch thread, in registration order, before the batch
+ * is fanned out to the client connections. Filtering work shared by all
+ * consumers of a sensor (decimation, low-pass, axis alignment, ...) is
+ * then computed once per batch instead of once per consumer.
+ *
+ * @addtogroup sensing_pipeline
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @struct sensing_pipeline_stage
+ * @brief One processing stage of a sensor's sample pipeline.
+ *
+ * Stages transform the sample batch in place. The batch buffer is shared
+ * with all client connections, so a stage must keep the value data
+ * structure (header plus readings) consistent when it returns.
+ */
+struct sensing_pipeline_stage {
+	/** Name of the stage, for logging. */
+	const char *name;
+	/**
+	 * Process one sample batch in place.
+	 *
+	 * @param stage Pointer to this stage.
+	 * @param data Sample batch, a sensor value data structure.
+	 * @param len Size of the sample batch buffer in bytes.
+	 * @return 0 on success, negative errno to drop the batch.
+	 */
+	int (*process)(struct sensing_pipeline_stage *stage, void *data, uint32_t len);
+	/** Node in the sensor's stage list, internal use only. */
+	sys_snode_t node;
+};
+
+/**
+ * @brief Append a processing stage to a sensor's pipeline.
+ *
+ * Stages run in registration order. The stage object must remain valid
+ * until it is removed again.
+ *
+ * @param dev The sensor device to attach the stage to.
+ * @param stage The stage to append.
+ * @return 0 on success or a negative error value.
+ */
+int sensing_pipeline_stage_add(const struct device *dev,
+			       struct sensing_pipeline_stage *stage);
+
+/**
+ * @brief Remove a processing stage from a sensor's pipeline.
+ *
+ * @param dev The sensor device the stage was attached to.
+ * @param stage The stage to remove.
+ * @return 0 on success or a negative error value.
+ */
+int sensing_pipeline_stage_remove(const struct device *dev,
+				  struct sensing_pipeline_stage *stage);
+
+/**
+ * @struct sensing_pipeline_decimate_3d
+ * @brief Built-in decimation stage for 3-axis q31 sample batches.
+ *
+ * Keeps every 'factor'th reading of a batch and compacts the batch in
+ * place, accumulating the timestamp deltas of the dropped readings so
+ * the remaining readings keep their original timestamps.
+ */
+struct sensing_pipeline_decimate_3d {
+	struct sensing_pipeline_stage stage; /**< Base stage, internal use only. */
+	uint32_t factor;                     /**< Keep one reading in 'factor'. */
+	uint32_t phase;                      /**< Position within the current period. */
+	uint32_t dropped_delta;              /**< Timestamp delta carried over drops. */
+};
+
+/**
+ * @brief Initialize a 3-axis decimation stage.
+ *
+ * @param decimate The stage to initialize.
+ * @param factor Decimation factor, must be >= 1.
+ * @return 0 on success or a negative error value.
+ */
+int sensing_pipeline_decimate_3d_init(struct sensing_pipeline_decimate_3d *decimate,
+				      uint32_t factor);
+
+#ifdef CONFIG_SENSING_PIPELINE_LOWPASS
+
+/** Readings per block fed to the CMSIS-DSP filter kernel. */
+#define SENSING_PIPELINE_LOWPASS_BLOCK_SIZE 32
+
+/**
+ * @struct sensing_pipeline_lowpass_3d
+ * @brief Built-in low-pass filter stage for 3-axis q31 sample batches.
+ *
+ * Runs one biquad (second order IIR) section per axis with the
+ * CMSIS-DSP vectorized q31 kernel. Filter state persists across
+ * batches, so one instance must filter only one sensor's pipeline.
+ */
+struct sensing_pipeline_lowpass_3d {
+	struct sensing_pipeline_stage stage; /**< Base stage, internal use only. */
+	/** CMSIS-DSP biquad instance per axis. */
+	arm_biquad_casd_df1_inst_q31 inst[3];
+	/** Biquad state (x[n-1], x[n-2], y[n-1], y[n-2]) per axis. */
+	q31_t state[3][4];
+	/** Biquad coefficients (b0, b1, b2, a1, a2), shared by all axes. */
+	q31_t coeffs[5];
+};
+
+/**
+ * @brief Initialize a 3-axis low-pass filter stage.
+ *
+ * @param lowpass The stage to initialize.
+ * @param coeffs Biquad coefficients b0, b1, b2, a1, a2 in q31 format,
+ *               following the CMSIS-DSP df1 convention (a1, a2 negated).
+ * @param post_shift Output shift applied by the filter kernel.
+ * @return 0 on success or a negative error value.
+ */
+int sensing_pipeline_lowpass_3d_init(struct sensing_pipeline_lowpass_3d *lowpass,
+				     const q31_t coeffs[5], int8_t post_shift);
+
+#endif /* CONFIG_SENSING_PIPELINE_LOWPASS */
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_SENSING_PIPELINE_H_ */
@@ -109,6 +109,9 @@ struct sensing_sensor {
 	const struct sensing_sensor_register_info *register_info;
 	const uint16_t reporter_num; /**< Reporter number of the sensor instance. */
 	sys_slist_t client_list;     /**< List of the sensor clients. */
+#ifdef CONFIG_SENSING_PIPELINE
+	sys_slist_t stage_list;      /**< List of sample processing pipeline stages. */
+#endif
 	uint32_t interval;           /**< Report interval of the sensor sample in micro seconds. */
 	uint8_t sensitivity_count;   /**< Sensitivity count of the sensor instance. */
 	/** Sensitivity array of the sensor instance. */
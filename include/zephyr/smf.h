@@ -55,6 +55,10 @@ extern "C" {
 
 #include <zephyr/kernel.h>
 
+#ifdef CONFIG_SMF_EVENT_QUEUE
+#include <zephyr/sys/mpsc_lockfree.h>
+#endif /* CONFIG_SMF_EVENT_QUEUE */
+
 /**
  * @brief Function pointer that implements a portion of a state
  *
@@ -95,6 +99,48 @@ struct smf_state {
 #endif /* CONFIG_SMF_ANCESTOR_SUPPORT */
 };
 
+#if defined(CONFIG_SMF_EVENT_QUEUE) || defined(__DOXYGEN__)
+/**
+ * @brief Event that can be posted to a state machine.
+ *
+ * The event is queued by reference, so it shall remain valid until it
+ * has been processed. Embed it in a user defined structure to attach
+ * data to an event.
+ */
+struct smf_event {
+	/** @cond INTERNAL_HIDDEN */
+	struct mpsc_node node;
+	/** @endcond */
+	/** User defined event identifier */
+	uint32_t id;
+};
+#endif /* CONFIG_SMF_EVENT_QUEUE */
+
+#ifdef CONFIG_SMF_TRANSITION_CACHE
+/**
+ * @cond INTERNAL_HIDDEN
+ *
+ * Compiled transition. The ancestors that have to be entered and exited
+ * for a (source, destination) state pair are resolved once and reused
+ * whenever the same transition is taken again.
+ */
+struct smf_transition {
+	/** Transition source state, NULL if the slot is unused */
+	const struct smf_state *source;
+	/** Transition destination as passed to smf_set_state() */
+	const struct smf_state *dest;
+	/** Final target after resolving initial transitions */
+	const struct smf_state *target;
+	/** Topmost state whose entry/exit actions are not executed */
+	const struct smf_state *topmost;
+	/** Entry actions to execute, from the child of topmost to target */
+	const struct smf_state *entries[CONFIG_SMF_TRANSITION_CACHE_DEPTH];
+	/** Number of states in entries */
+	uint8_t num_entries;
+};
+/** @endcond */
+#endif /* CONFIG_SMF_TRANSITION_CACHE */
+
 /** Defines the current context of the state machine. */
 struct smf_ctx {
 	/** Current state the state machine is executing. */
@@ -118,6 +164,18 @@ struct smf_ctx {
 	 * used to track state machine context
 	 */
 	uint32_t internal;
+#ifdef CONFIG_SMF_TRANSITION_CACHE
+	/** Compiled transitions, filled in as transitions are first taken */
+	struct smf_transition transitions[CONFIG_SMF_TRANSITION_CACHE_SIZE];
+	/** Next transition slot to replace */
+	uint8_t transition_next;
+#endif /* CONFIG_SMF_TRANSITION_CACHE */
+#ifdef CONFIG_SMF_EVENT_QUEUE
+	/** Queue of posted but not yet processed events */
+	struct mpsc event_queue;
+	/** Event being processed by smf_run_events(), NULL otherwise */
+	const struct smf_event *event;
+#endif /* CONFIG_SMF_EVENT_QUEUE */
 };
 
 /**
@@ -167,6 +225,35 @@ void smf_set_handled(struct smf_ctx *ctx);
  */
 int32_t smf_run_state(struct smf_ctx *ctx);
 
+#if defined(CONFIG_SMF_EVENT_QUEUE) || defined(__DOXYGEN__)
+/**
+ * @brief Post an event to a state machine.
+ *
+ * Safe to call from any context, including ISRs; pushing the event is
+ * wait-free. The event is queued by reference and shall remain valid
+ * until it has been processed by smf_run_events().
+ *
+ * @param ctx   State machine context
+ * @param event Event to post
+ */
+void smf_event_post(struct smf_ctx *ctx, struct smf_event *event);
+
+/**
+ * @brief Process all queued events of a state machine.
+ *
+ * Drains the event queue, running one state machine iteration per event.
+ * The event being processed is available to the state functions through
+ * the event member of the state machine context.
+ *
+ * Events must be processed by a single thread per state machine.
+ *
+ * @param ctx  State machine context
+ * @return	   A non-zero value should terminate the state machine, see
+ *			   smf_run_state().
+ */
+int32_t smf_run_events(struct smf_ctx *ctx);
+#endif /* CONFIG_SMF_EVENT_QUEUE */
+
 #ifdef __cplusplus
 }
 #endif
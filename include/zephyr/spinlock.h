@@ -35,6 +35,8 @@ struct z_spinlock_key {
 	int key;
 };
 
+struct z_spin_lock_profile_entry;
+
 /**
  * @brief Kernel Spin Lock
  *
@@ -78,6 +80,14 @@ struct k_spinlock {
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_SPIN_LOCK_PROFILE
+	/* Profiling table slot assigned to this lock when it is first
+	 * acquired, and the time (in cycles) when the lock was last taken.
+	 */
+	struct z_spin_lock_profile_entry *profile;
+	uint32_t acquire_time;
+#endif /* CONFIG_SPIN_LOCK_PROFILE */
+
 #if defined(CONFIG_CPP) && !defined(CONFIG_SMP) && \
 	!defined(CONFIG_SPIN_VALIDATE)
 	/* If CONFIG_SMP and CONFIG_SPIN_VALIDATE are both not defined
@@ -116,6 +126,51 @@ bool z_spin_lock_mem_coherent(struct k_spinlock *l);
 
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_SPIN_LOCK_PROFILE
+void z_spin_lock_profile_acquire(struct k_spinlock *l, uint32_t spin_cycles);
+void z_spin_lock_profile_release(struct k_spinlock *l);
+
+/**
+ * @brief Spinlock profiling statistics, aggregated over all CPUs.
+ */
+struct k_spin_lock_profile_stats {
+	/** Number of times the lock has been acquired */
+	uint64_t count;
+	/** Total number of cycles spent spinning while waiting for the lock */
+	uint64_t spin_cycles;
+	/** Total number of cycles the lock has been held */
+	uint64_t hold_cycles;
+	/** Longest time (in cycles) the lock has been held in one go */
+	uint32_t max_hold_cycles;
+};
+
+/**
+ * @brief Retrieve profiling statistics for one profiled spinlock.
+ *
+ * Locks are assigned profiling table slots in the order they are first
+ * acquired, so iterating over indexes from 0 until this function returns
+ * -ENOENT visits every profiled lock.
+ *
+ * @param index Profiling table slot to query, in range
+ *              [0, CONFIG_SPIN_LOCK_PROFILE_MAX_LOCKS)
+ * @param lock Filled with the address of the profiled lock
+ * @param stats Filled with the statistics collected for the lock so far
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @p index is outside the profiling table
+ * @retval -ENOENT if the slot has not been assigned to any lock yet
+ */
+int k_spin_lock_profile_stats_get(size_t index, struct k_spinlock **lock,
+				  struct k_spin_lock_profile_stats *stats);
+
+/**
+ * @brief Reset statistics collected for all profiled spinlocks.
+ *
+ * Locks keep their profiling table slots, only the counters are zeroed.
+ */
+void k_spin_lock_profile_reset(void);
+#endif /* CONFIG_SPIN_LOCK_PROFILE */
+
 /**
  * @brief Spinlock key type
  *
@@ -151,6 +206,43 @@ static ALWAYS_INLINE void z_spinlock_validate_post(struct k_spinlock *l)
 #endif /* CONFIG_SPIN_VALIDATE */
 }
 
+/* Returns the cycle count at which the CPU started waiting for the lock.
+ * Only meaningful on SMP, where acquiring a contended lock actually spins;
+ * on uniprocessor systems no time is ever spent waiting.
+ */
+static ALWAYS_INLINE uint32_t z_spinlock_profile_pre(void)
+{
+	uint32_t spin_start = 0;
+
+#if defined(CONFIG_SPIN_LOCK_PROFILE) && defined(CONFIG_SMP)
+	spin_start = sys_clock_cycle_get_32();
+#endif
+	return spin_start;
+}
+
+static ALWAYS_INLINE void z_spinlock_profile_post(struct k_spinlock *l,
+						  uint32_t spin_start)
+{
+	ARG_UNUSED(l);
+	ARG_UNUSED(spin_start);
+#ifdef CONFIG_SPIN_LOCK_PROFILE
+	uint32_t spin_cycles = 0;
+
+#ifdef CONFIG_SMP
+	spin_cycles = sys_clock_cycle_get_32() - spin_start;
+#endif
+	z_spin_lock_profile_acquire(l, spin_cycles);
+#endif /* CONFIG_SPIN_LOCK_PROFILE */
+}
+
+static ALWAYS_INLINE void z_spinlock_profile_release(struct k_spinlock *l)
+{
+	ARG_UNUSED(l);
+#ifdef CONFIG_SPIN_LOCK_PROFILE
+	z_spin_lock_profile_release(l);
+#endif
+}
+
 /**
  * @brief Lock a spinlock
  *
@@ -191,6 +283,7 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	k.key = arch_irq_lock();
 
 	z_spinlock_validate_pre(l);
+	uint32_t spin_start = z_spinlock_profile_pre();
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	/*
@@ -209,6 +302,7 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 	z_spinlock_validate_post(l);
+	z_spinlock_profile_post(l, spin_start);
 
 	return k;
 }
@@ -232,6 +326,7 @@ static ALWAYS_INLINE int k_spin_trylock(struct k_spinlock *l, k_spinlock_key_t *
 	int key = arch_irq_lock();
 
 	z_spinlock_validate_pre(l);
+	uint32_t spin_start = z_spinlock_profile_pre();
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	/*
@@ -264,6 +359,7 @@ static ALWAYS_INLINE int k_spin_trylock(struct k_spinlock *l, k_spinlock_key_t *
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 	z_spinlock_validate_post(l);
+	z_spinlock_profile_post(l, spin_start);
 
 	k->key = key;
 
@@ -312,6 +408,7 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 		 l, delta, CONFIG_SPIN_LOCK_TIME_LIMIT);
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
+	z_spinlock_profile_release(l);
 
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
@@ -362,6 +459,7 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 #ifdef CONFIG_SPIN_VALIDATE
 	__ASSERT(z_spin_unlock_valid(l), "Not my spinlock %p", l);
 #endif
+	z_spinlock_profile_release(l);
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	(void)atomic_inc(&l->owner);
@@ -113,6 +113,71 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
  */
 int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buff);
 
+#if defined(CONFIG_DISK_ACCESS_ASYNC) || defined(__DOXYGEN__)
+
+struct disk_access_op;
+
+/**
+ * @brief Asynchronous disk operation completion callback
+ *
+ * Invoked from the disk access thread when a submitted operation has
+ * completed.
+ *
+ * @param[in] op            Completed operation
+ * @param[in] result        0 on success, negative errno code on fail
+ */
+typedef void (*disk_access_cb_t)(struct disk_access_op *op, int result);
+
+/**
+ * @brief Asynchronous disk operation
+ *
+ * Describes a single read or write request submitted with
+ * @ref disk_access_submit. The structure must remain valid until the
+ * completion callback has been invoked.
+ */
+struct disk_access_op {
+	/** @cond INTERNAL_HIDDEN */
+	/** Entry in the disk operation queue */
+	sys_snode_t node;
+	/** Disk the operation was submitted to */
+	struct disk_info *disk;
+	/** Times this operation was overtaken by later submissions */
+	uint16_t bypass;
+	/** @endcond */
+	/** True for a write operation, false for a read operation */
+	bool write;
+	/** Pointer to the memory buffer, not modified for write operations */
+	uint8_t *data_buf;
+	/** Start disk sector */
+	uint32_t start_sector;
+	/** Number of disk sectors */
+	uint32_t num_sector;
+	/** Completion callback */
+	disk_access_cb_t cb;
+	/** User data, not touched by the disk access layer */
+	void *user_data;
+};
+
+/**
+ * @brief submit an asynchronous disk operation
+ *
+ * Queues a read or write operation for execution by the disk access
+ * thread and returns without waiting for the transfer. Operations are
+ * executed in submission order; directly adjacent operations of the same
+ * direction targeting consecutive sectors with contiguous memory buffers
+ * are merged into a single multi-sector transfer before being handed to
+ * the disk driver. The completion callback of every merged operation is
+ * invoked with the result of the combined transfer.
+ *
+ * @param[in] pdrv          Disk name
+ * @param[in] op            Operation to submit
+ *
+ * @return 0 on success, negative errno code on fail
+ */
+int disk_access_submit(const char *pdrv, struct disk_access_op *op);
+
+#endif /* CONFIG_DISK_ACCESS_ASYNC */
+
 #ifdef __cplusplus
 }
 #endif
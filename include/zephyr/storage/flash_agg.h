@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Public API for aggregated writes to flash
+ */
+
+#ifndef ZEPHYR_INCLUDE_STORAGE_FLASH_AGG_H_
+#define ZEPHYR_INCLUDE_STORAGE_FLASH_AGG_H_
+
+/**
+ * @brief Aggregation of sub-page writes to flash
+ *
+ * Collects writes in a RAM page buffer and programs them with a single
+ * flash_write() once the caller moves on to another page, the whole page
+ * has been written, or the buffer is flushed explicitly. This reduces the
+ * number of program cycles on devices where every program operation costs
+ * a full page-program cycle, regardless of its size.
+ *
+ * Unlike the stream flash API, which handles sequential streams, this
+ * API accepts writes at arbitrary offsets and with arbitrary alignment;
+ * bytes needed to pad a programmed range to the device write-block-size
+ * are filled with the erase value. The caller remains responsible for
+ * erasing the target range beforehand, as with flash_write().
+ *
+ * @defgroup flash_agg Flash write aggregation interface
+ * @since 4.2
+ * @version 0.1.0
+ * @ingroup storage_apis
+ * @{
+ */
+
+#include <zephyr/drivers/flash.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Structure for flash write aggregation context
+ *
+ * Users should treat these structures as opaque values and only interact
+ * with them through the below API.
+ */
+struct flash_agg_ctx {
+	const struct device *fdev; /* Flash device */
+	uint8_t *buf; /* Page buffer */
+	size_t buf_len; /* Length of page buffer */
+	off_t page_start; /* Device offset of buffered page, negative if none */
+	size_t dirty_start; /* First modified byte within page buffer */
+	size_t dirty_end; /* One past last modified byte within page buffer */
+	size_t write_block_size; /* Offset/size device write alignment */
+	uint8_t erase_value;
+};
+
+/**
+ * @brief Initialize context needed for aggregated writes to flash.
+ *
+ * @param ctx context to be initialized
+ * @param fdev Flash device to operate on
+ * @param buf Page buffer
+ * @param buf_len Length of page buffer. Writes are aggregated per buf_len
+ *                sized region, so this should match the device page size.
+ *                Must be a multiple of the flash device write-block-size.
+ *
+ * @return non-negative on success, negative errno code on fail
+ */
+int flash_agg_init(struct flash_agg_ctx *ctx, const struct device *fdev,
+		   uint8_t *buf, size_t buf_len);
+
+/**
+ * @brief Process data for aggregated write to flash
+ *
+ * The data is buffered until the write moves to another page, at which
+ * point the buffered page is programmed. Writes larger than a page are
+ * split and processed page by page. A page which becomes fully written
+ * is programmed immediately.
+ *
+ * @param ctx context
+ * @param offset Offset within flash device to write the data to
+ * @param data data to write
+ * @param len Number of bytes to write
+ *
+ * @return non-negative on success, negative errno code on fail
+ */
+int flash_agg_write(struct flash_agg_ctx *ctx, off_t offset,
+		    const void *data, size_t len);
+
+/**
+ * @brief Program any buffered data to flash
+ *
+ * The programmed range is the smallest write-block-size aligned range
+ * covering all buffered writes; padding bytes hold the erase value so
+ * that they leave erased flash untouched.
+ *
+ * @param ctx context
+ *
+ * @return non-negative on success, negative errno code on fail
+ */
+int flash_agg_flush(struct flash_agg_ctx *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_STORAGE_FLASH_AGG_H_ */
@@ -40,6 +40,7 @@
 #include <sys/types.h>
 #include <zephyr/device.h>
 #include <zephyr/devicetree.h>
+#include <zephyr/kernel.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -248,6 +249,83 @@ int flash_area_erase(const struct flash_area *fa, off_t off, size_t len);
  */
 int flash_area_flatten(const struct flash_area *fa, off_t off, size_t len);
 
+#if defined(CONFIG_FLASH_MAP_ASYNC) || defined(__DOXYGEN__)
+/**
+ * @brief Completion callback for asynchronous flash area operations
+ *
+ * Invoked from the flash map work queue thread once a queued operation
+ * has finished.
+ *
+ * @param[in] fa        Flash area the operation was performed on
+ * @param[in] result    0 on success, negative errno code on fail
+ * @param[in] user_data User supplied data
+ */
+typedef void (*flash_area_async_cb_t)(const struct flash_area *fa, int result,
+				      void *user_data);
+
+/**
+ * @brief Asynchronous flash area operation
+ *
+ * Tracks one queued write or erase operation. The object, as well as the
+ * source buffer of a write, must stay valid until the completion callback
+ * has been invoked.
+ */
+struct flash_area_async_op {
+	/** @cond INTERNAL_HIDDEN */
+	struct k_work work;
+	const struct flash_area *fa;
+	off_t off;
+	size_t len;
+	const void *src;
+	flash_area_async_cb_t cb;
+	void *user_data;
+	/** @endcond */
+};
+
+/**
+ * @brief Queue a write to a flash area
+ *
+ * Performs the same operation as flash_area_write(), but from a dedicated
+ * work queue thread, so the caller does not block on the flash device.
+ * Queued operations are executed in submission order, also across flash
+ * areas.
+ *
+ * @param[in] fa        Flash area
+ * @param[in] off       Offset relative from beginning of flash area to write
+ * @param[in] src       Buffer with data to be written
+ * @param[in] len       Number of bytes to write
+ * @param[in] op        Operation tracking object
+ * @param[in] cb        Completion callback
+ * @param[in] user_data User data passed to the completion callback
+ *
+ * @return  0 when the operation was queued, negative errno code on fail.
+ */
+int flash_area_write_async(const struct flash_area *fa, off_t off, const void *src,
+			   size_t len, struct flash_area_async_op *op,
+			   flash_area_async_cb_t cb, void *user_data);
+
+/**
+ * @brief Queue an erase of a flash area range
+ *
+ * Performs the same operation as flash_area_erase(), but from a dedicated
+ * work queue thread, so the caller does not block on the flash device.
+ * Queued operations are executed in submission order, also across flash
+ * areas.
+ *
+ * @param[in] fa        Flash area
+ * @param[in] off       Offset relative from beginning of flash area.
+ * @param[in] len       Number of bytes to be erase
+ * @param[in] op        Operation tracking object
+ * @param[in] cb        Completion callback
+ * @param[in] user_data User data passed to the completion callback
+ *
+ * @return  0 when the operation was queued, negative errno code on fail.
+ */
+int flash_area_erase_async(const struct flash_area *fa, off_t off, size_t len,
+			   struct flash_area_async_op *op,
+			   flash_area_async_cb_t cb, void *user_data);
+#endif /* CONFIG_FLASH_MAP_ASYNC */
+
 /**
  * @brief Get write block size of the flash area
  *
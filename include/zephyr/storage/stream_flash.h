@@ -24,6 +24,7 @@
  */
 
 #include <stdbool.h>
+#include <zephyr/kernel.h>
 #include <zephyr/drivers/flash.h>
 
 #ifdef __cplusplus
@@ -74,6 +75,19 @@ struct stream_flash_ctx {
 #endif
 	size_t write_block_size;	/* Offset/size device write alignment */
 	uint8_t erase_value;
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	uint8_t *alt_buf;	/* Buffer filled while the other one is programmed,
+				 * NULL when pipelining is not enabled for the context.
+				 */
+	struct k_work pipe_work; /* Programs pipe_buf on the system work queue */
+	struct k_sem pipe_sem;	/* Signals completion of pipe_work */
+	uint8_t *pipe_buf;	/* Buffer currently being programmed */
+	size_t pipe_len;	/* Write-block aligned length of pipe_buf data */
+	size_t pipe_buf_bytes;	/* Payload bytes in pipe_buf */
+	size_t pipe_addr;	/* Absolute write address of pipe_buf */
+	int pipe_rc;		/* Result of the last pipelined write */
+	bool pipe_active;	/* A pipelined write has not yet been collected */
+#endif
 };
 
 /**
@@ -95,6 +109,30 @@ struct stream_flash_ctx {
 int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 		      uint8_t *buf, size_t buf_len, size_t offset, size_t size,
 		      stream_flash_callback_t cb);
+
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+/**
+ * @brief Enable pipelined writes for an initialized context.
+ *
+ * When enabled, a full buffer is programmed from the system work queue while
+ * subsequent stream_flash_buffered_write() calls fill @p buf, overlapping
+ * flash programming with data reception. An error from a pipelined write is
+ * reported by the next stream_flash_buffered_write() call; the context must
+ * then be re-initialized. A write with the flush flag set waits until all
+ * data has been programmed before returning.
+ *
+ * Must be called after @ref stream_flash_init and before any data is
+ * written.
+ *
+ * @param ctx context, previously initialized by @ref stream_flash_init
+ * @param buf Second write buffer. Same length and alignment requirements as
+ *            the buffer given to @ref stream_flash_init.
+ *
+ * @return non-negative on success, negative errno code on fail
+ */
+int stream_flash_pipeline_init(struct stream_flash_ctx *ctx, uint8_t *buf);
+#endif /* CONFIG_STREAM_FLASH_PIPELINE */
+
 /**
  * @brief Read number of bytes written to the flash.
  *
@@ -168,6 +168,29 @@ int sys_bitarray_test_and_clear_bit(sys_bitarray_t *bitarray, size_t bit, int *p
 int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		       size_t *offset);
 
+/**
+ * Allocate multiple bits in a bit array
+ *
+ * This finds a number of bits (@p num_bits) in previously unallocated
+ * regions, which do not need to be contiguous, and marks them as
+ * allocated in a single pass. The offset of each allocated bit is
+ * returned via @p offsets, which must have room for @p num_bits
+ * entries. If not enough unallocated bits exist, the bit array is
+ * left unmodified.
+ *
+ * @param[in]  bitarray Bitarray struct
+ * @param[in]  num_bits Number of bits to allocate
+ * @param[out] offsets  Offsets of the allocated bits if successful
+ *
+ * @retval 0       Allocation successful
+ * @retval -EINVAL Invalid argument (e.g. allocating more bits than
+ *                 the bitarray has, trying to allocate 0 bits, etc.)
+ * @retval -ENOSPC Not enough unallocated bits to accommodate
+ *                 the allocation
+ */
+int sys_bitarray_alloc_bits(sys_bitarray_t *bitarray, size_t num_bits,
+			    size_t *offsets);
+
 /**
  * Calculates the bit-wise XOR of two bitarrays in a region.
  * The result is stored in the first bitarray passed in (@p dst).
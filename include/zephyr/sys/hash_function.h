@@ -108,6 +108,22 @@ uint32_t sys_hash32_djb2(const void *str, size_t n);
  */
 uint32_t sys_hash32_murmur3(const void *str, size_t n);
 
+/**
+ * @brief CRC32C (Castagnoli) hash function
+ *
+ * When the compiler targets a processor with the CRC extension, this hash
+ * function uses the CRC32 instructions directly; other targets fall back to
+ * the table-driven software CRC32C.
+ *
+ * @param str a string of input data
+ * @param n the number of bytes in @p str
+ *
+ * @return the numeric hash associated with @p str
+ *
+ * @note enable with @kconfig{CONFIG_SYS_HASH_FUNC32_CRC32C}
+ */
+uint32_t sys_hash32_crc32c(const void *str, size_t n);
+
 /**
  * @brief System default 32-bit hash function
  *
@@ -130,11 +146,36 @@ static inline uint32_t sys_hash32(const void *str, size_t n)
 		return sys_hash32_murmur3(str, n);
 	}
 
+	if (IS_ENABLED(CONFIG_SYS_HASH_FUNC32_CHOICE_CRC32C)) {
+		return sys_hash32_crc32c(str, n);
+	}
+
 	__ASSERT(0, "No default 32-bit hash. See CONFIG_SYS_HASH_FUNC32_CHOICE");
 
 	return 0;
 }
 
+/**
+ * @brief Hash an array of keys with the system default 32-bit hash function
+ *
+ * Hashing many keys from a single call site amortizes the per-call overhead
+ * (call dispatch and, for table-driven hash functions, lookup-table cache
+ * warm-up) across all keys, which benefits bulk operations such as rehashing
+ * a table.
+ *
+ * @param keys array of @p n pointers to key data
+ * @param sizes array of @p n key sizes (in bytes)
+ * @param hashes array filled with the @p n computed hashes
+ * @param n the number of keys
+ */
+static inline void sys_hash32_bulk(const void *const *keys, const size_t *sizes,
+				   uint32_t *hashes, size_t n)
+{
+	for (size_t i = 0; i < n; ++i) {
+		hashes[i] = sys_hash32(keys[i], sizes[i]);
+	}
+}
+
 /**
  * @}
  */
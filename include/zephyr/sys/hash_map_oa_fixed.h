@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @ingroup hashmap_implementations
+ * @brief Fixed-storage Open-Addressing Hashmap Implementation
+ *
+ * In contrast to the other Hashmap implementations, the bucket array of this
+ * variant is allocated statically by the defining macro and the map never
+ * calls an allocator. This makes it suitable for use before the heap is
+ * available, in code that must not allocate, and (with external
+ * synchronization) from ISRs. Deleted entries are compacted with
+ * backward-shift deletion, so no tombstones accumulate and no rehashing is
+ * ever required.
+ *
+ * The number of buckets is fixed at definition time and must be a power of
+ * two. Insertions fail with -ENOSPC once the configured load factor would be
+ * exceeded.
+ *
+ * @note Enable with @kconfig{CONFIG_SYS_HASH_MAP_OA_FIXED}
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_HASH_MAP_OA_FIXED_H_
+#define ZEPHYR_INCLUDE_SYS_HASH_MAP_OA_FIXED_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/hash_function.h>
+#include <zephyr/sys/hash_map_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief A single bucket of a fixed-storage Hashmap, zero-initialized = empty */
+struct sys_hashmap_oa_fixed_entry {
+	uint64_t key;
+	uint64_t value;
+	uint8_t state;
+};
+
+/** @brief Configuration variant for fixed-storage Hashmaps */
+struct sys_hashmap_oa_fixed_config {
+	/** Common Hashmap configuration, must be the first member */
+	struct sys_hashmap_config common;
+	/** Statically allocated bucket array */
+	struct sys_hashmap_oa_fixed_entry *entries;
+	/** Number of buckets in @a entries, a power of two */
+	size_t n_buckets;
+};
+
+/**
+ * @brief Declare a fixed-storage Open Addressing Hashmap (advanced)
+ *
+ * Declare a fixed-storage Open Addressing Hashmap with control over advanced
+ * parameters.
+ *
+ * @param _name Name of the Hashmap.
+ * @param _n_buckets Number of buckets, must be a power of two.
+ * @param _hash_func Hash function pointer of type @ref sys_hash_func32_t.
+ * @param ... Details for @ref sys_hashmap_config.
+ */
+#define SYS_HASHMAP_OA_FIXED_DEFINE_ADVANCED(_name, _n_buckets, _hash_func, ...)                   \
+	BUILD_ASSERT(((_n_buckets) & ((_n_buckets) - 1)) == 0,                                     \
+		     "n_buckets must be a power of two");                                          \
+	static struct sys_hashmap_oa_fixed_entry _name##_entries[_n_buckets];                      \
+	SYS_HASHMAP_DEFINE_ADVANCED(_name, &sys_hashmap_oa_fixed_api,                              \
+				    sys_hashmap_oa_fixed_config, sys_hashmap_data, _hash_func,     \
+				    NULL,                                                          \
+				    {                                                              \
+					    .common = __VA_ARGS__,                                 \
+					    .entries = _name##_entries,                            \
+					    .n_buckets = (_n_buckets),                             \
+				    })
+
+/**
+ * @brief Declare a fixed-storage Open Addressing Hashmap statically (advanced)
+ *
+ * Declare a fixed-storage Open Addressing Hashmap statically with control
+ * over advanced parameters.
+ *
+ * @param _name Name of the Hashmap.
+ * @param _n_buckets Number of buckets, must be a power of two.
+ * @param _hash_func Hash function pointer of type @ref sys_hash_func32_t.
+ * @param ... Details for @ref sys_hashmap_config.
+ */
+#define SYS_HASHMAP_OA_FIXED_DEFINE_STATIC_ADVANCED(_name, _n_buckets, _hash_func, ...)            \
+	BUILD_ASSERT(((_n_buckets) & ((_n_buckets) - 1)) == 0,                                     \
+		     "n_buckets must be a power of two");                                          \
+	static struct sys_hashmap_oa_fixed_entry _name##_entries[_n_buckets];                      \
+	SYS_HASHMAP_DEFINE_STATIC_ADVANCED(_name, &sys_hashmap_oa_fixed_api,                       \
+					   sys_hashmap_oa_fixed_config, sys_hashmap_data,          \
+					   _hash_func, NULL,                                       \
+					   {                                                       \
+						   .common = __VA_ARGS__,                          \
+						   .entries = _name##_entries,                     \
+						   .n_buckets = (_n_buckets),                      \
+					   })
+
+/**
+ * @brief Declare a fixed-storage Open Addressing Hashmap
+ *
+ * Declare a fixed-storage Open Addressing Hashmap with default parameters.
+ *
+ * @param _name Name of the Hashmap.
+ * @param _n_buckets Number of buckets, must be a power of two.
+ */
+#define SYS_HASHMAP_OA_FIXED_DEFINE(_name, _n_buckets)                                             \
+	SYS_HASHMAP_OA_FIXED_DEFINE_ADVANCED(                                                      \
+		_name, _n_buckets, sys_hash32,                                                     \
+		SYS_HASHMAP_CONFIG(_n_buckets, SYS_HASHMAP_DEFAULT_LOAD_FACTOR))
+
+/**
+ * @brief Declare a fixed-storage Open Addressing Hashmap statically
+ *
+ * Declare a fixed-storage Open Addressing Hashmap statically with default
+ * parameters.
+ *
+ * @param _name Name of the Hashmap.
+ * @param _n_buckets Number of buckets, must be a power of two.
+ */
+#define SYS_HASHMAP_OA_FIXED_DEFINE_STATIC(_name, _n_buckets)                                      \
+	SYS_HASHMAP_OA_FIXED_DEFINE_STATIC_ADVANCED(                                               \
+		_name, _n_buckets, sys_hash32,                                                     \
+		SYS_HASHMAP_CONFIG(_n_buckets, SYS_HASHMAP_DEFAULT_LOAD_FACTOR))
+
+extern const struct sys_hashmap_api sys_hashmap_oa_fixed_api;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_HASH_MAP_OA_FIXED_H_ */
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_MEM_ARENA_H_
+#define ZEPHYR_INCLUDE_SYS_MEM_ARENA_H_
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup mem_arena_apis Memory arena APIs
+ * @ingroup mem_mgmt
+ * @{
+ *
+ * @brief Arena allocator for transient allocations
+ *
+ * An arena hands out allocations by bumping an offset into a single
+ * chunk of memory obtained from a parent k_heap, and releases all of
+ * them at once with sys_mem_arena_reset(). Allocation and release are
+ * O(1) pointer arithmetic without locking, which makes arenas suited
+ * for bursts of short-lived allocations with a common lifetime, such
+ * as building up an encoded message, where individual k_heap
+ * alloc/free pairs would serialize on the heap spinlock.
+ *
+ * An arena is intentionally not thread-safe: it is owned by a single
+ * context at a time. Memory allocated from an arena cannot be freed
+ * individually.
+ */
+
+/**
+ * @brief Memory arena
+ *
+ * The struct is initialized with sys_mem_arena_init() and all fields
+ * are internal to the implementation.
+ */
+struct sys_mem_arena {
+	/** Parent heap the arena chunk was allocated from */
+	struct k_heap *parent;
+	/** Arena chunk */
+	uint8_t *buf;
+	/** Size of the arena chunk in bytes */
+	size_t size;
+	/** Offset of the next allocation */
+	size_t offset;
+#if defined(CONFIG_THREAD_LOCAL_STORAGE) || defined(__DOXYGEN__)
+	/** Arena shadowed by this one in the thread arena scope chain */
+	struct sys_mem_arena *prev;
+#endif
+};
+
+/**
+ * @brief Initialize a memory arena
+ *
+ * Allocates the arena chunk from the parent heap. The allocation does
+ * not wait; initialization fails when the parent heap cannot satisfy
+ * it immediately.
+ *
+ * @param arena  Arena to initialize.
+ * @param parent Heap to allocate the arena chunk from.
+ * @param size   Size of the arena chunk in bytes.
+ *
+ * @return 0 on success, -ENOMEM if the chunk allocation failed.
+ */
+int sys_mem_arena_init(struct sys_mem_arena *arena, struct k_heap *parent,
+		       size_t size);
+
+/**
+ * @brief Allocate memory from an arena
+ *
+ * The returned memory is aligned to sizeof(void *) and remains valid
+ * until the arena is reset or destroyed.
+ *
+ * @param arena Arena to allocate from.
+ * @param bytes Number of bytes requested.
+ *
+ * @return Pointer to the allocated memory, or NULL if the space left
+ *         in the arena chunk is insufficient.
+ */
+void *sys_mem_arena_alloc(struct sys_mem_arena *arena, size_t bytes);
+
+/**
+ * @brief Allocate aligned memory from an arena
+ *
+ * @param arena Arena to allocate from.
+ * @param align Alignment of the allocation, must be a power of two.
+ * @param bytes Number of bytes requested.
+ *
+ * @return Pointer to the allocated memory, or NULL if the space left
+ *         in the arena chunk is insufficient.
+ */
+void *sys_mem_arena_aligned_alloc(struct sys_mem_arena *arena, size_t align,
+				  size_t bytes);
+
+/**
+ * @brief Release all arena allocations
+ *
+ * Invalidates every pointer previously returned by the allocation
+ * functions and makes the full arena chunk available again.
+ *
+ * @param arena Arena to reset.
+ */
+void sys_mem_arena_reset(struct sys_mem_arena *arena);
+
+/**
+ * @brief Destroy a memory arena
+ *
+ * Returns the arena chunk to the parent heap. The arena must be
+ * re-initialized before it can be used again.
+ *
+ * @param arena Arena to destroy.
+ */
+void sys_mem_arena_destroy(struct sys_mem_arena *arena);
+
+#if defined(CONFIG_THREAD_LOCAL_STORAGE) || defined(__DOXYGEN__)
+
+/**
+ * @brief Make an arena the implicit arena of the current thread
+ *
+ * Establishes @p arena as the arena returned by
+ * sys_mem_arena_current() in the calling thread until the matching
+ * sys_mem_arena_scope_exit() call. Scopes nest: the previously
+ * established arena is restored on exit.
+ *
+ * This allows deep call chains to allocate transient memory from an
+ * arena set up by their caller without threading the arena pointer
+ * through every function.
+ *
+ * @param arena Arena to establish.
+ */
+void sys_mem_arena_scope_enter(struct sys_mem_arena *arena);
+
+/**
+ * @brief Leave the current thread arena scope
+ *
+ * Restores the implicit arena that was established before the
+ * matching sys_mem_arena_scope_enter() call. The arena itself is not
+ * reset; this remains the responsibility of the scope owner.
+ *
+ * @param arena Arena passed to the matching scope enter call.
+ */
+void sys_mem_arena_scope_exit(struct sys_mem_arena *arena);
+
+/**
+ * @brief Get the implicit arena of the current thread
+ *
+ * @return The arena established by the innermost active scope of the
+ *         calling thread, or NULL when no scope is active.
+ */
+struct sys_mem_arena *sys_mem_arena_current(void);
+
+#endif /* CONFIG_THREAD_LOCAL_STORAGE */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_MEM_ARENA_H_ */
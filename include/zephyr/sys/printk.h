@@ -60,6 +60,22 @@ static inline __printf_like(1, 0) void vprintk(const char *fmt, va_list ap)
 }
 #endif
 
+/**
+ * @brief Flush buffered printk() output synchronously.
+ *
+ * Drains any characters still sitting in the printk ring buffers
+ * directly to the console and switches subsequent printk() calls to
+ * synchronous output. Called from the fatal error path so that
+ * buffered diagnostics are not lost on a panic.
+ */
+#ifdef CONFIG_PRINTK_BUFFERED
+void printk_flush(void);
+#else
+static inline void printk_flush(void)
+{
+}
+#endif
+
 #ifdef CONFIG_PICOLIBC
 
 #include <stdio.h>
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SPSC_RING_BUF_H_
+#define ZEPHYR_INCLUDE_SYS_SPSC_RING_BUF_H_
+
+#include <zephyr/devicetree.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Single producer, single consumer byte ring buffer API
+ * @defgroup spsc_ring_buf SPSC byte ring buffer API
+ * @ingroup datastructure_apis
+ *
+ * A lock-free byte ring buffer restricted to exactly one producer and one
+ * consumer context, with a claim/finish API shaped after the byte mode of
+ * @ref ring_buffer_apis. The producer and consumer indices are kept on
+ * separate cache lines so that the two sides do not false-share when they
+ * run on different cores, and index updates use atomics so no locking or
+ * IRQ masking is needed on either path.
+ *
+ * The buffer size must be a power of two.
+ *
+ * @{
+ */
+
+/** @cond INTERNAL_HIDDEN */
+
+#if CONFIG_DCACHE_LINE_SIZE != 0
+#define Z_SPSC_RING_BUF_DCACHE_LINE CONFIG_DCACHE_LINE_SIZE
+#else
+#define Z_SPSC_RING_BUF_DCACHE_LINE DT_PROP_OR(CPU, d_cache_line_size, 0)
+#endif
+
+/* Alignment keeping the producer and consumer index pairs on separate
+ * cache lines, falling back to natural alignment when the cache line
+ * size is unknown.
+ */
+#define Z_SPSC_RING_BUF_IDX_ALIGN \
+	MAX(Z_SPSC_RING_BUF_DCACHE_LINE, __alignof__(atomic_t))
+
+struct spsc_ring_buf_index {
+	/* Free running index, masked on buffer access */
+	atomic_t idx;
+	/* Bytes claimed past idx, private to the owning side */
+	uint32_t claimed;
+} __aligned(Z_SPSC_RING_BUF_IDX_ALIGN);
+
+/** @endcond */
+
+/**
+ * @brief A single producer, single consumer byte ring buffer
+ *
+ * All fields are internal to the implementation.
+ */
+struct spsc_ring_buf {
+	/** @cond INTERNAL_HIDDEN */
+	uint8_t *data;
+	uint32_t mask;
+	/* Mutated by the producer only */
+	struct spsc_ring_buf_index put;
+	/* Mutated by the consumer only */
+	struct spsc_ring_buf_index get;
+	/** @endcond */
+};
+
+/**
+ * @brief Define and initialize an SPSC ring buffer.
+ *
+ * @param name Name of the ring buffer.
+ * @param size8 Size of the ring buffer in bytes, must be a power of two.
+ */
+#define SPSC_RING_BUF_DECLARE(name, size8)                        \
+	BUILD_ASSERT(IS_POWER_OF_TWO(size8));                     \
+	static uint8_t __noinit _spsc_ring_buffer_data_##name[size8]; \
+	static struct spsc_ring_buf name = {                      \
+		.data = _spsc_ring_buffer_data_##name,            \
+		.mask = (size8) - 1,                              \
+	}
+
+/**
+ * @brief Initialize an SPSC ring buffer.
+ *
+ * This routine initializes a ring buffer, prior to its first use. It is only
+ * used for ring buffers not defined using SPSC_RING_BUF_DECLARE.
+ *
+ * @param buf Ring buffer.
+ * @param data Ring buffer data area.
+ * @param size Ring buffer data area size in bytes, must be a power of two.
+ */
+void spsc_ring_buf_init(struct spsc_ring_buf *buf, uint8_t *data, uint32_t size);
+
+/**
+ * @brief Get the ring buffer capacity in bytes.
+ *
+ * @param buf Ring buffer.
+ *
+ * @return Ring buffer capacity.
+ */
+static inline uint32_t spsc_ring_buf_capacity_get(const struct spsc_ring_buf *buf)
+{
+	return buf->mask + 1;
+}
+
+/**
+ * @brief Determine used space in a ring buffer.
+ *
+ * The result is a snapshot: the other side may have progressed by the time
+ * it is acted upon. Space consumed by the producer can only grow it and
+ * space released by the consumer can only shrink it.
+ *
+ * @param buf Ring buffer.
+ *
+ * @return Ring buffer space used in bytes.
+ */
+uint32_t spsc_ring_buf_size_get(const struct spsc_ring_buf *buf);
+
+/**
+ * @brief Determine free space in a ring buffer.
+ *
+ * See the snapshot note on spsc_ring_buf_size_get().
+ *
+ * @param buf Ring buffer.
+ *
+ * @return Ring buffer free space in bytes.
+ */
+uint32_t spsc_ring_buf_space_get(const struct spsc_ring_buf *buf);
+
+/**
+ * @brief Allocate buffer for writing data to a ring buffer.
+ *
+ * With this routine, memory copying can be reduced since internal ring buffer
+ * can be used directly by the user. Once data is written to allocated area
+ * the number of bytes written must be confirmed (see
+ * spsc_ring_buf_put_finish()). Claims may be repeated to obtain the region
+ * past a wrap-around; claimed bytes are not visible to the consumer until
+ * finished.
+ *
+ * Must only be called from the producer context.
+ *
+ * @param[in]  buf Ring buffer.
+ * @param[out] data Pointer to the address. It is set to a location within
+ *		    ring buffer.
+ * @param[in]  size Requested allocation size (in bytes).
+ *
+ * @return Size of allocated buffer which can be smaller than requested if
+ *	   there is not enough free space or buffer wraps.
+ */
+uint32_t spsc_ring_buf_put_claim(struct spsc_ring_buf *buf, uint8_t **data,
+				 uint32_t size);
+
+/**
+ * @brief Indicate number of bytes written to allocated buffers.
+ *
+ * The number of bytes must be equal to or lower than the sum corresponding
+ * to all preceding spsc_ring_buf_put_claim() invocations (or even 0).
+ * Surplus bytes will be returned to the available free buffer space. The
+ * finished bytes are published to the consumer with release semantics.
+ *
+ * Must only be called from the producer context.
+ *
+ * @param buf Ring buffer.
+ * @param size Number of valid bytes in the allocated buffers.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL Provided size exceeds the claimed buffer size.
+ */
+int spsc_ring_buf_put_finish(struct spsc_ring_buf *buf, uint32_t size);
+
+/**
+ * @brief Get address of a valid data in a ring buffer.
+ *
+ * With this routine, memory copying can be reduced since internal ring buffer
+ * can be used directly by the user. Once data is processed it must be freed
+ * using spsc_ring_buf_get_finish(). Claims may be repeated to obtain the
+ * region past a wrap-around.
+ *
+ * Must only be called from the consumer context.
+ *
+ * @param[in]  buf Ring buffer.
+ * @param[out] data Pointer to the address. It is set to a location within
+ *		    ring buffer.
+ * @param[in]  size Requested size (in bytes).
+ *
+ * @return Number of valid bytes in the provided buffer which can be smaller
+ *	   than requested if there is less available data or buffer wraps.
+ */
+uint32_t spsc_ring_buf_get_claim(struct spsc_ring_buf *buf, uint8_t **data,
+				 uint32_t size);
+
+/**
+ * @brief Indicate number of bytes read from claimed buffer.
+ *
+ * The number of bytes must be equal to or lower than the sum corresponding
+ * to all preceding spsc_ring_buf_get_claim() invocations (or even 0).
+ * Surplus bytes will remain available in the buffer.
+ *
+ * Must only be called from the consumer context.
+ *
+ * @param buf Ring buffer.
+ * @param size Number of bytes that can be freed.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL Provided size exceeds the claimed buffer size.
+ */
+int spsc_ring_buf_get_finish(struct spsc_ring_buf *buf, uint32_t size);
+
+/**
+ * @brief Write (copy) data to a ring buffer.
+ *
+ * Must only be called from the producer context.
+ *
+ * @param buf Ring buffer.
+ * @param data Address of data.
+ * @param size Data size (in bytes).
+ *
+ * @return Number of bytes written, which can be smaller than requested if
+ *	   there is not enough free space.
+ */
+uint32_t spsc_ring_buf_put(struct spsc_ring_buf *buf, const uint8_t *data,
+			   uint32_t size);
+
+/**
+ * @brief Read (copy) data from a ring buffer.
+ *
+ * Must only be called from the consumer context.
+ *
+ * @param buf Ring buffer.
+ * @param data Address of the output buffer.
+ * @param size Data size (in bytes).
+ *
+ * @return Number of bytes read, which can be smaller than requested if there
+ *	   is less available data.
+ */
+uint32_t spsc_ring_buf_get(struct spsc_ring_buf *buf, uint8_t *data,
+			   uint32_t size);
+
+/**
+ * @brief Reset a ring buffer to the empty state.
+ *
+ * Not safe while the buffer is in use by a producer or consumer.
+ *
+ * @param buf Ring buffer.
+ */
+void spsc_ring_buf_reset(struct spsc_ring_buf *buf);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_SPSC_RING_BUF_H_ */
@@ -306,6 +306,33 @@ int sys_heap_array_save(struct sys_heap *heap);
  */
 int sys_heap_array_get(struct sys_heap ***heap);
 
+/**
+ * @brief One entry of the sys_heap allocation site table
+ */
+struct sys_heap_alloc_site {
+	/** Return address of the allocating call site, or 0 if unused */
+	uintptr_t caller;
+	/** Number of live allocations made from this site */
+	uint32_t count;
+	/** Live allocated bytes, including chunk overhead */
+	size_t bytes;
+};
+
+/** @brief Read one allocation site table entry
+ *
+ * Copies out entry @a idx of the global allocation site table that is
+ * maintained when CONFIG_SYS_HEAP_ALLOC_SITES is enabled.  The table
+ * is shared by all heaps.  Entry 0 is the overflow site accounting for
+ * allocations whose caller could not claim a slot of its own; its
+ * caller field is always 0.
+ *
+ * @param idx Table index, 0 to CONFIG_SYS_HEAP_ALLOC_SITES_COUNT - 1
+ * @param site Struct to copy the entry into
+ * @return -EINVAL if @a site is NULL or @a idx is out of range,
+ *         otherwise 0
+ */
+int sys_heap_alloc_site_get(size_t idx, struct sys_heap_alloc_site *site);
+
 /**
  * @}
  */
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+#define ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief System call batching
+ * @defgroup syscall_batch_apis System call batching APIs
+ * @ingroup internal_api
+ * @{
+ */
+
+/**
+ * @brief One operation within a system call batch
+ *
+ * The call ID is one of the generated K_SYSCALL_* identifiers from
+ * zephyr/syscall_list.h and the arguments are laid out exactly as the
+ * generated invocation stubs would marshal them, one uintptr_t per
+ * parameter (two for 64-bit parameters on 32-bit targets, low word
+ * first). Unused argument slots are ignored.
+ */
+struct k_syscall_batch_op {
+	/** System call ID (K_SYSCALL_* value) to invoke */
+	uint32_t call_id;
+
+	/** Marshalled arguments for the call */
+	uintptr_t args[6];
+
+	/** Return value of the call, written back on completion */
+	uintptr_t result;
+};
+
+/**
+ * @brief Execute a batch of system calls with a single privilege transition
+ *
+ * Runs up to CONFIG_SYSCALL_BATCH_MAX_OPS system calls in order, each with
+ * the same validation it would receive if invoked individually, and writes
+ * each call's return value back into the corresponding operation's result
+ * field. This amortizes the cost of the user/kernel privilege transition
+ * over the whole batch, which helps workloads issuing many small system
+ * calls in quick succession.
+ *
+ * All call IDs are validated before any operation runs; a batch containing
+ * an unknown ID, or k_syscall_batch() itself, fails without side effects.
+ * Operations that would fault when invoked individually (bad pointers,
+ * missing object permissions, ...) still fault and terminate the calling
+ * thread as usual.
+ *
+ * System calls with more than six marshalled arguments, or with 64-bit
+ * return values on 32-bit targets, pass extra state through pointers set
+ * up by their generated invocation stubs and cannot be batched.
+ *
+ * This routine only performs batched dispatch when invoked from user mode;
+ * kernel threads call kernel APIs directly and get -ENOTSUP.
+ *
+ * @param ops Array of operations to execute, updated with results
+ * @param num_ops Number of operations in the array
+ *
+ * @retval 0 All operations were dispatched
+ * @retval -EINVAL @a num_ops is zero or exceeds CONFIG_SYSCALL_BATCH_MAX_OPS
+ * @retval -ENOSYS A call ID does not name a batchable system call
+ * @retval -ENOTSUP Invoked from supervisor mode
+ */
+__syscall int k_syscall_batch(struct k_syscall_batch_op *ops, size_t num_ops);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <zephyr/syscalls/syscall_batch.h>
+
+#endif /* ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_ */
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef ZEPHYR_INCLUDE_SYS_THREAD_POOL_H_
+#define ZEPHYR_INCLUDE_SYS_THREAD_POOL_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/iterable_sections.h>
+
+/* Pools of pre-created worker threads for short-lived jobs.
+ *
+ * Spawning a thread with k_thread_create() pays for full stack and
+ * thread object initialization on every spawn, which adds up for
+ * workloads that create many short-lived worker threads. A thread pool
+ * creates its workers once at boot and parks them on a semaphore;
+ * submitting a job only rebinds the entry point and parameters of an
+ * idle worker and wakes it up. The worker stacks are initialized
+ * (and painted, with CONFIG_INIT_STACKS) exactly once, so stack usage
+ * watermarks accumulate over the pool lifetime.
+ */
+
+struct k_thread_pool;
+
+/** @cond INTERNAL_HIDDEN */
+
+struct k_thread_pool_worker {
+	sys_snode_t node;
+	struct k_sem wakeup;
+	k_thread_entry_t entry;
+	void *p1;
+	void *p2;
+	void *p3;
+	struct k_thread_pool *pool;
+	struct k_thread thread;
+};
+
+/** @endcond */
+
+/**
+ * @brief Thread pool
+ *
+ * Set of pre-created worker threads that jobs can be submitted to.
+ */
+struct k_thread_pool {
+	struct k_spinlock lock;
+
+	/* Parked workers waiting for a job */
+	sys_slist_t idle;
+
+	/* Counts the workers on the idle list, so that submitters can
+	 * block waiting for a worker to become available.
+	 */
+	struct k_sem idle_sem;
+
+	struct k_thread_pool_worker *workers;
+	uint32_t num;
+};
+
+/** @cond INTERNAL_HIDDEN */
+
+struct k_thread_pool_initparam {
+	struct k_thread_pool *pool;
+	struct k_thread_pool_worker *workers;
+	struct z_thread_stack_element *stacks;
+	uintptr_t stack_size;
+	uint32_t num;
+	int prio;
+};
+
+/** @endcond */
+
+/**
+ * @brief Statically define a thread pool
+ *
+ * Statically defines a struct k_thread_pool object with the specified
+ * number of worker threads which will be created at boot and ready for
+ * use on entry to main().
+ *
+ * @param name Symbol name of the struct k_thread_pool that will be defined
+ * @param n_threads Number of worker threads in the pool
+ * @param stack_sz Requested stack size of each worker, in bytes
+ * @param prio_ Thread priority the workers run jobs at
+ */
+#define K_THREAD_POOL_DEFINE(name, n_threads, stack_sz, prio_)		\
+	static K_THREAD_STACK_ARRAY_DEFINE(_pool_stacks_##name,		\
+					   n_threads, stack_sz);	\
+	static struct k_thread_pool_worker _pool_workers_##name[n_threads]; \
+	static struct k_thread_pool name;				\
+	static const STRUCT_SECTION_ITERABLE(k_thread_pool_initparam,	\
+					     _init_##name) = {		\
+		.pool = &name,						\
+		.workers = _pool_workers_##name,			\
+		.stacks = &(_pool_stacks_##name[0][0]),			\
+		.stack_size = stack_sz,					\
+		.num = n_threads,					\
+		.prio = prio_,						\
+	}
+
+/**
+ * @brief Submit a job to a thread pool
+ *
+ * Rebinds an idle worker thread to the given entry point and
+ * parameters and wakes it up. The entry function runs in the worker
+ * thread context at the pool priority; when it returns, the worker
+ * parks itself back on the idle list. Unlike a thread spawned with
+ * k_thread_create(), the worker stack is not reinitialized between
+ * jobs.
+ *
+ * Can be called from ISR context only with a timeout of K_NO_WAIT.
+ *
+ * @param pool Thread pool to submit to
+ * @param entry Job entry point
+ * @param p1 First parameter passed to @p entry
+ * @param p2 Second parameter passed to @p entry
+ * @param p3 Third parameter passed to @p entry
+ * @param timeout How long to wait for a worker to become idle
+ *
+ * @retval 0 on success
+ * @retval -EBUSY if no worker is idle and the timeout is K_NO_WAIT
+ * @retval -EAGAIN if no worker became idle before the timeout expired
+ */
+int k_thread_pool_submit(struct k_thread_pool *pool, k_thread_entry_t entry,
+			 void *p1, void *p2, void *p3, k_timeout_t timeout);
+
+/**
+ * @brief Number of currently idle workers in a thread pool
+ *
+ * The value is naturally racy as workers may be claimed or released
+ * concurrently, so it is only a snapshot.
+ *
+ * @param pool Thread pool to query
+ *
+ * @return Number of workers currently parked on the idle list
+ */
+static inline uint32_t k_thread_pool_idle_count(struct k_thread_pool *pool)
+{
+	return k_sem_count_get(&pool->idle_sem);
+}
+
+#endif /* ZEPHYR_INCLUDE_SYS_THREAD_POOL_H_ */
@@ -1267,6 +1267,22 @@
  */
 #define sys_port_trace_k_lifo_alloc_put_exit(lifo, data, ret)
 
+/**
+ * @brief Trace LIFO Queue put list entry
+ * @param lifo LIFO object
+ * @param head First ll-node
+ * @param tail Last ll-node
+ */
+#define sys_port_trace_k_lifo_put_list_enter(lifo, head, tail)
+
+/**
+ * @brief Trace LIFO Queue put list exit
+ * @param lifo LIFO object
+ * @param head First ll-node
+ * @param tail Last ll-node
+ */
+#define sys_port_trace_k_lifo_put_list_exit(lifo, head, tail)
+
 /**
  * @brief Trace LIFO Queue get entry
  * @param lifo LIFO object
@@ -50,6 +50,14 @@ struct zbus_channel_data {
 	int highest_observer_priority;
 #endif /* CONFIG_ZBUS_PRIORITY_BOOST */
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK) || defined(__DOXYGEN__)
+	/** Message sequence counter. It is incremented before and after every message update,
+	 * so it is odd while a write is in progress. Readers use it to take consistent message
+	 * snapshots without acquiring the channel semaphore.
+	 */
+	atomic_t seq;
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 #if defined(CONFIG_ZBUS_RUNTIME_OBSERVERS) || defined(__DOXYGEN__)
 	/** Channel observer list. Represents the channel's observers list, it can be empty
 	 * or have listeners and subscribers mixed in any sequence. It can be changed in runtime.
@@ -118,6 +126,7 @@ enum __packed zbus_observer_type {
 	ZBUS_OBSERVER_LISTENER_TYPE,
 	ZBUS_OBSERVER_SUBSCRIBER_TYPE,
 	ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE,
+	ZBUS_OBSERVER_EVENT_SUBSCRIBER_TYPE,
 };
 
 struct zbus_observer_data {
@@ -169,7 +178,22 @@ struct zbus_observer {
 		 */
 		struct k_fifo *message_fifo;
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
+
+#if defined(CONFIG_ZBUS_EVENT_SUBSCRIBER) || defined(__DOXYGEN__)
+		/** Observer event object. It turns the observer into an event subscriber. Several
+		 * event subscribers can share the same event object. It only exists if the
+		 * @kconfig{CONFIG_ZBUS_EVENT_SUBSCRIBER} is enabled.
+		 */
+		struct k_event *event;
+#endif /* CONFIG_ZBUS_EVENT_SUBSCRIBER */
 	};
+
+#if defined(CONFIG_ZBUS_EVENT_SUBSCRIBER) || defined(__DOXYGEN__)
+	/** Event bits posted to the event object on every notification. It only exists if the
+	 * @kconfig{CONFIG_ZBUS_EVENT_SUBSCRIBER} is enabled.
+	 */
+	uint32_t event_mask;
+#endif /* CONFIG_ZBUS_EVENT_SUBSCRIBER */
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -550,6 +574,52 @@ struct zbus_channel_observation {
  * @param[in] _name The subscriber's name.
  */
 #define ZBUS_MSG_SUBSCRIBER_DEFINE(_name) ZBUS_MSG_SUBSCRIBER_DEFINE_WITH_ENABLE(_name, true)
+
+/* clang-format off */
+
+/**
+ * @brief Define and initialize an event subscriber.
+ *
+ * This macro defines an observer of @ref ZBUS_OBSERVER_EVENT_SUBSCRIBER_TYPE type. On every
+ * notification the bus posts the given bits to the given event object. Several event subscribers
+ * can share a single event object, so one publish wakes all of them with a single kernel
+ * operation. Event subscribers carry no message payload; the application waits with
+ * k_event_wait() and fetches the current message with zbus_chan_read().
+ *
+ * @param[in] _name The subscriber's name.
+ * @param[in] _event The k_event object the notification bits are posted to.
+ * @param[in] _event_mask The bits posted on every notification.
+ * @param[in] _enable The subscriber's initial state.
+ */
+#define ZBUS_EVENT_SUBSCRIBER_DEFINE_WITH_ENABLE(_name, _event, _event_mask, _enable)  \
+	static struct zbus_observer_data _CONCAT(_zbus_obs_data_, _name) = {  \
+		.enabled = _enable,                                           \
+		IF_ENABLED(CONFIG_ZBUS_PRIORITY_BOOST, (                      \
+			.priority = ZBUS_MIN_THREAD_PRIORITY,                 \
+		))                                                            \
+	};                                                                    \
+	_ZBUS_CPP_EXTERN const STRUCT_SECTION_ITERABLE(zbus_observer, _name) = {  \
+		ZBUS_OBSERVER_NAME_INIT(_name) /* Name field */               \
+		.type = ZBUS_OBSERVER_EVENT_SUBSCRIBER_TYPE,                  \
+		.data = &_CONCAT(_zbus_obs_data_, _name),                     \
+		.event = &(_event),                                           \
+		.event_mask = (_event_mask),                                  \
+	}
+/* clang-format on */
+
+/**
+ * @brief Define and initialize an enabled event subscriber.
+ *
+ * This macro defines an observer of event subscriber type. The event subscribers are defined in
+ * the enabled state with this macro.
+ *
+ * @param[in] _name The subscriber's name.
+ * @param[in] _event The k_event object the notification bits are posted to.
+ * @param[in] _event_mask The bits posted on every notification.
+ */
+#define ZBUS_EVENT_SUBSCRIBER_DEFINE(_name, _event, _event_mask)                                   \
+	ZBUS_EVENT_SUBSCRIBER_DEFINE_WITH_ENABLE(_name, _event, _event_mask, true)
+
 /**
  *
  * @brief Publish to a channel
@@ -576,7 +646,10 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 /**
  * @brief Read a channel
  *
- * This routine reads a message from a channel.
+ * This routine reads a message from a channel. When the @kconfig{CONFIG_ZBUS_CHANNEL_SEQLOCK} is
+ * enabled, the message is copied without acquiring the channel semaphore, and the copy is retried
+ * while a concurrent write is detected. The semaphore is only acquired when the retry limit is
+ * reached.
  *
  * @param[in] chan The channel's reference.
  * @param[out] msg Reference to the message where the read function copies the channel's
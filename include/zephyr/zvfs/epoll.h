@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+#define ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Add a file descriptor to a ZVFS epoll instance */
+#define ZVFS_EPOLL_CTL_ADD 1
+/** Remove a file descriptor from a ZVFS epoll instance */
+#define ZVFS_EPOLL_CTL_DEL 2
+/** Change the registration of a file descriptor */
+#define ZVFS_EPOLL_CTL_MOD 3
+
+/** User data attached to a registration, returned verbatim with events */
+union zvfs_epoll_data {
+	void *ptr;
+	int fd;
+	uint32_t u32;
+	uint64_t u64;
+};
+
+/**
+ * @brief ZVFS epoll event
+ *
+ * The events field uses the same ZVFS_POLL* bits as zvfs_poll().
+ */
+struct zvfs_epoll_event {
+	uint32_t events;
+	union zvfs_epoll_data data;
+};
+
+/**
+ * @brief Create a ZVFS epoll instance
+ *
+ * The returned file descriptor refers to a persistent interest list: file
+ * descriptors are registered once with zvfs_epoll_ctl() and every
+ * zvfs_epoll_wait() call reports only the descriptors that are ready,
+ * instead of the caller re-submitting and re-scanning the full descriptor
+ * array as with zvfs_poll().
+ *
+ * @return New epoll file descriptor on success, -1 on error
+ */
+int zvfs_epoll_create(void);
+
+/**
+ * @brief Modify the interest list of a ZVFS epoll instance
+ *
+ * @param epfd Epoll file descriptor
+ * @param op One of ZVFS_EPOLL_CTL_ADD, ZVFS_EPOLL_CTL_DEL or
+ * ZVFS_EPOLL_CTL_MOD
+ * @param fd File descriptor the operation applies to
+ * @param event Requested events and user data; ignored for
+ * ZVFS_EPOLL_CTL_DEL
+ *
+ * @return 0 on success, -1 on error
+ */
+int zvfs_epoll_ctl(int epfd, int op, int fd, const struct zvfs_epoll_event *event);
+
+/**
+ * @brief Wait for events on a ZVFS epoll instance
+ *
+ * @param epfd Epoll file descriptor
+ * @param events Array filled with the ready descriptors' events and the
+ * user data given at registration
+ * @param maxevents Capacity of the @p events array
+ * @param timeout Timeout in milliseconds, or a negative value to wait
+ * forever
+ *
+ * @return Number of ready file descriptors, 0 on timeout, -1 on error
+ */
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents,
+		    int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_ */
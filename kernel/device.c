@@ -8,6 +8,7 @@
 #include <stddef.h>
 #include <string.h>
 #include <zephyr/device.h>
+#include <zephyr/kernel.h>
 #include <zephyr/sys/atomic.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/sys/kobject.h>
@@ -130,6 +131,28 @@ size_t z_device_get_all_static(struct device const **devices)
 	return cnt;
 }
 
+#ifdef CONFIG_DEVICE_INIT_ON_DEMAND
+static K_MUTEX_DEFINE(init_on_demand_lock);
+
+/* First-use gate for deferred devices: the first caller runs the init
+ * function, concurrent callers block until it completes.  Contexts
+ * that cannot block (ISRs, pre-kernel) leave the device untouched and
+ * keep seeing it as not ready.
+ */
+static void device_init_on_demand(const struct device *dev)
+{
+	if (k_is_in_isr() || k_is_pre_kernel()) {
+		return;
+	}
+
+	(void)k_mutex_lock(&init_on_demand_lock, K_FOREVER);
+	if (!dev->state->initialized) {
+		(void)device_init(dev);
+	}
+	(void)k_mutex_unlock(&init_on_demand_lock);
+}
+#endif /* CONFIG_DEVICE_INIT_ON_DEMAND */
+
 bool z_impl_device_is_ready(const struct device *dev)
 {
 	/*
@@ -140,6 +163,13 @@ bool z_impl_device_is_ready(const struct device *dev)
 		return false;
 	}
 
+#ifdef CONFIG_DEVICE_INIT_ON_DEMAND
+	if (!dev->state->initialized &&
+	    ((dev->flags & DEVICE_FLAG_INIT_DEFERRED) != 0U)) {
+		device_init_on_demand(dev);
+	}
+#endif /* CONFIG_DEVICE_INIT_ON_DEMAND */
+
 	return dev->state->initialized && (dev->state->init_res == 0U);
 }
 
@@ -92,6 +92,9 @@ void z_fatal_error(unsigned int reason, const struct arch_esf *esf)
 	struct k_thread *thread = IS_ENABLED(CONFIG_MULTITHREADING) ?
 			_current : NULL;
 
+	/* flush any buffered printk output before reporting the error */
+	printk_flush();
+
 	/* twister looks for the "ZEPHYR FATAL ERROR" string, don't
 	 * change it without also updating twister
 	 */
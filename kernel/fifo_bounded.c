@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Bounded lock-free FIFO
+ *
+ * Fixed-capacity multi-producer single-consumer ring of pointer-sized
+ * items. Producers claim a slot with a compare-and-swap on the head
+ * index and publish it with a non-NULL store, so the data path never
+ * takes a spinlock; the only lock involved is the k_poll lock used to
+ * wake a sleeping consumer.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/util.h>
+
+#include <kernel_internal.h>
+#include <ksched.h>
+
+void k_fifo_bounded_init(struct k_fifo_bounded *fifo, atomic_ptr_t *buffer,
+			 uint32_t size)
+{
+	__ASSERT(IS_POWER_OF_TWO(size), "size must be a power of two");
+
+	fifo->put_head = ATOMIC_INIT(0);
+	fifo->get_tail = ATOMIC_INIT(0);
+	fifo->mask = size - 1U;
+	fifo->buf = buffer;
+
+	for (uint32_t i = 0U; i < size; i++) {
+		atomic_ptr_clear(&buffer[i]);
+	}
+
+#ifdef CONFIG_POLL
+	sys_dlist_init(&fifo->poll_events);
+#endif
+}
+
+static inline bool handle_poll_events(struct k_fifo_bounded *fifo)
+{
+#ifdef CONFIG_POLL
+	return z_handle_obj_poll_events(&fifo->poll_events,
+					K_POLL_STATE_FIFO_BOUNDED_DATA_AVAILABLE);
+#else
+	ARG_UNUSED(fifo);
+
+	return false;
+#endif /* CONFIG_POLL */
+}
+
+int k_fifo_bounded_put(struct k_fifo_bounded *fifo, void *data)
+{
+	atomic_val_t head;
+
+	__ASSERT(data != NULL, "NULL marks free slots and cannot be queued");
+
+	do {
+		head = atomic_get(&fifo->put_head);
+		if ((uint32_t)(head - atomic_get(&fifo->get_tail)) >
+		    fifo->mask) {
+			return -ENOMEM;
+		}
+	} while (!atomic_cas(&fifo->put_head, head, head + 1));
+
+	atomic_ptr_set(&fifo->buf[(uint32_t)head & fifo->mask], data);
+
+	if (handle_poll_events(fifo)) {
+		z_reschedule_unlocked();
+	}
+
+	return 0;
+}
+
+static void *fifo_bounded_try_get(struct k_fifo_bounded *fifo)
+{
+	atomic_val_t tail = atomic_get(&fifo->get_tail);
+	atomic_ptr_t *slot;
+	void *data;
+
+	if (tail == atomic_get(&fifo->put_head)) {
+		return NULL;
+	}
+
+	slot = &fifo->buf[(uint32_t)tail & fifo->mask];
+	data = atomic_ptr_get(slot);
+	if (data == NULL) {
+		/* The slot is claimed by a producer but not published yet,
+		 * possibly for a long time if the producer was preempted
+		 * between its index claim and pointer store. Report empty:
+		 * k_fifo_bounded_is_empty() tests this same pointer, so
+		 * k_poll() keeps the consumer asleep instead of spinning
+		 * until the producer publishes and raises the poll event.
+		 */
+		return NULL;
+	}
+
+	/* Free the slot before making it available to producers again. */
+	atomic_ptr_clear(slot);
+	atomic_set(&fifo->get_tail, tail + 1);
+
+	return data;
+}
+
+void *k_fifo_bounded_get(struct k_fifo_bounded *fifo, k_timeout_t timeout)
+{
+	void *data = fifo_bounded_try_get(fifo);
+
+#ifdef CONFIG_POLL
+	if ((data == NULL) && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+			K_POLL_TYPE_FIFO_BOUNDED_DATA_AVAILABLE,
+			K_POLL_MODE_NOTIFY_ONLY, fifo);
+		k_timepoint_t end = sys_timepoint_calc(timeout);
+
+		__ASSERT(!arch_is_in_isr(), "cannot wait in ISR context");
+
+		do {
+			if (k_poll(&event, 1, sys_timepoint_timeout(end)) !=
+			    0) {
+				break;
+			}
+
+			event.state = K_POLL_STATE_NOT_READY;
+			data = fifo_bounded_try_get(fifo);
+		} while (data == NULL);
+	}
+#else
+	__ASSERT(K_TIMEOUT_EQ(timeout, K_NO_WAIT),
+		 "waiting requires CONFIG_POLL");
+	ARG_UNUSED(timeout);
+#endif /* CONFIG_POLL */
+
+	return data;
+}
@@ -16,14 +16,20 @@
 #define IPI_CPU_MASK(cpu_id)   \
 	(IS_ENABLED(CONFIG_IPI_OPTIMIZE) ? BIT(cpu_id) : IPI_ALL_CPUS_MASK)
 
+/* Reasons for a scheduler IPI, recorded per target CPU when
+ * CONFIG_IPI_OPTIMIZE is enabled so that the receiving CPU knows why it was
+ * interrupted without re-deriving it from scheduler state.
+ */
+#define IPI_CAUSE_RESCHED   BIT(0)
+#define IPI_CAUSE_TIMESLICE BIT(1)
 
 /* defined in ipi.c when CONFIG_SMP=y */
 #ifdef CONFIG_SMP
-void flag_ipi(uint32_t ipi_mask);
+void flag_ipi(uint32_t ipi_mask, uint32_t cause);
 void signal_pending_ipi(void);
 atomic_val_t ipi_mask_create(struct k_thread *thread);
 #else
-#define flag_ipi(ipi_mask) do { } while (false)
+#define flag_ipi(ipi_mask, cause) do { } while (false)
 #define signal_pending_ipi() do { } while (false)
 #endif /* CONFIG_SMP */
 
@@ -74,6 +74,15 @@ void z_thread_abort(struct k_thread *thread);
 void move_thread_to_end_of_prio_q(struct k_thread *thread);
 bool thread_is_sliceable(struct k_thread *thread);
 
+#ifdef CONFIG_TIMESLICE_ADAPTIVE
+void z_time_slice_thread_blocked(struct k_thread *thread);
+#else
+static inline void z_time_slice_thread_blocked(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+}
+#endif
+
 static inline void z_reschedule_unlocked(void)
 {
 	(void) z_reschedule_irqlock(arch_irq_lock());
@@ -323,9 +332,23 @@ int z_sched_waitq_walk(_wait_q_t *wait_q,
  * requires no other synchronization.  Architecture layers don't need
  * to do anything more.
  */
+#ifdef CONFIG_SCHED_THREAD_USAGE_SAMPLED
+/* In sampled mode the context switch hooks compile away; usage is
+ * accumulated by the periodic sampler in usage.c instead.
+ */
+static inline void z_sched_usage_stop(void)
+{
+}
+
+static inline void z_sched_usage_start(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+}
+#else
 void z_sched_usage_stop(void);
 
 void z_sched_usage_start(struct k_thread *thread);
+#endif /* CONFIG_SCHED_THREAD_USAGE_SAMPLED */
 
 /**
  * @brief Retrieves CPU cycle usage data for specified core
@@ -284,9 +284,7 @@ static ALWAYS_INLINE void z_priq_mq_init(struct _priq_mq *q)
 		sys_dlist_init(&q->queues[i]);
 	}
 
-#ifndef CONFIG_SMP
 	q->cached_queue_index = K_NUM_THREAD_PRIO - 1;
-#endif
 }
 
 static ALWAYS_INLINE void z_priq_mq_add(struct _priq_mq *pq,
@@ -297,11 +295,13 @@ static ALWAYS_INLINE void z_priq_mq_add(struct _priq_mq *pq,
 	sys_dlist_append(&pq->queues[pos.offset_prio], &thread->base.qnode_dlist);
 	pq->bitmask[pos.idx] |= BIT(pos.bit);
 
-#ifndef CONFIG_SMP
+	/* All run queue manipulation is serialized by the scheduler
+	 * spinlock (even on SMP), so the cached index can be kept
+	 * coherent without extra synchronization.
+	 */
 	if (pos.offset_prio < pq->cached_queue_index) {
 		pq->cached_queue_index = pos.offset_prio;
 	}
-#endif
 }
 
 static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq,
@@ -312,9 +312,7 @@ static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq,
 	sys_dlist_dequeue(&thread->base.qnode_dlist);
 	if (unlikely(sys_dlist_is_empty(&pq->queues[pos.offset_prio]))) {
 		pq->bitmask[pos.idx] &= ~BIT(pos.bit);
-#ifndef CONFIG_SMP
 		pq->cached_queue_index = z_priq_mq_best_queue_index(pq);
-#endif
 	}
 }
 
@@ -331,11 +329,7 @@ static ALWAYS_INLINE void z_priq_mq_yield(struct _priq_mq *pq)
 
 static ALWAYS_INLINE struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 {
-#ifdef CONFIG_SMP
-	unsigned int index = z_priq_mq_best_queue_index(pq);
-#else
 	unsigned int index = pq->cached_queue_index;
-#endif
 
 	sys_dnode_t *n = sys_dlist_peek_head(&pq->queues[index]);
 
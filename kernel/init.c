@@ -312,7 +312,13 @@ static int do_device_init(const struct device *dev)
 	int rc = 0;
 
 	if (dev->ops.init != NULL) {
+#ifdef CONFIG_DEVICE_INIT_ON_DEMAND
+		uint32_t start = k_cycle_get_32();
+#endif
 		rc = dev->ops.init(dev);
+#ifdef CONFIG_DEVICE_INIT_ON_DEMAND
+		dev->state->init_cycles = k_cycle_get_32() - start;
+#endif
 		/* Mark device initialized. If initialization
 		 * failed, record the error condition.
 		 */
@@ -337,6 +343,117 @@ static int do_device_init(const struct device *dev)
 	return rc;
 }
 
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+#include <zephyr/sys/thread_pool.h>
+
+K_THREAD_POOL_DEFINE(init_pool, CONFIG_DEVICE_INIT_PARALLEL_THREADS,
+		     CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE,
+		     CONFIG_MAIN_THREAD_PRIORITY);
+
+static K_SEM_DEFINE(init_done_sem, 0, K_SEM_MAX_LIMIT);
+
+/* Devices whose init function is currently running on a worker.  Only
+ * the boot thread writes a non-NULL value; workers clear their own
+ * slot when done, just before posting init_done_sem.
+ */
+static const struct device *init_in_flight[CONFIG_DEVICE_INIT_PARALLEL_THREADS];
+static uint32_t init_pending;
+
+static void parallel_init_job(void *p1, void *p2, void *p3)
+{
+	const struct init_entry *entry = p1;
+	uintptr_t slot = (uintptr_t)p2;
+	enum init_level level = (enum init_level)(uintptr_t)p3;
+	int result;
+
+	sys_trace_sys_init_enter(entry, level);
+	result = do_device_init(entry->dev);
+	sys_trace_sys_init_exit(entry, level, result);
+
+	init_in_flight[slot] = NULL;
+	k_sem_give(&init_done_sem);
+}
+
+static bool device_in_flight(const struct device *dev)
+{
+	for (int i = 0; i < CONFIG_DEVICE_INIT_PARALLEL_THREADS; i++) {
+		if (init_in_flight[i] == dev) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void parallel_init_wait_one(void)
+{
+	(void)k_sem_take(&init_done_sem, K_FOREVER);
+	init_pending--;
+}
+
+/* Wait for all outstanding init work.  Used at the end of a level and
+ * before SYS_INIT functions, which have no dependency information and
+ * therefore act as barriers.
+ */
+static void parallel_init_drain(void)
+{
+	while (init_pending > 0U) {
+		parallel_init_wait_one();
+	}
+}
+
+static void parallel_init_submit(const struct init_entry *entry,
+				 enum init_level level)
+{
+	const struct device *dev = entry->dev;
+	const device_handle_t *deps;
+	size_t ndeps = 0;
+	uintptr_t slot;
+
+	/* The linker orders init entries so that dependencies come
+	 * first: anything this device requires is already initialized,
+	 * still in flight from an earlier iteration, or handled at
+	 * another init level exactly as in the sequential scheme.
+	 */
+	deps = device_required_handles_get(dev, &ndeps);
+	for (size_t i = 0; (deps != NULL) && (i < ndeps); i++) {
+		const struct device *dep = device_from_handle(deps[i]);
+
+		while ((dep != NULL) && device_in_flight(dep)) {
+			parallel_init_wait_one();
+		}
+	}
+
+	if (init_pending == CONFIG_DEVICE_INIT_PARALLEL_THREADS) {
+		parallel_init_wait_one();
+	}
+
+	/* Workers clear their slot before posting the semaphore, so
+	 * having fewer pending jobs than workers guarantees a free slot.
+	 */
+	for (slot = 0; init_in_flight[slot] != NULL; slot++) {
+	}
+	init_in_flight[slot] = dev;
+
+	if (k_thread_pool_submit(&init_pool, parallel_init_job, (void *)entry,
+				 (void *)slot, (void *)(uintptr_t)level,
+				 K_NO_WAIT) == 0) {
+		init_pending++;
+	} else {
+		/* The pool brings itself up via SYS_INIT and is not
+		 * available until its own entry has run: initialize
+		 * sequentially until then.
+		 */
+		int result;
+
+		init_in_flight[slot] = NULL;
+		sys_trace_sys_init_enter(entry, level);
+		result = do_device_init(dev);
+		sys_trace_sys_init_exit(entry, level, result);
+	}
+}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -368,6 +485,19 @@ static void z_sys_init_run_level(enum init_level level)
 		const struct device *dev = entry->dev;
 		int result = 0;
 
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+		if (level >= INIT_LEVEL_POST_KERNEL) {
+			if ((dev != NULL) &&
+			    ((dev->flags & DEVICE_FLAG_INIT_DEFERRED) == 0U)) {
+				parallel_init_submit(entry, level);
+				continue;
+			}
+			if (dev == NULL) {
+				parallel_init_drain();
+			}
+		}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 		sys_trace_sys_init_enter(entry, level);
 		if (dev != NULL) {
 			if ((dev->flags & DEVICE_FLAG_INIT_DEFERRED) == 0U) {
@@ -378,6 +508,10 @@ static void z_sys_init_run_level(enum init_level level)
 		}
 		sys_trace_sys_init_exit(entry, level, result);
 	}
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+	parallel_init_drain();
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
 }
 
 
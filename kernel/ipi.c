@@ -13,12 +13,32 @@ extern void z_trace_sched_ipi(void);
 #endif
 
 
-void flag_ipi(uint32_t ipi_mask)
+void flag_ipi(uint32_t ipi_mask, uint32_t cause)
 {
 #if defined(CONFIG_SCHED_IPI_SUPPORTED)
 	if (arch_num_cpus() > 1) {
+#if defined(CONFIG_IPI_OPTIMIZE)
+		/* Record the cause on each target CPU before flagging the IPI
+		 * so that it is guaranteed to be visible to the handler. If
+		 * the interrupt has not been delivered yet, the new cause
+		 * simply coalesces into the one already pending.
+		 */
+		unsigned int num_cpus = (unsigned int)arch_num_cpus();
+
+		for (unsigned int i = 0; i < num_cpus; i++) {
+			if ((ipi_mask & BIT(i)) != 0) {
+				atomic_or(&_kernel.cpus[i].pending_ipi_causes,
+					  (atomic_val_t)cause);
+			}
+		}
+#else
+		ARG_UNUSED(cause);
+#endif /* CONFIG_IPI_OPTIMIZE */
 		atomic_or(&_kernel.pending_ipi, (atomic_val_t)ipi_mask);
 	}
+#else
+	ARG_UNUSED(ipi_mask);
+	ARG_UNUSED(cause);
 #endif /* CONFIG_SCHED_IPI_SUPPORTED */
 }
 
@@ -100,8 +120,16 @@ void z_sched_ipi(void)
 	z_trace_sched_ipi();
 #endif /* CONFIG_TRACE_SCHED_IPI */
 
+#if defined(CONFIG_IPI_OPTIMIZE)
+	uint32_t causes = (uint32_t)atomic_clear(&_current_cpu->pending_ipi_causes);
+#else
+	uint32_t causes = IPI_CAUSE_RESCHED | IPI_CAUSE_TIMESLICE;
+#endif /* CONFIG_IPI_OPTIMIZE */
+
+	ARG_UNUSED(causes);
+
 #ifdef CONFIG_TIMESLICING
-	if (thread_is_sliceable(_current)) {
+	if (((causes & IPI_CAUSE_TIMESLICE) != 0) && thread_is_sliceable(_current)) {
 		z_time_slice();
 	}
 #endif /* CONFIG_TIMESLICING */
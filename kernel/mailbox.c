@@ -234,6 +234,62 @@ static int mbox_message_put(struct k_mbox *mbox, struct k_mbox_msg *tx_msg,
 			/* take receiver out of rx queue */
 			z_unpend_thread(receiving_thread);
 
+#ifdef CONFIG_MBOX_DIRECT_COPY
+			/*
+			 * The receiver supplied a retrieval buffer when it
+			 * began waiting, so copy the message data straight
+			 * into it and complete the exchange here: the
+			 * receiver finds the data already delivered when it
+			 * wakes, and the sender does not pend waiting for
+			 * the receiver to consume the message.
+			 */
+			if ((rx_msg->_rx_buffer != NULL) &&
+			    (tx_msg->tx_data != NULL)) {
+				(void)memcpy(rx_msg->_rx_buffer,
+					     tx_msg->tx_data, rx_msg->size);
+
+				/* nothing left to retrieve or dispose of */
+				rx_msg->tx_data = NULL;
+				rx_msg->_syncing_thread = NULL;
+
+				/* update data size field for sender */
+				tx_msg->size = rx_msg->size;
+
+				/* ready receiver for execution */
+				arch_thread_return_value_set(receiving_thread, 0);
+				z_ready_thread(receiving_thread);
+
+				SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mbox, message_put, mbox,
+							       timeout, 0);
+
+#if (CONFIG_NUM_MBOX_ASYNC_MSGS > 0)
+				/*
+				 * asynchronous send: the message has been
+				 * consumed, so free the descriptor + dummy
+				 * thread pair right away (after dropping the
+				 * mailbox lock, as giving the semaphore may
+				 * reschedule)
+				 */
+				if ((sending_thread->base.thread_state &
+				     _THREAD_DUMMY) != 0U) {
+					struct k_sem *async_sem = tx_msg->_async_sem;
+
+					z_reschedule(&mbox->lock, key);
+					mbox_async_free(
+						(struct k_mbox_async *)sending_thread);
+					if (async_sem != NULL) {
+						k_sem_give(async_sem);
+					}
+					return 0;
+				}
+#endif /* CONFIG_NUM_MBOX_ASYNC_MSGS */
+
+				/* synchronous send: no need to pend */
+				z_reschedule(&mbox->lock, key);
+				return 0;
+			}
+#endif /* CONFIG_MBOX_DIRECT_COPY */
+
 			/* ready receiver for execution */
 			arch_thread_return_value_set(receiving_thread, 0);
 			z_ready_thread(receiving_thread);
@@ -425,6 +481,10 @@ int k_mbox_get(struct k_mbox *mbox, struct k_mbox_msg *rx_msg, void *buffer,
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mbox, get, mbox, timeout);
 
 	/* wait until a matching sender appears or a timeout occurs */
+#ifdef CONFIG_MBOX_DIRECT_COPY
+	/* let a matching sender copy its data directly into the buffer */
+	rx_msg->_rx_buffer = buffer;
+#endif /* CONFIG_MBOX_DIRECT_COPY */
 	_current->base.swap_data = rx_msg;
 	result = z_pend_curr(&mbox->lock, key, &mbox->rx_msg_queue, timeout);
 
@@ -179,6 +179,11 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->info.num_used = 0U;
 	slab->lock = (struct k_spinlock) {};
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	/* per-CPU caching is only available via K_MEM_SLAB_DEFINE_PERCPU() */
+	slab->percpu_cache = NULL;
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
+
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	slab->info.max_used = 0U;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
@@ -218,8 +223,69 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 	       ((offset % slab->info.block_size) == 0);
 }
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+/* The per-CPU caches are only ever touched from their owning CPU with
+ * interrupts masked, so the allocation side takes no spinlock.  Blocks
+ * held in a cache still count as allocated in slab->info.num_used.
+ */
+static void *percpu_cache_get(struct k_mem_slab *slab)
+{
+	void *mem = NULL;
+	unsigned int key = arch_irq_lock();
+	struct k_mem_slab_cpu_cache *cache =
+		&slab->percpu_cache->cpu[_current_cpu->id];
+
+	if (cache->count > 0U) {
+		mem = cache->blocks[--cache->count];
+	}
+	arch_irq_unlock(key);
+
+	return mem;
+}
+
+static bool percpu_cache_put(struct k_mem_slab *slab, void *mem)
+{
+	bool cached = false;
+	/* Threads pend on the wait queue under slab->lock, possibly from
+	 * another CPU, so the queue must be tested under that lock too: a
+	 * plain interrupt lock can read a stale empty queue, caching the
+	 * block while the waiter sleeps on.  The spinlock also masks
+	 * interrupts locally, preserving the cache access invariant.
+	 */
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	struct k_mem_slab_cpu_cache *cache =
+		&slab->percpu_cache->cpu[_current_cpu->id];
+
+	/* While threads are pended on the slab, blocks must go back
+	 * to the shared pool so their wakeup isn't deferred until
+	 * some later free takes the locked path.
+	 */
+	if ((cache->count < CONFIG_MEM_SLAB_PERCPU_CACHE_SIZE) &&
+	    (z_waitq_head(&slab->wait_q) == NULL)) {
+		cache->blocks[cache->count++] = mem;
+		cached = true;
+	}
+	k_spin_unlock(&slab->lock, key);
+
+	return cached;
+}
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
+
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	if (slab->percpu_cache != NULL) {
+		void *cached = percpu_cache_get(slab);
+
+		if (cached != NULL) {
+			SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+			*mem = cached;
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+			return 0;
+		}
+	}
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 	int result;
 
@@ -275,6 +341,14 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 		return;
 	}
 
+#ifdef CONFIG_MEM_SLAB_PERCPU_CACHE
+	if ((slab->percpu_cache != NULL) && percpu_cache_put(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+		return;
+	}
+#endif /* CONFIG_MEM_SLAB_PERCPU_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
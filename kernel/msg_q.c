@@ -66,6 +66,152 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	k_object_init(msgq);
 }
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+/* Bounded lock-free MPSC ring (sequence-stamped slots, after Vyukov).
+ * A slot whose sequence equals the enqueue cursor is free; equal to
+ * cursor + 1 it holds a message.  Producers claim a slot by advancing
+ * enq_pos with a CAS, copy the payload, then publish by bumping the
+ * slot sequence, so the queue spinlock is never taken on the put path.
+ */
+struct msgq_lf_slot {
+	atomic_t seq;
+	char data[];
+};
+
+#define MSGQ_LF_STRIDE(msg_size) \
+	(sizeof(atomic_t) + ROUND_UP(msg_size, sizeof(atomic_t)))
+
+static inline struct msgq_lf_slot *lf_slot(struct k_msgq *msgq, uint32_t idx)
+{
+	return (struct msgq_lf_slot *)(msgq->buffer_start +
+				       (size_t)idx * MSGQ_LF_STRIDE(msgq->msg_size));
+}
+
+void k_msgq_lockfree_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
+			  uint32_t max_msgs)
+{
+	__ASSERT((max_msgs != 0U) && ((max_msgs & (max_msgs - 1U)) == 0U),
+		 "max_msgs must be a power of two");
+	__ASSERT(((uintptr_t)buffer % sizeof(atomic_t)) == 0U,
+		 "buffer must be atomic-word aligned");
+
+	k_msgq_init(msgq, buffer, msg_size, max_msgs);
+	msgq->buffer_end = buffer + (max_msgs * MSGQ_LF_STRIDE(msg_size));
+	msgq->flags |= K_MSGQ_FLAG_LOCKFREE;
+	atomic_set(&msgq->enq_pos, 0);
+	atomic_set(&msgq->deq_pos, 0);
+	atomic_set(&msgq->consumer_waiting, 0);
+
+	for (uint32_t i = 0; i < max_msgs; i++) {
+		atomic_set(&lf_slot(msgq, i)->seq, i);
+	}
+}
+
+static int lf_put(struct k_msgq *msgq, const void *data)
+{
+	uint32_t mask = msgq->max_msgs - 1U;
+	atomic_val_t pos = atomic_get(&msgq->enq_pos);
+
+	for (;;) {
+		struct msgq_lf_slot *slot = lf_slot(msgq, (uint32_t)pos & mask);
+		intptr_t dif = (intptr_t)atomic_get(&slot->seq) - (intptr_t)pos;
+
+		if (dif == 0) {
+			if (atomic_cas(&msgq->enq_pos, pos, pos + 1)) {
+				(void)memcpy(slot->data, data, msgq->msg_size);
+				/* publish the message */
+				atomic_set(&slot->seq, pos + 1);
+				break;
+			}
+		} else if (dif < 0) {
+			return -ENOMSG;
+		}
+		pos = atomic_get(&msgq->enq_pos);
+	}
+
+	/* Wake the consumer if it pended after seeing the ring empty.
+	 * Both sides use sequentially consistent atomics: the consumer
+	 * sets consumer_waiting before re-checking the ring, we read it
+	 * after publishing, so one of the two always notices the other.
+	 */
+	if (atomic_get(&msgq->consumer_waiting) != 0) {
+		k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+		struct k_thread *pending_thread = z_unpend_first_thread(&msgq->wait_q);
+
+		if (pending_thread != NULL) {
+			atomic_set(&msgq->consumer_waiting, 0);
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			z_reschedule(&msgq->lock, key);
+		} else {
+			k_spin_unlock(&msgq->lock, key);
+		}
+	}
+
+	return 0;
+}
+
+static int lf_get(struct k_msgq *msgq, void *data)
+{
+	uint32_t mask = msgq->max_msgs - 1U;
+	atomic_val_t pos = atomic_get(&msgq->deq_pos);
+
+	for (;;) {
+		struct msgq_lf_slot *slot = lf_slot(msgq, (uint32_t)pos & mask);
+		intptr_t dif = (intptr_t)atomic_get(&slot->seq) - (intptr_t)(pos + 1);
+
+		if (dif == 0) {
+			if (atomic_cas(&msgq->deq_pos, pos, pos + 1)) {
+				(void)memcpy(data, slot->data, msgq->msg_size);
+				/* mark the slot free for the next lap */
+				atomic_set(&slot->seq, pos + mask + 1);
+				return 0;
+			}
+		} else if (dif < 0) {
+			return -ENOMSG;
+		}
+		pos = atomic_get(&msgq->deq_pos);
+	}
+}
+
+static int lf_get_blocking(struct k_msgq *msgq, void *data, k_timeout_t timeout)
+{
+	int result;
+
+	for (;;) {
+		result = lf_get(msgq, data);
+		if ((result == 0) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			break;
+		}
+
+		k_spinlock_key_t key = k_spin_lock(&msgq->lock);
+
+		atomic_set(&msgq->consumer_waiting, 1);
+		/* Re-check after announcing the wait so a message
+		 * published just before the flag was set is not missed.
+		 */
+		if (lf_get(msgq, data) == 0) {
+			atomic_set(&msgq->consumer_waiting, 0);
+			k_spin_unlock(&msgq->lock, key);
+			result = 0;
+			break;
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if (result != 0) {
+			/* timed out */
+			atomic_set(&msgq->consumer_waiting, 0);
+			break;
+		}
+		/* woken by a producer: retry the dequeue */
+	}
+
+	return result;
+}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 int z_impl_k_msgq_alloc_init(struct k_msgq *msgq, size_t msg_size,
 			    uint32_t max_msgs)
 {
@@ -134,6 +280,16 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 	int result;
 	bool resched = false;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if ((msgq->flags & K_MSGQ_FLAG_LOCKFREE) != 0U) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
+		/* producers never block in lock-free mode */
+		result = lf_put(msgq, data);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
+		return result;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
@@ -226,6 +382,15 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 	int result;
 	bool resched = false;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if ((msgq->flags & K_MSGQ_FLAG_LOCKFREE) != 0U) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
+		result = lf_get_blocking(msgq, data, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
+		return result;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
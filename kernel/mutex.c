@@ -102,6 +102,49 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+static bool thread_is_running(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (_kernel.cpus[i].current == thread) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Poll the mutex while its owner is making progress on another CPU:
+ * for critical sections shorter than a pair of context switches this
+ * is cheaper than pending. Called with the lock held, drops and
+ * retakes it around each poll. Returns true with the lock held and
+ * the mutex free if it was released while spinning. Ownership handed
+ * directly to a pended waiter by k_mutex_unlock() leaves lock_count
+ * set, so a spinning thread cannot overtake threads already in the
+ * wait queue.
+ */
+static bool adaptive_spin(struct k_mutex *mutex, k_spinlock_key_t *key)
+{
+	for (uint32_t i = 0; i < CONFIG_MUTEX_ADAPTIVE_SPIN_COUNT; i++) {
+		if (mutex->lock_count == 0U) {
+			return true;
+		}
+
+		if (!thread_is_running(mutex->owner)) {
+			break;
+		}
+
+		k_spin_unlock(&lock, *key);
+		arch_spin_relax();
+		*key = k_spin_lock(&lock);
+	}
+
+	return false;
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
@@ -142,6 +185,24 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		return -EBUSY;
 	}
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	if (adaptive_spin(mutex, &key)) {
+		mutex->owner_orig_prio = _current->base.prio;
+		mutex->lock_count++;
+		mutex->owner = _current;
+
+		LOG_DBG("%p took mutex %p after spinning, count: %d, orig prio: %d",
+			_current, mutex, mutex->lock_count,
+			mutex->owner_orig_prio);
+
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
+
+		return 0;
+	}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
 
 	new_prio = new_prio_for_inheritance(_current->base.prio,
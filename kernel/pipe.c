@@ -270,6 +270,87 @@ exit:
 	return rc;
 }
 
+int k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	int rc;
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+	} else if (unlikely(pipe_closed(pipe))) {
+		rc = -EPIPE;
+	} else {
+		rc = ring_buf_put_claim(&pipe->buf, data, size);
+	}
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return rc;
+}
+
+int k_pipe_write_finish(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+	int rc;
+
+	rc = ring_buf_put_finish(&pipe->buf, size);
+	if (rc == 0 && size > 0) {
+		need_resched = z_sched_wake_all(&pipe->data, 0, NULL);
+#ifdef CONFIG_POLL
+		need_resched |= z_handle_obj_poll_events(&pipe->poll_events,
+							 K_POLL_STATE_PIPE_DATA_AVAILABLE);
+#endif /* CONFIG_POLL */
+	}
+
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return rc;
+}
+
+int k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	int rc;
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+	} else {
+		rc = ring_buf_get_claim(&pipe->buf, data, size);
+		if (rc == 0 && unlikely(pipe_closed(pipe))) {
+			rc = -EPIPE;
+		}
+	}
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return rc;
+}
+
+int k_pipe_read_finish(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+	int rc;
+
+	rc = ring_buf_get_finish(&pipe->buf, size);
+	if (rc == 0 && size > 0) {
+		need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
+	}
+
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return rc;
+}
+
 void z_impl_k_pipe_reset(struct k_pipe *pipe)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, reset, pipe);
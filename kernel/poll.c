@@ -97,6 +97,12 @@ static inline bool is_condition_met(struct k_poll_event *event, uint32_t *state)
 			return true;
 		}
 		break;
+	case K_POLL_TYPE_FIFO_BOUNDED_DATA_AVAILABLE:
+		if (!k_fifo_bounded_is_empty(event->fifo_bounded)) {
+			*state = K_POLL_STATE_FIFO_BOUNDED_DATA_AVAILABLE;
+			return true;
+		}
+		break;
 	case K_POLL_TYPE_IGNORE:
 		break;
 	default:
@@ -161,6 +167,10 @@ static inline void register_event(struct k_poll_event *event,
 		__ASSERT(event->pipe != NULL, "invalid pipe\n");
 		add_event(&event->pipe->poll_events, event, poller);
 		break;
+	case K_POLL_TYPE_FIFO_BOUNDED_DATA_AVAILABLE:
+		__ASSERT(event->fifo_bounded != NULL, "invalid bounded FIFO\n");
+		add_event(&event->fifo_bounded->poll_events, event, poller);
+		break;
 	case K_POLL_TYPE_IGNORE:
 		/* nothing to do */
 		break;
@@ -200,6 +210,10 @@ static inline void clear_event_registration(struct k_poll_event *event)
 		__ASSERT(event->pipe != NULL, "invalid pipe\n");
 		remove_event = true;
 		break;
+	case K_POLL_TYPE_FIFO_BOUNDED_DATA_AVAILABLE:
+		__ASSERT(event->fifo_bounded != NULL, "invalid bounded FIFO\n");
+		remove_event = true;
+		break;
 	case K_POLL_TYPE_IGNORE:
 		/* nothing to do */
 		break;
@@ -434,6 +448,83 @@ oops_free:
 #include <zephyr/syscalls/k_poll_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+void k_poll_set_init(struct k_poll_set *set, struct k_poll_event *events,
+		     int num_events)
+{
+	__ASSERT(events != NULL, "NULL events\n");
+	__ASSERT(num_events >= 0, "<0 events\n");
+
+	set->events = events;
+	set->num_events = num_events;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, k_timeout_t timeout)
+{
+	struct z_poller *poller = &_current->poller;
+	k_spinlock_key_t key;
+	bool ready = false;
+
+	__ASSERT(!arch_is_in_isr(), "");
+
+	poller->is_polling = true;
+	poller->mode = MODE_POLL;
+
+	/* Unlike register_events(), the whole scan runs under one lock
+	 * acquisition: no event can fire in between, and events that are
+	 * still registered from an earlier wait need no work at all.
+	 */
+	key = k_spin_lock(&lock);
+
+	for (int ii = 0; ii < set->num_events; ii++) {
+		struct k_poll_event *event = &set->events[ii];
+		uint32_t state;
+
+		if (is_condition_met(event, &state)) {
+			set_event_ready(event, state);
+			/* A ready event may not linger on the object's wait
+			 * list without a poller, or it would swallow the
+			 * wakeup of a later waiter.
+			 */
+			if (sys_dnode_is_linked(&event->_node)) {
+				sys_dlist_remove(&event->_node);
+			}
+			ready = true;
+		} else if (event->poller == NULL) {
+			/* First wait, or the registration was consumed when
+			 * the event fired; (re-)arm it.
+			 */
+			register_event(event, poller);
+		} else {
+			/* Still registered from an earlier wait */
+			;
+		}
+	}
+
+	poller->is_polling = false;
+
+	if (ready) {
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&lock, key);
+		return -EAGAIN;
+	}
+
+	static _wait_q_t wait_q = Z_WAIT_Q_INIT(&wait_q);
+
+	return z_pend_curr(&lock, key, &wait_q, timeout);
+}
+
+void k_poll_set_deinit(struct k_poll_set *set)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	clear_event_registrations(set->events, set->num_events, key);
+	k_spin_unlock(&lock, key);
+}
+
 /* must be called with interrupts locked */
 static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 {
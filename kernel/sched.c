@@ -59,6 +59,13 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
 	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_PER_CPU_RUNQ)
+	/* Queue threads on the CPU they last ran on.  base.cpu is
+	 * only written when a thread becomes _current (at which point
+	 * it is not queued), so it is stable for as long as the
+	 * thread sits in a run queue.
+	 */
+	return &_kernel.cpus[thread->base.cpu].ready_q.runq;
 #else
 	ARG_UNUSED(thread);
 	return &_kernel.ready_q.runq;
@@ -67,7 +74,7 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
@@ -93,9 +100,44 @@ static ALWAYS_INLINE void runq_yield(void)
 	_priq_run_yield(curr_cpu_runq());
 }
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+/* Called with the scheduler lock held when the local run queue is
+ * empty.  Returns the best runnable thread found on a sibling CPU's
+ * queue, or NULL.  The caller removes it with dequeue_thread(), which
+ * resolves the home queue through thread_runq().
+ */
+static struct k_thread *runq_steal(void)
+{
+	struct k_thread *best = NULL;
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (i == _current_cpu->id) {
+			continue;
+		}
+
+		struct k_thread *thread =
+			_priq_run_best(&_kernel.cpus[i].ready_q.runq);
+
+		if ((thread != NULL) &&
+		    ((best == NULL) || (z_sched_prio_cmp(thread, best) > 0))) {
+			best = thread;
+		}
+	}
+	return best;
+}
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
-	return _priq_run_best(curr_cpu_runq());
+	struct k_thread *thread = _priq_run_best(curr_cpu_runq());
+
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	if (thread == NULL) {
+		thread = runq_steal();
+	}
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+	return thread;
 }
 
 /* _current is never in the run queue until context switch on
@@ -350,7 +392,7 @@ static void ready_thread(struct k_thread *thread)
 		queue_thread(thread);
 		update_cache(0);
 
-		flag_ipi(ipi_mask_create(thread));
+		flag_ipi(ipi_mask_create(thread), IPI_CAUSE_RESCHED);
 	}
 }
 
@@ -526,6 +568,7 @@ static void unready_thread(struct k_thread *thread)
 	if (z_is_thread_queued(thread)) {
 		dequeue_thread(thread);
 	}
+	z_time_slice_thread_blocked(thread);
 	update_cache(thread == _current);
 }
 
@@ -678,7 +721,7 @@ bool z_thread_prio_set(struct k_thread *thread, int prio)
 				queue_thread(thread);
 
 				if (old_prio > prio) {
-					flag_ipi(ipi_mask_create(thread));
+					flag_ipi(ipi_mask_create(thread), IPI_CAUSE_RESCHED);
 				}
 			} else {
 				/*
@@ -694,7 +737,7 @@ bool z_thread_prio_set(struct k_thread *thread, int prio)
 
 				cpu = thread_active_elsewhere(thread);
 				if ((cpu != NULL) && (old_prio < prio)) {
-					flag_ipi(IPI_CPU_MASK(cpu->id));
+					flag_ipi(IPI_CPU_MASK(cpu->id), IPI_CAUSE_RESCHED);
 				}
 			}
 
@@ -902,7 +945,7 @@ void *z_get_next_switch_handle(void *interrupted)
 #ifdef CONFIG_SCHED_IPI_CASCADE
 				if ((new_thread->base.cpu_mask != -1) &&
 				    (old_thread->base.cpu_mask != BIT(cpu_id))) {
-					flag_ipi(ipi_mask_create(old_thread));
+					flag_ipi(ipi_mask_create(old_thread), IPI_CAUSE_RESCHED);
 				}
 #endif
 				runq_add(old_thread);
@@ -947,7 +990,7 @@ void init_ready_q(struct _ready_q *ready_q)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <string.h>
+
+#include <kernel_internal.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/llext/symbol.h>
+#include <zephyr/sys/atomic.h>
+
+/* Statistics are collected separately for each CPU, so that the profiling
+ * writes do not bounce cache lines between CPUs and distort the very
+ * contention they are supposed to measure. All updates happen with the
+ * profiled lock held (and interrupts masked), so plain accesses suffice.
+ */
+struct z_spin_lock_profile_percpu {
+	uint64_t count;
+	uint64_t spin_cycles;
+	uint64_t hold_cycles;
+	uint32_t max_hold_cycles;
+};
+
+struct z_spin_lock_profile_entry {
+	atomic_ptr_t lock;
+	struct z_spin_lock_profile_percpu cpu[CONFIG_MP_MAX_NUM_CPUS];
+};
+
+static struct z_spin_lock_profile_entry entries[CONFIG_SPIN_LOCK_PROFILE_MAX_LOCKS];
+
+/* Sentinel assigned to locks that could not get a table slot, so that the
+ * full table is not rescanned on their every acquisition.
+ */
+static struct z_spin_lock_profile_entry overflow;
+
+static struct z_spin_lock_profile_entry *entry_claim(struct k_spinlock *l)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(entries); i++) {
+		if (atomic_ptr_cas(&entries[i].lock, NULL, l)) {
+			return &entries[i];
+		}
+	}
+
+	return &overflow;
+}
+
+void z_spin_lock_profile_acquire(struct k_spinlock *l, uint32_t spin_cycles)
+{
+	struct z_spin_lock_profile_entry *entry = l->profile;
+
+	if (entry == NULL) {
+		/* First acquisition of this lock. We hold the lock, so no
+		 * other CPU can race with us for the slot assignment.
+		 */
+		entry = entry_claim(l);
+		l->profile = entry;
+	}
+
+	if (entry == &overflow) {
+		return;
+	}
+
+	struct z_spin_lock_profile_percpu *stats = &entry->cpu[_current_cpu->id];
+
+	stats->count++;
+	stats->spin_cycles += spin_cycles;
+
+	l->acquire_time = sys_clock_cycle_get_32();
+}
+EXPORT_SYMBOL(z_spin_lock_profile_acquire);
+
+void z_spin_lock_profile_release(struct k_spinlock *l)
+{
+	struct z_spin_lock_profile_entry *entry = l->profile;
+
+	if ((entry == NULL) || (entry == &overflow)) {
+		return;
+	}
+
+	struct z_spin_lock_profile_percpu *stats = &entry->cpu[_current_cpu->id];
+	uint32_t hold_cycles = sys_clock_cycle_get_32() - l->acquire_time;
+
+	stats->hold_cycles += hold_cycles;
+	if (hold_cycles > stats->max_hold_cycles) {
+		stats->max_hold_cycles = hold_cycles;
+	}
+}
+EXPORT_SYMBOL(z_spin_lock_profile_release);
+
+int k_spin_lock_profile_stats_get(size_t index, struct k_spinlock **lock,
+				  struct k_spin_lock_profile_stats *stats)
+{
+	if (index >= ARRAY_SIZE(entries)) {
+		return -EINVAL;
+	}
+
+	struct z_spin_lock_profile_entry *entry = &entries[index];
+	struct k_spinlock *l = atomic_ptr_get(&entry->lock);
+
+	if (l == NULL) {
+		return -ENOENT;
+	}
+
+	*lock = l;
+	memset(stats, 0, sizeof(*stats));
+
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		stats->count += entry->cpu[i].count;
+		stats->spin_cycles += entry->cpu[i].spin_cycles;
+		stats->hold_cycles += entry->cpu[i].hold_cycles;
+		stats->max_hold_cycles = MAX(stats->max_hold_cycles,
+					     entry->cpu[i].max_hold_cycles);
+	}
+
+	return 0;
+}
+
+void k_spin_lock_profile_reset(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(entries); i++) {
+		/* Best effort: counters of locks held during the reset may
+		 * keep a partial update, which is acceptable for a profiler.
+		 */
+		memset(entries[i].cpu, 0, sizeof(entries[i].cpu));
+	}
+}
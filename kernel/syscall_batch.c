@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/syscall_batch.h>
+#include <zephyr/internal/syscall_handler.h>
+
+int z_impl_k_syscall_batch(struct k_syscall_batch_op *ops, size_t num_ops)
+{
+	ARG_UNUSED(ops);
+	ARG_UNUSED(num_ops);
+
+	/* There is no marshaling layer to go through in supervisor mode,
+	 * kernel threads invoke kernel APIs directly.
+	 */
+	return -ENOTSUP;
+}
+
+static inline int z_vrfy_k_syscall_batch(struct k_syscall_batch_op *ops,
+					 size_t num_ops)
+{
+	struct k_syscall_batch_op batch[CONFIG_SYSCALL_BATCH_MAX_OPS];
+	void *ssf = _current->syscall_frame;
+
+	if ((num_ops == 0) || (num_ops > ARRAY_SIZE(batch))) {
+		return -EINVAL;
+	}
+
+	K_OOPS(k_usermode_from_copy(batch, ops, num_ops * sizeof(batch[0])));
+
+	/* Validate all IDs up front so that a bad batch fails without
+	 * side effects. Nesting batches is disallowed to bound privilege
+	 * stack usage.
+	 */
+	for (size_t i = 0; i < num_ops; i++) {
+		uint32_t call_id = batch[i].call_id;
+
+		if ((call_id >= K_SYSCALL_LIMIT) || (call_id == K_SYSCALL_BAD) ||
+		    (call_id == K_SYSCALL_K_SYSCALL_BATCH)) {
+			return -ENOSYS;
+		}
+	}
+
+	for (size_t i = 0; i < num_ops; i++) {
+		struct k_syscall_batch_op *op = &batch[i];
+
+		/* The marshal functions perform the same argument and
+		 * object validation as an individual syscall would, and
+		 * oops the caller on failure just the same.
+		 */
+		op->result = _k_syscall_table[op->call_id](op->args[0], op->args[1],
+							   op->args[2], op->args[3],
+							   op->args[4], op->args[5],
+							   ssf);
+
+		/* The nested marshal function cleared the syscall frame
+		 * on its way out; restore it so that subsequent operations
+		 * and our own marshal epilogue see consistent state.
+		 */
+		_current->syscall_frame = ssf;
+	}
+
+	K_OOPS(k_usermode_to_copy(ops, batch, num_ops * sizeof(batch[0])));
+
+	return 0;
+}
+#include <zephyr/syscalls/k_syscall_batch_mrsh.c>
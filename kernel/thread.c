@@ -547,6 +547,11 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 	z_init_thread_base(&new_thread->base, prio, _THREAD_SLEEPING, options);
 	stack_ptr = setup_thread_stack(new_thread, stack, stack_size);
 
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+	/* Nothing scanned yet, the whole stack buffer may be unused */
+	new_thread->stack_unused = new_thread->stack_info.size;
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
 #ifdef CONFIG_KERNEL_COHERENCE
 	/* Check that the thread object is safe, but that the stack is
 	 * still cached!
@@ -754,6 +759,13 @@ void z_init_thread_base(struct _thread_base *thread_base, int priority,
 
 #ifdef CONFIG_SMP
 	thread_base->is_idle = 0;
+
+	/* The thread has not run anywhere yet, but thread_runq() indexes
+	 * _kernel.cpus[] with this before the first run when
+	 * CONFIG_SCHED_PER_CPU_RUNQ is enabled, so it must not hold
+	 * stack garbage from a recycled thread object.
+	 */
+	thread_base->cpu = 0;
 #endif /* CONFIG_SMP */
 
 #ifdef CONFIG_TIMESLICE_PER_THREAD
@@ -857,14 +869,37 @@ int z_stack_space_get(const uint8_t *stack_start, size_t size, size_t *unused_pt
 int z_impl_k_thread_stack_space_get(const struct k_thread *thread,
 				    size_t *unused_ptr)
 {
+	size_t size = thread->stack_info.size;
+	int ret;
+
 #ifdef CONFIG_THREAD_STACK_MEM_MAPPED
 	if (thread->stack_info.mapped.addr == NULL) {
 		return -EINVAL;
 	}
 #endif /* CONFIG_THREAD_STACK_MEM_MAPPED */
 
-	return z_stack_space_get((const uint8_t *)thread->stack_info.start,
-				 thread->stack_info.size, unused_ptr);
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+	/* Stack usage can only grow and painted memory is never restored,
+	 * so the unused byte count from the previous query bounds how far
+	 * the painted region can extend now. It is sufficient to rescan
+	 * just that much of the stack buffer.
+	 */
+	if (thread->stack_unused < size) {
+		size = thread->stack_unused +
+		       (IS_ENABLED(CONFIG_STACK_SENTINEL) ? 4 : 0);
+	}
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
+	ret = z_stack_space_get((const uint8_t *)thread->stack_info.start,
+				size, unused_ptr);
+
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+	if (ret == 0) {
+		((struct k_thread *)thread)->stack_unused = *unused_ptr;
+	}
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
+	return ret;
 }
 
 #ifdef CONFIG_USERSPACE
@@ -1136,6 +1171,9 @@ void z_dummy_thread_init(struct k_thread *dummy_thread)
 	dummy_thread->stack_info.start = 0U;
 	dummy_thread->stack_info.size = 0U;
 #endif /* CONFIG_THREAD_STACK_INFO */
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+	dummy_thread->stack_unused = 0U;
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
 #ifdef CONFIG_USERSPACE
 	dummy_thread->mem_domain_info.mem_domain = &k_mem_domain_default;
 #endif /* CONFIG_USERSPACE */
@@ -16,6 +16,16 @@ static uint64_t curr_tick;
 
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
 
+/* Sum of all deltas in timeout_list, i.e. the expiry offset of the last
+ * entry relative to curr_tick.  Must mirror every dticks mutation of
+ * linked timeouts.  It allows z_add_timeout() to append a timeout that
+ * expires at or after everything already queued in O(1) instead of
+ * walking the whole list, which is the common case when many timeouts
+ * of similar duration (e.g. protocol retransmit or supervision timers)
+ * are active at once.
+ */
+static int64_t timeout_list_span;
+
 /*
  * The timeout code shall take no locks other than its own (timeout_lock), nor
  * shall it call any other subsystem while holding this lock.
@@ -40,6 +50,55 @@ static inline unsigned int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_SYS_CLOCK_UPTIME_FASTPATH
+#include <zephyr/app_memory/app_memdomain.h>
+#include <zephyr/sys/barrier.h>
+
+K_APPMEM_PARTITION_DEFINE(z_uptime_partition);
+
+/* Seqlock-protected time anchor exported to user mode: uptime in ticks
+ * paired with the cycle count at which it was taken.  Written under
+ * timeout_lock each time curr_tick advances; read lock-free by
+ * k_uptime_ticks_fast() from threads granted z_uptime_partition.
+ */
+static K_APP_DMEM(z_uptime_partition) struct {
+	uint32_t seq;
+	uint32_t cycles;
+	uint64_t ticks;
+} uptime_anchor;
+
+/* Must be called with timeout_lock held */
+static void uptime_anchor_update(void)
+{
+	uptime_anchor.seq++;
+	barrier_dmem_fence_full();
+	uptime_anchor.cycles = k_cycle_get_32();
+	uptime_anchor.ticks = curr_tick;
+	barrier_dmem_fence_full();
+	uptime_anchor.seq++;
+}
+
+int64_t k_uptime_ticks_fast(void)
+{
+	uint32_t seq, cycles;
+	uint64_t ticks;
+
+	do {
+		seq = uptime_anchor.seq;
+		barrier_dmem_fence_full();
+		cycles = uptime_anchor.cycles;
+		ticks = uptime_anchor.ticks;
+		barrier_dmem_fence_full();
+	} while (((seq & 1U) != 0U) || (seq != uptime_anchor.seq));
+
+	return ticks + k_cyc_to_ticks_floor64((uint32_t)(k_cycle_get_32() - cycles));
+}
+#else
+static inline void uptime_anchor_update(void)
+{
+}
+#endif /* CONFIG_SYS_CLOCK_UPTIME_FASTPATH */
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -58,6 +117,8 @@ static void remove_timeout(struct _timeout *t)
 {
 	if (next(t) != NULL) {
 		next(t)->dticks += t->dticks;
+	} else {
+		timeout_list_span -= t->dticks;
 	}
 
 	sys_dlist_remove(&t->node);
@@ -131,17 +192,29 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 			ticks = timeout.ticks;
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
+		if (to->dticks >= timeout_list_span) {
+			/* Expires at or after every queued timeout
+			 * (including the empty list case): append
+			 * directly, no list walk needed.  Ties keep
+			 * the same FIFO ordering the walk produces.
+			 */
+			to->dticks -= timeout_list_span;
+			timeout_list_span += to->dticks;
+			sys_dlist_append(&timeout_list, &to->node);
+		} else {
+			for (t = first(); t != NULL; t = next(t)) {
+				if (t->dticks > to->dticks) {
+					t->dticks -= to->dticks;
+					sys_dlist_insert(&t->node, &to->node);
+					break;
+				}
+				to->dticks -= t->dticks;
 			}
-			to->dticks -= t->dticks;
-		}
 
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
+			if (t == NULL) {
+				timeout_list_span += to->dticks;
+				sys_dlist_append(&timeout_list, &to->node);
+			}
 		}
 
 		if (to == first() && announce_remaining == 0) {
@@ -257,6 +330,7 @@ void sys_clock_announce(int32_t ticks)
 
 		curr_tick += dt;
 		t->dticks = 0;
+		timeout_list_span -= dt;
 		remove_timeout(t);
 
 		k_spin_unlock(&timeout_lock, key);
@@ -267,11 +341,14 @@ void sys_clock_announce(int32_t ticks)
 
 	if (t != NULL) {
 		t->dticks -= announce_remaining;
+		timeout_list_span -= announce_remaining;
 	}
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
 
+	uptime_anchor_update();
+
 	sys_clock_set_timeout(next_timeout(0), false);
 
 	k_spin_unlock(&timeout_lock, key);
@@ -13,6 +13,16 @@ static int slice_max_prio = CONFIG_TIMESLICE_PRIORITY;
 static struct _timeout slice_timeouts[CONFIG_MP_MAX_NUM_CPUS];
 static bool slice_expired[CONFIG_MP_MAX_NUM_CPUS];
 
+#ifdef CONFIG_TIMESLICE_ADAPTIVE
+/* Each point of slice_score doubles the slice, so anything beyond the
+ * width of the tick counter is moot.  Capping well below that keeps the
+ * shift in slice_time() from overflowing.
+ */
+#define SLICE_SCORE_MAX 7
+
+static int slice_max_ticks = DIV_ROUND_UP(CONFIG_TIMESLICE_ADAPTIVE_MAX * Z_HZ_ticks, Z_HZ_ms);
+#endif
+
 #ifdef CONFIG_SWAP_NONATOMIC
 /* If z_swap() isn't atomic, then it's possible for a timer interrupt
  * to try to timeslice away _current after it has already pended
@@ -28,9 +38,17 @@ static inline int slice_time(struct k_thread *thread)
 
 #ifdef CONFIG_TIMESLICE_PER_THREAD
 	if (thread->base.slice_ticks != 0) {
-		ret = thread->base.slice_ticks;
+		return thread->base.slice_ticks;
+	}
+#endif
+
+#ifdef CONFIG_TIMESLICE_ADAPTIVE
+	if (ret != 0) {
+		ret = MIN(ret << thread->base.slice_score, slice_max_ticks);
 	}
-#else
+#endif
+
+#if !defined(CONFIG_TIMESLICE_PER_THREAD) && !defined(CONFIG_TIMESLICE_ADAPTIVE)
 	ARG_UNUSED(thread);
 #endif
 	return ret;
@@ -61,7 +79,7 @@ static void slice_timeout(struct _timeout *timeout)
 	 * for a different CPU.
 	 */
 	if (cpu != _current_cpu->id) {
-		flag_ipi(IPI_CPU_MASK(cpu));
+		flag_ipi(IPI_CPU_MASK(cpu), IPI_CAUSE_TIMESLICE);
 	}
 }
 
@@ -99,6 +117,22 @@ void k_thread_time_slice_set(struct k_thread *thread, int32_t thread_slice_ticks
 }
 #endif
 
+#ifdef CONFIG_TIMESLICE_ADAPTIVE
+void z_time_slice_thread_blocked(struct k_thread *thread)
+{
+	/* A thread unreadied while its slice had already run out isn't
+	 * blocking voluntarily; don't credit it for that.
+	 */
+	if (thread == _current && slice_expired[_current_cpu->id]) {
+		return;
+	}
+
+	if (thread->base.slice_score > 0) {
+		thread->base.slice_score--;
+	}
+}
+#endif
+
 /* Called out of each timer interrupt */
 void z_time_slice(void)
 {
@@ -121,6 +155,14 @@ void z_time_slice(void)
 			curr->base.slice_expired(curr, curr->base.slice_data);
 			key = k_spin_lock(&_sched_spinlock);
 		}
+#endif
+#ifdef CONFIG_TIMESLICE_ADAPTIVE
+		/* Burned through the whole slice without blocking: this
+		 * looks like a batch thread, so grow its next slice.
+		 */
+		if (curr->base.slice_score < SLICE_SCORE_MAX) {
+			curr->base.slice_score++;
+		}
 #endif
 		if (!z_is_thread_prevented_from_running(curr)) {
 			move_thread_to_end_of_prio_q(curr);
@@ -6,13 +6,15 @@
 
 #include <zephyr/kernel.h>
 
+#include <zephyr/init.h>
 #include <zephyr/timing/timing.h>
 #include <ksched.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/check.h>
 
 /* Need one of these for this to work */
-#if !defined(CONFIG_USE_SWITCH) && !defined(CONFIG_INSTRUMENT_THREAD_SWITCHING)
+#if !defined(CONFIG_USE_SWITCH) && !defined(CONFIG_INSTRUMENT_THREAD_SWITCHING) && \
+	!defined(CONFIG_SCHED_THREAD_USAGE_SAMPLED)
 #error "No data backend configured for CONFIG_SCHED_THREAD_USAGE"
 #endif /* !CONFIG_USE_SWITCH && !CONFIG_INSTRUMENT_THREAD_SWITCHING */
 
@@ -71,6 +73,7 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 }
 
+#ifndef CONFIG_SCHED_THREAD_USAGE_SAMPLED
 void z_sched_usage_start(struct k_thread *thread)
 {
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
@@ -117,6 +120,67 @@ void z_sched_usage_stop(void)
 	cpu->usage0 = 0;
 	k_spin_unlock(&usage_lock, k);
 }
+#endif /* !CONFIG_SCHED_THREAD_USAGE_SAMPLED */
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_SAMPLED
+/* Cycles represented by one sample period, computed at init. */
+static uint32_t sample_period_cycles;
+
+static void sched_usage_sample(struct k_timer *timer)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(timer);
+
+	key = k_spin_lock(&usage_lock);
+
+	/* Attribute one full period to the thread observed running on each
+	 * CPU. Remote CPUs are sampled without stopping them, so a period
+	 * may occasionally be charged to a thread that was just switched
+	 * out; the error is statistical noise at typical sample rates.
+	 */
+	for (uint8_t i = 0; i < num_cpus; i++) {
+		struct _cpu *cpu = &_kernel.cpus[i];
+		struct k_thread *thread = cpu->current;
+
+		if ((thread != NULL) && thread->base.usage.track_usage) {
+			sched_thread_update_usage(thread,
+						  sample_period_cycles);
+		}
+
+		sched_cpu_update_usage(cpu, sample_period_cycles);
+	}
+
+	k_spin_unlock(&usage_lock, key);
+}
+
+static K_TIMER_DEFINE(sched_usage_timer, sched_usage_sample, NULL);
+
+static int sched_usage_sample_init(void)
+{
+	uint64_t freq;
+
+#ifdef CONFIG_THREAD_RUNTIME_STATS_USE_TIMING_FUNCTIONS
+	freq = timing_freq_get();
+#else
+	freq = (uint64_t)sys_clock_hw_cycles_per_sec();
+#endif /* CONFIG_THREAD_RUNTIME_STATS_USE_TIMING_FUNCTIONS */
+
+	sample_period_cycles = (uint32_t)
+		((freq * CONFIG_SCHED_THREAD_USAGE_SAMPLE_PERIOD_MS) /
+		 MSEC_PER_SEC);
+
+	k_timer_start(&sched_usage_timer,
+		      K_MSEC(CONFIG_SCHED_THREAD_USAGE_SAMPLE_PERIOD_MS),
+		      K_MSEC(CONFIG_SCHED_THREAD_USAGE_SAMPLE_PERIOD_MS));
+
+	return 0;
+}
+
+SYS_INIT(sched_usage_sample_init, POST_KERNEL,
+	 CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_SCHED_THREAD_USAGE_SAMPLED */
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
@@ -128,6 +192,7 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 	cpu = _current_cpu;
 
 
+#ifndef CONFIG_SCHED_THREAD_USAGE_SAMPLED
 	if (&_kernel.cpus[cpu_id] == cpu) {
 		uint32_t  now = usage_now();
 		uint32_t cycles = now - cpu->usage0;
@@ -147,6 +212,7 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 
 		cpu->usage0 = now;
 	}
+#endif /* !CONFIG_SCHED_THREAD_USAGE_SAMPLED */
 
 	stats->total_cycles     = cpu->usage->total;
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
@@ -173,12 +239,12 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats)
 {
-	struct _cpu *cpu;
 	k_spinlock_key_t  key;
 
 	key = k_spin_lock(&usage_lock);
-	cpu = _current_cpu;
 
+#ifndef CONFIG_SCHED_THREAD_USAGE_SAMPLED
+	struct _cpu *cpu = _current_cpu;
 
 	if (thread == cpu->current) {
 		uint32_t now = usage_now();
@@ -199,6 +265,7 @@ void z_sched_thread_usage(struct k_thread *thread,
 
 		cpu->usage0 = now;
 	}
+#endif /* !CONFIG_SCHED_THREAD_USAGE_SAMPLED */
 
 	stats->execution_cycles = thread->base.usage.total;
 	stats->total_cycles     = thread->base.usage.total;
@@ -255,17 +322,20 @@ int k_thread_runtime_stats_disable(k_tid_t  thread)
 	}
 
 	key = k_spin_lock(&usage_lock);
-	struct _cpu *cpu = _current_cpu;
 
 	if (thread->base.usage.track_usage) {
 		thread->base.usage.track_usage = false;
 
+#ifndef CONFIG_SCHED_THREAD_USAGE_SAMPLED
+		struct _cpu *cpu = _current_cpu;
+
 		if (thread == cpu->current) {
 			uint32_t cycles = usage_now() - cpu->usage0;
 
 			sched_thread_update_usage(thread, cycles);
 			sched_cpu_update_usage(cpu, cycles);
 		}
+#endif /* !CONFIG_SCHED_THREAD_USAGE_SAMPLED */
 	}
 
 	k_spin_unlock(&usage_lock, key);
@@ -383,6 +453,7 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	stats->num_windows = (thread->base.usage.track_usage) ?  1U : 0U;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 
+#ifndef CONFIG_SCHED_THREAD_USAGE_SAMPLED
 	if (thread != _current_cpu->current) {
 
 		/*
@@ -406,6 +477,9 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	sched_cpu_update_usage(_current_cpu, cycles);
 
 	_current_cpu->usage0 = now;
+#else
+	ARG_UNUSED(thread);
+#endif /* !CONFIG_SCHED_THREAD_USAGE_SAMPLED */
 
 	k_spin_unlock(&usage_lock, key);
 
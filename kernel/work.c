@@ -624,6 +624,9 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * not on the pending list.
 			 */
 			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#ifdef CONFIG_WORK_QUEUE_POOL
+			queue->busy_cnt++;
+#endif
 			work = CONTAINER_OF(node, struct k_work, node);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
@@ -641,7 +644,8 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * This means that if node is not NULL, then work will not be NULL.
 			 */
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
+		} else if (!flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT) &&
+			   flag_test_and_clear(&queue->flags,
 					       K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
@@ -698,7 +702,14 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			finalize_cancel_locked(work);
 		}
 
+#ifdef CONFIG_WORK_QUEUE_POOL
+		queue->busy_cnt--;
+		if (queue->busy_cnt == 0U) {
+			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		}
+#else
 		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#endif
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -749,6 +760,11 @@ void k_work_queue_start(struct k_work_q *queue,
 	 */
 	flags_set(&queue->flags, flags);
 
+#ifdef CONFIG_WORK_QUEUE_POOL
+	queue->busy_cnt = 0;
+	queue->nthreads = 1;
+#endif
+
 	(void)k_thread_create(&queue->thread, stack, stack_size,
 			      work_queue_main, queue, NULL, NULL,
 			      prio, 0, K_FOREVER);
@@ -766,6 +782,28 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#ifdef CONFIG_WORK_QUEUE_POOL
+void k_work_queue_add_thread(struct k_work_q *queue,
+			     struct k_thread *thread,
+			     k_thread_stack_t *stack, size_t stack_size,
+			     int prio)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(thread);
+	__ASSERT_NO_MSG(stack);
+	__ASSERT_NO_MSG(flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	queue->nthreads++;
+	k_spin_unlock(&lock, key);
+
+	(void)k_thread_create(thread, stack, stack_size,
+			      work_queue_main, queue, NULL, NULL,
+			      prio, 0, K_NO_WAIT);
+}
+#endif /* CONFIG_WORK_QUEUE_POOL */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -831,6 +869,17 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 		return -EALREADY;
 	}
 
+#ifdef CONFIG_WORK_QUEUE_POOL
+	/* Stopping only terminates the queue's own thread, which cannot
+	 * leave additional worker threads in a consistent state.
+	 */
+	if (queue->nthreads > 1U) {
+		k_spin_unlock(&lock, key);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, stop, queue, timeout, -ENOTSUP);
+		return -ENOTSUP;
+	}
+#endif
+
 	if (!flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT)) {
 		k_spin_unlock(&lock, key);
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, stop, queue, timeout, -EBUSY);
@@ -1125,6 +1174,54 @@ bool k_work_cancel_delayable_sync(struct k_work_delayable *dwork,
 	return pending;
 }
 
+size_t k_work_cancel_delayable_bulk(struct k_work_delayable **dworks, size_t count,
+				    struct k_work_sync *sync)
+{
+	__ASSERT_NO_MSG(dworks != NULL);
+	__ASSERT_NO_MSG(sync != NULL);
+	__ASSERT_NO_MSG(!k_is_in_isr());
+#ifdef CONFIG_KERNEL_COHERENCE
+	__ASSERT_NO_MSG(arch_mem_coherent(sync));
+#endif /* CONFIG_KERNEL_COHERENCE */
+
+	struct z_work_canceller *canceller = &sync->canceller;
+	k_spinlock_key_t key;
+	size_t pending = 0;
+
+	/* Initiate cancellation of all items in a single pass, so handlers
+	 * that are running on different queues drain in parallel while the
+	 * caller waits for them below.
+	 */
+	key = k_spin_lock(&lock);
+
+	for (size_t i = 0; i < count; ++i) {
+		if (work_delayable_busy_get_locked(dworks[i]) != 0U) {
+			(void)cancel_delayable_async_locked(dworks[i]);
+			pending++;
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	/* Wait for the items that are still running.  The sync object can be
+	 * reused since each wait completes before the next canceller is
+	 * registered.
+	 */
+	for (size_t i = 0; i < count; ++i) {
+		bool need_wait;
+
+		key = k_spin_lock(&lock);
+		need_wait = cancel_sync_locked(&dworks[i]->work, canceller);
+		k_spin_unlock(&lock, key);
+
+		if (need_wait) {
+			k_sem_take(&canceller->sem, K_FOREVER);
+		}
+	}
+
+	return pending;
+}
+
 bool k_work_flush_delayable(struct k_work_delayable *dwork,
 			    struct k_work_sync *sync)
 {
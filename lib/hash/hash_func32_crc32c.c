@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __ARM_FEATURE_CRC32
+#include <arm_acle.h>
+
+uint32_t sys_hash32_crc32c(const void *str, size_t n)
+{
+	const uint8_t *data = str;
+	uint32_t crc = 0xffffffffU;
+
+	for (; n >= sizeof(uint32_t); n -= sizeof(uint32_t), data += sizeof(uint32_t)) {
+		crc = __crc32cw(crc, UNALIGNED_GET((const uint32_t *)data));
+	}
+
+	if (n >= sizeof(uint16_t)) {
+		crc = __crc32ch(crc, UNALIGNED_GET((const uint16_t *)data));
+		n -= sizeof(uint16_t);
+		data += sizeof(uint16_t);
+	}
+
+	if (n != 0) {
+		crc = __crc32cb(crc, *data);
+	}
+
+	return crc ^ 0xffffffffU;
+}
+#else
+uint32_t sys_hash32_crc32c(const void *str, size_t n)
+{
+	return crc32_c(0, str, n, true, true);
+}
+#endif
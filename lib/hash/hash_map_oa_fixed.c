@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/hash_map_oa_fixed.h>
+#include <zephyr/sys/util.h>
+
+enum bucket_state {
+	UNUSED,
+	USED,
+};
+
+static inline const struct sys_hashmap_oa_fixed_config *
+get_config(const struct sys_hashmap *map)
+{
+	return (const struct sys_hashmap_oa_fixed_config *)map->config;
+}
+
+/* The bucket array is allocated by the defining macro rather than by an
+ * allocator, attach it to the (zero-initialized) data on first use.
+ */
+static void sys_hashmap_oa_fixed_attach(struct sys_hashmap *map)
+{
+	struct sys_hashmap_data *data = map->data;
+	const struct sys_hashmap_oa_fixed_config *config = get_config(map);
+
+	if (data->buckets == NULL) {
+		data->buckets = config->entries;
+		data->n_buckets = config->n_buckets;
+	}
+}
+
+static size_t sys_hashmap_oa_fixed_max_size(const struct sys_hashmap *map)
+{
+	const struct sys_hashmap_oa_fixed_config *config = get_config(map);
+	size_t limit = config->n_buckets * config->common.load_factor / 100U;
+
+	return MIN(limit, config->common.max_size);
+}
+
+/* Return the entry holding @a key, or the first unused entry of its probe
+ * sequence if the key is absent. Since backward-shift deletion keeps probe
+ * sequences gap-free, hitting an unused entry proves the key is not present.
+ * NULL is only returned when the table is completely full of other keys.
+ */
+static struct sys_hashmap_oa_fixed_entry *
+sys_hashmap_oa_fixed_find(const struct sys_hashmap *map, uint64_t key)
+{
+	struct sys_hashmap_oa_fixed_entry *entry;
+	const size_t n_buckets = map->data->n_buckets;
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+	struct sys_hashmap_oa_fixed_entry *const buckets = map->data->buckets;
+
+	for (size_t i = 0, j = hash; i < n_buckets; ++i, ++j) {
+		j &= (n_buckets - 1);
+
+		entry = &buckets[j];
+
+		switch (entry->state) {
+		case USED:
+			if (entry->key == key) {
+				return entry;
+			}
+			break;
+		case UNUSED:
+			return entry;
+		default:
+			__ASSERT(false, "Invalid entry state. Memory has been corrupted");
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+static void sys_hashmap_oa_fixed_iter_next(struct sys_hashmap_iterator *it)
+{
+	size_t i;
+	struct sys_hashmap_oa_fixed_entry *entry;
+	const struct sys_hashmap *map = (const struct sys_hashmap *)it->map;
+	struct sys_hashmap_oa_fixed_entry *buckets = map->data->buckets;
+
+	__ASSERT(it->size == map->data->size, "Concurrent modification!");
+	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
+
+	if (it->pos == 0) {
+		it->state = buckets;
+	}
+
+	i = (struct sys_hashmap_oa_fixed_entry *)it->state - buckets;
+	__ASSERT(i < map->data->n_buckets, "Invalid iterator state %p", it->state);
+
+	for (; i < map->data->n_buckets; ++i) {
+		entry = &buckets[i];
+		if (entry->state == USED) {
+			it->state = &buckets[i + 1];
+			it->key = entry->key;
+			it->value = entry->value;
+			++it->pos;
+			return;
+		}
+	}
+
+	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
+}
+
+/*
+ * Fixed-storage Open Addressing Hashmap API
+ */
+
+static void sys_hashmap_oa_fixed_iter(const struct sys_hashmap *map,
+				      struct sys_hashmap_iterator *it)
+{
+	it->map = map;
+	it->next = sys_hashmap_oa_fixed_iter_next;
+	it->pos = 0;
+	*((size_t *)&it->size) = map->data->size;
+}
+
+static void sys_hashmap_oa_fixed_clear(struct sys_hashmap *map, sys_hashmap_callback_t cb,
+				       void *cookie)
+{
+	struct sys_hashmap_oa_fixed_entry *entry;
+	struct sys_hashmap_data *data = map->data;
+	struct sys_hashmap_oa_fixed_entry *buckets = data->buckets;
+
+	for (size_t i = 0, j = 0; i < data->n_buckets && j < data->size; ++i) {
+		entry = &buckets[i];
+		if (entry->state == USED) {
+			if (cb != NULL) {
+				cb(entry->key, entry->value, cookie);
+			}
+			entry->state = UNUSED;
+			++j;
+		}
+	}
+
+	data->buckets = NULL;
+	data->n_buckets = 0;
+	data->size = 0;
+}
+
+static int sys_hashmap_oa_fixed_insert(struct sys_hashmap *map, uint64_t key, uint64_t value,
+				       uint64_t *old_value)
+{
+	int ret;
+	struct sys_hashmap_oa_fixed_entry *entry;
+	struct sys_hashmap_data *data = map->data;
+
+	sys_hashmap_oa_fixed_attach(map);
+
+	entry = sys_hashmap_oa_fixed_find(map, key);
+	if (entry == NULL) {
+		return -ENOSPC;
+	}
+
+	if (entry->state == UNUSED) {
+		if (data->size == sys_hashmap_oa_fixed_max_size(map)) {
+			return -ENOSPC;
+		}
+		++data->size;
+		ret = 1;
+	} else {
+		ret = 0;
+	}
+
+	if (old_value != NULL) {
+		*old_value = entry->value;
+	}
+
+	entry->state = USED;
+	entry->key = key;
+	entry->value = value;
+
+	return ret;
+}
+
+static bool sys_hashmap_oa_fixed_remove(struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	size_t i;
+	struct sys_hashmap_oa_fixed_entry *entry;
+	struct sys_hashmap_data *data = map->data;
+	struct sys_hashmap_oa_fixed_entry *const buckets = data->buckets;
+	const size_t n_buckets = data->n_buckets;
+
+	entry = sys_hashmap_oa_fixed_find(map, key);
+	if (entry == NULL || entry->state == UNUSED) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entry->value;
+	}
+
+	/* Backward-shift deletion: move entries whose probe sequence passes
+	 * through the vacated bucket back into it, keeping all probe
+	 * sequences gap-free. This way no tombstones accumulate and no
+	 * rehashing is ever needed.
+	 */
+	i = entry - buckets;
+	for (size_t n = 0, j = (i + 1) & (n_buckets - 1); n < n_buckets;
+	     ++n, j = (j + 1) & (n_buckets - 1)) {
+		size_t home;
+
+		if (buckets[j].state == UNUSED) {
+			break;
+		}
+
+		home = map->hash_func(&buckets[j].key, sizeof(key)) & (n_buckets - 1);
+		if (((j - home) & (n_buckets - 1)) >= ((j - i) & (n_buckets - 1))) {
+			buckets[i] = buckets[j];
+			i = j;
+		}
+	}
+
+	buckets[i].state = UNUSED;
+	--data->size;
+
+	return true;
+}
+
+static bool sys_hashmap_oa_fixed_get(const struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	struct sys_hashmap_oa_fixed_entry *entry;
+
+	entry = sys_hashmap_oa_fixed_find(map, key);
+	if (entry == NULL || entry->state == UNUSED) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entry->value;
+	}
+
+	return true;
+}
+
+const struct sys_hashmap_api sys_hashmap_oa_fixed_api = {
+	.iter = sys_hashmap_oa_fixed_iter,
+	.clear = sys_hashmap_oa_fixed_clear,
+	.insert = sys_hashmap_oa_fixed_insert,
+	.remove = sys_hashmap_oa_fixed_remove,
+	.get = sys_hashmap_oa_fixed_get,
+};
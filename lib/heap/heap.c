@@ -21,6 +21,17 @@ static inline void increase_allocated_bytes(struct z_heap *h, size_t num_bytes)
 }
 #endif
 
+#ifdef CONFIG_SYS_HEAP_ALLOC_SITES
+/* Attribute the chunk to the given call site and stash the site index
+ * in the tag slot at the end of the chunk.
+ */
+static void bind_alloc_site(struct z_heap *h, chunkid_t c, void *caller)
+{
+	*alloc_site_tag(h, c) =
+		z_alloc_site_record(caller, chunksz_to_bytes(h, chunk_size(h, c)));
+}
+#endif
+
 static void *chunk_mem(struct z_heap *h, chunkid_t c)
 {
 	chunk_unit_t *buf = chunk_buf(h);
@@ -148,6 +159,68 @@ static void free_chunk(struct z_heap *h, chunkid_t c)
 	free_list_add(h, c);
 }
 
+#ifdef CONFIG_SYS_HEAP_SMALL_CACHE
+/* Pop an exact-size chunk from the quick cache.  Returned chunks are
+ * already marked used and never need splitting.
+ */
+static chunkid_t quick_alloc(struct z_heap *h, chunksz_t sz)
+{
+	chunkid_t c = 0;
+
+	if (sz < ARRAY_SIZE(h->quick)) {
+		c = h->quick[sz];
+		if (c != 0U) {
+			h->quick[sz] = next_free_chunk(h, c);
+			CHECK(chunk_size(h, c) == sz);
+			CHECK(chunk_used(h, c));
+		}
+	}
+	return c;
+}
+
+/* Defer a freed small chunk to the quick cache instead of coalescing.
+ * The chunk keeps its used mark and its allocated accounting.
+ */
+static bool quick_free(struct z_heap *h, chunkid_t c)
+{
+	chunksz_t sz = chunk_size(h, c);
+
+	if ((sz >= ARRAY_SIZE(h->quick)) || solo_free_header(h, c)) {
+		return false;
+	}
+
+	set_next_free_chunk(h, c, h->quick[sz]);
+	h->quick[sz] = c;
+	return true;
+}
+
+/* Hand all cached chunks back to the regular free path so they can
+ * coalesce.  Returns true if anything was flushed.
+ */
+static bool quick_flush(struct z_heap *h)
+{
+	bool flushed = false;
+
+	for (chunksz_t sz = 1; sz < ARRAY_SIZE(h->quick); sz++) {
+		chunkid_t c = h->quick[sz];
+
+		h->quick[sz] = 0;
+		while (c != 0U) {
+			chunkid_t n = next_free_chunk(h, c);
+
+			set_chunk_used(h, c, false);
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+			h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
+#endif
+			free_chunk(h, c);
+			c = n;
+			flushed = true;
+		}
+	}
+	return flushed;
+}
+#endif /* CONFIG_SYS_HEAP_SMALL_CACHE */
+
 /*
  * Return the closest chunk ID corresponding to given memory pointer.
  * Here "closest" is only meaningful in the context of sys_heap_aligned_alloc()
@@ -184,6 +257,25 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
+#ifdef CONFIG_SYS_HEAP_ALLOC_SITES
+	z_alloc_site_forget(*alloc_site_tag(h, c),
+			    chunksz_to_bytes(h, chunk_size(h, c)));
+#endif
+
+#ifdef CONFIG_SYS_HEAP_SMALL_CACHE
+	/* Small chunks are deferred to the quick cache rather than
+	 * coalesced; they keep their used mark and their allocated
+	 * accounting until flushed, but the listener is told now.
+	 */
+	if (quick_free(h, c)) {
+#ifdef CONFIG_SYS_HEAP_LISTENER
+		heap_listener_notify_free(HEAP_ID_FROM_POINTER(heap), mem,
+					  chunksz_to_bytes(h, chunk_size(h, c)));
+#endif
+		return;
+	}
+#endif /* CONFIG_SYS_HEAP_SMALL_CACHE */
+
 	set_chunk_used(h, c, false);
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
@@ -205,7 +297,7 @@ size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
 	size_t chunk_base = (size_t)&chunk_buf(h)[c];
 	size_t chunk_sz = chunk_size(h, c) * CHUNK_UNIT;
 
-	return chunk_sz - (addr - chunk_base);
+	return chunk_sz - (addr - chunk_base) - ALLOC_SITE_TAG_BYTES;
 }
 
 static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
@@ -257,6 +349,16 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 		return c;
 	}
 
+#ifdef CONFIG_SYS_HEAP_SMALL_CACHE
+	/* Hand deferred small chunks back for coalescing and retry
+	 * once; the cache is empty after a flush, so the recursion
+	 * terminates immediately.
+	 */
+	if (quick_flush(h)) {
+		return alloc_chunk(h, sz);
+	}
+#endif /* CONFIG_SYS_HEAP_SMALL_CACHE */
+
 	return 0;
 }
 
@@ -269,7 +371,30 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 		return NULL;
 	}
 
-	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes);
+	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes + ALLOC_SITE_TAG_BYTES);
+
+#ifdef CONFIG_SYS_HEAP_SMALL_CACHE
+	chunkid_t qc = quick_alloc(h, chunk_sz);
+
+	if (qc != 0U) {
+		/* Exact fit, already marked used and still counted as
+		 * allocated in the stats: nothing else to update.
+		 */
+		mem = chunk_mem(h, qc);
+
+#ifdef CONFIG_SYS_HEAP_ALLOC_SITES
+		bind_alloc_site(h, qc, __builtin_return_address(0));
+#endif
+
+#ifdef CONFIG_SYS_HEAP_LISTENER
+		heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(heap), mem,
+					   chunksz_to_bytes(h, chunk_size(h, qc)));
+#endif
+		IF_ENABLED(CONFIG_MSAN, (__msan_allocated_memory(mem, bytes)));
+		return mem;
+	}
+#endif /* CONFIG_SYS_HEAP_SMALL_CACHE */
+
 	chunkid_t c = alloc_chunk(h, chunk_sz);
 	if (c == 0U) {
 		return NULL;
@@ -285,6 +410,10 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 
 	mem = chunk_mem(h, c);
 
+#ifdef CONFIG_SYS_HEAP_ALLOC_SITES
+	bind_alloc_site(h, c, __builtin_return_address(0));
+#endif
+
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	increase_allocated_bytes(h, chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
@@ -339,7 +468,8 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	 * We over-allocate to account for alignment and then free
 	 * the extra allocations afterwards.
 	 */
-	chunksz_t padded_sz = bytes_to_chunksz(h, bytes + align - gap);
+	chunksz_t padded_sz =
+		bytes_to_chunksz(h, bytes + ALLOC_SITE_TAG_BYTES + align - gap);
 	chunkid_t c0 = alloc_chunk(h, padded_sz);
 
 	if (c0 == 0) {
@@ -349,7 +479,8 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 
 	/* Align allocated memory */
 	mem = (uint8_t *) ROUND_UP(mem + rew, align) - rew;
-	chunk_unit_t *end = (chunk_unit_t *) ROUND_UP(mem + bytes, CHUNK_UNIT);
+	chunk_unit_t *end = (chunk_unit_t *)
+		ROUND_UP(mem + bytes + ALLOC_SITE_TAG_BYTES, CHUNK_UNIT);
 
 	/* Get corresponding chunks */
 	chunkid_t c = mem_to_chunkid(h, mem);
@@ -370,6 +501,10 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 
 	set_chunk_used(h, c, true);
 
+#ifdef CONFIG_SYS_HEAP_ALLOC_SITES
+	bind_alloc_site(h, c, __builtin_return_address(0));
+#endif
+
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	increase_allocated_bytes(h, chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
@@ -393,7 +528,8 @@ static bool inplace_realloc(struct sys_heap *heap, void *ptr, size_t bytes)
 
 	chunkid_t c = mem_to_chunkid(h, ptr);
 	size_t align_gap = (uint8_t *)ptr - (uint8_t *)chunk_mem(h, c);
-	chunksz_t chunks_need = bytes_to_chunksz(h, bytes + align_gap);
+	chunksz_t chunks_need =
+		bytes_to_chunksz(h, bytes + align_gap + ALLOC_SITE_TAG_BYTES);
 
 	if (chunk_size(h, c) == chunks_need) {
 		/* We're good already */
@@ -474,7 +610,21 @@ void *sys_heap_realloc(struct sys_heap *heap, void *ptr, size_t bytes)
 		return NULL;
 	}
 
+#ifdef CONFIG_SYS_HEAP_ALLOC_SITES
+	/* Resizing may move the tag slot, so read it beforehand; the
+	 * resized block is re-attributed to the caller of realloc.
+	 */
+	struct z_heap *h = heap->heap;
+	chunkid_t c = mem_to_chunkid(h, ptr);
+	uint32_t old_site = *alloc_site_tag(h, c);
+	size_t old_bytes = chunksz_to_bytes(h, chunk_size(h, c));
+#endif
+
 	if (inplace_realloc(heap, ptr, bytes)) {
+#ifdef CONFIG_SYS_HEAP_ALLOC_SITES
+		z_alloc_site_forget(old_site, old_bytes);
+		bind_alloc_site(h, c, __builtin_return_address(0));
+#endif
 		return ptr;
 	}
 
@@ -486,6 +636,14 @@ void *sys_heap_realloc(struct sys_heap *heap, void *ptr, size_t bytes)
 
 		memcpy(ptr2, ptr, MIN(prev_size, bytes));
 		sys_heap_free(heap, ptr);
+
+#ifdef CONFIG_SYS_HEAP_ALLOC_SITES
+		chunkid_t c2 = mem_to_chunkid(h, ptr2);
+
+		z_alloc_site_forget(*alloc_site_tag(h, c2),
+				    chunksz_to_bytes(h, chunk_size(h, c2)));
+		bind_alloc_site(h, c2, __builtin_return_address(0));
+#endif
 	}
 	return ptr2;
 }
@@ -504,8 +662,20 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 
 	__ASSERT((align & (align - 1)) == 0, "align must be a power of 2");
 
+#ifdef CONFIG_SYS_HEAP_ALLOC_SITES
+	/* See sys_heap_realloc() */
+	struct z_heap *h = heap->heap;
+	chunkid_t c = mem_to_chunkid(h, ptr);
+	uint32_t old_site = *alloc_site_tag(h, c);
+	size_t old_bytes = chunksz_to_bytes(h, chunk_size(h, c));
+#endif
+
 	if ((align == 0 || ((uintptr_t)ptr & (align - 1)) == 0) &&
 	    inplace_realloc(heap, ptr, bytes)) {
+#ifdef CONFIG_SYS_HEAP_ALLOC_SITES
+		z_alloc_site_forget(old_site, old_bytes);
+		bind_alloc_site(h, c, __builtin_return_address(0));
+#endif
 		return ptr;
 	}
 
@@ -520,6 +690,14 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 
 		memcpy(ptr2, ptr, MIN(prev_size, bytes));
 		sys_heap_free(heap, ptr);
+
+#ifdef CONFIG_SYS_HEAP_ALLOC_SITES
+		chunkid_t c2 = mem_to_chunkid(h, ptr2);
+
+		z_alloc_site_forget(*alloc_site_tag(h, c2),
+				    chunksz_to_bytes(h, chunk_size(h, c2)));
+		bind_alloc_site(h, c2, __builtin_return_address(0));
+#endif
 	}
 	return ptr2;
 }
@@ -573,6 +751,12 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 		h->buckets[i].next = 0;
 	}
 
+#ifdef CONFIG_SYS_HEAP_SMALL_CACHE
+	for (int i = 0; i < (int)ARRAY_SIZE(h->quick); i++) {
+		h->quick[i] = 0;
+	}
+#endif /* CONFIG_SYS_HEAP_SMALL_CACHE */
+
 	/* chunk containing our struct z_heap */
 	set_chunk_size(h, 0, chunk0_size);
 	set_left_chunk_size(h, 0, 0);
@@ -73,6 +73,15 @@ struct z_heap {
 	size_t free_bytes;
 	size_t allocated_bytes;
 	size_t max_allocated_bytes;
+#endif
+#ifdef CONFIG_SYS_HEAP_SMALL_CACHE
+	/* Exact-size LIFO lists of recently freed small chunks,
+	 * indexed by chunk size in units; [0] is unused.  Cached
+	 * chunks stay marked "used" so neighbors don't coalesce with
+	 * them, and they still count as allocated in the runtime
+	 * stats.
+	 */
+	chunkid_t quick[(CONFIG_SYS_HEAP_SMALL_CACHE_THRESHOLD / CHUNK_UNIT) + 1];
 #endif
 	struct z_heap_bucket buckets[0];
 };
@@ -262,6 +271,29 @@ static inline bool size_too_big(struct z_heap *h, size_t bytes)
 	return (bytes / CHUNK_UNIT) >= h->end_chunk;
 }
 
+#ifdef CONFIG_SYS_HEAP_ALLOC_SITES
+
+/* The last four bytes of every allocated chunk hold the index of the
+ * allocation site owning it.  The space is reserved by adding
+ * ALLOC_SITE_TAG_BYTES to the requested size in the allocation paths;
+ * chunk ends are CHUNK_UNIT aligned so the tag is naturally aligned.
+ */
+#define ALLOC_SITE_TAG_BYTES sizeof(uint32_t)
+
+static inline uint32_t *alloc_site_tag(struct z_heap *h, chunkid_t c)
+{
+	return (uint32_t *)&chunk_buf(h)[c + chunk_size(h, c)] - 1;
+}
+
+uint32_t z_alloc_site_record(void *caller, size_t bytes);
+void z_alloc_site_forget(uint32_t site, size_t bytes);
+
+#else
+
+#define ALLOC_SITE_TAG_BYTES 0U
+
+#endif /* CONFIG_SYS_HEAP_ALLOC_SITES */
+
 static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			   size_t *free_bytes)
 {
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/kernel.h>
+#include "heap.h"
+
+/*
+ * Allocation site table, shared by all sys_heap instances.
+ *
+ * Entry 0 is the overflow site: allocations whose caller cannot get a
+ * slot of its own (table full, or too many collisions) are pooled
+ * there so no live bytes ever go missing from the accounting.  Slots
+ * are claimed with a compare-and-set on the caller field and never
+ * released; the population of allocation sites in an image is small
+ * and static.  Individual heap operations are serialized by the heap
+ * owner's lock, but nothing orders operations on different heaps, so
+ * the counters are atomics.
+ */
+static struct {
+	atomic_ptr_t caller;
+	atomic_t count;
+	atomic_t bytes;
+} sites[CONFIG_SYS_HEAP_ALLOC_SITES_COUNT];
+
+/* Bounded linear probing; past this the overflow site absorbs the hit */
+#define MAX_PROBES 8
+
+static uint32_t site_hash(uintptr_t caller)
+{
+	/* Fibonacci hashing; return addresses share their low bits */
+	return (uint32_t)(caller >> 1) * 2654435769U;
+}
+
+uint32_t z_alloc_site_record(void *caller, size_t bytes)
+{
+	uint32_t n = ARRAY_SIZE(sites) - 1U;
+	uint32_t idx = (site_hash((uintptr_t)caller) % n) + 1U;
+	uint32_t site = 0;
+
+	for (int i = 0; i < MAX_PROBES; i++) {
+		void *cur = atomic_ptr_get(&sites[idx].caller);
+
+		if (cur == NULL) {
+			if (atomic_ptr_cas(&sites[idx].caller, NULL, caller)) {
+				site = idx;
+				break;
+			}
+			/* Lost the race for this slot, see who won it */
+			cur = atomic_ptr_get(&sites[idx].caller);
+		}
+		if (cur == caller) {
+			site = idx;
+			break;
+		}
+		idx = (idx % n) + 1U;
+	}
+
+	atomic_inc(&sites[site].count);
+	atomic_add(&sites[site].bytes, bytes);
+	return site;
+}
+
+void z_alloc_site_forget(uint32_t site, size_t bytes)
+{
+	if (site >= ARRAY_SIZE(sites)) {
+		/* The tag was overwritten; don't wreck the table too */
+		return;
+	}
+
+	atomic_dec(&sites[site].count);
+	atomic_sub(&sites[site].bytes, bytes);
+}
+
+int sys_heap_alloc_site_get(size_t idx, struct sys_heap_alloc_site *site)
+{
+	if ((site == NULL) || (idx >= ARRAY_SIZE(sites))) {
+		return -EINVAL;
+	}
+
+	site->caller = (uintptr_t)atomic_ptr_get(&sites[idx].caller);
+	site->count = (uint32_t)atomic_get(&sites[idx].count);
+	site->bytes = (size_t)atomic_get(&sites[idx].bytes);
+
+	return 0;
+}
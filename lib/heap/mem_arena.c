@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/mem_arena.h>
+#include <zephyr/sys/util.h>
+
+int sys_mem_arena_init(struct sys_mem_arena *arena, struct k_heap *parent,
+		       size_t size)
+{
+	void *buf;
+
+	__ASSERT_NO_MSG(arena != NULL);
+	__ASSERT_NO_MSG(parent != NULL);
+
+	buf = k_heap_aligned_alloc(parent, sizeof(void *), size, K_NO_WAIT);
+	if (buf == NULL) {
+		return -ENOMEM;
+	}
+
+	arena->parent = parent;
+	arena->buf = buf;
+	arena->size = size;
+	arena->offset = 0;
+
+	return 0;
+}
+
+void *sys_mem_arena_aligned_alloc(struct sys_mem_arena *arena, size_t align,
+				  size_t bytes)
+{
+	size_t offset;
+
+	__ASSERT_NO_MSG(arena != NULL);
+	__ASSERT_NO_MSG((align & (align - 1)) == 0U);
+
+	/* The chunk itself is pointer aligned, so aligning the offset
+	 * aligns the returned address for any larger power of two too.
+	 */
+	offset = ROUND_UP(arena->offset, align);
+	if ((offset > arena->size) || (bytes > arena->size - offset)) {
+		return NULL;
+	}
+
+	arena->offset = offset + bytes;
+
+	return &arena->buf[offset];
+}
+
+void *sys_mem_arena_alloc(struct sys_mem_arena *arena, size_t bytes)
+{
+	return sys_mem_arena_aligned_alloc(arena, sizeof(void *), bytes);
+}
+
+void sys_mem_arena_reset(struct sys_mem_arena *arena)
+{
+	__ASSERT_NO_MSG(arena != NULL);
+
+	arena->offset = 0;
+}
+
+void sys_mem_arena_destroy(struct sys_mem_arena *arena)
+{
+	__ASSERT_NO_MSG(arena != NULL);
+
+	k_heap_free(arena->parent, arena->buf);
+	arena->parent = NULL;
+	arena->buf = NULL;
+	arena->size = 0;
+	arena->offset = 0;
+}
+
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+
+static Z_THREAD_LOCAL struct sys_mem_arena *thread_arena;
+
+void sys_mem_arena_scope_enter(struct sys_mem_arena *arena)
+{
+	__ASSERT_NO_MSG(arena != NULL);
+
+	arena->prev = thread_arena;
+	thread_arena = arena;
+}
+
+void sys_mem_arena_scope_exit(struct sys_mem_arena *arena)
+{
+	__ASSERT_NO_MSG(arena == thread_arena);
+
+	thread_arena = arena->prev;
+	arena->prev = NULL;
+}
+
+struct sys_mem_arena *sys_mem_arena_current(void)
+{
+	return thread_arena;
+}
+
+#endif /* CONFIG_THREAD_LOCAL_STORAGE */
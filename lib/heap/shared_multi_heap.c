@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
+
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
 #include <zephyr/sys/sys_heap.h>
@@ -15,13 +17,66 @@ static struct sys_multi_heap shared_multi_heap;
 
 static struct {
 	struct sys_heap heap_pool[MAX_MULTI_HEAPS];
+	uint16_t cost[MAX_MULTI_HEAPS];
 	unsigned int heap_cnt;
 } smh_data[MAX_SHARED_MULTI_HEAP_ATTR];
 
+static enum shared_multi_heap_policy smh_policy = SMH_ALLOC_POLICY_FIRST_FIT;
+
+/* Pick the next heap to try among the ones not tried yet, according to the
+ * allocation policy. Returns the number of heaps when none is left.
+ */
+static unsigned int smh_pick(enum shared_multi_heap_attr attr, uint32_t tried)
+{
+	unsigned int cnt = smh_data[attr].heap_cnt;
+	unsigned int pick = cnt;
+
+	for (unsigned int hdx = 0; hdx < cnt; hdx++) {
+		if ((tried & BIT(hdx)) != 0U) {
+			continue;
+		}
+
+		switch (smh_policy) {
+		case SMH_ALLOC_POLICY_PREFER_FAST:
+			if (pick == cnt ||
+			    smh_data[attr].cost[hdx] < smh_data[attr].cost[pick]) {
+				pick = hdx;
+			}
+			break;
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+		case SMH_ALLOC_POLICY_PREFER_LARGEST_FREE: {
+			struct sys_memory_stats stats;
+			struct sys_memory_stats pick_stats;
+
+			if (sys_heap_runtime_stats_get(&smh_data[attr].heap_pool[hdx],
+						       &stats) != 0) {
+				break;
+			}
+			if (pick == cnt ||
+			    sys_heap_runtime_stats_get(&smh_data[attr].heap_pool[pick],
+						       &pick_stats) != 0 ||
+			    stats.free_bytes > pick_stats.free_bytes) {
+				pick = hdx;
+			}
+			break;
+		}
+#endif
+		case SMH_ALLOC_POLICY_FIRST_FIT:
+		default:
+			/* Heaps are stored in the order they were added */
+			return hdx;
+		}
+	}
+
+	return pick;
+}
+
 static void *smh_choice(struct sys_multi_heap *mheap, void *cfg, size_t align, size_t size)
 {
 	struct sys_heap *h;
 	enum shared_multi_heap_attr attr;
+	uint32_t tried = 0;
+	unsigned int pick;
 	void *block;
 
 	attr = (enum shared_multi_heap_attr)(long) cfg;
@@ -34,7 +89,13 @@ static void *smh_choice(struct sys_multi_heap *mheap, void *cfg, size_t align, s
 	block = NULL;
 
 	for (size_t hdx = 0; hdx < smh_data[attr].heap_cnt; hdx++) {
-		h = &smh_data[attr].heap_pool[hdx];
+		pick = smh_pick(attr, tried);
+		if (pick >= smh_data[attr].heap_cnt) {
+			break;
+		}
+		tried |= BIT(pick);
+
+		h = &smh_data[attr].heap_pool[pick];
 
 		if (h->heap == NULL) {
 			return NULL;
@@ -72,11 +133,93 @@ int shared_multi_heap_add(struct shared_multi_heap_region *region, void *user_da
 	sys_heap_init(h, (void *) region->addr, region->size);
 	sys_multi_heap_add_heap(&shared_multi_heap, h, user_data);
 
+	smh_data[attr].cost[slot] = region->cost;
 	smh_data[attr].heap_cnt++;
 
 	return 0;
 }
 
+int shared_multi_heap_policy_set(enum shared_multi_heap_policy policy)
+{
+	switch (policy) {
+	case SMH_ALLOC_POLICY_FIRST_FIT:
+	case SMH_ALLOC_POLICY_PREFER_FAST:
+		break;
+	case SMH_ALLOC_POLICY_PREFER_LARGEST_FREE:
+		if (!IS_ENABLED(CONFIG_SYS_HEAP_RUNTIME_STATS)) {
+			return -ENOTSUP;
+		}
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	smh_policy = policy;
+
+	return 0;
+}
+
+void *shared_multi_heap_alloc_pinned(enum shared_multi_heap_attr attr, unsigned int idx,
+				     size_t align, size_t bytes)
+{
+	if (attr >= MAX_SHARED_MULTI_HEAP_ATTR || bytes == 0 ||
+	    idx >= smh_data[attr].heap_cnt) {
+		return NULL;
+	}
+
+	/* The heap was registered with the multi-heap manager, so the block
+	 * can be freed with shared_multi_heap_free() as usual.
+	 */
+	return sys_heap_aligned_alloc(&smh_data[attr].heap_pool[idx], align, bytes);
+}
+
+void *shared_multi_heap_migrate(void *block, enum shared_multi_heap_attr attr)
+{
+	const struct sys_multi_heap_rec *rec;
+	void *new_block;
+	size_t old_size;
+
+	if (block == NULL || attr >= MAX_SHARED_MULTI_HEAP_ATTR) {
+		return NULL;
+	}
+
+	rec = sys_multi_heap_get_heap(&shared_multi_heap, block);
+	if (rec == NULL) {
+		return NULL;
+	}
+
+	old_size = sys_heap_usable_size(rec->heap, block);
+
+	new_block = shared_multi_heap_alloc(attr, old_size);
+	if (new_block == NULL) {
+		return NULL;
+	}
+
+	memcpy(new_block, block, old_size);
+	shared_multi_heap_free(block);
+
+	return new_block;
+}
+
+int shared_multi_heap_runtime_stats_get(enum shared_multi_heap_attr attr, unsigned int idx,
+					struct sys_memory_stats *stats)
+{
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	if (attr >= MAX_SHARED_MULTI_HEAP_ATTR || idx >= smh_data[attr].heap_cnt ||
+	    stats == NULL) {
+		return -EINVAL;
+	}
+
+	return sys_heap_runtime_stats_get(&smh_data[attr].heap_pool[idx], stats);
+#else
+	ARG_UNUSED(attr);
+	ARG_UNUSED(idx);
+	ARG_UNUSED(stats);
+
+	return -ENOTSUP;
+#endif
+}
+
 void shared_multi_heap_free(void *block)
 {
 	sys_multi_heap_free(&shared_multi_heap, block);
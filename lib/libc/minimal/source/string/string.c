@@ -217,6 +217,7 @@ char *strncat(char *ZRESTRICT dest, const char *ZRESTRICT src,
  *
  * @return negative # if <m1> < <m2>, 0 if <m1> == <m2>, else positive #
  */
+#if !defined(CONFIG_ARCH_HAS_OPTIMIZED_STRING_FUNCS)
 int memcmp(const void *m1, const void *m2, size_t n)
 {
 	const char *c1 = m1;
@@ -233,6 +234,7 @@ int memcmp(const void *m1, const void *m2, size_t n)
 
 	return *c1 - *c2;
 }
+#endif /* !CONFIG_ARCH_HAS_OPTIMIZED_STRING_FUNCS */
 
 /**
  *
@@ -276,6 +278,7 @@ void *memmove(void *d, const void *s, size_t n)
  * @return pointer to start of destination buffer
  */
 
+#if !defined(CONFIG_ARCH_HAS_OPTIMIZED_STRING_FUNCS)
 void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 {
 	/* attempt word-sized copying only if buffers have identical alignment */
@@ -322,6 +325,7 @@ void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 
 	return d;
 }
+#endif /* !CONFIG_ARCH_HAS_OPTIMIZED_STRING_FUNCS */
 
 /**
  *
@@ -330,6 +334,7 @@ void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
  * @return pointer to start of buffer
  */
 
+#if !defined(CONFIG_ARCH_HAS_OPTIMIZED_STRING_FUNCS)
 void *memset(void *buf, int c, size_t n)
 {
 	/* do byte-sized initialization until word-aligned or finished */
@@ -374,6 +379,7 @@ void *memset(void *buf, int c, size_t n)
 
 	return buf;
 }
+#endif /* !CONFIG_ARCH_HAS_OPTIMIZED_STRING_FUNCS */
 
 /**
  *
@@ -13,6 +13,11 @@
 #include <zephyr/init.h>
 #include <string.h>
 
+/* Number of blocks allocated per locked bitmap pass by
+ * sys_mem_blocks_alloc().
+ */
+#define ALLOC_BATCH_SIZE 16
+
 static void *alloc_blocks(sys_mem_blocks_t *mem_block, size_t num_blocks)
 {
 	size_t offset;
@@ -127,7 +132,8 @@ int sys_mem_blocks_alloc(sys_mem_blocks_t *mem_block, size_t count,
 			 void **out_blocks)
 {
 	int ret = 0;
-	int i;
+	size_t allocated = 0;
+	size_t offsets[ALLOC_BATCH_SIZE];
 
 	__ASSERT_NO_MSG(mem_block != NULL);
 	__ASSERT_NO_MSG(out_blocks != NULL);
@@ -145,25 +151,54 @@ int sys_mem_blocks_alloc(sys_mem_blocks_t *mem_block, size_t count,
 		goto out;
 	}
 
-	for (i = 0; i < count; i++) {
-		void *ptr = alloc_blocks(mem_block, 1);
+	while (allocated < count) {
+		size_t batch = MIN(count - allocated, ARRAY_SIZE(offsets));
+		int r;
+
+#ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
+		k_spinlock_key_t  key = k_spin_lock(&mem_block->lock);
+#endif
+
+		/* Grab the whole batch of blocks in one bitmap pass */
+		r = sys_bitarray_alloc_bits(mem_block->bitmap, batch, offsets);
+
+#ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
+		if (r == 0) {
+			mem_block->info.used_blocks += (uint32_t)batch;
+
+			if (mem_block->info.max_used_blocks <
+			    mem_block->info.used_blocks) {
+				mem_block->info.max_used_blocks =
+					mem_block->info.used_blocks;
+			}
+		}
+
+		k_spin_unlock(&mem_block->lock, key);
+#endif
 
-		if (ptr == NULL) {
+		if (r != 0) {
 			break;
 		}
 
-		out_blocks[i] = ptr;
+		for (size_t i = 0; i < batch; i++) {
+			void *ptr = mem_block->buffer +
+				    (offsets[i] << mem_block->info.blk_sz_shift);
+
+			out_blocks[allocated + i] = ptr;
 
 #ifdef CONFIG_SYS_MEM_BLOCKS_LISTENER
-		heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(mem_block),
-					   ptr,
-					   BIT(mem_block->info.blk_sz_shift));
+			heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(mem_block),
+						   ptr,
+						   BIT(mem_block->info.blk_sz_shift));
 #endif
+		}
+
+		allocated += batch;
 	}
 
 	/* If error, free already allocated blocks. */
-	if (i < count) {
-		(void)sys_mem_blocks_free(mem_block, i, out_blocks);
+	if (allocated < count) {
+		(void)sys_mem_blocks_free(mem_block, allocated, out_blocks);
 		ret = -ENOMEM;
 	}
 
@@ -59,11 +59,18 @@ static int pool_id(struct net_buf_pool *pool)
 	return pool - TYPE_SECTION_START(net_buf_pool);
 }
 
+static size_t pool_struct_size(const struct net_buf_pool *pool)
+{
+	size_t align = pool->buf_align ? pool->buf_align :
+		       __alignof__(struct net_buf);
+
+	return ROUND_UP(sizeof(struct net_buf) + pool->user_data_size, align);
+}
+
 int net_buf_id(const struct net_buf *buf)
 {
 	struct net_buf_pool *pool = net_buf_pool_get(buf->pool_id);
-	size_t struct_size = ROUND_UP(sizeof(struct net_buf) + pool->user_data_size,
-				__alignof__(struct net_buf));
+	size_t struct_size = pool_struct_size(pool);
 	ptrdiff_t offset = (uint8_t *)buf - (uint8_t *)pool->__bufs;
 
 	return offset / struct_size;
@@ -72,8 +79,7 @@ int net_buf_id(const struct net_buf *buf)
 static inline struct net_buf *pool_get_uninit(struct net_buf_pool *pool,
 					      uint16_t uninit_count)
 {
-	size_t struct_size = ROUND_UP(sizeof(struct net_buf) + pool->user_data_size,
-				__alignof__(struct net_buf));
+	size_t struct_size = pool_struct_size(pool);
 	size_t byte_offset = (pool->buf_count - uninit_count) * struct_size;
 	struct net_buf *buf;
 
@@ -85,6 +91,50 @@ static inline struct net_buf *pool_get_uninit(struct net_buf_pool *pool,
 	return buf;
 }
 
+#if defined(CONFIG_NET_BUF_POOL_PERCPU_CACHE)
+static struct net_buf *pool_cache_get(struct net_buf_pool *pool)
+{
+	return atomic_ptr_set(&pool->free_cache[arch_curr_cpu()->id], NULL);
+}
+
+static struct net_buf *pool_cache_scavenge(struct net_buf_pool *pool)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	struct net_buf *buf;
+
+	for (unsigned int cpu = 0; cpu < num_cpus; cpu++) {
+		buf = atomic_ptr_set(&pool->free_cache[cpu], NULL);
+		if (buf) {
+			return buf;
+		}
+	}
+
+	return NULL;
+}
+
+bool net_buf_pool_cache_put(struct net_buf_pool *pool, struct net_buf *buf)
+{
+	atomic_ptr_t *slot = &pool->free_cache[arch_curr_cpu()->id];
+
+	if (!atomic_ptr_cas(slot, NULL, buf)) {
+		return false;
+	}
+
+	/* Pairs with the waiter announcement in net_buf_alloc_len(): an
+	 * allocator increments free_waiters before scavenging the caches,
+	 * so either it finds the buffer cached above, or the cas below
+	 * succeeds and the buffer goes to the LIFO to wake the allocator
+	 * up. A failing cas means another CPU already took the buffer.
+	 */
+	if (atomic_get(&pool->free_waiters) != 0 &&
+	    atomic_ptr_cas(slot, buf, NULL)) {
+		return false;
+	}
+
+	return true;
+}
+#endif /* CONFIG_NET_BUF_POOL_PERCPU_CACHE */
+
 void net_buf_reset(struct net_buf *buf)
 {
 	__ASSERT_NO_MSG(buf->flags == 0U);
@@ -166,6 +216,81 @@ const struct net_buf_data_cb net_buf_fixed_cb = {
 	.unref = fixed_data_unref,
 };
 
+static uint8_t *segmented_data_alloc(struct net_buf *buf, size_t *size,
+				     k_timeout_t timeout)
+{
+	struct net_buf_pool *buf_pool = net_buf_pool_get(buf->pool_id);
+	const struct net_buf_pool_segmented *seg = buf_pool->alloc->alloc_data;
+	struct net_buf_pool_segmented_class *first_fit = NULL;
+
+	ARG_UNUSED(timeout);
+
+	/* Classes are ordered by ascending chunk size: serve the request
+	 * from the smallest class it fits in, borrowing from the larger
+	 * classes when that one is exhausted.
+	 */
+	for (uint8_t i = 0; i < seg->class_count; i++) {
+		struct net_buf_pool_segmented_class *sc = &seg->classes[i];
+
+		if (*size > sc->data_size) {
+			continue;
+		}
+
+		if (first_fit == NULL) {
+			first_fit = sc;
+		}
+
+		for (uint16_t slot = 0; slot < sc->data_count; slot++) {
+			if (atomic_test_and_set_bit(sc->in_use, slot)) {
+				continue;
+			}
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+			atomic_val_t used = atomic_inc(&sc->used_count) + 1;
+
+			sc->max_used = MAX(sc->max_used, (uint16_t)used);
+			if (sc != first_fit) {
+				atomic_inc(&first_fit->borrow_count);
+			}
+#endif
+			*size = sc->data_size;
+
+			return sc->data_pool + (size_t)slot * sc->data_size;
+		}
+	}
+
+	return NULL;
+}
+
+static void segmented_data_unref(struct net_buf *buf, uint8_t *data)
+{
+	struct net_buf_pool *buf_pool = net_buf_pool_get(buf->pool_id);
+	const struct net_buf_pool_segmented *seg = buf_pool->alloc->alloc_data;
+
+	for (uint8_t i = 0; i < seg->class_count; i++) {
+		struct net_buf_pool_segmented_class *sc = &seg->classes[i];
+		size_t span = (size_t)sc->data_count * sc->data_size;
+
+		if (data < sc->data_pool || data >= sc->data_pool + span) {
+			continue;
+		}
+
+		atomic_clear_bit(sc->in_use,
+				 (data - sc->data_pool) / sc->data_size);
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+		atomic_dec(&sc->used_count);
+#endif
+		return;
+	}
+
+	__ASSERT(false, "data %p does not belong to pool %p", data, buf_pool);
+}
+
+const struct net_buf_data_cb net_buf_segmented_cb = {
+	.alloc = segmented_data_alloc,
+	.unref = segmented_data_unref,
+};
+
 #if (K_HEAP_MEM_POOL_SIZE > 0)
 
 static uint8_t *heap_data_alloc(struct net_buf *buf, size_t *size,
@@ -239,6 +364,14 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	NET_BUF_DBG("%s():%d: pool %p size %zu", func, line, pool, size);
 
+#if defined(CONFIG_NET_BUF_POOL_PERCPU_CACHE)
+	/* Lock-free fast path: take the buffer this CPU freed last */
+	buf = pool_cache_get(pool);
+	if (buf) {
+		goto success;
+	}
+#endif
+
 	/* We need to prevent race conditions
 	 * when accessing pool->uninit_count.
 	 */
@@ -271,6 +404,21 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	k_spin_unlock(&pool->lock, key);
 
+#if defined(CONFIG_NET_BUF_POOL_PERCPU_CACHE)
+	/* Announce ourselves as a waiter before scavenging the caches of
+	 * the other CPUs; net_buf_pool_cache_put() rechecks the waiter
+	 * count after caching, so a buffer freed while we block below is
+	 * guaranteed to end up in the LIFO.
+	 */
+	atomic_inc(&pool->free_waiters);
+
+	buf = pool_cache_scavenge(pool);
+	if (buf) {
+		atomic_dec(&pool->free_waiters);
+		goto success;
+	}
+#endif
+
 #if defined(CONFIG_NET_BUF_LOG) && (CONFIG_NET_BUF_LOG_LEVEL >= LOG_LEVEL_WRN)
 	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
 		uint32_t ref = k_uptime_get_32();
@@ -300,6 +448,11 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 #else
 	buf = k_lifo_get(&pool->free, timeout);
 #endif
+
+#if defined(CONFIG_NET_BUF_POOL_PERCPU_CACHE)
+	atomic_dec(&pool->free_waiters);
+#endif
+
 	if (!buf) {
 		NET_BUF_ERR("%s():%d: Failed to get free buffer", func, line);
 		return NULL;
@@ -418,12 +571,30 @@ struct net_buf *net_buf_slist_get(sys_slist_t *list)
 	return buf;
 }
 
+static void net_buf_free_batch(struct net_buf_pool *pool,
+			       struct net_buf *head, struct net_buf *tail)
+{
+	if (head == NULL) {
+		return;
+	}
+
+	if (head == tail) {
+		k_lifo_put(&pool->free, head);
+	} else {
+		k_lifo_put_list(&pool->free, head, tail);
+	}
+}
+
 #if defined(CONFIG_NET_BUF_LOG)
 void net_buf_unref_debug(struct net_buf *buf, const char *func, int line)
 #else
 void net_buf_unref(struct net_buf *buf)
 #endif
 {
+	struct net_buf *batch_head = NULL;
+	struct net_buf *batch_tail = NULL;
+	struct net_buf_pool *batch_pool = NULL;
+
 	__ASSERT_NO_MSG(buf);
 
 	while (buf) {
@@ -434,14 +605,14 @@ void net_buf_unref(struct net_buf *buf)
 		if (!buf->ref) {
 			NET_BUF_ERR("%s():%d: buf %p double free", func, line,
 				    buf);
-			return;
+			break;
 		}
 #endif
 		NET_BUF_DBG("buf %p ref %u pool_id %u frags %p", buf, buf->ref,
 			    buf->pool_id, buf->frags);
 
 		if (--buf->ref > 0) {
-			return;
+			break;
 		}
 
 		buf->data = NULL;
@@ -456,12 +627,47 @@ void net_buf_unref(struct net_buf *buf)
 
 		if (pool->destroy) {
 			pool->destroy(buf);
+			buf = frags;
+			continue;
+		}
+
+		if (buf->__buf) {
+			if (!(buf->flags & NET_BUF_EXTERNAL_DATA)) {
+				pool->alloc->cb->unref(buf, buf->__buf);
+			}
+			buf->__buf = NULL;
+		}
+
+#if defined(CONFIG_NET_BUF_POOL_PERCPU_CACHE)
+		if (net_buf_pool_cache_put(pool, buf)) {
+			buf = frags;
+			continue;
+		}
+#endif
+
+		/* Collect fragments going back to the same pool and release
+		 * them with a single free list operation once the chain has
+		 * been walked, so that the pool lock is taken once and
+		 * threads waiting for buffers are woken in a single pass.
+		 */
+		if (pool != batch_pool) {
+			net_buf_free_batch(batch_pool, batch_head, batch_tail);
+			batch_pool = pool;
+			batch_head = NULL;
+		}
+
+		buf->node.next = NULL;
+		if (batch_head == NULL) {
+			batch_head = buf;
 		} else {
-			net_buf_destroy(buf);
+			batch_tail->node.next = &buf->node;
 		}
+		batch_tail = buf;
 
 		buf = frags;
 	}
+
+	net_buf_free_batch(batch_pool, batch_head, batch_tail);
 }
 
 struct net_buf *net_buf_ref(struct net_buf *buf)
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+
+#include <zephyr/cache.h>
+#include <zephyr/sys/util.h>
+
+void sys_cache_data_batch_init(struct sys_cache_batch *batch)
+{
+	batch->count = 0;
+}
+
+int sys_cache_data_batch_add(struct sys_cache_batch *batch, void *addr,
+			     size_t size)
+{
+	size_t line_size = sys_cache_data_line_size_get();
+	uintptr_t start = (uintptr_t)addr;
+	uintptr_t end = start + size;
+	bool merged;
+
+	if (size == 0) {
+		return 0;
+	}
+
+	if (line_size > 0) {
+		start = ROUND_DOWN(start, line_size);
+		end = ROUND_UP(end, line_size);
+	}
+
+	/* Absorb every queued range the new one overlaps or abuts. Growing
+	 * the new range can make it reach ranges already checked, so rescan
+	 * after each absorption.
+	 */
+	do {
+		merged = false;
+
+		for (uint8_t i = 0; i < batch->count; i++) {
+			if (start > batch->ranges[i].end ||
+			    end < batch->ranges[i].start) {
+				continue;
+			}
+
+			start = MIN(start, batch->ranges[i].start);
+			end = MAX(end, batch->ranges[i].end);
+			batch->ranges[i] = batch->ranges[--batch->count];
+			merged = true;
+			break;
+		}
+	} while (merged);
+
+	if (batch->count == ARRAY_SIZE(batch->ranges)) {
+		return -ENOSPC;
+	}
+
+	batch->ranges[batch->count].start = start;
+	batch->ranges[batch->count].end = end;
+	batch->count++;
+
+	return 0;
+}
+
+static int batch_commit(struct sys_cache_batch *batch,
+			int (*op)(void *addr, size_t size))
+{
+	int ret = 0;
+
+	for (uint8_t i = 0; i < batch->count; i++) {
+		int err = op((void *)batch->ranges[i].start,
+			     batch->ranges[i].end - batch->ranges[i].start);
+
+		if (err != 0) {
+			ret = err;
+		}
+	}
+
+	batch->count = 0;
+
+	return ret;
+}
+
+static int batch_flush_op(void *addr, size_t size)
+{
+	return sys_cache_data_flush_range(addr, size);
+}
+
+static int batch_invd_op(void *addr, size_t size)
+{
+	return sys_cache_data_invd_range(addr, size);
+}
+
+static int batch_flush_and_invd_op(void *addr, size_t size)
+{
+	return sys_cache_data_flush_and_invd_range(addr, size);
+}
+
+int sys_cache_data_batch_flush(struct sys_cache_batch *batch)
+{
+	return batch_commit(batch, batch_flush_op);
+}
+
+int sys_cache_data_batch_invd(struct sys_cache_batch *batch)
+{
+	return batch_commit(batch, batch_invd_op);
+}
+
+int sys_cache_data_batch_flush_and_invd(struct sys_cache_batch *batch)
+{
+	return batch_commit(batch, batch_flush_and_invd_op);
+}
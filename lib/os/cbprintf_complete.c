@@ -741,6 +741,58 @@ static void _ldiv10(uint64_t *v)
 	_ldiv5(v);
 }
 
+#ifdef CONFIG_CBPRINTF_FP_FAST_SCALING
+
+/* Division by 25, used to scale by two decimal digits per iteration.
+ * Same technique and bias as _ldiv5 above, except that the multiplier
+ * (1 << 64) / 25 = 0x0a3d70a3d70a3d70 is no longer a repeated 32-bit
+ * pattern. Unlike _ldiv5 the result may fall short of the exact
+ * quotient by 1 for values close to the top of the range, which is
+ * insignificant for the approximate scaling this is used for.
+ */
+static void _ldiv25(uint64_t *v)
+{
+#ifdef CONFIG_64BIT
+	*v /= 25U;
+#else
+	uint32_t v_lo = *v;
+	uint32_t v_hi = *v >> 32;
+	uint32_t m_lo = 0xd70a3d70;
+	uint32_t m_hi = 0x0a3d70a3;
+	uint64_t result;
+
+	__asm__ ("" : "+r" (m_lo), "+r" (m_hi));
+
+	/* Initial bias, as in _ldiv5. */
+	result = ((uint64_t)m_hi << 32) | m_lo;
+
+	result += (uint64_t)v_lo * m_lo;
+	result >>= 32;
+	result += (uint64_t)v_lo * m_hi;
+	result += (uint64_t)v_hi * m_lo;
+	result >>= 32;
+	result += (uint64_t)v_hi * m_hi;
+
+	*v = result;
+#endif /* CONFIG_64BIT */
+}
+
+/* Rounding bias for the last digit printed: 0.5 in the BIT64(59) fixed
+ * point representation, scaled down by 10^index. The entries are exactly
+ * what repeated application of _ldiv10() to BIT64(59) produces, so using
+ * the table instead does not change any output.
+ */
+static const uint64_t fp_round_scale[] = {
+	0x0800000000000000, 0x00cccccccccccccc, 0x00147ae147ae147a,
+	0x00020c49ba5e353f, 0x0000346dc5d63886, 0x0000053e2d6238da,
+	0x0000008637bd05af, 0x0000000d6bf94d5e, 0x000000015798ee23,
+	0x00000000225c17d0, 0x00000000036f9bfb, 0x000000000057f5ff,
+	0x000000000008cbcc, 0x000000000000e12e, 0x0000000000001684,
+	0x0000000000000240, 0x0000000000000039,
+};
+
+#endif /* CONFIG_CBPRINTF_FP_FAST_SCALING */
+
 /* Extract the next decimal character in the converted representation of a
  * fractional component.
  */
@@ -1101,6 +1153,38 @@ static char *encode_float(double value,
 	 */
 	int decexp = 0;
 
+#ifdef CONFIG_CBPRINTF_FP_FAST_SCALING
+	/*
+	 * Scale by two decimal digits per iteration while far away from
+	 * the target exponent range, falling through to the single-digit
+	 * loops below for the final steps.
+	 */
+	while (expo < -10) {
+		do {
+			fract >>= 1;
+			expo++;
+		} while ((uint32_t)(fract >> 32) >= (UINT32_MAX / 25U));
+
+		/* Perform fract * 25 * 4 / 100 */
+		fract *= 25U;
+		expo += 2;
+		decexp -= 2;
+	}
+
+	while (expo > 9) {
+		/* Perform fract / 25 / 4 * 100, rounding as for _ldiv5 */
+		fract += 12;
+		_ldiv25(&fract);
+		expo -= 2;
+		decexp += 2;
+
+		do {
+			fract <<= 1;
+			expo--;
+		} while (!(fract & BIT_63));
+	}
+#endif /* CONFIG_CBPRINTF_FP_FAST_SCALING */
+
 	while (expo < -2) {
 		/*
 		 * Make room to allow a multiplication by 5 without overflow.
@@ -1178,10 +1262,14 @@ static char *encode_float(double value,
 	}
 
 	/* Round the value to the last digit being printed. */
+#ifdef CONFIG_CBPRINTF_FP_FAST_SCALING
+	uint64_t round = fp_round_scale[decimals];
+#else
 	uint64_t round = BIT64(59); /* 0.5 */
 	while (decimals-- != 0) {
 		_ldiv10(&round);
 	}
+#endif /* CONFIG_CBPRINTF_FP_FAST_SCALING */
 	fract += round;
 	/* Make sure rounding didn't make fract >= 1.0 */
 	if (fract >= BIT64(60)) {
@@ -1406,11 +1494,82 @@ int z_cbvprintf_impl(cbprintf_cb __out, void *ctx, const char *fp,
 
 	while (*fp != 0) {
 		if (*fp != '%') {
-			OUTC(*fp);
-			++fp;
+			/* Emit the run of literal characters up to the next
+			 * conversion in one go.
+			 */
+			const char *sp = fp;
+
+			do {
+				++fp;
+			} while ((*fp != 0) && (*fp != '%'));
+
+			OUTS(sp, fp);
 			continue;
 		}
 
+#if defined(CONFIG_CBPRINTF_SIMPLE_SPEC_FAST_PATH)
+		/* Specialized handling of conversions without flags, width,
+		 * precision, or length modifiers, which skips the full
+		 * conversion machinery below. Tagged arguments carry a tag
+		 * per conversion and keep to the generic path.
+		 */
+		if (!tagged_ap) {
+			switch (fp[1]) {
+			case '%':
+				OUTC('%');
+				fp += 2;
+				continue;
+
+			case 'c':
+				OUTC((unsigned char)va_arg(ap, int));
+				fp += 2;
+				continue;
+
+			case 's': {
+				const char *str = va_arg(ap, const char *);
+
+				OUTS(str, NULL);
+				fp += 2;
+				continue;
+			}
+
+			case 'd':
+			case 'i':
+			case 'u':
+			case 'x':
+			case 'X': {
+				struct conversion fconv = {
+					.specifier = (unsigned char)fp[1],
+				};
+				uint_value_type uval;
+				char *bp;
+
+				if ((fp[1] == 'd') || (fp[1] == 'i')) {
+					int val = va_arg(ap, int);
+
+					if (val < 0) {
+						OUTC('-');
+					}
+					uval = (val < 0) ?
+					       -(uint_value_type)val :
+					       (uint_value_type)val;
+				} else {
+					uval = va_arg(ap, unsigned int);
+				}
+
+				bp = encode_uint(uval, &fconv, buf,
+						 buf + sizeof(buf));
+				OUTS(bp, buf + sizeof(buf));
+				fp += 2;
+				continue;
+			}
+
+			default:
+				break;
+			}
+		}
+#endif /* CONFIG_CBPRINTF_SIMPLE_SPEC_FAST_PATH */
+
 		/* Force union into RAM with conversion state to
 		 * mitigate LLVM code generation bug.
 		 */
@@ -30,6 +30,11 @@ struct fd_entry {
 	void *obj;
 	const struct fd_op_vtable *vtable;
 	atomic_t refcount;
+	/* Set once zvfs_close() has committed to closing the entry; new
+	 * references are refused and the backend close runs when the last
+	 * existing reference is dropped.
+	 */
+	atomic_t closing;
 	struct k_mutex lock;
 	struct k_condvar cond;
 	size_t offset;
@@ -75,14 +80,50 @@ static struct fd_entry fdtable[CONFIG_ZVFS_OPEN_MAX] = {
 
 static K_MUTEX_DEFINE(fdtable_lock);
 
+static int z_fd_unref(int fd, int *close_res);
+
 static int z_fd_ref(int fd)
 {
 	return atomic_inc(&fdtable[fd].refcount) + 1;
 }
 
-static int z_fd_unref(int fd)
+static int z_fd_tryref(int fd)
+{
+	atomic_val_t old_rc;
+
+	/* A reference may only be taken on an entry that is still in use;
+	 * incrementing a zeroed refcount would resurrect an entry that
+	 * zvfs_reserve_fd() considers free. Loop statement below executes
+	 * atomic increment if refcount value is greater than zero.
+	 * Otherwise, refcount is not going to be written.
+	 */
+	do {
+		old_rc = atomic_get(&fdtable[fd].refcount);
+		if (!old_rc) {
+			errno = EBADF;
+			return -1;
+		}
+	} while (!atomic_cas(&fdtable[fd].refcount, old_rc, old_rc + 1));
+
+	if (atomic_get(&fdtable[fd].closing) != 0) {
+		/* zvfs_close() has committed to closing the entry; do not
+		 * admit new I/O. Dropping the reference taken above may make
+		 * this the last user, running the deferred backend close.
+		 */
+		(void)z_fd_unref(fd, NULL);
+		errno = EBADF;
+		return -1;
+	}
+
+	return 0;
+}
+
+static int z_fd_unref(int fd, int *close_res)
 {
+	const struct fd_op_vtable *vtable = NULL;
 	atomic_val_t old_rc;
+	void *obj = NULL;
+	uint32_t mode = 0;
 
 	/* Reference counter must be checked to avoid decrement refcount below
 	 * zero causing file descriptor leak. Loop statement below executes
@@ -94,12 +135,45 @@ static int z_fd_unref(int fd)
 		if (!old_rc) {
 			return 0;
 		}
+		if (old_rc == 1) {
+			/* About to drop the last reference: snapshot the
+			 * entry before the count reaches zero and the entry
+			 * becomes eligible for reuse.
+			 */
+			obj = fdtable[fd].obj;
+			vtable = fdtable[fd].vtable;
+			mode = fdtable[fd].mode;
+		}
 	} while (!atomic_cas(&fdtable[fd].refcount, old_rc, old_rc - 1));
 
 	if (old_rc != 1) {
 		return old_rc - 1;
 	}
 
+	if ((atomic_get(&fdtable[fd].closing) != 0) &&
+	    (vtable != NULL) && (vtable->close != NULL)) {
+		int res;
+
+		/* Last user of an entry zvfs_close() committed to closing:
+		 * release the backend object. Any in-flight I/O finished
+		 * before this reference was dropped, so the object cannot
+		 * be dereferenced after this point.
+		 */
+		if (mode & ZVFS_MODE_IFSOCK) {
+			/* Network socket needs to know socket number so pass
+			 * it via close2() call.
+			 */
+			res = vtable->close2(obj, fd);
+		} else {
+			res = vtable->close(obj);
+		}
+
+		if (close_res != NULL) {
+			*close_res = res;
+		}
+	}
+
+	atomic_clear(&fdtable[fd].closing);
 	fdtable[fd].obj = NULL;
 	fdtable[fd].vtable = NULL;
 
@@ -249,6 +323,7 @@ int zvfs_reserve_fd(void)
 		fdtable[fd].obj = NULL;
 		fdtable[fd].vtable = NULL;
 		fdtable[fd].offset = 0;
+		atomic_clear(&fdtable[fd].closing);
 		k_mutex_init(&fdtable[fd].lock);
 		k_condvar_init(&fdtable[fd].cond);
 	}
@@ -294,7 +369,7 @@ void zvfs_finalize_typed_fd(int fd, void *obj, const struct fd_op_vtable *vtable
 void zvfs_free_fd(int fd)
 {
 	/* Assumes fd was already bounds-checked. */
-	(void)z_fd_unref(fd);
+	(void)z_fd_unref(fd, NULL);
 }
 
 int zvfs_alloc_fd(void *obj, const struct fd_op_vtable *vtable)
@@ -329,7 +404,13 @@ static ssize_t zvfs_rw(int fd, void *buf, size_t sz, bool is_write, const size_t
 		return -1;
 	}
 
-	(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
+	/* Hold a reference over the I/O call so that a concurrent close
+	 * cannot release the entry (and a subsequent open reuse it) while
+	 * it is still being accessed here.
+	 */
+	if (z_fd_tryref(fd) < 0) {
+		return -1;
+	}
 
 	prw = supports_pread_pwrite(fdtable[fd].mode);
 	if (from_offset != NULL && !prw) {
@@ -339,7 +420,16 @@ static ssize_t zvfs_rw(int fd, void *buf, size_t sz, bool is_write, const size_t
 		 */
 		errno = ENOTSUP;
 		res = -1;
-		goto unlock;
+		goto unref;
+	}
+
+	/* Only seekable file types share a per-fd offset between threads;
+	 * for the other types (e.g. sockets) the lock is skipped so that
+	 * concurrent I/O calls do not serialize here, and the backends
+	 * synchronize on their own locks as needed.
+	 */
+	if (prw) {
+		(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
 	}
 
 	/* If there is no specified from_offset, then use the current offset of the fd */
@@ -368,8 +458,12 @@ static ssize_t zvfs_rw(int fd, void *buf, size_t sz, bool is_write, const size_t
 		fdtable[fd].offset += res;
 	}
 
-unlock:
-	k_mutex_unlock(&fdtable[fd].lock);
+	if (prw) {
+		k_mutex_unlock(&fdtable[fd].lock);
+	}
+
+unref:
+	(void)z_fd_unref(fd, NULL);
 
 	return res;
 }
@@ -392,21 +486,18 @@ int zvfs_close(int fd)
 		return -1;
 	}
 
-	(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
-	if (fdtable[fd].vtable->close != NULL) {
-		/* close() is optional - e.g. stdinout_fd_op_vtable */
-		if (fdtable[fd].mode & ZVFS_MODE_IFSOCK) {
-			/* Network socket needs to know socket number so pass
-			 * it via close2() call.
-			 */
-			res = fdtable[fd].vtable->close2(fdtable[fd].obj, fd);
-		} else {
-			res = fdtable[fd].vtable->close(fdtable[fd].obj);
-		}
-	}
-	k_mutex_unlock(&fdtable[fd].lock);
-
-	zvfs_free_fd(fd);
+	/* zvfs_rw() accesses non-seekable fds without taking the entry lock,
+	 * pinning the entry with a reference instead. Committing to the
+	 * close first stops new references from being taken; the backend
+	 * close then runs when the last reference is dropped, so an I/O
+	 * call still in progress on another thread cannot dereference the
+	 * released object. With no I/O in flight that is the z_fd_unref()
+	 * below and the backend result is returned; otherwise the close is
+	 * deferred to the in-flight caller and 0 is returned, as with an
+	 * asynchronously reported close error.
+	 */
+	atomic_set(&fdtable[fd].closing, 1);
+	(void)z_fd_unref(fd, &res);
 
 	return res;
 }
@@ -98,6 +98,110 @@ static int char_out(int c, void *ctx_p)
 	return _char_out(c);
 }
 
+#ifdef CONFIG_PRINTK_BUFFERED
+
+BUILD_ASSERT((CONFIG_PRINTK_BUFFERED_RING_SIZE &
+	      (CONFIG_PRINTK_BUFFERED_RING_SIZE - 1)) == 0,
+	     "ring size must be a power of two");
+
+/*
+ * Per-CPU character ring. The producer side runs with interrupts locked,
+ * so each ring has a single producer; the flush thread is the single
+ * consumer, synchronized through the head/tail atomics only.
+ */
+struct printk_ring {
+	atomic_t head;    /* written by producer only */
+	atomic_t tail;    /* written by consumer only */
+	atomic_t dropped; /* bytes lost to ring overflow */
+	uint8_t buf[CONFIG_PRINTK_BUFFERED_RING_SIZE];
+};
+
+static struct printk_ring printk_rings[CONFIG_MP_MAX_NUM_CPUS];
+static K_SEM_DEFINE(printk_flush_sem, 0, 1);
+
+/* once a fatal error hits, fall back to synchronous output */
+static bool printk_panic_mode;
+
+static int buffered_char_out(int c, void *ctx_p)
+{
+	struct printk_ring *ring;
+	unsigned int key;
+	uint32_t head;
+
+	ARG_UNUSED(ctx_p);
+
+	key = arch_irq_lock();
+
+	ring = &printk_rings[IS_ENABLED(CONFIG_SMP) ? _current_cpu->id : 0];
+	head = (uint32_t)atomic_get(&ring->head);
+
+	if ((head - (uint32_t)atomic_get(&ring->tail)) >=
+	    CONFIG_PRINTK_BUFFERED_RING_SIZE) {
+		atomic_inc(&ring->dropped);
+	} else {
+		ring->buf[head & (CONFIG_PRINTK_BUFFERED_RING_SIZE - 1)] = (uint8_t)c;
+		atomic_set(&ring->head, head + 1);
+	}
+
+	arch_irq_unlock(key);
+
+	return c;
+}
+
+static void printk_ring_drain(struct printk_ring *ring)
+{
+	uint32_t tail = (uint32_t)atomic_get(&ring->tail);
+	atomic_val_t dropped;
+
+	while (tail != (uint32_t)atomic_get(&ring->head)) {
+		_char_out(ring->buf[tail & (CONFIG_PRINTK_BUFFERED_RING_SIZE - 1)]);
+		tail++;
+		atomic_set(&ring->tail, tail);
+	}
+
+	dropped = atomic_clear(&ring->dropped);
+	if (dropped != 0) {
+		char msg[40];
+		int len = snprintk(msg, sizeof(msg),
+				   "\n<printk dropped %ld bytes>\n", (long)dropped);
+
+		for (int i = 0; i < len; i++) {
+			_char_out(msg[i]);
+		}
+	}
+}
+
+/* drain all rings synchronously; called from the fatal error path */
+void printk_flush(void)
+{
+	printk_panic_mode = true;
+
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		printk_ring_drain(&printk_rings[i]);
+	}
+}
+
+static void printk_flush_thread(void *a, void *b, void *c)
+{
+	ARG_UNUSED(a);
+	ARG_UNUSED(b);
+	ARG_UNUSED(c);
+
+	while (true) {
+		(void)k_sem_take(&printk_flush_sem, K_FOREVER);
+
+		for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+			printk_ring_drain(&printk_rings[i]);
+		}
+	}
+}
+
+K_THREAD_DEFINE(printk_flush_tid, CONFIG_PRINTK_BUFFERED_THREAD_STACK_SIZE,
+		printk_flush_thread, NULL, NULL, NULL,
+		K_PRIO_PREEMPT(CONFIG_NUM_PREEMPT_PRIORITIES - 1), 0, 0);
+
+#endif /* CONFIG_PRINTK_BUFFERED */
+
 void vprintk(const char *fmt, va_list ap)
 {
 	if (IS_ENABLED(CONFIG_LOG_PRINTK)) {
@@ -124,6 +228,20 @@ void vprintk(const char *fmt, va_list ap)
 			buf_flush(&ctx);
 		}
 	} else {
+#ifdef CONFIG_PRINTK_BUFFERED
+		if (!printk_panic_mode) {
+#ifdef CONFIG_PICOLIBC
+			FILE buffered = FDEV_SETUP_STREAM(
+				(int(*)(char, FILE *))buffered_char_out,
+				NULL, NULL, _FDEV_SETUP_WRITE);
+			(void) vfprintf(&buffered, fmt, ap);
+#else
+			cbvprintf(buffered_char_out, NULL, fmt, ap);
+#endif
+			k_sem_give(&printk_flush_sem);
+			return;
+		}
+#endif /* CONFIG_PRINTK_BUFFERED */
 #ifdef CONFIG_PRINTK_SYNC
 		k_spinlock_key_t key = k_spin_lock(&lock);
 #endif
@@ -146,6 +264,15 @@ EXPORT_SYMBOL(vprintk);
 void z_impl_k_str_out(char *c, size_t n)
 {
 	size_t i;
+#ifdef CONFIG_PRINTK_BUFFERED
+	if (!printk_panic_mode) {
+		for (i = 0; i < n; i++) {
+			buffered_char_out(c[i], NULL);
+		}
+		k_sem_give(&printk_flush_sem);
+		return;
+	}
+#endif /* CONFIG_PRINTK_BUFFERED */
 #ifdef CONFIG_PRINTK_SYNC
 	k_spinlock_key_t key = k_spin_lock(&lock);
 #endif
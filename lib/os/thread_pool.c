@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/thread_pool.h>
+#include <zephyr/sys/iterable_sections.h>
+
+static FUNC_NORETURN void pool_loop(void *p0, void *p1, void *p2)
+{
+	struct k_thread_pool_worker *worker = p0;
+	struct k_thread_pool *pool = worker->pool;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+
+	while (true) {
+		k_sem_take(&worker->wakeup, K_FOREVER);
+
+		worker->entry(worker->p1, worker->p2, worker->p3);
+
+		key = k_spin_lock(&pool->lock);
+		sys_slist_prepend(&pool->idle, &worker->node);
+		k_spin_unlock(&pool->lock, key);
+
+		k_sem_give(&pool->idle_sem);
+	}
+}
+
+int k_thread_pool_submit(struct k_thread_pool *pool, k_thread_entry_t entry,
+			 void *p1, void *p2, void *p3, k_timeout_t timeout)
+{
+	struct k_thread_pool_worker *worker;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+	int ret;
+
+	__ASSERT_NO_MSG(entry != NULL);
+
+	ret = k_sem_take(&pool->idle_sem, timeout);
+	if (ret != 0) {
+		return ret;
+	}
+
+	key = k_spin_lock(&pool->lock);
+	node = sys_slist_get(&pool->idle);
+	k_spin_unlock(&pool->lock, key);
+
+	/* The semaphore taken above guarantees an idle worker exists */
+	__ASSERT_NO_MSG(node != NULL);
+
+	worker = CONTAINER_OF(node, struct k_thread_pool_worker, node);
+
+	worker->entry = entry;
+	worker->p1 = p1;
+	worker->p2 = p2;
+	worker->p3 = p3;
+
+	k_sem_give(&worker->wakeup);
+
+	return 0;
+}
+
+static int static_init(void)
+{
+	STRUCT_SECTION_FOREACH(k_thread_pool_initparam, pp) {
+		struct k_thread_pool *pool = pp->pool;
+
+		sys_slist_init(&pool->idle);
+		k_sem_init(&pool->idle_sem, pp->num, pp->num);
+		pool->workers = pp->workers;
+		pool->num = pp->num;
+
+		for (uint32_t i = 0; i < pp->num; i++) {
+			struct k_thread_pool_worker *worker = &pp->workers[i];
+			uintptr_t ssz = K_THREAD_STACK_LEN(pp->stack_size);
+
+			worker->pool = pool;
+			k_sem_init(&worker->wakeup, 0, 1);
+			sys_slist_append(&pool->idle, &worker->node);
+
+			k_thread_create(&worker->thread,
+					(k_thread_stack_t *)&pp->stacks[ssz * i],
+					pp->stack_size, pool_loop,
+					worker, NULL, NULL,
+					pp->prio, 0, K_NO_WAIT);
+		}
+	}
+
+	return 0;
+}
+
+SYS_INIT(static_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/zvfs/epoll.h>
+
+#define ZVFS_EPOLL_EVENTS_SET                                                                      \
+	(ZVFS_POLLIN | ZVFS_POLLPRI | ZVFS_POLLOUT | ZVFS_POLLERR | ZVFS_POLLHUP | ZVFS_POLLNVAL)
+
+/* lives in zvfs_poll.c, which has no separate header */
+int zvfs_poll_internal(struct zvfs_pollfd *fds, int nfds, k_timeout_t timeout);
+
+struct zvfs_epoll_entry {
+	int fd;
+	uint32_t events;
+	union zvfs_epoll_data data;
+};
+
+struct zvfs_epoll {
+	struct k_mutex lock;
+	struct zvfs_epoll_entry entries[CONFIG_ZVFS_EPOLL_MAX_FDS];
+	int num_entries;
+	bool in_use;
+};
+
+SYS_BITARRAY_DEFINE_STATIC(epolls_bitarray, CONFIG_ZVFS_EPOLL_MAX);
+static struct zvfs_epoll epolls[CONFIG_ZVFS_EPOLL_MAX];
+static const struct fd_op_vtable zvfs_epoll_fd_vtable;
+
+static struct zvfs_epoll_entry *zvfs_epoll_find_entry(struct zvfs_epoll *ep, int fd)
+{
+	for (int i = 0; i < ep->num_entries; i++) {
+		if (ep->entries[i].fd == fd) {
+			return &ep->entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+static ssize_t zvfs_epoll_read_op(void *obj, void *buf, size_t sz)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(sz);
+
+	errno = EOPNOTSUPP;
+	return -1;
+}
+
+static ssize_t zvfs_epoll_write_op(void *obj, const void *buf, size_t sz)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(sz);
+
+	errno = EOPNOTSUPP;
+	return -1;
+}
+
+static int zvfs_epoll_close_op(void *obj)
+{
+	int err;
+	struct zvfs_epoll *ep = (struct zvfs_epoll *)obj;
+
+	err = k_mutex_lock(&ep->lock, K_FOREVER);
+	__ASSERT(err == 0, "k_mutex_lock() failed: %d", err);
+
+	if (!ep->in_use) {
+		k_mutex_unlock(&ep->lock);
+		errno = EBADF;
+		return -1;
+	}
+
+	err = sys_bitarray_free(&epolls_bitarray, 1, ep - epolls);
+	__ASSERT(err == 0, "sys_bitarray_free() failed: %d", err);
+
+	ep->in_use = false;
+	ep->num_entries = 0;
+
+	err = k_mutex_unlock(&ep->lock);
+	__ASSERT(err == 0, "k_mutex_unlock() failed: %d", err);
+
+	return 0;
+}
+
+static int zvfs_epoll_ioctl_op(void *obj, unsigned int request, va_list args)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(request);
+	ARG_UNUSED(args);
+
+	errno = EOPNOTSUPP;
+	return -1;
+}
+
+static const struct fd_op_vtable zvfs_epoll_fd_vtable = {
+	.read = zvfs_epoll_read_op,
+	.write = zvfs_epoll_write_op,
+	.close = zvfs_epoll_close_op,
+	.ioctl = zvfs_epoll_ioctl_op,
+};
+
+int zvfs_epoll_create(void)
+{
+	int fd;
+	size_t offset;
+	struct zvfs_epoll *ep;
+
+	if (sys_bitarray_alloc(&epolls_bitarray, 1, &offset) < 0) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	ep = &epolls[offset];
+
+	fd = zvfs_reserve_fd();
+	if (fd < 0) {
+		sys_bitarray_free(&epolls_bitarray, 1, offset);
+		return -1;
+	}
+
+	k_mutex_init(&ep->lock);
+	ep->num_entries = 0;
+	ep->in_use = true;
+
+	zvfs_finalize_fd(fd, ep, &zvfs_epoll_fd_vtable);
+
+	return fd;
+}
+
+int zvfs_epoll_ctl(int epfd, int op, int fd, const struct zvfs_epoll_event *event)
+{
+	int err;
+	int ret = 0;
+	struct zvfs_epoll *ep;
+	struct zvfs_epoll_entry *entry;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EBADF);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (fd < 0 || fd == epfd) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (op != ZVFS_EPOLL_CTL_DEL) {
+		if (event == NULL) {
+			errno = EFAULT;
+			return -1;
+		}
+
+		if (event->events & ~ZVFS_EPOLL_EVENTS_SET) {
+			errno = EINVAL;
+			return -1;
+		}
+	}
+
+	err = k_mutex_lock(&ep->lock, K_FOREVER);
+	__ASSERT(err == 0, "k_mutex_lock() failed: %d", err);
+
+	entry = zvfs_epoll_find_entry(ep, fd);
+
+	switch (op) {
+	case ZVFS_EPOLL_CTL_ADD:
+		if (entry != NULL) {
+			errno = EEXIST;
+			ret = -1;
+			break;
+		}
+
+		if (ep->num_entries == CONFIG_ZVFS_EPOLL_MAX_FDS) {
+			errno = ENOMEM;
+			ret = -1;
+			break;
+		}
+
+		entry = &ep->entries[ep->num_entries++];
+		entry->fd = fd;
+		entry->events = event->events;
+		entry->data = event->data;
+		break;
+
+	case ZVFS_EPOLL_CTL_MOD:
+		if (entry == NULL) {
+			errno = ENOENT;
+			ret = -1;
+			break;
+		}
+
+		entry->events = event->events;
+		entry->data = event->data;
+		break;
+
+	case ZVFS_EPOLL_CTL_DEL:
+		if (entry == NULL) {
+			errno = ENOENT;
+			ret = -1;
+			break;
+		}
+
+		*entry = ep->entries[--ep->num_entries];
+		break;
+
+	default:
+		errno = EINVAL;
+		ret = -1;
+		break;
+	}
+
+	err = k_mutex_unlock(&ep->lock);
+	__ASSERT(err == 0, "k_mutex_unlock() failed: %d", err);
+
+	return ret;
+}
+
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout)
+{
+	int err;
+	int ret;
+	int nfds;
+	int nready = 0;
+	struct zvfs_epoll *ep;
+	struct zvfs_pollfd pfds[CONFIG_ZVFS_EPOLL_MAX_FDS];
+	union zvfs_epoll_data data[CONFIG_ZVFS_EPOLL_MAX_FDS];
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EBADF);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (events == NULL || maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	/*
+	 * Snapshot the interest list so that the instance lock is not held
+	 * while blocked in poll. Registration changes made by other threads
+	 * during the wait take effect on the next call.
+	 */
+	err = k_mutex_lock(&ep->lock, K_FOREVER);
+	__ASSERT(err == 0, "k_mutex_lock() failed: %d", err);
+
+	nfds = ep->num_entries;
+	for (int i = 0; i < nfds; i++) {
+		pfds[i].fd = ep->entries[i].fd;
+		pfds[i].events = (short)ep->entries[i].events;
+		pfds[i].revents = 0;
+		data[i] = ep->entries[i].data;
+	}
+
+	err = k_mutex_unlock(&ep->lock);
+	__ASSERT(err == 0, "k_mutex_unlock() failed: %d", err);
+
+	ret = zvfs_poll_internal(pfds, nfds, timeout < 0 ? K_FOREVER : K_MSEC(timeout));
+	if (ret <= 0) {
+		return ret;
+	}
+
+	for (int i = 0; i < nfds && nready < maxevents; i++) {
+		if (pfds[i].revents == 0) {
+			continue;
+		}
+
+		events[nready].events = (uint32_t)pfds[i].revents;
+		events[nready].data = data[i];
+		nready++;
+	}
+
+	return nready;
+}
@@ -100,6 +100,8 @@ static int zvfs_eventfd_poll_update(struct zvfs_eventfd *efd,
 
 static int zvfs_eventfd_read_locked(struct zvfs_eventfd *efd, zvfs_eventfd_t *value)
 {
+	bool was_saturated;
+
 	if (!zvfs_eventfd_is_in_use(efd)) {
 		/* file descriptor has been closed */
 		return -EBADF;
@@ -110,6 +112,8 @@ static int zvfs_eventfd_read_locked(struct zvfs_eventfd *efd, zvfs_eventfd_t *va
 		return -EAGAIN;
 	}
 
+	was_saturated = (efd->cnt == UINT64_MAX - 1);
+
 	/* successful read */
 	if (zvfs_eventfd_is_semaphore(efd)) {
 		*value = 1;
@@ -123,7 +127,12 @@ static int zvfs_eventfd_read_locked(struct zvfs_eventfd *efd, zvfs_eventfd_t *va
 		k_poll_signal_reset(&efd->read_sig);
 	}
 
-	k_poll_signal_raise(&efd->write_sig, 0);
+	/* pollers only pend on write_sig while the counter is saturated, so
+	 * a raise can only matter when this read released the saturation
+	 */
+	if (was_saturated) {
+		k_poll_signal_raise(&efd->write_sig, 0);
+	}
 
 	return 0;
 }
@@ -148,13 +157,23 @@ static int zvfs_eventfd_write_locked(struct zvfs_eventfd *efd, zvfs_eventfd_t *v
 	}
 
 	/* successful write */
+	bool was_empty = (efd->cnt == 0);
+
 	efd->cnt = result;
 
 	if (efd->cnt == (UINT64_MAX - 1)) {
 		k_poll_signal_reset(&efd->write_sig);
 	}
 
-	k_poll_signal_raise(&efd->read_sig, 0);
+	/* each raise wakes at most one poller. In semaphore mode every unit
+	 * written can satisfy one more reader, so raise on every write; in
+	 * normal mode the first reader drains the whole counter, so raising
+	 * again while the signal is still set would only wake a poller that
+	 * finds the counter already emptied by the first one.
+	 */
+	if (zvfs_eventfd_is_semaphore(efd) || was_empty) {
+		k_poll_signal_raise(&efd->read_sig, 0);
+	}
 
 	return 0;
 }
@@ -306,6 +325,9 @@ static ssize_t zvfs_eventfd_rw_op(void *obj, void *buf, size_t sz,
 	struct zvfs_eventfd *efd = obj;
 	struct k_mutex *lock = NULL;
 	struct k_condvar *cond = NULL;
+	zvfs_eventfd_t cnt_before;
+	zvfs_eventfd_t cnt_after;
+	bool wake = false;
 
 	if (sz < sizeof(zvfs_eventfd_t)) {
 		errno = EINVAL;
@@ -360,7 +382,9 @@ static ssize_t zvfs_eventfd_rw_op(void *obj, void *buf, size_t sz,
 		/* retake the spinlock */
 		key = k_spin_lock(&efd->lock);
 
+		cnt_before = efd->cnt;
 		ret = op(efd, buf);
+		cnt_after = efd->cnt;
 		switch (ret) {
 		case -EAGAIN:
 			/* not an error in blocking mode. break and try again */
@@ -387,9 +411,19 @@ static ssize_t zvfs_eventfd_rw_op(void *obj, void *buf, size_t sz,
 
 unlock_mutex:
 	k_spin_unlock(&efd->lock, key);
-	/* only wake a single waiter */
-	err = k_condvar_signal(cond);
-	__ASSERT(err == 0, "k_condvar_signal() failed: %d", err);
+	/* only wake a single waiter, and only when this operation can have
+	 * unblocked one: a write gives blocked readers data to consume and
+	 * a read gives blocked writers room (a writer blocks whenever its
+	 * value would overflow the current counter, so any decrease may
+	 * unblock it, not just leaving saturation). Error exits and no-op
+	 * operations leave the counter untouched and would just wake a
+	 * waiter so that it can observe -EAGAIN and go back to sleep.
+	 */
+	wake = (cnt_after != cnt_before);
+	if (wake) {
+		err = k_condvar_signal(cond);
+		__ASSERT(err == 0, "k_condvar_signal() failed: %d", err);
+	}
 	err = k_mutex_unlock(lock);
 	__ASSERT(err == 0, "k_mutex_unlock() failed: %d", err);
 	goto out;
@@ -115,6 +115,42 @@ static int acquire_mutex(pthread_mutex_t *mu, k_timeout_t timeout)
 	struct k_mutex *m = NULL;
 	struct k_thread *owner = NULL;
 
+	/* Fast path for initialized normal mutexes not owned by this thread.
+	 * Handle resolution is lock-free and k_mutex_lock() resolves
+	 * contention itself, so the pool lock is only needed to serialize
+	 * auto-initialization of statically initialized mutexes and the
+	 * recursion and error checks, which must read the owner and lock
+	 * count consistently. Reading the owner without the lock is benign
+	 * here: only the current thread can make itself the owner, or stop
+	 * being it.
+	 */
+	if (is_pthread_obj_initialized(*mu)) {
+		m = get_posix_mutex(*mu);
+		if (m == NULL) {
+			return EINVAL;
+		}
+
+		bit = posix_mutex_to_offset(m);
+		if ((posix_mutex_type[bit] == PTHREAD_MUTEX_NORMAL) &&
+		    (m->owner != k_current_get())) {
+			ret = k_mutex_lock(m, timeout);
+			if (ret == -EAGAIN) {
+				LOG_DBG("Timeout locking mutex %p", m);
+				return ETIMEDOUT;
+			}
+
+			if (ret < 0) {
+				LOG_DBG("k_mutex_lock() failed: %d", ret);
+				return -ret;
+			}
+
+			LOG_DBG("Locked mutex %p", m);
+			return 0;
+		}
+
+		m = NULL;
+	}
+
 	SYS_SEM_LOCK(&lock) {
 		m = to_posix_mutex(mu);
 		if (m == NULL) {
@@ -78,6 +78,155 @@ static const struct smf_state *get_lca_of(const struct smf_state *source,
 	return NULL;
 }
 
+/**
+ * @brief Find the topmost state of a transition, whose entry/exit actions
+ *        are not executed
+ *
+ * @param executing transition source
+ * @param new_state transition destination
+ * @return topmost state, or NULL if states have no common ancestor
+ */
+static const struct smf_state *get_topmost_of(const struct smf_state *executing,
+					      const struct smf_state *new_state)
+{
+	if (share_paren(executing, new_state)) {
+		/* new state is a parent of where we are now */
+		return new_state;
+	} else if (share_paren(new_state, executing)) {
+		/* we are a parent of the new state */
+		return executing;
+	}
+
+	/* not directly related, find LCA */
+	return get_lca_of(executing, new_state);
+}
+
+#ifdef CONFIG_SMF_TRANSITION_CACHE
+/**
+ * @brief Compile a transition into the next free or oldest cache slot
+ *
+ * @param ctx State machine context
+ * @param source transition source
+ * @param dest transition destination, as passed to smf_set_state()
+ * @return compiled transition, or NULL if the transition is too deep to cache
+ */
+static struct smf_transition *smf_transition_compile(struct smf_ctx *const ctx,
+						     const struct smf_state *source,
+						     const struct smf_state *dest)
+{
+	struct smf_transition *trans = &ctx->transitions[ctx->transition_next];
+	const struct smf_state *target = dest;
+	uint8_t num_entries = 0;
+
+	trans->topmost = get_topmost_of(source, dest);
+
+#ifdef CONFIG_SMF_INITIAL_TRANSITION
+	/*
+	 * The final target will be the deepest leaf state that
+	 * the target contains. Set that as the real target.
+	 */
+	while (target->initial) {
+		target = target->initial;
+	}
+#endif
+
+	/* Count the entry actions between topmost and target */
+	for (const struct smf_state *state = target; state != NULL && state != trans->topmost;
+	     state = state->parent) {
+		num_entries++;
+	}
+
+	if (num_entries > CONFIG_SMF_TRANSITION_CACHE_DEPTH) {
+		/* Too deep to cache, fall back to ancestor resolution */
+		trans->source = NULL;
+		return NULL;
+	}
+
+	/* Record the entry actions, from the child of topmost to the target */
+	trans->num_entries = num_entries;
+	for (const struct smf_state *state = target; state != NULL && state != trans->topmost;
+	     state = state->parent) {
+		trans->entries[--num_entries] = state;
+	}
+
+	trans->source = source;
+	trans->dest = dest;
+	trans->target = target;
+
+	ctx->transition_next = (ctx->transition_next + 1) % CONFIG_SMF_TRANSITION_CACHE_SIZE;
+
+	return trans;
+}
+
+/**
+ * @brief Get the compiled representation of a transition
+ *
+ * The transition is copied out of the cache slot, as entry actions may
+ * themselves transition and recycle the slot while it's being executed.
+ *
+ * @param ctx State machine context
+ * @param source transition source
+ * @param dest transition destination, as passed to smf_set_state()
+ * @param out where to copy the compiled transition
+ * @return true if out holds a compiled transition, else false
+ */
+static bool smf_transition_get(struct smf_ctx *const ctx, const struct smf_state *source,
+			       const struct smf_state *dest, struct smf_transition *out)
+{
+	struct smf_transition *trans = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(ctx->transitions); i++) {
+		if (ctx->transitions[i].source == source && ctx->transitions[i].dest == dest) {
+			trans = &ctx->transitions[i];
+			break;
+		}
+	}
+
+	if (trans == NULL) {
+		trans = smf_transition_compile(ctx, source, dest);
+		if (trans == NULL) {
+			return false;
+		}
+	}
+
+	*out = *trans;
+
+	return true;
+}
+
+/**
+ * @brief Executes the entry actions recorded in a compiled transition
+ *
+ * @param ctx State machine context
+ * @param trans Compiled transition being taken
+ * @return true if the state machine should terminate, else false
+ */
+static bool smf_execute_cached_entry_actions(struct smf_ctx *const ctx,
+					     const struct smf_transition *trans)
+{
+	struct internal_ctx *const internal = (void *)&ctx->internal;
+
+	for (uint8_t i = 0; i < trans->num_entries; i++) {
+		const struct smf_state *to_execute = trans->entries[i];
+
+		/* Keep track of the executing entry action in case it calls
+		 * smf_set_state()
+		 */
+		ctx->executing = to_execute;
+		if (to_execute->entry) {
+			to_execute->entry(ctx);
+
+			/* No need to continue if terminate was set */
+			if (internal->terminate) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+#endif /* CONFIG_SMF_TRANSITION_CACHE */
+
 /**
  * @brief Executes all entry actions from the direct child of topmost to the new state
  *
@@ -237,6 +386,16 @@ void smf_set_initial(struct smf_ctx *ctx, const struct smf_state *init_state)
 	ctx->previous = NULL;
 	ctx->terminate_val = 0;
 
+#ifdef CONFIG_SMF_TRANSITION_CACHE
+	memset(ctx->transitions, 0, sizeof(ctx->transitions));
+	ctx->transition_next = 0;
+#endif /* CONFIG_SMF_TRANSITION_CACHE */
+
+#ifdef CONFIG_SMF_EVENT_QUEUE
+	mpsc_init(&ctx->event_queue);
+	ctx->event = NULL;
+#endif /* CONFIG_SMF_EVENT_QUEUE */
+
 #ifdef CONFIG_SMF_ANCESTOR_SUPPORT
 	struct internal_ctx *const internal = (void *)&ctx->internal;
 
@@ -287,17 +446,18 @@ void smf_set_state(struct smf_ctx *const ctx, const struct smf_state *new_state)
 
 #ifdef CONFIG_SMF_ANCESTOR_SUPPORT
 	const struct smf_state *topmost;
+#ifdef CONFIG_SMF_TRANSITION_CACHE
+	struct smf_transition trans;
+	const bool use_cache = smf_transition_get(ctx, ctx->executing, new_state, &trans);
 
-	if (share_paren(ctx->executing, new_state)) {
-		/* new state is a parent of where we are now*/
-		topmost = new_state;
-	} else if (share_paren(new_state, ctx->executing)) {
-		/* we are a parent of the new state */
-		topmost = ctx->executing;
+	if (use_cache) {
+		topmost = trans.topmost;
 	} else {
-		/* not directly related, find LCA */
-		topmost = get_lca_of(ctx->executing, new_state);
+		topmost = get_topmost_of(ctx->executing, new_state);
 	}
+#else
+	topmost = get_topmost_of(ctx->executing, new_state);
+#endif /* CONFIG_SMF_TRANSITION_CACHE */
 
 	internal->is_exit = true;
 	internal->new_state = true;
@@ -329,6 +489,19 @@ void smf_set_state(struct smf_ctx *const ctx, const struct smf_state *new_state)
 			return;
 		}
 	}
+
+#ifdef CONFIG_SMF_TRANSITION_CACHE
+	if (use_cache) {
+		/* update the state variables */
+		ctx->previous = ctx->current;
+		ctx->current = trans.target;
+
+		/* call the recorded entry actions (except those of topmost) */
+		smf_execute_cached_entry_actions(ctx, &trans);
+		return;
+	}
+#endif /* CONFIG_SMF_TRANSITION_CACHE */
+
 #ifdef CONFIG_SMF_INITIAL_TRANSITION
 	/*
 	 * The final target will be the deepest leaf state that
@@ -417,3 +590,29 @@ int32_t smf_run_state(struct smf_ctx *const ctx)
 #endif
 	return 0;
 }
+
+#ifdef CONFIG_SMF_EVENT_QUEUE
+void smf_event_post(struct smf_ctx *ctx, struct smf_event *event)
+{
+	mpsc_push(&ctx->event_queue, &event->node);
+}
+
+int32_t smf_run_events(struct smf_ctx *const ctx)
+{
+	int32_t ret = 0;
+
+	for (struct mpsc_node *node = mpsc_pop(&ctx->event_queue); node != NULL;
+	     node = mpsc_pop(&ctx->event_queue)) {
+		ctx->event = CONTAINER_OF(node, struct smf_event, node);
+
+		ret = smf_run_state(ctx);
+		if (ret) {
+			break;
+		}
+	}
+
+	ctx->event = NULL;
+
+	return ret;
+}
+#endif /* CONFIG_SMF_EVENT_QUEUE */
@@ -15,6 +15,57 @@
 /* Number of bits represented by one bundle */
 #define bundle_bitness(ba)	(sizeof((ba)->bundles[0]) * 8)
 
+/* All mutating operations take the spinlock: the region operations are
+ * find-then-set sequences (e.g. sys_bitarray_alloc() scans for a free
+ * region before claiming it) and stay atomic with respect to single-bit
+ * updates only when the latter serialize on the same lock. Single-bit
+ * *reads* may still bypass the lock when the platform has native atomic
+ * instructions: an aligned 32-bit load observes a coherent bundle. The
+ * compiler builtins are used directly for the bundle updates since the
+ * bundles are 32-bit while atomic_t may be wider; they keep the locked
+ * writers free of data races with the lock-free reader.
+ *
+ * When atomic operations are implemented in C with a lock of their own
+ * (CONFIG_ATOMIC_OPERATIONS_C), reads take the spinlock too and all
+ * updates are plain read-modify-writes under it.
+ */
+#if !defined(CONFIG_ATOMIC_OPERATIONS_C)
+#define BITARRAY_LOCK_FREE_BITOPS 1
+#endif
+
+static inline uint32_t bundle_fetch_or(uint32_t *bundle, uint32_t mask)
+{
+#ifdef BITARRAY_LOCK_FREE_BITOPS
+	return __atomic_fetch_or(bundle, mask, __ATOMIC_SEQ_CST);
+#else
+	uint32_t prev = *bundle;
+
+	*bundle |= mask;
+	return prev;
+#endif
+}
+
+static inline uint32_t bundle_fetch_and(uint32_t *bundle, uint32_t mask)
+{
+#ifdef BITARRAY_LOCK_FREE_BITOPS
+	return __atomic_fetch_and(bundle, mask, __ATOMIC_SEQ_CST);
+#else
+	uint32_t prev = *bundle;
+
+	*bundle &= mask;
+	return prev;
+#endif
+}
+
+static inline void bundle_xor(uint32_t *bundle, uint32_t mask)
+{
+#ifdef BITARRAY_LOCK_FREE_BITOPS
+	(void)__atomic_fetch_xor(bundle, mask, __ATOMIC_SEQ_CST);
+#else
+	*bundle ^= mask;
+#endif
+}
+
 struct bundle_data {
 	 /* Start and end index of bundles */
 	size_t sidx, eidx;
@@ -184,9 +235,9 @@ static void set_region(sys_bitarray_t *bitarray, size_t offset,
 	if (bd->sidx == bd->eidx) {
 		/* Start/end at same bundle */
 		if (to_set) {
-			bitarray->bundles[bd->sidx] |= bd->smask;
+			(void)bundle_fetch_or(&bitarray->bundles[bd->sidx], bd->smask);
 		} else {
-			bitarray->bundles[bd->sidx] &= ~bd->smask;
+			(void)bundle_fetch_and(&bitarray->bundles[bd->sidx], ~bd->smask);
 		}
 	} else {
 		/* Start/end at different bundle.
@@ -195,14 +246,14 @@ static void set_region(sys_bitarray_t *bitarray, size_t offset,
 		 * set/clear all bits.
 		 */
 		if (to_set) {
-			bitarray->bundles[bd->sidx] |= bd->smask;
-			bitarray->bundles[bd->eidx] |= bd->emask;
+			(void)bundle_fetch_or(&bitarray->bundles[bd->sidx], bd->smask);
+			(void)bundle_fetch_or(&bitarray->bundles[bd->eidx], bd->emask);
 			for (idx = bd->sidx + 1; idx < bd->eidx; idx++) {
 				bitarray->bundles[idx] = ~0U;
 			}
 		} else {
-			bitarray->bundles[bd->sidx] &= ~bd->smask;
-			bitarray->bundles[bd->eidx] &= ~bd->emask;
+			(void)bundle_fetch_and(&bitarray->bundles[bd->sidx], ~bd->smask);
+			(void)bundle_fetch_and(&bitarray->bundles[bd->eidx], ~bd->emask);
 			for (idx = bd->sidx + 1; idx < bd->eidx; idx++) {
 				bitarray->bundles[idx] = 0U;
 			}
@@ -289,21 +340,15 @@ int sys_bitarray_xor(sys_bitarray_t *dst, sys_bitarray_t *other, size_t num_bits
 
 	if (bd.sidx == bd.eidx) {
 		/* Start/end at same bundle */
-		dst->bundles[bd.sidx] =
-			((other->bundles[bd.sidx] ^ dst->bundles[bd.sidx]) & bd.smask) |
-			(dst->bundles[bd.sidx] & ~bd.smask);
+		bundle_xor(&dst->bundles[bd.sidx], other->bundles[bd.sidx] & bd.smask);
 	} else {
 		/* Start/end at different bundle.
 		 * So xor the bits in start and end bundles according to their bitmasks
 		 * separately. For in-between bundles,
 		 * xor all bits.
 		 */
-		dst->bundles[bd.sidx] =
-			((other->bundles[bd.sidx] ^ dst->bundles[bd.sidx]) & bd.smask) |
-			(dst->bundles[bd.sidx] & ~bd.smask);
-		dst->bundles[bd.eidx] =
-			((other->bundles[bd.eidx] ^ dst->bundles[bd.eidx]) & bd.emask) |
-			(dst->bundles[bd.eidx] & ~bd.emask);
+		bundle_xor(&dst->bundles[bd.sidx], other->bundles[bd.sidx] & bd.smask);
+		bundle_xor(&dst->bundles[bd.eidx], other->bundles[bd.eidx] & bd.emask);
 		for (idx = bd.sidx + 1; idx < bd.eidx; idx++) {
 			dst->bundles[idx] ^= other->bundles[idx];
 		}
@@ -319,14 +364,13 @@ out:
 
 int sys_bitarray_set_bit(sys_bitarray_t *bitarray, size_t bit)
 {
-	k_spinlock_key_t key;
 	int ret;
 	size_t idx, off;
 
 	__ASSERT_NO_MSG(bitarray != NULL);
 	__ASSERT_NO_MSG(bitarray->num_bits > 0);
 
-	key = k_spin_lock(&bitarray->lock);
+	k_spinlock_key_t key = k_spin_lock(&bitarray->lock);
 
 	if (bit >= bitarray->num_bits) {
 		ret = -EINVAL;
@@ -336,7 +380,7 @@ int sys_bitarray_set_bit(sys_bitarray_t *bitarray, size_t bit)
 	idx = bit / bundle_bitness(bitarray);
 	off = bit % bundle_bitness(bitarray);
 
-	bitarray->bundles[idx] |= BIT(off);
+	(void)bundle_fetch_or(&bitarray->bundles[idx], BIT(off));
 
 	ret = 0;
 
@@ -347,14 +391,13 @@ out:
 
 int sys_bitarray_clear_bit(sys_bitarray_t *bitarray, size_t bit)
 {
-	k_spinlock_key_t key;
 	int ret;
 	size_t idx, off;
 
 	__ASSERT_NO_MSG(bitarray != NULL);
 	__ASSERT_NO_MSG(bitarray->num_bits > 0);
 
-	key = k_spin_lock(&bitarray->lock);
+	k_spinlock_key_t key = k_spin_lock(&bitarray->lock);
 
 	if (bit >= bitarray->num_bits) {
 		ret = -EINVAL;
@@ -364,7 +407,7 @@ int sys_bitarray_clear_bit(sys_bitarray_t *bitarray, size_t bit)
 	idx = bit / bundle_bitness(bitarray);
 	off = bit % bundle_bitness(bitarray);
 
-	bitarray->bundles[idx] &= ~BIT(off);
+	(void)bundle_fetch_and(&bitarray->bundles[idx], ~BIT(off));
 
 	ret = 0;
 
@@ -375,14 +418,15 @@ out:
 
 int sys_bitarray_test_bit(sys_bitarray_t *bitarray, size_t bit, int *val)
 {
-	k_spinlock_key_t key;
 	int ret;
 	size_t idx, off;
 
 	__ASSERT_NO_MSG(bitarray != NULL);
 	__ASSERT_NO_MSG(bitarray->num_bits > 0);
 
-	key = k_spin_lock(&bitarray->lock);
+#ifndef BITARRAY_LOCK_FREE_BITOPS
+	k_spinlock_key_t key = k_spin_lock(&bitarray->lock);
+#endif
 
 	CHECKIF(val == NULL) {
 		ret = -EINVAL;
@@ -397,6 +441,7 @@ int sys_bitarray_test_bit(sys_bitarray_t *bitarray, size_t bit, int *val)
 	idx = bit / bundle_bitness(bitarray);
 	off = bit % bundle_bitness(bitarray);
 
+	/* Aligned word reads are atomic on all supported platforms */
 	if ((bitarray->bundles[idx] & BIT(off)) != 0) {
 		*val = 1;
 	} else {
@@ -406,20 +451,22 @@ int sys_bitarray_test_bit(sys_bitarray_t *bitarray, size_t bit, int *val)
 	ret = 0;
 
 out:
+#ifndef BITARRAY_LOCK_FREE_BITOPS
 	k_spin_unlock(&bitarray->lock, key);
+#endif
 	return ret;
 }
 
 int sys_bitarray_test_and_set_bit(sys_bitarray_t *bitarray, size_t bit, int *prev_val)
 {
-	k_spinlock_key_t key;
 	int ret;
 	size_t idx, off;
+	uint32_t prev;
 
 	__ASSERT_NO_MSG(bitarray != NULL);
 	__ASSERT_NO_MSG(bitarray->num_bits > 0);
 
-	key = k_spin_lock(&bitarray->lock);
+	k_spinlock_key_t key = k_spin_lock(&bitarray->lock);
 
 	CHECKIF(prev_val == NULL) {
 		ret = -EINVAL;
@@ -434,14 +481,14 @@ int sys_bitarray_test_and_set_bit(sys_bitarray_t *bitarray, size_t bit, int *pre
 	idx = bit / bundle_bitness(bitarray);
 	off = bit % bundle_bitness(bitarray);
 
-	if ((bitarray->bundles[idx] & BIT(off)) != 0) {
+	prev = bundle_fetch_or(&bitarray->bundles[idx], BIT(off));
+
+	if ((prev & BIT(off)) != 0) {
 		*prev_val = 1;
 	} else {
 		*prev_val = 0;
 	}
 
-	bitarray->bundles[idx] |= BIT(off);
-
 	ret = 0;
 
 out:
@@ -451,14 +498,14 @@ out:
 
 int sys_bitarray_test_and_clear_bit(sys_bitarray_t *bitarray, size_t bit, int *prev_val)
 {
-	k_spinlock_key_t key;
 	int ret;
 	size_t idx, off;
+	uint32_t prev;
 
 	__ASSERT_NO_MSG(bitarray != NULL);
 	__ASSERT_NO_MSG(bitarray->num_bits > 0);
 
-	key = k_spin_lock(&bitarray->lock);
+	k_spinlock_key_t key = k_spin_lock(&bitarray->lock);
 
 	CHECKIF(prev_val == NULL) {
 		ret = -EINVAL;
@@ -473,14 +520,14 @@ int sys_bitarray_test_and_clear_bit(sys_bitarray_t *bitarray, size_t bit, int *p
 	idx = bit / bundle_bitness(bitarray);
 	off = bit % bundle_bitness(bitarray);
 
-	if ((bitarray->bundles[idx] & BIT(off)) != 0) {
+	prev = bundle_fetch_and(&bitarray->bundles[idx], ~BIT(off));
+
+	if ((prev & BIT(off)) != 0) {
 		*prev_val = 1;
 	} else {
 		*prev_val = 0;
 	}
 
-	bitarray->bundles[idx] &= ~BIT(off);
-
 	ret = 0;
 
 out:
@@ -560,6 +607,70 @@ out:
 	return ret;
 }
 
+int sys_bitarray_alloc_bits(sys_bitarray_t *bitarray, size_t num_bits,
+			    size_t *offsets)
+{
+	k_spinlock_key_t key;
+	size_t found = 0;
+	int ret;
+
+	__ASSERT_NO_MSG(bitarray != NULL);
+	__ASSERT_NO_MSG(bitarray->num_bits > 0);
+
+	key = k_spin_lock(&bitarray->lock);
+
+	CHECKIF(offsets == NULL) {
+		ret = -EINVAL;
+		goto out;
+	}
+
+	if ((num_bits == 0) || (num_bits > bitarray->num_bits)) {
+		ret = -EINVAL;
+		goto out;
+	}
+
+	/* Gather unallocated bits bundle by bundle, so the scan cost
+	 * does not depend on the number of bits requested.
+	 */
+	for (size_t idx = 0;
+	     (idx < bitarray->num_bundles) && (found < num_bits); idx++) {
+		uint32_t free_bits = ~bitarray->bundles[idx];
+
+		while ((free_bits != 0U) && (found < num_bits)) {
+			size_t off = find_lsb_set(free_bits) - 1;
+			size_t bit = idx * bundle_bitness(bitarray) + off;
+
+			if (bit >= bitarray->num_bits) {
+				/* Unused bits past the end of the last bundle */
+				break;
+			}
+
+			offsets[found] = bit;
+			found++;
+			free_bits &= ~BIT(off);
+		}
+	}
+
+	if (found < num_bits) {
+		/* Not enough free bits, leave the bitarray untouched */
+		ret = -ENOSPC;
+		goto out;
+	}
+
+	for (size_t i = 0; i < num_bits; i++) {
+		size_t idx = offsets[i] / bundle_bitness(bitarray);
+		size_t off = offsets[i] % bundle_bitness(bitarray);
+
+		(void)bundle_fetch_or(&bitarray->bundles[idx], BIT(off));
+	}
+
+	ret = 0;
+
+out:
+	k_spin_unlock(&bitarray->lock, key);
+	return ret;
+}
+
 int sys_bitarray_find_nth_set(sys_bitarray_t *bitarray, size_t n, size_t num_bits, size_t offset,
 			      size_t *found_at)
 {
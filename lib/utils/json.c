@@ -1777,3 +1777,394 @@ ssize_t json_calc_encoded_arr_len(const struct json_obj_descr *descr,
 
 	return total;
 }
+
+enum json_stream_state {
+	JSON_STREAM_STATE_VALUE,
+	JSON_STREAM_STATE_VALUE_OR_END,
+	JSON_STREAM_STATE_KEY,
+	JSON_STREAM_STATE_KEY_OR_END,
+	JSON_STREAM_STATE_COLON,
+	JSON_STREAM_STATE_NEXT,
+	JSON_STREAM_STATE_STRING,
+	JSON_STREAM_STATE_KEY_STRING,
+	JSON_STREAM_STATE_NUMBER,
+	JSON_STREAM_STATE_LITERAL,
+	JSON_STREAM_STATE_DONE,
+	JSON_STREAM_STATE_ERROR,
+};
+
+/* One bit of container kind per nesting level */
+#define JSON_STREAM_MAX_DEPTH (sizeof(((struct json_stream *)0)->stack) * 8)
+
+void json_stream_init(struct json_stream *stream, json_stream_cb_t cb,
+		      void *user_data, char *scratch, size_t scratch_size)
+{
+	*stream = (struct json_stream){
+		.cb = cb,
+		.user_data = user_data,
+		.scratch = scratch,
+		.scratch_size = scratch_size,
+		.state = JSON_STREAM_STATE_VALUE,
+	};
+}
+
+static int stream_push(struct json_stream *stream, bool object)
+{
+	if (stream->depth >= JSON_STREAM_MAX_DEPTH) {
+		return -E2BIG;
+	}
+
+	stream->stack = (stream->stack << 1) | (object ? 1 : 0);
+	stream->depth++;
+
+	return 0;
+}
+
+static bool stream_in_object(const struct json_stream *stream)
+{
+	return (stream->depth > 0) && ((stream->stack & 1) != 0);
+}
+
+static void stream_pop(struct json_stream *stream)
+{
+	stream->stack >>= 1;
+	stream->depth--;
+}
+
+/* Transition after a complete value, closing bracket or literal */
+static void stream_value_end(struct json_stream *stream)
+{
+	stream->state = (stream->depth == 0) ? JSON_STREAM_STATE_DONE
+					     : JSON_STREAM_STATE_NEXT;
+}
+
+static int stream_save(struct json_stream *stream, const char *start,
+		       const char *end)
+{
+	size_t length = end - start;
+
+	if (length > stream->scratch_size - stream->scratch_len) {
+		return -ENOMEM;
+	}
+
+	memcpy(stream->scratch + stream->scratch_len, start, length);
+	stream->scratch_len += length;
+
+	return 0;
+}
+
+static int stream_emit_token(struct json_stream *stream,
+			     enum json_stream_event event,
+			     const char *start, const char *end)
+{
+	int ret;
+
+	if (stream->scratch_len == 0) {
+		/* Token fully within the current chunk: emit in place */
+		return stream->cb(event, start, end - start, stream->user_data);
+	}
+
+	ret = stream_save(stream, start, end);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = stream->cb(event, stream->scratch, stream->scratch_len,
+			 stream->user_data);
+	stream->scratch_len = 0;
+
+	return ret;
+}
+
+static bool stream_isspace(char chr)
+{
+	return chr == ' ' || chr == '\t' || chr == '\n' || chr == '\r';
+}
+
+static bool stream_isnumber(char chr)
+{
+	return (chr >= '0' && chr <= '9') || chr == '-' || chr == '+' ||
+	       chr == '.' || chr == 'e' || chr == 'E';
+}
+
+static int stream_end_container(struct json_stream *stream, char chr)
+{
+	bool object = (chr == '}');
+	int ret;
+
+	if (stream_in_object(stream) != object || stream->depth == 0) {
+		return -EINVAL;
+	}
+
+	ret = stream->cb(object ? JSON_STREAM_OBJECT_END : JSON_STREAM_ARRAY_END,
+			 NULL, 0, stream->user_data);
+	stream_pop(stream);
+	stream_value_end(stream);
+
+	return ret;
+}
+
+static int stream_process(struct json_stream *stream, const char *data,
+			  size_t len, const char **tok_start)
+{
+	const char *pos = data;
+	const char *end = data + len;
+	int ret = 0;
+
+	while (pos < end) {
+		char chr = *pos;
+
+		switch (stream->state) {
+		case JSON_STREAM_STATE_VALUE:
+		case JSON_STREAM_STATE_VALUE_OR_END:
+			if (stream_isspace(chr)) {
+				pos++;
+				break;
+			}
+
+			switch (chr) {
+			case '{':
+				ret = stream_push(stream, true);
+				if (ret == 0) {
+					ret = stream->cb(JSON_STREAM_OBJECT_START,
+							 NULL, 0, stream->user_data);
+				}
+				stream->state = JSON_STREAM_STATE_KEY_OR_END;
+				pos++;
+				break;
+			case '[':
+				ret = stream_push(stream, false);
+				if (ret == 0) {
+					ret = stream->cb(JSON_STREAM_ARRAY_START,
+							 NULL, 0, stream->user_data);
+				}
+				stream->state = JSON_STREAM_STATE_VALUE_OR_END;
+				pos++;
+				break;
+			case ']':
+				if (stream->state != JSON_STREAM_STATE_VALUE_OR_END) {
+					return -EINVAL;
+				}
+				ret = stream_end_container(stream, chr);
+				pos++;
+				break;
+			case '"':
+				stream->state = JSON_STREAM_STATE_STRING;
+				stream->esc = 0;
+				pos++;
+				*tok_start = pos;
+				break;
+			case 't':
+			case 'f':
+			case 'n':
+				stream->literal = (chr == 't') ? "true" :
+						  (chr == 'f') ? "false" : "null";
+				stream->literal_event =
+						  (chr == 't') ? JSON_STREAM_TRUE :
+						  (chr == 'f') ? JSON_STREAM_FALSE :
+						  JSON_STREAM_NULL;
+				stream->literal_pos = 1;
+				stream->state = JSON_STREAM_STATE_LITERAL;
+				pos++;
+				break;
+			default:
+				if (!stream_isnumber(chr) || chr == '+' ||
+				    chr == '.' || chr == 'e' || chr == 'E') {
+					return -EINVAL;
+				}
+				stream->state = JSON_STREAM_STATE_NUMBER;
+				*tok_start = pos;
+				pos++;
+				break;
+			}
+			break;
+		case JSON_STREAM_STATE_KEY:
+		case JSON_STREAM_STATE_KEY_OR_END:
+			if (stream_isspace(chr)) {
+				pos++;
+				break;
+			}
+			if (chr == '}' &&
+			    stream->state == JSON_STREAM_STATE_KEY_OR_END) {
+				ret = stream_end_container(stream, chr);
+				pos++;
+				break;
+			}
+			if (chr != '"') {
+				return -EINVAL;
+			}
+			stream->state = JSON_STREAM_STATE_KEY_STRING;
+			stream->esc = 0;
+			pos++;
+			*tok_start = pos;
+			break;
+		case JSON_STREAM_STATE_COLON:
+			if (stream_isspace(chr)) {
+				pos++;
+				break;
+			}
+			if (chr != ':') {
+				return -EINVAL;
+			}
+			stream->state = JSON_STREAM_STATE_VALUE;
+			pos++;
+			break;
+		case JSON_STREAM_STATE_NEXT:
+			if (stream_isspace(chr)) {
+				pos++;
+				break;
+			}
+			if (chr == ',') {
+				stream->state = stream_in_object(stream) ?
+						JSON_STREAM_STATE_KEY :
+						JSON_STREAM_STATE_VALUE;
+				pos++;
+				break;
+			}
+			if (chr != '}' && chr != ']') {
+				return -EINVAL;
+			}
+			ret = stream_end_container(stream, chr);
+			pos++;
+			break;
+		case JSON_STREAM_STATE_STRING:
+		case JSON_STREAM_STATE_KEY_STRING:
+			if (stream->esc == 1) {
+				switch (chr) {
+				case '"':
+				case '\\':
+				case '/':
+				case 'b':
+				case 'f':
+				case 'n':
+				case 'r':
+				case 't':
+					stream->esc = 0;
+					break;
+				case 'u':
+					stream->esc = 2;
+					break;
+				default:
+					return -EINVAL;
+				}
+				pos++;
+				break;
+			}
+			if (stream->esc >= 2) {
+				if (isxdigit((unsigned char)chr) == 0) {
+					return -EINVAL;
+				}
+				stream->esc = (stream->esc == 5) ? 0 : stream->esc + 1;
+				pos++;
+				break;
+			}
+			if (chr == '\\') {
+				stream->esc = 1;
+				pos++;
+				break;
+			}
+			if (chr == '"') {
+				bool is_key = (stream->state ==
+					       JSON_STREAM_STATE_KEY_STRING);
+
+				ret = stream_emit_token(stream,
+							is_key ? JSON_STREAM_KEY :
+								 JSON_STREAM_STRING,
+							*tok_start, pos);
+				pos++;
+				if (is_key) {
+					stream->state = JSON_STREAM_STATE_COLON;
+				} else {
+					stream_value_end(stream);
+				}
+				break;
+			}
+			pos++;
+			break;
+		case JSON_STREAM_STATE_NUMBER:
+			if (stream_isnumber(chr)) {
+				pos++;
+				break;
+			}
+			/* Delimiter reached: emit and reprocess it */
+			ret = stream_emit_token(stream, JSON_STREAM_NUMBER,
+						*tok_start, pos);
+			stream_value_end(stream);
+			break;
+		case JSON_STREAM_STATE_LITERAL:
+			if (chr != stream->literal[stream->literal_pos]) {
+				return -EINVAL;
+			}
+			stream->literal_pos++;
+			pos++;
+			if (stream->literal[stream->literal_pos] == '\0') {
+				ret = stream->cb(stream->literal_event, NULL, 0,
+						 stream->user_data);
+				stream_value_end(stream);
+			}
+			break;
+		case JSON_STREAM_STATE_DONE:
+			if (!stream_isspace(chr)) {
+				return -EINVAL;
+			}
+			pos++;
+			break;
+		default:
+			return -EINVAL;
+		}
+
+		if (ret != 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+int json_stream_feed(struct json_stream *stream, const char *data, size_t len)
+{
+	/* Tokens resumed from a previous chunk restart at the chunk head */
+	const char *tok_start = data;
+	int ret;
+
+	ret = stream_process(stream, data, len, &tok_start);
+	if (ret != 0) {
+		stream->state = JSON_STREAM_STATE_ERROR;
+		return ret;
+	}
+
+	/* Preserve an unterminated token across the chunk boundary */
+	switch (stream->state) {
+	case JSON_STREAM_STATE_STRING:
+	case JSON_STREAM_STATE_KEY_STRING:
+	case JSON_STREAM_STATE_NUMBER:
+		ret = stream_save(stream, tok_start, data + len);
+		if (ret < 0) {
+			stream->state = JSON_STREAM_STATE_ERROR;
+			return ret;
+		}
+		break;
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+int json_stream_finish(struct json_stream *stream)
+{
+	int ret;
+
+	if (stream->state == JSON_STREAM_STATE_NUMBER) {
+		/* A top-level number is only delimited by the end of input */
+		ret = stream_emit_token(stream, JSON_STREAM_NUMBER,
+					NULL, NULL);
+		if (ret != 0) {
+			stream->state = JSON_STREAM_STATE_ERROR;
+			return ret;
+		}
+		stream_value_end(stream);
+	}
+
+	return (stream->state == JSON_STREAM_STATE_DONE) ? 0 : -EINVAL;
+}
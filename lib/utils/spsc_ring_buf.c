@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/sys/spsc_ring_buf.h>
+#include <zephyr/sys/__assert.h>
+
+/* The indices run free and are masked on buffer access. Since the buffer
+ * size is a power of two, index differences stay correct across the
+ * uint32_t wrap-around. Each index is only ever written by its owning
+ * side, so a single atomic add publishing the bytes (ordered after the
+ * data accesses) is all the synchronization the buffer needs.
+ */
+
+void spsc_ring_buf_init(struct spsc_ring_buf *buf, uint8_t *data, uint32_t size)
+{
+	__ASSERT_NO_MSG(IS_POWER_OF_TWO(size));
+
+	buf->data = data;
+	buf->mask = size - 1;
+	spsc_ring_buf_reset(buf);
+}
+
+uint32_t spsc_ring_buf_size_get(const struct spsc_ring_buf *buf)
+{
+	uint32_t head = (uint32_t)atomic_get(&buf->put.idx);
+	uint32_t tail = (uint32_t)atomic_get(&buf->get.idx);
+
+	return head - tail;
+}
+
+uint32_t spsc_ring_buf_space_get(const struct spsc_ring_buf *buf)
+{
+	return spsc_ring_buf_capacity_get(buf) - spsc_ring_buf_size_get(buf);
+}
+
+uint32_t spsc_ring_buf_put_claim(struct spsc_ring_buf *buf, uint8_t **data,
+				 uint32_t size)
+{
+	uint32_t head = (uint32_t)atomic_get(&buf->put.idx) + buf->put.claimed;
+	uint32_t tail = (uint32_t)atomic_get(&buf->get.idx);
+	uint32_t free_space = spsc_ring_buf_capacity_get(buf) - (head - tail);
+	uint32_t off = head & buf->mask;
+	uint32_t wrap_size = spsc_ring_buf_capacity_get(buf) - off;
+
+	size = MIN(size, MIN(free_space, wrap_size));
+
+	*data = &buf->data[off];
+	buf->put.claimed += size;
+
+	return size;
+}
+
+int spsc_ring_buf_put_finish(struct spsc_ring_buf *buf, uint32_t size)
+{
+	if (size > buf->put.claimed) {
+		return -EINVAL;
+	}
+
+	buf->put.claimed = 0;
+	if (size > 0) {
+		atomic_add(&buf->put.idx, size);
+	}
+
+	return 0;
+}
+
+uint32_t spsc_ring_buf_get_claim(struct spsc_ring_buf *buf, uint8_t **data,
+				 uint32_t size)
+{
+	uint32_t tail = (uint32_t)atomic_get(&buf->get.idx) + buf->get.claimed;
+	uint32_t head = (uint32_t)atomic_get(&buf->put.idx);
+	uint32_t avail = head - tail;
+	uint32_t off = tail & buf->mask;
+	uint32_t wrap_size = spsc_ring_buf_capacity_get(buf) - off;
+
+	size = MIN(size, MIN(avail, wrap_size));
+
+	*data = &buf->data[off];
+	buf->get.claimed += size;
+
+	return size;
+}
+
+int spsc_ring_buf_get_finish(struct spsc_ring_buf *buf, uint32_t size)
+{
+	if (size > buf->get.claimed) {
+		return -EINVAL;
+	}
+
+	buf->get.claimed = 0;
+	if (size > 0) {
+		atomic_add(&buf->get.idx, size);
+	}
+
+	return 0;
+}
+
+uint32_t spsc_ring_buf_put(struct spsc_ring_buf *buf, const uint8_t *data,
+			   uint32_t size)
+{
+	uint8_t *dst;
+	uint32_t partial_size;
+	uint32_t total_size = 0U;
+
+	do {
+		partial_size = spsc_ring_buf_put_claim(buf, &dst, size);
+		memcpy(dst, data, partial_size);
+		total_size += partial_size;
+		size -= partial_size;
+		data += partial_size;
+	} while ((size > 0U) && (partial_size > 0U));
+
+	(void)spsc_ring_buf_put_finish(buf, total_size);
+
+	return total_size;
+}
+
+uint32_t spsc_ring_buf_get(struct spsc_ring_buf *buf, uint8_t *data,
+			   uint32_t size)
+{
+	uint8_t *src;
+	uint32_t partial_size;
+	uint32_t total_size = 0U;
+
+	do {
+		partial_size = spsc_ring_buf_get_claim(buf, &src, size);
+		memcpy(data, src, partial_size);
+		total_size += partial_size;
+		size -= partial_size;
+		data += partial_size;
+	} while ((size > 0U) && (partial_size > 0U));
+
+	(void)spsc_ring_buf_get_finish(buf, total_size);
+
+	return total_size;
+}
+
+void spsc_ring_buf_reset(struct spsc_ring_buf *buf)
+{
+	buf->put.claimed = 0;
+	buf->get.claimed = 0;
+	atomic_set(&buf->put.idx, 0);
+	atomic_set(&buf->get.idx, 0);
+}
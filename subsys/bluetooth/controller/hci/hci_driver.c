@@ -84,6 +84,35 @@ static sys_slist_t hbuf_pend;
 static int32_t hbuf_count;
 #endif /* CONFIG_BT_HCI_ACL_FLOW_CONTROL */
 
+#if defined(CONFIG_BT_CTLR_ZERO_COPY_ACL_RX)
+/* H:4 packet type octet followed by the HCI ACL header */
+#define ACL_RX_ZC_HDR_SIZE (1U + BT_HCI_ACL_HDR_SIZE)
+
+/* Offset of the ACL payload inside a receive node, used to build the HCI
+ * headers in place and to recover the node in the pool destroy callback.
+ */
+#define ACL_RX_ZC_PDU_OFFSET (offsetof(struct node_rx_pdu, pdu) + \
+			      PDU_DC_LL_HEADER_SIZE)
+
+/* The headers overwrite the tail of the node's footer and the Link Layer
+ * data header, neither of which is needed once the PDU reaches the HCI
+ * layer. The node header itself is still used to release the node and
+ * shall not be overwritten.
+ */
+BUILD_ASSERT(ACL_RX_ZC_PDU_OFFSET >=
+	     (sizeof(struct node_rx_hdr) + ACL_RX_ZC_HDR_SIZE));
+
+/* User data area sized to cover the Host's per-buffer incoming ACL
+ * metadata (struct acl_data in the Host implementation).
+ */
+#define ACL_RX_ZC_USER_DATA_SIZE 8
+
+static void acl_rx_zc_destroy(struct net_buf *buf);
+
+NET_BUF_POOL_FIXED_DEFINE(acl_rx_zc_pool, CONFIG_BT_CTLR_RX_BUFFERS, 0,
+			  ACL_RX_ZC_USER_DATA_SIZE, acl_rx_zc_destroy);
+#endif /* CONFIG_BT_CTLR_ZERO_COPY_ACL_RX */
+
 #if defined(CONFIG_BT_CTLR_ISO)
 #define SDU_HCI_HDR_SIZE (BT_HCI_ISO_HDR_SIZE + BT_HCI_ISO_SDU_TS_HDR_SIZE)
 
@@ -532,6 +561,69 @@ void hci_recv_fifo_reset(void)
 	k_sched_unlock();
 }
 
+#if defined(CONFIG_BT_CTLR_ZERO_COPY_ACL_RX)
+static void acl_rx_zc_destroy(struct net_buf *buf)
+{
+	struct node_rx_pdu *node_rx;
+
+	node_rx = (void *)((uint8_t *)buf->__buf + ACL_RX_ZC_HDR_SIZE -
+			   ACL_RX_ZC_PDU_OFFSET);
+
+	net_buf_destroy(buf);
+
+	/* Called from the Host's context when the last reference is
+	 * dropped; the receive node may only be released back to the
+	 * controller from recv_thread(), hence hand it over through the
+	 * receive FIFO.
+	 */
+	node_rx->hdr.user_meta = HCI_CLASS_ACL_RELEASE;
+	k_fifo_put(&recv_fifo, node_rx);
+}
+
+static struct net_buf *encode_acl_node_zc(struct node_rx_pdu *node_rx)
+{
+	struct pdu_data *pdu_data = (void *)node_rx->pdu;
+	struct bt_hci_acl_hdr *acl;
+	uint16_t handle_flags;
+	uint8_t *hdr;
+	uint8_t len;
+
+	/* The headers built below overlay the Link Layer data header,
+	 * read out the needed fields first.
+	 */
+	len = pdu_data->len;
+
+	switch (pdu_data->ll_id) {
+	case PDU_DATA_LLID_DATA_CONTINUE:
+	case PDU_DATA_LLID_DATA_START:
+		if (pdu_data->ll_id == PDU_DATA_LLID_DATA_START) {
+			handle_flags = bt_acl_handle_pack(node_rx->hdr.handle,
+							  BT_ACL_START);
+		} else {
+			handle_flags = bt_acl_handle_pack(node_rx->hdr.handle,
+							  BT_ACL_CONT);
+		}
+		break;
+
+	default:
+		LL_ASSERT(0);
+		return NULL;
+	}
+
+	/* Build the H:4 and HCI ACL headers in place, in front of the PDU
+	 * payload.
+	 */
+	hdr = &((uint8_t *)node_rx)[ACL_RX_ZC_PDU_OFFSET - ACL_RX_ZC_HDR_SIZE];
+	hdr[0] = BT_HCI_H4_ACL;
+	acl = (void *)&hdr[1];
+	acl->handle = sys_cpu_to_le16(handle_flags);
+	acl->len = sys_cpu_to_le16(len);
+
+	return net_buf_alloc_with_data(&acl_rx_zc_pool, hdr,
+				       ACL_RX_ZC_HDR_SIZE + len, K_FOREVER);
+}
+#endif /* CONFIG_BT_CTLR_ZERO_COPY_ACL_RX */
+
 static inline struct net_buf *encode_node(struct node_rx_pdu *node_rx,
 					  int8_t class)
 {
@@ -555,10 +647,17 @@ static inline struct net_buf *encode_node(struct node_rx_pdu *node_rx,
 		break;
 #if defined(CONFIG_BT_CONN)
 	case HCI_CLASS_ACL_DATA:
+#if defined(CONFIG_BT_CTLR_ZERO_COPY_ACL_RX)
+		/* Hand the PDU memory itself to the Host; the node is
+		 * released when the Host unreferences the buffer.
+		 */
+		return encode_acl_node_zc(node_rx);
+#else /* !CONFIG_BT_CTLR_ZERO_COPY_ACL_RX */
 		/* generate ACL data */
 		buf = bt_buf_get_rx(BT_BUF_ACL_IN, K_FOREVER);
 		hci_acl_encode(node_rx, buf);
 		break;
+#endif /* !CONFIG_BT_CTLR_ZERO_COPY_ACL_RX */
 #endif /* CONFIG_BT_CONN */
 
 #if defined(CONFIG_BT_CTLR_SYNC_ISO) || defined(CONFIG_BT_CTLR_CONN_ISO)
@@ -644,6 +743,16 @@ static inline struct net_buf *process_node(struct node_rx_pdu *node_rx)
 	uint8_t class = node_rx->hdr.user_meta;
 	struct net_buf *buf = NULL;
 
+#if defined(CONFIG_BT_CTLR_ZERO_COPY_ACL_RX)
+	if (class == HCI_CLASS_ACL_RELEASE) {
+		/* The Host is done with a zero-copy ACL buffer */
+		node_rx->hdr.next = NULL;
+		ll_rx_mem_release((void **)&node_rx);
+
+		return NULL;
+	}
+#endif /* CONFIG_BT_CTLR_ZERO_COPY_ACL_RX */
+
 #if defined(CONFIG_BT_HCI_ACL_FLOW_CONTROL)
 	if (hbuf_count != -1) {
 		bool pend = !sys_slist_is_empty(&hbuf_pend);
@@ -29,6 +29,9 @@ extern atomic_t hci_state_mask;
 				     * data)
 				     */
 #define HCI_CLASS_ISO_DATA        6 /* Isochronous data */
+#define HCI_CLASS_ACL_RELEASE     7 /* Zero-copy ACL buffer returned by the
+				     * Host; release only
+				     */
 
 
 void hci_init(struct k_poll_signal *signal_host_buf);
@@ -258,6 +258,7 @@ uint8_t ll_feature_req_send(uint16_t handle);
 uint8_t ll_version_ind_send(uint16_t handle);
 uint8_t ll_terminate_ind_send(uint16_t handle, uint8_t reason);
 uint8_t ll_rssi_get(uint16_t handle, uint8_t *const rssi);
+uint8_t ll_conn_util_get(uint16_t handle, uint8_t *const util);
 uint8_t ll_tx_pwr_lvl_get(uint8_t handle_type,
 		       uint16_t handle, uint8_t type, int8_t *const tx_pwr_lvl);
 void ll_tx_pwr_get(int8_t *const min, int8_t *const max);
@@ -534,6 +534,11 @@ struct event_done_extra {
 			uint8_t  mic_state;
 #endif /* CONFIG_BT_CTLR_LE_ENC */
 
+#if defined(CONFIG_BT_CTLR_CONN_UTIL)
+			/* Radio air time used by the event, in microseconds */
+			uint32_t air_time_us;
+#endif /* CONFIG_BT_CTLR_CONN_UTIL */
+
 #if defined(CONFIG_BT_PERIPHERAL) || defined(CONFIG_BT_CTLR_SYNC_PERIODIC)
 			union {
 				struct event_done_extra_drift drift;
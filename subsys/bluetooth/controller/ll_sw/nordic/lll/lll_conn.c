@@ -1000,6 +1000,11 @@ static void isr_done(void *param)
 	e->mic_state = mic_state;
 #endif /* CONFIG_BT_CTLR_LE_ENC */
 
+#if defined(CONFIG_BT_CTLR_CONN_UTIL)
+	e->air_time_us = trx_cnt ? (radio_tmr_end_get() -
+				    radio_tmr_ready_get()) : 0U;
+#endif /* CONFIG_BT_CTLR_CONN_UTIL */
+
 #if defined(CONFIG_BT_PERIPHERAL)
 	if (trx_cnt) {
 		struct lll_conn *lll = param;
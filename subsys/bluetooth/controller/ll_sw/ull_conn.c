@@ -701,6 +701,27 @@ uint8_t ll_rssi_get(uint16_t handle, uint8_t *rssi)
 }
 #endif /* CONFIG_BT_CTLR_CONN_RSSI */
 
+#if defined(CONFIG_BT_CTLR_CONN_UTIL)
+uint8_t ll_conn_util_get(uint16_t handle, uint8_t *const util)
+{
+	struct ll_conn *conn;
+
+	conn = ll_connected_get(handle);
+	if (!conn) {
+		return BT_HCI_ERR_UNKNOWN_CONN_ID;
+	}
+
+	if (conn->util.elapsed_us == 0U) {
+		*util = 0U;
+	} else {
+		*util = (uint8_t)MIN((100ULL * conn->util.air_time_us) /
+				     conn->util.elapsed_us, 100ULL);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_BT_CTLR_CONN_UTIL */
+
 #if defined(CONFIG_BT_CTLR_LE_PING)
 uint8_t ll_apto_get(uint16_t handle, uint16_t *apto)
 {
@@ -1125,6 +1146,20 @@ void ull_conn_done(struct node_rx_event_done *done)
 
 	elapsed_event = latency_event + lll->lazy_prepare + 1U;
 
+#if defined(CONFIG_BT_CTLR_CONN_UTIL)
+	/* Accumulate radio air time against elapsed connection interval
+	 * time. Age both counters in tandem so that the ratio is retained
+	 * and recent events dominate the statistic.
+	 */
+	conn->util.air_time_us += done->extra.air_time_us;
+	conn->util.elapsed_us += (uint32_t)elapsed_event * lll->interval *
+				 CONN_INT_UNIT_US;
+	if (conn->util.elapsed_us > BIT(30)) {
+		conn->util.air_time_us >>= 1;
+		conn->util.elapsed_us >>= 1;
+	}
+#endif /* CONFIG_BT_CTLR_CONN_UTIL */
+
 	/* Reset supervision countdown */
 	if (done->extra.crc_valid && !done->extra.is_aborted) {
 		conn->supervision_expire = 0U;
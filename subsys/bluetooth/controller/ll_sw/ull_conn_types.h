@@ -263,6 +263,16 @@ struct ll_conn {
 	/* Detect empty L2CAP start frame */
 	uint8_t  start_empty:1;
 #endif /* CONFIG_BT_CTLR_LLID_DATA_START_EMPTY */
+
+#if defined(CONFIG_BT_CTLR_CONN_UTIL)
+	/* Radio utilization statistics, both counters are aged in tandem to
+	 * retain their ratio while avoiding overflow.
+	 */
+	struct {
+		uint32_t air_time_us;
+		uint32_t elapsed_us;
+	} util;
+#endif /* CONFIG_BT_CTLR_CONN_UTIL */
 }; /* struct ll_conn */
 
 struct node_rx_cc {
@@ -934,6 +934,12 @@ struct bt_conn *get_conn_ready(void)
 		return NULL;
 	}
 
+	/* `bt_conn_data_ready()` relies on the scheduler lock when appending to
+	 * the list. Lock it here too: with CONFIG_BT_CONN_TX_DIRECT this walk
+	 * can run in a preemptible thread instead of the system workqueue.
+	 */
+	k_sched_lock();
+
 	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&bt_dev.le.conn_ready, conn, tmp, _conn_ready) {
 		__ASSERT_NO_MSG(tmp != conn);
 
@@ -974,12 +980,18 @@ struct bt_conn *get_conn_ready(void)
 				bt_conn_data_ready(conn);
 			}
 
+			k_sched_unlock();
+
 			return conn;
 		}
 
+		k_sched_unlock();
+
 		return bt_conn_ref(conn);
 	}
 
+	k_sched_unlock();
+
 	/* No connection has data to send */
 	return NULL;
 }
@@ -197,6 +197,9 @@ struct bt_conn_iso {
 
 	/** Queue from which conn will pull data */
 	struct k_fifo                   txq;
+
+	/** Number of SDUs on txq not yet handed over to the controller */
+	atomic_t			staged_sdus;
 };
 
 typedef void (*bt_conn_tx_cb_t)(struct bt_conn *conn, void *user_data, int err);
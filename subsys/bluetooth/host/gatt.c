@@ -1903,11 +1903,10 @@ uint16_t bt_gatt_attr_get_handle(const struct bt_gatt_attr *attr)
 			continue;
 		}
 
-		for (size_t i = 0; i < static_svc->attr_count; i++, handle++) {
-			if (attr == &static_svc->attrs[i]) {
-				return handle;
-			}
-		}
+		/* Attributes of a static service are contiguous, so the
+		 * handle follows from the position within the array.
+		 */
+		return handle + (uint16_t)(attr - &static_svc->attrs[0]);
 	}
 
 	return 0;
@@ -2098,7 +2097,16 @@ void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 				continue;
 			}
 
-			for (i = 0; i < static_svc->attr_count; i++, handle++) {
+			/* Jump ahead to the attribute matching start_handle,
+			 * the handles of a static service are consecutive.
+			 */
+			i = 0;
+			if (start_handle > handle) {
+				i = start_handle - handle;
+				handle = start_handle;
+			}
+
+			for (; i < static_svc->attr_count; i++, handle++) {
 				if (gatt_foreach_iter(&static_svc->attrs[i],
 						      handle, start_handle,
 						      end_handle, uuid,
@@ -2500,8 +2508,66 @@ static int gatt_notify_mult(struct bt_conn *conn, uint16_t handle,
 #endif /* CONFIG_BT_GATT_NOTIFY_MULTIPLE_FLUSH_MS != 0 */
 #endif /* CONFIG_BT_GATT_NOTIFY_MULTIPLE */
 
+static const struct bt_gatt_attr *gatt_ccc_attr_find(const struct bt_gatt_attr *attr)
+{
+	/* Check if attribute is a characteristic value */
+	if (bt_uuid_cmp(attr->uuid, BT_UUID_GATT_CCC) != 0) {
+		attr = bt_gatt_attr_next(attr);
+		if (!attr) {
+			return NULL;
+		}
+	}
+
+	/* Find the CCC Descriptor */
+	while (bt_uuid_cmp(attr->uuid, BT_UUID_GATT_CCC) &&
+	       /* Also stop if we leave the current characteristic definition */
+	       bt_uuid_cmp(attr->uuid, BT_UUID_GATT_CHRC) &&
+	       bt_uuid_cmp(attr->uuid, BT_UUID_GATT_PRIMARY) &&
+	       bt_uuid_cmp(attr->uuid, BT_UUID_GATT_SECONDARY)) {
+		attr = bt_gatt_attr_next(attr);
+		if (!attr) {
+			return NULL;
+		}
+	}
+
+	if (bt_uuid_cmp(attr->uuid, BT_UUID_GATT_CCC) != 0) {
+		return NULL;
+	}
+
+	return attr;
+}
+
+static bool gatt_ccc_type_enabled(struct bt_conn *conn,
+				  const struct bt_gatt_attr *ccc,
+				  uint16_t ccc_type)
+{
+	uint16_t ccc_bits;
+	uint8_t ccc_bits_encoded[sizeof(ccc_bits)];
+	ssize_t len;
+
+	if (!ccc->read) {
+		LOG_ERR("Read method not set");
+		return false;
+	}
+
+	len = ccc->read(conn, ccc, ccc_bits_encoded, sizeof(ccc_bits_encoded), 0);
+	if (len < 0) {
+		LOG_ERR("Failed to read attribute %p (err %zd)", ccc, len);
+		return false;
+	} else if (len != sizeof(ccc_bits_encoded)) {
+		LOG_ERR("Invalid read length: %zd", len);
+		return false;
+	}
+
+	ccc_bits = sys_get_le16(ccc_bits_encoded);
+
+	/* Check if the CCC bits match the subscription type */
+	return (ccc_bits & ccc_type) != 0;
+}
+
 static int gatt_notify(struct bt_conn *conn, uint16_t handle,
-		       struct bt_gatt_notify_params *params)
+		       struct bt_gatt_notify_params *params,
+		       const struct bt_gatt_attr *ccc)
 {
 	struct net_buf *buf;
 	struct bt_att_notify *nfy;
@@ -2526,11 +2592,20 @@ static int gatt_notify(struct bt_conn *conn, uint16_t handle,
 	}
 
 	if (IS_ENABLED(CONFIG_BT_GATT_ENFORCE_SUBSCRIPTION)) {
+		bool subscribed;
+
 		/* Check if client has subscribed before sending notifications.
 		 * This is not really required in the Bluetooth specification,
 		 * but follows its spirit.
 		 */
-		if (!bt_gatt_is_subscribed(conn, params->attr, BT_GATT_CCC_NOTIFY)) {
+		if (ccc) {
+			subscribed = gatt_ccc_type_enabled(conn, ccc, BT_GATT_CCC_NOTIFY);
+		} else {
+			subscribed = bt_gatt_is_subscribed(conn, params->attr,
+							   BT_GATT_CCC_NOTIFY);
+		}
+
+		if (!subscribed) {
 			LOG_WRN("Device is not subscribed to characteristic");
 			return -EINVAL;
 		}
@@ -2827,7 +2902,7 @@ static uint8_t notify_cb(const struct bt_gatt_attr *attr, uint16_t handle,
 			}
 		} else if ((data->type == BT_GATT_CCC_NOTIFY) &&
 			   (cfg->value & BT_GATT_CCC_NOTIFY)) {
-			err = gatt_notify(conn, data->handle, data->nfy_params);
+			err = gatt_notify(conn, data->handle, data->nfy_params, NULL);
 		} else {
 			err = 0;
 		}
@@ -2933,7 +3008,7 @@ int bt_gatt_notify_cb(struct bt_conn *conn,
 	}
 
 	if (conn) {
-		return gatt_notify(conn, data.handle, params);
+		return gatt_notify(conn, data.handle, params, NULL);
 	}
 
 	data.err = -ENOTCONN;
@@ -2946,6 +3021,69 @@ int bt_gatt_notify_cb(struct bt_conn *conn,
 	return data.err;
 }
 
+int bt_gatt_notify_prepare(struct bt_gatt_notify_prepared *prepared,
+			   const struct bt_gatt_attr *attr)
+{
+	uint16_t handle;
+
+	CHECKIF(!prepared || !attr) {
+		return -EINVAL;
+	}
+
+	handle = bt_gatt_attr_get_handle(attr);
+	if (!handle) {
+		return -ENOENT;
+	}
+
+	/* Check if attribute is a characteristic then adjust to its value */
+	if (!bt_uuid_cmp(attr->uuid, BT_UUID_GATT_CHRC)) {
+		struct bt_gatt_chrc *chrc = attr->user_data;
+
+		if (!(chrc->properties & BT_GATT_CHRC_NOTIFY)) {
+			return -EINVAL;
+		}
+
+		handle = bt_gatt_attr_value_handle(attr);
+
+		attr = bt_gatt_attr_next(attr);
+		if (!attr) {
+			return -ENOENT;
+		}
+	}
+
+	prepared->ccc = gatt_ccc_attr_find(attr);
+	if (!prepared->ccc) {
+		return -EINVAL;
+	}
+
+	prepared->attr = attr;
+	prepared->handle = handle;
+
+	return 0;
+}
+
+int bt_gatt_notify_prepared_cb(struct bt_conn *conn,
+			       const struct bt_gatt_notify_prepared *prepared,
+			       struct bt_gatt_notify_params *params)
+{
+	__ASSERT(conn, "invalid parameters\n");
+	__ASSERT(params, "invalid parameters\n");
+	__ASSERT(prepared && prepared->attr && prepared->ccc,
+		 "invalid parameters\n");
+
+	if (!atomic_test_bit(bt_dev.flags, BT_DEV_READY)) {
+		return -EAGAIN;
+	}
+
+	if (conn->state != BT_CONN_CONNECTED) {
+		return -ENOTCONN;
+	}
+
+	params->attr = prepared->attr;
+
+	return gatt_notify(conn, prepared->handle, params, prepared->ccc);
+}
+
 #if defined(CONFIG_BT_GATT_NOTIFY_MULTIPLE)
 static int gatt_notify_multiple_verify_args(struct bt_conn *conn,
 					    struct bt_gatt_notify_params params[],
@@ -3462,9 +3600,7 @@ static uint8_t disconnected_cb(const struct bt_gatt_attr *attr, uint16_t handle,
 bool bt_gatt_is_subscribed(struct bt_conn *conn,
 			   const struct bt_gatt_attr *attr, uint16_t ccc_type)
 {
-	uint16_t ccc_bits;
-	uint8_t ccc_bits_encoded[sizeof(ccc_bits)];
-	ssize_t len;
+	const struct bt_gatt_attr *ccc;
 
 	__ASSERT(conn, "invalid parameter\n");
 	__ASSERT(attr, "invalid parameter\n");
@@ -3476,6 +3612,7 @@ bool bt_gatt_is_subscribed(struct bt_conn *conn,
 	/* Check if attribute is a characteristic declaration */
 	if (!bt_uuid_cmp(attr->uuid, BT_UUID_GATT_CHRC)) {
 		uint8_t properties;
+		ssize_t len;
 
 		if (!attr->read) {
 			LOG_ERR("Read method not set");
@@ -3500,50 +3637,13 @@ bool bt_gatt_is_subscribed(struct bt_conn *conn,
 		__ASSERT(attr, "No more attributes\n");
 	}
 
-	/* Check if attribute is a characteristic value */
-	if (bt_uuid_cmp(attr->uuid, BT_UUID_GATT_CCC) != 0) {
-		attr = bt_gatt_attr_next(attr);
-		__ASSERT(attr, "No more attributes\n");
-	}
-
 	/* Find the CCC Descriptor */
-	while (bt_uuid_cmp(attr->uuid, BT_UUID_GATT_CCC) &&
-	       /* Also stop if we leave the current characteristic definition */
-	       bt_uuid_cmp(attr->uuid, BT_UUID_GATT_CHRC) &&
-	       bt_uuid_cmp(attr->uuid, BT_UUID_GATT_PRIMARY) &&
-	       bt_uuid_cmp(attr->uuid, BT_UUID_GATT_SECONDARY)) {
-		attr = bt_gatt_attr_next(attr);
-		if (!attr) {
-			return false;
-		}
-	}
-
-	if (bt_uuid_cmp(attr->uuid, BT_UUID_GATT_CCC) != 0) {
+	ccc = gatt_ccc_attr_find(attr);
+	if (!ccc) {
 		return false;
 	}
 
-	if (!attr->read) {
-		LOG_ERR("Read method not set");
-		return false;
-	}
-
-	len = attr->read(conn, attr, ccc_bits_encoded, sizeof(ccc_bits_encoded), 0);
-	if (len < 0) {
-		LOG_ERR("Failed to read attribute %p (err %zd)", attr, len);
-		return false;
-	} else if (len != sizeof(ccc_bits_encoded)) {
-		LOG_ERR("Invalid read length: %zd", len);
-		return false;
-	}
-
-	ccc_bits = sys_get_le16(ccc_bits_encoded);
-
-	/* Check if the CCC bits match the subscription type */
-	if (ccc_bits & ccc_type) {
-		return true;
-	}
-
-	return false;
+	return gatt_ccc_type_enabled(conn, ccc, ccc_type);
 }
 
 static bool gatt_sub_is_empty(struct gatt_sub *sub)
@@ -4232,34 +4232,41 @@ static void rx_work_handler(struct k_work *work)
 
 	struct net_buf *buf;
 
-	LOG_DBG("Getting net_buf from queue");
-	buf = net_buf_slist_get(&bt_dev.rx_queue);
-	if (!buf) {
-		return;
-	}
+	/* Process up to CONFIG_BT_RECV_BATCH_COUNT queued packets per
+	 * invocation to amortize the workqueue wakeup and resubmission
+	 * overhead when the transport delivers packets faster than they
+	 * are consumed.
+	 */
+	for (int i = 0; i < CONFIG_BT_RECV_BATCH_COUNT; i++) {
+		LOG_DBG("Getting net_buf from queue");
+		buf = net_buf_slist_get(&bt_dev.rx_queue);
+		if (!buf) {
+			return;
+		}
 
-	type = net_buf_pull_u8(buf);
+		type = net_buf_pull_u8(buf);
 
-	LOG_DBG("buf %p type %u len %u", buf, type, buf->len);
+		LOG_DBG("buf %p type %u len %u", buf, type, buf->len);
 
-	switch (type) {
+		switch (type) {
 #if defined(CONFIG_BT_CONN)
-	case BT_HCI_H4_ACL:
-		hci_acl(buf);
-		break;
+		case BT_HCI_H4_ACL:
+			hci_acl(buf);
+			break;
 #endif /* CONFIG_BT_CONN */
 #if defined(CONFIG_BT_ISO)
-	case BT_HCI_H4_ISO:
-		hci_iso(buf);
-		break;
+		case BT_HCI_H4_ISO:
+			hci_iso(buf);
+			break;
 #endif /* CONFIG_BT_ISO */
-	case BT_HCI_H4_EVT:
-		hci_event(buf);
-		break;
-	default:
-		LOG_ERR("Unknown buf type %u", type);
-		net_buf_unref(buf);
-		break;
+		case BT_HCI_H4_EVT:
+			hci_event(buf);
+			break;
+		default:
+			LOG_ERR("Unknown buf type %u", type);
+			net_buf_unref(buf);
+			break;
+		}
 	}
 
 	/* Schedule the work handler to be executed again if there are
@@ -4744,7 +4751,7 @@ static bool process_pending_cmd(k_timeout_t timeout)
 	return false;
 }
 
-static void tx_processor(struct k_work *item)
+static void tx_process(void)
 {
 	LOG_DBG("TX process start");
 	if (process_pending_cmd(K_NO_WAIT)) {
@@ -4761,6 +4768,73 @@ static void tx_processor(struct k_work *item)
 	}
 }
 
+#if defined(CONFIG_BT_CONN_TX_DIRECT)
+
+/* TX processor ownership. The TX processor is not re-entrant, so only one
+ * context may run it at a time. Contenders record a pending request that the
+ * owner honors before releasing ownership.
+ */
+enum {
+	TX_PROCESSING,
+	TX_PENDING,
+};
+static atomic_t tx_state;
+
+static void tx_processor(struct k_work *item);
+static K_WORK_DEFINE(tx_work, tx_processor);
+
+static void tx_try_process(void)
+{
+	atomic_set_bit(&tx_state, TX_PENDING);
+
+	if (atomic_test_and_set_bit(&tx_state, TX_PROCESSING)) {
+		/* The owner re-checks TX_PENDING before releasing ownership,
+		 * so this request is not lost.
+		 */
+		return;
+	}
+
+	atomic_clear_bit(&tx_state, TX_PENDING);
+
+	tx_process();
+
+	atomic_clear_bit(&tx_state, TX_PROCESSING);
+
+	if (atomic_test_bit(&tx_state, TX_PENDING)) {
+		k_work_submit(&tx_work);
+	}
+}
+
+static void tx_processor(struct k_work *item)
+{
+	ARG_UNUSED(item);
+
+	tx_try_process();
+}
+
+void bt_tx_irq_raise(void)
+{
+	LOG_DBG("kick TX");
+
+	if (k_is_in_isr()) {
+		k_work_submit(&tx_work);
+		return;
+	}
+
+	/* Process one batch inline, skipping the context switch to the system
+	 * work queue. Any work that cannot be done inline (processor already
+	 * owned, or more data left after one pass) ends up on the work queue.
+	 */
+	tx_try_process();
+}
+
+#else /* !CONFIG_BT_CONN_TX_DIRECT */
+
+static void tx_processor(struct k_work *item)
+{
+	tx_process();
+}
+
 static K_WORK_DEFINE(tx_work, tx_processor);
 
 void bt_tx_irq_raise(void)
@@ -4768,3 +4842,5 @@ void bt_tx_irq_raise(void)
 	LOG_DBG("kick TX");
 	k_work_submit(&tx_work);
 }
+
+#endif /* CONFIG_BT_CONN_TX_DIRECT */
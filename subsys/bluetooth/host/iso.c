@@ -235,6 +235,7 @@ static void bt_iso_chan_add(struct bt_conn *iso, struct bt_iso_chan *chan)
 	chan->iso = iso;
 	iso->iso.chan = chan;
 	k_fifo_init(&iso->iso.txq);
+	atomic_clear(&iso->iso.staged_sdus);
 
 	LOG_DBG("iso %p chan %p", iso, chan);
 }
@@ -805,6 +806,7 @@ static struct net_buf *iso_data_pull(struct bt_conn *conn, size_t amount, size_t
 		LOG_DBG("channel has been disconnected");
 		__ASSERT_NO_MSG(b == frag);
 
+		atomic_dec(&conn->iso.staged_sdus);
 		net_buf_unref(b);
 
 		/* Service other connections */
@@ -828,6 +830,8 @@ static struct net_buf *iso_data_pull(struct bt_conn *conn, size_t amount, size_t
 
 		BT_ISO_DATA_DBG("last frag, pop buf");
 		__ASSERT_NO_MSG(b == frag);
+
+		atomic_dec(&conn->iso.staged_sdus);
 	}
 
 	*length = frag->len;
@@ -867,6 +871,21 @@ int conn_iso_send(struct bt_conn *conn, struct net_buf *buf, enum bt_iso_timesta
 		return -EINVAL;
 	}
 
+	atomic_val_t staged = atomic_inc(&conn->iso.staged_sdus);
+
+	if ((CONFIG_BT_ISO_TX_MAX_STAGED_SDUS > 0) &&
+	    (staged >= CONFIG_BT_ISO_TX_MAX_STAGED_SDUS)) {
+		/* The staged queue is drained by controller buffer credits.
+		 * Refusing new SDUs here gives the application backpressure
+		 * so that pre-encoded SDUs do not go stale behind a stalled
+		 * controller.
+		 */
+		atomic_dec(&conn->iso.staged_sdus);
+		LOG_DBG("Staged SDU limit (%d) reached", CONFIG_BT_ISO_TX_MAX_STAGED_SDUS);
+
+		return -ENOBUFS;
+	}
+
 	k_fifo_put(&conn->iso.txq, buf);
 	BT_ISO_DATA_DBG("%p put on list", buf);
 
@@ -1252,7 +1252,22 @@ static void l2cap_chan_rx_init(struct bt_l2cap_le_chan *chan)
 		chan->rx.mtu = chan->rx.mps - BT_L2CAP_SDU_HDR_SIZE;
 	}
 
-	atomic_set(&chan->rx.credits, 1);
+	if (!chan->rx.init_credits) {
+		chan->rx.init_credits = CONFIG_BT_L2CAP_RX_CREDITS;
+	}
+
+	if (!chan->rx.credits_watermark) {
+		chan->rx.credits_watermark = CONFIG_BT_L2CAP_RX_CREDITS_WATERMARK;
+	}
+
+	/* A watermark above the window would make the peer run out of
+	 * credits waiting for a return that never comes.
+	 */
+	chan->rx.credits_watermark = MIN(chan->rx.credits_watermark,
+					 chan->rx.init_credits);
+
+	atomic_set(&chan->rx.credits, chan->rx.init_credits);
+	atomic_set(&chan->_pending_rx_credits, 0);
 }
 
 /** @brief Get @c chan->state.
@@ -2315,8 +2330,7 @@ static void l2cap_chan_send_credits(struct bt_l2cap_le_chan *chan,
 		return;
 	}
 
-	__ASSERT_NO_MSG(atomic_get(&chan->rx.credits) == 0);
-	atomic_set(&chan->rx.credits, credits);
+	atomic_add(&chan->rx.credits, credits);
 
 	ev = net_buf_add(buf, sizeof(*ev));
 	ev->cid = sys_cpu_to_le16(chan->rx.cid);
@@ -2327,6 +2341,20 @@ static void l2cap_chan_send_credits(struct bt_l2cap_le_chan *chan,
 	LOG_DBG("chan %p credits %lu", chan, atomic_get(&chan->rx.credits));
 }
 
+static void l2cap_chan_return_credits(struct bt_l2cap_le_chan *chan,
+				      uint16_t credits)
+{
+	atomic_val_t pending;
+
+	pending = atomic_add(&chan->_pending_rx_credits, credits) + credits;
+	if (pending < chan->rx.credits_watermark) {
+		return;
+	}
+
+	atomic_sub(&chan->_pending_rx_credits, pending);
+	l2cap_chan_send_credits(chan, pending);
+}
+
 #if defined(CONFIG_BT_L2CAP_SEG_RECV)
 static int l2cap_chan_send_credits_pdu(struct bt_conn *conn, uint16_t cid, uint16_t credits)
 {
@@ -2434,7 +2462,7 @@ int bt_l2cap_chan_recv_complete(struct bt_l2cap_chan *chan, struct net_buf *buf)
 	LOG_DBG("chan %p buf %p", chan, buf);
 
 	if (bt_l2cap_chan_get_state(&le_chan->chan) == BT_L2CAP_CONNECTED) {
-		l2cap_chan_send_credits(le_chan, 1);
+		l2cap_chan_return_credits(le_chan, 1);
 	}
 
 	return 0;
@@ -2463,7 +2491,6 @@ static void l2cap_chan_le_recv_sdu(struct bt_l2cap_le_chan *chan,
 	LOG_DBG("chan %p len %u", chan, buf->len);
 
 	__ASSERT_NO_MSG(bt_l2cap_chan_get_state(&chan->chan) == BT_L2CAP_CONNECTED);
-	__ASSERT_NO_MSG(atomic_get(&chan->rx.credits) == 0);
 
 	/* Receiving complete SDU, notify channel and reset SDU buf */
 	err = chan->chan.ops->recv(&chan->chan, buf);
@@ -2475,7 +2502,7 @@ static void l2cap_chan_le_recv_sdu(struct bt_l2cap_le_chan *chan,
 		}
 		return;
 	} else if (bt_l2cap_chan_get_state(&chan->chan) == BT_L2CAP_CONNECTED) {
-		l2cap_chan_send_credits(chan, 1);
+		l2cap_chan_return_credits(chan, 1);
 	}
 
 	net_buf_unref(buf);
@@ -2678,7 +2705,7 @@ static void l2cap_chan_le_recv(struct bt_l2cap_le_chan *chan,
 	 * in the recv() callback above
 	 */
 	if (bt_l2cap_chan_get_state(&chan->chan) == BT_L2CAP_CONNECTED) {
-		l2cap_chan_send_credits(chan, 1);
+		l2cap_chan_return_credits(chan, 1);
 	}
 }
 
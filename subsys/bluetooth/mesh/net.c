@@ -84,7 +84,9 @@ static struct {
 	uint32_t src : 15, /* MSb of source is always 0 */
 	      seq : 17;
 } msg_cache[CONFIG_BT_MESH_MSG_CACHE_SIZE];
+#if !defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
 static uint16_t msg_cache_next;
+#endif
 
 /* Singleton network context (the implementation only supports one) */
 struct bt_mesh_net bt_mesh = {
@@ -145,6 +147,75 @@ static bool check_dup(struct net_buf_simple *data)
 	return false;
 }
 
+#if defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
+/* Number of consecutive slots probed on lookup and insertion. A short window
+ * keeps collisions from evicting unrelated entries without turning lookups
+ * back into a scan of the whole cache.
+ */
+#define MSG_CACHE_PROBE 4
+
+static uint16_t msg_cache_slot(uint16_t src, uint32_t seq)
+{
+	uint32_t key = ((uint32_t)src << 17) | seq;
+
+	/* Knuth multiplicative hash */
+	return (key * 2654435761U) % ARRAY_SIZE(msg_cache);
+}
+
+static bool msg_cache_match(struct net_buf_simple *pdu)
+{
+	uint16_t src = SRC(pdu->data);
+	uint32_t seq = SEQ(pdu->data) & BIT_MASK(17);
+	uint16_t slot = msg_cache_slot(src, seq);
+
+	for (int i = 0; i < MSG_CACHE_PROBE; i++) {
+		uint16_t pos = (slot + i) % ARRAY_SIZE(msg_cache);
+
+		if (msg_cache[pos].src == src && msg_cache[pos].seq == seq) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void msg_cache_add(struct bt_mesh_net_rx *rx)
+{
+	uint32_t seq = rx->seq & BIT_MASK(17);
+	uint16_t slot = msg_cache_slot(rx->ctx.addr, seq);
+	uint16_t victim = slot;
+
+	/* Prefer an empty slot in the probe window, otherwise overwrite the
+	 * home slot. Eviction happens on collision instead of in FIFO order.
+	 */
+	for (int i = 0; i < MSG_CACHE_PROBE; i++) {
+		uint16_t pos = (slot + i) % ARRAY_SIZE(msg_cache);
+
+		if (!msg_cache[pos].src) {
+			victim = pos;
+			break;
+		}
+	}
+
+	msg_cache[victim].src = rx->ctx.addr;
+	msg_cache[victim].seq = seq;
+}
+
+static void msg_cache_remove(struct bt_mesh_net_rx *rx)
+{
+	uint32_t seq = rx->seq & BIT_MASK(17);
+	uint16_t slot = msg_cache_slot(rx->ctx.addr, seq);
+
+	for (int i = 0; i < MSG_CACHE_PROBE; i++) {
+		uint16_t pos = (slot + i) % ARRAY_SIZE(msg_cache);
+
+		if (msg_cache[pos].src == rx->ctx.addr && msg_cache[pos].seq == seq) {
+			msg_cache[pos].src = BT_MESH_ADDR_UNASSIGNED;
+			break;
+		}
+	}
+}
+#else /* !CONFIG_BT_MESH_MSG_CACHE_HASH */
 static bool msg_cache_match(struct net_buf_simple *pdu)
 {
 	uint16_t i;
@@ -174,6 +245,15 @@ static void msg_cache_add(struct bt_mesh_net_rx *rx)
 	msg_cache_next++;
 }
 
+static void msg_cache_remove(struct bt_mesh_net_rx *rx)
+{
+	ARG_UNUSED(rx);
+
+	/* Rewind the next index now that we're not using this entry */
+	msg_cache[--msg_cache_next].src = BT_MESH_ADDR_UNASSIGNED;
+}
+#endif /* CONFIG_BT_MESH_MSG_CACHE_HASH */
+
 static void store_iv(bool only_duration)
 {
 	bt_mesh_settings_store_schedule(BT_MESH_SETTINGS_IV_PENDING);
@@ -216,7 +296,9 @@ int bt_mesh_net_create(uint16_t idx, uint8_t flags, const struct bt_mesh_key *ke
 	}
 
 	(void)memset(msg_cache, 0, sizeof(msg_cache));
+#if !defined(CONFIG_BT_MESH_MSG_CACHE_HASH)
 	msg_cache_next = 0U;
+#endif
 
 	bt_mesh.iv_index = iv_index;
 	atomic_set_bit_to(bt_mesh.flags, BT_MESH_IVU_IN_PROGRESS,
@@ -653,9 +735,17 @@ static bool net_decrypt(struct bt_mesh_net_rx *rx, struct net_buf_simple *in,
 		return false;
 	}
 
-	if (rx->net_if == BT_MESH_NET_IF_ADV && msg_cache_match(out)) {
-		LOG_DBG("Duplicate found in Network Message Cache");
-		return false;
+	if (rx->net_if == BT_MESH_NET_IF_ADV) {
+		bool hit = msg_cache_match(out);
+
+		if (IS_ENABLED(CONFIG_BT_MESH_STATISTIC)) {
+			bt_mesh_stat_msg_cache(hit);
+		}
+
+		if (hit) {
+			LOG_DBG("Duplicate found in Network Message Cache");
+			return false;
+		}
 	}
 
 	LOG_DBG("src 0x%04x", rx->ctx.addr);
@@ -911,8 +1001,7 @@ void bt_mesh_net_recv(struct net_buf_simple *data, int8_t rssi,
 		 * it again in the future.
 		 */
 		LOG_WRN("Removing rejected message from Network Message Cache");
-		/* Rewind the next index now that we're not using this entry */
-		msg_cache[--msg_cache_next].src = BT_MESH_ADDR_UNASSIGNED;
+		msg_cache_remove(&rx);
 		dup_cache[--dup_cache_next] = 0;
 		return;
 	} else if (err == -EBADMSG) {
@@ -49,6 +49,81 @@ static inline int rpl_idx(const struct bt_mesh_rpl *rpl)
 	return rpl - &replay_list[0];
 }
 
+#if defined(CONFIG_BT_MESH_RPL_INDEX)
+/* Open addressing hash index over replay_list, mapping a source address to
+ * its list slot. Each entry holds the slot number plus one, with zero
+ * marking an empty index slot. Keeping the table at twice the list capacity
+ * guarantees a free slot, so probing always terminates. The index is rebuilt
+ * lazily after the list has been compacted or loaded from settings.
+ */
+#define RPL_INDEX_SIZE (2 * CONFIG_BT_MESH_CRPL)
+
+static uint16_t rpl_index[RPL_INDEX_SIZE];
+static bool rpl_index_valid;
+
+static uint16_t rpl_index_slot(uint16_t src)
+{
+	/* Knuth multiplicative hash */
+	return ((uint32_t)src * 2654435761U) % RPL_INDEX_SIZE;
+}
+
+static void rpl_index_insert(uint16_t src, int idx)
+{
+	uint16_t slot = rpl_index_slot(src);
+
+	for (int i = 0; i < RPL_INDEX_SIZE; i++) {
+		uint16_t pos = (slot + i) % RPL_INDEX_SIZE;
+
+		if (rpl_index[pos] == 0) {
+			rpl_index[pos] = idx + 1;
+			return;
+		}
+	}
+}
+
+static void rpl_index_invalidate(void)
+{
+	rpl_index_valid = false;
+}
+
+static void rpl_index_rebuild(void)
+{
+	(void)memset(rpl_index, 0, sizeof(rpl_index));
+
+	for (int i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		if (replay_list[i].src) {
+			rpl_index_insert(replay_list[i].src, i);
+		}
+	}
+
+	rpl_index_valid = true;
+}
+
+static struct bt_mesh_rpl *rpl_index_find(uint16_t src)
+{
+	uint16_t slot = rpl_index_slot(src);
+
+	for (int i = 0; i < RPL_INDEX_SIZE; i++) {
+		uint16_t pos = (slot + i) % RPL_INDEX_SIZE;
+		uint16_t idx = rpl_index[pos];
+
+		if (idx == 0) {
+			return NULL;
+		}
+
+		if (replay_list[idx - 1].src == src) {
+			return &replay_list[idx - 1];
+		}
+	}
+
+	return NULL;
+}
+#else /* !CONFIG_BT_MESH_RPL_INDEX */
+static inline void rpl_index_insert(uint16_t src, int idx) {}
+
+static inline void rpl_index_invalidate(void) {}
+#endif /* CONFIG_BT_MESH_RPL_INDEX */
+
 static void clear_rpl(struct bt_mesh_rpl *rpl)
 {
 	int err;
@@ -92,6 +167,11 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		rpl->seg = 0;
 	}
 
+	if (rpl->src != rx->ctx.addr) {
+		/* Previously empty slot */
+		rpl_index_insert(rx->ctx.addr, rpl_idx(rpl));
+	}
+
 	rpl->src = rx->ctx.addr;
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
@@ -109,8 +189,7 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
  */
 bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx, struct bt_mesh_rpl **match, bool bridge)
 {
-	struct bt_mesh_rpl *rpl;
-	int i;
+	struct bt_mesh_rpl *rpl = NULL;
 
 	/* Don't bother checking messages from ourselves */
 	if (rx->net_if == BT_MESH_NET_IF_LOCAL) {
@@ -122,42 +201,64 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx, struct bt_mesh_rpl **match, bo
 		return false;
 	}
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		rpl = &replay_list[i];
-
-		/* Empty slot */
-		if (!rpl->src) {
-			goto match;
-		}
+#if defined(CONFIG_BT_MESH_RPL_INDEX)
+	if (!rpl_index_valid) {
+		rpl_index_rebuild();
+	}
 
-		/* Existing slot for given address */
-		if (rpl->src == rx->ctx.addr) {
-			if (!rpl->old_iv &&
-			    atomic_test_bit(rpl_flags, PENDING_RESET) &&
-			    !atomic_test_bit(store, i)) {
-				/* Until rpl reset is finished, entry with old_iv == false and
-				 * without "store" bit set will be removed, therefore it can be
-				 * reused. If such entry is reused, "store" bit will be set and
-				 * the entry won't be removed.
-				 */
+	rpl = rpl_index_find(rx->ctx.addr);
+	if (rpl == NULL) {
+		/* Unknown source address. Allocation is rare enough that a
+		 * scan for a free slot is acceptable.
+		 */
+		for (int i = 0; i < ARRAY_SIZE(replay_list); i++) {
+			if (!replay_list[i].src) {
+				rpl = &replay_list[i];
 				goto match;
 			}
+		}
 
-			if (rx->old_iv && !rpl->old_iv) {
-				return true;
-			}
-
-			if ((!rx->old_iv && rpl->old_iv) ||
-			    rpl->seq < rx->seq) {
-				goto match;
-			} else {
-				return true;
-			}
+		LOG_ERR("RPL is full!");
+		return true;
+	}
+#else
+	for (int i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		if (!replay_list[i].src || replay_list[i].src == rx->ctx.addr) {
+			rpl = &replay_list[i];
+			break;
 		}
 	}
 
-	LOG_ERR("RPL is full!");
-	return true;
+	if (rpl == NULL) {
+		LOG_ERR("RPL is full!");
+		return true;
+	}
+
+	/* Empty slot */
+	if (!rpl->src) {
+		goto match;
+	}
+#endif
+
+	/* Existing slot for given address */
+	if (!rpl->old_iv &&
+	    atomic_test_bit(rpl_flags, PENDING_RESET) &&
+	    !atomic_test_bit(store, rpl_idx(rpl))) {
+		/* Until rpl reset is finished, entry with old_iv == false and
+		 * without "store" bit set will be removed, therefore it can be
+		 * reused. If such entry is reused, "store" bit will be set and
+		 * the entry won't be removed.
+		 */
+		goto match;
+	}
+
+	if (rx->old_iv && !rpl->old_iv) {
+		return true;
+	}
+
+	if (!((!rx->old_iv && rpl->old_iv) || rpl->seq < rx->seq)) {
+		return true;
+	}
 
 match:
 	if (match) {
@@ -175,6 +276,7 @@ void bt_mesh_rpl_clear(void)
 
 	if (!IS_ENABLED(CONFIG_BT_SETTINGS)) {
 		(void)memset(replay_list, 0, sizeof(replay_list));
+		rpl_index_invalidate();
 		return;
 	}
 
@@ -261,6 +363,7 @@ void bt_mesh_rpl_reset(void)
 		}
 
 		(void)memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+		rpl_index_invalidate();
 	}
 }
 
@@ -284,6 +387,7 @@ static int rpl_set(const char *name, size_t len_rd,
 		LOG_DBG("val (null)");
 		if (entry) {
 			(void)memset(entry, 0, sizeof(*entry));
+			rpl_index_invalidate();
 		} else {
 			LOG_WRN("Unable to find RPL entry for 0x%04x", src);
 		}
@@ -297,6 +401,8 @@ static int rpl_set(const char *name, size_t len_rd,
 			LOG_ERR("Unable to allocate RPL entry for 0x%04x", src);
 			return -ENOMEM;
 		}
+
+		rpl_index_invalidate();
 	}
 
 	err = bt_mesh_settings_set(read_cb, cb_arg, &rpl, sizeof(rpl));
@@ -403,6 +509,11 @@ void bt_mesh_rpl_pending_store(uint16_t addr)
 	if (addr == BT_MESH_ADDR_ALL_NODES) {
 		(void)memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
 	}
+
+	if (clr || rst) {
+		/* Entries may have been cleared or compacted */
+		rpl_index_invalidate();
+	}
 }
 
 void bt_mesh_rpl_pending_store_all_nodes(void)
@@ -61,3 +61,12 @@ void bt_mesh_stat_rx(enum bt_mesh_net_if net_if)
 		break;
 	}
 }
+
+void bt_mesh_stat_msg_cache(bool hit)
+{
+	if (hit) {
+		stat.msg_cache_hit++;
+	} else {
+		stat.msg_cache_miss++;
+	}
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <lz4.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/toolchain.h>
+
+#include "coredump_internal.h"
+
+/*
+ * Everything after the coredump header is gathered into chunks of
+ * CONFIG_DEBUG_COREDUMP_COMPRESS_CHUNK_SIZE bytes. Each chunk is compressed
+ * as an independent LZ4 block and emitted with its own header, so a dump
+ * truncated mid-transfer can be decoded up to the last intact chunk.
+ */
+
+#define CHUNK_SIZE CONFIG_DEBUG_COREDUMP_COMPRESS_CHUNK_SIZE
+
+struct coredump_chunk_hdr_t {
+	/* 'L', 'Z', '4', 'C' */
+	char id[4];
+
+	/* Number of payload bytes following this header */
+	uint16_t comp_bytes;
+
+	/* Number of bytes the payload decompresses to. Equal to comp_bytes
+	 * when the payload is stored uncompressed.
+	 */
+	uint16_t raw_bytes;
+
+	/* CRC32 (IEEE) of the payload */
+	uint32_t crc;
+} __packed;
+
+static uint8_t raw_buf[CHUNK_SIZE];
+static uint8_t comp_buf[LZ4_COMPRESSBOUND(CHUNK_SIZE)];
+static size_t raw_len;
+
+/* Compression state used via LZ4_compress_fast_extState() so no memory
+ * needs to be allocated while dumping.
+ */
+static LZ4_stream_t lz4_state;
+
+void z_coredump_compress_start(void)
+{
+	raw_len = 0;
+}
+
+static void emit_chunk(void)
+{
+	struct coredump_chunk_hdr_t hdr = {
+		.id = {'L', 'Z', '4', 'C'},
+	};
+	uint8_t *payload = comp_buf;
+	int comp;
+
+	if (raw_len == 0) {
+		return;
+	}
+
+	comp = LZ4_compress_fast_extState(&lz4_state, (const char *)raw_buf,
+					  (char *)comp_buf, raw_len,
+					  sizeof(comp_buf), 1);
+	if ((comp <= 0) || ((size_t)comp >= raw_len)) {
+		/* Incompressible data is stored verbatim */
+		payload = raw_buf;
+		comp = raw_len;
+	}
+
+	hdr.comp_bytes = sys_cpu_to_le16(comp);
+	hdr.raw_bytes = sys_cpu_to_le16(raw_len);
+	hdr.crc = sys_cpu_to_le32(crc32_ieee(payload, comp));
+
+	z_coredump_backend_output((uint8_t *)&hdr, sizeof(hdr));
+	z_coredump_backend_output(payload, comp);
+
+	raw_len = 0;
+}
+
+void z_coredump_compress_output(uint8_t *buf, size_t buflen)
+{
+	while (buflen > 0) {
+		size_t copy = MIN(buflen, sizeof(raw_buf) - raw_len);
+
+		memcpy(&raw_buf[raw_len], buf, copy);
+		raw_len += copy;
+		buf += copy;
+		buflen -= copy;
+
+		if (raw_len == sizeof(raw_buf)) {
+			emit_chunk();
+		}
+	}
+}
+
+void z_coredump_compress_flush(void)
+{
+	emit_chunk();
+}
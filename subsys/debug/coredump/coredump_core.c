@@ -41,6 +41,10 @@ static struct coredump_backend_api
 #define DT_DRV_COMPAT zephyr_coredump
 #endif
 
+#if defined(CONFIG_PROFILING_FLIGHT_RECORDER)
+#include <zephyr/profiling/flight_recorder.h>
+#endif
+
 #if defined(CONFIG_DEBUG_COREDUMP_DUMP_THREAD_PRIV_STACK)
 __weak void arch_coredump_priv_stack_dump(struct k_thread *thread)
 {
@@ -71,7 +75,8 @@ static void dump_header(unsigned int reason)
 }
 
 #if defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_MIN) || \
-	defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS)
+	defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS) || \
+	defined(CONFIG_DEBUG_COREDUMP_PRIORITIZE_FAULT_DATA)
 static void dump_thread(struct k_thread *thread)
 {
 	uintptr_t end_addr;
@@ -150,6 +155,10 @@ void process_memory_region_list(void)
 #define MY_FN(inst) process_coredump_dev_memory(DEVICE_DT_INST_GET(inst));
 	DT_INST_FOREACH_STATUS_OKAY(MY_FN)
 #endif
+
+#if defined(CONFIG_PROFILING_FLIGHT_RECORDER)
+	sys_fr_coredump();
+#endif
 }
 
 #ifdef CONFIG_DEBUG_COREDUMP_THREADS_METADATA
@@ -184,11 +193,21 @@ void coredump(unsigned int reason, const struct arch_esf *esf,
 #endif
 
 	if (thread != NULL) {
-#ifdef CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_MIN
+#if defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_MIN) || \
+	defined(CONFIG_DEBUG_COREDUMP_PRIORITIZE_FAULT_DATA)
+		/*
+		 * Dumped before the memory region list so a truncated dump
+		 * still contains the faulting thread.
+		 */
 		dump_thread(thread);
 #endif
 	}
 
+#ifdef CONFIG_DEBUG_COREDUMP_PRIORITIZE_FAULT_DATA
+	coredump_memory_dump(POINTER_TO_UINT(&_kernel),
+			     POINTER_TO_UINT(&_kernel) + sizeof(_kernel));
+#endif
+
 	process_memory_region_list();
 
 	z_coredump_end();
@@ -197,13 +216,28 @@ void coredump(unsigned int reason, const struct arch_esf *esf,
 void z_coredump_start(void)
 {
 	backend_api->start();
+
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4
+	z_coredump_compress_start();
+#endif
 }
 
 void z_coredump_end(void)
 {
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4
+	z_coredump_compress_flush();
+#endif
+
 	backend_api->end();
 }
 
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4
+void z_coredump_backend_output(uint8_t *buf, size_t buflen)
+{
+	backend_api->buffer_output(buf, buflen);
+}
+#endif
+
 void coredump_buffer_output(uint8_t *buf, size_t buflen)
 {
 	if ((buf == NULL) || (buflen == 0)) {
@@ -211,7 +245,11 @@ void coredump_buffer_output(uint8_t *buf, size_t buflen)
 		return;
 	}
 
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4
+	z_coredump_compress_output(buf, buflen);
+#else
 	backend_api->buffer_output(buf, buflen);
+#endif
 }
 
 void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
@@ -43,6 +43,36 @@ void z_coredump_start(void);
  */
 void z_coredump_end(void);
 
+#ifdef CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4
+
+/**
+ * @brief Output data through the backend, bypassing compression.
+ *
+ * @param buf Pointer to buffer to be output.
+ * @param buflen Length of buffer.
+ */
+void z_coredump_backend_output(uint8_t *buf, size_t buflen);
+
+/**
+ * @brief Reset the compressor at the beginning of a coredump session.
+ */
+void z_coredump_compress_start(void);
+
+/**
+ * @brief Buffer data for compression, emitting full chunks as needed.
+ *
+ * @param buf Pointer to buffer to be output.
+ * @param buflen Length of buffer.
+ */
+void z_coredump_compress_output(uint8_t *buf, size_t buflen);
+
+/**
+ * @brief Emit any partially filled chunk at the end of a coredump session.
+ */
+void z_coredump_compress_flush(void);
+
+#endif /* CONFIG_DEBUG_COREDUMP_COMPRESS_LZ4 */
+
 /**
  * @endcond
  */
@@ -309,3 +309,205 @@ K_THREAD_DEFINE(thread_analyzer,
 #endif /* CONFIG_THREAD_ANALYZER_AUTO_SEPARATE_CORES */
 
 #endif /* CONFIG_THREAD_ANALYZER_AUTO */
+
+#if defined(CONFIG_THREAD_ANALYZER_CONTINUOUS)
+
+/* Sentinel CPU share marking an entry that has no previous sample yet */
+#define CONTINUOUS_FRESH_ENTRY UINT8_MAX
+
+struct continuous_entry {
+	const struct k_thread *thread;
+	uint8_t stack_pcnt;
+	uint8_t cpu_pcnt;
+	bool stack_alerted;
+	/* Value of continuous_samples when the entry was last updated */
+	uint32_t last_seen;
+};
+
+struct continuous_pick {
+	size_t target;
+	size_t count;
+};
+
+static struct continuous_entry
+	continuous_table[CONFIG_THREAD_ANALYZER_CONTINUOUS_MAX_THREADS];
+static size_t continuous_index;
+static uint32_t continuous_samples;
+static thread_analyzer_event_cb_t continuous_event_cb;
+
+void thread_analyzer_event_cb_set(thread_analyzer_event_cb_t cb)
+{
+	continuous_event_cb = cb;
+}
+
+static void continuous_emit_event(const struct thread_analyzer_event *evt)
+{
+	if (continuous_event_cb != NULL) {
+		continuous_event_cb(evt);
+	} else if (evt->type == THREAD_ANALYZER_EVENT_STACK_HIGH) {
+		LOG_WRN("%s: stack usage %u %%", evt->name, evt->value);
+	} else {
+		LOG_WRN("%s: CPU share %u %% (was %u %%)", evt->name,
+			evt->value, evt->previous);
+	}
+}
+
+/* @brief Find or allocate the tracking entry for a thread
+ *
+ * Threads are keyed by their handle. When the table is full the entry
+ * that was sampled the longest time ago is recycled; it either belongs
+ * to a thread that no longer exists or to one that will simply be
+ * reported as seen for the first time again.
+ */
+static struct continuous_entry *continuous_entry_get(const struct k_thread *thread)
+{
+	struct continuous_entry *victim = &continuous_table[0];
+	struct continuous_entry *entry;
+
+	for (size_t i = 0; i < ARRAY_SIZE(continuous_table); i++) {
+		entry = &continuous_table[i];
+
+		if (entry->thread == thread) {
+			return entry;
+		}
+		if (entry->thread == NULL ||
+		    (victim->thread != NULL &&
+		     entry->last_seen < victim->last_seen)) {
+			victim = entry;
+		}
+	}
+
+	victim->thread = thread;
+	victim->cpu_pcnt = CONTINUOUS_FRESH_ENTRY;
+	victim->stack_alerted = false;
+
+	return victim;
+}
+
+static void continuous_sample_cb(const struct k_thread *cthread, void *user_data)
+{
+	struct k_thread *thread = (struct k_thread *)cthread;
+	struct continuous_pick *pick = user_data;
+	struct continuous_entry *entry;
+	unsigned int stack_pcnt = 0;
+	unsigned int cpu_pcnt = 0;
+	char hexname[PTR_STR_MAXLEN + 1];
+	const char *name;
+	size_t unused;
+	bool fresh;
+
+	if (pick->count++ != pick->target) {
+		return;
+	}
+
+	name = k_thread_name_get((k_tid_t)thread);
+	if (!name || name[0] == '\0') {
+		name = hexname;
+		snprintk(hexname, sizeof(hexname), "%p", (void *)thread);
+	}
+
+	if (k_thread_stack_space_get(thread, &unused) == 0) {
+		stack_pcnt = ((thread->stack_info.size - unused) * 100U) /
+			     thread->stack_info.size;
+	}
+
+#ifdef CONFIG_THREAD_RUNTIME_STATS
+	k_thread_runtime_stats_t rt_stats_all;
+	k_thread_runtime_stats_t usage;
+
+	if ((k_thread_runtime_stats_get(thread, &usage) == 0) &&
+	    (k_thread_runtime_stats_all_get(&rt_stats_all) == 0) &&
+	    (rt_stats_all.execution_cycles > 0U)) {
+		cpu_pcnt = (usage.execution_cycles * 100U) /
+			   rt_stats_all.execution_cycles;
+	}
+#endif
+
+	entry = continuous_entry_get(cthread);
+	fresh = entry->cpu_pcnt == CONTINUOUS_FRESH_ENTRY;
+
+	if (fresh || stack_pcnt != entry->stack_pcnt ||
+	    cpu_pcnt != entry->cpu_pcnt) {
+		THREAD_ANALYZER_PRINT(
+			THREAD_ANALYZER_FMT(" %-20s: STACK: %u %%; CPU: %u %%"),
+			THREAD_ANALYZER_VSTR(name), stack_pcnt, cpu_pcnt);
+	}
+
+	if (stack_pcnt >= CONFIG_THREAD_ANALYZER_CONTINUOUS_STACK_ALERT_PCT) {
+		if (!entry->stack_alerted) {
+			const struct thread_analyzer_event evt = {
+				.type = THREAD_ANALYZER_EVENT_STACK_HIGH,
+				.name = name,
+				.value = stack_pcnt,
+				.previous = entry->stack_pcnt,
+			};
+
+			continuous_emit_event(&evt);
+			entry->stack_alerted = true;
+		}
+	} else {
+		entry->stack_alerted = false;
+	}
+
+	if (!fresh) {
+		unsigned int delta = cpu_pcnt > entry->cpu_pcnt ?
+			cpu_pcnt - entry->cpu_pcnt : entry->cpu_pcnt - cpu_pcnt;
+
+		if (delta >= CONFIG_THREAD_ANALYZER_CONTINUOUS_CPU_DELTA_PCT) {
+			const struct thread_analyzer_event evt = {
+				.type = THREAD_ANALYZER_EVENT_CPU_CHANGE,
+				.name = name,
+				.value = cpu_pcnt,
+				.previous = entry->cpu_pcnt,
+			};
+
+			continuous_emit_event(&evt);
+		}
+	}
+
+	entry->stack_pcnt = stack_pcnt;
+	entry->cpu_pcnt = cpu_pcnt;
+	entry->last_seen = continuous_samples;
+}
+
+static void continuous_work_handler(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(continuous_work, continuous_work_handler);
+
+static void continuous_work_handler(struct k_work *work)
+{
+	struct continuous_pick pick = { .target = continuous_index };
+
+	ARG_UNUSED(work);
+
+	continuous_samples++;
+
+	if (IS_ENABLED(CONFIG_THREAD_ANALYZER_RUN_UNLOCKED)) {
+		k_thread_foreach_unlocked(continuous_sample_cb, &pick);
+	} else {
+		k_thread_foreach(continuous_sample_cb, &pick);
+	}
+
+	/* Advance to the next thread; if threads went away since the last
+	 * sweep the target may not have been reached, wrapping handles it.
+	 */
+	continuous_index++;
+	if (continuous_index >= pick.count) {
+		continuous_index = 0;
+	}
+
+	k_work_schedule(&continuous_work,
+			K_MSEC(CONFIG_THREAD_ANALYZER_CONTINUOUS_INTERVAL_MS));
+}
+
+static int continuous_init(void)
+{
+	k_work_schedule(&continuous_work,
+			K_MSEC(CONFIG_THREAD_ANALYZER_CONTINUOUS_INTERVAL_MS));
+
+	return 0;
+}
+
+SYS_INIT(continuous_init, APPLICATION, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+#endif /* CONFIG_THREAD_ANALYZER_CONTINUOUS */
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Clock (second-chance) eviction algorithm for demand paging
+ *
+ * Evictable page frames are swept in a circular fashion by a clock hand.
+ * A page whose accessed bit is set when the hand reaches it gets a second
+ * chance: the bit is cleared in the page tables and the hand moves on. A
+ * page whose accessed bit is already clear has not been used for a full
+ * revolution of the hand and is selected for eviction, with clean pages
+ * preferred over dirty ones to avoid the write-back to the backing store.
+ *
+ * Unlike the NRU algorithm there is no periodic clearing of the accessed
+ * state: a page only loses its accessed bit when the hand sweeps past it
+ * while looking for a victim, so the pages of the active working set keep
+ * it and effectively form the "active" set the hand skips over, at the
+ * cost of a sweep at eviction time.
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+#include <zephyr/kernel/mm/demand_paging.h>
+
+struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	static uint32_t clock_hand;
+	struct k_mem_page_frame *pf, *dirty_pf = NULL;
+	uintptr_t flags;
+	uint32_t pf_idx;
+
+	/* At most two revolutions of the hand: every accessed bit seen
+	 * during the first one is cleared along the way, so the second
+	 * one always finds a non-accessed page unless every evictable
+	 * page is accessed again in between.
+	 */
+	for (unsigned int pass = 0; pass < 2; pass++) {
+		for (uint32_t n = 0; n < ARRAY_SIZE(k_mem_page_frames); n++) {
+			pf_idx = clock_hand;
+			clock_hand = (clock_hand + 1) % ARRAY_SIZE(k_mem_page_frames);
+			pf = &k_mem_page_frames[pf_idx];
+
+			if (!k_mem_page_frame_is_evictable(pf)) {
+				continue;
+			}
+
+			flags = arch_page_info_get(k_mem_page_frame_to_virt(pf), NULL, false);
+
+			/* Implies a mismatch with page frame ontology and page
+			 * tables
+			 */
+			__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+				 "non-present page, %s",
+				 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+				 "un-mapped" : "paged out");
+
+			if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) {
+				/* Second chance: clear the accessed bit in the
+				 * page tables and move the hand along.
+				 */
+				(void)arch_page_info_get(k_mem_page_frame_to_virt(pf),
+							 NULL, true);
+				continue;
+			}
+
+			if ((flags & ARCH_DATA_PAGE_DIRTY) == 0UL) {
+				*dirty_ptr = false;
+				return pf;
+			}
+
+			/* Remember the first non-accessed dirty page in case
+			 * no clean one turns up during this revolution.
+			 */
+			if (dirty_pf == NULL) {
+				dirty_pf = pf;
+			}
+		}
+
+		if (dirty_pf != NULL) {
+			*dirty_ptr = true;
+			return dirty_pf;
+		}
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(false, "no page to evict");
+
+	return NULL;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+}
+
+#ifdef CONFIG_EVICTION_TRACKING
+/*
+ * Empty functions defined here so that architectures unconditionally
+ * implement eviction tracking can still use this algorithm for
+ * testing.
+ */
+
+void k_mem_paging_eviction_add(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_remove(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_accessed(uintptr_t phys)
+{
+	ARG_UNUSED(phys);
+}
+
+#endif /* CONFIG_EVICTION_TRACKING */
@@ -107,6 +107,80 @@ static int scramble_mcuboot_trailer(struct flash_img_context *ctx)
 }
 
 
+#ifdef CONFIG_IMG_STREAM_HASH
+
+static int stream_hash_start(struct flash_img_context *ctx)
+{
+	int rc;
+
+	ctx->hash_bytes = 0;
+	ctx->hash_finished = false;
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+	ctx->hash_ctx = psa_hash_operation_init();
+	rc = psa_hash_setup(&ctx->hash_ctx, PSA_ALG_SHA_256);
+	if (rc != PSA_SUCCESS) {
+		return -ESRCH;
+	}
+#else
+	mbedtls_sha256_init(&ctx->hash_ctx);
+	rc = mbedtls_sha256_starts(&ctx->hash_ctx, false);
+	if (rc != 0) {
+		mbedtls_sha256_free(&ctx->hash_ctx);
+		return -ESRCH;
+	}
+#endif
+
+	return 0;
+}
+
+static int stream_hash_update(struct flash_img_context *ctx, const uint8_t *data,
+			      size_t len)
+{
+	int rc;
+
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+	rc = psa_hash_update(&ctx->hash_ctx, data, len);
+	if (rc != PSA_SUCCESS) {
+		return -ESRCH;
+	}
+#else
+	rc = mbedtls_sha256_update(&ctx->hash_ctx, data, len);
+	if (rc != 0) {
+		return -ESRCH;
+	}
+#endif
+	ctx->hash_bytes += len;
+
+	return 0;
+}
+
+static int stream_hash_finish(struct flash_img_context *ctx)
+{
+	int rc;
+
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_PSA)
+	size_t hash_len;
+
+	rc = psa_hash_finish(&ctx->hash_ctx, ctx->hash_digest,
+			     sizeof(ctx->hash_digest), &hash_len);
+	if (rc != PSA_SUCCESS) {
+		psa_hash_abort(&ctx->hash_ctx);
+		return -ESRCH;
+	}
+#else
+	rc = mbedtls_sha256_finish(&ctx->hash_ctx, ctx->hash_digest);
+	mbedtls_sha256_free(&ctx->hash_ctx);
+	if (rc != 0) {
+		return -ESRCH;
+	}
+#endif
+	ctx->hash_finished = true;
+
+	return 0;
+}
+
+#endif /* CONFIG_IMG_STREAM_HASH */
+
 int flash_img_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
 			     size_t len, bool flush)
 {
@@ -121,6 +195,16 @@ int flash_img_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
 	}
 
 
+#ifdef CONFIG_IMG_STREAM_HASH
+	/* Hash data as it streams by, so flash_img_check does not need to
+	 * read the image back from flash.
+	 */
+	rc = stream_hash_update(ctx, data, len);
+	if (rc != 0) {
+		return rc;
+	}
+#endif
+
 	/* if CONFIG_IMG_ERASE_PROGRESSIVELY is enabled the enabled CONFIG_STREAM_FLASH_ERASE
 	 * ensures that stream_flash erases flash progresively.
 	 */
@@ -129,6 +213,12 @@ int flash_img_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
 		return rc;
 	}
 
+#ifdef CONFIG_IMG_STREAM_HASH
+	if (rc == 0) {
+		rc = stream_hash_finish(ctx);
+	}
+#endif
+
 	flash_area_close(ctx->flash_area);
 	ctx->flash_area = NULL;
 
@@ -238,14 +328,22 @@ int flash_img_init_id(struct flash_img_context *ctx, uint8_t area_id)
 		}
 	}
 
-	return stream_flash_init(&ctx->stream, flash_dev, ctx->buf, CONFIG_IMG_BLOCK_BUF_SIZE,
-				 (ctx->flash_area->fa_off + sector_data.fs_size),
-				 (ctx->flash_area->fa_size - sector_data.fs_size), NULL);
+	rc = stream_flash_init(&ctx->stream, flash_dev, ctx->buf, CONFIG_IMG_BLOCK_BUF_SIZE,
+			       (ctx->flash_area->fa_off + sector_data.fs_size),
+			       (ctx->flash_area->fa_size - sector_data.fs_size), NULL);
 #else
-	return stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
+	rc = stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
 			CONFIG_IMG_BLOCK_BUF_SIZE, ctx->flash_area->fa_off,
 			ctx->flash_area->fa_size, NULL);
 #endif
+
+#ifdef CONFIG_IMG_STREAM_HASH
+	if (rc == 0) {
+		rc = stream_hash_start(ctx);
+	}
+#endif
+
+	return rc;
 }
 
 #ifdef CONFIG_MCUBOOT_BOOTLOADER_MODE_RAM_LOAD
@@ -284,6 +382,16 @@ int flash_img_check(struct flash_img_context *ctx,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_IMG_STREAM_HASH
+	/* If the streamed digest covers exactly the checked length, compare
+	 * it directly instead of re-reading the image from flash.
+	 */
+	if (ctx->hash_finished && fic->clen == ctx->hash_bytes) {
+		return memcmp(ctx->hash_digest, fic->match,
+			      sizeof(ctx->hash_digest)) ? -EILSEQ : 0;
+	}
+#endif
+
 	rc = flash_area_open(area_id,
 			     (const struct flash_area **)&(ctx->flash_area));
 	if (rc) {
@@ -211,3 +211,187 @@ int disk_access_unregister(struct disk_info *disk)
 	LOG_DBG("disk interface(%s) unregistered", disk->name);
 	return 0;
 }
+
+#ifdef CONFIG_DISK_ACCESS_ASYNC
+
+/* queue of submitted asynchronous disk operations */
+static sys_slist_t disk_ops_queue = SYS_SLIST_STATIC_INIT(&disk_ops_queue);
+
+static K_SEM_DEFINE(disk_ops_sem, 0, K_SEM_MAX_LIMIT);
+
+#ifdef CONFIG_DISK_ACCESS_ASYNC_ELEVATOR
+
+/* Sector just past the last dispatched operation, the reference point of the
+ * elevator sweep. Only a scheduling hint, so sharing it between disks merely
+ * costs some ordering quality when several disks are in use.
+ */
+static uint32_t disk_ops_elevator_pos;
+
+/* Insert an operation so that, per disk, queued operations are serviced in
+ * ascending sector order starting from the elevator position, wrapping around
+ * at the end of the disk. Operations of other disks are left in place, and an
+ * operation that has already been overtaken too often is never overtaken
+ * again.
+ */
+static void disk_ops_queue_insert(struct disk_access_op *op)
+{
+	/* Distance ahead of the sweep position, with wraparound */
+	uint32_t op_key = op->start_sector - disk_ops_elevator_pos;
+	sys_snode_t *prev = NULL;
+	sys_snode_t *node;
+	struct disk_access_op *itr;
+	bool found = false;
+
+	SYS_SLIST_FOR_EACH_NODE(&disk_ops_queue, node) {
+		itr = CONTAINER_OF(node, struct disk_access_op, node);
+
+		if ((itr->disk == op->disk) &&
+		    ((itr->start_sector - disk_ops_elevator_pos) > op_key) &&
+		    (itr->bypass < CONFIG_DISK_ACCESS_ASYNC_MAX_BYPASS)) {
+			found = true;
+			break;
+		}
+
+		prev = node;
+	}
+
+	if (!found) {
+		sys_slist_append(&disk_ops_queue, &op->node);
+		return;
+	}
+
+	sys_slist_insert(&disk_ops_queue, prev, &op->node);
+
+	/* Every operation now behind the inserted one was delayed by it */
+	for (node = sys_slist_peek_next(&op->node); node != NULL;
+	     node = sys_slist_peek_next(node)) {
+		itr = CONTAINER_OF(node, struct disk_access_op, node);
+		itr->bypass++;
+	}
+}
+
+#endif /* CONFIG_DISK_ACCESS_ASYNC_ELEVATOR */
+
+static bool disk_access_op_mergeable(const struct disk_access_op *prev,
+				     const struct disk_access_op *op,
+				     uint32_t sector_size)
+{
+	return (op->disk == prev->disk) && (op->write == prev->write) &&
+	       (op->start_sector == (prev->start_sector + prev->num_sector)) &&
+	       (op->data_buf == (prev->data_buf +
+				 (size_t)prev->num_sector * sector_size));
+}
+
+static void disk_access_op_thread(void *p1, void *p2, void *p3)
+{
+	struct disk_access_op *op, *tail, *itr;
+	k_spinlock_key_t spinlock_key;
+	uint32_t sector_size, num_sector;
+	sys_slist_t chain;
+	sys_snode_t *node;
+	int rc;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&disk_ops_sem, K_FOREVER);
+
+		spinlock_key = k_spin_lock(&lock);
+		node = sys_slist_get(&disk_ops_queue);
+		k_spin_unlock(&lock, spinlock_key);
+		if (node == NULL) {
+			/* Operation was already picked up as part of a
+			 * merged transfer
+			 */
+			continue;
+		}
+
+		op = CONTAINER_OF(node, struct disk_access_op, node);
+		sys_slist_init(&chain);
+		num_sector = op->num_sector;
+		tail = op;
+
+#ifdef CONFIG_DISK_ACCESS_ASYNC_ELEVATOR
+		/* Advance the elevator sweep past this operation */
+		spinlock_key = k_spin_lock(&lock);
+		disk_ops_elevator_pos = op->start_sector + op->num_sector;
+		k_spin_unlock(&lock, spinlock_key);
+#endif
+
+		/*
+		 * Merge directly adjacent operations queued behind this one
+		 * into a single multi-sector transfer. Only consecutive queue
+		 * entries are considered, operations are never reordered.
+		 */
+		sector_size = 0U;
+		rc = op->disk->ops->ioctl(op->disk, DISK_IOCTL_GET_SECTOR_SIZE,
+					  &sector_size);
+		if ((rc == 0) && (sector_size != 0U)) {
+			spinlock_key = k_spin_lock(&lock);
+			while ((node = sys_slist_peek_head(&disk_ops_queue)) != NULL) {
+				itr = CONTAINER_OF(node, struct disk_access_op, node);
+				if (!disk_access_op_mergeable(tail, itr, sector_size)) {
+					break;
+				}
+				(void)sys_slist_get(&disk_ops_queue);
+				sys_slist_append(&chain, &itr->node);
+				num_sector += itr->num_sector;
+				tail = itr;
+			}
+			k_spin_unlock(&lock, spinlock_key);
+		}
+
+		if (op->write) {
+			rc = op->disk->ops->write(op->disk, op->data_buf,
+						  op->start_sector, num_sector);
+		} else {
+			rc = op->disk->ops->read(op->disk, op->data_buf,
+						 op->start_sector, num_sector);
+		}
+
+		/* All merged operations complete with the transfer result */
+		op->cb(op, rc);
+		while ((node = sys_slist_get(&chain)) != NULL) {
+			itr = CONTAINER_OF(node, struct disk_access_op, node);
+			itr->cb(itr, rc);
+		}
+	}
+}
+
+K_THREAD_DEFINE(disk_access_op_tid, CONFIG_DISK_ACCESS_ASYNC_STACK_SIZE,
+		disk_access_op_thread, NULL, NULL, NULL,
+		CONFIG_DISK_ACCESS_ASYNC_THREAD_PRIORITY, 0, 0);
+
+int disk_access_submit(const char *pdrv, struct disk_access_op *op)
+{
+	struct disk_info *disk = disk_access_get_di(pdrv);
+	k_spinlock_key_t spinlock_key;
+
+	if ((disk == NULL) || (disk->ops == NULL) || (op == NULL) ||
+	    (op->cb == NULL) || (op->num_sector == 0U)) {
+		return -EINVAL;
+	}
+
+	if ((disk->ops->ioctl == NULL) ||
+	    ((op->write ? disk->ops->write : disk->ops->read) == NULL)) {
+		return -EINVAL;
+	}
+
+	op->disk = disk;
+	op->bypass = 0U;
+
+	spinlock_key = k_spin_lock(&lock);
+#ifdef CONFIG_DISK_ACCESS_ASYNC_ELEVATOR
+	disk_ops_queue_insert(op);
+#else
+	sys_slist_append(&disk_ops_queue, &op->node);
+#endif
+	k_spin_unlock(&lock, spinlock_key);
+	k_sem_give(&disk_ops_sem);
+
+	return 0;
+}
+
+#endif /* CONFIG_DISK_ACCESS_ASYNC */
@@ -63,10 +63,40 @@ struct char_framebuffer {
 
 	/** Inverted */
 	bool inverted;
+
+#if defined(CONFIG_CHARACTER_FRAMEBUFFER_PARTIAL_UPDATE)
+	/** First line touched since the last finalize */
+	uint16_t dirty_y0;
+
+	/** One past the last line touched since the last finalize */
+	uint16_t dirty_y1;
+#endif
 };
 
 static struct char_framebuffer char_fb;
 
+#if defined(CONFIG_CHARACTER_FRAMEBUFFER_PARTIAL_UPDATE)
+static void mark_dirty_lines(int16_t y, int16_t height)
+{
+	struct char_framebuffer *fb = &char_fb;
+	const int16_t y0 = MAX(y, 0);
+	const int16_t y1 = MIN(y + height, fb->y_res);
+
+	if (y1 <= y0) {
+		return;
+	}
+
+	fb->dirty_y0 = MIN(fb->dirty_y0, y0);
+	fb->dirty_y1 = MAX(fb->dirty_y1, y1);
+}
+#else
+static inline void mark_dirty_lines(int16_t y, int16_t height)
+{
+	ARG_UNUSED(y);
+	ARG_UNUSED(height);
+}
+#endif /* CONFIG_CHARACTER_FRAMEBUFFER_PARTIAL_UPDATE */
+
 static inline uint8_t *get_glyph_ptr(const struct cfb_font *fptr, uint8_t c)
 {
 	return (uint8_t *)fptr->data +
@@ -289,6 +319,7 @@ static inline void draw_point(struct char_framebuffer *fb, int16_t x, int16_t y)
 	}
 
 	fb->buf[index + x] |= m;
+	mark_dirty_lines(y, 1);
 }
 
 static void draw_line(struct char_framebuffer *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
@@ -339,6 +370,7 @@ static int draw_text(const struct device *dev, const char *const str, int16_t x,
 	}
 
 	const size_t len = strlen(str);
+	const int16_t y_start = y;
 
 	for (size_t i = 0; i < len; i++) {
 		if ((x + fptr->width > fb->x_res) && wrap) {
@@ -351,6 +383,9 @@ static int draw_text(const struct device *dev, const char *const str, int16_t x,
 			x += fb->kerning + draw_char_htmono(fb, str[i], x, y, wrap);
 		}
 	}
+
+	mark_dirty_lines(y_start, (y - y_start) + fptr->height);
+
 	return 0;
 }
 
@@ -476,6 +511,8 @@ int cfb_invert_area(const struct device *dev, uint16_t x, uint16_t y,
 			}
 		}
 
+		mark_dirty_lines(y, height);
+
 		return 0;
 	}
 
@@ -501,6 +538,7 @@ int cfb_framebuffer_clear(const struct device *dev, bool clear_display)
 	}
 
 	memset(fb->buf, 0, fb->size);
+	mark_dirty_lines(0, fb->y_res);
 
 	if (clear_display) {
 		cfb_framebuffer_finalize(dev);
@@ -514,6 +552,7 @@ int cfb_framebuffer_invert(const struct device *dev)
 	struct char_framebuffer *fb = &char_fb;
 
 	fb->inverted = !fb->inverted;
+	mark_dirty_lines(0, fb->y_res);
 
 	return 0;
 }
@@ -536,15 +575,42 @@ int cfb_framebuffer_finalize(const struct device *dev)
 		.height = fb->y_res,
 		.pitch = fb->x_res,
 	};
+	uint8_t *buf = fb->buf;
+	uint16_t y = 0U;
+
+#if defined(CONFIG_CHARACTER_FRAMEBUFFER_PARTIAL_UPDATE)
+	uint16_t start;
+	uint16_t end;
+
+	if (char_fb.dirty_y1 <= char_fb.dirty_y0) {
+		/* Nothing has been drawn since the last flush */
+		return 0;
+	}
+
+	/* Flush whole tile rows only. Partial-width writes are not attempted
+	 * since the monochrome display drivers commonly require the pitch to
+	 * be equal to the width.
+	 */
+	start = ROUND_DOWN(char_fb.dirty_y0, 8U);
+	end = MIN(ROUND_UP(char_fb.dirty_y1, 8U), fb->y_res);
+
+	y = start;
+	buf = fb->buf + (start / 8U) * fb->x_res;
+	desc.height = end - start;
+	desc.buf_size = (end - start) / 8U * fb->x_res;
+
+	char_fb.dirty_y0 = fb->y_res;
+	char_fb.dirty_y1 = 0U;
+#endif
 
 	if ((fb->pixel_format == PIXEL_FORMAT_MONO10) == fb->inverted) {
 		cfb_invert(fb);
-		err = api->write(dev, 0, 0, &desc, fb->buf);
+		err = api->write(dev, 0, y, &desc, buf);
 		cfb_invert(fb);
 		return err;
 	}
 
-	return api->write(dev, 0, 0, &desc, fb->buf);
+	return api->write(dev, 0, y, &desc, buf);
 }
 
 int cfb_get_display_parameter(const struct device *dev,
@@ -652,6 +718,7 @@ int cfb_framebuffer_init(const struct device *dev)
 	}
 
 	memset(fb->buf, 0, fb->size);
+	mark_dirty_lines(0, fb->y_res);
 
 	return 0;
 }
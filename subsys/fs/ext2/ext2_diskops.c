@@ -235,8 +235,72 @@ static inline uint32_t get_ngroups(struct ext2_data *fs)
 	return ngroups;
 }
 
+/**
+ * @brief Write back dirty metadata of the cached block group.
+ *
+ * Blocks holding bitmaps and the inode table are written before the group
+ * descriptor so that the on-disk bitmaps never lag behind the free counts
+ * that summarize them.
+ */
+static int flush_bgroup(struct ext2_data *fs)
+{
+	int rc;
+	struct ext2_bgroup *bg = &fs->bgroup;
+
+	if (bg->num < 0 || bg->dirty == 0) {
+		return 0;
+	}
+
+	if (bg->dirty & EXT2_BG_DIRTY_ITABLE) {
+		rc = ext2_write_block(fs, bg->inode_table);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+	if (bg->dirty & EXT2_BG_DIRTY_IBITMAP) {
+		rc = ext2_write_block(fs, bg->inode_bitmap);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+	if (bg->dirty & EXT2_BG_DIRTY_BBITMAP) {
+		rc = ext2_write_block(fs, bg->block_bitmap);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+	if (bg->dirty & EXT2_BG_DIRTY_DESC) {
+		rc = ext2_commit_bg(fs);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+	bg->dirty = 0;
+	return 0;
+}
+
+int ext2_sync_metadata(struct ext2_data *fs)
+{
+	int rc;
+
+	rc = flush_bgroup(fs);
+	if (rc < 0) {
+		return rc;
+	}
+
+	if (fs->flags & EXT2_DATA_FLAGS_SB_DIRTY) {
+		rc = ext2_commit_superblock(fs);
+		if (rc < 0) {
+			return rc;
+		}
+		fs->flags &= ~EXT2_DATA_FLAGS_SB_DIRTY;
+	}
+	return 0;
+}
+
 int ext2_fetch_block_group(struct ext2_data *fs, uint32_t group)
 {
+	int rc;
 	struct ext2_bgroup *bg = &fs->bgroup;
 
 	/* Check if block group is cached */
@@ -253,6 +317,12 @@ int ext2_fetch_block_group(struct ext2_data *fs, uint32_t group)
 		return -ERANGE;
 	}
 
+	/* Write back metadata of the old group before it is replaced */
+	rc = flush_bgroup(fs);
+	if (rc < 0) {
+		return rc;
+	}
+
 	uint32_t groups_per_block = fs->block_size / sizeof(struct ext2_disk_bgroup);
 	uint32_t block = group / groups_per_block;
 	uint32_t offset = group % groups_per_block;
@@ -299,6 +369,15 @@ int ext2_fetch_bg_itable(struct ext2_bgroup *bg, uint32_t block)
 	struct ext2_data *fs = bg->fs;
 	uint32_t global_block = bg->bg_inode_table + block;
 
+	if (bg->dirty & EXT2_BG_DIRTY_ITABLE) {
+		int rc = ext2_write_block(fs, bg->inode_table);
+
+		if (rc < 0) {
+			return rc;
+		}
+		bg->dirty &= ~EXT2_BG_DIRTY_ITABLE;
+	}
+
 	ext2_drop_block(bg->inode_table);
 	bg->inode_table = ext2_get_block(fs, global_block);
 	if (bg->inode_table == NULL) {
@@ -830,6 +909,10 @@ int ext2_commit_inode(struct ext2_inode *inode)
 	/* fill dinode */
 	fill_disk_inode(dino, inode);
 
+	if (IS_ENABLED(CONFIG_EXT2_LAZY_METADATA)) {
+		fs->bgroup.dirty |= EXT2_BG_DIRTY_ITABLE;
+		return 0;
+	}
 	return ext2_write_block(fs, fs->bgroup.inode_table);
 }
 
@@ -861,10 +944,49 @@ int ext2_clear_inode(struct ext2_data *fs, uint32_t ino)
 	}
 
 	memset(&BGROUP_INODE_TABLE(&fs->bgroup)[itable_offset], 0, sizeof(struct ext2_disk_inode));
+	if (IS_ENABLED(CONFIG_EXT2_LAZY_METADATA)) {
+		fs->bgroup.dirty |= EXT2_BG_DIRTY_ITABLE;
+		return 0;
+	}
 	ret = ext2_write_block(fs, fs->bgroup.inode_table);
 	return ret;
 }
 
+/**
+ * @brief Commit a bitmap change together with the updated free counts.
+ *
+ * With lazy metadata writeback only the dirty flags are set; the blocks are
+ * written back by ext2_sync_metadata() or when the cached group is replaced.
+ */
+static int commit_bitmap_change(struct ext2_data *fs, struct ext2_block *bitmap,
+		uint8_t dirty_flag)
+{
+	int rc;
+
+	if (IS_ENABLED(CONFIG_EXT2_LAZY_METADATA)) {
+		fs->bgroup.dirty |= dirty_flag | EXT2_BG_DIRTY_DESC;
+		fs->flags |= EXT2_DATA_FLAGS_SB_DIRTY;
+		return 0;
+	}
+
+	rc = ext2_commit_superblock(fs);
+	if (rc < 0) {
+		LOG_DBG("super block write returned: %d", rc);
+		return -EIO;
+	}
+	rc = ext2_commit_bg(fs);
+	if (rc < 0) {
+		LOG_DBG("block group write returned: %d", rc);
+		return -EIO;
+	}
+	rc = ext2_write_block(fs, bitmap);
+	if (rc < 0) {
+		LOG_DBG("bitmap write returned: %d", rc);
+		return -EIO;
+	}
+	return 0;
+}
+
 int64_t ext2_alloc_block(struct ext2_data *fs)
 {
 	int rc, bitmap_slot;
@@ -920,20 +1042,9 @@ int64_t ext2_alloc_block(struct ext2_data *fs)
 		return -EINVAL;
 	}
 
-	rc = ext2_commit_superblock(fs);
-	if (rc < 0) {
-		LOG_DBG("super block write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_commit_bg(fs);
+	rc = commit_bitmap_change(fs, fs->bgroup.block_bitmap, EXT2_BG_DIRTY_BBITMAP);
 	if (rc < 0) {
-		LOG_DBG("block group write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_write_block(fs, fs->bgroup.block_bitmap);
-	if (rc < 0) {
-		LOG_DBG("block bitmap write returned: %d", rc);
-		return -EIO;
+		return rc;
 	}
 	return total;
 }
@@ -1017,20 +1128,9 @@ int32_t ext2_alloc_inode(struct ext2_data *fs)
 		return -EINVAL;
 	}
 
-	rc = ext2_commit_superblock(fs);
+	rc = commit_bitmap_change(fs, fs->bgroup.inode_bitmap, EXT2_BG_DIRTY_IBITMAP);
 	if (rc < 0) {
-		LOG_DBG("super block write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_commit_bg(fs);
-	if (rc < 0) {
-		LOG_DBG("block group write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_write_block(fs, fs->bgroup.inode_bitmap);
-	if (rc < 0) {
-		LOG_DBG("block bitmap write returned: %d", rc);
-		return -EIO;
+		return rc;
 	}
 
 	LOG_DBG("Free inodes (bg): %d", fs->bgroup.bg_free_inodes_count);
@@ -1076,22 +1176,7 @@ int ext2_free_block(struct ext2_data *fs, uint32_t block)
 		return -EINVAL;
 	}
 
-	rc = ext2_commit_superblock(fs);
-	if (rc < 0) {
-		LOG_DBG("super block write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_commit_bg(fs);
-	if (rc < 0) {
-		LOG_DBG("block group write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_write_block(fs, fs->bgroup.block_bitmap);
-	if (rc < 0) {
-		LOG_DBG("block bitmap write returned: %d", rc);
-		return -EIO;
-	}
-	return 0;
+	return commit_bitmap_change(fs, fs->bgroup.block_bitmap, EXT2_BG_DIRTY_BBITMAP);
 }
 
 int ext2_free_inode(struct ext2_data *fs, uint32_t ino, bool directory)
@@ -1139,24 +1224,16 @@ int ext2_free_inode(struct ext2_data *fs, uint32_t ino, bool directory)
 
 	LOG_INF("Inode %d is free", ino);
 
-	rc = ext2_commit_superblock(fs);
+	rc = commit_bitmap_change(fs, fs->bgroup.inode_bitmap, EXT2_BG_DIRTY_IBITMAP);
 	if (rc < 0) {
-		LOG_DBG("super block write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_commit_bg(fs);
-	if (rc < 0) {
-		LOG_DBG("block group write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_write_block(fs, fs->bgroup.inode_bitmap);
-	if (rc < 0) {
-		LOG_DBG("block bitmap write returned: %d", rc);
-		return -EIO;
+		return rc;
 	}
-	rc = fs->backend_ops->sync(fs);
-	if (rc < 0) {
-		return -EIO;
+
+	if (!IS_ENABLED(CONFIG_EXT2_LAZY_METADATA)) {
+		rc = fs->backend_ops->sync(fs);
+		if (rc < 0) {
+			return -EIO;
+		}
 	}
 	return 0;
 }
@@ -158,6 +158,20 @@ int ext2_commit_superblock(struct ext2_data *fs);
  */
 int ext2_commit_bg(struct ext2_data *fs);
 
+/**
+ * @brief Write back metadata that is modified only in cached blocks.
+ *
+ * Writes dirty bitmap and inode table blocks of the cached block group, then
+ * the group descriptor and the superblock. Has no effect unless lazy metadata
+ * writeback is enabled (without it all metadata is committed immediately).
+ *
+ * @param fs File system data struct
+ *
+ * @retval 0 on success
+ * @retval <0 error
+ */
+int ext2_sync_metadata(struct ext2_data *fs);
+
 /* Operations that reserve or free the block or inode in the file system. They
  * mark an inode or block as used in the bitmap and change free inode/block
  * count in superblock and block group.
@@ -372,6 +372,11 @@ int ext2_close_fs(struct ext2_data *fs)
 
 	/* To save file system as correct it must be writable and without errors */
 	if (!(fs->flags & (EXT2_DATA_FLAGS_RO | EXT2_DATA_FLAGS_ERR))) {
+		ret = ext2_sync_metadata(fs);
+		if (ret < 0) {
+			return ret;
+		}
+
 		fs->sblock.s_state = EXT2_VALID_FS;
 		ret = ext2_commit_superblock(fs);
 		if (ret < 0) {
@@ -795,6 +800,16 @@ int ext2_inode_sync(struct ext2_inode *inode)
 			return ret;
 		}
 	}
+
+	/* Write back lazily cached bitmaps, inode tables and counts */
+	ret = ext2_sync_metadata(fs);
+	if (ret < 0) {
+		return ret;
+	}
+	ret = fs->backend_ops->sync(fs);
+	if (ret < 0) {
+		return ret;
+	}
 	return 0;
 }
 
@@ -895,9 +910,13 @@ static int ext2_create_inode(struct ext2_data *fs, struct ext2_inode *parent,
 		 * (It was done above in ext2_alloc_inode function.)
 		 */
 		fs->bgroup.bg_used_dirs_count += 1;
-		rc = ext2_commit_bg(fs);
-		if (rc < 0) {
-			return rc;
+		if (IS_ENABLED(CONFIG_EXT2_LAZY_METADATA)) {
+			fs->bgroup.dirty |= EXT2_BG_DIRTY_DESC;
+		} else {
+			rc = ext2_commit_bg(fs);
+			if (rc < 0) {
+				return rc;
+			}
 		}
 	}
 
@@ -142,6 +142,14 @@ struct ext2_block {
 #define BGROUP_INODE_BITMAP(bg) ((uint8_t *)(bg)->inode_bitmap->data)
 #define BGROUP_BLOCK_BITMAP(bg) ((uint8_t *)(bg)->block_bitmap->data)
 
+/* Flags marking block group metadata that is modified only in memory and still
+ * has to be written back (used with lazy metadata writeback).
+ */
+#define EXT2_BG_DIRTY_DESC    BIT(0)
+#define EXT2_BG_DIRTY_ITABLE  BIT(1)
+#define EXT2_BG_DIRTY_IBITMAP BIT(2)
+#define EXT2_BG_DIRTY_BBITMAP BIT(3)
+
 struct ext2_bgroup {
 	struct ext2_data *fs;       /* pointer to file system data */
 
@@ -151,6 +159,7 @@ struct ext2_bgroup {
 
 	int32_t num;                /* number of described block group */
 	uint32_t inode_table_block; /* number of fetched block (relative) */
+	uint8_t dirty;              /* not yet written metadata (EXT2_BG_DIRTY_* flags) */
 
 	uint32_t bg_block_bitmap;
 	uint32_t bg_inode_bitmap;
@@ -212,6 +221,7 @@ struct ext2_file {
 
 #define EXT2_DATA_FLAGS_RO  BIT(0)
 #define EXT2_DATA_FLAGS_ERR BIT(1)
+#define EXT2_DATA_FLAGS_SB_DIRTY BIT(2)
 
 struct ext2_data;
 
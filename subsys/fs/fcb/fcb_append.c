@@ -8,6 +8,8 @@
 #include <stddef.h>
 #include <string.h>
 
+#include <zephyr/sys/crc.h>
+
 #include <zephyr/fs/fcb.h>
 #include "fcb_priv.h"
 
@@ -136,5 +138,161 @@ fcb_append_finish(struct fcb *fcb, struct fcb_entry *loc)
 	if (rc) {
 		return -EIO;
 	}
+#ifdef CONFIG_FCB_ENTRY_CACHE
+	rc = k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+	if (rc) {
+		return -EINVAL;
+	}
+	fcb_cache_add(fcb, loc);
+	k_mutex_unlock(&fcb->f_mtx);
+#endif
+	return 0;
+}
+
+int
+fcb_append_batch(struct fcb *fcb, const struct fcb_batch_entry *entries, uint16_t cnt,
+		 uint8_t *buf, size_t buf_size)
+{
+	struct flash_sector *sector;
+	struct fcb_entry *active;
+	uint8_t len_str[2];
+	uint32_t run_off;
+	size_t used;
+	int entry_len;
+	int data_len;
+	int hdr_len;
+	int len_cnt;
+	int em_len;
+	uint8_t em;
+	int rc;
+	int i;
+#ifdef CONFIG_FCB_ENTRY_CACHE
+	struct fcb_entry loc;
+	uint32_t off;
+	int first;
+	int j;
+#endif
+
+	if (!entries || !buf) {
+		return -EINVAL;
+	}
+
+	em_len = fcb_len_in_flash(fcb, FCB_CRC_SZ);
+
+	/* Validate up front, so that the batch does not fail half-way
+	 * through with some entries already committed.
+	 */
+	for (i = 0; i < cnt; i++) {
+		len_cnt = fcb_put_len(fcb, len_str, entries[i].len);
+		if (len_cnt < 0) {
+			return len_cnt;
+		}
+		entry_len = fcb_len_in_flash(fcb, len_cnt) +
+			    fcb_len_in_flash(fcb, entries[i].len) + em_len;
+		if (entry_len > buf_size) {
+			return -ENOMEM;
+		}
+	}
+
+	rc = k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+	if (rc) {
+		return -EINVAL;
+	}
+
+	active = &fcb->f_active;
+	i = 0;
+	while (i < cnt) {
+		len_cnt = fcb_put_len(fcb, len_str, entries[i].len);
+		entry_len = fcb_len_in_flash(fcb, len_cnt) +
+			    fcb_len_in_flash(fcb, entries[i].len) + em_len;
+		if (active->fe_elem_off + entry_len > active->fe_sector->fs_size) {
+			sector = fcb_new_sector(fcb, fcb->f_scratch_cnt);
+			if (!sector || (sector->fs_size <
+				fcb_len_in_flash(fcb, sizeof(struct fcb_disk_area)) + entry_len)) {
+				rc = -ENOSPC;
+				goto err;
+			}
+			rc = fcb_sector_hdr_init(fcb, sector, fcb->f_active_id + 1);
+			if (rc) {
+				goto err;
+			}
+			active->fe_sector = sector;
+			active->fe_elem_off = fcb_len_in_flash(fcb,
+							       sizeof(struct fcb_disk_area));
+			fcb->f_active_id++;
+		}
+
+		/* Serialize a run of complete entries which fits both the
+		 * work buffer and the active sector, then program it with
+		 * a single flash write.
+		 */
+		run_off = active->fe_elem_off;
+		used = 0;
+#ifdef CONFIG_FCB_ENTRY_CACHE
+		first = i;
+#endif
+		while (i < cnt) {
+			len_cnt = fcb_put_len(fcb, len_str, entries[i].len);
+			hdr_len = fcb_len_in_flash(fcb, len_cnt);
+			data_len = fcb_len_in_flash(fcb, entries[i].len);
+			entry_len = hdr_len + data_len + em_len;
+			if (active->fe_elem_off + entry_len >
+			    active->fe_sector->fs_size) {
+				break;
+			}
+			if (used + entry_len > buf_size) {
+				break;
+			}
+
+			/* Ensure defined value of padding bytes */
+			(void)memset(&buf[used], fcb->f_erase_value, hdr_len + data_len);
+			memcpy(&buf[used], len_str, len_cnt);
+			memcpy(&buf[used + hdr_len], entries[i].data, entries[i].len);
+			(void)memset(&buf[used + hdr_len + data_len], 0xFF, em_len);
+#ifdef CONFIG_FCB_ALLOW_FIXED_ENDMARKER
+			if (fcb->f_flags & FCB_FLAGS_CRC_DISABLED) {
+				em = FCB_FIXED_ENDMARKER;
+			} else
+#endif
+			{
+				em = crc8_ccitt(CRC8_CCITT_INITIAL_VALUE, len_str, len_cnt);
+				em = crc8_ccitt(em, entries[i].data, entries[i].len);
+			}
+			buf[used + hdr_len + data_len] = em;
+
+			used += entry_len;
+			active->fe_elem_off += entry_len;
+			i++;
+		}
+
+		rc = fcb_flash_write(fcb, active->fe_sector, run_off, buf, used);
+		if (rc) {
+			/* Nothing of the run reached flash; roll the
+			 * instance state back to match.
+			 */
+			active->fe_elem_off = run_off;
+			rc = -EIO;
+			goto err;
+		}
+#ifdef CONFIG_FCB_ENTRY_CACHE
+		off = run_off;
+		for (j = first; j < i; j++) {
+			len_cnt = fcb_put_len(fcb, len_str, entries[j].len);
+			loc.fe_sector = active->fe_sector;
+			loc.fe_elem_off = off;
+			loc.fe_data_off = off + fcb_len_in_flash(fcb, len_cnt);
+			loc.fe_data_len = entries[j].len;
+			fcb_cache_add(fcb, &loc);
+			off += fcb_len_in_flash(fcb, len_cnt) +
+			       fcb_len_in_flash(fcb, entries[j].len) + em_len;
+		}
+#endif
+	}
+
+	k_mutex_unlock(&fcb->f_mtx);
+
 	return 0;
+err:
+	k_mutex_unlock(&fcb->f_mtx);
+	return rc;
 }
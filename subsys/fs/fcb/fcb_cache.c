@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include <zephyr/fs/fcb.h>
+#include "fcb_priv.h"
+
+#define FCB_CACHE_ELEM_OFF_MASK 0xffffffU
+
+/*
+ * Store the location of an entry at the newest end of the ring. Returns
+ * false when the entry cannot be described by the cache.
+ */
+static bool
+fcb_cache_push(struct fcb *fcbp, const struct fcb_entry *loc)
+{
+	struct fcb_cache_entry *ce;
+	uint32_t sector_idx;
+	uint16_t idx;
+
+	sector_idx = loc->fe_sector - fcbp->f_sectors;
+	if (fcbp->f_cache.cnt == fcbp->f_cache.capacity ||
+	    loc->fe_elem_off > FCB_CACHE_ELEM_OFF_MASK) {
+		return false;
+	}
+	idx = (fcbp->f_cache.head + fcbp->f_cache.cnt) % fcbp->f_cache.capacity;
+	ce = &fcbp->f_cache.entries[idx];
+	ce->ce_loc = (sector_idx << 24) | loc->fe_elem_off;
+	ce->ce_data_len = loc->fe_data_len;
+	fcbp->f_cache.cnt++;
+	return true;
+}
+
+/*
+ * Fill in entry location from the cache element with given sequence
+ * number. Caller has verified that the sequence number is cached.
+ */
+static void
+fcb_cache_entry_get(struct fcb *fcbp, uint32_t seq, struct fcb_entry *loc)
+{
+	const struct fcb_cache_entry *ce;
+	uint16_t idx;
+	int cnt;
+
+	idx = (fcbp->f_cache.head + (seq - fcbp->f_cache.seq_oldest)) %
+	      fcbp->f_cache.capacity;
+	ce = &fcbp->f_cache.entries[idx];
+	loc->fe_sector = &fcbp->f_sectors[ce->ce_loc >> 24];
+	loc->fe_elem_off = ce->ce_loc & FCB_CACHE_ELEM_OFF_MASK;
+	loc->fe_data_len = ce->ce_data_len;
+	/* Length header size matches the encoding done by fcb_put_len. */
+	cnt = (ce->ce_data_len < 0x80) ? 1 : 2;
+	loc->fe_data_off = loc->fe_elem_off + fcb_len_in_flash(fcbp, cnt);
+	loc->fe_cache_seq = seq + 1U;
+}
+
+/*
+ * Check that the cache element with given sequence number describes the
+ * entry pointed at by loc. Guards against stale or foreign iteration
+ * cursors being continued from the cache.
+ */
+static bool
+fcb_cache_seq_matches(struct fcb *fcbp, uint32_t seq, const struct fcb_entry *loc)
+{
+	const struct fcb_cache_entry *ce;
+	uint16_t idx;
+
+	if (seq < fcbp->f_cache.seq_oldest ||
+	    seq - fcbp->f_cache.seq_oldest >= fcbp->f_cache.cnt) {
+		return false;
+	}
+	idx = (fcbp->f_cache.head + (seq - fcbp->f_cache.seq_oldest)) %
+	      fcbp->f_cache.capacity;
+	ce = &fcbp->f_cache.entries[idx];
+	return (ce->ce_loc >> 24) == (uint32_t)(loc->fe_sector - fcbp->f_sectors) &&
+	       (ce->ce_loc & FCB_CACHE_ELEM_OFF_MASK) == loc->fe_elem_off;
+}
+
+/*
+ * Append the location of a finished entry to the cache. Called with
+ * fcb lock held. The cache is disabled when it can no longer describe
+ * all entries, so that lookups fall back to walking the flash contents.
+ */
+void
+fcb_cache_add(struct fcb *fcbp, const struct fcb_entry *loc)
+{
+	if (!fcbp->f_cache.valid) {
+		return;
+	}
+	if (!fcb_cache_push(fcbp, loc)) {
+		fcbp->f_cache.valid = false;
+	}
+}
+
+/*
+ * Drop cached locations within the sector which is about to be erased.
+ * Called with fcb lock held. Entries of the oldest sector occupy the
+ * oldest end of the ring, so dropping from the head is sufficient.
+ */
+void
+fcb_cache_drop_sector(struct fcb *fcbp, const struct flash_sector *sector)
+{
+	uint32_t sector_idx = sector - fcbp->f_sectors;
+
+	if (!fcbp->f_cache.valid) {
+		return;
+	}
+	while (fcbp->f_cache.cnt > 0U &&
+	       (fcbp->f_cache.entries[fcbp->f_cache.head].ce_loc >> 24) == sector_idx) {
+		fcbp->f_cache.head = (fcbp->f_cache.head + 1U) % fcbp->f_cache.capacity;
+		fcbp->f_cache.cnt--;
+		fcbp->f_cache.seq_oldest++;
+	}
+}
+
+/*
+ * Serve fcb_getnext from the cache. Called with fcb lock held. Returns
+ * -ENOENT when the lookup cannot be served and the caller should fall
+ * back to walking the flash contents.
+ */
+int
+fcb_cache_getnext(struct fcb *fcbp, struct fcb_entry *loc)
+{
+	uint32_t seq;
+
+	if (!fcbp->f_cache.valid) {
+		return -ENOENT;
+	}
+	if (loc->fe_sector == NULL) {
+		seq = fcbp->f_cache.seq_oldest;
+	} else if (loc->fe_elem_off != 0U && loc->fe_cache_seq != 0U &&
+		   fcb_cache_seq_matches(fcbp, loc->fe_cache_seq - 1U, loc)) {
+		seq = loc->fe_cache_seq;
+	} else {
+		return -ENOENT;
+	}
+	if (seq - fcbp->f_cache.seq_oldest >= fcbp->f_cache.cnt) {
+		/* The cache describes all entries; there is none newer. */
+		return -ENOTSUP;
+	}
+	fcb_cache_entry_get(fcbp, seq, loc);
+	return 0;
+}
+
+int
+fcb_cache_init(struct fcb *fcbp, struct fcb_cache_entry *entries, uint16_t capacity)
+{
+	struct fcb_entry loc;
+	int rc;
+
+	if (entries == NULL || capacity == 0U) {
+		return -EINVAL;
+	}
+
+	rc = k_mutex_lock(&fcbp->f_mtx, K_FOREVER);
+	if (rc) {
+		return -EINVAL;
+	}
+
+	fcbp->f_cache.entries = entries;
+	fcbp->f_cache.capacity = capacity;
+	fcbp->f_cache.cnt = 0U;
+	fcbp->f_cache.head = 0U;
+	fcbp->f_cache.seq_oldest = 0U;
+	/* Keep the cache disabled while scanning so that the scan itself
+	 * is not served from the incomplete cache.
+	 */
+	fcbp->f_cache.valid = false;
+
+	(void)memset(&loc, 0, sizeof(loc));
+	while ((rc = fcb_getnext_nolock(fcbp, &loc)) == 0) {
+		if (!fcb_cache_push(fcbp, &loc)) {
+			rc = -ENOMEM;
+			goto out;
+		}
+	}
+	fcbp->f_cache.valid = true;
+	rc = 0;
+out:
+	k_mutex_unlock(&fcbp->f_mtx);
+	return rc;
+}
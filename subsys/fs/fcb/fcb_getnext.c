@@ -45,6 +45,14 @@ fcb_getnext_nolock(struct fcb *fcb, struct fcb_entry *loc)
 {
 	int rc;
 
+#ifdef CONFIG_FCB_ENTRY_CACHE
+	rc = fcb_cache_getnext(fcb, loc);
+	if (rc != -ENOENT) {
+		return rc;
+	}
+	loc->fe_cache_seq = 0U;
+#endif
+
 	if (loc->fe_sector == NULL) {
 		/*
 		 * Find the first one we have in flash.
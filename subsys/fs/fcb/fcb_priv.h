@@ -19,6 +19,8 @@ extern "C" {
 #define FCB_CRC_SZ	sizeof(uint8_t)
 #define FCB_TMP_BUF_SZ	32
 
+#define FCB_FIXED_ENDMARKER 0xab
+
 #define FCB_ID_GT(a, b) (((int16_t)(a) - (int16_t)(b)) > 0)
 
 #define MK32(val) ((((uint32_t)(val)) << 24) |			\
@@ -78,6 +80,12 @@ int fcb_elem_endmarker(struct fcb *fcbp, struct fcb_entry *loc, uint8_t *crc8p);
 int fcb_sector_hdr_init(struct fcb *fcbp, struct flash_sector *sector, uint16_t id);
 int fcb_sector_hdr_read(struct fcb *fcbp, struct flash_sector *sector, struct fcb_disk_area *fdap);
 
+#ifdef CONFIG_FCB_ENTRY_CACHE
+void fcb_cache_add(struct fcb *fcbp, const struct fcb_entry *loc);
+void fcb_cache_drop_sector(struct fcb *fcbp, const struct flash_sector *sector);
+int fcb_cache_getnext(struct fcb *fcbp, struct fcb_entry *loc);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
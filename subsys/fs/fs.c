@@ -16,6 +16,10 @@
 #include <zephyr/fs/fs_sys.h>
 #include <zephyr/sys/check.h>
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+#include "fs_cache.h"
+#endif
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(fs, CONFIG_FS_LOG_LEVEL);
 
@@ -193,6 +197,10 @@ int fs_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t flags)
 		}
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+	fs_cache_open(zfp);
+#endif
+
 	return rc;
 }
 
@@ -214,6 +222,12 @@ int fs_close(struct fs_file_t *zfp)
 		return rc;
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+	if (zfp->cache_filep != NULL) {
+		fs_cache_close(zfp);
+	}
+#endif
+
 	zfp->mp = NULL;
 
 	return rc;
@@ -231,6 +245,12 @@ ssize_t fs_read(struct fs_file_t *zfp, void *ptr, size_t size)
 		return -ENOTSUP;
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+	if (zfp->cache_filep != NULL) {
+		return fs_cache_read(zfp, ptr, size);
+	}
+#endif
+
 	rc = zfp->mp->fs->read(zfp, ptr, size);
 	if (rc < 0) {
 		LOG_ERR("file read error (%d)", rc);
@@ -251,6 +271,12 @@ ssize_t fs_write(struct fs_file_t *zfp, const void *ptr, size_t size)
 		return -ENOTSUP;
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+	if (zfp->cache_filep != NULL) {
+		return fs_cache_write(zfp, ptr, size);
+	}
+#endif
+
 	rc = zfp->mp->fs->write(zfp, ptr, size);
 	if (rc < 0) {
 		LOG_ERR("file write error (%d)", rc);
@@ -271,6 +297,12 @@ int fs_seek(struct fs_file_t *zfp, off_t offset, int whence)
 		return -ENOTSUP;
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+	if (zfp->cache_filep != NULL) {
+		return fs_cache_seek(zfp, offset, whence);
+	}
+#endif
+
 	rc = zfp->mp->fs->lseek(zfp, offset, whence);
 	if (rc < 0) {
 		LOG_ERR("file seek error (%d)", rc);
@@ -291,6 +323,12 @@ off_t fs_tell(struct fs_file_t *zfp)
 		return -ENOTSUP;
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+	if (zfp->cache_filep != NULL) {
+		return fs_cache_tell(zfp);
+	}
+#endif
+
 	rc = zfp->mp->fs->tell(zfp);
 	if (rc < 0) {
 		LOG_ERR("file tell error (%d)", rc);
@@ -311,6 +349,12 @@ int fs_truncate(struct fs_file_t *zfp, off_t length)
 		return -ENOTSUP;
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+	if (zfp->cache_filep != NULL) {
+		return fs_cache_truncate(zfp, length);
+	}
+#endif
+
 	rc = zfp->mp->fs->truncate(zfp, length);
 	if (rc < 0) {
 		LOG_ERR("file truncate error (%d)", rc);
@@ -0,0 +1,439 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * File read cache for the VFS layer.
+ *
+ * A small pool of fixed-size pages, shared across all mounts with
+ * FS_MOUNT_FLAG_CACHE set, holds recently read file data so that
+ * repeated reads of the same region (index or header blocks that an
+ * application revisits between appends) do not reach the backing
+ * storage again. Sequential read patterns are detected and the
+ * following page is read ahead.
+ *
+ * The cache operates strictly per open file: at this layer there is no
+ * notion of inode identity, so pages are keyed by the file object and
+ * dropped when the file is closed. Writes go straight through to the
+ * underlying file system and invalidate overlapping pages, which keeps
+ * the cache trivially consistent with the backing store; metadata I/O
+ * issued by the file system implementations themselves happens below
+ * this layer and is not cached here.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_sys.h>
+#include <zephyr/sys/util.h>
+
+#include "fs_cache.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(fs, CONFIG_FS_LOG_LEVEL);
+
+#define FS_CACHE_PAGE_SIZE CONFIG_FILE_SYSTEM_CACHE_PAGE_SIZE
+#define FS_CACHE_NUM_PAGES CONFIG_FILE_SYSTEM_CACHE_NUM_PAGES
+#define FS_CACHE_MAX_FILES CONFIG_FILE_SYSTEM_CACHE_MAX_FILES
+
+/* Per-file cache state, pointed to by fs_file_t.cache_filep */
+struct fs_cache_file {
+	/* File the state belongs to, NULL if the slot is free */
+	struct fs_file_t *zfp;
+	/* File position maintained by the cache layer */
+	off_t pos;
+	/* Position of the underlying file system file pointer */
+	off_t fs_pos;
+	/* Expected position of the next sequential read, -1 if unknown */
+	off_t seq_pos;
+};
+
+struct fs_cache_page {
+	/* File the page belongs to, NULL if the page is invalid */
+	const struct fs_cache_file *owner;
+	/* Page-aligned file offset of the cached data */
+	off_t offset;
+	/* Number of valid bytes, less than the page size at EOF */
+	size_t len;
+	/* Global access sequence number, used for LRU eviction */
+	uint32_t last_use;
+};
+
+static struct fs_cache_file cache_files[FS_CACHE_MAX_FILES];
+static struct fs_cache_page cache_pages[FS_CACHE_NUM_PAGES];
+static uint8_t cache_data[FS_CACHE_NUM_PAGES][FS_CACHE_PAGE_SIZE];
+static uint32_t cache_use_seq;
+
+/* Lock to protect the page pool and all per-file cache state */
+static K_MUTEX_DEFINE(cache_mutex);
+
+static struct fs_cache_page *page_lookup(const struct fs_cache_file *cf,
+					 off_t offset)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache_pages); ++i) {
+		struct fs_cache_page *page = &cache_pages[i];
+
+		if ((page->owner == cf) && (page->offset == offset)) {
+			return page;
+		}
+	}
+
+	return NULL;
+}
+
+/* Invalidate pages overlapping the range [start, end) */
+static void file_invalidate(const struct fs_cache_file *cf, off_t start,
+			    off_t end)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache_pages); ++i) {
+		struct fs_cache_page *page = &cache_pages[i];
+
+		if ((page->owner == cf) && (page->offset < end) &&
+		    (page->offset + FS_CACHE_PAGE_SIZE > start)) {
+			page->owner = NULL;
+		}
+	}
+}
+
+/* Invalidate all pages from start to the end of the file */
+static void file_invalidate_from(const struct fs_cache_file *cf, off_t start)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache_pages); ++i) {
+		struct fs_cache_page *page = &cache_pages[i];
+
+		if ((page->owner == cf) &&
+		    (page->offset + FS_CACHE_PAGE_SIZE > start)) {
+			page->owner = NULL;
+		}
+	}
+}
+
+static struct fs_cache_page *page_evict(void)
+{
+	struct fs_cache_page *victim = &cache_pages[0];
+
+	for (size_t i = 1; i < ARRAY_SIZE(cache_pages); ++i) {
+		struct fs_cache_page *page = &cache_pages[i];
+
+		if (page->owner == NULL) {
+			return page;
+		}
+
+		if ((victim->owner != NULL) &&
+		    (page->last_use < victim->last_use)) {
+			victim = page;
+		}
+	}
+
+	return victim;
+}
+
+/* Position the underlying file system file pointer, if needed */
+static int raw_seek(struct fs_cache_file *cf, off_t offset)
+{
+	struct fs_file_t *zfp = cf->zfp;
+	int rc;
+
+	if (cf->fs_pos == offset) {
+		return 0;
+	}
+
+	rc = zfp->mp->fs->lseek(zfp, offset, FS_SEEK_SET);
+	if (rc < 0) {
+		return rc;
+	}
+
+	cf->fs_pos = offset;
+
+	return 0;
+}
+
+static ssize_t raw_read(struct fs_cache_file *cf, off_t offset, void *ptr,
+			size_t size)
+{
+	struct fs_file_t *zfp = cf->zfp;
+	ssize_t rc;
+
+	rc = raw_seek(cf, offset);
+	if (rc < 0) {
+		return rc;
+	}
+
+	rc = zfp->mp->fs->read(zfp, ptr, size);
+	if (rc > 0) {
+		cf->fs_pos += rc;
+	}
+
+	return rc;
+}
+
+/* Read the page at the given aligned offset into a free or evicted slot */
+static ssize_t page_fill(struct fs_cache_file *cf, off_t offset,
+			 struct fs_cache_page **pagep)
+{
+	struct fs_cache_page *page = page_evict();
+	size_t idx = page - cache_pages;
+	ssize_t rc;
+
+	page->owner = NULL;
+
+	rc = raw_read(cf, offset, cache_data[idx], FS_CACHE_PAGE_SIZE);
+	if (rc < 0) {
+		return rc;
+	}
+
+	page->owner = cf;
+	page->offset = offset;
+	page->len = rc;
+	page->last_use = ++cache_use_seq;
+	*pagep = page;
+
+	return rc;
+}
+
+void fs_cache_open(struct fs_file_t *zfp)
+{
+	zfp->cache_filep = NULL;
+
+	if ((zfp->mp->flags & FS_MOUNT_FLAG_CACHE) == 0) {
+		return;
+	}
+
+	/* The cache maintains the file position itself and repositions
+	 * the underlying file lazily, which would defeat the append
+	 * semantics implemented by the file systems.
+	 */
+	if ((zfp->flags & FS_O_APPEND) != 0) {
+		return;
+	}
+
+	/* Everything below requires repositioning the underlying file */
+	if ((zfp->mp->fs->lseek == NULL) || (zfp->mp->fs->tell == NULL)) {
+		return;
+	}
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_files); ++i) {
+		struct fs_cache_file *cf = &cache_files[i];
+
+		if (cf->zfp == NULL) {
+			cf->zfp = zfp;
+			cf->pos = 0;
+			cf->fs_pos = 0;
+			cf->seq_pos = -1;
+			zfp->cache_filep = cf;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&cache_mutex);
+}
+
+void fs_cache_close(struct fs_file_t *zfp)
+{
+	struct fs_cache_file *cf = zfp->cache_filep;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	file_invalidate_from(cf, 0);
+	cf->zfp = NULL;
+	zfp->cache_filep = NULL;
+
+	k_mutex_unlock(&cache_mutex);
+}
+
+ssize_t fs_cache_read(struct fs_file_t *zfp, void *ptr, size_t size)
+{
+	struct fs_cache_file *cf = zfp->cache_filep;
+	struct fs_cache_page *page;
+	bool sequential;
+	size_t served = 0;
+	ssize_t rc = 0;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	sequential = (cf->pos == cf->seq_pos);
+
+	while (served < size) {
+		size_t remaining = size - served;
+		off_t page_off = ROUND_DOWN(cf->pos, FS_CACHE_PAGE_SIZE);
+		size_t in_page = cf->pos - page_off;
+		size_t chunk;
+
+		page = page_lookup(cf, page_off);
+		if (page == NULL) {
+			/* Requests spanning whole pages bypass the cache,
+			 * splitting them into page-sized backend reads
+			 * would penalize bulk transfers.
+			 */
+			if ((in_page == 0U) && (remaining >= FS_CACHE_PAGE_SIZE)) {
+				rc = raw_read(cf, cf->pos,
+					      (uint8_t *)ptr + served,
+					      remaining);
+				if (rc > 0) {
+					cf->pos += rc;
+					served += rc;
+				}
+				break;
+			}
+
+			rc = page_fill(cf, page_off, &page);
+			if (rc < 0) {
+				break;
+			}
+		} else {
+			page->last_use = ++cache_use_seq;
+		}
+
+		if (page->len <= in_page) {
+			/* Cached page ends before the position: EOF */
+			break;
+		}
+
+		chunk = MIN(remaining, page->len - in_page);
+		memcpy((uint8_t *)ptr + served, &cache_data[page - cache_pages][in_page],
+		       chunk);
+		cf->pos += chunk;
+		served += chunk;
+
+		if (page->len < FS_CACHE_PAGE_SIZE) {
+			/* Short page: EOF reached */
+			break;
+		}
+	}
+
+	cf->seq_pos = cf->pos;
+
+	/* On a sequential pattern pull in the next page ahead of time */
+	if (sequential && (served == size)) {
+		off_t next_off = ROUND_DOWN(cf->pos, FS_CACHE_PAGE_SIZE);
+
+		if (page_lookup(cf, next_off) != NULL) {
+			next_off += FS_CACHE_PAGE_SIZE;
+		}
+
+		if (page_lookup(cf, next_off) == NULL) {
+			(void)page_fill(cf, next_off, &page);
+		}
+	}
+
+	k_mutex_unlock(&cache_mutex);
+
+	if ((rc < 0) && (served == 0)) {
+		LOG_ERR("file read error (%d)", (int)rc);
+		return rc;
+	}
+
+	return served;
+}
+
+ssize_t fs_cache_write(struct fs_file_t *zfp, const void *ptr, size_t size)
+{
+	struct fs_cache_file *cf = zfp->cache_filep;
+	ssize_t rc;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	rc = raw_seek(cf, cf->pos);
+	if (rc == 0) {
+		rc = zfp->mp->fs->write(zfp, ptr, size);
+	}
+
+	if (rc > 0) {
+		file_invalidate(cf, cf->pos, cf->pos + rc);
+		cf->fs_pos += rc;
+		cf->pos += rc;
+		/* A write interrupts any sequential read pattern */
+		cf->seq_pos = -1;
+	}
+
+	k_mutex_unlock(&cache_mutex);
+
+	if (rc < 0) {
+		LOG_ERR("file write error (%d)", (int)rc);
+	}
+
+	return rc;
+}
+
+int fs_cache_seek(struct fs_file_t *zfp, off_t offset, int whence)
+{
+	struct fs_cache_file *cf = zfp->cache_filep;
+	off_t pos = 0;
+	int rc = 0;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	switch (whence) {
+	case FS_SEEK_SET:
+		pos = offset;
+		break;
+	case FS_SEEK_CUR:
+		pos = cf->pos + offset;
+		break;
+	case FS_SEEK_END:
+		/* Only the underlying file system knows the file size */
+		rc = zfp->mp->fs->lseek(zfp, offset, FS_SEEK_END);
+		if (rc >= 0) {
+			rc = 0;
+			pos = zfp->mp->fs->tell(zfp);
+			cf->fs_pos = pos;
+		}
+		break;
+	default:
+		rc = -EINVAL;
+		break;
+	}
+
+	if ((rc == 0) && (pos < 0)) {
+		rc = -EINVAL;
+	}
+
+	if (rc == 0) {
+		cf->pos = pos;
+	}
+
+	k_mutex_unlock(&cache_mutex);
+
+	if (rc < 0) {
+		LOG_ERR("file seek error (%d)", rc);
+	}
+
+	return rc;
+}
+
+off_t fs_cache_tell(struct fs_file_t *zfp)
+{
+	struct fs_cache_file *cf = zfp->cache_filep;
+	off_t pos;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	pos = cf->pos;
+	k_mutex_unlock(&cache_mutex);
+
+	return pos;
+}
+
+int fs_cache_truncate(struct fs_file_t *zfp, off_t length)
+{
+	struct fs_cache_file *cf = zfp->cache_filep;
+	int rc;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	rc = zfp->mp->fs->truncate(zfp, length);
+	if (rc == 0) {
+		file_invalidate_from(cf, length);
+	}
+
+	k_mutex_unlock(&cache_mutex);
+
+	if (rc < 0) {
+		LOG_ERR("file truncate error (%d)", rc);
+	}
+
+	return rc;
+}
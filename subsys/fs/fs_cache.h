@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Internal interface of the file read cache, used by the VFS layer only. */
+
+#ifndef ZEPHYR_SUBSYS_FS_FS_CACHE_H_
+#define ZEPHYR_SUBSYS_FS_FS_CACHE_H_
+
+#include <zephyr/fs/fs.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Attach cache state to a freshly opened file.
+ *
+ * Called by fs_open() after the underlying file system open succeeded.
+ * Whether the file actually gets cached depends on the mount flags, the
+ * open flags and on a cache file slot being available; when no state is
+ * attached the file simply remains uncached and all operations take the
+ * direct path.
+ *
+ * @param zfp Pointer to the file object.
+ */
+void fs_cache_open(struct fs_file_t *zfp);
+
+/**
+ * @brief Release cache state of a file.
+ *
+ * Drops all cached pages of the file and frees its cache file slot.
+ * Called by fs_close() after the underlying file system close succeeded.
+ *
+ * @param zfp Pointer to the file object.
+ */
+void fs_cache_close(struct fs_file_t *zfp);
+
+/**
+ * @brief Read from a cached file.
+ *
+ * Serves the request from cached pages where possible, fetching missing
+ * pages from the underlying file system. Sequential reads trigger
+ * read-ahead of the following page.
+ *
+ * @param zfp Pointer to the file object.
+ * @param ptr Pointer to the data buffer.
+ * @param size Number of bytes to be read.
+ *
+ * @return Number of bytes read, or negative errno code on error.
+ */
+ssize_t fs_cache_read(struct fs_file_t *zfp, void *ptr, size_t size);
+
+/**
+ * @brief Write to a cached file.
+ *
+ * Writes through to the underlying file system and invalidates cached
+ * pages overlapping the written range.
+ *
+ * @param zfp Pointer to the file object.
+ * @param ptr Pointer to the data to be written.
+ * @param size Number of bytes to be written.
+ *
+ * @return Number of bytes written, or negative errno code on error.
+ */
+ssize_t fs_cache_write(struct fs_file_t *zfp, const void *ptr, size_t size);
+
+/**
+ * @brief Change the position of a cached file.
+ *
+ * Only updates the cache-maintained position; the underlying file system
+ * is repositioned lazily on the next read or write.
+ *
+ * @param zfp Pointer to the file object.
+ * @param offset Relative location to move the file pointer to.
+ * @param whence Relative location from where offset is to be calculated.
+ *
+ * @return 0 on success, negative errno code on error.
+ */
+int fs_cache_seek(struct fs_file_t *zfp, off_t offset, int whence);
+
+/**
+ * @brief Get the position of a cached file.
+ *
+ * @param zfp Pointer to the file object.
+ *
+ * @return Current position, or negative errno code on error.
+ */
+off_t fs_cache_tell(struct fs_file_t *zfp);
+
+/**
+ * @brief Truncate a cached file.
+ *
+ * Truncates the file on the underlying file system and drops all cached
+ * pages of the file.
+ *
+ * @param zfp Pointer to the file object.
+ * @param length New length of the file.
+ *
+ * @return 0 on success, negative errno code on error.
+ */
+int fs_cache_truncate(struct fs_file_t *zfp, off_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_SUBSYS_FS_FS_CACHE_H_ */
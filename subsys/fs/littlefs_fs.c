@@ -171,13 +171,137 @@ static int errno_to_lfs(int error)
 
 #ifdef CONFIG_FS_LITTLEFS_FMP_DEV
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+
+#define CACHE_LINE_SIZE CONFIG_FS_LITTLEFS_BLOCK_CACHE_LINE_SIZE
+#define CACHE_LINE_COUNT CONFIG_FS_LITTLEFS_BLOCK_CACHE_LINE_COUNT
+#define CACHE_LINE_EMPTY UINT32_MAX
+
+BUILD_ASSERT((CACHE_LINE_SIZE & (CACHE_LINE_SIZE - 1)) == 0,
+	     "cache line size must be a power of two");
+BUILD_ASSERT(CONFIG_FS_LITTLEFS_BLOCK_CACHE_READ_AHEAD < CACHE_LINE_COUNT,
+	     "read-ahead must be smaller than the cache line count");
+
+static void littlefs_cache_init(struct fs_littlefs *fs)
+{
+	for (int i = 0; i < CACHE_LINE_COUNT; i++) {
+		fs->cache_offset[i] = CACHE_LINE_EMPTY;
+	}
+	fs->cache_next_offset = CACHE_LINE_EMPTY;
+	fs->cache_next_victim = 0;
+}
+
+/* Drop all cache lines overlapping the given flash area range. */
+static void littlefs_cache_invalidate(struct fs_littlefs *fs, size_t offset,
+				      size_t len)
+{
+	uint32_t first = ROUND_DOWN(offset, CACHE_LINE_SIZE);
+	uint32_t last = ROUND_DOWN(offset + len - 1U, CACHE_LINE_SIZE);
+
+	for (int i = 0; i < CACHE_LINE_COUNT; i++) {
+		if ((fs->cache_offset[i] >= first) && (fs->cache_offset[i] <= last)) {
+			fs->cache_offset[i] = CACHE_LINE_EMPTY;
+		}
+	}
+}
+
+/* Fetch the line starting at line_off into the cache. When the access
+ * continues a sequential read, up to
+ * CONFIG_FS_LITTLEFS_BLOCK_CACHE_READ_AHEAD following lines are prefetched
+ * together with the demanded line in a single flash transaction. Returns
+ * the index of the cache line holding line_off, or a negative error code.
+ */
+static int littlefs_cache_fetch(struct fs_littlefs *fs,
+				const struct flash_area *fa, uint32_t line_off)
+{
+	int idx = fs->cache_next_victim;
+	size_t count = 1;
+	int rc;
+
+	if (line_off == fs->cache_next_offset) {
+		count += CONFIG_FS_LITTLEFS_BLOCK_CACHE_READ_AHEAD;
+	}
+
+	/* The victim lines of a single fetch must be contiguous in memory,
+	 * and the fetch may not extend past the end of the flash area.
+	 */
+	count = MIN(count, (size_t)(CACHE_LINE_COUNT - idx));
+	count = MIN(count, (fa->fa_size - line_off) / CACHE_LINE_SIZE);
+
+	rc = flash_area_read(fa, line_off, fs->cache_data[idx],
+			     count * CACHE_LINE_SIZE);
+	if (rc < 0) {
+		return rc;
+	}
+
+	/* Drop stale duplicates of the fetched range before claiming lines */
+	littlefs_cache_invalidate(fs, line_off, count * CACHE_LINE_SIZE);
+
+	for (size_t i = 0; i < count; i++) {
+		fs->cache_offset[idx + i] = line_off + i * CACHE_LINE_SIZE;
+	}
+	fs->cache_next_victim = (idx + count) % CACHE_LINE_COUNT;
+
+	return idx;
+}
+
+static int littlefs_cache_read(struct fs_littlefs *fs,
+			       const struct flash_area *fa, size_t offset,
+			       void *buffer, size_t size)
+{
+	uint8_t *dst = buffer;
+
+	while (size > 0) {
+		uint32_t line_off = ROUND_DOWN(offset, CACHE_LINE_SIZE);
+		size_t skip = offset - line_off;
+		size_t chunk = MIN(size, CACHE_LINE_SIZE - skip);
+		int idx = -1;
+
+		/* A partial line at the end of the area is read directly */
+		if ((line_off + CACHE_LINE_SIZE) > fa->fa_size) {
+			return flash_area_read(fa, offset, dst, size);
+		}
+
+		for (int i = 0; i < CACHE_LINE_COUNT; i++) {
+			if (fs->cache_offset[i] == line_off) {
+				idx = i;
+				break;
+			}
+		}
+
+		if (idx < 0) {
+			idx = littlefs_cache_fetch(fs, fa, line_off);
+			if (idx < 0) {
+				return idx;
+			}
+		}
+
+		memcpy(dst, &fs->cache_data[idx][skip], chunk);
+		fs->cache_next_offset = line_off + CACHE_LINE_SIZE;
+
+		dst += chunk;
+		offset += chunk;
+		size -= chunk;
+	}
+
+	return 0;
+}
+
+#endif /* CONFIG_FS_LITTLEFS_BLOCK_CACHE */
+
 static int lfs_api_read(const struct lfs_config *c, lfs_block_t block,
 			lfs_off_t off, void *buffer, lfs_size_t size)
 {
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	struct fs_littlefs *fs = CONTAINER_OF(c, struct fs_littlefs, cfg);
+
+	int rc = littlefs_cache_read(fs, fa, offset, buffer, size);
+#else
 	int rc = flash_area_read(fa, offset, buffer, size);
+#endif
 
 	return errno_to_lfs(rc);
 }
@@ -188,6 +312,11 @@ static int lfs_api_prog(const struct lfs_config *c, lfs_block_t block,
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	littlefs_cache_invalidate(CONTAINER_OF(c, struct fs_littlefs, cfg),
+				  offset, size);
+#endif
+
 	int rc = flash_area_write(fa, offset, buffer, size);
 
 	return errno_to_lfs(rc);
@@ -198,6 +327,11 @@ static int lfs_api_erase(const struct lfs_config *c, lfs_block_t block)
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size;
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	littlefs_cache_invalidate(CONTAINER_OF(c, struct fs_littlefs, cfg),
+				  offset, c->block_size);
+#endif
+
 	int rc = flash_area_flatten(fa, offset, c->block_size);
 
 	return errno_to_lfs(rc);
@@ -891,6 +1025,16 @@ static int littlefs_init_cfg(struct fs_littlefs *fs, int flags)
 	lcp->block_size = block_size;
 	lcp->block_count = block_count;
 	lcp->block_cycles = block_cycles;
+
+#ifdef CONFIG_FS_LITTLEFS_MAINTENANCE
+	/* The buffers were sized for the configuration the mount was
+	 * declared with; record their capacity as the tuning limit.
+	 */
+	if (fs->cache_capacity == 0) {
+		fs->cache_capacity = lcp->cache_size;
+		fs->lookahead_capacity = lcp->lookahead_size;
+	}
+#endif /* CONFIG_FS_LITTLEFS_MAINTENANCE */
 	return 0;
 }
 
@@ -915,6 +1059,10 @@ static int littlefs_init_fs(struct fs_littlefs *fs, void *dev_id, int flags)
 	if (ret < 0) {
 		return ret;
 	}
+
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	littlefs_cache_init(fs);
+#endif
 	return 0;
 }
 
@@ -1011,6 +1159,135 @@ out:
 
 #endif /* CONFIG_FILE_SYSTEM_MKFS */
 
+#ifdef CONFIG_FS_LITTLEFS_MAINTENANCE
+
+/* Fetch the filesystem state of a mounted littlefs mount point. */
+static struct fs_littlefs *littlefs_from_mount(struct fs_mount_t *mountp)
+{
+	struct fs_littlefs *fs;
+
+	if ((mountp == NULL) || (mountp->type != FS_LITTLEFS) ||
+	    (mountp->fs_data == NULL)) {
+		return NULL;
+	}
+
+	fs = mountp->fs_data;
+
+	return (fs->backend != NULL) ? fs : NULL;
+}
+
+int fs_littlefs_gc(struct fs_mount_t *mountp)
+{
+	struct fs_littlefs *fs = littlefs_from_mount(mountp);
+	uint32_t start;
+	uint32_t duration;
+	int ret;
+
+	if (fs == NULL) {
+		return -EINVAL;
+	}
+
+	fs_lock(fs);
+
+	start = k_uptime_get_32();
+	ret = lfs_fs_gc(&fs->lfs);
+	duration = k_uptime_get_32() - start;
+
+	fs->stats.gc_runs++;
+	fs->stats.gc_total_ms += duration;
+	fs->stats.gc_max_ms = MAX(fs->stats.gc_max_ms, duration);
+
+	fs_unlock(fs);
+
+	return lfs_to_errno(ret);
+}
+
+int fs_littlefs_tune(struct fs_mount_t *mountp,
+		     const struct fs_littlefs_tuning *tuning)
+{
+	struct fs_littlefs *fs = littlefs_from_mount(mountp);
+	struct lfs_config *lcp;
+	int ret;
+
+	if ((fs == NULL) || (tuning == NULL)) {
+		return -EINVAL;
+	}
+
+	lcp = &fs->cfg;
+
+	lfs_size_t cache_size = tuning->cache_size;
+
+	if (cache_size == 0) {
+		cache_size = lcp->cache_size;
+	} else if ((cache_size > fs->cache_capacity) ||
+		   ((cache_size % lcp->read_size) != 0) ||
+		   ((cache_size % lcp->prog_size) != 0) ||
+		   ((lcp->block_size % cache_size) != 0)) {
+		return -EINVAL;
+	}
+
+	lfs_size_t lookahead_size = tuning->lookahead_size;
+
+	if (lookahead_size == 0) {
+		lookahead_size = lcp->lookahead_size;
+	} else if ((lookahead_size > fs->lookahead_capacity) ||
+		   ((lookahead_size % 8) != 0)) {
+		return -EINVAL;
+	}
+
+	if (tuning->inline_max > cache_size) {
+		return -EINVAL;
+	}
+
+	fs_lock(fs);
+
+	/* The littlefs configuration is fixed at mount, so apply the new
+	 * values through an internal remount. The caller must have closed
+	 * all files and directories on the mount.
+	 */
+	ret = lfs_unmount(&fs->lfs);
+	if (ret < 0) {
+		goto out;
+	}
+
+	lcp->cache_size = cache_size;
+	lcp->lookahead_size = lookahead_size;
+	if (tuning->inline_max != 0) {
+		lcp->inline_max = tuning->inline_max;
+	}
+	if (tuning->compact_thresh != 0) {
+		lcp->compact_thresh = (tuning->compact_thresh < 0) ?
+			(lfs_size_t)-1 : (lfs_size_t)tuning->compact_thresh;
+	}
+
+	ret = lfs_mount(&fs->lfs, &fs->cfg);
+
+out:
+	fs_unlock(fs);
+
+	return lfs_to_errno(ret);
+}
+
+int fs_littlefs_stats_get(struct fs_mount_t *mountp,
+			  struct fs_littlefs_stats *stats)
+{
+	struct fs_littlefs *fs = littlefs_from_mount(mountp);
+
+	if ((fs == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	fs_lock(fs);
+
+	*stats = fs->stats;
+
+	fs_unlock(fs);
+
+	return 0;
+}
+
+#endif /* CONFIG_FS_LITTLEFS_MAINTENANCE */
+
 static int littlefs_unmount(struct fs_mount_t *mountp)
 {
 	struct fs_littlefs *fs = mountp->fs_data;
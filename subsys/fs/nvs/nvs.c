@@ -19,9 +19,9 @@ LOG_MODULE_REGISTER(fs_nvs, CONFIG_NVS_LOG_LEVEL);
 static int nvs_prev_ate(struct nvs_fs *fs, uint32_t *addr, struct nvs_ate *ate);
 static int nvs_ate_valid(struct nvs_fs *fs, const struct nvs_ate *entry);
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#if defined(CONFIG_NVS_LOOKUP_CACHE) || defined(CONFIG_NVS_DATA_CACHE)
 
-static inline size_t nvs_lookup_cache_pos(uint16_t id)
+static inline uint16_t nvs_id_hash(uint16_t id)
 {
 	uint16_t hash;
 
@@ -33,14 +33,86 @@ static inline size_t nvs_lookup_cache_pos(uint16_t id)
 	hash *= 0xdb2dU;
 	hash ^= hash >> 9;
 
-	return hash % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	return hash;
+}
+
+#endif /* CONFIG_NVS_LOOKUP_CACHE || CONFIG_NVS_DATA_CACHE */
+
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+
+static inline size_t nvs_lookup_cache_pos(uint16_t id)
+{
+	return nvs_id_hash(id) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+}
+
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL
+
+/* Probe for the cache slot holding the most recent ATE address of the given
+ * id. Returns the slot position, or CONFIG_NVS_LOOKUP_CACHE_SIZE if the id
+ * is not cached.
+ */
+static size_t nvs_lookup_cache_probe(struct nvs_fs *fs, uint16_t id)
+{
+	size_t pos = nvs_lookup_cache_pos(id);
+
+	for (size_t i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		if (fs->lookup_cache[pos] == NVS_LOOKUP_CACHE_NO_ADDR) {
+			break;
+		}
+		if (fs->lookup_cache_id[pos] == id) {
+			return pos;
+		}
+		pos = (pos + 1) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	}
+
+	return CONFIG_NVS_LOOKUP_CACHE_SIZE;
 }
 
+/* Return the cached ATE address of the given id. Cache entries may be lost
+ * to eviction or sector erase, so a miss does not imply that the id is
+ * absent: on a miss the ATE write address is returned and the caller walks
+ * the complete allocation table.
+ */
+static uint32_t nvs_lookup_cache_find(struct nvs_fs *fs, uint16_t id)
+{
+	size_t pos = nvs_lookup_cache_probe(fs, id);
+
+	return (pos < CONFIG_NVS_LOOKUP_CACHE_SIZE) ? fs->lookup_cache[pos] : fs->ate_wra;
+}
+
+/* Insert or update the cached ATE address of the given id using linear
+ * probing.
+ */
+static void nvs_lookup_cache_insert(struct nvs_fs *fs, uint16_t id, uint32_t addr)
+{
+	size_t pos = nvs_lookup_cache_pos(id);
+
+	for (size_t i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		if ((fs->lookup_cache[pos] == NVS_LOOKUP_CACHE_NO_ADDR) ||
+		    (fs->lookup_cache_id[pos] == id)) {
+			break;
+		}
+		pos = (pos + 1) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	}
+
+	/* If the cache holds no free slot and is full of other ids, 'pos' has
+	 * wrapped around to the home slot, which is then evicted. The evicted
+	 * id is found again through the fallback walk in
+	 * nvs_lookup_cache_find().
+	 */
+	fs->lookup_cache[pos] = addr;
+	fs->lookup_cache_id[pos] = id;
+}
+
+#endif /* CONFIG_NVS_LOOKUP_CACHE_FULL */
+
 static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 {
 	int rc;
 	uint32_t addr, ate_addr;
+#ifndef CONFIG_NVS_LOOKUP_CACHE_FULL
 	uint32_t *cache_entry;
+#endif
 	struct nvs_ate ate;
 
 	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
@@ -55,12 +127,22 @@ static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 			return rc;
 		}
 
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL
+		/* The walk goes from the newest to the oldest entry, so only
+		 * the first occurrence of an id may be stored.
+		 */
+		if (ate.id != 0xFFFF && nvs_ate_valid(fs, &ate) &&
+		    nvs_lookup_cache_probe(fs, ate.id) == CONFIG_NVS_LOOKUP_CACHE_SIZE) {
+			nvs_lookup_cache_insert(fs, ate.id, ate_addr);
+		}
+#else
 		cache_entry = &fs->lookup_cache[nvs_lookup_cache_pos(ate.id)];
 
 		if (ate.id != 0xFFFF && *cache_entry == NVS_LOOKUP_CACHE_NO_ADDR &&
 		    nvs_ate_valid(fs, &ate)) {
 			*cache_entry = ate_addr;
 		}
+#endif
 
 		if (addr == fs->ate_wra) {
 			break;
@@ -84,6 +166,44 @@ static void nvs_lookup_cache_invalidate(struct nvs_fs *fs, uint32_t sector)
 
 #endif /* CONFIG_NVS_LOOKUP_CACHE */
 
+#ifdef CONFIG_NVS_DATA_CACHE
+
+static inline struct nvs_data_cache_entry *nvs_data_cache_entry_get(struct nvs_fs *fs,
+								    uint16_t id)
+{
+	return &fs->data_cache[nvs_id_hash(id) % CONFIG_NVS_DATA_CACHE_SIZE];
+}
+
+/* Store the data of the given id in the data cache, or drop the id from the
+ * cache if the data is deleted or too large to be cached. The nvs_lock mutex
+ * must be held by the caller.
+ */
+static void nvs_data_cache_update(struct nvs_fs *fs, uint16_t id, const void *data,
+				  size_t len)
+{
+	struct nvs_data_cache_entry *entry = nvs_data_cache_entry_get(fs, id);
+
+	if ((len == 0U) || (len > CONFIG_NVS_DATA_CACHE_ENTRY_SIZE)) {
+		if (entry->id == id) {
+			entry->id = 0xFFFF;
+		}
+		return;
+	}
+
+	entry->id = id;
+	entry->len = (uint16_t)len;
+	memcpy(entry->data, data, len);
+}
+
+static void nvs_data_cache_invalidate(struct nvs_fs *fs)
+{
+	for (size_t i = 0; i < CONFIG_NVS_DATA_CACHE_SIZE; i++) {
+		fs->data_cache[i].id = 0xFFFF;
+	}
+}
+
+#endif /* CONFIG_NVS_DATA_CACHE */
+
 /* basic routines */
 /* nvs_al_size returns size aligned to fs->write_block_size */
 static inline size_t nvs_al_size(struct nvs_fs *fs, size_t len)
@@ -166,7 +286,11 @@ static int nvs_flash_ate_wrt(struct nvs_fs *fs, const struct nvs_ate *entry)
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 	/* 0xFFFF is a special-purpose identifier. Exclude it from the cache */
 	if (entry->id != 0xFFFF) {
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL
+		nvs_lookup_cache_insert(fs, entry->id, fs->ate_wra);
+#else
 		fs->lookup_cache[nvs_lookup_cache_pos(entry->id)] = fs->ate_wra;
+#endif
 	}
 #endif
 	fs->ate_wra -= nvs_al_size(fs, sizeof(struct nvs_ate));
@@ -673,7 +797,9 @@ static int nvs_gc(struct nvs_fs *fs)
 			continue;
 		}
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL
+		wlk_addr = nvs_lookup_cache_find(fs, gc_ate.id);
+#elif defined(CONFIG_NVS_LOOKUP_CACHE)
 		wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(gc_ate.id)];
 
 		if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
@@ -923,9 +1049,14 @@ static int nvs_startup(struct nvs_fs *fs)
 		 * So, temporarily, we set the lookup cache to the end of the fs.
 		 * The cache will be rebuilt afterwards
 		 **/
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL
+		/* An empty cache makes every lookup fall back to the end of the fs. */
+		memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+#else
 		for (i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
 			fs->lookup_cache[i] = fs->ate_wra;
 		}
+#endif
 #endif
 		rc = nvs_gc(fs);
 		goto end;
@@ -1047,6 +1178,10 @@ int nvs_mount(struct nvs_fs *fs)
 		return rc;
 	}
 
+#ifdef CONFIG_NVS_DATA_CACHE
+	nvs_data_cache_invalidate(fs);
+#endif
+
 	/* nvs is ready for use */
 	fs->ready = true;
 
@@ -1090,7 +1225,9 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 	}
 
 	/* find latest entry with same id */
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL
+	wlk_addr = nvs_lookup_cache_find(fs, id);
+#elif defined(CONFIG_NVS_LOOKUP_CACHE)
 	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
@@ -1116,7 +1253,7 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 		}
 	}
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#if defined(CONFIG_NVS_LOOKUP_CACHE) && !defined(CONFIG_NVS_LOOKUP_CACHE_FULL)
 no_cached_entry:
 #endif
 
@@ -1172,6 +1309,9 @@ no_cached_entry:
 			if (rc) {
 				goto end;
 			}
+#ifdef CONFIG_NVS_DATA_CACHE
+			nvs_data_cache_update(fs, id, data, len);
+#endif
 			break;
 		}
 
@@ -1221,9 +1361,27 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_NVS_DATA_CACHE
+	if (cnt == 0U) {
+		struct nvs_data_cache_entry *entry;
+
+		k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+		entry = nvs_data_cache_entry_get(fs, id);
+		if (entry->id == id) {
+			rc = entry->len;
+			memcpy(data, entry->data, MIN(len, (size_t)entry->len));
+			k_mutex_unlock(&fs->nvs_lock);
+			return rc;
+		}
+		k_mutex_unlock(&fs->nvs_lock);
+	}
+#endif
+
 	cnt_his = 0U;
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
+#ifdef CONFIG_NVS_LOOKUP_CACHE_FULL
+	wlk_addr = nvs_lookup_cache_find(fs, id);
+#elif defined(CONFIG_NVS_LOOKUP_CACHE)
 	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
@@ -1287,6 +1445,17 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 	}
 #endif
 
+#ifdef CONFIG_NVS_DATA_CACHE
+	/* Only cache the latest entry, and only when the data was read (and,
+	 * if enabled, CRC-checked) in full.
+	 */
+	if ((cnt == 0U) && (len >= (size_t)(wlk_ate.len - NVS_DATA_CRC_SIZE))) {
+		k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+		nvs_data_cache_update(fs, id, data, wlk_ate.len - NVS_DATA_CRC_SIZE);
+		k_mutex_unlock(&fs->nvs_lock);
+	}
+#endif
+
 	return wlk_ate.len - NVS_DATA_CRC_SIZE;
 
 err:
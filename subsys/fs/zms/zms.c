@@ -23,6 +23,9 @@ static int zms_get_sector_header(struct zms_fs *fs, uint64_t addr, struct zms_at
 				 struct zms_ate *close_ate);
 static int zms_ate_valid_different_sector(struct zms_fs *fs, const struct zms_ate *entry,
 					  uint8_t cycle_cnt);
+#ifdef CONFIG_ZMS_WRITE_CACHE
+static ssize_t zms_write_direct(struct zms_fs *fs, uint32_t id, const void *data, size_t len);
+#endif
 
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 
@@ -348,6 +351,11 @@ static int zms_flash_erase_sector(struct zms_fs *fs, uint64_t addr)
 
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 	zms_lookup_cache_invalidate(fs, SECTOR_NUM(addr));
+#endif
+#ifdef CONFIG_ZMS_WEAR_STATS
+	if (SECTOR_NUM(addr) < ARRAY_SIZE(fs->erase_count)) {
+		fs->erase_count[SECTOR_NUM(addr)]++;
+	}
 #endif
 	rc = flash_erase(fs->flash_device, offset, fs->sector_size);
 
@@ -926,6 +934,9 @@ static int zms_gc(struct zms_fs *fs)
 	uint64_t data_addr;
 	uint64_t stop_addr;
 	uint8_t previous_cycle = 0;
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	uint32_t copied = 0;
+#endif
 
 	rc = zms_get_sector_cycle(fs, fs->ate_wra, &fs->sector_cycle);
 	if (rc == -ENOENT) {
@@ -1037,11 +1048,23 @@ static int zms_gc(struct zms_fs *fs)
 			if (rc) {
 				return rc;
 			}
+
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+			copied += fs->ate_size;
+			if (gc_ate.len > ZMS_DATA_IN_ATE_SIZE) {
+				copied += zms_al_size(fs, gc_ate.len);
+			}
+#endif
 		}
 	} while (gc_prev_addr != stop_addr);
 
 gc_done:
 
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	fs->gc_count++;
+	fs->gc_max_copied = MAX(fs->gc_max_copied, copied);
+#endif
+
 	/* restore the previous sector_cycle */
 	fs->sector_cycle = previous_cycle;
 
@@ -1067,6 +1090,131 @@ gc_done:
 	return rc;
 }
 
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+
+static void zms_gc_work_handler(struct k_work *work)
+{
+	int rc;
+	struct zms_fs *fs = CONTAINER_OF(work, struct zms_fs, gc_work);
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+
+	/* A write issued after this work item was submitted may already have
+	 * triggered the synchronous garbage collection and opened a new sector.
+	 */
+	if ((fs->ate_wra - fs->data_wra) >=
+	    (CONFIG_ZMS_BACKGROUND_GC_THRESHOLD + fs->ate_size)) {
+		goto end;
+	}
+
+	rc = zms_sector_close(fs);
+	if (rc) {
+		LOG_ERR("Failed to close the sector, returned = %d", rc);
+		goto end;
+	}
+
+	rc = zms_gc(fs);
+	if (rc) {
+		LOG_ERR("Garbage collection failed, returned = %d", rc);
+	}
+
+end:
+	k_mutex_unlock(&fs->zms_lock);
+}
+
+#endif /* CONFIG_ZMS_BACKGROUND_GC */
+
+#ifdef CONFIG_ZMS_WRITE_CACHE
+
+/* Must be called with the zms_lock held */
+static struct zms_wc_entry *zms_wc_find(struct zms_fs *fs, uint32_t id)
+{
+	for (uint8_t i = 0; i < fs->wc_count; i++) {
+		if (fs->wc_entry[i].id == id) {
+			return &fs->wc_entry[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Must be called with the zms_lock held */
+static int zms_wc_flush(struct zms_fs *fs)
+{
+	ssize_t rc;
+
+	/* Flush in the order the entries were first buffered so that the
+	 * storage never holds a write that was issued after one it lacks.
+	 */
+	for (uint8_t i = 0; i < fs->wc_count; i++) {
+		struct zms_wc_entry *entry = &fs->wc_entry[i];
+
+		rc = zms_write_direct(fs, entry->id, (entry->len > 0U) ? entry->data : NULL,
+				      entry->len);
+		if (rc < 0) {
+			/* Keep the entries that did not make it out */
+			memmove(&fs->wc_entry[0], &fs->wc_entry[i],
+				(fs->wc_count - i) * sizeof(fs->wc_entry[0]));
+			fs->wc_count -= i;
+			return rc;
+		}
+	}
+
+	fs->wc_count = 0;
+
+	return 0;
+}
+
+/* Must be called with the zms_lock held */
+static int zms_wc_put(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
+{
+	struct zms_wc_entry *entry = zms_wc_find(fs, id);
+
+	if (entry == NULL) {
+		if (fs->wc_count == ARRAY_SIZE(fs->wc_entry)) {
+			int rc = zms_wc_flush(fs);
+
+			if (rc) {
+				return rc;
+			}
+		}
+		entry = &fs->wc_entry[fs->wc_count++];
+		entry->id = id;
+	}
+
+	entry->len = len;
+	if (len > 0U) {
+		memcpy(entry->data, data, len);
+	}
+
+	/* No-op while a flush is already pending, so the deadline set by the
+	 * first buffered write holds.
+	 */
+	k_work_schedule(&fs->wc_flush_work, K_MSEC(CONFIG_ZMS_WRITE_CACHE_TIMEOUT_MS));
+
+	return 0;
+}
+
+static void zms_wc_flush_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct zms_fs *fs = CONTAINER_OF(dwork, struct zms_fs, wc_flush_work);
+	int rc;
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+
+	rc = zms_wc_flush(fs);
+	if (rc) {
+		LOG_ERR("Write cache flush failed, returned = %d", rc);
+		/* Retry the remaining entries on the next interval */
+		k_work_schedule(&fs->wc_flush_work, K_MSEC(CONFIG_ZMS_WRITE_CACHE_TIMEOUT_MS));
+	}
+
+	k_mutex_unlock(&fs->zms_lock);
+}
+
+#endif /* CONFIG_ZMS_WRITE_CACHE */
+
 int zms_clear(struct zms_fs *fs)
 {
 	int rc;
@@ -1078,6 +1226,13 @@ int zms_clear(struct zms_fs *fs)
 	}
 
 	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+
+#ifdef CONFIG_ZMS_WRITE_CACHE
+	/* Buffered writes are dropped together with the stored data */
+	k_work_cancel_delayable(&fs->wc_flush_work);
+	fs->wc_count = 0;
+#endif
+
 	for (uint32_t i = 0; i < fs->sector_count; i++) {
 		addr = (uint64_t)i << ADDR_SECT_SHIFT;
 		rc = zms_flash_erase_sector(fs, addr);
@@ -1368,6 +1523,21 @@ int zms_mount(struct zms_fs *fs)
 
 	k_mutex_init(&fs->zms_lock);
 
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	k_work_init(&fs->gc_work, zms_gc_work_handler);
+	fs->gc_count = 0;
+	fs->gc_max_copied = 0;
+#endif
+
+#ifdef CONFIG_ZMS_WRITE_CACHE
+	k_work_init_delayable(&fs->wc_flush_work, zms_wc_flush_work_handler);
+	fs->wc_count = 0;
+#endif
+
+#ifdef CONFIG_ZMS_WEAR_STATS
+	memset(fs->erase_count, 0, sizeof(fs->erase_count));
+#endif
+
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
 	if (fs->flash_parameters == NULL) {
 		LOG_ERR("Could not obtain flash parameters");
@@ -1429,7 +1599,7 @@ int zms_mount(struct zms_fs *fs)
 	return 0;
 }
 
-ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
+static ssize_t zms_write_direct(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
 {
 	int rc;
 	size_t data_size;
@@ -1565,17 +1735,86 @@ no_cached_entry:
 		}
 		gc_count++;
 	}
+
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	/* Hand the next sector switch over to the work item while there is
+	 * still room left for a few foreground writes.
+	 */
+	if ((fs->ate_wra - fs->data_wra) <
+	    (CONFIG_ZMS_BACKGROUND_GC_THRESHOLD + fs->ate_size)) {
+		k_work_submit(&fs->gc_work);
+	}
+#endif
 	rc = len;
 end:
 	k_mutex_unlock(&fs->zms_lock);
 	return rc;
 }
 
+ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
+{
+#ifdef CONFIG_ZMS_WRITE_CACHE
+	int rc;
+
+	if (!fs->ready) {
+		LOG_ERR("zms not initialized");
+		return -EACCES;
+	}
+
+	if ((len > 0) && (data == NULL)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+
+	if (len > CONFIG_ZMS_WRITE_CACHE_DATA_SIZE) {
+		/* Too large to buffer: flush what was buffered before this
+		 * write so that the storage observes the original ordering,
+		 * then write through.
+		 */
+		rc = zms_wc_flush(fs);
+		k_mutex_unlock(&fs->zms_lock);
+		if (rc) {
+			return rc;
+		}
+
+		return zms_write_direct(fs, id, data, len);
+	}
+
+	rc = zms_wc_put(fs, id, data, len);
+	k_mutex_unlock(&fs->zms_lock);
+
+	return (rc < 0) ? rc : (ssize_t)len;
+#else
+	return zms_write_direct(fs, id, data, len);
+#endif
+}
+
 int zms_delete(struct zms_fs *fs, uint32_t id)
 {
 	return zms_write(fs, id, NULL, 0);
 }
 
+int zms_sync(struct zms_fs *fs)
+{
+	if (!fs->ready) {
+		LOG_ERR("zms not initialized");
+		return -EACCES;
+	}
+
+#ifdef CONFIG_ZMS_WRITE_CACHE
+	int rc;
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+	rc = zms_wc_flush(fs);
+	k_mutex_unlock(&fs->zms_lock);
+
+	return rc;
+#else
+	return 0;
+#endif
+}
+
 ssize_t zms_read_hist(struct zms_fs *fs, uint32_t id, void *data, size_t len, uint32_t cnt)
 {
 	int rc;
@@ -1596,6 +1835,33 @@ ssize_t zms_read_hist(struct zms_fs *fs, uint32_t id, void *data, size_t len, ui
 
 	cnt_his = 0U;
 
+#ifdef CONFIG_ZMS_WRITE_CACHE
+	struct zms_wc_entry *wc_entry;
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+	wc_entry = zms_wc_find(fs, id);
+	if (wc_entry != NULL) {
+		if (cnt == 0) {
+			if (wc_entry->len == 0U) {
+				/* buffered delete */
+				k_mutex_unlock(&fs->zms_lock);
+				return -ENOENT;
+			}
+			if (data) {
+				memcpy(data, wc_entry->data, MIN(len, wc_entry->len));
+			}
+			rc = wc_entry->len;
+			k_mutex_unlock(&fs->zms_lock);
+			return rc;
+		}
+		/* The buffered entry is the most recent value, so history
+		 * counting on the storage starts one generation further back.
+		 */
+		cnt--;
+	}
+	k_mutex_unlock(&fs->zms_lock);
+#endif
+
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 	wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(id)];
 
@@ -1810,6 +2076,22 @@ ssize_t zms_calc_free_space(struct zms_fs *fs)
 	return free_space;
 }
 
+#ifdef CONFIG_ZMS_WEAR_STATS
+ssize_t zms_sector_erase_count(struct zms_fs *fs, uint32_t sector)
+{
+	if (!fs->ready) {
+		LOG_ERR("zms not initialized");
+		return -EACCES;
+	}
+
+	if ((sector >= fs->sector_count) || (sector >= ARRAY_SIZE(fs->erase_count))) {
+		return -EINVAL;
+	}
+
+	return fs->erase_count[sector];
+}
+#endif
+
 size_t zms_active_sector_free_space(struct zms_fs *fs)
 {
 	if (!fs->ready) {
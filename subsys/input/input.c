@@ -27,6 +27,100 @@ static void input_process(struct input_event *evt)
 	}
 }
 
+#ifdef CONFIG_INPUT_EVENT_FRAMES
+
+static struct input_event frame_buf[CONFIG_INPUT_EVENT_FRAME_MAX_EVENTS];
+static uint16_t frame_len;
+
+static void input_frame_dispatch(void)
+{
+	if (frame_len == 0) {
+		return;
+	}
+
+	/* Coalescing can leave stale sync flags around, the frame boundary
+	 * is the end of the buffer.
+	 */
+	for (uint16_t i = 0; i < frame_len; i++) {
+		frame_buf[i].sync = (i == frame_len - 1);
+	}
+
+	STRUCT_SECTION_FOREACH(input_frame_callback, callback) {
+		if (callback->dev == NULL || callback->dev == frame_buf[0].dev) {
+			callback->callback(frame_buf, frame_len,
+					   callback->user_data);
+		}
+	}
+
+	frame_len = 0;
+}
+
+static bool input_frame_coalesce(struct input_event *evt)
+{
+	if (evt->type != INPUT_EV_ABS && evt->type != INPUT_EV_REL) {
+		return false;
+	}
+
+	for (uint16_t i = 0; i < frame_len; i++) {
+		if (frame_buf[i].type == evt->type &&
+		    frame_buf[i].code == evt->code) {
+			if (evt->type == INPUT_EV_REL) {
+				frame_buf[i].value += evt->value;
+			} else {
+				frame_buf[i].value = evt->value;
+			}
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool input_frame_motion_only(void)
+{
+	for (uint16_t i = 0; i < frame_len; i++) {
+		if (frame_buf[i].type != INPUT_EV_ABS &&
+		    frame_buf[i].type != INPUT_EV_REL) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void input_frame_add(struct input_event *evt)
+{
+	/* A frame only holds events from a single device */
+	if (frame_len > 0 && frame_buf[0].dev != evt->dev) {
+		input_frame_dispatch();
+	}
+
+	if (!IS_ENABLED(CONFIG_INPUT_EVENT_FRAME_COALESCE) ||
+	    !input_frame_coalesce(evt)) {
+		if (frame_len == ARRAY_SIZE(frame_buf)) {
+			input_frame_dispatch();
+		}
+		frame_buf[frame_len++] = *evt;
+	}
+
+	if (!evt->sync) {
+		return;
+	}
+
+	/* Hold back motion-only frames while events keep piling up behind
+	 * the listeners, newer motion data coalesces into the pending frame
+	 * so they see fewer but fresher frames.
+	 */
+	if (IS_ENABLED(CONFIG_INPUT_EVENT_FRAME_COALESCE) &&
+	    !input_queue_empty() && input_frame_motion_only()) {
+		return;
+	}
+
+	input_frame_dispatch();
+}
+
+#endif /* CONFIG_INPUT_EVENT_FRAMES */
+
 bool input_queue_empty(void)
 {
 #ifdef CONFIG_INPUT_MODE_THREAD
@@ -86,6 +180,10 @@ static void input_thread(void)
 		}
 
 		input_process(&evt);
+
+#ifdef CONFIG_INPUT_EVENT_FRAMES
+		input_frame_add(&evt);
+#endif
 	}
 }
 
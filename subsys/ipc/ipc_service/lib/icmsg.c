@@ -123,6 +123,27 @@ static void submit_mbox_work(struct icmsg_data_t *dev_data)
 
 #endif
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE
+static void tx_coalesce_flush(struct icmsg_data_t *dev_data)
+{
+	if (atomic_set(&dev_data->tx_coalesce_pending, 0) == 0) {
+		return;
+	}
+
+	(void)pbuf_write_commit(dev_data->tx_pb);
+	(void)mbox_send_dt(&dev_data->cfg->mbox_tx, NULL);
+}
+
+static void tx_coalesce_work_handler(struct k_work *item)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(item);
+	struct icmsg_data_t *dev_data =
+		CONTAINER_OF(dwork, struct icmsg_data_t, tx_coalesce_work);
+
+	tx_coalesce_flush(dev_data);
+}
+#endif /* def CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE */
+
 static int initialize_tx_with_sid_disabled(struct icmsg_data_t *dev_data)
 {
 	int ret;
@@ -411,6 +432,10 @@ int icmsg_open(const struct icmsg_config_t *conf,
 #ifdef CONFIG_IPC_SERVICE_ICMSG_SHMEM_ACCESS_SYNC
 	k_mutex_init(&dev_data->tx_lock);
 #endif
+#ifdef CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE
+	k_work_init_delayable(&dev_data->tx_coalesce_work, tx_coalesce_work_handler);
+	atomic_set(&dev_data->tx_coalesce_pending, 0);
+#endif
 
 	ret = pbuf_rx_init(dev_data->rx_pb);
 
@@ -473,6 +498,12 @@ int icmsg_close(const struct icmsg_config_t *conf,
 	int ret = 0;
 	enum icmsg_state old_state;
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE
+	/* Publish any staged messages before the disconnect notification. */
+	(void)k_work_cancel_delayable(&dev_data->tx_coalesce_work);
+	tx_coalesce_flush(dev_data);
+#endif
+
 	if (conf->unbound_mode != ICMSG_UNBOUND_MODE_DISABLE &&
 	    (UNBOUND_ENABLED || UNBOUND_DETECT)) {
 		pbuf_handshake_write(dev_data->rx_pb,
@@ -517,7 +548,11 @@ int icmsg_send(const struct icmsg_config_t *conf,
 		return -ENOBUFS;
 	}
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE
+	write_ret = pbuf_write_stage(dev_data->tx_pb, msg, len);
+#else
 	write_ret = pbuf_write(dev_data->tx_pb, msg, len);
+#endif
 
 	release_ret = release_tx_buffer(dev_data);
 	__ASSERT_NO_MSG(!release_ret);
@@ -531,10 +566,23 @@ int icmsg_send(const struct icmsg_config_t *conf,
 
 	__ASSERT_NO_MSG(conf->mbox_tx.dev != NULL);
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE
+	if (atomic_inc(&dev_data->tx_coalesce_pending) + 1 >=
+	    CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE_COUNT) {
+		tx_coalesce_flush(dev_data);
+	} else {
+		/* Scheduling is a no-op when the work is already pending, so
+		 * the delay runs from the first staged message of the batch.
+		 */
+		(void)k_work_schedule(&dev_data->tx_coalesce_work,
+				      K_USEC(CONFIG_IPC_SERVICE_ICMSG_TX_COALESCE_DELAY_US));
+	}
+#else
 	ret = mbox_send_dt(&conf->mbox_tx, NULL);
 	if (ret) {
 		return ret;
 	}
+#endif
 
 	return sent_bytes;
 }
@@ -112,7 +112,7 @@ int pbuf_rx_init(struct pbuf *pb)
 	return 0;
 }
 
-int pbuf_write(struct pbuf *pb, const char *data, uint16_t len)
+static int pbuf_write_internal(struct pbuf *pb, const char *data, uint16_t len, bool commit)
 {
 	if (pb == NULL || len == 0 || data == NULL) {
 		/* Incorrect call. */
@@ -172,11 +172,45 @@ int pbuf_write(struct pbuf *pb, const char *data, uint16_t len)
 	wr_idx = idx_wrap(blen, ROUND_UP(wr_idx + len, _PBUF_IDX_SIZE));
 	/* Update wr_idx. */
 	pb->data.wr_idx = wr_idx;
-	*(pb->cfg->wr_idx_loc) = wr_idx;
+	if (commit) {
+		*(pb->cfg->wr_idx_loc) = wr_idx;
+		__sync_synchronize();
+		sys_cache_data_flush_range((void *)pb->cfg->wr_idx_loc,
+					   sizeof(*(pb->cfg->wr_idx_loc)));
+	}
+
+	return len;
+}
+
+int pbuf_write(struct pbuf *pb, const char *data, uint16_t len)
+{
+	return pbuf_write_internal(pb, data, len, true);
+}
+
+int pbuf_write_stage(struct pbuf *pb, const char *data, uint16_t len)
+{
+	return pbuf_write_internal(pb, data, len, false);
+}
+
+int pbuf_write_commit(struct pbuf *pb)
+{
+	if (pb == NULL) {
+		/* Incorrect call. */
+		return -EINVAL;
+	}
+
+	/* The writer is the only one updating the shared wr_idx, so its cached
+	 * value reflects what was last committed.
+	 */
+	if (*(pb->cfg->wr_idx_loc) == pb->data.wr_idx) {
+		return 0;
+	}
+
+	*(pb->cfg->wr_idx_loc) = pb->data.wr_idx;
 	__sync_synchronize();
 	sys_cache_data_flush_range((void *)pb->cfg->wr_idx_loc, sizeof(*(pb->cfg->wr_idx_loc)));
 
-	return len;
+	return 0;
 }
 
 int pbuf_get_initial_buf(struct pbuf *pb, volatile char **buf, uint16_t *len)
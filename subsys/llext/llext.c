@@ -134,15 +134,26 @@ const void *llext_find_sym(const struct llext_symtable *sym_table, const char *s
 #ifdef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
 		/* 'sym_name' is actually a SLID to search for */
 		uintptr_t slid = (uintptr_t)sym_name;
+		size_t left = 0, right;
 
-		/* TODO: perform a binary search instead of linear.
-		 * Note that - as of writing - the llext_const_symbol_area
-		 * section is sorted in ascending SLID order.
-		 * (see scripts/build/llext_prepare_exptab.py)
+		/*
+		 * The llext_const_symbol_area section is sorted in ascending
+		 * SLID order (see scripts/build/llext_prepare_exptab.py), so
+		 * a binary search can be used here.
 		 */
-		STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
+		STRUCT_SECTION_COUNT(llext_const_symbol, &right);
+
+		while (left < right) {
+			size_t mid = left + (right - left) / 2;
+			const struct llext_const_symbol *sym;
+
+			STRUCT_SECTION_GET(llext_const_symbol, mid, &sym);
 			if (slid == sym->slid) {
 				return sym->addr;
+			} else if (slid > sym->slid) {
+				left = mid + 1;
+			} else {
+				right = mid;
 			}
 		}
 #else
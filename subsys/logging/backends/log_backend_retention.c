@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_retention.h>
+#include <zephyr/logging/log_backend_std.h>
+#include <zephyr/logging/log_core.h>
+#include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_output_dict.h>
+#include <zephyr/retention/retention.h>
+#include <zephyr/sys/crc.h>
+#include <string.h>
+
+#define LOG_RETENTION_MAGIC 0x43474f4c
+
+/* Control block stored at the start of the retention area */
+struct log_retention_hdr {
+	uint32_t magic;
+	/* Write offset into the ring data area */
+	uint32_t head;
+	/* Number of used bytes in the ring data area */
+	uint32_t used;
+} __packed;
+
+/* Frame header preceding every message in the ring data area */
+struct log_retention_frame_hdr {
+	uint16_t len;
+	uint16_t crc;
+} __packed;
+
+static const struct device *const retention_dev =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_log_retention));
+
+/* RAM copy of the control block, written back on every commit */
+static struct log_retention_hdr ring_hdr;
+/* Size of the ring data area following the control block */
+static uint32_t ring_size;
+static bool backend_ok;
+
+/* Message assembly buffer. The dictionary output of one message is
+ * collected here so that it can be committed to the ring as one frame.
+ */
+static uint8_t msg_buf[CONFIG_LOG_BACKEND_RETENTION_MAX_MSG_SIZE];
+static size_t msg_len;
+static bool msg_overflow;
+
+/* Read from the ring data area, wrapping at the end of the area */
+static int ring_read(uint32_t off, uint8_t *data, size_t len)
+{
+	size_t first = MIN(len, ring_size - off);
+	int rc;
+
+	rc = retention_read(retention_dev,
+			    sizeof(struct log_retention_hdr) + off, data,
+			    first);
+	if ((rc == 0) && (first < len)) {
+		rc = retention_read(retention_dev,
+				    sizeof(struct log_retention_hdr),
+				    data + first, len - first);
+	}
+
+	return rc;
+}
+
+/* Write to the ring data area, wrapping at the end of the area */
+static int ring_write(uint32_t off, const uint8_t *data, size_t len)
+{
+	size_t first = MIN(len, ring_size - off);
+	int rc;
+
+	rc = retention_write(retention_dev,
+			     sizeof(struct log_retention_hdr) + off, data,
+			     first);
+	if ((rc == 0) && (first < len)) {
+		rc = retention_write(retention_dev,
+				     sizeof(struct log_retention_hdr),
+				     data + first, len - first);
+	}
+
+	return rc;
+}
+
+/* Offset of the oldest frame in the ring data area */
+static uint32_t ring_tail(void)
+{
+	return (ring_hdr.head + ring_size - ring_hdr.used) % ring_size;
+}
+
+/* Release the space held by the oldest frame */
+static int ring_drop_oldest(void)
+{
+	struct log_retention_frame_hdr frame;
+	int rc;
+
+	rc = ring_read(ring_tail(), (uint8_t *)&frame, sizeof(frame));
+	if (rc < 0) {
+		return rc;
+	}
+
+	if ((frame.len == 0U) ||
+	    ((sizeof(frame) + frame.len) > ring_hdr.used)) {
+		/* Frame header is corrupted, drop the whole ring */
+		ring_hdr.used = 0U;
+		return 0;
+	}
+
+	ring_hdr.used -= sizeof(frame) + frame.len;
+
+	return 0;
+}
+
+/* Commit the assembled message to the ring as a single frame */
+static void commit_msg(void)
+{
+	struct log_retention_frame_hdr frame;
+	uint32_t total = sizeof(frame) + msg_len;
+	int rc;
+
+	if ((msg_len == 0U) || msg_overflow || (total > ring_size)) {
+		return;
+	}
+
+	/* Make room by dropping the oldest frames */
+	while ((ring_size - ring_hdr.used) < total) {
+		if (ring_drop_oldest() < 0) {
+			backend_ok = false;
+			return;
+		}
+	}
+
+	frame.len = msg_len;
+	frame.crc = crc16_itu_t(0U, msg_buf, msg_len);
+
+	rc = ring_write(ring_hdr.head, (const uint8_t *)&frame, sizeof(frame));
+	if (rc == 0) {
+		rc = ring_write((ring_hdr.head + sizeof(frame)) % ring_size,
+				msg_buf, msg_len);
+	}
+	if (rc == 0) {
+		ring_hdr.head = (ring_hdr.head + total) % ring_size;
+		ring_hdr.used += total;
+		rc = retention_write(retention_dev, 0,
+				     (const uint8_t *)&ring_hdr,
+				     sizeof(ring_hdr));
+	}
+
+	if (rc < 0) {
+		backend_ok = false;
+	}
+}
+
+static int copy_to_msg_buf(uint8_t *data, size_t length, void *ctx)
+{
+	size_t copy = MIN(length, sizeof(msg_buf) - msg_len);
+
+	ARG_UNUSED(ctx);
+
+	memcpy(&msg_buf[msg_len], data, copy);
+	msg_len += copy;
+	if (copy < length) {
+		msg_overflow = true;
+	}
+
+	/* Report all bytes as consumed to keep the output flushed */
+	return length;
+}
+
+static uint8_t out_buf[64];
+LOG_OUTPUT_DEFINE(log_output_retention, copy_to_msg_buf, out_buf,
+		  sizeof(out_buf));
+
+static void process(const struct log_backend *const backend,
+		    union log_msg_generic *msg)
+{
+	ARG_UNUSED(backend);
+
+	if (!backend_ok) {
+		return;
+	}
+
+	msg_len = 0;
+	msg_overflow = false;
+	log_dict_output_msg_process(&log_output_retention, &msg->log,
+				    log_backend_std_get_flags());
+	commit_msg();
+}
+
+static void dropped(const struct log_backend *const backend, uint32_t cnt)
+{
+	ARG_UNUSED(backend);
+
+	if (!backend_ok) {
+		return;
+	}
+
+	msg_len = 0;
+	msg_overflow = false;
+	log_dict_output_dropped_process(&log_output_retention, cnt);
+	commit_msg();
+}
+
+static void log_backend_retention_init(const struct log_backend *const backend)
+{
+	ssize_t area_size = retention_size(retention_dev);
+	int rc;
+
+	ARG_UNUSED(backend);
+
+	if (!device_is_ready(retention_dev) ||
+	    (area_size <= (ssize_t)(sizeof(struct log_retention_hdr) +
+				    sizeof(struct log_retention_frame_hdr)))) {
+		return;
+	}
+
+	ring_size = area_size - sizeof(struct log_retention_hdr);
+
+	/* Pick up the ring from before the reboot when the control block
+	 * is intact, otherwise start over with an empty ring.
+	 */
+	rc = retention_read(retention_dev, 0, (uint8_t *)&ring_hdr,
+			    sizeof(ring_hdr));
+	if ((rc == 0) && (ring_hdr.magic == LOG_RETENTION_MAGIC) &&
+	    (ring_hdr.head < ring_size) && (ring_hdr.used <= ring_size)) {
+		backend_ok = true;
+		return;
+	}
+
+	ring_hdr.magic = LOG_RETENTION_MAGIC;
+	ring_hdr.head = 0U;
+	ring_hdr.used = 0U;
+	rc = retention_write(retention_dev, 0, (const uint8_t *)&ring_hdr,
+			     sizeof(ring_hdr));
+	backend_ok = (rc == 0);
+}
+
+static void panic(struct log_backend const *const backend)
+{
+	/* Messages processed before the panic are already persisted.
+	 * Deactivate rather than risk corrupting the retained ring from a
+	 * broken context; the ring is dumped after the reboot.
+	 */
+	log_backend_deactivate(backend);
+}
+
+static int format_set(const struct log_backend *const backend,
+		      uint32_t log_type)
+{
+	ARG_UNUSED(backend);
+
+	/* The ring framing assumes dictionary output */
+	return (log_type == LOG_OUTPUT_DICT) ? 0 : -ENOTSUP;
+}
+
+int log_backend_retention_dump(log_backend_retention_cb_t cb, void *ctx)
+{
+	struct log_retention_frame_hdr frame;
+	uint32_t off = ring_tail();
+	uint32_t remaining = ring_hdr.used;
+	int count = 0;
+	int rc;
+
+	if (!backend_ok) {
+		return -ENODEV;
+	}
+
+	while (remaining >= sizeof(frame)) {
+		rc = ring_read(off, (uint8_t *)&frame, sizeof(frame));
+		if (rc < 0) {
+			return rc;
+		}
+
+		if ((frame.len == 0U) || (frame.len > sizeof(msg_buf)) ||
+		    ((sizeof(frame) + frame.len) > remaining)) {
+			/* Frame header is corrupted, stop the walk */
+			break;
+		}
+
+		rc = ring_read((off + sizeof(frame)) % ring_size, msg_buf,
+			       frame.len);
+		if (rc < 0) {
+			return rc;
+		}
+
+		if (crc16_itu_t(0U, msg_buf, frame.len) == frame.crc) {
+			cb(msg_buf, frame.len, ctx);
+			count++;
+		}
+
+		off = (off + sizeof(frame) + frame.len) % ring_size;
+		remaining -= sizeof(frame) + frame.len;
+	}
+
+	return count;
+}
+
+int log_backend_retention_clear(void)
+{
+	int rc;
+
+	if (!backend_ok) {
+		return -ENODEV;
+	}
+
+	ring_hdr.head = 0U;
+	ring_hdr.used = 0U;
+	rc = retention_write(retention_dev, 0, (const uint8_t *)&ring_hdr,
+			     sizeof(ring_hdr));
+	if (rc < 0) {
+		backend_ok = false;
+	}
+
+	return rc;
+}
+
+static const struct log_backend_api log_backend_retention_api = {
+	.process = process,
+	.panic = panic,
+	.init = log_backend_retention_init,
+	.dropped = dropped,
+	.format_set = format_set,
+};
+
+LOG_BACKEND_DEFINE(log_backend_retention, log_backend_retention_api,
+		   IS_ENABLED(CONFIG_LOG_BACKEND_RETENTION_AUTOSTART));
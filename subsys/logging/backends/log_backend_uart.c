@@ -14,16 +14,30 @@
 #include <zephyr/device.h>
 #include <zephyr/drivers/uart.h>
 #include <zephyr/sys/util_macro.h>
+#include <zephyr/sys/util.h>
 #include <zephyr/sys/__assert.h>
+#include <string.h>
 #include <zephyr/pm/device.h>
 #include <zephyr/pm/device_runtime.h>
 LOG_MODULE_REGISTER(log_uart);
 
+struct lbu_cb_ctx;
+
 struct lbu_data {
 	struct k_sem sem;
 	uint32_t log_format_current;
 	volatile bool in_panic;
 	bool use_async;
+#if defined(CONFIG_LOG_BACKEND_UART_ASYNC_COALESCE)
+	struct k_work_delayable flush_work;
+	const struct lbu_cb_ctx *cb_ctx;
+	struct k_spinlock lock;
+	uint8_t (*tx_bufs)[CONFIG_LOG_BACKEND_UART_ASYNC_COALESCE_BUF_SIZE];
+	size_t fill;
+	uint8_t active;
+	bool tx_busy;
+	bool pm_ref;
+#endif
 };
 
 struct lbu_cb_ctx {
@@ -43,6 +57,53 @@ struct lbu_cb_ctx {
  */
 static const char LOG_HEX_SEP[10] = "##ZLOGV1##";
 
+#if defined(CONFIG_LOG_BACKEND_UART_ASYNC_COALESCE)
+#define LBU_COALESCE_BUF_SIZE CONFIG_LOG_BACKEND_UART_ASYNC_COALESCE_BUF_SIZE
+
+/* Requires data->lock to be held. Hands the filled buffer over to the UART
+ * and switches filling to the other one.
+ */
+static void lbu_coalesce_tx_start(const struct device *uart_dev, struct lbu_data *data)
+{
+	int err;
+	uint8_t idx = data->active;
+
+	data->tx_busy = true;
+	data->active ^= 1;
+
+	err = uart_tx(uart_dev, data->tx_bufs[idx], data->fill, SYS_FOREVER_US);
+	__ASSERT_NO_MSG(err == 0);
+	(void)err;
+
+	data->fill = 0;
+}
+
+static void lbu_flush_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct lbu_data *data = CONTAINER_OF(dwork, struct lbu_data, flush_work);
+	const struct device *uart_dev = LBU_UART_DEV(data->cb_ctx);
+	k_spinlock_key_t key;
+	bool put = false;
+
+	key = k_spin_lock(&data->lock);
+
+	if (!data->tx_busy && (data->fill > 0)) {
+		lbu_coalesce_tx_start(uart_dev, data);
+	} else if (!data->tx_busy && data->pm_ref) {
+		/* Everything drained, let the device suspend again */
+		data->pm_ref = false;
+		put = true;
+	}
+
+	k_spin_unlock(&data->lock, key);
+
+	if (put) {
+		(void)pm_device_runtime_put_async(uart_dev, K_MSEC(1));
+	}
+}
+#endif /* CONFIG_LOG_BACKEND_UART_ASYNC_COALESCE */
+
 static void uart_callback(const struct device *dev,
 			  struct uart_event *evt,
 			  void *user_data)
@@ -54,6 +115,19 @@ static void uart_callback(const struct device *dev,
 
 	switch (evt->type) {
 	case UART_TX_DONE:
+#if defined(CONFIG_LOG_BACKEND_UART_ASYNC_COALESCE)
+		if (data->use_async && !data->in_panic) {
+			k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+			data->tx_busy = false;
+			k_spin_unlock(&data->lock, key);
+
+			/* Start the next transfer, or release the device if
+			 * nothing is pending.
+			 */
+			(void)k_work_reschedule(&data->flush_work, K_NO_WAIT);
+		}
+#endif
 		k_sem_give(&data->sem);
 		break;
 	default:
@@ -79,6 +153,65 @@ static void dict_char_out_hex(const struct device *uart_dev, uint8_t *data, size
 	}
 }
 
+#if defined(CONFIG_LOG_BACKEND_UART_ASYNC_COALESCE)
+static void lbu_coalesce_out(const struct lbu_cb_ctx *ctx, uint8_t *buf, size_t length)
+{
+	struct lbu_data *data = ctx->data;
+	const struct device *uart_dev = LBU_UART_DEV(ctx);
+	size_t written = 0;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&data->lock);
+
+	if (!data->pm_ref) {
+		/* Keep the device resumed while output is buffered or a
+		 * transfer is in flight. Released by the flush work once
+		 * everything has drained.
+		 */
+		data->pm_ref = true;
+		k_spin_unlock(&data->lock, key);
+		(void)pm_device_runtime_get(uart_dev);
+		key = k_spin_lock(&data->lock);
+	}
+
+	while (written < length) {
+		size_t chunk = MIN(LBU_COALESCE_BUF_SIZE - data->fill, length - written);
+
+		memcpy(&data->tx_bufs[data->active][data->fill], &buf[written], chunk);
+		data->fill += chunk;
+		written += chunk;
+
+		if (data->fill < LBU_COALESCE_BUF_SIZE) {
+			break;
+		}
+
+		if (!data->tx_busy) {
+			lbu_coalesce_tx_start(uart_dev, data);
+			continue;
+		}
+
+		k_spin_unlock(&data->lock, key);
+
+		/* Both buffers full, wait for the in-flight transfer */
+		if (k_sem_take(&data->sem,
+			       K_MSEC(CONFIG_LOG_BACKEND_UART_ASYNC_COALESCE_DROP_TIMEOUT_MS)) !=
+		    0) {
+			/* The UART cannot keep up, drop the remainder */
+			return;
+		}
+
+		key = k_spin_lock(&data->lock);
+	}
+
+	if ((data->fill > 0) && !data->tx_busy) {
+		(void)k_work_schedule(&data->flush_work,
+				      K_MSEC(CONFIG_LOG_BACKEND_UART_ASYNC_COALESCE_LATENCY_MS));
+	}
+
+	k_spin_unlock(&data->lock, key);
+}
+#endif /* CONFIG_LOG_BACKEND_UART_ASYNC_COALESCE */
+
 static int char_out(uint8_t *data, size_t length, void *ctx)
 {
 	int err;
@@ -106,6 +239,10 @@ static int char_out(uint8_t *data, size_t length, void *ctx)
 		goto cleanup;
 	}
 
+#if defined(CONFIG_LOG_BACKEND_UART_ASYNC_COALESCE)
+	ARG_UNUSED(err);
+	lbu_coalesce_out(cb_ctx, data, length);
+#else
 	err = uart_tx(uart_dev, data, length, SYS_FOREVER_US);
 	__ASSERT_NO_MSG(err == 0);
 
@@ -113,6 +250,7 @@ static int char_out(uint8_t *data, size_t length, void *ctx)
 	__ASSERT_NO_MSG(err == 0);
 
 	(void)err;
+#endif /* CONFIG_LOG_BACKEND_UART_ASYNC_COALESCE */
 cleanup:
 	/* Use async put to avoid useless device suspension/resumption
 	 * when tranmiting chain of chars.
@@ -173,6 +311,10 @@ static void log_backend_uart_init(struct log_backend const *const backend)
 		if (err == 0) {
 			data->use_async = true;
 			k_sem_init(&data->sem, 0, 1);
+#if defined(CONFIG_LOG_BACKEND_UART_ASYNC_COALESCE)
+			data->cb_ctx = ctx;
+			k_work_init_delayable(&data->flush_work, lbu_flush_work_handler);
+#endif
 		} else {
 			LOG_WRN("Failed to initialize asynchronous mode (err:%d). "
 				"Fallback to polling.",
@@ -203,6 +345,23 @@ static void panic(struct log_backend const *const backend)
 #endif /* CONFIG_PM_DEVICE */
 
 	data->in_panic = true;
+
+#if defined(CONFIG_LOG_BACKEND_UART_ASYNC_COALESCE)
+	if (data->use_async) {
+		/* Push out whatever is still sitting in the coalescing
+		 * buffer. An in-flight transfer is left to complete on its
+		 * own.
+		 */
+		k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+		for (size_t i = 0; i < data->fill; i++) {
+			uart_poll_out(uart_dev, data->tx_bufs[data->active][i]);
+		}
+		data->fill = 0;
+		k_spin_unlock(&data->lock, key);
+	}
+#endif
+
 	log_backend_std_panic(ctx->output);
 }
 
@@ -237,8 +396,14 @@ const struct log_backend_api log_backend_uart_api = {
 	LOG_OUTPUT_DEFINE(lbu_output##__VA_ARGS__, char_out, lbu_buffer##__VA_ARGS__,              \
 			  CONFIG_LOG_BACKEND_UART_BUFFER_SIZE);                                    \
                                                                                                    \
+	IF_ENABLED(CONFIG_LOG_BACKEND_UART_ASYNC_COALESCE,                                         \
+		   (static uint8_t lbu_coalesce_bufs##__VA_ARGS__[2][LBU_COALESCE_BUF_SIZE]        \
+			    NOCACHE_ATTR;))                                                        \
+                                                                                                   \
 	static struct lbu_data lbu_data##__VA_ARGS__ = {                                           \
 		.log_format_current = CONFIG_LOG_BACKEND_UART_OUTPUT_DEFAULT,                      \
+		IF_ENABLED(CONFIG_LOG_BACKEND_UART_ASYNC_COALESCE,                                 \
+			   (.tx_bufs = lbu_coalesce_bufs##__VA_ARGS__,))                           \
 	};                                                                                         \
                                                                                                    \
 	static const struct lbu_cb_ctx lbu_cb_ctx##__VA_ARGS__ = {                                 \
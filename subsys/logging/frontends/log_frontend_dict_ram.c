@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/logging/log_frontend.h>
+#include <zephyr/logging/log_internal.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/cbprintf.h>
+
+/* Frontend storing log messages as fixed size binary records in a RAM
+ * ring buffer, with no cbprintf packaging on the call site. The buffer
+ * is meant to be extracted with a debugger or from a RAM dump and
+ * decoded with the dictionary tooling, the format string address acts
+ * as the string identifier in the dictionary database.
+ */
+
+#define MAX_ARGS 4
+
+struct log_frontend_dict_ram_msg {
+	uint64_t timestamp;
+	uint32_t fmt;
+	uint16_t source_id;
+	uint8_t level;
+	uint8_t nargs;
+	uint32_t args[MAX_ARGS];
+};
+
+BUILD_ASSERT(sizeof(struct log_frontend_dict_ram_msg) == 32);
+
+#define MSG_COUNT \
+	(CONFIG_LOG_FRONTEND_DICT_RAM_BUFFER_SIZE / sizeof(struct log_frontend_dict_ram_msg))
+
+BUILD_ASSERT(MSG_COUNT > 0);
+
+/* Global so that the buffer and the counters can be located by name
+ * when extracting the data from the target.
+ */
+struct log_frontend_dict_ram_msg log_frontend_dict_ram_buf[MSG_COUNT];
+atomic_t log_frontend_dict_ram_wr_cnt;
+atomic_t log_frontend_dict_ram_dropped;
+
+static uint16_t get_source_id(const void *source)
+{
+	return (source != NULL) ? log_source_id(source) : 0U;
+}
+
+static void store(const void *source, uint32_t level, const char *fmt,
+		  const uint32_t *args, uint32_t nargs)
+{
+	atomic_val_t cnt = atomic_inc(&log_frontend_dict_ram_wr_cnt);
+	struct log_frontend_dict_ram_msg *msg =
+		&log_frontend_dict_ram_buf[(uint32_t)cnt % MSG_COUNT];
+
+	msg->timestamp = z_log_timestamp();
+	msg->fmt = (uint32_t)(uintptr_t)fmt;
+	msg->source_id = get_source_id(source);
+	msg->level = level;
+	msg->nargs = nargs;
+
+	for (uint32_t i = 0; i < nargs; i++) {
+		msg->args[i] = args[i];
+	}
+}
+
+void log_frontend_msg(const void *source,
+		      const struct log_msg_desc desc,
+		      uint8_t *package, const void *data)
+{
+	const union cbprintf_package_hdr *hdr =
+		(const union cbprintf_package_hdr *)package;
+	const uint32_t *words = (const uint32_t *)package;
+	uint32_t hdr_wlen = sizeof(union cbprintf_package_hdr) / sizeof(uint32_t);
+	uint32_t nargs;
+
+	/* Only messages whose arguments are plain words fit in the fixed
+	 * record. Packages carrying appended strings or hexdump data would
+	 * need to be walked, count them as dropped instead.
+	 */
+	if ((data != NULL) || (hdr->desc.str_cnt != 0U) ||
+	    (hdr->desc.ro_str_cnt != 0U) || (hdr->desc.rw_str_cnt != 0U) ||
+	    (hdr->desc.len > (hdr_wlen + 1U + MAX_ARGS))) {
+		atomic_inc(&log_frontend_dict_ram_dropped);
+		return;
+	}
+
+	nargs = hdr->desc.len - hdr_wlen - 1U;
+	store(source, desc.level, (const char *)(uintptr_t)words[hdr_wlen],
+	      &words[hdr_wlen + 1], nargs);
+}
+
+void log_frontend_simple_0(const void *source, uint32_t level, const char *fmt)
+{
+	store(source, level, fmt, NULL, 0);
+}
+
+void log_frontend_simple_1(const void *source, uint32_t level, const char *fmt, uint32_t arg)
+{
+	store(source, level, fmt, &arg, 1);
+}
+
+void log_frontend_simple_2(const void *source, uint32_t level,
+			   const char *fmt, uint32_t arg0, uint32_t arg1)
+{
+	uint32_t args[2] = {arg0, arg1};
+
+	store(source, level, fmt, args, 2);
+}
+
+void log_frontend_panic(void)
+{
+	/* All records already reside in RAM, nothing to flush. */
+}
+
+void log_frontend_init(void)
+{
+}
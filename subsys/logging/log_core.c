@@ -58,6 +58,19 @@ LOG_MODULE_REGISTER(log);
 #define CONFIG_LOG_BUFFER_SIZE 4
 #endif
 
+#ifndef CONFIG_LOG_USER_STAGING_POLL_MS
+#define CONFIG_LOG_USER_STAGING_POLL_MS 0
+#endif
+
+/* User mode threads stage messages without entering the kernel, so nothing
+ * wakes the processing thread up; poll the staging buffer when idle.
+ */
+#ifdef CONFIG_LOG_USER_STAGING
+#define LOG_PROCESS_IDLE_TIMEOUT K_MSEC(CONFIG_LOG_USER_STAGING_POLL_MS)
+#else
+#define LOG_PROCESS_IDLE_TIMEOUT K_FOREVER
+#endif
+
 #ifdef CONFIG_LOG_PROCESS_THREAD_CUSTOM_PRIORITY
 #define LOG_PROCESS_THREAD_PRIORITY CONFIG_LOG_PROCESS_THREAD_PRIORITY
 #else
@@ -132,16 +145,53 @@ static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT)
 static void z_log_notify_drop(const struct mpsc_pbuf_buffer *buffer,
 			      const union mpsc_pbuf_generic *item);
 
+#define LOG_MPSC_PBUF_FLAGS ((IS_ENABLED(CONFIG_LOG_MODE_OVERFLOW) ?	\
+			      MPSC_PBUF_MODE_OVERWRITE : 0) |		\
+			     (IS_ENABLED(CONFIG_LOG_MEM_UTILIZATION) ?	\
+			      MPSC_PBUF_MAX_UTILIZATION : 0))
+
 static const struct mpsc_pbuf_buffer_config mpsc_config = {
 	.buf = (uint32_t *)buf32,
 	.size = ARRAY_SIZE(buf32),
 	.notify_drop = z_log_notify_drop,
 	.get_wlen = log_msg_generic_get_wlen,
-	.flags = (IS_ENABLED(CONFIG_LOG_MODE_OVERFLOW) ?
-		  MPSC_PBUF_MODE_OVERWRITE : 0) |
-		 (IS_ENABLED(CONFIG_LOG_MEM_UTILIZATION) ?
-		  MPSC_PBUF_MAX_UTILIZATION : 0)
+	.flags = LOG_MPSC_PBUF_FLAGS
 };
+
+#ifdef CONFIG_LOG_PERCPU_BUFFER
+/* CPU 0 logs to log_buffer, every other CPU gets a buffer of its own so
+ * that heavy logging from parallel workers does not bounce the buffer
+ * header cache line between cores. Messages are claimed from all the
+ * buffers in timestamp order at processing time, reusing the machinery
+ * that merges the per-link buffers in the multi-domain setup.
+ */
+#define LOG_PERCPU_EXTRA_BUFS (CONFIG_MP_MAX_NUM_CPUS - 1)
+
+static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT)
+	percpu_buf32[LOG_PERCPU_EXTRA_BUFS][CONFIG_LOG_BUFFER_SIZE / sizeof(int)];
+
+#define LOG_PERCPU_PBUF_DEFINE(i, _)					\
+	static STRUCT_SECTION_ITERABLE_ALTERNATE(log_mpsc_pbuf,		\
+						 mpsc_pbuf_buffer,	\
+						 log_percpu_buffer##i);	\
+	static STRUCT_SECTION_ITERABLE(log_msg_ptr, log_percpu_msg_ptr##i)
+
+LISTIFY(LOG_PERCPU_EXTRA_BUFS, LOG_PERCPU_PBUF_DEFINE, (;));
+
+#define LOG_PERCPU_PBUF_CONFIG(i, _)					\
+	{								\
+		.buf = percpu_buf32[i],					\
+		.size = ARRAY_SIZE(percpu_buf32[i]),			\
+		.notify_drop = z_log_notify_drop,			\
+		.get_wlen = log_msg_generic_get_wlen,			\
+		.flags = LOG_MPSC_PBUF_FLAGS				\
+	}
+
+static const struct mpsc_pbuf_buffer_config
+	percpu_mpsc_config[LOG_PERCPU_EXTRA_BUFS] = {
+	LISTIFY(LOG_PERCPU_EXTRA_BUFS, LOG_PERCPU_PBUF_CONFIG, (,))
+};
+#endif /* CONFIG_LOG_PERCPU_BUFFER */
 #endif
 
 /* Check that default tag can fit in tag buffer. */
@@ -567,6 +617,10 @@ bool z_impl_log_process(void)
 		return false;
 	}
 
+	if (IS_ENABLED(CONFIG_LOG_USER_STAGING)) {
+		z_log_user_staging_drain();
+	}
+
 	msg = z_log_msg_claim(&backoff);
 
 	if (msg) {
@@ -653,7 +707,20 @@ void z_log_msg_init(void)
 #ifdef CONFIG_MPSC_PBUF
 	mpsc_pbuf_init(&log_buffer, &mpsc_config);
 	curr_log_buffer = &log_buffer;
+
+#ifdef CONFIG_LOG_PERCPU_BUFFER
+	for (int i = 0; i < LOG_PERCPU_EXTRA_BUFS; i++) {
+		struct log_mpsc_pbuf *buf;
+
+		STRUCT_SECTION_GET(log_mpsc_pbuf, i + 1, &buf);
+		mpsc_pbuf_init(&buf->buf, &percpu_mpsc_config[i]);
+	}
+#endif
 #endif
+
+	if (IS_ENABLED(CONFIG_LOG_USER_STAGING)) {
+		z_log_user_staging_init();
+	}
 }
 
 static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
@@ -669,9 +736,53 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 			: K_MSEC(CONFIG_LOG_BLOCK_IN_THREAD_TIMEOUT_MS));
 }
 
+#ifdef CONFIG_LOG_PERCPU_BUFFER
+static struct mpsc_pbuf_buffer *percpu_log_buffer(void)
+{
+	uint8_t cpu = arch_curr_cpu()->id;
+	struct log_mpsc_pbuf *buf;
+
+	if (cpu == 0U) {
+		return &log_buffer;
+	}
+
+	STRUCT_SECTION_GET(log_mpsc_pbuf, cpu, &buf);
+
+	return &buf->buf;
+}
+
+/* The thread may have migrated between allocation and commit, so find
+ * the buffer owning the message by its address.
+ */
+static struct mpsc_pbuf_buffer *msg_buffer(struct log_msg *msg)
+{
+	uint32_t *word = (uint32_t *)msg;
+	size_t len;
+
+	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
+
+	for (size_t i = 0; i < len; i++) {
+		struct log_mpsc_pbuf *buf;
+
+		STRUCT_SECTION_GET(log_mpsc_pbuf, i, &buf);
+
+		if ((word >= buf->buf.buf) &&
+		    (word < &buf->buf.buf[buf->buf.size])) {
+			return &buf->buf;
+		}
+	}
+
+	return &log_buffer;
+}
+#endif /* CONFIG_LOG_PERCPU_BUFFER */
+
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
+#ifdef CONFIG_LOG_PERCPU_BUFFER
+	return msg_alloc(percpu_log_buffer(), wlen);
+#else
 	return msg_alloc(&log_buffer, wlen);
+#endif
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -703,7 +814,11 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
+#ifdef CONFIG_LOG_PERCPU_BUFFER
+	msg_commit(msg_buffer(msg), msg);
+#else
 	msg_commit(&log_buffer, msg);
+#endif
 }
 
 union log_msg_generic *z_log_msg_local_claim(void)
@@ -790,7 +905,8 @@ union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	/* Use only one buffer if others are not registered. */
-	if (IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && len > 1) {
+	if ((IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) ||
+	     IS_ENABLED(CONFIG_LOG_PERCPU_BUFFER)) && len > 1) {
 		return z_log_msg_claim_oldest(backoff);
 	}
 
@@ -825,7 +941,8 @@ bool z_log_msg_pending(void)
 
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
-	if (!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) {
+	if ((!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) &&
+	     !IS_ENABLED(CONFIG_LOG_PERCPU_BUFFER)) || (len == 1)) {
 		return msg_pending(&log_buffer);
 	}
 
@@ -944,7 +1061,7 @@ static void log_process_thread_func(void *dummy1, void *dummy2, void *dummy3)
 	 * to poll backends for readiness. Period is set arbitrary.
 	 * If all backends are ready periodic wake up is not needed.
 	 */
-	k_timeout_t timeout = (activate_mask != 0) ? K_MSEC(50) : K_FOREVER;
+	k_timeout_t timeout = (activate_mask != 0) ? K_MSEC(50) : LOG_PROCESS_IDLE_TIMEOUT;
 	bool processed_any = false;
 	thread_set(k_current_get());
 
@@ -958,7 +1075,7 @@ static void log_process_thread_func(void *dummy1, void *dummy2, void *dummy3)
 				/* Periodic wake up no longer needed since all
 				 * backends are ready.
 				 */
-				timeout = K_FOREVER;
+				timeout = LOG_PROCESS_IDLE_TIMEOUT;
 			}
 		}
 
@@ -393,7 +393,11 @@ void z_log_msg_runtime_vcreate(uint8_t domain_id, const void *source,
 	}
 
 	if (IS_ENABLED(CONFIG_USERSPACE) && k_is_user_context()) {
-		z_log_msg_static_create(source, desc, pkg, data);
+		if (IS_ENABLED(CONFIG_LOG_USER_STAGING)) {
+			z_log_msg_user_stage(source, desc, pkg, data);
+		} else {
+			z_log_msg_static_create(source, desc, pkg, data);
+		}
 	} else {
 		if (IS_ENABLED(CONFIG_LOG_FRONTEND) &&
 		    frontend_runtime_filtering(source, desc.level)) {
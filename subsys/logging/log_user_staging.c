@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/kernel.h>
+#include <zephyr/app_memory/app_memdomain.h>
+#include <zephyr/logging/log_internal.h>
+#include <zephyr/logging/log_msg.h>
+#include <zephyr/sys/cbprintf.h>
+#include <zephyr/sys/spsc_pbuf.h>
+
+/* Staged record layout: header followed by the converted package and raw
+ * data. The package is re-aligned within the packet since spsc_pbuf only
+ * guarantees 2 byte alignment of packet payloads.
+ */
+struct log_user_staging_hdr {
+	struct log_msg_desc desc;
+	const void *source;
+};
+
+K_APPMEM_PARTITION_DEFINE(log_user_staging_partition);
+
+static K_APP_BMEM(log_user_staging_partition) uint32_t
+	staging_buf32[CONFIG_LOG_USER_STAGING_BUFFER_SIZE / sizeof(uint32_t)];
+static K_APP_BMEM(log_user_staging_partition) struct spsc_pbuf *staging_pbuf;
+static K_APP_BMEM(log_user_staging_partition) atomic_t staging_lock;
+static K_APP_BMEM(log_user_staging_partition) atomic_t staging_dropped;
+
+/* Consumer side state, never accessed from user mode. */
+static atomic_t drain_lock;
+
+void z_log_user_staging_init(void)
+{
+	staging_pbuf = spsc_pbuf_init(staging_buf32, sizeof(staging_buf32), 0);
+}
+
+void z_log_msg_user_stage(const void *source, const struct log_msg_desc desc,
+			  uint8_t *package, const void *data)
+{
+	/* Same conversion flags as z_impl_z_log_msg_static_create() so that
+	 * transient strings are copied out before the caller returns.
+	 */
+	uint32_t flags = CBPRINTF_PACKAGE_CONVERT_RW_STR |
+			 (IS_ENABLED(CONFIG_LOG_MSG_APPEND_RO_STRING_LOC) ?
+			 CBPRINTF_PACKAGE_CONVERT_KEEP_RO_STR : 0) |
+			 (IS_ENABLED(CONFIG_LOG_FMT_SECTION_STRIP) ?
+			 0 : CBPRINTF_PACKAGE_CONVERT_PTR_CHECK);
+	struct log_user_staging_hdr hdr = {
+		.desc = desc,
+		.source = source,
+	};
+	uint16_t strl[4];
+	int plen = 0;
+	size_t total;
+	uint8_t *pkg;
+	char *slot;
+	int alen;
+
+	if (desc.package_len > 0) {
+		plen = cbprintf_package_copy(package, desc.package_len,
+					     NULL, 0, flags,
+					     strl, ARRAY_SIZE(strl));
+	}
+
+	/* Reserve space for aligning the package within the packet. */
+	total = sizeof(hdr) + Z_LOG_MSG_ALIGNMENT + plen + desc.data_len;
+
+	if ((staging_pbuf == NULL) || (plen < 0) ||
+	    (plen > Z_LOG_MSG_MAX_PACKAGE) || (total > SPSC_PBUF_MAX_LEN)) {
+		z_log_msg_static_create(source, desc, package, data);
+		return;
+	}
+
+	/* The staging buffer has a single producer. A thread losing the race
+	 * takes the syscall path instead of spinning, as user mode cannot
+	 * mask preemption while holding the lock.
+	 */
+	if (!atomic_cas(&staging_lock, 0, 1)) {
+		z_log_msg_static_create(source, desc, package, data);
+		return;
+	}
+
+	alen = spsc_pbuf_alloc(staging_pbuf, total, &slot);
+	if (alen < (int)total) {
+		atomic_set(&staging_lock, 0);
+		atomic_inc(&staging_dropped);
+		return;
+	}
+
+	hdr.desc.package_len = plen;
+	memcpy(slot, &hdr, sizeof(hdr));
+
+	pkg = (uint8_t *)ROUND_UP((uintptr_t)slot + sizeof(hdr),
+				  Z_LOG_MSG_ALIGNMENT);
+	if (plen > 0) {
+		plen = cbprintf_package_copy(package, desc.package_len,
+					     pkg, plen, flags,
+					     strl, ARRAY_SIZE(strl));
+		__ASSERT_NO_MSG(plen >= 0);
+	}
+
+	if (data != NULL) {
+		memcpy(pkg + plen, data, desc.data_len);
+	}
+
+	spsc_pbuf_commit(staging_pbuf, total);
+	atomic_set(&staging_lock, 0);
+}
+
+void z_log_user_staging_drain(void)
+{
+	struct log_user_staging_hdr hdr;
+	uint32_t dropped;
+	uint16_t len;
+	char *buf;
+
+	if (staging_pbuf == NULL) {
+		return;
+	}
+
+	/* log_process() may be called from multiple threads while the
+	 * staging buffer has a single consumer.
+	 */
+	if (!atomic_cas(&drain_lock, 0, 1)) {
+		return;
+	}
+
+	while ((len = spsc_pbuf_claim(staging_pbuf, &buf)) > 0) {
+		const uint8_t *pkg;
+		struct log_msg *msg;
+
+		memcpy(&hdr, buf, sizeof(hdr));
+		pkg = (const uint8_t *)ROUND_UP((uintptr_t)buf + sizeof(hdr),
+						Z_LOG_MSG_ALIGNMENT);
+
+		msg = z_log_msg_alloc(log_msg_get_total_wlen(hdr.desc));
+		if (msg != NULL) {
+			memcpy(msg->data, pkg, hdr.desc.package_len);
+		}
+
+		/* Commit path timestamps the message at drain time. */
+		z_log_msg_finalize(msg, hdr.source, hdr.desc,
+				   hdr.desc.data_len > 0 ?
+				   pkg + hdr.desc.package_len : NULL);
+
+		spsc_pbuf_free(staging_pbuf, len);
+	}
+
+	dropped = (uint32_t)atomic_set(&staging_dropped, 0);
+	while (dropped > 0) {
+		z_log_dropped(false);
+		dropped--;
+	}
+
+	atomic_set(&drain_lock, 0);
+}
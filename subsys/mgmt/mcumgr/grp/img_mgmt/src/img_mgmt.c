@@ -392,6 +392,109 @@ img_mgmt_find_by_hash(uint8_t *find, struct image_version *ver)
 	return -1;
 }
 
+#if defined(CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW)
+/* Chunks that arrived ahead of the expected upload offset, stashed until the
+ * missing chunk arrives.
+ */
+struct img_mgmt_window_slot {
+	bool used;
+	size_t off;
+	size_t len;
+	uint8_t data[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_CHUNK_SIZE];
+};
+
+static struct img_mgmt_window_slot upload_window[CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_SIZE - 1];
+
+static void img_mgmt_window_reset(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(upload_window); i++) {
+		upload_window[i].used = false;
+	}
+}
+
+/**
+ * Stashes a chunk that arrived ahead of the expected upload offset so a
+ * pipelined client does not have to retransmit it. A chunk that cannot be
+ * stashed is silently dropped; the client retransmits it based on the
+ * acknowledged offset.
+ */
+static void img_mgmt_window_stash(const struct img_mgmt_upload_req *req)
+{
+	struct img_mgmt_window_slot *slot = NULL;
+
+	if (req->img_data.len == 0 ||
+	    req->img_data.len > CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_CHUNK_SIZE ||
+	    (req->off + req->img_data.len) > g_img_mgmt_state.size) {
+		return;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(upload_window); i++) {
+		/* Reclaim slots that fell behind the expected offset */
+		if (upload_window[i].used && upload_window[i].off < g_img_mgmt_state.off) {
+			upload_window[i].used = false;
+		}
+
+		/* Chunk is already stashed */
+		if (upload_window[i].used && upload_window[i].off == req->off) {
+			return;
+		}
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(upload_window); i++) {
+		if (!upload_window[i].used) {
+			slot = &upload_window[i];
+			break;
+		}
+	}
+
+	if (slot == NULL) {
+		return;
+	}
+
+	slot->off = req->off;
+	slot->len = req->img_data.len;
+	memcpy(slot->data, req->img_data.value, slot->len);
+	slot->used = true;
+}
+
+/**
+ * Writes out stashed chunks that have become contiguous with the current
+ * upload offset.
+ *
+ * @return 0 on success; nonzero on flash write failure.
+ */
+static int img_mgmt_window_drain(void)
+{
+	bool progress;
+	int rc;
+
+	do {
+		progress = false;
+
+		for (size_t i = 0; i < ARRAY_SIZE(upload_window); i++) {
+			struct img_mgmt_window_slot *slot = &upload_window[i];
+			bool last;
+
+			if (!slot->used || slot->off != g_img_mgmt_state.off) {
+				continue;
+			}
+
+			last = (slot->off + slot->len == g_img_mgmt_state.size);
+			rc = img_mgmt_write_image_data(slot->off, slot->data, slot->len, last);
+			slot->used = false;
+			if (rc != 0) {
+				return rc;
+			}
+
+			g_img_mgmt_state.off += slot->len;
+			progress = true;
+		}
+	} while (progress);
+
+	return 0;
+}
+#endif /* CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW */
+
 /*
  * Resets upload status to defaults (no upload in progress)
  */
@@ -404,6 +507,9 @@ static void img_mgmt_reset_upload(void)
 	img_mgmt_take_lock();
 	memset(&g_img_mgmt_state, 0, sizeof(g_img_mgmt_state));
 	g_img_mgmt_state.area_id = -1;
+#if defined(CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW)
+	img_mgmt_window_reset();
+#endif
 	img_mgmt_release_lock();
 }
 
@@ -799,10 +905,30 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 	}
 
 	if (!action.proceed) {
+#if defined(CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW)
+		/* Keep chunks ahead of the expected offset, a pipelined client
+		 * will not have to retransmit them.
+		 */
+		if (req.off != 0 && g_img_mgmt_state.area_id != -1 &&
+		    req.off > g_img_mgmt_state.off) {
+			img_mgmt_window_stash(&req);
+		}
+#endif
+
 		/* Request specifies incorrect offset.  Respond with a success code and
 		 * the correct offset.
 		 */
 		rc = img_mgmt_upload_good_rsp(ctxt);
+
+#if defined(CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW)
+		/* Advertise the upload window so capable clients can pipeline */
+		if (req.off == 0 && rc == MGMT_ERR_EOK) {
+			if (!(zcbor_tstr_put_lit(zse, "win") &&
+			      zcbor_uint32_put(zse, CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_SIZE))) {
+				rc = MGMT_ERR_EMSGSIZE;
+			}
+		}
+#endif
 		img_mgmt_release_lock();
 		return rc;
 	}
@@ -844,6 +970,10 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 
 		g_img_mgmt_state.off = 0;
 
+#if defined(CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW)
+		img_mgmt_window_reset();
+#endif
+
 #if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
 		(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_STARTED, NULL, 0, &err_rc,
 					   &err_group);
@@ -920,7 +1050,19 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 						    last);
 		if (rc == 0) {
 			g_img_mgmt_state.off += action.write_bytes;
-		} else {
+
+#if defined(CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW)
+			/* Write out stashed chunks that are now contiguous with
+			 * the upload offset.
+			 */
+			rc = img_mgmt_window_drain();
+			if (rc == 0 && g_img_mgmt_state.off == g_img_mgmt_state.size) {
+				last = true;
+			}
+#endif
+		}
+
+		if (rc != 0) {
 			/* Write failed, currently not able to recover from this */
 #if defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 			cmd_status_arg.status = IMG_MGMT_ID_UPLOAD_STATUS_COMPLETE;
@@ -990,6 +1132,14 @@ end:
 	} else {
 		rc = img_mgmt_upload_good_rsp(ctxt);
 
+#if defined(CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW)
+		/* Advertise the upload window so capable clients can pipeline */
+		if (req.off == 0 && rc == MGMT_ERR_EOK) {
+			ok = ok && zcbor_tstr_put_lit(zse, "win")	&&
+			     zcbor_uint32_put(zse, CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW_SIZE);
+		}
+#endif
+
 #ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
 		if (last && rc == MGMT_ERR_EOK) {
 			/* Append status to last packet */
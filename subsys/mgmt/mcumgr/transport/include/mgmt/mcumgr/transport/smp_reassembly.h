@@ -44,7 +44,9 @@ void smp_reassembly_init(struct smp_transport *smpt);
  *		and no more fragments are expected;
  *		-ENOSR if a packet length, read from header, is bigger than
  *              CONFIG_MCUMGR_TRANSPORT_NETBUF_SIZE, which means there is no way to fit it in
- *              the configured buffer;
+ *              the configured buffer; with CONFIG_MCUMGR_TRANSPORT_REASSEMBLY_ARENA such
+ *              packets are collected into the arena instead and -ENOSR is only returned when
+ *              they do not fit CONFIG_MCUMGR_TRANSPORT_REASSEMBLY_ARENA_SIZE either;
  *		-EOVERFLOW if attempting to add a fragment that would make complete packet larger
  *		than expected;
  *		-ENOMEM if failed to allocate a new buffer for packet assembly;
@@ -15,6 +15,34 @@
 
 #define MCUMGR_TRANSPORT_NETBUF_SIZE CONFIG_MCUMGR_TRANSPORT_NETBUF_SIZE
 
+#if defined(CONFIG_MCUMGR_TRANSPORT_REASSEMBLY_ARENA)
+/*
+ * Packets too large for a regular mcumgr buffer land directly in this
+ * contiguous arena. The wrapping net_buf comes from a single-buffer pool,
+ * so the pool allocation arbitrates concurrent claims from different
+ * transports and releasing the packet returns the arena automatically.
+ */
+static uint8_t reassembly_arena[CONFIG_MCUMGR_TRANSPORT_REASSEMBLY_ARENA_SIZE];
+
+NET_BUF_POOL_FIXED_DEFINE(smp_reassembly_arena_pool, 1, 0,
+			  CONFIG_MCUMGR_TRANSPORT_NETBUF_USER_DATA_SIZE, NULL);
+
+static struct net_buf *arena_packet_alloc(void)
+{
+	struct net_buf *nb;
+
+	nb = net_buf_alloc_with_data(&smp_reassembly_arena_pool,
+				     reassembly_arena,
+				     sizeof(reassembly_arena), K_NO_WAIT);
+	if (nb != NULL) {
+		/* The arena gets attached at full length; restart it empty. */
+		net_buf_reset(nb);
+	}
+
+	return nb;
+}
+#endif /* CONFIG_MCUMGR_TRANSPORT_REASSEMBLY_ARENA */
+
 void smp_reassembly_init(struct smp_transport *smpt)
 {
 	smpt->__reassembly.current = NULL;
@@ -47,6 +75,21 @@ int smp_reassembly_collect(struct smp_transport *smpt, const void *buf, uint16_t
 			 */
 			expected += sizeof(struct smp_hdr);
 
+#if defined(CONFIG_MCUMGR_TRANSPORT_REASSEMBLY_ARENA)
+			if (len > expected) {
+				return -EOVERFLOW;
+			}
+
+			if (expected > MCUMGR_TRANSPORT_NETBUF_SIZE) {
+				if (expected > sizeof(reassembly_arena)) {
+					return -ENOSR;
+				}
+
+				smpt->__reassembly.current = arena_packet_alloc();
+			} else {
+				smpt->__reassembly.current = smp_packet_alloc();
+			}
+#else
 			/* Joining net_bufs not supported yet */
 			if (len > MCUMGR_TRANSPORT_NETBUF_SIZE ||
 			    expected > MCUMGR_TRANSPORT_NETBUF_SIZE) {
@@ -58,6 +101,7 @@ int smp_reassembly_collect(struct smp_transport *smpt, const void *buf, uint16_t
 			}
 
 			smpt->__reassembly.current = smp_packet_alloc();
+#endif /* CONFIG_MCUMGR_TRANSPORT_REASSEMBLY_ARENA */
 			if (smpt->__reassembly.current != NULL) {
 				smpt->__reassembly.expected = expected;
 			} else {
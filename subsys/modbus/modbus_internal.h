@@ -79,8 +79,13 @@ struct modbus_serial_config {
 	struct gpio_dt_spec *de;
 	/* Pointer to receiver enable (nRE) pin config */
 	struct gpio_dt_spec *re;
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+	/* True if reception is enabled */
+	bool rx_enabled;
+#else
 	/* RTU timer to detect frame end point */
 	struct k_timer rtu_timer;
+#endif
 	/* Number of bytes received or to send */
 	uint16_t uart_buf_ctr;
 	/* Storage of received characters or characters to send */
@@ -29,6 +29,65 @@ LOG_MODULE_REGISTER(modbus_serial, CONFIG_MODBUS_LOG_LEVEL);
 #include <zephyr/sys/crc.h>
 #include <modbus_internal.h>
 
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+static void modbus_serial_tx_on(struct modbus_context *ctx)
+{
+	struct modbus_serial_config *cfg = ctx->cfg;
+	int err;
+
+	if (cfg->de != NULL) {
+		gpio_pin_set(cfg->de->port, cfg->de->pin, 1);
+	}
+
+	err = uart_tx(cfg->dev, cfg->uart_buf, cfg->uart_buf_ctr,
+		      SYS_FOREVER_US);
+	if (err != 0) {
+		LOG_ERR("Failed to start frame transmission (err %d)", err);
+	}
+}
+
+static void modbus_serial_tx_off(struct modbus_context *ctx)
+{
+	struct modbus_serial_config *cfg = ctx->cfg;
+
+	(void)uart_tx_abort(cfg->dev);
+	if (cfg->de != NULL) {
+		gpio_pin_set(cfg->de->port, cfg->de->pin, 0);
+	}
+}
+
+static void modbus_serial_rx_on(struct modbus_context *ctx)
+{
+	struct modbus_serial_config *cfg = ctx->cfg;
+	int err;
+
+	if (cfg->re != NULL) {
+		gpio_pin_set(cfg->re->port, cfg->re->pin, 1);
+	}
+
+	cfg->uart_buf_ctr = 0;
+	cfg->uart_buf_ptr = &cfg->uart_buf[0];
+	cfg->rx_enabled = true;
+
+	/* The receiver idle timeout acts as the t3.5 frame delimiter */
+	err = uart_rx_enable(cfg->dev, cfg->uart_buf, sizeof(cfg->uart_buf),
+			     cfg->rtu_timeout);
+	if (err != 0 && err != -EBUSY) {
+		LOG_ERR("Failed to enable reception (err %d)", err);
+	}
+}
+
+static void modbus_serial_rx_off(struct modbus_context *ctx)
+{
+	struct modbus_serial_config *cfg = ctx->cfg;
+
+	cfg->rx_enabled = false;
+	(void)uart_rx_disable(cfg->dev);
+	if (cfg->re != NULL) {
+		gpio_pin_set(cfg->re->port, cfg->re->pin, 0);
+	}
+}
+#else /* CONFIG_MODBUS_SERIAL_ASYNC */
 static void modbus_serial_tx_on(struct modbus_context *ctx)
 {
 	struct modbus_serial_config *cfg = ctx->cfg;
@@ -70,6 +129,7 @@ static void modbus_serial_rx_off(struct modbus_context *ctx)
 		gpio_pin_set(cfg->re->port, cfg->re->pin, 0);
 	}
 }
+#endif /* CONFIG_MODBUS_SERIAL_ASYNC */
 
 #ifdef CONFIG_MODBUS_ASCII_MODE
 /* The function calculates an 8-bit Longitudinal Redundancy Check. */
@@ -304,6 +364,41 @@ static void rtu_tx_adu(struct modbus_context *ctx)
 	modbus_serial_tx_on(ctx);
 }
 
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+static void uart_async_cb(const struct device *dev, struct uart_event *evt,
+			  void *user_data)
+{
+	struct modbus_context *ctx = (struct modbus_context *)user_data;
+	struct modbus_serial_config *cfg = ctx->cfg;
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+		if (cfg->de != NULL) {
+			gpio_pin_set(cfg->de->port, cfg->de->pin, 0);
+		}
+
+		modbus_serial_rx_on(ctx);
+		break;
+	case UART_TX_ABORTED:
+		if (cfg->de != NULL) {
+			gpio_pin_set(cfg->de->port, cfg->de->pin, 0);
+		}
+
+		break;
+	case UART_RX_RDY:
+		/* The receiver went idle for the frame timeout or the buffer
+		 * is full, the frame is complete. Stop reception until the
+		 * frame has been processed.
+		 */
+		cfg->uart_buf_ctr += evt->data.rx.len;
+		(void)uart_rx_disable(cfg->dev);
+		k_work_submit(&ctx->server_work);
+		break;
+	default:
+		break;
+	}
+}
+#else /* CONFIG_MODBUS_SERIAL_ASYNC */
 /*
  * A byte has been received from a serial port. We just store it in the buffer
  * for processing when a complete packet has been received.
@@ -418,6 +513,7 @@ static void rtu_tmr_handler(struct k_timer *t_id)
 
 	k_work_submit(&ctx->server_work);
 }
+#endif /* CONFIG_MODBUS_SERIAL_ASYNC */
 
 static int configure_gpio(struct modbus_context *ctx)
 {
@@ -533,6 +629,13 @@ int modbus_serial_rx_adu(struct modbus_context *ctx)
 	cfg->uart_buf_ctr = 0;
 	cfg->uart_buf_ptr = &cfg->uart_buf[0];
 
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+	if (cfg->rx_enabled) {
+		/* Re-arm reception from the start of the buffer */
+		modbus_serial_rx_on(ctx);
+	}
+#endif
+
 	return rc;
 }
 
@@ -596,6 +699,12 @@ int modbus_serial_init(struct modbus_context *ctx,
 	cfg->uart_buf_ctr = 0;
 	cfg->uart_buf_ptr = &cfg->uart_buf[0];
 
+#ifdef CONFIG_MODBUS_SERIAL_ASYNC
+	err = uart_callback_set(cfg->dev, uart_async_cb, ctx);
+	if (err != 0) {
+		return err;
+	}
+#else
 	err = uart_irq_callback_user_data_set(cfg->dev, uart_cb_handler, ctx);
 	if (err != 0) {
 		return err;
@@ -603,6 +712,7 @@ int modbus_serial_init(struct modbus_context *ctx,
 
 	k_timer_init(&cfg->rtu_timer, rtu_tmr_handler, NULL);
 	k_timer_user_data_set(&cfg->rtu_timer, ctx);
+#endif
 
 	modbus_serial_rx_on(ctx);
 	LOG_INF("RTU timeout %u us", cfg->rtu_timeout);
@@ -614,5 +724,7 @@ void modbus_serial_disable(struct modbus_context *ctx)
 {
 	modbus_serial_tx_off(ctx);
 	modbus_serial_rx_off(ctx);
+#ifndef CONFIG_MODBUS_SERIAL_ASYNC
 	k_timer_stop(&ctx->cfg->rtu_timer);
+#endif
 }
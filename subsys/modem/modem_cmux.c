@@ -910,6 +910,58 @@ static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t by
 	}
 }
 
+static void modem_cmux_process_received_chunk(struct modem_cmux *cmux, const uint8_t *buf,
+					      size_t len)
+{
+	while (len > 0) {
+		size_t consumed;
+
+		switch (cmux->receive_state) {
+		case MODEM_CMUX_RECEIVE_STATE_SOF: {
+			/* Skip to the next flag in one step */
+			const uint8_t *flag = memchr(buf, 0xF9, len);
+
+			if (flag == NULL) {
+				return;
+			}
+
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_RESYNC;
+			consumed = (size_t)(flag - buf) + 1;
+			break;
+		}
+
+		case MODEM_CMUX_RECEIVE_STATE_DATA:
+			/* Consume the longest possible span of frame data at once */
+			consumed = MIN(len, (size_t)(cmux->frame.data_len - cmux->receive_buf_len));
+
+			if (cmux->receive_buf_len < cmux->receive_buf_size) {
+				memcpy(&cmux->receive_buf[cmux->receive_buf_len], buf,
+				       MIN(consumed,
+					   (size_t)(cmux->receive_buf_size -
+						    cmux->receive_buf_len)));
+			}
+
+			cmux->receive_buf_len += consumed;
+
+			/* Check if datalen reached */
+			if (cmux->frame.data_len == cmux->receive_buf_len) {
+				/* Await FCS */
+				cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_FCS;
+			}
+
+			break;
+
+		default:
+			modem_cmux_process_received_byte(cmux, buf[0]);
+			consumed = 1;
+			break;
+		}
+
+		buf += consumed;
+		len -= consumed;
+	}
+}
+
 static void modem_cmux_receive_handler(struct k_work *item)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(item);
@@ -926,9 +978,7 @@ static void modem_cmux_receive_handler(struct k_work *item)
 	}
 
 	/* Process received data */
-	for (int i = 0; i < ret; i++) {
-		modem_cmux_process_received_byte(cmux, cmux->work_buf[i]);
-	}
+	modem_cmux_process_received_chunk(cmux, cmux->work_buf, (size_t)ret);
 
 	/* Reschedule received work */
 	k_work_schedule(&cmux->receive_work, K_NO_WAIT);
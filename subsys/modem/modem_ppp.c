@@ -19,16 +19,6 @@ LOG_MODULE_REGISTER(modem_ppp, CONFIG_MODEM_MODULES_LOG_LEVEL);
 #define MODEM_PPP_CODE_ESCAPE		(0x7D)
 #define MODEM_PPP_VALUE_ESCAPE		(0x20)
 
-static uint16_t modem_ppp_fcs_init(uint8_t byte)
-{
-	return crc16_ccitt(0xFFFF, &byte, 1);
-}
-
-static uint16_t modem_ppp_fcs_update(uint16_t fcs, uint8_t byte)
-{
-	return crc16_ccitt(fcs, &byte, 1);
-}
-
 static uint16_t modem_ppp_fcs_final(uint16_t fcs)
 {
 	return fcs ^ 0xFFFF;
@@ -48,6 +38,31 @@ static uint16_t modem_ppp_ppp_protocol(struct net_pkt *pkt)
 	return 0;
 }
 
+/* Compute the FCS over the unescaped frame (address, control, protocol if it
+ * is prepended while wrapping, and data) span by span instead of a byte at a
+ * time while escaping.
+ */
+static uint16_t modem_ppp_fcs_net_pkt(struct modem_ppp *ppp)
+{
+	uint8_t header[4] = {0xFF, 0x03};
+	size_t header_len = 2;
+	uint16_t fcs;
+
+	if (net_pkt_is_ppp(ppp->tx_pkt) == false) {
+		header[2] = (ppp->tx_pkt_protocol >> 8) & 0xFF;
+		header[3] = ppp->tx_pkt_protocol & 0xFF;
+		header_len = 4;
+	}
+
+	fcs = crc16_ccitt(0xFFFF, header, header_len);
+
+	for (struct net_buf *buf = ppp->tx_pkt->buffer; buf != NULL; buf = buf->frags) {
+		fcs = crc16_ccitt(fcs, buf->data, buf->len);
+	}
+
+	return fcs;
+}
+
 static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 {
 	uint8_t byte;
@@ -64,12 +79,16 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 
 	case MODEM_PPP_TRANSMIT_STATE_HDR_FF:
 		net_pkt_cursor_init(ppp->tx_pkt);
-		ppp->tx_pkt_fcs = modem_ppp_fcs_init(0xFF);
+
+		if (net_pkt_is_ppp(ppp->tx_pkt) == false) {
+			ppp->tx_pkt_protocol = modem_ppp_ppp_protocol(ppp->tx_pkt);
+		}
+
+		ppp->tx_pkt_fcs = modem_ppp_fcs_net_pkt(ppp);
 		ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_HDR_7D;
 		return 0xFF;
 
 	case MODEM_PPP_TRANSMIT_STATE_HDR_7D:
-		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, 0x03);
 		ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_HDR_23;
 		return MODEM_PPP_CODE_ESCAPE;
 
@@ -77,7 +96,6 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		if (net_pkt_is_ppp(ppp->tx_pkt) == true) {
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_DATA;
 		} else {
-			ppp->tx_pkt_protocol = modem_ppp_ppp_protocol(ppp->tx_pkt);
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_PROTOCOL_HIGH;
 		}
 
@@ -86,7 +104,6 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 	/* Writing protocol */
 	case MODEM_PPP_TRANSMIT_STATE_PROTOCOL_HIGH:
 		byte = (ppp->tx_pkt_protocol >> 8) & 0xFF;
-		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
 		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
 		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
@@ -104,7 +121,6 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 
 	case MODEM_PPP_TRANSMIT_STATE_PROTOCOL_LOW:
 		byte = ppp->tx_pkt_protocol & 0xFF;
-		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
 		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
 		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
@@ -123,7 +139,6 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 	/* Writing data */
 	case MODEM_PPP_TRANSMIT_STATE_DATA:
 		(void)net_pkt_read_u8(ppp->tx_pkt, &byte);
-		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
 		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
 		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
@@ -201,6 +216,17 @@ static bool modem_ppp_is_byte_expected(uint8_t byte, uint8_t expected_byte)
 	return false;
 }
 
+static void modem_ppp_drop_rx_pkt(struct modem_ppp *ppp)
+{
+	LOG_WRN("Dropped PPP frame");
+	net_pkt_unref(ppp->rx_pkt);
+	ppp->rx_pkt = NULL;
+	ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
+#if defined(CONFIG_NET_STATISTICS_PPP)
+	ppp->stats.drop++;
+#endif
+}
+
 static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 {
 	switch (ppp->receive_state) {
@@ -285,26 +311,14 @@ static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 		}
 
 		if (net_pkt_write_u8(ppp->rx_pkt, byte) < 0) {
-			LOG_WRN("Dropped PPP frame");
-			net_pkt_unref(ppp->rx_pkt);
-			ppp->rx_pkt = NULL;
-			ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
-#if defined(CONFIG_NET_STATISTICS_PPP)
-			ppp->stats.drop++;
-#endif
+			modem_ppp_drop_rx_pkt(ppp);
 		}
 
 		break;
 
 	case MODEM_PPP_RECEIVE_STATE_UNESCAPING:
 		if (net_pkt_write_u8(ppp->rx_pkt, (byte ^ MODEM_PPP_VALUE_ESCAPE)) < 0) {
-			LOG_WRN("Dropped PPP frame");
-			net_pkt_unref(ppp->rx_pkt);
-			ppp->rx_pkt = NULL;
-			ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
-#if defined(CONFIG_NET_STATISTICS_PPP)
-			ppp->stats.drop++;
-#endif
+			modem_ppp_drop_rx_pkt(ppp);
 			break;
 		}
 
@@ -313,6 +327,92 @@ static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 	}
 }
 
+/* Write a span of unescaped frame data, growing the packet as needed */
+static int modem_ppp_write_to_rx_pkt(struct modem_ppp *ppp, const uint8_t *buf, size_t len)
+{
+	while (len > 0) {
+		size_t available = net_pkt_available_buffer(ppp->rx_pkt);
+		size_t chunk;
+
+		if (available <= 1) {
+			if (net_pkt_alloc_buffer(ppp->rx_pkt, CONFIG_MODEM_PPP_NET_BUF_FRAG_SIZE,
+						 AF_INET, K_NO_WAIT) < 0) {
+				return -ENOMEM;
+			}
+
+			available = net_pkt_available_buffer(ppp->rx_pkt);
+			if (available == 0) {
+				return -ENOMEM;
+			}
+		}
+
+		chunk = MIN(len, available);
+		if (net_pkt_write(ppp->rx_pkt, buf, chunk) < 0) {
+			return -ENOMEM;
+		}
+
+		buf += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+static void modem_ppp_process_received_chunk(struct modem_ppp *ppp, const uint8_t *buf, size_t len)
+{
+	while (len > 0) {
+		size_t consumed;
+
+		switch (ppp->receive_state) {
+		case MODEM_PPP_RECEIVE_STATE_HDR_SOF: {
+			/* Resynchronize on the next delimiter in one step */
+			const uint8_t *sof = memchr(buf, MODEM_PPP_CODE_DELIMITER, len);
+
+			if (sof == NULL) {
+				LOG_DBG("Dropped %zu bytes while looking for delimiter", len);
+				return;
+			}
+
+			ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_FF;
+			consumed = (size_t)(sof - buf) + 1;
+			break;
+		}
+
+		case MODEM_PPP_RECEIVE_STATE_WRITING: {
+			/* Find the next byte requiring special handling */
+			const uint8_t *delim = memchr(buf, MODEM_PPP_CODE_DELIMITER, len);
+			const uint8_t *escape = memchr(buf, MODEM_PPP_CODE_ESCAPE, len);
+			const uint8_t *special = (delim == NULL) ? escape :
+						 ((escape == NULL) ? delim : MIN(delim, escape));
+			size_t span = (special == NULL) ? len : (size_t)(special - buf);
+
+			if (span == 0) {
+				/* Delimiter or escape, handled by the state machine */
+				modem_ppp_process_received_byte(ppp, buf[0]);
+				consumed = 1;
+				break;
+			}
+
+			/* Write the whole clean span at once */
+			if (modem_ppp_write_to_rx_pkt(ppp, buf, span) < 0) {
+				modem_ppp_drop_rx_pkt(ppp);
+			}
+
+			consumed = span;
+			break;
+		}
+
+		default:
+			modem_ppp_process_received_byte(ppp, buf[0]);
+			consumed = 1;
+			break;
+		}
+
+		buf += consumed;
+		len -= consumed;
+	}
+}
+
 #if CONFIG_MODEM_STATS
 static uint32_t get_transmit_buf_length(struct modem_ppp *ppp)
 {
@@ -420,9 +520,7 @@ static void modem_ppp_process_handler(struct k_work *item)
 	advertise_receive_buf_stats(ppp, ret);
 #endif
 
-	for (int i = 0; i < ret; i++) {
-		modem_ppp_process_received_byte(ppp, ppp->receive_buf[i]);
-	}
+	modem_ppp_process_received_chunk(ppp, ppp->receive_buf, (size_t)ret);
 
 	k_work_submit(&ppp->process_work);
 }
@@ -277,6 +277,15 @@ static void conn_mgr_mon_thread_fn(void *p1, void *p2, void *p3)
 		/* Wait for changes */
 		k_sem_take(&conn_mgr_mon_updated, K_FOREVER);
 
+		if (CONFIG_NET_CONNECTION_MANAGER_EVENT_SETTLE_TIME_MS > 0) {
+			/* Let the event burst settle so that all state changes
+			 * are evaluated in a single pass, then consume any
+			 * pending wakeup the burst produced.
+			 */
+			k_sleep(K_MSEC(CONFIG_NET_CONNECTION_MANAGER_EVENT_SETTLE_TIME_MS));
+			(void)k_sem_take(&conn_mgr_mon_updated, K_NO_WAIT);
+		}
+
 		/* Respond to changes */
 		conn_mgr_mon_handle_update();
 	}
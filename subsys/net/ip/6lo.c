@@ -115,6 +115,150 @@ static int get_ihpc_inlined_size(uint16_t iphc)
 	return size;
 }
 
+#if defined(CONFIG_NET_6LO_FLOW_CACHE)
+/* Precomputed IPHC rewrite templates for recently compressed flows.
+ *
+ * The first packet of a flow runs the full IPHC decision tree and the
+ * resulting compressed header is recorded together with the uncompressed
+ * header and the link layer addresses it was derived from. Subsequent
+ * packets whose headers only differ in the fields IPHC elides anyway
+ * (IPv6 payload length, UDP length) or carries verbatim (UDP checksum)
+ * are rewritten by copying the template and patching the checksum,
+ * skipping the decision tree entirely.
+ */
+struct net_6lo_flow {
+	struct net_if *iface;
+	uint8_t ll_src[NET_LINK_ADDR_MAX_LENGTH];
+	uint8_t ll_dst[NET_LINK_ADDR_MAX_LENGTH];
+	uint8_t ll_src_len;
+	uint8_t ll_dst_len;
+	uint8_t hdr[NET_IPV6UDPH_LEN];  /* Uncompressed header */
+	uint8_t tmpl[NET_IPV6UDPH_LEN]; /* Compressed replacement */
+	uint8_t hdr_len;
+	uint8_t tmpl_len;
+	bool is_used;
+};
+
+static struct net_6lo_flow flow_cache[CONFIG_NET_6LO_FLOW_CACHE_COUNT];
+static uint8_t flow_cache_next;
+
+static void flow_cache_flush(void)
+{
+	ARRAY_FOR_EACH(flow_cache, i) {
+		flow_cache[i].is_used = false;
+	}
+}
+
+static bool flow_cache_hdr_match(const struct net_6lo_flow *flow,
+				 const uint8_t *hdr, uint8_t hdr_len)
+{
+	/* Skip the IPv6 payload length (offsets 4-5) and, for UDP, the UDP
+	 * length and checksum (offsets 44-47). They are either elided by
+	 * IPHC or patched into the template separately.
+	 */
+	if (flow->hdr_len != hdr_len) {
+		return false;
+	}
+
+	if (memcmp(flow->hdr, hdr, 4) != 0 ||
+	    memcmp(&flow->hdr[6], &hdr[6], NET_IPV6H_LEN - 6) != 0) {
+		return false;
+	}
+
+	if (hdr_len == NET_IPV6UDPH_LEN &&
+	    memcmp(&flow->hdr[NET_IPV6H_LEN], &hdr[NET_IPV6H_LEN], 4) != 0) {
+		return false;
+	}
+
+	return true;
+}
+
+static struct net_6lo_flow *flow_cache_lookup(struct net_pkt *pkt,
+					      uint8_t hdr_len)
+{
+	struct net_linkaddr *ll_src = net_pkt_lladdr_src(pkt);
+	struct net_linkaddr *ll_dst = net_pkt_lladdr_dst(pkt);
+
+	ARRAY_FOR_EACH(flow_cache, i) {
+		struct net_6lo_flow *flow = &flow_cache[i];
+
+		if (flow->is_used &&
+		    flow->iface == net_pkt_iface(pkt) &&
+		    flow->ll_src_len == ll_src->len &&
+		    flow->ll_dst_len == ll_dst->len &&
+		    memcmp(flow->ll_src, ll_src->addr, ll_src->len) == 0 &&
+		    memcmp(flow->ll_dst, ll_dst->addr, ll_dst->len) == 0 &&
+		    flow_cache_hdr_match(flow, pkt->buffer->data, hdr_len)) {
+			return flow;
+		}
+	}
+
+	return NULL;
+}
+
+static int flow_cache_apply(struct net_pkt *pkt, uint8_t hdr_len)
+{
+	struct net_6lo_flow *flow = flow_cache_lookup(pkt, hdr_len);
+	uint16_t chksum = 0U;
+	uint8_t compressed;
+
+	if (!flow) {
+		return -ENOENT;
+	}
+
+	if (hdr_len == NET_IPV6UDPH_LEN) {
+		struct net_udp_hdr *udp =
+			(struct net_udp_hdr *)(pkt->buffer->data +
+					       NET_IPV6H_LEN);
+
+		chksum = udp->chksum;
+	}
+
+	compressed = hdr_len - flow->tmpl_len;
+	memcpy(pkt->buffer->data + compressed, flow->tmpl, flow->tmpl_len);
+
+	if (hdr_len == NET_IPV6UDPH_LEN) {
+		/* The UDP checksum is always the trailing inline field */
+		memcpy(pkt->buffer->data + hdr_len - sizeof(chksum),
+		       &chksum, sizeof(chksum));
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_pull(pkt, compressed);
+	net_pkt_compact(pkt);
+
+	return compressed;
+}
+
+static void flow_cache_store(struct net_pkt *pkt, const uint8_t *hdr,
+			     uint8_t hdr_len, const uint8_t *tmpl,
+			     uint8_t tmpl_len)
+{
+	struct net_linkaddr *ll_src = net_pkt_lladdr_src(pkt);
+	struct net_linkaddr *ll_dst = net_pkt_lladdr_dst(pkt);
+	struct net_6lo_flow *flow;
+
+	if (ll_src->len > sizeof(flow->ll_src) ||
+	    ll_dst->len > sizeof(flow->ll_dst)) {
+		return;
+	}
+
+	flow = &flow_cache[flow_cache_next];
+	flow_cache_next = (flow_cache_next + 1) % ARRAY_SIZE(flow_cache);
+
+	flow->iface = net_pkt_iface(pkt);
+	flow->ll_src_len = ll_src->len;
+	flow->ll_dst_len = ll_dst->len;
+	memcpy(flow->ll_src, ll_src->addr, ll_src->len);
+	memcpy(flow->ll_dst, ll_dst->addr, ll_dst->len);
+	memcpy(flow->hdr, hdr, hdr_len);
+	memcpy(flow->tmpl, tmpl, tmpl_len);
+	flow->hdr_len = hdr_len;
+	flow->tmpl_len = tmpl_len;
+	flow->is_used = true;
+}
+#endif /* CONFIG_NET_6LO_FLOW_CACHE */
+
 /* TODO: Unicast-Prefix based IPv6 Multicast(dst) address compression
  *       Mesh header compression
  */
@@ -170,6 +314,11 @@ static inline void set_6lo_context(struct net_if *iface, uint8_t index,
 	ctx_6co[index].cid = get_6co_cid(context);
 
 	net_ipv6_addr_copy_raw((uint8_t *)&ctx_6co[index].prefix, context->prefix);
+
+#if defined(CONFIG_NET_6LO_FLOW_CACHE)
+	/* Cached templates may rely on the old context information */
+	flow_cache_flush();
+#endif
 }
 
 void net_6lo_set_context(struct net_if *iface,
@@ -192,6 +341,9 @@ void net_6lo_set_context(struct net_if *iface,
 			/* Remove if lifetime is zero */
 			if (!context->lifetime) {
 				ctx_6co[i].is_used = false;
+#if defined(CONFIG_NET_6LO_FLOW_CACHE)
+				flow_cache_flush();
+#endif
 				return;
 			}
 
@@ -730,6 +882,11 @@ static inline int compress_IPHC_header(struct net_pkt *pkt)
 	struct net_ipv6_hdr *ipv6 = NET_IPV6_HDR(pkt);
 	struct net_udp_hdr *udp;
 	uint8_t *inline_pos;
+#if defined(CONFIG_NET_6LO_FLOW_CACHE)
+	uint8_t hdr_copy[NET_IPV6UDPH_LEN];
+	uint8_t hdr_len;
+	int ret;
+#endif
 
 	if (pkt->frags->len < NET_IPV6H_LEN) {
 		NET_ERR("Invalid length %d, min %d",
@@ -744,6 +901,21 @@ static inline int compress_IPHC_header(struct net_pkt *pkt)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_NET_6LO_FLOW_CACHE)
+	hdr_len = (ipv6->nexthdr == IPPROTO_UDP) ? NET_IPV6UDPH_LEN :
+						   NET_IPV6H_LEN;
+
+	ret = flow_cache_apply(pkt, hdr_len);
+	if (ret >= 0) {
+		return ret;
+	}
+
+	/* The in-place compression below consumes the header, keep a copy
+	 * for the cache entry recorded on the way out.
+	 */
+	memcpy(hdr_copy, pkt->buffer->data, hdr_len);
+#endif
+
 	inline_pos = pkt->buffer->data + NET_IPV6H_LEN;
 
 	if (ipv6->nexthdr == IPPROTO_UDP) {
@@ -826,6 +998,11 @@ sa_end:
 
 	compressed = inline_pos - pkt->buffer->data;
 
+#if defined(CONFIG_NET_6LO_FLOW_CACHE)
+	flow_cache_store(pkt, hdr_copy, hdr_len, inline_pos,
+			 hdr_len - compressed);
+#endif
+
 	net_pkt_cursor_init(pkt);
 	net_pkt_pull(pkt, compressed);
 	net_pkt_compact(pkt);
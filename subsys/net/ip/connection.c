@@ -18,6 +18,9 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #include <errno.h>
 #include <zephyr/sys/util.h>
+#if defined(CONFIG_NET_CONN_HASH)
+#include <zephyr/sys/hash_function.h>
+#endif
 
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
@@ -113,6 +116,110 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#if defined(CONFIG_NET_CONN_HASH)
+/* Exact-match index for fully specified connections. Incoming unicast
+ * packets are looked up here first; wildcard listeners are left to the
+ * linear scan over conn_used. All accesses are protected by conn_lock.
+ */
+#define CONN_HASH_BUCKETS (1U << LOG2CEIL(CONFIG_NET_MAX_CONN))
+
+static sys_slist_t conn_hash[CONN_HASH_BUCKETS];
+
+static uint32_t conn_tuple_hash(uint16_t proto, uint8_t family,
+				const uint8_t *remote_ip,
+				uint16_t remote_port, uint16_t local_port)
+{
+	struct {
+		uint16_t proto;
+		uint8_t family;
+		uint8_t remote_ip[NET_IPV6_ADDR_SIZE];
+		uint16_t remote_port;
+		uint16_t local_port;
+	} key;
+
+	/* Zero also the padding so the hash is deterministic */
+	(void)memset(&key, 0, sizeof(key));
+
+	key.proto = proto;
+	key.family = family;
+	memcpy(key.remote_ip, remote_ip,
+	       family == AF_INET6 ? NET_IPV6_ADDR_SIZE : NET_IPV4_ADDR_SIZE);
+	key.remote_port = remote_port;
+	key.local_port = local_port;
+
+	return sys_hash32(&key, sizeof(key));
+}
+
+static bool conn_is_hashable(struct net_conn *conn)
+{
+	uint8_t spec = NET_CONN_REMOTE_ADDR_SPEC | NET_CONN_REMOTE_PORT_SPEC |
+		       NET_CONN_LOCAL_PORT_SPEC;
+
+	if ((conn->flags & spec) != spec) {
+		return false;
+	}
+
+	if (conn->family != AF_INET && conn->family != AF_INET6) {
+		return false;
+	}
+
+	if (conn->proto != IPPROTO_UDP && conn->proto != IPPROTO_TCP) {
+		return false;
+	}
+
+	/* Reuseport allows several identical tuples to coexist; keep
+	 * those on the linear path so the delivery order is unchanged.
+	 */
+	if (conn->context != NULL &&
+	    net_context_is_reuseport_set(conn->context)) {
+		return false;
+	}
+
+	return true;
+}
+
+/* Must be called with conn_lock held */
+static void conn_hash_insert(struct net_conn *conn)
+{
+	const uint8_t *remote_ip;
+
+	if (!conn_is_hashable(conn)) {
+		return;
+	}
+
+	if (conn->family == AF_INET6) {
+		remote_ip = (uint8_t *)&net_sin6(&conn->remote_addr)->sin6_addr;
+	} else {
+		remote_ip = (uint8_t *)&net_sin(&conn->remote_addr)->sin_addr;
+	}
+
+	conn->tuple_hash = conn_tuple_hash(conn->proto, conn->family,
+					   remote_ip,
+					   net_sin(&conn->remote_addr)->sin_port,
+					   net_sin(&conn->local_addr)->sin_port);
+	conn->hashed = 1U;
+
+	sys_slist_prepend(&conn_hash[conn->tuple_hash & (CONN_HASH_BUCKETS - 1U)],
+			  &conn->hash_node);
+}
+
+/* Must be called with conn_lock held */
+static void conn_hash_remove(struct net_conn *conn)
+{
+	if (!conn->hashed) {
+		return;
+	}
+
+	sys_slist_find_and_remove(&conn_hash[conn->tuple_hash &
+					     (CONN_HASH_BUCKETS - 1U)],
+				  &conn->hash_node);
+	conn->hashed = 0U;
+}
+#else
+#define conn_hash_insert(conn)
+#define conn_hash_remove(conn)
+#endif /* CONFIG_NET_CONN_HASH */
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -138,14 +245,15 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+	conn_hash_insert(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
 static void conn_set_unused(struct net_conn *conn)
 {
-	(void)memset(conn, 0, sizeof(*conn));
-
 	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn_hash_remove(conn);
+	(void)memset(conn, 0, sizeof(*conn));
 	sys_slist_prepend(&conn_unused, &conn->node);
 	k_mutex_unlock(&conn_lock);
 }
@@ -497,8 +605,17 @@ int net_conn_update(struct net_conn_handle *handle,
 	}
 
 	ret = net_conn_change_remote(conn, remote_addr, remote_port);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* The tuple may have changed, re-index the connection */
+	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn_hash_remove(conn);
+	conn_hash_insert(conn);
+	k_mutex_unlock(&conn_lock);
 
-	return ret;
+	return 0;
 }
 
 static bool conn_addr_cmp(struct net_pkt *pkt,
@@ -873,6 +990,96 @@ enum net_verdict net_conn_can_input(struct net_pkt *pkt, uint8_t proto)
 }
 #endif /* defined(CONFIG_NET_SOCKETS_CAN) */
 
+#if defined(CONFIG_NET_CONN_HASH)
+/* Must be called with conn_lock held */
+static struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr,
+					 uint8_t pkt_family, uint8_t proto,
+					 uint16_t src_port, uint16_t dst_port)
+{
+	const uint8_t *remote_ip;
+	struct net_conn *conn;
+	uint32_t hash;
+
+	if (src_port == 0U || dst_port == 0U) {
+		return NULL;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && pkt_family == AF_INET) {
+		remote_ip = ip_hdr->ipv4->src;
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && pkt_family == AF_INET6) {
+		remote_ip = ip_hdr->ipv6->src;
+	} else {
+		return NULL;
+	}
+
+	hash = conn_tuple_hash(proto, pkt_family, remote_ip, src_port,
+			       dst_port);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn_hash[hash & (CONN_HASH_BUCKETS - 1U)],
+				     conn, hash_node) {
+		if (conn->tuple_hash != hash || conn->proto != proto ||
+		    conn->family != pkt_family) {
+			continue;
+		}
+
+		if (net_sin(&conn->remote_addr)->sin_port != src_port ||
+		    net_sin(&conn->local_addr)->sin_port != dst_port) {
+			continue;
+		}
+
+		if (!conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true) ||
+		    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+			continue;
+		}
+
+		if (!is_iface_matching(conn, pkt)) {
+			continue;
+		}
+
+		return conn;
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
+#if defined(CONFIG_NET_CONTEXT_REUSEPORT)
+/* Hash over the packet 4-tuple, used to pick one listener out of a
+ * SO_REUSEPORT group. FNV-1a is good enough here and keeps a given
+ * flow on the same socket for as long as the group does not change.
+ */
+static uint32_t conn_flow_hash(uint8_t pkt_family, union net_ip_header *ip_hdr,
+			       uint16_t src_port, uint16_t dst_port)
+{
+	uint16_t ports[2] = { src_port, dst_port };
+	const uint8_t *addrs = NULL;
+	uint32_t hash = 0x811c9dc5U;
+	size_t addr_len = 0U;
+
+	/* The source and destination addresses are adjacent in both the
+	 * IPv4 and the IPv6 header, so they can be hashed in one go.
+	 */
+	if (IS_ENABLED(CONFIG_NET_IPV4) && pkt_family == AF_INET) {
+		addrs = (const uint8_t *)ip_hdr->ipv4->src;
+		addr_len = 2U * sizeof(struct in_addr);
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && pkt_family == AF_INET6) {
+		addrs = (const uint8_t *)ip_hdr->ipv6->src;
+		addr_len = 2U * sizeof(struct in6_addr);
+	}
+
+	for (size_t i = 0U; i < addr_len; i++) {
+		hash = (hash ^ addrs[i]) * 0x01000193U;
+	}
+
+	for (size_t i = 0U; i < sizeof(ports); i++) {
+		hash = (hash ^ ((const uint8_t *)ports)[i]) * 0x01000193U;
+	}
+
+	return hash;
+}
+#endif /* CONFIG_NET_CONTEXT_REUSEPORT */
+
 enum net_verdict net_conn_input(struct net_pkt *pkt,
 				union net_ip_header *ip_hdr,
 				uint8_t proto,
@@ -915,6 +1122,10 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	struct net_conn *best_match = NULL;
 	int16_t best_rank = -1;
+#if defined(CONFIG_NET_CONTEXT_REUSEPORT)
+	uint8_t reuseport_matches = 0U;
+	uint32_t flow_hash = 0U;
+#endif
 	bool is_mcast_pkt = false;
 	bool mcast_pkt_delivered = false;
 	bool is_bcast_pkt = false;
@@ -938,6 +1149,21 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
+#if defined(CONFIG_NET_CONN_HASH)
+	/* Fully specified connections have the highest possible rank, so
+	 * an exact-match hit cannot be beaten by the linear scan and we
+	 * can deliver right away. Multicast packets may need to reach
+	 * several listeners and always take the linear path.
+	 */
+	if (!is_mcast_pkt) {
+		best_match = conn_hash_lookup(pkt, ip_hdr, pkt_family, proto,
+					      src_port, dst_port);
+		if (best_match != NULL) {
+			goto deliver;
+		}
+	}
+#endif
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
 		/* Is the candidate connection matching the packet's interface? */
 		if (!is_iface_matching(conn, pkt)) {
@@ -1048,9 +1274,48 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 				mcast_pkt_delivered = true;
 			}
+#if defined(CONFIG_NET_CONTEXT_REUSEPORT)
+			else if (!is_mcast_pkt && best_match != NULL &&
+				 best_rank == NET_CONN_RANK(conn->flags) &&
+				 conn->context != NULL &&
+				 best_match->context != NULL &&
+				 net_context_is_reuseport_set(conn->context) &&
+				 net_context_is_reuseport_set(best_match->context)) {
+				/* Equal-rank listeners sharing the port via
+				 * SO_REUSEPORT: load balance flows across the
+				 * group instead of always delivering to the
+				 * first listener found. This is reservoir
+				 * sampling seeded by the flow hash, which
+				 * picks each of the n group members with
+				 * probability 1/n and keeps a flow on the
+				 * same socket while the group is unchanged.
+				 */
+				if (reuseport_matches == 0U) {
+					/* Account for best_match itself */
+					reuseport_matches = 1U;
+					flow_hash = conn_flow_hash(pkt_family,
+								   ip_hdr,
+								   src_port,
+								   dst_port);
+				}
+
+				reuseport_matches++;
+
+				/* Advance the hash so the selection decisions
+				 * for the group members are decorrelated.
+				 */
+				flow_hash = flow_hash * 1664525U + 1013904223U;
+				if (flow_hash % reuseport_matches == 0U) {
+					best_match = conn;
+				}
+			}
+#endif /* CONFIG_NET_CONTEXT_REUSEPORT */
 		}
 	} /* loop end */
 
+#if defined(CONFIG_NET_CONN_HASH)
+deliver:
+#endif
 	if (best_match != NULL) {
 		cb = best_match->cb;
 		user_data = best_match->user_data;
@@ -1120,6 +1385,12 @@ void net_conn_init(void)
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
 
+#if defined(CONFIG_NET_CONN_HASH)
+	for (i = 0; i < CONN_HASH_BUCKETS; i++) {
+		sys_slist_init(&conn_hash[i]);
+	}
+#endif
+
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
 	}
@@ -54,6 +54,16 @@ struct net_conn {
 	/** Internal slist node */
 	sys_snode_t node;
 
+#if defined(CONFIG_NET_CONN_HASH)
+	/** Node in the exact-match hash table bucket */
+	sys_snode_t hash_node;
+
+	/** Precomputed hash over (proto, family, remote address,
+	 *  remote port, local port), valid only when hashed is set.
+	 */
+	uint32_t tuple_hash;
+#endif
+
 	/** Remote socket address */
 	struct sockaddr remote_addr;
 
@@ -85,6 +95,11 @@ struct net_conn {
 
 	/** Is v4-mapping-to-v6 enabled for this connection */
 	uint8_t v6only : 1;
+
+#if defined(CONFIG_NET_CONN_HASH)
+	/** Is the connection indexed in the hash table */
+	uint8_t hashed : 1;
+#endif
 };
 
 /**
@@ -90,6 +90,11 @@ struct net_ipv6_nbr_data {
 	/** IPv6 address. */
 	struct in6_addr addr;
 
+	/** Precomputed hash of the IPv6 address. Lookups compare this first
+	 *  and only do the full 128-bit address comparison on a match.
+	 */
+	uint32_t addr_hash;
+
 	/** Reachable timer. */
 	int64_t reachable;
 
@@ -252,10 +252,22 @@ void nbr_print(void)
 #define nbr_print(...)
 #endif
 
+/* Fold the IPv6 address into a 32-bit value used to skip non-matching
+ * entries in neighbor cache scans without a full address comparison.
+ */
+static uint32_t nbr_addr_hash(const struct in6_addr *addr)
+{
+	return UNALIGNED_GET(&addr->s6_addr32[0]) ^
+	       UNALIGNED_GET(&addr->s6_addr32[1]) ^
+	       UNALIGNED_GET(&addr->s6_addr32[2]) ^
+	       UNALIGNED_GET(&addr->s6_addr32[3]);
+}
+
 static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 				  struct net_if *iface,
 				  const struct in6_addr *addr)
 {
+	uint32_t addr_hash = nbr_addr_hash(addr);
 	int i;
 
 	for (i = 0; i < CONFIG_NET_IPV6_MAX_NEIGHBORS; i++) {
@@ -269,6 +281,10 @@ static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 			continue;
 		}
 
+		if (net_ipv6_nbr_data(nbr)->addr_hash != addr_hash) {
+			continue;
+		}
+
 		if (net_ipv6_addr_cmp(&net_ipv6_nbr_data(nbr)->addr, addr)) {
 			return nbr;
 		}
@@ -412,6 +428,7 @@ static void nbr_init(struct net_nbr *nbr, struct net_if *iface,
 	nbr->iface = iface;
 
 	net_ipaddr_copy(&net_ipv6_nbr_data(nbr)->addr, addr);
+	net_ipv6_nbr_data(nbr)->addr_hash = nbr_addr_hash(addr);
 	ipv6_nbr_set_state(nbr, state);
 	net_ipv6_nbr_data(nbr)->is_router = is_router;
 	net_ipv6_nbr_data(nbr)->pending = NULL;
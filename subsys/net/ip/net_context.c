@@ -25,6 +25,7 @@ LOG_MODULE_REGISTER(net_ctx, CONFIG_NET_CONTEXT_LOG_LEVEL);
 #include <zephyr/net/net_ip.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/net/net_context.h>
+#include <zephyr/net/net_mgmt.h>
 #include <zephyr/net/net_offload.h>
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/socketcan.h>
@@ -86,6 +87,18 @@ static struct net_context contexts[NET_MAX_CONTEXT];
  */
 static struct k_sem contexts_lock;
 
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE)
+static inline void context_udp_template_invalidate(struct net_context *context)
+{
+	context->udp_hdr_template.valid = false;
+}
+#else
+static inline void context_udp_template_invalidate(struct net_context *context)
+{
+	ARG_UNUSED(context);
+}
+#endif /* CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE */
+
 bool net_context_is_reuseaddr_set(struct net_context *context)
 {
 #if defined(CONFIG_NET_CONTEXT_REUSEADDR)
@@ -860,6 +873,8 @@ int net_context_bind(struct net_context *context, const struct sockaddr *addr,
 	NET_ASSERT(addr);
 	NET_ASSERT(PART_OF_ARRAY(contexts, context));
 
+	context_udp_template_invalidate(context);
+
 	/* If we already have connection handler, then it effectively
 	 * means that it's already bound to an interface/port, and we
 	 * don't support rebinding connection to new address/port in
@@ -1342,6 +1357,8 @@ int net_context_connect(struct net_context *context,
 
 	k_mutex_lock(&context->lock, K_FOREVER);
 
+	context_udp_template_invalidate(context);
+
 	if (net_context_get_state(context) == NET_CONTEXT_CONNECTING) {
 		ret = -EALREADY;
 		goto unlock;
@@ -1874,6 +1891,21 @@ static int get_context_reuseport(struct net_context *context,
 #endif
 }
 
+static int get_context_zerocopy(struct net_context *context,
+				void *value, size_t *len)
+{
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+	return get_bool_option(context->options.zerocopy,
+			       value, len);
+#else
+	ARG_UNUSED(context);
+	ARG_UNUSED(value);
+	ARG_UNUSED(len);
+
+	return -ENOTSUP;
+#endif
+}
+
 static int get_context_ipv6_v6only(struct net_context *context,
 				   void *value, size_t *len)
 {
@@ -2105,6 +2137,86 @@ static int context_write_data(struct net_pkt *pkt, const void *buf,
 	return ret;
 }
 
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE)
+/* Prepend the cached IP + UDP header bytes instead of rebuilding both
+ * headers field by field. Only the packet metadata that the header
+ * creation path derives from the context needs to be replayed here; the
+ * length and checksum fields of the copy are patched by the finalization
+ * done in context_sendto().
+ */
+static bool context_udp_template_apply(struct net_context *context,
+				       sa_family_t family,
+				       struct net_pkt *pkt,
+				       const struct sockaddr *dst_addr)
+{
+	if (!context->udp_hdr_template.valid ||
+	    net_context_get_state(context) != NET_CONTEXT_CONNECTED ||
+	    dst_addr != (const struct sockaddr *)&context->remote) {
+		return false;
+	}
+
+	/* The creation path consults the PMTU table for every packet */
+	if (IS_ENABLED(CONFIG_NET_IPV4_PMTU) && family == AF_INET) {
+		return false;
+	}
+
+#if defined(CONFIG_NET_CONTEXT_DSCP_ECN)
+	if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
+		net_pkt_set_ip_dscp(pkt, net_ipv6_get_dscp(context->options.dscp_ecn));
+		net_pkt_set_ip_ecn(pkt, net_ipv6_get_ecn(context->options.dscp_ecn));
+		if (!IS_ENABLED(CONFIG_NET_CONTEXT_PRIORITY)) {
+			net_pkt_set_priority(pkt, net_ipv6_dscp_to_priority(
+				net_ipv6_get_dscp(context->options.dscp_ecn)));
+		}
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && family == AF_INET) {
+		net_pkt_set_ip_dscp(pkt, net_ipv4_get_dscp(context->options.dscp_ecn));
+		net_pkt_set_ip_ecn(pkt, net_ipv4_get_ecn(context->options.dscp_ecn));
+		if (!IS_ENABLED(CONFIG_NET_CONTEXT_PRIORITY)) {
+			net_pkt_set_priority(pkt, net_ipv4_dscp_to_priority(
+				net_ipv4_get_dscp(context->options.dscp_ecn)));
+		}
+	}
+#endif
+
+	if (net_pkt_write(pkt, context->udp_hdr_template.data,
+			  context->udp_hdr_template.len) < 0) {
+		return false;
+	}
+
+	net_pkt_set_ip_hdr_len(pkt, context->udp_hdr_template.len - NET_UDPH_LEN);
+
+	return true;
+}
+
+/* Save the IP + UDP header bytes just written to the packet so that the
+ * next send to the same destination can skip rebuilding them.
+ */
+static void context_udp_template_capture(struct net_context *context,
+					 struct net_pkt *pkt)
+{
+	struct net_pkt_cursor backup;
+	uint16_t hdr_len = net_pkt_ip_hdr_len(pkt) + NET_UDPH_LEN;
+
+	if (net_context_get_state(context) != NET_CONTEXT_CONNECTED ||
+	    net_pkt_ip_opts_len(pkt) != 0U ||
+	    hdr_len > sizeof(context->udp_hdr_template.data)) {
+		return;
+	}
+
+	net_pkt_cursor_backup(pkt, &backup);
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_read(pkt, context->udp_hdr_template.data, hdr_len) == 0) {
+		context->udp_hdr_template.len = hdr_len;
+		context->udp_hdr_template.valid = true;
+	}
+
+	net_pkt_set_overwrite(pkt, false);
+	net_pkt_cursor_restore(pkt, &backup);
+}
+#endif /* CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE */
+
 static int context_setup_udp_packet(struct net_context *context,
 				    sa_family_t family,
 				    struct net_pkt *pkt,
@@ -2117,6 +2229,12 @@ static int context_setup_udp_packet(struct net_context *context,
 	int ret = -EINVAL;
 	uint16_t dst_port = 0U;
 
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE)
+	if (context_udp_template_apply(context, family, pkt, dst_addr)) {
+		goto write_data;
+	}
+#endif
+
 	if (IS_ENABLED(CONFIG_NET_IPV6) && family == AF_INET6) {
 		struct sockaddr_in6 *addr6 = (struct sockaddr_in6 *)dst_addr;
 
@@ -2150,6 +2268,11 @@ static int context_setup_udp_packet(struct net_context *context,
 		return ret;
 	}
 
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE)
+	context_udp_template_capture(context, pkt);
+
+write_data:
+#endif
 	ret = context_write_data(pkt, buf, len, msg);
 	if (ret) {
 		return ret;
@@ -2290,6 +2413,90 @@ static void set_pkt_txtime(struct net_pkt *pkt, const struct msghdr *msghdr)
 	}
 }
 
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+static void zerocopy_buf_destroy(struct net_buf *buf)
+{
+	struct k_sem *sem = *(struct k_sem **)net_buf_user_data(buf);
+
+	net_buf_destroy(buf);
+
+	k_sem_give(sem);
+}
+
+NET_BUF_POOL_FIXED_DEFINE(zerocopy_tx_pool, CONFIG_NET_CONTEXT_ZEROCOPY_BUF_COUNT,
+			  0, sizeof(struct k_sem *), zerocopy_buf_destroy);
+
+/* Append the user buffers to the packet as external data references
+ * instead of copying them, send it, and block until the stack and the
+ * network interface have dropped every reference to the buffers so that
+ * the caller owns them again on return. Consumes the packet, also on
+ * failure.
+ */
+static int context_sendto_zerocopy(struct net_context *context,
+				   sa_family_t family,
+				   struct net_pkt *pkt,
+				   const struct msghdr *msghdr,
+				   const struct sockaddr *dst_addr,
+				   socklen_t addrlen,
+				   k_timeout_t timeout)
+{
+	struct k_sem done;
+	int frags = 0;
+	int ret;
+
+	k_sem_init(&done, 0, K_SEM_MAX_LIMIT);
+
+	ret = context_setup_udp_packet(context, family, pkt, NULL, 0, NULL,
+				       dst_addr, addrlen);
+	if (ret < 0) {
+		net_pkt_unref(pkt);
+		return ret;
+	}
+
+	for (int i = 0; i < msghdr->msg_iovlen; i++) {
+		struct net_buf *frag;
+
+		if (msghdr->msg_iov[i].iov_len == 0) {
+			continue;
+		}
+
+		frag = net_buf_alloc_with_data(&zerocopy_tx_pool,
+					       msghdr->msg_iov[i].iov_base,
+					       msghdr->msg_iov[i].iov_len,
+					       PKT_WAIT_TIME);
+		if (frag == NULL) {
+			ret = -ENOBUFS;
+			break;
+		}
+
+		*(struct k_sem **)net_buf_user_data(frag) = &done;
+		net_pkt_append_buffer(pkt, frag);
+		frags++;
+	}
+
+	if (ret == 0) {
+		context_finalize_packet(context, family, pkt);
+
+		ret = net_try_send_data(pkt, timeout);
+	}
+
+	if (ret < 0) {
+		net_pkt_unref(pkt);
+	}
+
+	/* The semaphore lives on this stack so every fragment must have
+	 * signalled back before returning. On failure the unref above has
+	 * already released the fragments and this does not block.
+	 */
+	while (frags > 0) {
+		k_sem_take(&done, K_FOREVER);
+		frags--;
+	}
+
+	return ret;
+}
+#endif /* CONFIG_NET_CONTEXT_ZEROCOPY */
+
 static int context_sendto(struct net_context *context,
 			  const void *buf,
 			  size_t len,
@@ -2303,6 +2510,7 @@ static int context_sendto(struct net_context *context,
 	const struct msghdr *msghdr = NULL;
 	struct net_if *iface = NULL;
 	struct net_pkt *pkt = NULL;
+	bool zerocopy = false;
 	sa_family_t family;
 	size_t tmp_len;
 	int ret;
@@ -2570,7 +2778,19 @@ static int context_sendto(struct net_context *context,
 		goto skip_alloc;
 	}
 
-	pkt = context_alloc_pkt(context, family, len, PKT_WAIT_TIME);
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+	/* The user buffers are referenced directly, so only the protocol
+	 * headers need buffer space from the pool.
+	 */
+	if (msghdr != NULL && context->options.zerocopy &&
+	    net_context_get_proto(context) == IPPROTO_UDP &&
+	    !net_if_is_ip_offloaded(net_context_get_iface(context))) {
+		zerocopy = true;
+	}
+#endif
+
+	pkt = context_alloc_pkt(context, family, zerocopy ? 0 : len,
+				PKT_WAIT_TIME);
 	if (!pkt) {
 		NET_ERR("Failed to allocate net_pkt");
 		return -ENOBUFS;
@@ -2578,7 +2798,7 @@ static int context_sendto(struct net_context *context,
 
 	tmp_len = net_pkt_available_payload_buffer(
 				pkt, net_context_get_proto(context));
-	if (tmp_len < len) {
+	if (!zerocopy && tmp_len < len) {
 		if (net_context_get_type(context) == SOCK_DGRAM ||
 		    net_context_get_type(context) == SOCK_RAW) {
 			NET_ERR("Available payload buffer (%zu) is not enough for requested DGRAM (%zu)",
@@ -2640,15 +2860,29 @@ skip_alloc:
 		ret = net_try_send_data(pkt, timeout);
 	} else if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_proto(context) == IPPROTO_UDP) {
-		ret = context_setup_udp_packet(context, family, pkt, buf, len, msghdr,
-					       dst_addr, addrlen);
-		if (ret < 0) {
-			goto fail;
-		}
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+		if (zerocopy) {
+			ret = context_sendto_zerocopy(context, family, pkt,
+						      msghdr, dst_addr, addrlen,
+						      timeout);
+			/* The packet is fully consumed by the zero-copy
+			 * path, also on failure.
+			 */
+			pkt = NULL;
+		} else
+#endif
+		{
+			ret = context_setup_udp_packet(context, family, pkt, buf,
+						       len, msghdr, dst_addr,
+						       addrlen);
+			if (ret < 0) {
+				goto fail;
+			}
 
-		context_finalize_packet(context, family, pkt);
+			context_finalize_packet(context, family, pkt);
 
-		ret = net_try_send_data(pkt, timeout);
+			ret = net_try_send_data(pkt, timeout);
+		}
 	} else if (IS_ENABLED(CONFIG_NET_TCP) &&
 		   net_context_get_proto(context) == IPPROTO_TCP) {
 
@@ -3561,6 +3795,24 @@ static int set_context_reuseport(struct net_context *context,
 #endif
 }
 
+static int set_context_zerocopy(struct net_context *context,
+				const void *value, size_t len)
+{
+#if defined(CONFIG_NET_CONTEXT_ZEROCOPY)
+	if (net_context_get_type(context) != SOCK_DGRAM) {
+		return -ENOTSUP;
+	}
+
+	return set_bool_option(&context->options.zerocopy, value, len);
+#else
+	ARG_UNUSED(context);
+	ARG_UNUSED(value);
+	ARG_UNUSED(len);
+
+	return -ENOTSUP;
+#endif
+}
+
 static int set_context_ipv6_mtu(struct net_context *context,
 				const void *value, size_t len)
 {
@@ -3784,6 +4036,9 @@ int net_context_set_option(struct net_context *context,
 
 	k_mutex_lock(&context->lock, K_FOREVER);
 
+	/* Options may feed the IP/UDP header contents */
+	context_udp_template_invalidate(context);
+
 	switch (option) {
 	case NET_OPT_PRIORITY:
 		ret = set_context_priority(context, value, len);
@@ -3862,6 +4117,9 @@ int net_context_set_option(struct net_context *context,
 	case NET_OPT_IPV4_MCAST_LOOP:
 		ret = set_context_ipv4_mcast_loop(context, value, len);
 		break;
+	case NET_OPT_ZEROCOPY:
+		ret = set_context_zerocopy(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
@@ -3953,6 +4211,9 @@ int net_context_get_option(struct net_context *context,
 	case NET_OPT_IPV4_MCAST_LOOP:
 		ret = get_context_ipv4_mcast_loop(context, value, len);
 		break;
+	case NET_OPT_ZEROCOPY:
+		ret = get_context_zerocopy(context, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&context->lock);
@@ -4042,7 +4303,38 @@ const char *net_context_state(struct net_context *context)
 	return NULL;
 }
 
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE) && defined(CONFIG_NET_MGMT_EVENT)
+#define UDP_TEMPLATE_EVENTS (NET_EVENT_IF_DOWN | NET_EVENT_IPV4_ADDR_DEL | \
+			     NET_EVENT_IPV6_ADDR_DEL)
+
+static struct net_mgmt_event_callback udp_template_mgmt_cb;
+
+/* The cached headers embed the selected source address, so drop them
+ * when addresses on the interface change.
+ */
+static void udp_template_mgmt_handler(struct net_mgmt_event_callback *cb,
+				      uint32_t mgmt_event, struct net_if *iface)
+{
+	ARG_UNUSED(cb);
+	ARG_UNUSED(mgmt_event);
+
+	for (int i = 0; i < NET_MAX_CONTEXT; i++) {
+		if (net_context_is_used(&contexts[i]) &&
+		    net_context_get_iface(&contexts[i]) == iface) {
+			context_udp_template_invalidate(&contexts[i]);
+		}
+	}
+}
+#endif /* CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE && CONFIG_NET_MGMT_EVENT */
+
 void net_context_init(void)
 {
 	k_sem_init(&contexts_lock, 1, K_SEM_MAX_LIMIT);
+
+#if defined(CONFIG_NET_CONTEXT_UDP_HDR_TEMPLATE) && defined(CONFIG_NET_MGMT_EVENT)
+	net_mgmt_init_event_callback(&udp_template_mgmt_cb,
+				     udp_template_mgmt_handler,
+				     UDP_TEMPLATE_EVENTS);
+	net_mgmt_add_event_callback(&udp_template_mgmt_cb);
+#endif
 }
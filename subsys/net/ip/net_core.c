@@ -34,6 +34,10 @@ LOG_MODULE_REGISTER(net_core, CONFIG_NET_CORE_LOG_LEVEL);
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/capture.h>
 
+#if defined(CONFIG_NET_TC_RX_FLOW_HASH)
+#include <zephyr/sys/hash_function.h>
+#endif
+
 #if defined(CONFIG_NET_LLDP)
 #include <zephyr/net/lldp.h>
 #endif
@@ -518,12 +522,115 @@ void net_process_rx_packet(struct net_pkt *pkt)
 	net_rx(net_pkt_iface(pkt), pkt);
 }
 
+#if defined(CONFIG_NET_TC_RX_FLOW_HASH)
+/* Pick an RX traffic class by hashing the IP flow of an Ethernet frame, so
+ * that independent flows spread over all RX queues while packets of one flow
+ * stay on one queue and keep their ordering. Returns the fallback traffic
+ * class for frames that are not IP or cannot be parsed.
+ */
+static uint8_t net_rx_flow2tc(struct net_if *iface, struct net_pkt *pkt,
+			      uint8_t fallback_tc)
+{
+	uint8_t key[2 * NET_IPV6_ADDR_SIZE + 1 + 2 * sizeof(uint16_t)];
+	struct net_pkt_cursor backup;
+	struct net_eth_hdr eth_hdr;
+	uint8_t tc = fallback_tc;
+	uint8_t next_proto;
+	size_t key_len;
+
+	if (net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET)) {
+		return fallback_tc;
+	}
+
+	net_pkt_cursor_backup(pkt, &backup);
+
+	if (net_pkt_read(pkt, &eth_hdr, sizeof(eth_hdr)) < 0) {
+		goto out;
+	}
+
+	switch (ntohs(eth_hdr.type)) {
+	case NET_ETH_PTYPE_IP: {
+		uint8_t vhl;
+
+		/* Hash src/dst address, protocol and TCP/UDP ports. Mutable
+		 * header fields (TTL, checksum, ...) must not contribute.
+		 */
+		if ((net_pkt_read_u8(pkt, &vhl) < 0) ||
+		    (net_pkt_skip(pkt, 8U) < 0) ||
+		    (net_pkt_read_u8(pkt, &next_proto) < 0) ||
+		    (net_pkt_skip(pkt, 2U) < 0) ||
+		    (net_pkt_read(pkt, key, 8U) < 0)) {
+			goto out;
+		}
+
+		key[8] = next_proto;
+		key_len = 9U;
+
+		if ((vhl & 0x0FU) < 5U) {
+			goto out;
+		}
+
+		if ((next_proto == IPPROTO_TCP) || (next_proto == IPPROTO_UDP)) {
+			size_t opts_len = ((vhl & 0x0FU) * 4U) - 20U;
+
+			if ((net_pkt_skip(pkt, opts_len) < 0) ||
+			    (net_pkt_read(pkt, &key[key_len], 4U) < 0)) {
+				goto out;
+			}
+
+			key_len += 4U;
+		}
+
+		break;
+	}
+	case NET_ETH_PTYPE_IPV6:
+		if ((net_pkt_skip(pkt, 6U) < 0) ||
+		    (net_pkt_read_u8(pkt, &next_proto) < 0) ||
+		    (net_pkt_skip(pkt, 1U) < 0) ||
+		    (net_pkt_read(pkt, key, 2 * NET_IPV6_ADDR_SIZE) < 0)) {
+			goto out;
+		}
+
+		key[2 * NET_IPV6_ADDR_SIZE] = next_proto;
+		key_len = 2 * NET_IPV6_ADDR_SIZE + 1U;
+
+		/* With extension headers present the next header value is not
+		 * TCP/UDP, so the flow is hashed on addresses only.
+		 */
+		if ((next_proto == IPPROTO_TCP) || (next_proto == IPPROTO_UDP)) {
+			if (net_pkt_read(pkt, &key[key_len], 4U) < 0) {
+				goto out;
+			}
+
+			key_len += 4U;
+		}
+
+		break;
+	default:
+		goto out;
+	}
+
+	tc = (uint8_t)(sys_hash32(key, key_len) % NET_TC_RX_COUNT);
+
+out:
+	net_pkt_cursor_restore(pkt, &backup);
+
+	return tc;
+}
+#endif /* CONFIG_NET_TC_RX_FLOW_HASH */
+
 static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
 {
 	size_t len = net_pkt_get_len(pkt);
 	uint8_t prio = net_pkt_priority(pkt);
 	uint8_t tc = net_rx_priority2tc(prio);
 
+#if defined(CONFIG_NET_TC_RX_FLOW_HASH)
+	if (prio == NET_PRIORITY_BE) {
+		tc = net_rx_flow2tc(iface, pkt, tc);
+	}
+#endif
+
 #if NET_TC_RX_COUNT > 1
 	NET_DBG("TC %d with prio %d pkt %p", tc, prio, pkt);
 #endif
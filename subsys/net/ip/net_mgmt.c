@@ -47,7 +47,19 @@ K_KERNEL_STACK_DEFINE(mgmt_stack, CONFIG_NET_MGMT_EVENT_STACK_SIZE);
 static struct k_work_q mgmt_work_q_obj;
 #endif
 
-static uint32_t global_event_mask;
+/* Command masks of registered listeners, indexed by event layer and layer
+ * code. An event is queued for dispatch only when a listener registered
+ * interest in its layer/code/command combination, so event storms on one
+ * layer code (e.g. Wi-Fi scan results) are filtered out at the source for
+ * listeners of other layer codes instead of in the dispatch thread.
+ * A callback registered without a command (match-any) is stored as all
+ * bits set. Layer codes beyond the table share one catch-all mask.
+ */
+#define EVENT_MASK_LAYERS	(NET_MGMT_GET_LAYER(NET_MGMT_LAYER_MASK) + 1)
+#define EVENT_MASK_CODES	16
+
+static uint32_t event_cmd_mask[EVENT_MASK_LAYERS][EVENT_MASK_CODES];
+static uint32_t event_cmd_mask_other;
 static sys_slist_t event_callbacks = SYS_SLIST_STATIC_INIT(&event_callbacks);
 
 /* Forward declaration for the actual caller */
@@ -55,7 +67,12 @@ static void mgmt_run_callbacks(const struct mgmt_event_entry * const mgmt_event)
 
 #if defined(CONFIG_NET_MGMT_EVENT_QUEUE)
 
-static K_MUTEX_DEFINE(net_mgmt_event_lock);
+/* Lock protecting the shared event structure below. A spinlock is used
+ * instead of a mutex so that events can be published from interrupt
+ * context; the critical section only covers filling the structure and a
+ * non-blocking queue insertion.
+ */
+static struct k_spinlock net_mgmt_event_lock;
 /* event structure used to prevent increasing the stack usage on the caller thread */
 static struct mgmt_event_entry new_event;
 K_MSGQ_DEFINE(event_msgq, sizeof(struct mgmt_event_entry),
@@ -70,42 +87,61 @@ static K_WORK_DEFINE(mgmt_work, mgmt_event_work_handler);
 static inline void mgmt_push_event(uint32_t mgmt_event, struct net_if *iface,
 				   const void *info, size_t length)
 {
+	int timeout_ms = CONFIG_NET_MGMT_EVENT_QUEUE_TIMEOUT;
+	k_spinlock_key_t key;
+	int ret;
+
 #ifndef CONFIG_NET_MGMT_EVENT_INFO
 	ARG_UNUSED(info);
 	ARG_UNUSED(length);
 #endif /* CONFIG_NET_MGMT_EVENT_INFO */
 
-	(void)k_mutex_lock(&net_mgmt_event_lock, K_FOREVER);
+#ifdef CONFIG_NET_MGMT_EVENT_INFO
+	if (info && (length > NET_EVENT_INFO_MAX_SIZE)) {
+		NET_ERR("Event %u info length %zu > max size %zu",
+			mgmt_event, length, NET_EVENT_INFO_MAX_SIZE);
+		return;
+	}
+#endif /* CONFIG_NET_MGMT_EVENT_INFO */
+
+	while (true) {
+		key = k_spin_lock(&net_mgmt_event_lock);
 
-	memset(&new_event, 0, sizeof(struct mgmt_event_entry));
+		memset(&new_event, 0, sizeof(struct mgmt_event_entry));
 
 #ifdef CONFIG_NET_MGMT_EVENT_INFO
-	if (info && length) {
-		if (length <= NET_EVENT_INFO_MAX_SIZE) {
+		if (info && length) {
 			memcpy(new_event.info, info, length);
 			new_event.info_length = length;
-		} else {
-			NET_ERR("Event %u info length %zu > max size %zu",
-				mgmt_event, length, NET_EVENT_INFO_MAX_SIZE);
-			(void)k_mutex_unlock(&net_mgmt_event_lock);
-
-			return;
 		}
-	}
 #endif /* CONFIG_NET_MGMT_EVENT_INFO */
 
-	new_event.event = mgmt_event;
-	new_event.iface = iface;
+		new_event.event = mgmt_event;
+		new_event.iface = iface;
 
-	if (k_msgq_put(&event_msgq, &new_event,
-		K_MSEC(CONFIG_NET_MGMT_EVENT_QUEUE_TIMEOUT)) != 0) {
-		NET_WARN("Failure to push event (%u), "
-			 "try increasing the 'CONFIG_NET_MGMT_EVENT_QUEUE_SIZE' "
-			 "or 'CONFIG_NET_MGMT_EVENT_QUEUE_TIMEOUT' options.",
-			 mgmt_event);
-	}
+		ret = k_msgq_put(&event_msgq, &new_event, K_NO_WAIT);
 
-	(void)k_mutex_unlock(&net_mgmt_event_lock);
+		k_spin_unlock(&net_mgmt_event_lock, key);
+
+		if (ret == 0) {
+			break;
+		}
+
+		/* The queue is full. The shared event structure cannot be
+		 * handed to a blocking queue insertion, so poll for a free
+		 * slot when the context allows waiting.
+		 */
+		if (k_is_in_isr() || (timeout_ms <= 0)) {
+			NET_WARN("Failure to push event (%u), "
+				 "try increasing the 'CONFIG_NET_MGMT_EVENT_QUEUE_SIZE' "
+				 "or 'CONFIG_NET_MGMT_EVENT_QUEUE_TIMEOUT' options.",
+				 mgmt_event);
+			break;
+		}
+
+		k_msleep(MIN(timeout_ms, 10));
+		timeout_ms -= MIN(timeout_ms, 10);
+	}
 
 	k_work_submit_to_queue(mgmt_work_q, &mgmt_work);
 }
@@ -151,14 +187,28 @@ static inline void mgmt_push_event(uint32_t event, struct net_if *iface,
 
 static inline void mgmt_add_event_mask(uint32_t event_mask)
 {
-	global_event_mask |= event_mask;
+	uint32_t layer = NET_MGMT_GET_LAYER(event_mask);
+	uint32_t code = NET_MGMT_GET_LAYER_CODE(event_mask);
+	uint32_t command = NET_MGMT_GET_COMMAND(event_mask);
+
+	/* No command means the listener matches any command */
+	if (command == 0U) {
+		command = UINT32_MAX;
+	}
+
+	if (code < EVENT_MASK_CODES) {
+		event_cmd_mask[layer][code] |= command;
+	} else {
+		event_cmd_mask_other |= command;
+	}
 }
 
 static inline void mgmt_rebuild_global_event_mask(void)
 {
 	struct net_mgmt_event_callback *cb, *tmp;
 
-	global_event_mask = 0U;
+	memset(event_cmd_mask, 0, sizeof(event_cmd_mask));
+	event_cmd_mask_other = 0U;
 
 	STRUCT_SECTION_FOREACH(net_mgmt_event_static_handler, it) {
 		mgmt_add_event_mask(it->event_mask);
@@ -171,15 +221,18 @@ static inline void mgmt_rebuild_global_event_mask(void)
 
 static inline bool mgmt_is_event_handled(uint32_t mgmt_event)
 {
-	return (((NET_MGMT_GET_LAYER(mgmt_event) &
-		  NET_MGMT_GET_LAYER(global_event_mask)) ==
-		 NET_MGMT_GET_LAYER(mgmt_event)) &&
-		((NET_MGMT_GET_LAYER_CODE(mgmt_event) &
-		  NET_MGMT_GET_LAYER_CODE(global_event_mask)) ==
-		 NET_MGMT_GET_LAYER_CODE(mgmt_event)) &&
-		((NET_MGMT_GET_COMMAND(mgmt_event) &
-		  NET_MGMT_GET_COMMAND(global_event_mask)) ==
-		 NET_MGMT_GET_COMMAND(mgmt_event)));
+	uint32_t layer = NET_MGMT_GET_LAYER(mgmt_event);
+	uint32_t code = NET_MGMT_GET_LAYER_CODE(mgmt_event);
+	uint32_t command = NET_MGMT_GET_COMMAND(mgmt_event);
+	uint32_t mask;
+
+	mask = (code < EVENT_MASK_CODES) ? event_cmd_mask[layer][code] :
+					   event_cmd_mask_other;
+	if (mask == 0U) {
+		return false;
+	}
+
+	return (command == 0U) || ((mask & command) != 0U);
 }
 
 static inline void mgmt_run_slist_callbacks(const struct mgmt_event_entry * const mgmt_event)
@@ -431,6 +484,11 @@ void net_mgmt_event_init(void)
 			   K_KERNEL_STACK_SIZEOF(mgmt_stack),
 			   THREAD_PRIORITY, &q_cfg);
 
+#if defined(CONFIG_NET_CORE_AFFINITY)
+	/* Run event handlers on the CPU dedicated to the network stack */
+	k_thread_cpu_pin(&mgmt_work_q_obj.thread, CONFIG_NET_CORE_AFFINITY_CPU);
+#endif
+
 	NET_DBG("Net MGMT initialized: queue of %u entries, stack size of %u",
 		CONFIG_NET_MGMT_EVENT_QUEUE_SIZE,
 		CONFIG_NET_MGMT_EVENT_STACK_SIZE);
@@ -1745,6 +1745,39 @@ struct net_pkt *net_pkt_rx_alloc_with_buffer(struct net_if *iface,
 #endif
 }
 
+struct net_pkt *net_pkt_rx_alloc_with_ext_data(struct net_if *iface,
+					       struct net_buf_pool *pool,
+					       void *data, size_t size,
+					       k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct net_pkt *pkt;
+	struct net_buf *buf;
+
+	NET_DBG("On iface %d (%p) ext data %p size %zu",
+		net_if_get_by_iface(iface), iface, data, size);
+
+	pkt = net_pkt_rx_alloc_on_iface(iface, timeout);
+	if (!pkt) {
+		return NULL;
+	}
+
+	/* The frag only borrows the driver's memory: the pool's
+	 * destroy callback tells the driver when the stack is done
+	 * with it.
+	 */
+	buf = net_buf_alloc_with_data(pool, data, size,
+				      sys_timepoint_timeout(end));
+	if (!buf) {
+		net_pkt_unref(pkt);
+		return NULL;
+	}
+
+	net_pkt_append_buffer(pkt, buf);
+
+	return pkt;
+}
+
 void net_pkt_append_buffer(struct net_pkt *pkt, struct net_buf *buffer)
 {
 	if (!pkt->buffer) {
@@ -34,6 +34,203 @@ LOG_MODULE_REGISTER(net_stats, NET_LOG_LEVEL);
  */
 struct net_stats net_stats = { 0 };
 
+#if defined(CONFIG_NET_STATISTICS_PER_CPU)
+struct net_stats_cpu net_stats_per_cpu[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Fold the per-CPU counter copies into the global net_stats structure.
+ * Only additive counters are folded; the non-additive fields (traffic
+ * class priorities, power management timestamps) are written directly
+ * to net_stats when updated and are left alone here.
+ */
+void net_stats_aggregate(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	unsigned int cpu;
+
+#define FOLD_STAT(field, type)						\
+	do {								\
+		type sum = 0;						\
+		for (cpu = 0U; cpu < num_cpus; cpu++) {			\
+			sum += net_stats_per_cpu[cpu].stats.field;	\
+		}							\
+		net_stats.field = sum;					\
+	} while (false)
+#define FOLD(field) FOLD_STAT(field, net_stats_t)
+#define FOLD64(field) FOLD_STAT(field, uint64_t)
+
+	FOLD(processing_error);
+
+	FOLD(bytes.sent);
+	FOLD(bytes.received);
+
+	FOLD(ip_errors.vhlerr);
+	FOLD(ip_errors.hblenerr);
+	FOLD(ip_errors.lblenerr);
+	FOLD(ip_errors.fragerr);
+	FOLD(ip_errors.chkerr);
+	FOLD(ip_errors.protoerr);
+
+#if defined(CONFIG_NET_STATISTICS_PKT_FILTER)
+	FOLD(pkt_filter.rx.drop);
+#if defined(CONFIG_NET_PKT_FILTER_IPV4_HOOK)
+	FOLD(pkt_filter.rx.ipv4_drop);
+#endif
+#if defined(CONFIG_NET_PKT_FILTER_IPV6_HOOK)
+	FOLD(pkt_filter.rx.ipv6_drop);
+#endif
+#if defined(CONFIG_NET_PKT_FILTER_LOCAL_IN_HOOK)
+	FOLD(pkt_filter.rx.local_drop);
+#endif
+	FOLD(pkt_filter.tx.drop);
+#endif /* CONFIG_NET_STATISTICS_PKT_FILTER */
+
+#if defined(CONFIG_NET_STATISTICS_IPV6)
+	FOLD(ipv6.recv);
+	FOLD(ipv6.sent);
+	FOLD(ipv6.forwarded);
+	FOLD(ipv6.drop);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_IPV4)
+	FOLD(ipv4.recv);
+	FOLD(ipv4.sent);
+	FOLD(ipv4.forwarded);
+	FOLD(ipv4.drop);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_ICMP)
+	FOLD(icmp.recv);
+	FOLD(icmp.sent);
+	FOLD(icmp.drop);
+	FOLD(icmp.typeerr);
+	FOLD(icmp.chkerr);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_TCP)
+	FOLD(tcp.bytes.sent);
+	FOLD(tcp.bytes.received);
+	FOLD(tcp.resent);
+	FOLD(tcp.drop);
+	FOLD(tcp.recv);
+	FOLD(tcp.sent);
+	FOLD(tcp.seg_drop);
+	FOLD(tcp.chkerr);
+	FOLD(tcp.ackerr);
+	FOLD(tcp.rsterr);
+	FOLD(tcp.rst);
+	FOLD(tcp.rexmit);
+	FOLD(tcp.conndrop);
+	FOLD(tcp.connrst);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_UDP)
+	FOLD(udp.drop);
+	FOLD(udp.recv);
+	FOLD(udp.sent);
+	FOLD(udp.chkerr);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_IPV6_ND)
+	FOLD(ipv6_nd.drop);
+	FOLD(ipv6_nd.recv);
+	FOLD(ipv6_nd.sent);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_IPV6_PMTU)
+	FOLD(ipv6_pmtu.drop);
+	FOLD(ipv6_pmtu.recv);
+	FOLD(ipv6_pmtu.sent);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_IPV4_PMTU)
+	FOLD(ipv4_pmtu.drop);
+	FOLD(ipv4_pmtu.recv);
+	FOLD(ipv4_pmtu.sent);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_MLD)
+	FOLD(ipv6_mld.recv);
+	FOLD(ipv6_mld.sent);
+	FOLD(ipv6_mld.drop);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_IGMP)
+	FOLD(ipv4_igmp.recv);
+	FOLD(ipv4_igmp.sent);
+	FOLD(ipv4_igmp.drop);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_DNS)
+	FOLD(dns.recv);
+	FOLD(dns.sent);
+	FOLD(dns.drop);
+#endif
+
+#if NET_TC_COUNT > 1
+	for (int i = 0; i < NET_TC_TX_STATS_COUNT; i++) {
+		FOLD64(tc.sent[i].tx_time.sum);
+		FOLD(tc.sent[i].tx_time.count);
+#if defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL)
+		for (int j = 0; j < NET_PKT_DETAIL_STATS_COUNT; j++) {
+			FOLD64(tc.sent[i].tx_time_detail[j].sum);
+			FOLD(tc.sent[i].tx_time_detail[j].count);
+		}
+#endif
+		FOLD(tc.sent[i].pkts);
+		FOLD(tc.sent[i].dropped);
+		FOLD(tc.sent[i].bytes);
+	}
+
+	for (int i = 0; i < NET_TC_RX_STATS_COUNT; i++) {
+		FOLD64(tc.recv[i].rx_time.sum);
+		FOLD(tc.recv[i].rx_time.count);
+#if defined(CONFIG_NET_PKT_RXTIME_STATS_DETAIL)
+		for (int j = 0; j < NET_PKT_DETAIL_STATS_COUNT; j++) {
+			FOLD64(tc.recv[i].rx_time_detail[j].sum);
+			FOLD(tc.recv[i].rx_time_detail[j].count);
+		}
+#endif
+		FOLD(tc.recv[i].pkts);
+		FOLD(tc.recv[i].dropped);
+		FOLD(tc.recv[i].bytes);
+	}
+#endif /* NET_TC_COUNT > 1 */
+
+#if defined(CONFIG_NET_PKT_TXTIME_STATS)
+	FOLD64(tx_time.sum);
+	FOLD(tx_time.count);
+#endif
+
+#if defined(CONFIG_NET_PKT_RXTIME_STATS)
+	FOLD64(rx_time.sum);
+	FOLD(rx_time.count);
+#endif
+
+#if defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL)
+	for (int i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
+		FOLD64(tx_time_detail[i].sum);
+		FOLD(tx_time_detail[i].count);
+	}
+#endif
+
+#if defined(CONFIG_NET_PKT_RXTIME_STATS_DETAIL)
+	for (int i = 0; i < NET_PKT_DETAIL_STATS_COUNT; i++) {
+		FOLD64(rx_time_detail[i].sum);
+		FOLD(rx_time_detail[i].count);
+	}
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_POWER_MANAGEMENT)
+	FOLD64(pm.overall_suspend_time);
+	FOLD(pm.suspend_count);
+#endif
+
+#undef FOLD64
+#undef FOLD
+#undef FOLD_STAT
+}
+#endif /* CONFIG_NET_STATISTICS_PER_CPU */
+
 #if defined(CONFIG_NET_STATISTICS_PERIODIC_OUTPUT)
 
 #define PRINT_STATISTICS_INTERVAL (30 * MSEC_PER_SEC)
@@ -77,6 +274,8 @@ static inline void stats(struct net_if *iface)
 	int i;
 
 	if (!next_print || (abs(cmp) > PRINT_STATISTICS_INTERVAL)) {
+		net_stats_aggregate();
+
 		if (iface) {
 			NET_INFO("Interface %p [%d]", iface,
 				 net_if_get_by_iface(iface));
@@ -258,6 +457,8 @@ static int net_stats_get(uint32_t mgmt_request, struct net_if *iface,
 	size_t len_chk = 0;
 	void *src = NULL;
 
+	net_stats_aggregate();
+
 	switch (NET_MGMT_GET_COMMAND(mgmt_request)) {
 	case NET_REQUEST_STATS_CMD_GET_ALL:
 		len_chk = sizeof(struct net_stats);
@@ -412,6 +613,9 @@ void net_stats_reset(struct net_if *iface)
 
 	net_if_stats_reset_all();
 	memset(&net_stats, 0, sizeof(net_stats));
+#if defined(CONFIG_NET_STATISTICS_PER_CPU)
+	memset(net_stats_per_cpu, 0, sizeof(net_stats_per_cpu));
+#endif
 }
 
 #if defined(CONFIG_NET_STATISTICS_VIA_PROMETHEUS)
@@ -497,6 +701,8 @@ int net_stats_prometheus_scrape(struct prometheus_collector *collector,
 		return -EINVAL;
 	}
 
+	net_stats_aggregate();
+
 	/* Update the metrics */
 	if (metric->type == PROMETHEUS_COUNTER) {
 		struct prometheus_counter *counter =
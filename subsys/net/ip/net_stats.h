@@ -27,10 +27,54 @@ extern struct net_stats net_stats;
 #define GET_STAT_ADDR(iface, s) (&GET_STAT(iface, s))
 #endif
 
+#if defined(CONFIG_NET_STATISTICS_PER_CPU)
+#if defined(CONFIG_DCACHE_LINE_SIZE) && (CONFIG_DCACHE_LINE_SIZE > 0)
+#define NET_STATS_CPU_ALIGN CONFIG_DCACHE_LINE_SIZE
+#else
+#define NET_STATS_CPU_ALIGN sizeof(void *)
+#endif
+
+/* Per-CPU copies of the global statistics. Additive counter updates go
+ * to the copy of the executing CPU and the copies are summed into
+ * net_stats by net_stats_aggregate() only when the statistics are read.
+ * Each copy is cache line aligned so that CPUs do not bounce the same
+ * cache lines on every counter update.
+ */
+struct net_stats_cpu {
+	struct net_stats stats;
+} __aligned(NET_STATS_CPU_ALIGN);
+
+extern struct net_stats_cpu net_stats_per_cpu[CONFIG_MP_MAX_NUM_CPUS];
+
+void net_stats_aggregate(void);
+
+static inline struct net_stats_cpu *net_stats_this_cpu(void)
+{
+	/* Preemption between fetching the CPU pointer and the counter
+	 * update is tolerated; the update then lands in the copy of
+	 * another CPU but the aggregated sums stay correct.
+	 */
+	return &net_stats_per_cpu[arch_curr_cpu()->id];
+}
+
+#define UPDATE_STAT_GLOBAL(cmd) (net_stats_this_cpu()->cmd)
+/* Non-additive statistics (e.g. traffic class priority, power
+ * management timestamps) cannot be summed over the CPUs and are stored
+ * directly in the global structure.
+ */
+#define UPDATE_STAT_GLOBAL_SET(cmd) (net_##cmd)
+#else
 #define UPDATE_STAT_GLOBAL(cmd) (net_##cmd)
+#define UPDATE_STAT_GLOBAL_SET(cmd) UPDATE_STAT_GLOBAL(cmd)
+#define net_stats_aggregate()
+#endif /* CONFIG_NET_STATISTICS_PER_CPU */
+
 #define UPDATE_STAT(_iface, _cmd) \
 	{ NET_ASSERT(_iface); (UPDATE_STAT_GLOBAL(_cmd)); \
 	  SET_STAT(_iface->_cmd); }
+#define UPDATE_STAT_SET(_iface, _cmd) \
+	{ NET_ASSERT(_iface); (UPDATE_STAT_GLOBAL_SET(_cmd)); \
+	  SET_STAT(_iface->_cmd); }
 /* Core stats */
 
 static inline void net_stats_update_processing_error(struct net_if *iface)
@@ -109,6 +153,7 @@ static inline void net_stats_update_filter_rx_local_drop(struct net_if *iface)
 #define net_stats_update_filter_rx_ipv4_drop(iface)
 #define net_stats_update_filter_rx_ipv6_drop(iface)
 #define net_stats_update_filter_rx_local_drop(iface)
+#define net_stats_aggregate()
 #endif /* CONFIG_NET_STATISTICS */
 
 #if defined(CONFIG_NET_STATISTICS_IPV6) && defined(CONFIG_NET_NATIVE_IPV6)
@@ -543,7 +588,7 @@ static inline void net_stats_update_tc_sent_bytes(struct net_if *iface,
 static inline void net_stats_update_tc_sent_priority(struct net_if *iface,
 						     uint8_t tc, uint8_t priority)
 {
-	UPDATE_STAT(iface, stats.tc.sent[tc].priority = priority);
+	UPDATE_STAT_SET(iface, stats.tc.sent[tc].priority = priority);
 }
 
 #if defined(CONFIG_NET_PKT_TXTIME_STATS) && \
@@ -649,7 +694,7 @@ static inline void net_stats_update_tc_recv_bytes(struct net_if *iface,
 static inline void net_stats_update_tc_recv_priority(struct net_if *iface,
 						     uint8_t tc, uint8_t priority)
 {
-	UPDATE_STAT(iface, stats.tc.recv[tc].priority = priority);
+	UPDATE_STAT_SET(iface, stats.tc.recv[tc].priority = priority);
 }
 #else
 static inline void net_stats_update_tc_sent_pkt(struct net_if *iface, uint8_t tc)
@@ -770,7 +815,7 @@ static inline void net_stats_update_tc_rx_time_detail(struct net_if *iface,
 static inline void net_stats_add_suspend_start_time(struct net_if *iface,
 						    uint32_t time)
 {
-	UPDATE_STAT(iface, stats.pm.start_time = time);
+	UPDATE_STAT_SET(iface, stats.pm.start_time = time);
 }
 
 static inline void net_stats_add_suspend_end_time(struct net_if *iface,
@@ -779,8 +824,8 @@ static inline void net_stats_add_suspend_end_time(struct net_if *iface,
 	uint32_t diff_time =
 		k_cyc_to_ms_floor32(time - GET_STAT(iface, pm.start_time));
 
-	UPDATE_STAT(iface, stats.pm.start_time = 0);
-	UPDATE_STAT(iface, stats.pm.last_suspend_time = diff_time);
+	UPDATE_STAT_SET(iface, stats.pm.start_time = 0);
+	UPDATE_STAT_SET(iface, stats.pm.last_suspend_time = diff_time);
 	UPDATE_STAT(iface, stats.pm.suspend_count++);
 	UPDATE_STAT(iface, stats.pm.overall_suspend_time += diff_time);
 }
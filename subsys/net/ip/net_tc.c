@@ -43,14 +43,28 @@ BUILD_ASSERT(NET_TC_TX_SLOTS > 0,
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
 #define NET_TC_RETRY_CNT 1
 #endif
+
+/* With transmit packet steering each traffic class gets one queue and
+ * handler thread per CPU, and senders use the queue of the CPU they are
+ * running on.
+ */
+#if defined(CONFIG_NET_TC_TX_XPS)
+#define NET_TC_TX_QUEUES_PER_CLASS CONFIG_MP_MAX_NUM_CPUS
+#else
+#define NET_TC_TX_QUEUES_PER_CLASS 1
+#endif
+
+#define NET_TC_TX_QUEUE_COUNT (NET_TC_TX_COUNT * NET_TC_TX_QUEUES_PER_CLASS)
+
 /* Template for thread name. The "xx" is either "TX" denoting transmit thread,
- * or "RX" denoting receive thread. The "q[y]" denotes the traffic class queue
- * where y indicates the traffic class id. The value of y can be from 0 to 7.
+ * or "RX" denoting receive thread. The "q[yy]" denotes the traffic class queue
+ * where yy indicates the queue id. The value of yy can be from 0 to 7, or up
+ * to 8 * CONFIG_MP_MAX_NUM_CPUS - 1 with per-CPU transmit queues.
  */
-#define MAX_NAME_LEN sizeof("xx_q[y]")
+#define MAX_NAME_LEN sizeof("xx_q[yy]")
 
 /* Stacks for TX work queue */
-K_KERNEL_STACK_ARRAY_DEFINE(tx_stack, NET_TC_TX_COUNT,
+K_KERNEL_STACK_ARRAY_DEFINE(tx_stack, NET_TC_TX_QUEUE_COUNT,
 			    CONFIG_NET_TX_STACK_SIZE);
 
 /* Stacks for RX work queue */
@@ -58,7 +72,21 @@ K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_COUNT,
 			    CONFIG_NET_RX_STACK_SIZE);
 
 #if NET_TC_TX_COUNT > 0
-static struct net_traffic_class tx_classes[NET_TC_TX_COUNT];
+static struct net_traffic_class tx_classes[NET_TC_TX_QUEUE_COUNT];
+
+/* Map a traffic class to the TX queue used by this CPU */
+static inline int tx_tc2queue(uint8_t tc)
+{
+#if defined(CONFIG_NET_TC_TX_XPS)
+	/* The CPU id is only a steering hint; if the thread migrates
+	 * right after reading it, the packet just lands in another
+	 * CPU's queue and is still sent normally.
+	 */
+	return tc * NET_TC_TX_QUEUES_PER_CLASS + arch_curr_cpu()->id;
+#else
+	return tc;
+#endif
+}
 #endif
 
 #if NET_TC_RX_COUNT > 0
@@ -69,15 +97,17 @@ enum net_verdict net_tc_try_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt,
 					       k_timeout_t timeout)
 {
 #if NET_TC_TX_COUNT > 0
+	struct net_traffic_class *tx_class = &tx_classes[tx_tc2queue(tc)];
+
 	net_pkt_set_tx_stats_tick(pkt, k_cycle_get_32());
 
 #if NET_TC_TX_EFFECTIVE_COUNT > 1
-	if (k_sem_take(&tx_classes[tc].fifo_slot, timeout) != 0) {
+	if (k_sem_take(&tx_class->fifo_slot, timeout) != 0) {
 		return NET_DROP;
 	}
 #endif
 
-	k_fifo_put(&tx_classes[tc].fifo, pkt);
+	k_fifo_put(&tx_class->fifo, pkt);
 	return NET_OK;
 #else
 	ARG_UNUSED(tc);
@@ -294,15 +324,36 @@ static void tc_rx_handler(void *p1, void *p2, void *p3)
 	struct k_sem *fifo_slot = p2;
 #else
 	ARG_UNUSED(p2);
+#endif
+#if CONFIG_NET_TC_RX_POLL_TIME_US > 0
+	k_timepoint_t poll_end = sys_timepoint_calc(K_NO_WAIT);
 #endif
 	struct net_pkt *pkt;
 
 	while (1) {
-		pkt = k_fifo_get(fifo, K_FOREVER);
+		pkt = k_fifo_get(fifo, K_NO_WAIT);
 		if (pkt == NULL) {
-			continue;
+#if CONFIG_NET_TC_RX_POLL_TIME_US > 0
+			/* The queue ran empty but during a burst the next
+			 * packet is typically already on its way, so poll
+			 * for a short while before paying the sleep/wakeup.
+			 */
+			if (!sys_timepoint_expired(poll_end)) {
+				k_yield();
+				continue;
+			}
+#endif
+			pkt = k_fifo_get(fifo, K_FOREVER);
+			if (pkt == NULL) {
+				continue;
+			}
 		}
 
+#if CONFIG_NET_TC_RX_POLL_TIME_US > 0
+		poll_end = sys_timepoint_calc(
+			K_USEC(CONFIG_NET_TC_RX_POLL_TIME_US));
+#endif
+
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
 		k_sem_give(fifo_slot);
 #endif
@@ -357,12 +408,12 @@ void net_tc_tx_init(void)
 	net_if_foreach(net_tc_tx_stats_priority_setup, NULL);
 #endif
 
-	for (i = 0; i < NET_TC_TX_COUNT; i++) {
+	for (i = 0; i < NET_TC_TX_QUEUE_COUNT; i++) {
 		uint8_t thread_priority;
 		int priority;
 		k_tid_t tid;
 
-		thread_priority = tx_tc2thread(i);
+		thread_priority = tx_tc2thread(i / NET_TC_TX_QUEUES_PER_CLASS);
 
 		priority = IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE) ?
 			K_PRIO_COOP(thread_priority) :
@@ -406,6 +457,14 @@ void net_tc_tx_init(void)
 			k_thread_name_set(tid, name);
 		}
 
+#if defined(CONFIG_NET_CORE_AFFINITY)
+		/* Keep the network hot path on its dedicated CPU */
+		k_thread_cpu_pin(tid, CONFIG_NET_CORE_AFFINITY_CPU);
+#elif defined(CONFIG_NET_TC_TX_XPS) && defined(CONFIG_SCHED_CPU_MASK)
+		/* Keep the packet processing cache-local to the sender */
+		k_thread_cpu_pin(tid, i % NET_TC_TX_QUEUES_PER_CLASS);
+#endif
+
 		k_thread_start(tid);
 	}
 #endif
@@ -474,6 +533,11 @@ void net_tc_rx_init(void)
 			k_thread_name_set(tid, name);
 		}
 
+#if defined(CONFIG_NET_CORE_AFFINITY)
+		/* Keep the network hot path on its dedicated CPU */
+		k_thread_cpu_pin(tid, CONFIG_NET_CORE_AFFINITY_CPU);
+#endif
+
 		k_thread_start(tid);
 	}
 #endif
@@ -443,6 +443,187 @@ static void tcp_derive_rto(struct tcp *conn)
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
+#if defined(CONFIG_NET_TCP_CONGESTION_CUBIC)
+
+/* Implementation according to RFC8312, using fixed point arithmetic only */
+
+/* Multiplicative decrease factor: the window is scaled by 7/10 on a
+ * congestion event instead of NewReno's 1/2 (RFC8312 chapter 4.5).
+ */
+#define CUBIC_BETA_NUM		7
+#define CUBIC_BETA_DEN		10
+
+static void tcp_cubic_log(struct tcp *conn, char *step)
+{
+	NET_DBG("conn: %p, ca %s, cwnd=%d, ssthres=%d, w_max=%d, fast_pend=%i",
+		conn, step, conn->ca.cwnd, conn->ca.ssthresh, conn->ca.w_max,
+		conn->ca.pending_fast_retransmit_bytes);
+}
+
+/* Digit-by-digit integer cube root, used for the CUBIC K coefficient */
+static uint32_t cubic_cbrt(uint64_t value)
+{
+	uint64_t result = 0U;
+
+	for (int shift = 63; shift >= 0; shift -= 3) {
+		uint64_t bit;
+
+		result <<= 1;
+		bit = 3U * result * (result + 1U) + 1U;
+		if ((value >> shift) >= bit) {
+			value -= bit << shift;
+			result++;
+		}
+	}
+
+	return (uint32_t)result;
+}
+
+/* Congestion window prescribed by the cubic function at the current time,
+ * W_cubic(t) = C * (t - K)^3 + w_max (RFC8312 chapter 4.1), with C = 0.4.
+ */
+static uint16_t cubic_target_cwnd(struct tcp *conn)
+{
+	uint16_t mss = conn_mss(conn);
+	uint32_t t_ms = k_uptime_get_32() - conn->ca.epoch_start;
+	uint32_t w_max_mss = MAX(conn->ca.w_max / mss, 2U);
+	int64_t d_ms, offs, target_mss;
+	uint32_t k_ms;
+
+	/* K = cbrt(w_max * (1 - beta) / C) seconds; with beta = 0.7 and
+	 * C = 0.4 this is cbrt(0.75 * w_max) s, or cbrt(750e6 * w_max) ms.
+	 */
+	k_ms = cubic_cbrt(750000000ULL * w_max_mss);
+
+	/* Limit the time since the congestion event so that computing the
+	 * cube below cannot overflow.
+	 */
+	d_ms = MIN((int64_t)t_ms, 600000) - (int64_t)k_ms;
+
+	/* C * d^3 with time in ms: 0.4 * d^3 / 1e9 = 2 * d^3 / 5e9 */
+	offs = (2 * d_ms * d_ms * d_ms) / 5000000000LL;
+
+	target_mss = CLAMP((int64_t)w_max_mss + offs, 2, UINT16_MAX / mss);
+
+	return (uint16_t)(target_mss * mss);
+}
+
+static void tcp_cubic_init(struct tcp *conn)
+{
+	conn->ca.cwnd = conn_mss(conn) * TCP_CONGESTION_INITIAL_WIN;
+	conn->ca.ssthresh = conn_mss(conn) * TCP_CONGESTION_INITIAL_SSTHRESH;
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	conn->ca.w_max = conn->ca.cwnd;
+	conn->ca.epoch_start = k_uptime_get_32();
+	tcp_cubic_log(conn, "init");
+}
+
+static void tcp_cubic_congestion_event(struct tcp *conn)
+{
+	conn->ca.w_max = conn->ca.cwnd;
+	conn->ca.epoch_start = k_uptime_get_32();
+	conn->ca.ssthresh = MAX(((uint32_t)conn->ca.cwnd * CUBIC_BETA_NUM) /
+				CUBIC_BETA_DEN,
+				conn_mss(conn) * 2);
+}
+
+static void tcp_cubic_fast_retransmit(struct tcp *conn)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		tcp_cubic_congestion_event(conn);
+		/* Account for the lost segments */
+		conn->ca.cwnd = conn_mss(conn) * 3 + conn->ca.ssthresh;
+		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
+		tcp_cubic_log(conn, "fast_retransmit");
+	}
+}
+
+static void tcp_cubic_timeout(struct tcp *conn)
+{
+	tcp_cubic_congestion_event(conn);
+	conn->ca.cwnd = conn_mss(conn);
+	tcp_cubic_log(conn, "timeout");
+}
+
+/* For every duplicate ack increment the cwnd by mss */
+static void tcp_cubic_dup_ack(struct tcp *conn)
+{
+	int32_t new_win = conn->ca.cwnd;
+
+	new_win += conn_mss(conn);
+	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	tcp_cubic_log(conn, "dup_ack");
+}
+
+static void tcp_cubic_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	int32_t new_win = conn->ca.cwnd;
+	int32_t win_inc = MIN(acked_len, conn_mss(conn));
+
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		if (conn->ca.cwnd < conn->ca.ssthresh) {
+			/* Slow start, as with NewReno */
+			new_win += win_inc;
+		} else {
+			uint16_t target = cubic_target_cwnd(conn);
+
+			if (target > conn->ca.cwnd) {
+				/* Approach the cubic curve, at most one mss
+				 * per received acknowledgment
+				 */
+				new_win += MIN(target - conn->ca.cwnd,
+					       conn_mss(conn));
+			} else {
+				/* On the plateau around w_max, fall back to
+				 * growing at the NewReno rate as a lower
+				 * bound (TCP friendly region, RFC8312
+				 * chapter 4.2)
+				 */
+				new_win += ((win_inc * win_inc) +
+					    conn->ca.cwnd - 1) / conn->ca.cwnd;
+			}
+		}
+		conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	} else {
+		/* Check if it is still in fast recovery mode */
+		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
+			conn->ca.pending_fast_retransmit_bytes = 0;
+			conn->ca.cwnd = conn->ca.ssthresh;
+		} else {
+			conn->ca.pending_fast_retransmit_bytes -= acked_len;
+			conn->ca.cwnd -= acked_len;
+		}
+	}
+	tcp_cubic_log(conn, "pkts_acked");
+}
+
+static void tcp_ca_init(struct tcp *conn)
+{
+	tcp_cubic_init(conn);
+}
+
+static void tcp_ca_fast_retransmit(struct tcp *conn)
+{
+	tcp_cubic_fast_retransmit(conn);
+}
+
+static void tcp_ca_timeout(struct tcp *conn)
+{
+	tcp_cubic_timeout(conn);
+}
+
+static void tcp_ca_dup_ack(struct tcp *conn)
+{
+	tcp_cubic_dup_ack(conn);
+}
+
+static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	tcp_cubic_pkts_acked(conn, acked_len);
+}
+
+#else
+
 /* Implementation according to RFC6582 */
 
 static void tcp_new_reno_log(struct tcp *conn, char *step)
@@ -538,6 +719,8 @@ static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
 	tcp_new_reno_pkts_acked(conn, acked_len);
 }
+
+#endif /* CONFIG_NET_TCP_CONGESTION_CUBIC */
 #else
 
 static void tcp_ca_init(struct tcp *conn) { }
@@ -1100,6 +1283,7 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	recv_options->mss_found = false;
 	recv_options->wnd_found = false;
+	recv_options->sack_permitted = false;
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -1148,6 +1332,14 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+		case NET_TCP_SACK_PERMITTED_OPT:
+			if (opt_len != NET_TCP_SACK_PERMITTED_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_permitted = true;
+			break;
 		default:
 			continue;
 		}
@@ -1182,6 +1374,69 @@ static bool tcp_need_window_update(struct tcp *conn)
 		conn->recv_win_sent <= threshold);
 }
 
+#ifdef CONFIG_NET_TCP_RECV_WINDOW_AUTOTUNE
+/* Adjust the maximum receive window based on how fast the application
+ * drains it and on receive buffer pool pressure. The window grows by one
+ * MSS every time a full window is drained quickly, and is halved when the
+ * receive buffer pool runs low. Must be called with the connection lock
+ * held.
+ */
+static void tcp_autotune_recv_wnd(struct tcp *conn, bool short_win_before,
+				  bool short_win_after)
+{
+	struct net_buf_pool *rx_data_pool = NULL;
+	uint16_t win_floor;
+	uint32_t avail;
+
+	net_pkt_get_info(NULL, NULL, &rx_data_pool, NULL);
+	avail = (uint32_t)atomic_get(&rx_data_pool->avail_count);
+
+	if (avail < rx_data_pool->buf_count / 8) {
+		/* Running out of receive buffers, back off towards the
+		 * configured default so that a single connection cannot
+		 * starve the rest of the stack.
+		 */
+		win_floor = MIN(tcp_rx_window, conn->recv_win_ceiling);
+		conn->recv_win_max = MAX(win_floor, conn->recv_win_max / 2);
+		if (conn->recv_win > conn->recv_win_max) {
+			conn->recv_win = conn->recv_win_max;
+		}
+
+		conn->win_drain_pending = false;
+		return;
+	}
+
+	if (!short_win_before && short_win_after) {
+		/* The peer filled the advertised window, start measuring
+		 * how long the application takes to drain it.
+		 */
+		conn->win_drain_pending = true;
+		conn->win_short_since = k_uptime_get_32();
+	} else if (conn->win_drain_pending &&
+		   conn->recv_win == conn->recv_win_max) {
+		uint32_t drain_ms = k_uptime_get_32() - conn->win_short_since;
+
+		conn->win_drain_pending = false;
+
+		/* A full window drained within one initial RTO means the
+		 * connection is window limited rather than application
+		 * limited, so advertise a larger window as long as there
+		 * is enough margin in the receive buffer pool.
+		 */
+		if (drain_ms <= (uint32_t)tcp_rto &&
+		    avail >= rx_data_pool->buf_count / 2 &&
+		    conn->recv_win_max < conn->recv_win_ceiling) {
+			uint32_t new_max = MIN((uint32_t)conn->recv_win_max +
+					       conn_mss(conn),
+					       conn->recv_win_ceiling);
+
+			conn->recv_win += new_max - conn->recv_win_max;
+			conn->recv_win_max = (uint16_t)new_max;
+		}
+	}
+}
+#endif /* CONFIG_NET_TCP_RECV_WINDOW_AUTOTUNE */
+
 /**
  * @brief Update TCP receive window
  *
@@ -1210,6 +1465,12 @@ static int tcp_update_recv_wnd(struct tcp *conn, int32_t delta)
 
 	short_win_after = tcp_short_window(conn);
 
+#ifdef CONFIG_NET_TCP_RECV_WINDOW_AUTOTUNE
+	if (conn->state == TCP_ESTABLISHED) {
+		tcp_autotune_recv_wnd(conn, short_win_before, short_win_after);
+	}
+#endif
+
 	if (((short_win_before && !short_win_after) ||
 	     tcp_need_window_update(conn)) &&
 	    conn->state == TCP_ESTABLISHED) {
@@ -1338,6 +1599,76 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 	return -EINVAL;
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+/* The SACK-permitted option is offered on every SYN we send.  A SACK
+ * block is appended to an ACK whenever the out-of-order queue holds
+ * data, so the peer can retransmit just the hole in front of it.  Both
+ * tests must give the same answer in tcp_out_ext(), tcp_header_add()
+ * and the option writers; they all run back to back under conn->lock,
+ * so the queue cannot change in between.
+ */
+static bool tcp_opt_sack_permitted(struct tcp *conn, uint8_t flags)
+{
+	ARG_UNUSED(conn);
+
+	return (flags & SYN) == SYN;
+}
+
+static bool tcp_opt_sack_block(struct tcp *conn, uint8_t flags)
+{
+	return conn->sack_enabled && ((flags & SYN) == 0U) &&
+		((flags & ACK) == ACK) && (conn->queue_recv_data != NULL) &&
+		!net_pkt_is_empty(conn->queue_recv_data);
+}
+
+static int net_tcp_set_sack_permitted_opt(struct tcp *conn, struct net_pkt *pkt)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(sack_opt_access, uint32_t);
+	uint32_t *opt;
+
+	ARG_UNUSED(conn);
+
+	opt = net_pkt_get_data(pkt, &sack_opt_access);
+	if (!opt) {
+		return -ENOBUFS;
+	}
+
+	/* SACK-permitted padded to 32 bits with two NOPs */
+	UNALIGNED_PUT(htonl((NET_TCP_SACK_PERMITTED_OPT << 24) |
+			    (NET_TCP_SACK_PERMITTED_SIZE << 16) |
+			    (NET_TCP_NOP_OPT << 8) | NET_TCP_NOP_OPT), opt);
+
+	return net_pkt_set_data(pkt, &sack_opt_access);
+}
+
+static int net_tcp_set_sack_opt(struct tcp *conn, struct net_pkt *pkt)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(sack_opt_access, struct tcp_sack_option);
+	struct tcp_sack_option *sack;
+	struct net_buf *last;
+
+	sack = net_pkt_get_data(pkt, &sack_opt_access);
+	if (!sack) {
+		return -ENOBUFS;
+	}
+
+	/* The out-of-order queue is a single contiguous range, so one
+	 * SACK block describes it completely.
+	 */
+	last = net_buf_frag_last(conn->queue_recv_data->buffer);
+
+	sack->nop1 = NET_TCP_NOP_OPT;
+	sack->nop2 = NET_TCP_NOP_OPT;
+	sack->kind = NET_TCP_SACK_OPT;
+	sack->length = sizeof(struct tcp_sack_option) - 2 * NET_TCP_NOP_SIZE;
+	UNALIGNED_PUT(htonl(tcp_get_seq(conn->queue_recv_data->buffer)),
+		      &sack->left_edge);
+	UNALIGNED_PUT(htonl(tcp_get_seq(last) + last->len), &sack->right_edge);
+
+	return net_pkt_set_data(pkt, &sack_opt_access);
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 			  uint32_t seq)
 {
@@ -1359,6 +1690,16 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 		th->th_off++;
 	}
 
+#if defined(CONFIG_NET_TCP_SACK)
+	if (tcp_opt_sack_permitted(conn, flags)) {
+		th->th_off++;
+	}
+
+	if (tcp_opt_sack_block(conn, flags)) {
+		th->th_off += sizeof(struct tcp_sack_option) / sizeof(uint32_t);
+	}
+#endif
+
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(htons(conn->recv_win), &th->th_win);
 	UNALIGNED_PUT(htonl(seq), &th->th_seq);
@@ -1549,6 +1890,16 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		alloc_len += sizeof(uint32_t);
 	}
 
+#if defined(CONFIG_NET_TCP_SACK)
+	if (tcp_opt_sack_permitted(conn, flags)) {
+		alloc_len += sizeof(uint32_t);
+	}
+
+	if (tcp_opt_sack_block(conn, flags)) {
+		alloc_len += sizeof(struct tcp_sack_option);
+	}
+#endif
+
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1581,6 +1932,24 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+#if defined(CONFIG_NET_TCP_SACK)
+	if (tcp_opt_sack_permitted(conn, flags)) {
+		ret = net_tcp_set_sack_permitted_opt(conn, pkt);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+
+	if (tcp_opt_sack_block(conn, flags)) {
+		ret = net_tcp_set_sack_opt(conn, pkt);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+#endif
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -2128,6 +2497,21 @@ static struct tcp *tcp_conn_alloc(void)
 	conn->recv_win_max = tcp_rx_window;
 	conn->recv_win = conn->recv_win_max;
 	conn->recv_win_sent = conn->recv_win_max;
+#ifdef CONFIG_NET_TCP_RECV_WINDOW_AUTOTUNE
+	/* Leave some margin for other connections and protocols when
+	 * deriving the growth ceiling from the receive buffer pool size.
+	 */
+#if defined(CONFIG_NET_BUF_FIXED_DATA_SIZE)
+	conn->recv_win_ceiling = (uint16_t)MIN(
+		(CONFIG_NET_BUF_RX_COUNT * CONFIG_NET_BUF_DATA_SIZE) * 3U / 4U,
+		UINT16_MAX);
+#else
+	conn->recv_win_ceiling = (uint16_t)MIN(
+		CONFIG_NET_PKT_BUF_RX_DATA_POOL_SIZE * 3U / 4U, UINT16_MAX);
+#endif /* CONFIG_NET_BUF_FIXED_DATA_SIZE */
+	conn->recv_win_ceiling = MAX(conn->recv_win_ceiling,
+				     conn->recv_win_max);
+#endif /* CONFIG_NET_TCP_RECV_WINDOW_AUTOTUNE */
 	conn->send_win_max = MAX(tcp_tx_window, NET_IPV6_MTU);
 	conn->send_win = conn->send_win_max;
 	conn->tcp_nodelay = false;
@@ -2792,6 +3176,12 @@ static void tcp_check_sock_options(struct tcp *conn)
 
 		diff = rcvbuf_opt - conn->recv_win_max;
 		conn->recv_win_max = rcvbuf_opt;
+#ifdef CONFIG_NET_TCP_RECV_WINDOW_AUTOTUNE
+		/* SO_RCVBUF sets a hard per-socket ceiling for the
+		 * auto-tuned window.
+		 */
+		conn->recv_win_ceiling = rcvbuf_opt;
+#endif
 		tcp_update_recv_wnd(conn, diff);
 
 		k_mutex_unlock(&conn->lock);
@@ -2929,6 +3319,9 @@ next_state:
 		if (FL(&fl, ==, SYN)) {
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
+#if defined(CONFIG_NET_TCP_SACK)
+			conn->sack_enabled = conn->recv_options.sack_permitted;
+#endif
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
 			tcp_out(conn, SYN | ACK);
 			conn->send_options.mss_found = false;
@@ -3052,6 +3445,9 @@ next_state:
 		 */
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			tcp_send_timer_cancel(conn);
+#if defined(CONFIG_NET_TCP_SACK)
+			conn->sack_enabled = conn->recv_options.sack_permitted;
+#endif
 			conn_ack(conn, th_seq(th) + 1);
 			if (len) {
 				verdict = tcp_data_get(conn, pkt, &len);
@@ -196,6 +196,16 @@ struct tcp_mss_option {
 	uint32_t option;
 };
 
+/* Single SACK block, padded to a 32-bit boundary with two NOPs */
+struct tcp_sack_option {
+	uint8_t nop1;
+	uint8_t nop2;
+	uint8_t kind;
+	uint8_t length;
+	uint32_t left_edge;
+	uint32_t right_edge;
+};
+
 enum tcp_state {
 	TCP_UNUSED = 0,
 	TCP_LISTEN,
@@ -223,22 +233,26 @@ union tcp_endpoint {
 };
 
 /* TCP Option codes */
-#define NET_TCP_END_OPT          0
-#define NET_TCP_NOP_OPT          1
-#define NET_TCP_MSS_OPT          2
-#define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_END_OPT            0
+#define NET_TCP_NOP_OPT            1
+#define NET_TCP_MSS_OPT            2
+#define NET_TCP_WINDOW_SCALE_OPT   3
+#define NET_TCP_SACK_PERMITTED_OPT 4
+#define NET_TCP_SACK_OPT           5
 
 /* TCP Option sizes */
-#define NET_TCP_END_SIZE          1
-#define NET_TCP_NOP_SIZE          1
-#define NET_TCP_MSS_SIZE          4
-#define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_END_SIZE            1
+#define NET_TCP_NOP_SIZE            1
+#define NET_TCP_MSS_SIZE            4
+#define NET_TCP_WINDOW_SCALE_SIZE   3
+#define NET_TCP_SACK_PERMITTED_SIZE 2
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
 	bool mss_found : 1;
 	bool wnd_found : 1;
+	bool sack_permitted : 1;
 };
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
@@ -248,6 +262,18 @@ struct tcp_collision_avoidance_reno {
 	uint16_t ssthresh;
 	uint16_t pending_fast_retransmit_bytes;
 };
+
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+struct tcp_collision_avoidance_cubic {
+	uint16_t cwnd;
+	uint16_t ssthresh;
+	uint16_t pending_fast_retransmit_bytes;
+	/* Congestion window at the last congestion event */
+	uint16_t w_max;
+	/* Uptime (in ms) of the last congestion event */
+	uint32_t epoch_start;
+};
+#endif
 #endif
 
 struct tcp;
@@ -319,11 +345,23 @@ struct tcp { /* TCP connection */
 	uint16_t recv_win;
 	uint16_t send_win_max;
 	uint16_t send_win;
+#ifdef CONFIG_NET_TCP_RECV_WINDOW_AUTOTUNE
+	/* Time when the receive window went short, for measuring how fast
+	 * the application drains it.
+	 */
+	uint32_t win_short_since;
+	/* Upper bound for the auto-tuned receive window. */
+	uint16_t recv_win_ceiling;
+#endif
 #ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
 	uint16_t rto;
 #endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+	struct tcp_collision_avoidance_cubic ca;
+#else
 	struct tcp_collision_avoidance_reno ca;
+#endif
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
@@ -339,6 +377,12 @@ struct tcp { /* TCP connection */
 	bool tcp_nodelay : 1;
 	bool addr_ref_done : 1;
 	bool rst_received : 1;
+#if defined(CONFIG_NET_TCP_SACK)
+	bool sack_enabled : 1;
+#endif
+#ifdef CONFIG_NET_TCP_RECV_WINDOW_AUTOTUNE
+	bool win_drain_pending : 1;
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
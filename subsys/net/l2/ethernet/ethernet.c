@@ -24,6 +24,7 @@ LOG_MODULE_REGISTER(net_ethernet, CONFIG_NET_L2_ETHERNET_LOG_LEVEL);
 
 #include "arp.h"
 #include "eth_stats.h"
+#include "fast_resp.h"
 #include "net_private.h"
 #include "ipv6.h"
 #include "ipv4.h"
@@ -376,6 +377,20 @@ static enum net_verdict ethernet_recv(struct net_if *iface,
 		goto drop;
 	}
 
+#if defined(CONFIG_NET_ETHERNET_FAST_RESPONDER)
+	if (!is_vlan_pkt) {
+		/* Capture the length before the responder as the packet
+		 * ownership moves to the TX path if it answers.
+		 */
+		body_len = net_pkt_get_len(pkt) - hdr_len;
+
+		if (net_eth_fast_resp_input(iface, pkt, type) == NET_OK) {
+			verdict = NET_OK;
+			goto out;
+		}
+	}
+#endif /* CONFIG_NET_ETHERNET_FAST_RESPONDER */
+
 	/* Get rid of the Ethernet header. */
 	net_buf_pull(pkt->frags, hdr_len);
 
@@ -708,6 +723,14 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 		goto send;
 	}
 
+	/* Replies generated by the fast responder are complete frames
+	 * as well, send them as is.
+	 */
+	if (IS_ENABLED(CONFIG_NET_ETHERNET_FAST_RESPONDER) &&
+	    net_pkt_is_eth_fast_resp(pkt)) {
+		goto send;
+	}
+
 	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET &&
 	    net_pkt_ll_proto_type(pkt) == NET_ETH_PTYPE_IP) {
 		if (!net_pkt_ipv4_acd(pkt)) {
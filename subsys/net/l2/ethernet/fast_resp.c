@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_eth_fast_resp, CONFIG_NET_L2_ETHERNET_LOG_LEVEL);
+
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/icmp.h>
+#include <zephyr/net/ethernet.h>
+
+#include "icmpv6.h"
+#include "fast_resp.h"
+
+/* The responder works on the first fragment only; any packet whose
+ * relevant headers are not linear there is handed to the normal stack.
+ * The incoming checksum is deliberately not verified: replies to echo
+ * requests are fixed up incrementally (RFC 1624), so a corrupted request
+ * produces a reply with an equally bad checksum that the sender discards,
+ * which is equivalent to us dropping the request.
+ */
+
+static uint32_t fast_resp_csum_add(uint32_t sum, const uint8_t *data,
+				   size_t len)
+{
+	while (len >= 2U) {
+		sum += ((uint16_t)data[0] << 8) | data[1];
+		data += 2;
+		len -= 2U;
+	}
+
+	if (len > 0U) {
+		sum += (uint16_t)data[0] << 8;
+	}
+
+	return sum;
+}
+
+static uint16_t fast_resp_csum_fold(uint32_t sum)
+{
+	while ((sum >> 16) != 0U) {
+		sum = (sum & 0xffffU) + (sum >> 16);
+	}
+
+	return (uint16_t)~sum;
+}
+
+/* RFC 1624 incremental checksum update, all values in host byte order. */
+static uint16_t fast_resp_csum_update(uint16_t chksum, uint16_t old_word,
+				      uint16_t new_word)
+{
+	uint32_t sum = (uint16_t)~chksum;
+
+	sum += (uint16_t)~old_word;
+	sum += new_word;
+
+	return fast_resp_csum_fold(sum);
+}
+
+static enum net_verdict fast_resp_send(struct net_if *iface,
+				       struct net_pkt *pkt)
+{
+	net_pkt_set_eth_fast_resp(pkt, true);
+
+	NET_DBG("Replying to pkt %p at L2 iface %d", pkt,
+		net_if_get_by_iface(iface));
+
+	net_if_queue_tx(iface, pkt);
+
+	return NET_OK;
+}
+
+#if defined(CONFIG_NET_IPV4)
+static enum net_verdict fast_resp_ipv4_echo(struct net_if *iface,
+					    struct net_pkt *pkt)
+{
+	struct net_buf *frag = pkt->buffer;
+	struct net_eth_hdr *eth_hdr = (struct net_eth_hdr *)frag->data;
+	struct net_ipv4_hdr *ip_hdr;
+	struct net_icmp_hdr *icmp_hdr;
+	struct net_if *addr_iface = NULL;
+	uint8_t addr[NET_IPV4_ADDR_SIZE];
+	struct in_addr dst_addr;
+
+	if (frag->len < sizeof(struct net_eth_hdr) + NET_IPV4H_LEN +
+			NET_ICMPH_LEN + sizeof(uint32_t)) {
+		return NET_CONTINUE;
+	}
+
+	ip_hdr = (struct net_ipv4_hdr *)(frag->data +
+					 sizeof(struct net_eth_hdr));
+
+	/* No IPv4 options and no fragments on the fast path. */
+	if (ip_hdr->vhl != 0x45U ||
+	    (ip_hdr->offset[0] & 0x3fU) != 0U || ip_hdr->offset[1] != 0U ||
+	    ip_hdr->proto != IPPROTO_ICMP) {
+		return NET_CONTINUE;
+	}
+
+	if (ntohs(ip_hdr->len) >
+	    net_pkt_get_len(pkt) - sizeof(struct net_eth_hdr)) {
+		return NET_CONTINUE;
+	}
+
+	icmp_hdr = (struct net_icmp_hdr *)(frag->data +
+					   sizeof(struct net_eth_hdr) +
+					   NET_IPV4H_LEN);
+
+	if (icmp_hdr->type != NET_ICMPV4_ECHO_REQUEST ||
+	    icmp_hdr->code != 0U) {
+		return NET_CONTINUE;
+	}
+
+	/* Only answer for our own unicast addresses, the stack handles
+	 * broadcast/multicast echo policy.
+	 */
+	memcpy(&dst_addr, ip_hdr->dst, sizeof(dst_addr));
+
+	if (net_if_ipv4_addr_lookup(&dst_addr, &addr_iface) == NULL ||
+	    addr_iface != iface) {
+		return NET_CONTINUE;
+	}
+
+	memcpy(eth_hdr->dst.addr, eth_hdr->src.addr, sizeof(eth_hdr->dst.addr));
+	memcpy(eth_hdr->src.addr, net_if_get_link_addr(iface)->addr,
+	       sizeof(eth_hdr->src.addr));
+
+	memcpy(addr, ip_hdr->src, sizeof(addr));
+	memcpy(ip_hdr->src, ip_hdr->dst, sizeof(addr));
+	memcpy(ip_hdr->dst, addr, sizeof(addr));
+
+	ip_hdr->ttl = net_if_ipv4_get_ttl(iface);
+	ip_hdr->chksum = 0U;
+	ip_hdr->chksum = htons(fast_resp_csum_fold(
+		fast_resp_csum_add(0U, (uint8_t *)ip_hdr, NET_IPV4H_LEN)));
+
+	icmp_hdr->type = NET_ICMPV4_ECHO_REPLY;
+	icmp_hdr->chksum = htons(fast_resp_csum_update(
+		ntohs(icmp_hdr->chksum),
+		(uint16_t)NET_ICMPV4_ECHO_REQUEST << 8,
+		(uint16_t)NET_ICMPV4_ECHO_REPLY << 8));
+
+	return fast_resp_send(iface, pkt);
+}
+#endif /* CONFIG_NET_IPV4 */
+
+#if defined(CONFIG_NET_IPV6)
+/* ICMPv6 part of a neighbor solicitation with a single source
+ * link-layer address option: 4 bytes ICMPv6 header, 4 bytes reserved,
+ * 16 bytes target address, 8 bytes option.
+ */
+#define FAST_RESP_NS_LEN (NET_ICMPH_LEN + 4U + NET_IPV6_ADDR_SIZE + 8U)
+
+static uint16_t fast_resp_ipv6_csum(struct net_ipv6_hdr *ip_hdr,
+				    const uint8_t *data, uint16_t len)
+{
+	uint32_t sum;
+
+	sum = fast_resp_csum_add(0U, ip_hdr->src, NET_IPV6_ADDR_SIZE);
+	sum = fast_resp_csum_add(sum, ip_hdr->dst, NET_IPV6_ADDR_SIZE);
+	sum += len;
+	sum += IPPROTO_ICMPV6;
+
+	return fast_resp_csum_fold(fast_resp_csum_add(sum, data, len));
+}
+
+static enum net_verdict fast_resp_ipv6(struct net_if *iface,
+				       struct net_pkt *pkt)
+{
+	struct net_buf *frag = pkt->buffer;
+	struct net_eth_hdr *eth_hdr = (struct net_eth_hdr *)frag->data;
+	struct net_ipv6_hdr *ip_hdr;
+	struct net_icmp_hdr *icmp_hdr;
+	struct in6_addr addr;
+	uint16_t payload_len;
+	uint8_t tmp[NET_IPV6_ADDR_SIZE];
+
+	if (frag->len < sizeof(struct net_eth_hdr) + NET_IPV6H_LEN +
+			NET_ICMPH_LEN + sizeof(uint32_t)) {
+		return NET_CONTINUE;
+	}
+
+	ip_hdr = (struct net_ipv6_hdr *)(frag->data +
+					 sizeof(struct net_eth_hdr));
+
+	/* Extension headers take the normal input path. */
+	if ((ip_hdr->vtc & 0xf0U) != 0x60U ||
+	    ip_hdr->nexthdr != IPPROTO_ICMPV6) {
+		return NET_CONTINUE;
+	}
+
+	payload_len = ntohs(ip_hdr->len);
+	if (payload_len > net_pkt_get_len(pkt) -
+			  sizeof(struct net_eth_hdr) - NET_IPV6H_LEN) {
+		return NET_CONTINUE;
+	}
+
+	icmp_hdr = (struct net_icmp_hdr *)(frag->data +
+					   sizeof(struct net_eth_hdr) +
+					   NET_IPV6H_LEN);
+
+	if (icmp_hdr->type == NET_ICMPV6_ECHO_REQUEST &&
+	    icmp_hdr->code == 0U) {
+		memcpy(&addr, ip_hdr->dst, sizeof(addr));
+
+		/* Multicast echo is left to the stack. */
+		if (net_if_ipv6_addr_lookup_by_iface(iface, &addr) == NULL) {
+			return NET_CONTINUE;
+		}
+
+		memcpy(eth_hdr->dst.addr, eth_hdr->src.addr,
+		       sizeof(eth_hdr->dst.addr));
+		memcpy(eth_hdr->src.addr, net_if_get_link_addr(iface)->addr,
+		       sizeof(eth_hdr->src.addr));
+
+		memcpy(tmp, ip_hdr->src, sizeof(tmp));
+		memcpy(ip_hdr->src, ip_hdr->dst, sizeof(tmp));
+		memcpy(ip_hdr->dst, tmp, sizeof(tmp));
+
+		ip_hdr->hop_limit = net_if_ipv6_get_hop_limit(iface);
+
+		/* Swapping src and dst does not change the pseudo-header
+		 * sum, so only the type word moves.
+		 */
+		icmp_hdr->type = NET_ICMPV6_ECHO_REPLY;
+		icmp_hdr->chksum = htons(fast_resp_csum_update(
+			ntohs(icmp_hdr->chksum),
+			(uint16_t)NET_ICMPV6_ECHO_REQUEST << 8,
+			(uint16_t)NET_ICMPV6_ECHO_REPLY << 8));
+
+		return fast_resp_send(iface, pkt);
+	}
+
+	if (icmp_hdr->type == NET_ICMPV6_NS && icmp_hdr->code == 0U) {
+		uint8_t *ns = (uint8_t *)icmp_hdr;
+		uint8_t *opt = ns + NET_ICMPH_LEN + 4U + NET_IPV6_ADDR_SIZE;
+
+		/* Handle only the common solicitation: hop limit 255,
+		 * exactly one source link-layer address option, all in
+		 * the first fragment. DAD probes (unspecified source)
+		 * must go through the stack.
+		 */
+		if (ip_hdr->hop_limit != 255U ||
+		    payload_len != FAST_RESP_NS_LEN ||
+		    frag->len < sizeof(struct net_eth_hdr) + NET_IPV6H_LEN +
+				FAST_RESP_NS_LEN ||
+		    opt[0] != NET_ICMPV6_ND_OPT_SLLAO || opt[1] != 1U) {
+			return NET_CONTINUE;
+		}
+
+		memcpy(&addr, ip_hdr->src, sizeof(addr));
+		if (net_ipv6_is_addr_unspecified(&addr)) {
+			return NET_CONTINUE;
+		}
+
+		memcpy(&addr, ns + NET_ICMPH_LEN + 4U, sizeof(addr));
+		if (net_if_ipv6_addr_lookup_by_iface(iface, &addr) == NULL) {
+			return NET_CONTINUE;
+		}
+
+		memcpy(eth_hdr->dst.addr, eth_hdr->src.addr,
+		       sizeof(eth_hdr->dst.addr));
+		memcpy(eth_hdr->src.addr, net_if_get_link_addr(iface)->addr,
+		       sizeof(eth_hdr->src.addr));
+
+		/* Advertisement goes back to the solicitation source,
+		 * from the target address.
+		 */
+		memcpy(ip_hdr->dst, ip_hdr->src, NET_IPV6_ADDR_SIZE);
+		memcpy(ip_hdr->src, ns + NET_ICMPH_LEN + 4U,
+		       NET_IPV6_ADDR_SIZE);
+		ip_hdr->hop_limit = 255U;
+
+		icmp_hdr->type = NET_ICMPV6_NA;
+		ns[NET_ICMPH_LEN] = NET_ICMPV6_NA_FLAG_SOLICITED |
+				    NET_ICMPV6_NA_FLAG_OVERRIDE;
+		ns[NET_ICMPH_LEN + 1U] = 0U;
+		ns[NET_ICMPH_LEN + 2U] = 0U;
+		ns[NET_ICMPH_LEN + 3U] = 0U;
+
+		opt[0] = NET_ICMPV6_ND_OPT_TLLAO;
+		memcpy(&opt[2], net_if_get_link_addr(iface)->addr,
+		       sizeof(struct net_eth_addr));
+
+		icmp_hdr->chksum = 0U;
+		icmp_hdr->chksum = htons(fast_resp_ipv6_csum(ip_hdr, ns,
+							     FAST_RESP_NS_LEN));
+
+		return fast_resp_send(iface, pkt);
+	}
+
+	return NET_CONTINUE;
+}
+#endif /* CONFIG_NET_IPV6 */
+
+enum net_verdict net_eth_fast_resp_input(struct net_if *iface,
+					 struct net_pkt *pkt,
+					 uint16_t type)
+{
+#if defined(CONFIG_NET_IPV4)
+	if (type == NET_ETH_PTYPE_IP) {
+		return fast_resp_ipv4_echo(iface, pkt);
+	}
+#endif
+#if defined(CONFIG_NET_IPV6)
+	if (type == NET_ETH_PTYPE_IPV6) {
+		return fast_resp_ipv6(iface, pkt);
+	}
+#endif
+	ARG_UNUSED(iface);
+	ARG_UNUSED(pkt);
+
+	return NET_CONTINUE;
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __FAST_RESP_H
+#define __FAST_RESP_H
+
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(CONFIG_NET_ETHERNET_FAST_RESPONDER)
+/**
+ * @brief Try to answer a received frame directly at L2 input.
+ *
+ * Recognized ICMPv4/v6 echo requests and IPv6 neighbor solicitations
+ * aimed at an address of @p iface are rewritten in place into the
+ * corresponding reply and queued for transmission without traversing
+ * the IP stack.
+ *
+ * @param iface Network interface the frame was received on.
+ * @param pkt Received packet, Ethernet header still in place.
+ * @param type Ethernet protocol type of the frame (host byte order).
+ *
+ * @return NET_OK if the packet was consumed (reply queued),
+ *	   NET_CONTINUE if the packet should take the normal input path.
+ */
+enum net_verdict net_eth_fast_resp_input(struct net_if *iface,
+					 struct net_pkt *pkt,
+					 uint16_t type);
+#else
+static inline enum net_verdict net_eth_fast_resp_input(struct net_if *iface,
+						       struct net_pkt *pkt,
+						       uint16_t type)
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(type);
+
+	return NET_CONTINUE;
+}
+#endif /* CONFIG_NET_ETHERNET_FAST_RESPONDER */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FAST_RESP_H */
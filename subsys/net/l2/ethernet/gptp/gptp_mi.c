@@ -736,6 +736,8 @@ static void gptp_mi_clk_slave_sync_compute(void)
 	global_ds->last_gm_freq_change = pss->last_gm_freq_change;
 
 	offset_state->rcvd_sync_receipt_time = true;
+
+	gptp_timebase_update(state->pss_rcv_ptr->local_port_number);
 }
 
 #if defined(CONFIG_NET_GPTP_USE_DEFAULT_CLOCK_UPDATE)
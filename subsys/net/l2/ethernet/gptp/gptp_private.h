@@ -171,6 +171,17 @@ void gptp_change_pa_info_state_debug(
 	const char *caller, int line);
 #endif
 
+/**
+ * @brief Refresh the timebase correlation anchor
+ *
+ * @param port Port number of the clock to use.
+ */
+#if defined(CONFIG_NET_GPTP_TIMEBASE)
+void gptp_timebase_update(int port);
+#else
+#define gptp_timebase_update(port)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
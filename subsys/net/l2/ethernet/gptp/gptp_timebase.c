@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_gptp, CONFIG_NET_GPTP_LOG_LEVEL);
+
+#include <zephyr/drivers/ptp_clock.h>
+#include <zephyr/net/gptp.h>
+
+#include "gptp_messages.h"
+#include "gptp_data_set.h"
+#include "gptp_private.h"
+
+/* Correlation between the gPTP time and the hardware cycle counter.
+ *
+ * The anchor and the conversion multipliers are recomputed once per
+ * received sync by the gPTP thread; readers interpolate from the anchor
+ * with one multiplication per conversion. Consistency is guaranteed by
+ * a sequence counter that is odd while an update is in progress, so
+ * readers never block the writer and vice versa.
+ *
+ * The multipliers are Q32 fixed point values measured from consecutive
+ * anchors, which accounts for the drift of both the PTP hardware clock
+ * and the cycle counter against their nominal frequencies.
+ */
+static struct {
+	atomic_t seq;
+	uint64_t ref_cycles;
+	uint64_t ref_ns;
+	uint64_t mult;     /* gPTP nanoseconds per cycle, Q32 */
+	uint64_t inv_mult; /* cycles per gPTP nanosecond, Q32 */
+	bool valid;
+} timebase;
+
+static uint64_t cycles_now(void)
+{
+	if (IS_ENABLED(CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER)) {
+		return k_cycle_get_64();
+	}
+
+	return k_cycle_get_32();
+}
+
+/* Scale a cycle or nanosecond delta by a Q32 multiplier. Split into
+ * integer and fractional parts so that the intermediate products do not
+ * overflow for any delta the fractional term can represent.
+ */
+static uint64_t scale(uint64_t delta, uint64_t mult)
+{
+	return delta * (mult >> 32) + ((delta * (uint32_t)mult) >> 32);
+}
+
+void gptp_timebase_update(int port)
+{
+	const struct device *clk;
+	struct net_ptp_time tm;
+	unsigned int key;
+	uint64_t cycles, ns, delta_cyc, delta_ns;
+
+	clk = net_eth_get_ptp_clock(GPTP_PORT_IFACE(port));
+	if (!clk) {
+		return;
+	}
+
+	/* Sample both clocks back to back so that the anchor pair is
+	 * as tightly correlated as possible.
+	 */
+	key = irq_lock();
+	ptp_clock_get(clk, &tm);
+	cycles = cycles_now();
+	irq_unlock(key);
+
+	ns = (tm.second * NSEC_PER_SEC) + tm.nanosecond;
+
+	delta_cyc = cycles - timebase.ref_cycles;
+	delta_ns = ns - timebase.ref_ns;
+
+	atomic_inc(&timebase.seq);
+
+	if (timebase.valid && delta_ns > 0 && delta_ns <= UINT32_MAX &&
+	    delta_cyc > 0 && delta_cyc <= UINT32_MAX) {
+		/* Measured rate between the previous and new anchor */
+		timebase.mult = (delta_ns << 32) / delta_cyc;
+		timebase.inv_mult = (delta_cyc << 32) / delta_ns;
+	} else {
+		/* First sync, or too long since the previous one for
+		 * the rate measurement: assume nominal frequency.
+		 */
+		uint32_t cyc_per_sec = sys_clock_hw_cycles_per_sec();
+
+		timebase.mult = ((uint64_t)NSEC_PER_SEC << 32) / cyc_per_sec;
+		timebase.inv_mult =
+			((uint64_t)cyc_per_sec << 32) / NSEC_PER_SEC;
+	}
+
+	timebase.ref_cycles = cycles;
+	timebase.ref_ns = ns;
+	timebase.valid = true;
+
+	atomic_inc(&timebase.seq);
+}
+
+int gptp_timebase_cycles_to_ns(uint64_t cycles, uint64_t *ptp_ns)
+{
+	uint64_t ref_cycles, ref_ns, mult, delta;
+	atomic_val_t seq;
+	bool valid, negative;
+
+	do {
+		seq = atomic_get(&timebase.seq);
+		if (seq & 1) {
+			continue;
+		}
+
+		ref_cycles = timebase.ref_cycles;
+		ref_ns = timebase.ref_ns;
+		mult = timebase.mult;
+		valid = timebase.valid;
+	} while (atomic_get(&timebase.seq) != seq);
+
+	if (!valid) {
+		return -EAGAIN;
+	}
+
+	negative = cycles < ref_cycles;
+	delta = negative ? ref_cycles - cycles : cycles - ref_cycles;
+
+	if (delta > UINT32_MAX) {
+		return -ERANGE;
+	}
+
+	*ptp_ns = negative ? ref_ns - scale(delta, mult) :
+			     ref_ns + scale(delta, mult);
+
+	return 0;
+}
+
+int gptp_timebase_ns_to_cycles(uint64_t ptp_ns, uint64_t *cycles)
+{
+	uint64_t ref_cycles, ref_ns, inv_mult, delta;
+	atomic_val_t seq;
+	bool valid, negative;
+
+	do {
+		seq = atomic_get(&timebase.seq);
+		if (seq & 1) {
+			continue;
+		}
+
+		ref_cycles = timebase.ref_cycles;
+		ref_ns = timebase.ref_ns;
+		inv_mult = timebase.inv_mult;
+		valid = timebase.valid;
+	} while (atomic_get(&timebase.seq) != seq);
+
+	if (!valid) {
+		return -EAGAIN;
+	}
+
+	negative = ptp_ns < ref_ns;
+	delta = negative ? ref_ns - ptp_ns : ptp_ns - ref_ns;
+
+	if (delta > UINT32_MAX) {
+		return -ERANGE;
+	}
+
+	*cycles = negative ? ref_cycles - scale(delta, inv_mult) :
+			     ref_cycles + scale(delta, inv_mult);
+
+	return 0;
+}
@@ -1001,6 +1001,30 @@ static int wifi_get_power_save_config(uint32_t mgmt_request, struct net_if *ifac
 
 NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_WIFI_PS_CONFIG, wifi_get_power_save_config);
 
+static int wifi_data_path(uint32_t mgmt_request, struct net_if *iface,
+			  void *data, size_t len)
+{
+	const struct device *dev = net_if_get_device(iface);
+	const struct wifi_mgmt_ops *const wifi_mgmt_api = get_wifi_api(iface);
+	struct wifi_data_path_params *params = data;
+
+	if (wifi_mgmt_api == NULL || wifi_mgmt_api->data_path == NULL) {
+		return -ENOTSUP;
+	}
+
+	if (!net_if_is_admin_up(iface)) {
+		return -ENETDOWN;
+	}
+
+	if (!data || len != sizeof(*params)) {
+		return -EINVAL;
+	}
+
+	return wifi_mgmt_api->data_path(dev, params);
+}
+
+NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_WIFI_DATA_PATH, wifi_data_path);
+
 static int wifi_set_twt(uint32_t mgmt_request, struct net_if *iface,
 			  void *data, size_t len)
 {
@@ -1140,6 +1164,14 @@ void wifi_mgmt_raise_twt_sleep_state(struct net_if *iface,
 					sizeof(twt_sleep_state));
 }
 
+void wifi_mgmt_raise_ps_sleep_state(struct net_if *iface,
+				    int ps_sleep_state)
+{
+	net_mgmt_event_notify_with_info(NET_EVENT_WIFI_PS_SLEEP_STATE,
+					iface, &ps_sleep_state,
+					sizeof(ps_sleep_state));
+}
+
 static int wifi_mode(uint32_t mgmt_request, struct net_if *iface,
 				void *data, size_t len)
 {
@@ -51,6 +51,13 @@ NET_BUF_POOL_VAR_DEFINE(capture_bufs, CONFIG_NET_CAPTURE_BUF_COUNT,
 
 static sys_slist_t net_capture_devlist;
 
+#if CONFIG_NET_CAPTURE_SAMPLING_INTERVAL > 1
+/* Number of packets seen by the capture point, used for sampling.
+ * Protected by the lock mutex.
+ */
+static uint32_t sample_count;
+#endif
+
 struct net_capture {
 	sys_snode_t node;
 
@@ -510,6 +517,136 @@ static int capture_disable(const struct device *dev)
 	return 0;
 }
 
+static void capture_truncate(struct net_pkt *pkt)
+{
+	size_t len = net_pkt_get_len(pkt);
+
+	if (CONFIG_NET_CAPTURE_SNAPLEN == 0 || len <= CONFIG_NET_CAPTURE_SNAPLEN) {
+		return;
+	}
+
+	(void)net_pkt_remove_tail(pkt, len - CONFIG_NET_CAPTURE_SNAPLEN);
+}
+
+#if defined(CONFIG_NET_CAPTURE_PASSIVE)
+static struct {
+	struct k_fifo queue;
+	struct k_work drain_work;
+	struct net_if *iface;
+	net_capture_passive_cb_t cb;
+	void *user_data;
+	bool enabled;
+} passive;
+
+static void passive_drain(struct k_work *work)
+{
+	struct net_pkt *pkt;
+
+	ARG_UNUSED(work);
+
+	while ((pkt = k_fifo_get(&passive.queue, K_NO_WAIT)) != NULL) {
+		if (passive.cb != NULL) {
+			passive.cb(pkt, passive.user_data);
+		}
+
+		net_pkt_unref(pkt);
+	}
+}
+
+static int passive_capture(struct net_if *iface, struct net_pkt *pkt)
+{
+	struct k_mem_slab *orig_slab;
+	struct net_pkt *captured;
+
+	orig_slab = pkt->slab;
+	pkt->slab = get_net_pkt();
+
+	captured = net_pkt_clone(pkt, K_NO_WAIT);
+
+	pkt->slab = orig_slab;
+
+	if (captured == NULL) {
+		NET_DBG("Captured pkt %s", "dropped");
+		net_stats_update_processing_error(iface);
+		return -ENOMEM;
+	}
+
+	capture_truncate(captured);
+
+	net_pkt_set_orig_iface(captured, iface);
+	net_pkt_set_captured(captured, true);
+	net_pkt_set_captured(pkt, true);
+
+	k_fifo_put(&passive.queue, captured);
+	k_work_submit(&passive.drain_work);
+
+	return 0;
+}
+
+int net_capture_passive_enable(struct net_if *iface,
+			       net_capture_passive_cb_t cb, void *user_data)
+{
+	static bool init_done;
+
+	if (cb == NULL) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&lock, K_FOREVER);
+
+	if (passive.enabled) {
+		k_mutex_unlock(&lock);
+		return -EALREADY;
+	}
+
+	if (!init_done) {
+		k_fifo_init(&passive.queue);
+		k_work_init(&passive.drain_work, passive_drain);
+		init_done = true;
+	}
+
+	passive.iface = iface;
+	passive.cb = cb;
+	passive.user_data = user_data;
+	passive.enabled = true;
+
+	k_mutex_unlock(&lock);
+
+	net_mgmt_event_notify(NET_EVENT_CAPTURE_STARTED, iface);
+
+	return 0;
+}
+
+int net_capture_passive_disable(void)
+{
+	struct net_if *iface;
+	struct net_pkt *pkt;
+
+	k_mutex_lock(&lock, K_FOREVER);
+
+	if (!passive.enabled) {
+		k_mutex_unlock(&lock);
+		return -EALREADY;
+	}
+
+	iface = passive.iface;
+	passive.enabled = false;
+	passive.cb = NULL;
+	passive.iface = NULL;
+
+	/* Drop any captured packets that were not yet delivered */
+	while ((pkt = k_fifo_get(&passive.queue, K_NO_WAIT)) != NULL) {
+		net_pkt_unref(pkt);
+	}
+
+	k_mutex_unlock(&lock);
+
+	net_mgmt_event_notify(NET_EVENT_CAPTURE_STOPPED, iface);
+
+	return 0;
+}
+#endif /* CONFIG_NET_CAPTURE_PASSIVE */
+
 int net_capture_pkt_with_status(struct net_if *iface, struct net_pkt *pkt)
 {
 	struct k_mem_slab *orig_slab;
@@ -525,8 +662,29 @@ int net_capture_pkt_with_status(struct net_if *iface, struct net_pkt *pkt)
 		return -EALREADY;
 	}
 
+	/* Evaluate any capture filter rules before spending cycles on
+	 * cloning the packet.
+	 */
+	if (!net_pkt_filter_capture_ok(pkt)) {
+		return -ENOENT;
+	}
+
 	k_mutex_lock(&lock, K_FOREVER);
 
+#if CONFIG_NET_CAPTURE_SAMPLING_INTERVAL > 1
+	if ((sample_count++ % CONFIG_NET_CAPTURE_SAMPLING_INTERVAL) != 0) {
+		goto out;
+	}
+#endif
+
+#if defined(CONFIG_NET_CAPTURE_PASSIVE)
+	if (passive.enabled &&
+	    (passive.iface == NULL || passive.iface == iface)) {
+		ret = passive_capture(iface, pkt);
+		goto out;
+	}
+#endif
+
 	SYS_SLIST_FOR_EACH_NODE_SAFE(&net_capture_devlist, sn, sns) {
 		struct net_capture *ctx = CONTAINER_OF(sn, struct net_capture,
 						       node);
@@ -560,6 +718,8 @@ int net_capture_pkt_with_status(struct net_if *iface, struct net_pkt *pkt)
 				ret = -ENOMEM;
 				goto out;
 			}
+
+			capture_truncate(captured);
 		}
 
 		net_pkt_set_orig_iface(captured, iface);
@@ -719,6 +719,280 @@ static int send_rst(struct coap_client *client, const struct coap_packet *req)
 	return 0;
 }
 
+#if (CONFIG_COAP_CLIENT_BLOCK_PIPELINE > 1)
+static struct coap_client_block_slot *block_slot_find(
+	struct coap_client_internal_request *internal_req, uint32_t block_num)
+{
+	for (int i = 0; i < ARRAY_SIZE(internal_req->block_slots); i++) {
+		if (internal_req->block_slots[i].used &&
+		    internal_req->block_slots[i].block_num == block_num) {
+			return &internal_req->block_slots[i];
+		}
+	}
+
+	return NULL;
+}
+
+static struct coap_client_block_slot *block_slot_alloc(
+	struct coap_client_internal_request *internal_req)
+{
+	for (int i = 0; i < ARRAY_SIZE(internal_req->block_slots); i++) {
+		if (!internal_req->block_slots[i].used) {
+			memset(&internal_req->block_slots[i], 0,
+			       sizeof(internal_req->block_slots[i]));
+			internal_req->block_slots[i].used = true;
+			return &internal_req->block_slots[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void block_slots_reset(struct coap_client_internal_request *internal_req)
+{
+	for (int i = 0; i < ARRAY_SIZE(internal_req->block_slots); i++) {
+		internal_req->block_slots[i].used = false;
+	}
+}
+
+/** Block number the non-pipelined request machinery waits for. */
+static uint32_t block_expected_num(struct coap_client_internal_request *internal_req)
+{
+	return internal_req->recv_blk_ctx.current /
+	       coap_block_size_to_bytes(internal_req->recv_blk_ctx.block_size);
+}
+
+static bool block_slot_token_match(struct coap_client_internal_request *internal_req,
+				   const uint8_t *token, uint8_t tkl)
+{
+	if (tkl != COAP_TOKEN_MAX_LEN) {
+		return false;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(internal_req->block_slots); i++) {
+		if (internal_req->block_slots[i].used &&
+		    memcmp(internal_req->block_slots[i].token, token, tkl) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/** Buffer a response to a pipelined block request other than the expected
+ * block. Returns true if the response was consumed.
+ */
+static bool pipeline_stash_response(struct coap_client_internal_request *internal_req,
+				    const struct coap_packet *response, uint8_t response_code)
+{
+	struct coap_client_block_slot *slot;
+	const uint8_t *payload;
+	uint16_t payload_len;
+	uint32_t block_num;
+	int block_option;
+
+	if (internal_req->is_observe || internal_req->recv_blk_ctx.current == 0) {
+		return false;
+	}
+
+	block_option = coap_get_option_int(response, COAP_OPTION_BLOCK2);
+	if (block_option < 0) {
+		uint8_t token[COAP_TOKEN_MAX_LEN];
+		uint8_t tkl = coap_header_get_token(response, token);
+
+		/* A pipelined request for a block number past the end of the
+		 * resource is answered with an error carrying no Block2 option.
+		 * Drop it, the transfer completes through the blocks already on
+		 * the wire.
+		 */
+		if (response_code >= COAP_RESPONSE_CODE_BAD_REQUEST &&
+		    tkl == COAP_TOKEN_MAX_LEN) {
+			for (int i = 0; i < ARRAY_SIZE(internal_req->block_slots); i++) {
+				slot = &internal_req->block_slots[i];
+				if (slot->used && !slot->received &&
+				    memcmp(slot->token, token, tkl) == 0) {
+					slot->used = false;
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	if (GET_BLOCK_SIZE(block_option) != internal_req->recv_blk_ctx.block_size) {
+		/* Block size renegotiation, let the generic path handle it. */
+		return false;
+	}
+
+	block_num = GET_BLOCK_NUM(block_option);
+	if (block_num == block_expected_num(internal_req)) {
+		return false;
+	}
+
+	if (block_num < block_expected_num(internal_req)) {
+		/* Duplicate of a block that is already delivered. */
+		return true;
+	}
+
+	slot = block_slot_find(internal_req, block_num);
+	if (slot == NULL) {
+		slot = block_slot_alloc(internal_req);
+		if (slot == NULL) {
+			return true;
+		}
+		slot->block_num = block_num;
+	} else if (slot->received) {
+		return true;
+	}
+
+	payload = coap_packet_get_payload(response, &payload_len);
+	if (response_code >= COAP_RESPONSE_CODE_BAD_REQUEST ||
+	    payload_len > sizeof(slot->payload)) {
+		slot->used = false;
+		return true;
+	}
+
+	if (payload != NULL) {
+		memcpy(slot->payload, payload, payload_len);
+	}
+	slot->len = payload_len;
+	slot->more = GET_MORE(block_option);
+	slot->received = true;
+
+	LOG_DBG("Buffered out-of-order block %u", block_num);
+
+	return true;
+}
+
+/** Deliver consecutively buffered blocks to the application callback. */
+static void pipeline_drain_slots(struct coap_client_internal_request *internal_req,
+				 uint8_t response_code, bool *last_block)
+{
+	uint16_t block_size = coap_block_size_to_bytes(internal_req->recv_blk_ctx.block_size);
+	struct coap_client_block_slot *slot;
+
+	while (!*last_block) {
+		slot = block_slot_find(internal_req, internal_req->offset / block_size);
+		if (slot == NULL || !slot->received) {
+			break;
+		}
+
+		*last_block = !slot->more;
+
+		if (internal_req->coap_request.cb) {
+			if (!atomic_set(&internal_req->in_callback, 1)) {
+				internal_req->coap_request.cb(response_code, internal_req->offset,
+							      slot->len > 0 ? slot->payload : NULL,
+							      slot->len, *last_block,
+							      internal_req->coap_request.user_data);
+				atomic_clear(&internal_req->in_callback);
+			}
+			if (!internal_req->request_ongoing) {
+				return;
+			}
+		}
+
+		internal_req->offset += slot->len;
+		internal_req->recv_blk_ctx.current = internal_req->offset;
+		slot->used = false;
+	}
+}
+
+/** Send requests for the blocks following the expected one, so that up to
+ * COAP_CLIENT_BLOCK_PIPELINE requests are in flight. Best effort: these
+ * requests are not retransmitted, a lost exchange is recovered by the
+ * regular request machinery when it advances to that block.
+ */
+static void pipeline_send_speculative(struct coap_client *client,
+				      struct coap_client_internal_request *internal_req)
+{
+	uint16_t block_size = coap_block_size_to_bytes(internal_req->recv_blk_ctx.block_size);
+	size_t total_size = internal_req->recv_blk_ctx.total_size;
+	uint32_t saved_current = internal_req->recv_blk_ctx.current;
+	uint32_t next_num = saved_current / block_size;
+	int ret;
+
+	if (internal_req->is_observe) {
+		return;
+	}
+
+	for (uint32_t num = next_num + 1;
+	     num < next_num + CONFIG_COAP_CLIENT_BLOCK_PIPELINE; num++) {
+		struct coap_client_block_slot *slot;
+
+		if (total_size > 0 && (size_t)num * block_size >= total_size) {
+			break;
+		}
+
+		if (block_slot_find(internal_req, num) != NULL) {
+			/* Already in flight or buffered */
+			continue;
+		}
+
+		slot = block_slot_alloc(internal_req);
+		if (slot == NULL) {
+			break;
+		}
+
+		internal_req->recv_blk_ctx.current = num * block_size;
+		ret = coap_client_init_request(client, &internal_req->coap_request,
+					       internal_req, false);
+		if (ret == 0) {
+			ret = send_request(client->fd, internal_req->request.data,
+					   internal_req->request.offset, 0,
+					   &client->address, client->socklen);
+		}
+		if (ret < 0) {
+			slot->used = false;
+			break;
+		}
+
+		slot->block_num = num;
+		slot->mid = internal_req->last_id;
+		memcpy(slot->token, internal_req->request_token, COAP_TOKEN_MAX_LEN);
+	}
+
+	internal_req->recv_blk_ctx.current = saved_current;
+}
+
+/** If the expected block is already in flight as a pipelined request, adopt
+ * that exchange as the tracked one instead of requesting the block again.
+ */
+static bool pipeline_adopt_next_block(struct coap_client *client,
+				      struct coap_client_internal_request *internal_req)
+{
+	struct coap_transmission_parameters params = internal_req->pending.params;
+	struct coap_client_block_slot *slot;
+	int ret;
+
+	slot = block_slot_find(internal_req, block_expected_num(internal_req));
+	if (slot == NULL || slot->received) {
+		return false;
+	}
+
+	internal_req->last_id = slot->mid;
+	memcpy(internal_req->request_token, slot->token, COAP_TOKEN_MAX_LEN);
+	internal_req->request_tkl = COAP_TOKEN_MAX_LEN & 0xf;
+	slot->used = false;
+
+	/* Rebuild the request packet for retransmission bookkeeping. */
+	ret = coap_client_init_request(client, &internal_req->coap_request, internal_req, true);
+	if (ret < 0) {
+		return false;
+	}
+
+	ret = coap_pending_init(&internal_req->pending, &internal_req->request,
+				&client->address, &params);
+	if (ret < 0) {
+		return false;
+	}
+	coap_pending_cycle(&internal_req->pending);
+
+	return true;
+}
+#endif /* CONFIG_COAP_CLIENT_BLOCK_PIPELINE > 1 */
+
 static struct coap_client_internal_request *get_request_with_token(
 	struct coap_client *client, const struct coap_packet *resp)
 {
@@ -731,6 +1005,12 @@ static struct coap_client_internal_request *get_request_with_token(
 	for (int i = 0; i < CONFIG_COAP_CLIENT_MAX_REQUESTS; i++) {
 		if (client->requests[i].request_ongoing ||
 		    !exchange_lifetime_exceeded(&client->requests[i])) {
+#if (CONFIG_COAP_CLIENT_BLOCK_PIPELINE > 1)
+			if (block_slot_token_match(&client->requests[i], response_token,
+						   response_tkl)) {
+				return &client->requests[i];
+			}
+#endif
 			if (client->requests[i].request_tkl == 0) {
 				continue;
 			}
@@ -897,6 +1177,15 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 		return 0;
 	}
 
+#if (CONFIG_COAP_CLIENT_BLOCK_PIPELINE > 1)
+	/* A response to one of the pipelined block requests other than the
+	 * expected block does not complete the tracked exchange.
+	 */
+	if (pipeline_stash_response(internal_req, response, response_code)) {
+		return 0;
+	}
+#endif
+
 	if (internal_req->pending.timeout != 0) {
 		coap_pending_clear(&internal_req->pending);
 	}
@@ -913,13 +1202,27 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 						 coap_client_default_block_size(),
 						 0);
 			internal_req->offset = 0;
+#if (CONFIG_COAP_CLIENT_BLOCK_PIPELINE > 1)
+			block_slots_reset(internal_req);
+#endif
 		}
 
+#if (CONFIG_COAP_CLIENT_BLOCK_PIPELINE > 1)
+		enum coap_block_size prev_block_size = internal_req->recv_blk_ctx.block_size;
+#endif
+
 		ret = coap_update_from_block(response, &internal_req->recv_blk_ctx);
 		if (ret < 0) {
 			LOG_ERR("Error updating block context");
 		}
 		coap_next_block(response, &internal_req->recv_blk_ctx);
+
+#if (CONFIG_COAP_CLIENT_BLOCK_PIPELINE > 1)
+		if (internal_req->recv_blk_ctx.block_size != prev_block_size) {
+			/* Renegotiated block size invalidates buffered blocks. */
+			block_slots_reset(internal_req);
+		}
+#endif
 	} else {
 		internal_req->offset = 0;
 		last_block = true;
@@ -961,8 +1264,26 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 		}
 	}
 
+#if (CONFIG_COAP_CLIENT_BLOCK_PIPELINE > 1)
+	if (blockwise_transfer && !last_block) {
+		pipeline_drain_slots(internal_req, response_code, &last_block);
+		if (!internal_req->request_ongoing) {
+			/* User callback must have called coap_client_cancel_requests(). */
+			goto fail;
+		}
+	}
+#endif
+
 	/* If this wasn't last block, send the next request */
 	if (blockwise_transfer && !last_block) {
+#if (CONFIG_COAP_CLIENT_BLOCK_PIPELINE > 1)
+		if (internal_req->recv_blk_ctx.current > 0) {
+			pipeline_send_speculative(client, internal_req);
+			if (pipeline_adopt_next_block(client, internal_req)) {
+				return 1;
+			}
+		}
+#endif
 		ret = coap_client_init_request(client, &internal_req->coap_request, internal_req,
 					       false);
 
@@ -40,6 +40,10 @@ LOG_MODULE_REGISTER(net_dhcpv4, CONFIG_NET_DHCPV4_LOG_LEVEL);
 #include <zephyr/sys/slist.h>
 #include <zephyr/sys/util.h>
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+#include <zephyr/settings/settings.h>
+#endif
+
 #define PKT_WAIT_TIME K_MSEC(100)
 
 static K_MUTEX_DEFINE(lock);
@@ -412,6 +416,135 @@ static void dhcpv4_set_timeout_inc(struct net_if_dhcpv4 *dhcpv4,
 	dhcpv4->request_time = (uint32_t)(timeout_ms / MSEC_PER_SEC);
 }
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+
+#define DHCPV4_LEASE_KEY_FMT "net/dhcpv4/lease/%d"
+#define DHCPV4_LEASE_KEY_LEN sizeof("net/dhcpv4/lease/255")
+
+/* Lease parameters persisted across reboots. */
+struct dhcpv4_cached_lease {
+	struct in_addr requested_ip;
+	struct in_addr netmask;
+	struct in_addr server_id;
+	uint32_t lease_time;
+	uint32_t renewal_time;
+	uint32_t rebinding_time;
+};
+
+struct dhcpv4_lease_load_ctx {
+	struct dhcpv4_cached_lease *lease;
+	bool found;
+};
+
+static int dhcpv4_lease_load_cb(const char *key, size_t len,
+				settings_read_cb read_cb, void *cb_arg,
+				void *param)
+{
+	struct dhcpv4_lease_load_ctx *ctx = param;
+
+	ARG_UNUSED(key);
+
+	if (len != sizeof(*ctx->lease)) {
+		NET_DBG("Invalid cached lease length %zu", len);
+		return -EINVAL;
+	}
+
+	if (read_cb(cb_arg, ctx->lease, sizeof(*ctx->lease)) !=
+	    sizeof(*ctx->lease)) {
+		return -ENODATA;
+	}
+
+	ctx->found = true;
+
+	return 0;
+}
+
+static int dhcpv4_lease_load(struct net_if *iface,
+			     struct dhcpv4_cached_lease *lease)
+{
+	struct dhcpv4_lease_load_ctx ctx = { .lease = lease };
+	char key[DHCPV4_LEASE_KEY_LEN];
+
+	(void)settings_subsys_init();
+
+	snprintk(key, sizeof(key), DHCPV4_LEASE_KEY_FMT,
+		 net_if_get_by_iface(iface));
+
+	(void)settings_load_subtree_direct(key, dhcpv4_lease_load_cb, &ctx);
+
+	return ctx.found ? 0 : -ENOENT;
+}
+
+/* Persist the active lease so that it can be reclaimed with INIT-REBOOT
+ * after a reboot. Skips the write when the stored lease is up to date, so
+ * periodic renewals do not wear the settings storage.
+ */
+static void dhcpv4_lease_store(struct net_if *iface)
+{
+	struct dhcpv4_cached_lease stored;
+	struct dhcpv4_cached_lease lease = {
+		.requested_ip = iface->config.dhcpv4.requested_ip,
+		.netmask = iface->config.dhcpv4.netmask,
+		.server_id = iface->config.dhcpv4.server_id,
+		.lease_time = iface->config.dhcpv4.lease_time,
+		.renewal_time = iface->config.dhcpv4.renewal_time,
+		.rebinding_time = iface->config.dhcpv4.rebinding_time,
+	};
+	char key[DHCPV4_LEASE_KEY_LEN];
+	int ret;
+
+	if (dhcpv4_lease_load(iface, &stored) == 0 &&
+	    memcmp(&stored, &lease, sizeof(lease)) == 0) {
+		return;
+	}
+
+	snprintk(key, sizeof(key), DHCPV4_LEASE_KEY_FMT,
+		 net_if_get_by_iface(iface));
+
+	ret = settings_save_one(key, &lease, sizeof(lease));
+	if (ret < 0) {
+		NET_DBG("Failed to store lease (%d)", ret);
+	}
+}
+
+static void dhcpv4_lease_invalidate(struct net_if *iface)
+{
+	char key[DHCPV4_LEASE_KEY_LEN];
+
+	snprintk(key, sizeof(key), DHCPV4_LEASE_KEY_FMT,
+		 net_if_get_by_iface(iface));
+
+	(void)settings_delete(key);
+}
+
+/* Restore a cached lease into the interface, if a valid one is stored.
+ * Returns true if the client can attempt INIT-REBOOT with it.
+ */
+static bool dhcpv4_lease_restore(struct net_if *iface)
+{
+	struct dhcpv4_cached_lease lease;
+
+	if (dhcpv4_lease_load(iface, &lease) < 0) {
+		return false;
+	}
+
+	if (lease.requested_ip.s_addr == INADDR_ANY ||
+	    lease.lease_time == 0U) {
+		return false;
+	}
+
+	iface->config.dhcpv4.requested_ip = lease.requested_ip;
+	iface->config.dhcpv4.netmask = lease.netmask;
+	iface->config.dhcpv4.server_id = lease.server_id;
+	iface->config.dhcpv4.lease_time = lease.lease_time;
+	iface->config.dhcpv4.renewal_time = lease.renewal_time;
+	iface->config.dhcpv4.rebinding_time = lease.rebinding_time;
+
+	return true;
+}
+
+#endif /* CONFIG_NET_DHCPV4_LEASE_CACHE */
+
 static uint32_t dhcpv4_get_timeleft(int64_t start, uint32_t time, int64_t now)
 {
 	int64_t deadline = start + MSEC_PER_SEC * time;
@@ -559,7 +692,14 @@ static uint32_t dhcpv4_send_request(struct net_if *iface)
 		goto fail;
 		break;
 	case NET_DHCPV4_REQUESTING:
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+		/* RFC2131 4.3.2, in INIT-REBOOT the client MUST NOT include
+		 * the server identifier in the DHCPREQUEST.
+		 */
+		with_server_id = !iface->config.dhcpv4.init_reboot;
+#else
 		with_server_id = true;
+#endif /* CONFIG_NET_DHCPV4_LEASE_CACHE */
 		with_requested_ip = true;
 		memcpy(&iface->config.dhcpv4.request_server_addr, &iface->config.dhcpv4.server_id,
 		       sizeof(struct in_addr));
@@ -691,6 +831,10 @@ static void dhcpv4_enter_selecting(struct net_if *iface)
 {
 	iface->config.dhcpv4.attempts = 0U;
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+	iface->config.dhcpv4.init_reboot = false;
+#endif
+
 	iface->config.dhcpv4.lease_time = 0U;
 	iface->config.dhcpv4.renewal_time = 0U;
 	iface->config.dhcpv4.rebinding_time = 0U;
@@ -750,6 +894,11 @@ static void dhcpv4_enter_bound(struct net_if *iface)
 		net_dhcpv4_state_name(dhcpv4->state),
 		dhcpv4->renewal_time, dhcpv4->rebinding_time);
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+	dhcpv4->init_reboot = false;
+	dhcpv4_lease_store(iface);
+#endif
+
 	dhcpv4_set_timeout(dhcpv4, dhcpv4->renewal_time);
 
 	net_mgmt_event_notify_with_info(NET_EVENT_IPV4_DHCP_BOUND, iface,
@@ -1453,6 +1602,19 @@ static void dhcpv4_handle_msg_nak(struct net_if *iface)
 	case NET_DHCPV4_INIT:
 	case NET_DHCPV4_SELECTING:
 	case NET_DHCPV4_REQUESTING:
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+		if (iface->config.dhcpv4.init_reboot) {
+			/* In INIT-REBOOT any server on the network may NAK
+			 * the cached address, restart the configuration
+			 * process right away.
+			 */
+			LOG_DBG("NAK for cached lease, restart config");
+			dhcpv4_lease_invalidate(iface);
+			dhcpv4_enter_selecting(iface);
+			dhcpv4_immediate_timeout(&iface->config.dhcpv4);
+			break;
+		}
+#endif /* CONFIG_NET_DHCPV4_LEASE_CACHE */
 		if (memcmp(&iface->config.dhcpv4.request_server_addr,
 			   &iface->config.dhcpv4.response_src_addr,
 			   sizeof(iface->config.dhcpv4.request_server_addr)) == 0) {
@@ -1701,6 +1863,10 @@ static void dhcpv4_acd_event_handler(struct net_mgmt_event_callback *cb,
 	NET_DBG("Conflict on DHCP assigned address %s, starting over",
 		net_sprint_ipv4_addr(addr));
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+	dhcpv4_lease_invalidate(iface);
+#endif
+
 	iface->config.dhcpv4.state = NET_DHCPV4_DECLINE;
 	dhcpv4_immediate_timeout(&iface->config.dhcpv4);
 
@@ -1770,6 +1936,24 @@ static void dhcpv4_start_internal(struct net_if *iface, bool first_start)
 		 */
 		iface->config.dhcpv4.xid = entropy;
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+		if (first_start && dhcpv4_lease_restore(iface)) {
+			/* A valid lease from a previous run is cached, skip
+			 * the initial delay and discovery and try to reclaim
+			 * the cached address with INIT-REBOOT (RFC2131
+			 * ch. 3.2).
+			 */
+			NET_DBG("reclaim cached lease %s",
+				net_sprint_ipv4_addr(
+					&iface->config.dhcpv4.requested_ip));
+
+			iface->config.dhcpv4.init_reboot = true;
+			iface->config.dhcpv4.attempts = 0U;
+			iface->config.dhcpv4.state = NET_DHCPV4_REQUESTING;
+			first_start = false;
+		}
+#endif /* CONFIG_NET_DHCPV4_LEASE_CACHE */
+
 		/* Use default */
 		if (first_start) {
 			/* RFC2131 4.1.1 requires we wait a random period
@@ -17,6 +17,10 @@ LOG_MODULE_REGISTER(net_dhcpv6, CONFIG_NET_DHCPV6_LOG_LEVEL);
 #include <zephyr/random/random.h>
 #include <zephyr/sys/math_extras.h>
 
+#if defined(CONFIG_NET_DHCPV6_LEASE_CACHE)
+#include <zephyr/settings/settings.h>
+#endif
+
 #include "dhcpv6_internal.h"
 #include "ipv6.h"
 #include "net_private.h"
@@ -1424,6 +1428,204 @@ out:
 	return ret;
 }
 
+#if defined(CONFIG_NET_DHCPV6_LEASE_CACHE)
+
+#define DHCPV6_LEASE_KEY_FMT "net/dhcpv6/lease/%d"
+#define DHCPV6_LEASE_KEY_LEN sizeof("net/dhcpv6/lease/255")
+
+/* Lease parameters persisted across reboots. Timers are stored as
+ * durations, in seconds, relative to the lease acquisition.
+ */
+struct dhcpv6_cached_lease {
+	struct net_dhcpv6_duid_storage serverid;
+	struct in6_addr addr;
+	struct in6_addr prefix;
+	uint32_t t1;
+	uint32_t t2;
+	uint32_t expire;
+	uint8_t prefix_len;
+};
+
+struct dhcpv6_lease_load_ctx {
+	struct dhcpv6_cached_lease *lease;
+	bool found;
+};
+
+static int dhcpv6_lease_load_cb(const char *key, size_t len,
+				settings_read_cb read_cb, void *cb_arg,
+				void *param)
+{
+	struct dhcpv6_lease_load_ctx *ctx = param;
+
+	ARG_UNUSED(key);
+
+	if (len != sizeof(*ctx->lease)) {
+		NET_DBG("Invalid cached lease length %zu", len);
+		return -EINVAL;
+	}
+
+	if (read_cb(cb_arg, ctx->lease, sizeof(*ctx->lease)) !=
+	    sizeof(*ctx->lease)) {
+		return -ENODATA;
+	}
+
+	ctx->found = true;
+
+	return 0;
+}
+
+static int dhcpv6_lease_load(struct net_if *iface,
+			     struct dhcpv6_cached_lease *lease)
+{
+	struct dhcpv6_lease_load_ctx ctx = { .lease = lease };
+	char key[DHCPV6_LEASE_KEY_LEN];
+
+	(void)settings_subsys_init();
+
+	snprintk(key, sizeof(key), DHCPV6_LEASE_KEY_FMT,
+		 net_if_get_by_iface(iface));
+
+	(void)settings_load_subtree_direct(key, dhcpv6_lease_load_cb, &ctx);
+
+	return ctx.found ? 0 : -ENOENT;
+}
+
+static uint32_t dhcpv6_lease_duration(uint64_t deadline, int64_t now)
+{
+	if (deadline == UINT64_MAX) {
+		return UINT32_MAX;
+	}
+
+	if (deadline <= (uint64_t)now) {
+		return 0;
+	}
+
+	return (uint32_t)MIN((deadline - (uint64_t)now) / MSEC_PER_SEC,
+			     UINT32_MAX - 1);
+}
+
+static uint64_t dhcpv6_lease_deadline(uint32_t duration, int64_t now)
+{
+	if (duration == UINT32_MAX) {
+		return UINT64_MAX;
+	}
+
+	return (uint64_t)now + (uint64_t)duration * MSEC_PER_SEC;
+}
+
+/* Persist the active lease so that it can be confirmed right away after
+ * a reboot. The stored durations are identical on every renewal of the
+ * same lease, so an unchanged lease is written out only once.
+ */
+static void dhcpv6_lease_store(struct net_if *iface)
+{
+	struct dhcpv6_cached_lease stored;
+	struct dhcpv6_cached_lease lease = { 0 };
+	char key[DHCPV6_LEASE_KEY_LEN];
+	int64_t now = k_uptime_get();
+	int ret;
+
+	memcpy(&lease.serverid, &iface->config.dhcpv6.serverid,
+	       sizeof(lease.serverid));
+	memcpy(&lease.addr, &iface->config.dhcpv6.addr, sizeof(lease.addr));
+	memcpy(&lease.prefix, &iface->config.dhcpv6.prefix,
+	       sizeof(lease.prefix));
+	lease.prefix_len = iface->config.dhcpv6.prefix_len;
+	lease.t1 = dhcpv6_lease_duration(iface->config.dhcpv6.t1, now);
+	lease.t2 = dhcpv6_lease_duration(iface->config.dhcpv6.t2, now);
+	lease.expire = dhcpv6_lease_duration(iface->config.dhcpv6.expire, now);
+
+	if (dhcpv6_lease_load(iface, &stored) == 0 &&
+	    memcmp(&stored, &lease, sizeof(lease)) == 0) {
+		return;
+	}
+
+	snprintk(key, sizeof(key), DHCPV6_LEASE_KEY_FMT,
+		 net_if_get_by_iface(iface));
+
+	ret = settings_save_one(key, &lease, sizeof(lease));
+	if (ret < 0) {
+		NET_DBG("Failed to store lease (%d)", ret);
+	}
+}
+
+static void dhcpv6_lease_invalidate(struct net_if *iface)
+{
+	char key[DHCPV6_LEASE_KEY_LEN];
+
+	snprintk(key, sizeof(key), DHCPV6_LEASE_KEY_FMT,
+		 net_if_get_by_iface(iface));
+
+	(void)settings_delete(key);
+}
+
+/* Restore a cached lease into the interface, if a valid one is stored.
+ * With the address/prefix and expiry deadline in place the INIT state
+ * proceeds with a Confirm/Rebind exchange instead of a full discovery.
+ */
+static bool dhcpv6_lease_restore(struct net_if *iface)
+{
+	struct dhcpv6_cached_lease lease;
+	int64_t now = k_uptime_get();
+
+	if (dhcpv6_lease_load(iface, &lease) < 0) {
+		return false;
+	}
+
+	if (lease.expire == 0U) {
+		return false;
+	}
+
+	if (iface->config.dhcpv6.params.request_addr) {
+		if (net_ipv6_addr_cmp(&lease.addr,
+				      net_ipv6_unspecified_address())) {
+			return false;
+		}
+
+		if (net_if_ipv6_addr_add(iface, &lease.addr, NET_ADDR_DHCP,
+					 lease.expire) == NULL) {
+			NET_DBG("Failed to restore DHCPv6 address");
+			return false;
+		}
+	}
+
+	if (iface->config.dhcpv6.params.request_prefix) {
+		if (net_ipv6_addr_cmp(&lease.prefix,
+				      net_ipv6_unspecified_address())) {
+			return false;
+		}
+
+		if (net_if_ipv6_prefix_add(iface, &lease.prefix,
+					   lease.prefix_len,
+					   lease.expire) == NULL) {
+			NET_DBG("Failed to restore DHCPv6 prefix");
+
+			if (iface->config.dhcpv6.params.request_addr) {
+				(void)net_if_ipv6_addr_rm(iface, &lease.addr);
+			}
+
+			return false;
+		}
+	}
+
+	memcpy(&iface->config.dhcpv6.serverid, &lease.serverid,
+	       sizeof(iface->config.dhcpv6.serverid));
+	memcpy(&iface->config.dhcpv6.addr, &lease.addr,
+	       sizeof(iface->config.dhcpv6.addr));
+	memcpy(&iface->config.dhcpv6.prefix, &lease.prefix,
+	       sizeof(iface->config.dhcpv6.prefix));
+	iface->config.dhcpv6.prefix_len = lease.prefix_len;
+	iface->config.dhcpv6.t1 = dhcpv6_lease_deadline(lease.t1, now);
+	iface->config.dhcpv6.t2 = dhcpv6_lease_deadline(lease.t2, now);
+	iface->config.dhcpv6.expire = dhcpv6_lease_deadline(lease.expire, now);
+
+	NET_DBG("Restored cached lease for iface %p", iface);
+
+	return true;
+}
+
+#endif /* CONFIG_NET_DHCPV6_LEASE_CACHE */
+
 /* DHCPv6 state changes */
 
 static void dhcpv6_enter_init(struct net_if *iface)
@@ -1498,6 +1700,10 @@ static void dhcpv6_enter_bound(struct net_if *iface)
 {
 	iface->config.dhcpv6.timeout = iface->config.dhcpv6.t1;
 
+#if defined(CONFIG_NET_DHCPV6_LEASE_CACHE)
+	dhcpv6_lease_store(iface);
+#endif
+
 	net_mgmt_event_notify_with_info(NET_EVENT_IPV6_DHCP_BOUND, iface,
 					&iface->config.dhcpv6,
 					sizeof(iface->config.dhcpv6));
@@ -1737,6 +1943,9 @@ static int dhcpv6_handle_reply(struct net_if *iface, struct net_pkt *pkt,
 	if (iface->config.dhcpv6.state == NET_DHCPV6_CONFIRMING) {
 		if (status != DHCPV6_STATUS_SUCCESS) {
 			rediscover = true;
+#if defined(CONFIG_NET_DHCPV6_LEASE_CACHE)
+			dhcpv6_lease_invalidate(iface);
+#endif
 		}
 
 		goto out;
@@ -2264,6 +2473,14 @@ void net_dhcpv6_start(struct net_if *iface, struct net_dhcpv6_params *params)
 	}
 
 	dhcpv6_generate_client_duid(iface);
+
+#if defined(CONFIG_NET_DHCPV6_LEASE_CACHE)
+	/* When a cached lease is restored, the INIT state will confirm it
+	 * with the server instead of running the full discovery.
+	 */
+	(void)dhcpv6_lease_restore(iface);
+#endif
+
 	dhcpv6_enter_state(iface, NET_DHCPV6_INIT);
 	dhcpv6_reschedule();
 
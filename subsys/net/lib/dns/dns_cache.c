@@ -11,6 +11,7 @@
 LOG_MODULE_REGISTER(net_dns_cache, CONFIG_DNS_RESOLVER_LOG_LEVEL);
 
 static void dns_cache_clean(struct dns_cache const *cache);
+static size_t dns_cache_get_slot(struct dns_cache const *cache);
 
 int dns_cache_flush(struct dns_cache *cache)
 {
@@ -26,9 +27,7 @@ int dns_cache_flush(struct dns_cache *cache)
 int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
 		  uint32_t ttl)
 {
-	k_timepoint_t closest_to_expiry = sys_timepoint_calc(K_FOREVER);
-	size_t index_to_replace = 0;
-	bool found_empty = false;
+	size_t index_to_replace;
 
 	if (cache == NULL || query == NULL || addrinfo == NULL || ttl == 0) {
 		return -EINVAL;
@@ -47,26 +46,70 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
 
 	dns_cache_clean(cache);
 
+	/* The query resolves after all, drop any negative entry for it */
 	for (size_t i = 0; i < cache->size; i++) {
-		if (!cache->entries[i].in_use) {
-			index_to_replace = i;
-			found_empty = true;
-			break;
-		} else if (sys_timepoint_cmp(closest_to_expiry, cache->entries[i].expiry) > 0) {
-			index_to_replace = i;
-			closest_to_expiry = cache->entries[i].expiry;
+		if (cache->entries[i].in_use && cache->entries[i].negative &&
+		    cache->entries[i].data.ai_family == addrinfo->ai_family &&
+		    strcmp(cache->entries[i].query, query) == 0) {
+			cache->entries[i].in_use = false;
 		}
 	}
 
-	if (!found_empty) {
-		NET_DBG("Overwrite \"%s\"", cache->entries[index_to_replace].query);
-	}
+	index_to_replace = dns_cache_get_slot(cache);
 
 	strncpy(cache->entries[index_to_replace].query, query,
 		CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1);
 	cache->entries[index_to_replace].data = *addrinfo;
 	cache->entries[index_to_replace].expiry = sys_timepoint_calc(K_SECONDS(ttl));
 	cache->entries[index_to_replace].in_use = true;
+	cache->entries[index_to_replace].negative = false;
+
+	k_mutex_unlock(cache->lock);
+
+	return 0;
+}
+
+int dns_cache_add_negative(struct dns_cache *cache, char const *query,
+			   enum dns_query_type type, uint32_t ttl)
+{
+	size_t index_to_replace;
+	sa_family_t family;
+
+	if (cache == NULL || query == NULL || ttl == 0) {
+		return -EINVAL;
+	}
+
+	if (type == DNS_QUERY_TYPE_A) {
+		family = AF_INET;
+	} else if (type == DNS_QUERY_TYPE_AAAA) {
+		family = AF_INET6;
+	} else {
+		return -EINVAL;
+	}
+
+	if (strlen(query) >= CONFIG_DNS_RESOLVER_MAX_QUERY_LEN) {
+		NET_WARN("Query string to big to be processed %u >= "
+			 "CONFIG_DNS_RESOLVER_MAX_QUERY_LEN",
+			 strlen(query));
+		return -EINVAL;
+	}
+
+	k_mutex_lock(cache->lock, K_FOREVER);
+
+	NET_DBG("Add negative \"%s\" with TTL %" PRIu32, query, ttl);
+
+	dns_cache_clean(cache);
+
+	index_to_replace = dns_cache_get_slot(cache);
+
+	strncpy(cache->entries[index_to_replace].query, query,
+		CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1);
+	(void)memset(&cache->entries[index_to_replace].data, 0,
+		     sizeof(cache->entries[index_to_replace].data));
+	cache->entries[index_to_replace].data.ai_family = family;
+	cache->entries[index_to_replace].expiry = sys_timepoint_calc(K_SECONDS(ttl));
+	cache->entries[index_to_replace].in_use = true;
+	cache->entries[index_to_replace].negative = true;
 
 	k_mutex_unlock(cache->lock);
 
@@ -101,6 +144,7 @@ int dns_cache_remove(struct dns_cache *cache, char const *query)
 int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_query_type type,
 		   struct dns_addrinfo *addrinfo, size_t addrinfo_array_len)
 {
+	bool negative_hit = false;
 	size_t found = 0;
 	sa_family_t family;
 
@@ -136,6 +180,10 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 		if (cache->entries[i].data.ai_family != family) {
 			continue;
 		}
+		if (cache->entries[i].negative) {
+			negative_hit = true;
+			continue;
+		}
 		if (found >= addrinfo_array_len) {
 			NET_WARN("Found \"%s\" but not enough space in provided buffer.", query);
 			found++;
@@ -153,11 +201,39 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_qu
 	}
 
 	if (found == 0) {
+		if (negative_hit) {
+			NET_DBG("\"%s\" is cached as not resolving", query);
+			return -ENOENT;
+		}
+
 		NET_DBG("Could not find \"%s\"", query);
 	}
 	return found;
 }
 
+/* Pick the entry to (re)use for an addition: a free one if available,
+ * otherwise the one closest to expiry. Needs to be called when lock is
+ * already acquired.
+ */
+static size_t dns_cache_get_slot(struct dns_cache const *cache)
+{
+	k_timepoint_t closest_to_expiry = sys_timepoint_calc(K_FOREVER);
+	size_t index_to_replace = 0;
+
+	for (size_t i = 0; i < cache->size; i++) {
+		if (!cache->entries[i].in_use) {
+			return i;
+		} else if (sys_timepoint_cmp(closest_to_expiry, cache->entries[i].expiry) > 0) {
+			index_to_replace = i;
+			closest_to_expiry = cache->entries[i].expiry;
+		}
+	}
+
+	NET_DBG("Overwrite \"%s\"", cache->entries[index_to_replace].query);
+
+	return index_to_replace;
+}
+
 /* Needs to be called when lock is already acquired */
 static void dns_cache_clean(struct dns_cache const *cache)
 {
@@ -23,6 +23,10 @@ struct dns_cache_entry {
 	struct dns_addrinfo data;
 	k_timepoint_t expiry;
 	bool in_use;
+	/* The query is known not to resolve; only data.ai_family
+	 * is valid in that case.
+	 */
+	bool negative;
 };
 
 struct dns_cache {
@@ -71,6 +75,21 @@ int dns_cache_flush(struct dns_cache *cache);
 int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
 		  uint32_t ttl);
 
+/**
+ * @brief Adds a negative entry to the dns cache, recording that the query
+ * is known not to resolve. Replaces the entry closest to expiry if no free
+ * space is available.
+ *
+ * @param cache Cache where the entry should be added.
+ * @param query Query which should be persisted in the cache.
+ * @param type Query type the failure applies to.
+ * @param ttl Time to live for the entry in seconds.
+ * @retval 0 on success
+ * @retval On error, a negative value is returned.
+ */
+int dns_cache_add_negative(struct dns_cache *cache, char const *query,
+			   enum dns_query_type type, uint32_t ttl);
+
 /**
  * @brief Removes all entries with the given query
  *
@@ -94,6 +113,7 @@ int dns_cache_remove(struct dns_cache *cache, char const *query);
  * @retval On error a negative value is returned.
  * -ENOSR means there was not enough space in the addrinfo array to accommodate all cache hits the
  * array will however be filled with valid data.
+ * -ENOENT means the query is negatively cached and is known not to resolve.
  */
 int dns_cache_find(struct dns_cache const *cache, const char *query, enum dns_query_type type,
 		   struct dns_addrinfo *addrinfo, size_t addrinfo_array_len);
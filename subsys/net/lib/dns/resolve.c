@@ -1173,6 +1173,15 @@ static int dns_read(struct dns_resolve_context *ctx,
 		goto quit;
 	}
 
+#ifdef CONFIG_DNS_RESOLVER_CACHE
+	if (ret == DNS_EAI_NODATA && CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL > 0) {
+		(void)dns_cache_add_negative(&dns_cache,
+					     ctx->queries[query_idx].query,
+					     ctx->queries[query_idx].query_type,
+					     CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL);
+	}
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
 	invoke_query_callback(ret, NULL, &ctx->queries[query_idx]);
 
 	/* Marks the end of the results */
@@ -1575,6 +1584,13 @@ try_resolve:
 
 			cb(DNS_EAI_ALLDONE, NULL, user_data);
 
+			return 0;
+		} else if (ret == -ENOENT) {
+			/* The name is negatively cached, fail right away
+			 * instead of asking the server again.
+			 */
+			cb(DNS_EAI_NODATA, NULL, user_data);
+
 			return 0;
 		}
 	}
@@ -1739,6 +1755,30 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 					 user_data, timeout, true);
 }
 
+static void dns_resolve_prefetch_cb(enum dns_resolve_status status,
+				    struct dns_addrinfo *info,
+				    void *user_data)
+{
+	ARG_UNUSED(status);
+	ARG_UNUSED(info);
+	ARG_UNUSED(user_data);
+
+	/* The response has already updated the cache, nothing more to do */
+}
+
+int dns_resolve_prefetch(struct dns_resolve_context *ctx,
+			 const char *query,
+			 enum dns_query_type type,
+			 int32_t timeout)
+{
+	/* Bypass the cache lookup so that a fresh answer is fetched even
+	 * for a name that is still cached.
+	 */
+	return dns_resolve_name_internal(ctx, query, type, NULL,
+					 dns_resolve_prefetch_cb, NULL,
+					 timeout, false);
+}
+
 /* Must be invoked with context lock held */
 static int dns_resolve_close_locked(struct dns_resolve_context *ctx)
 {
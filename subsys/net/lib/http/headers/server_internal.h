@@ -48,10 +48,25 @@ bool compression_value_is_valid(enum http_compression compression);
 struct http_resource_detail *get_resource_detail(const struct http_service_desc *service,
 						 const char *path, int *len, bool is_ws);
 int http_server_sendall(struct http_client_ctx *client, const void *buf, size_t len);
+#if defined(CONFIG_HTTP_SERVER_TX_COALESCING)
+int http_server_tx_flush(struct http_client_ctx *client);
+#else
+static inline int http_server_tx_flush(struct http_client_ctx *client)
+{
+	ARG_UNUSED(client);
+
+	return 0;
+}
+#endif
 void http_server_get_content_type_from_extension(char *url, char *content_type,
 						 size_t content_type_size);
 int http_server_find_file(char *fname, size_t fname_size, size_t *file_size,
 			  uint8_t supported_compression, enum http_compression *chosen_compression);
+#if defined(CONFIG_HTTP_SERVER_COMPRESSION)
+const void *http_server_select_precompressed(
+	const struct http_resource_detail_static *static_detail,
+	uint8_t supported_compression, size_t *data_len, const char **content_encoding);
+#endif
 void http_client_timer_restart(struct http_client_ctx *client);
 bool http_response_is_final(struct http_response_ctx *rsp, enum http_data_status status);
 bool http_response_is_provided(struct http_response_ctx *rsp);
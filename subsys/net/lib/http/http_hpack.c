@@ -530,13 +530,12 @@ static int hpack_string_encode(uint8_t *buf, size_t buflen,
 }
 
 static int hpack_encode_literal(uint8_t *buf, size_t buflen,
-				struct http_hpack_header_buf *header)
+				struct http_hpack_header_buf *header,
+				uint8_t prefix, uint8_t prefix_len)
 {
 	int ret, len = 0;
 
-	ret = hpack_integer_encode(buf, buflen, 0,
-				   HPACK_PREFIX_LITERAL_NEVER_INDEXED,
-				   HPACK_PREFIX_LEN_LITERAL_NEVER_INDEXED);
+	ret = hpack_integer_encode(buf, buflen, 0, prefix, prefix_len);
 	if (ret < 0) {
 		return ret;
 	}
@@ -565,13 +564,12 @@ static int hpack_encode_literal(uint8_t *buf, size_t buflen,
 }
 
 static int hpack_encode_literal_value(uint8_t *buf, size_t buflen, int index,
-				      struct http_hpack_header_buf *header)
+				      struct http_hpack_header_buf *header,
+				      uint8_t prefix, uint8_t prefix_len)
 {
 	int ret, len = 0;
 
-	ret = hpack_integer_encode(buf, buflen, index,
-				   HPACK_PREFIX_LITERAL_NEVER_INDEXED,
-				   HPACK_PREFIX_LEN_LITERAL_NEVER_INDEXED);
+	ret = hpack_integer_encode(buf, buflen, index, prefix, prefix_len);
 	if (ret < 0) {
 		return ret;
 	}
@@ -615,10 +613,14 @@ int http_hpack_encode_header(uint8_t *buf, size_t buflen,
 	ret = http_hpack_find_index(header, &name_only);
 	if (ret < 0) {
 		/* All literal */
-		len = hpack_encode_literal(buf, buflen, header);
+		len = hpack_encode_literal(buf, buflen, header,
+					   HPACK_PREFIX_LITERAL_NEVER_INDEXED,
+					   HPACK_PREFIX_LEN_LITERAL_NEVER_INDEXED);
 	} else if (name_only) {
 		/* Literal value */
-		len = hpack_encode_literal_value(buf, buflen, ret, header);
+		len = hpack_encode_literal_value(buf, buflen, ret, header,
+						 HPACK_PREFIX_LITERAL_NEVER_INDEXED,
+						 HPACK_PREFIX_LEN_LITERAL_NEVER_INDEXED);
 	} else {
 		/* Indexed */
 		len = hpack_encode_indexed(buf, buflen, ret);
@@ -626,3 +628,201 @@ int http_hpack_encode_header(uint8_t *buf, size_t buflen,
 
 	return len;
 }
+
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+void http_hpack_enc_table_init(struct http_hpack_enc_table *table)
+{
+	table->count = 0;
+	table->size = 0;
+	table->max_size = CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE;
+	table->size_update = false;
+}
+
+/* Offset of the entry name string in the table string buffer. The entry
+ * value string follows the name directly.
+ */
+static size_t enc_table_entry_offset(struct http_hpack_enc_table *table,
+				     uint16_t entry)
+{
+	size_t offset = 0;
+
+	for (uint16_t i = 0; i < entry; i++) {
+		offset += table->entries[i].name_len +
+			  table->entries[i].value_len;
+	}
+
+	return offset;
+}
+
+static void enc_table_evict(struct http_hpack_enc_table *table, size_t needed)
+{
+	/* Evict oldest entries until the required size fits. */
+	while (table->count > 0 && table->size + needed > table->max_size) {
+		size_t str_len = table->entries[0].name_len +
+				 table->entries[0].value_len;
+
+		memmove(table->buf, table->buf + str_len,
+			enc_table_entry_offset(table, table->count) - str_len);
+		memmove(&table->entries[0], &table->entries[1],
+			(table->count - 1) * sizeof(table->entries[0]));
+
+		table->size -= str_len + HTTP_HPACK_DYNAMIC_ENTRY_OVERHEAD;
+		table->count--;
+	}
+}
+
+static void enc_table_add(struct http_hpack_enc_table *table,
+			  struct http_hpack_header_buf *header)
+{
+	size_t entry_size = header->name_len + header->value_len +
+			    HTTP_HPACK_DYNAMIC_ENTRY_OVERHEAD;
+	size_t offset;
+
+	if (entry_size > table->max_size) {
+		/* An oversized entry empties the table, RFC 7541, ch 4.4. */
+		enc_table_evict(table, table->max_size + 1);
+		return;
+	}
+
+	enc_table_evict(table, entry_size);
+
+	offset = enc_table_entry_offset(table, table->count);
+	memcpy(table->buf + offset, header->name, header->name_len);
+	memcpy(table->buf + offset + header->name_len, header->value,
+	       header->value_len);
+
+	table->entries[table->count].name_len = header->name_len;
+	table->entries[table->count].value_len = header->value_len;
+	table->count++;
+	table->size += entry_size;
+}
+
+void http_hpack_enc_table_resize(struct http_hpack_enc_table *table,
+				 uint16_t max_size)
+{
+	max_size = MIN(max_size, CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE_SIZE);
+
+	if (max_size == table->max_size) {
+		return;
+	}
+
+	table->max_size = max_size;
+	enc_table_evict(table, 0);
+
+	/* The new size needs to be acknowledged to the peer with a dynamic
+	 * table size update in the next header block, RFC 7541, ch 4.2.
+	 */
+	table->size_update = true;
+}
+
+/* Find the best match for a header field, searching the static table
+ * first (shorter indexes), then the dynamic table. Dynamic table
+ * indexes follow the static ones, newest entry first.
+ */
+static int enc_table_find_index(struct http_hpack_enc_table *table,
+				struct http_hpack_header_buf *header,
+				bool *name_only)
+{
+	int candidate;
+
+	candidate = http_hpack_find_index(header, name_only);
+	if (candidate >= 0 && !*name_only) {
+		return candidate;
+	}
+
+	for (uint16_t i = 0; i < table->count; i++) {
+		const uint8_t *name = table->buf + enc_table_entry_offset(table, i);
+
+		if (table->entries[i].name_len != header->name_len ||
+		    memcmp(name, header->name, header->name_len) != 0) {
+			continue;
+		}
+
+		if (table->entries[i].value_len == header->value_len &&
+		    memcmp(name + header->name_len, header->value,
+			   header->value_len) == 0) {
+			*name_only = false;
+			return HTTP_HPACK_STATIC_TABLE_SIZE + table->count - i;
+		}
+
+		if (candidate < 0) {
+			candidate = HTTP_HPACK_STATIC_TABLE_SIZE +
+				    table->count - i;
+			*name_only = true;
+		}
+	}
+
+	return (candidate < 0) ? -ENOENT : candidate;
+}
+
+int http_hpack_encode_header_dyn(uint8_t *buf, size_t buflen,
+				 struct http_hpack_header_buf *header,
+				 struct http_hpack_enc_table *table)
+{
+	int ret, len = 0;
+	bool name_only;
+
+	if (table == NULL) {
+		return http_hpack_encode_header(buf, buflen, header);
+	}
+
+	if (buf == NULL || header == NULL ||
+	    header->name == NULL || header->name_len == 0 ||
+	    header->value == NULL || header->value_len == 0) {
+		return -EINVAL;
+	}
+
+	if (buflen == 0) {
+		return -ENOBUFS;
+	}
+
+	if (table->size_update) {
+		ret = hpack_integer_encode(
+			buf, buflen, table->max_size,
+			HPACK_PREFIX_DYNAMIC_TABLE_SIZE_UPDATE,
+			HPACK_PREFIX_LEN_DYNAMIC_TABLE_SIZE_UPDATE);
+		if (ret < 0) {
+			return ret;
+		}
+
+		table->size_update = false;
+		buf += ret;
+		buflen -= ret;
+		len += ret;
+	}
+
+	ret = enc_table_find_index(table, header, &name_only);
+	if (ret >= 0 && !name_only) {
+		/* Indexed */
+		ret = hpack_encode_indexed(buf, buflen, ret);
+		if (ret < 0) {
+			return ret;
+		}
+
+		return len + ret;
+	}
+
+	/* Literal with incremental indexing, so that a repeated header can
+	 * be sent as a plain index next time.
+	 */
+	if (ret >= 0) {
+		ret = hpack_encode_literal_value(
+			buf, buflen, ret, header,
+			HPACK_PREFIX_LITERAL_INDEXING,
+			HPACK_PREFIX_LEN_LITERAL_INDEXING);
+	} else {
+		ret = hpack_encode_literal(
+			buf, buflen, header,
+			HPACK_PREFIX_LITERAL_INDEXING,
+			HPACK_PREFIX_LEN_LITERAL_INDEXING);
+	}
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	enc_table_add(table, header);
+
+	return len + ret;
+}
+#endif /* CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE */
@@ -378,6 +378,9 @@ static void close_client_connection(struct http_client_ctx *client)
 {
 	int fd = client->fd;
 
+	/* Best effort to get any pending data out before closing. */
+	(void)http_server_tx_flush(client);
+
 	http_server_release_client(client);
 
 	(void)zsock_close(fd);
@@ -437,6 +440,14 @@ static void init_client_ctx(struct http_client_ctx *client, const struct http_se
 	}
 
 	client->current_stream = NULL;
+
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+	http_hpack_enc_table_init(&client->hpack_enc_table);
+#endif /* CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE */
+
+#if defined(CONFIG_HTTP_SERVER_TX_COALESCING)
+	client->tx_buffer_len = 0;
+#endif /* CONFIG_HTTP_SERVER_TX_COALESCING */
 }
 
 static int handle_http_preface(struct http_client_ctx *client)
@@ -552,6 +563,7 @@ static int http_server_run(struct http_server_ctx *ctx)
 	bool found_slot;
 	int new_socket;
 	int ret, i, j;
+	int flush_ret;
 	int sock_error;
 	socklen_t optlen = sizeof(int);
 
@@ -685,6 +697,16 @@ static int http_server_run(struct http_server_ctx *ctx)
 			http_client_timer_restart(client);
 
 			ret = handle_http_request(client);
+
+			/* Push out data coalesced during this processing
+			 * round. In case of an error this gets any error
+			 * reply out before the connection is closed.
+			 */
+			flush_ret = http_server_tx_flush(client);
+			if (flush_ret < 0 && (ret >= 0 || ret == -EAGAIN)) {
+				ret = flush_ret;
+			}
+
 			if (ret < 0 && ret != -EAGAIN) {
 				if (ret == -ENOTCONN) {
 					LOG_DBG("Client closed connection while handling request");
@@ -796,6 +818,44 @@ struct http_resource_detail *get_resource_detail(const struct http_service_desc
 	return NULL;
 }
 
+#if defined(CONFIG_HTTP_SERVER_COMPRESSION)
+const void *http_server_select_precompressed(
+	const struct http_resource_detail_static *static_detail,
+	uint8_t supported_compression, size_t *data_len, const char **content_encoding)
+{
+	/* Same preference order as http_server_find_file() */
+	static const enum http_compression preference[] = {
+		HTTP_BR, HTTP_GZIP, HTTP_ZSTD, HTTP_COMPRESS, HTTP_DEFLATE,
+	};
+
+	*data_len = static_detail->static_data_len;
+	*content_encoding = static_detail->common.content_encoding;
+
+	if (static_detail->precompressed == NULL || static_detail->num_precompressed == 0) {
+		return static_detail->static_data;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(preference); i++) {
+		if (!IS_BIT_SET(supported_compression, preference[i])) {
+			continue;
+		}
+
+		for (size_t j = 0; j < static_detail->num_precompressed; j++) {
+			const struct http_resource_precompressed *alt =
+				&static_detail->precompressed[j];
+
+			if (alt->compression == preference[i]) {
+				*data_len = alt->static_data_len;
+				*content_encoding = http_compression_text(alt->compression);
+				return alt->static_data;
+			}
+		}
+	}
+
+	return static_detail->static_data;
+}
+#endif /* CONFIG_HTTP_SERVER_COMPRESSION */
+
 int http_server_find_file(char *fname, size_t fname_size, size_t *file_size,
 			  uint8_t supported_compression, enum http_compression *chosen_compression)
 {
@@ -878,7 +938,8 @@ void http_server_get_content_type_from_extension(char *url, char *content_type,
 	}
 }
 
-int http_server_sendall(struct http_client_ctx *client, const void *buf, size_t len)
+static int http_server_send_direct(struct http_client_ctx *client,
+				   const void *buf, size_t len)
 {
 	while (len) {
 		ssize_t out_len = zsock_send(client->fd, buf, len, 0);
@@ -896,6 +957,56 @@ int http_server_sendall(struct http_client_ctx *client, const void *buf, size_t
 	return 0;
 }
 
+#if defined(CONFIG_HTTP_SERVER_TX_COALESCING)
+int http_server_tx_flush(struct http_client_ctx *client)
+{
+	int ret;
+
+	if (client->tx_buffer_len == 0) {
+		return 0;
+	}
+
+	ret = http_server_send_direct(client, client->tx_buffer,
+				      client->tx_buffer_len);
+	client->tx_buffer_len = 0;
+
+	return ret;
+}
+#endif /* CONFIG_HTTP_SERVER_TX_COALESCING */
+
+int http_server_sendall(struct http_client_ctx *client, const void *buf, size_t len)
+{
+#if defined(CONFIG_HTTP_SERVER_TX_COALESCING)
+	int ret;
+
+	if (len >= sizeof(client->tx_buffer)) {
+		/* Data too large to ever fit in the TX buffer, flush any
+		 * pending data and send directly to keep the byte order.
+		 */
+		ret = http_server_tx_flush(client);
+		if (ret < 0) {
+			return ret;
+		}
+
+		return http_server_send_direct(client, buf, len);
+	}
+
+	if (len > sizeof(client->tx_buffer) - client->tx_buffer_len) {
+		ret = http_server_tx_flush(client);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	memcpy(client->tx_buffer + client->tx_buffer_len, buf, len);
+	client->tx_buffer_len += len;
+
+	return 0;
+#else
+	return http_server_send_direct(client, buf, len);
+#endif /* CONFIG_HTTP_SERVER_TX_COALESCING */
+}
+
 bool http_response_is_final(struct http_response_ctx *rsp, enum http_data_status status)
 {
 	if (status != HTTP_SERVER_DATA_FINAL) {
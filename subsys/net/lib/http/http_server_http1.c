@@ -132,6 +132,7 @@ static int handle_http1_static_resource(
 			   sizeof("Content-Type: \r\n") + HTTP_SERVER_MAX_CONTENT_TYPE_LEN +
 			   sizeof("xxxx") +
 			   sizeof("\r\n")];
+	const char *content_encoding;
 	const char *data;
 	int len;
 	int ret;
@@ -142,15 +143,23 @@ static int handle_http1_static_resource(
 
 	data = static_detail->static_data;
 	len = static_detail->static_data_len;
+	content_encoding = static_detail->common.content_encoding;
 
-	if (static_detail->common.content_encoding != NULL &&
-	    static_detail->common.content_encoding[0] != '\0') {
+#if defined(CONFIG_HTTP_SERVER_COMPRESSION)
+	size_t selected_len;
+
+	data = http_server_select_precompressed(static_detail, client->supported_compression,
+						&selected_len, &content_encoding);
+	len = selected_len;
+#endif
+
+	if (content_encoding != NULL && content_encoding[0] != '\0') {
 		snprintk(http_response, sizeof(http_response),
 			 RESPONSE_TEMPLATE "Content-Encoding: %s\r\n\r\n",
 			 "Content-Type: ",
 			 static_detail->common.content_type == NULL ?
 			 "text/html" : static_detail->common.content_type,
-			 len, static_detail->common.content_encoding);
+			 len, content_encoding);
 	} else {
 		snprintk(http_response, sizeof(http_response),
 			 RESPONSE_TEMPLATE "\r\n",
@@ -117,7 +117,12 @@ static int add_header_field(struct http_client_ctx *client, uint8_t **buf,
 	client->header_field.value = value;
 	client->header_field.value_len = strlen(value);
 
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+	ret = http_hpack_encode_header_dyn(*buf, *buflen, &client->header_field,
+					   &client->hpack_enc_table);
+#else
 	ret = http_hpack_encode_header(*buf, *buflen, &client->header_field);
+#endif /* CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE */
 	if (ret < 0) {
 		LOG_DBG("Failed to encode header, err %d", ret);
 		return ret;
@@ -429,8 +434,20 @@ static int handle_http2_static_resource(
 	content_200 = static_detail->static_data;
 	content_len = static_detail->static_data_len;
 
+#if defined(CONFIG_HTTP_SERVER_COMPRESSION)
+	struct http_resource_detail res_detail = static_detail->common;
+
+	content_200 = http_server_select_precompressed(static_detail,
+						       client->supported_compression,
+						       &content_len,
+						       &res_detail.content_encoding);
+
+	ret = send_headers_frame(client, HTTP_200_OK, frame->stream_identifier,
+				 &res_detail, 0, NULL, 0);
+#else
 	ret = send_headers_frame(client, HTTP_200_OK, frame->stream_identifier,
 				 &static_detail->common, 0, NULL, 0);
+#endif
 	if (ret < 0) {
 		LOG_DBG("Cannot write to socket (%d)", ret);
 		goto out;
@@ -1725,6 +1742,31 @@ int handle_http_frame_rst_stream(struct http_client_ctx *client)
 	return 0;
 }
 
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+static void settings_parse_header_table_size(struct http_client_ctx *client)
+{
+	const uint8_t *buf = client->cursor;
+	size_t len = client->current_frame.length;
+
+	while (len >= sizeof(struct http2_settings_field)) {
+		uint16_t id = sys_get_be16(buf);
+		uint32_t value = sys_get_be32(buf + sizeof(uint16_t));
+
+		if (id == HTTP2_SETTINGS_HEADER_TABLE_SIZE) {
+			/* The encoder table may not exceed the size the peer
+			 * decoder advertises.
+			 */
+			http_hpack_enc_table_resize(
+				&client->hpack_enc_table,
+				(uint16_t)MIN(value, UINT16_MAX));
+		}
+
+		buf += sizeof(struct http2_settings_field);
+		len -= sizeof(struct http2_settings_field);
+	}
+}
+#endif /* CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE */
+
 int handle_http_frame_settings(struct http_client_ctx *client)
 {
 	struct http2_frame *frame = &client->current_frame;
@@ -1736,6 +1778,12 @@ int handle_http_frame_settings(struct http_client_ctx *client)
 		return -EAGAIN;
 	}
 
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+	if (!is_header_flag_set(frame->flags, HTTP2_FLAG_SETTINGS_ACK)) {
+		settings_parse_header_table_size(client);
+	}
+#endif /* CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE */
+
 	bytes_consumed = client->current_frame.length;
 	client->data_len -= bytes_consumed;
 	client->cursor += bytes_consumed;
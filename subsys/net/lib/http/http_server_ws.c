@@ -102,6 +102,15 @@ int handle_http1_to_websocket_upgrade(struct http_client_ctx *client)
 
 		ws_detail = (struct http_resource_detail_websocket *)client->current_detail;
 
+		/* Make sure the handshake reply is sent out before the
+		 * application takes over the socket.
+		 */
+		ret = http_server_tx_flush(client);
+		if (ret < 0) {
+			NET_DBG("Cannot write to socket (%d)", ret);
+			goto error;
+		}
+
 		ret = ws_sock = websocket_register(client->fd,
 						   ws_detail->data_buffer,
 						   ws_detail->data_buffer_len);
@@ -99,6 +99,48 @@ static void lwm2m_engine_cache_write(const struct lwm2m_engine_obj_field *obj_fi
 				     const struct lwm2m_obj_path *path, const void *value,
 				     uint16_t len);
 #endif
+
+#if defined(CONFIG_LWM2M_REGISTRY_LOOKUP_CACHE)
+/* Direct-mapped cache of recent object instance lookups, keyed by object and
+ * object instance ID. Entries are inserted on lookup and invalidated when the
+ * instance or its object is unregistered, so a hit never returns a stale
+ * pointer.
+ */
+static struct lwm2m_engine_obj_inst *obj_inst_cache[CONFIG_LWM2M_REGISTRY_LOOKUP_CACHE_SIZE];
+
+static size_t obj_inst_cache_slot(int obj_id, int obj_inst_id)
+{
+	uint32_t key = ((uint32_t)obj_id << 16) | (uint32_t)(uint16_t)obj_inst_id;
+
+	/* Knuth multiplicative hash, spreads consecutive IDs across slots */
+	return (key * 2654435761U) % ARRAY_SIZE(obj_inst_cache);
+}
+
+static void obj_inst_cache_insert(struct lwm2m_engine_obj_inst *obj_inst)
+{
+	obj_inst_cache[obj_inst_cache_slot(obj_inst->obj->obj_id, obj_inst->obj_inst_id)] =
+		obj_inst;
+}
+
+static void obj_inst_cache_remove(struct lwm2m_engine_obj_inst *obj_inst)
+{
+	size_t slot = obj_inst_cache_slot(obj_inst->obj->obj_id, obj_inst->obj_inst_id);
+
+	if (obj_inst_cache[slot] == obj_inst) {
+		obj_inst_cache[slot] = NULL;
+	}
+}
+
+static void obj_inst_cache_remove_obj(struct lwm2m_engine_obj *obj)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(obj_inst_cache); i++) {
+		if (obj_inst_cache[i] != NULL && obj_inst_cache[i]->obj == obj) {
+			obj_inst_cache[i] = NULL;
+		}
+	}
+}
+#endif /* CONFIG_LWM2M_REGISTRY_LOOKUP_CACHE */
+
 /* Engine object */
 
 void lwm2m_register_obj(struct lwm2m_engine_obj *obj)
@@ -123,6 +165,9 @@ void lwm2m_unregister_obj(struct lwm2m_engine_obj *obj)
 	access_control_remove_obj(obj->obj_id);
 #endif
 	engine_remove_observer_by_id(obj->obj_id, -1);
+#if defined(CONFIG_LWM2M_REGISTRY_LOOKUP_CACHE)
+	obj_inst_cache_remove_obj(obj);
+#endif
 	sys_slist_find_and_remove(&engine_obj_list, &obj->node);
 	k_mutex_unlock(&registry_lock);
 }
@@ -184,6 +229,9 @@ static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 	access_control_remove(obj_inst->obj->obj_id, obj_inst->obj_inst_id);
 #endif
 	engine_remove_observer_by_id(obj_inst->obj->obj_id, obj_inst->obj_inst_id);
+#if defined(CONFIG_LWM2M_REGISTRY_LOOKUP_CACHE)
+	obj_inst_cache_remove(obj_inst);
+#endif
 	sys_slist_find_and_remove(&engine_obj_inst_list, &obj_inst->node);
 }
 
@@ -191,8 +239,19 @@ struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id, int obj_inst_id)
 {
 	struct lwm2m_engine_obj_inst *obj_inst;
 
+#if defined(CONFIG_LWM2M_REGISTRY_LOOKUP_CACHE)
+	obj_inst = obj_inst_cache[obj_inst_cache_slot(obj_id, obj_inst_id)];
+	if (obj_inst != NULL && obj_inst->obj->obj_id == obj_id &&
+	    obj_inst->obj_inst_id == obj_inst_id) {
+		return obj_inst;
+	}
+#endif
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_inst_list, obj_inst, node) {
 		if (obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id == obj_inst_id) {
+#if defined(CONFIG_LWM2M_REGISTRY_LOOKUP_CACHE)
+			obj_inst_cache_insert(obj_inst);
+#endif
 			return obj_inst;
 		}
 	}
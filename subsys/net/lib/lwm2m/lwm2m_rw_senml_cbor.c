@@ -35,6 +35,40 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 
 #define SENML_MAX_NAME_SIZE sizeof("/65535/65535/")
 
+#if defined(CONFIG_LWM2M_RW_SENML_CBOR_STREAMING)
+
+/* A record map holds at most bn, bt, n, t and one value */
+#define SENML_STREAM_MAP_PAIRS 5
+
+struct cbor_out_fmt_data {
+	/* Low-level zcbor encode state emitting into the CoAP packet buffer */
+	zcbor_state_t states[3];
+
+	/* Start of the SenML payload in the packet buffer */
+	uint8_t *payload_start;
+
+	/* Names waiting for the next record to be emitted */
+	char basename[SENML_MAX_NAME_SIZE];
+	char name[SENML_MAX_NAME_SIZE];
+	size_t basename_len;
+	size_t name_len;
+	bool basename_pending;
+	bool name_pending;
+
+	/* Timestamp waiting for the next record */
+	int64_t time_value;
+	bool t_pending;
+	bool bt_pending;
+
+	/* Whether the outer record array has been started */
+	bool list_open;
+
+	/* Basetime for Cached data timestamp */
+	time_t basetime;
+};
+
+#else /* CONFIG_LWM2M_RW_SENML_CBOR_STREAMING */
+
 struct cbor_out_fmt_data {
 	/* Data */
 	struct lwm2m_senml input;
@@ -57,6 +91,8 @@ struct cbor_out_fmt_data {
 	};
 };
 
+#endif /* CONFIG_LWM2M_RW_SENML_CBOR_STREAMING */
+
 struct cbor_in_fmt_data {
 	/* Decoded data */
 	struct lwm2m_senml dcd; /* Decoded data */
@@ -98,9 +134,13 @@ static void setup_out_fmt_data(struct lwm2m_message *msg)
 
 	(void)memset(fd, 0, sizeof(*fd));
 	engine_set_out_user_data(&msg->out, fd);
+#if defined(CONFIG_LWM2M_RW_SENML_CBOR_STREAMING)
+	/* The encode state is set up lazily when the first record is emitted */
+#else
 	fd->name_sz = SENML_MAX_NAME_SIZE;
 	fd->basetime = 0;
 	fd->objlnk_sz = sizeof("65535:65535");
+#endif
 }
 
 static void clear_out_fmt_data(struct lwm2m_message *msg)
@@ -127,6 +167,7 @@ static void clear_in_fmt_data(struct lwm2m_message *msg)
 	k_mutex_unlock(&fd_mtx);
 }
 
+#if !defined(CONFIG_LWM2M_RW_SENML_CBOR_STREAMING)
 static int fmt_range_check(struct cbor_out_fmt_data *fd)
 {
 	if (fd->name_cnt >= CONFIG_LWM2M_RW_SENML_CBOR_RECORDS ||
@@ -174,6 +215,7 @@ static int put_basename(struct lwm2m_output_context *out, struct lwm2m_obj_path
 
 	return 0;
 }
+#endif /* !CONFIG_LWM2M_RW_SENML_CBOR_STREAMING */
 
 static int put_empty_array(struct lwm2m_output_context *out)
 {
@@ -185,6 +227,224 @@ static int put_empty_array(struct lwm2m_output_context *out)
 	return len;
 }
 
+#if defined(CONFIG_LWM2M_RW_SENML_CBOR_STREAMING)
+
+/* Open the record map and emit the names and timestamps waiting for it */
+static int stream_record_begin(struct lwm2m_output_context *out)
+{
+	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
+	zcbor_state_t *st = fd->states;
+	struct zcbor_string name;
+	bool ok;
+
+	if (!fd->list_open) {
+		fd->payload_start = CPKT_BUF_W_PTR(out->out_cpkt);
+		zcbor_new_encode_state(fd->states, ARRAY_SIZE(fd->states), fd->payload_start,
+				       CPKT_BUF_W_SIZE(out->out_cpkt), 1);
+
+		/* The number of records is not known up front, reserve a
+		 * header large enough for any of them
+		 */
+		if (!zcbor_list_start_encode(st, UINT16_MAX)) {
+			return -ENOMEM;
+		}
+		fd->list_open = true;
+	}
+
+	ok = zcbor_map_start_encode(st, SENML_STREAM_MAP_PAIRS);
+
+	if (ok && fd->basename_pending) {
+		name.value = (uint8_t *)fd->basename;
+		name.len = fd->basename_len;
+		ok = zcbor_int32_put(st, lwm2m_senml_cbor_key_bn) &&
+		     zcbor_tstr_encode(st, &name);
+		fd->basename_pending = false;
+	}
+
+	if (ok && fd->bt_pending) {
+		ok = zcbor_int32_put(st, lwm2m_senml_cbor_key_bt) &&
+		     zcbor_int64_put(st, fd->time_value);
+		fd->bt_pending = false;
+	}
+
+	if (ok && fd->name_pending) {
+		name.value = (uint8_t *)fd->name;
+		name.len = fd->name_len;
+		ok = zcbor_uint32_put(st, lwm2m_senml_cbor_key_n) &&
+		     zcbor_tstr_encode(st, &name);
+		fd->name_pending = false;
+	}
+
+	if (ok && fd->t_pending) {
+		ok = zcbor_uint32_put(st, lwm2m_senml_cbor_key_t) &&
+		     zcbor_int64_put(st, fd->time_value);
+		fd->t_pending = false;
+	}
+
+	return ok ? 0 : -ENOMEM;
+}
+
+static int stream_record_end(struct lwm2m_output_context *out)
+{
+	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
+
+	if (!zcbor_map_end_encode(fd->states, SENML_STREAM_MAP_PAIRS)) {
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+
+static int put_end(struct lwm2m_output_context *out, struct lwm2m_obj_path *path)
+{
+	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
+	size_t len;
+
+	if (!fd->list_open) {
+		len = put_empty_array(out);
+
+		return len;
+	}
+
+	if (!zcbor_list_end_encode(fd->states, UINT16_MAX)) {
+		LOG_ERR("unable to encode senml cbor msg");
+
+		return -E2BIG;
+	}
+
+	fd->list_open = false;
+
+	len = fd->states->payload - fd->payload_start;
+	out->out_cpkt->offset += len;
+
+	return len;
+}
+
+static int put_begin_oi(struct lwm2m_output_context *out, struct lwm2m_obj_path *path)
+{
+	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
+	int len;
+	uint8_t tmp = path->level;
+
+	/* In case path level is set to 'none' or 'object' and we have only default oi */
+	path->level = LWM2M_PATH_LEVEL_OBJECT_INST;
+
+	len = path_to_string(fd->basename, sizeof(fd->basename), path,
+			     LWM2M_PATH_LEVEL_OBJECT_INST);
+	path->level = tmp;
+
+	if (len < 0) {
+		return len;
+	}
+
+	if ((len < sizeof("/0/0") - 1) || (len >= SENML_MAX_NAME_SIZE)) {
+		__ASSERT_NO_MSG(false);
+		return -EINVAL;
+	}
+
+	fd->basename_len = len;
+	fd->basename_pending = true;
+
+	return 0;
+}
+
+static int put_begin_r(struct lwm2m_output_context *out, struct lwm2m_obj_path *path)
+{
+	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
+	int len;
+
+	/* Write resource name */
+	len = snprintk(fd->name, sizeof("65535"), "%" PRIu16 "", path->res_id);
+
+	if (len < sizeof("0") - 1) {
+		__ASSERT_NO_MSG(false);
+		return -EINVAL;
+	}
+
+	fd->name_len = len;
+	fd->name_pending = true;
+
+	return 0;
+}
+
+static int put_data_timestamp(struct lwm2m_output_context *out, time_t value)
+{
+	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
+
+	if (fd->basetime) {
+		fd->time_value = value - fd->basetime;
+		fd->t_pending = true;
+	} else {
+		fd->basetime = value;
+		fd->time_value = value;
+		fd->bt_pending = true;
+	}
+
+	return 0;
+}
+
+static int put_begin_ri(struct lwm2m_output_context *out, struct lwm2m_obj_path *path)
+{
+	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
+
+	/* Forms name from resource id and resource instance id */
+	int len = snprintk(fd->name, SENML_MAX_NAME_SIZE,
+			   "%" PRIu16 "/%" PRIu16 "",
+			   path->res_id, path->res_inst_id);
+
+	if (len < sizeof("0/0") - 1) {
+		__ASSERT_NO_MSG(false);
+		return -EINVAL;
+	}
+
+	fd->name_len = len;
+	fd->name_pending = true;
+
+	return 0;
+}
+
+static int put_name_nth_ri(struct lwm2m_output_context *out, struct lwm2m_obj_path *path)
+{
+	int ret = 0;
+	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
+
+	/* With the first ri the resource name (and ri name) are already in place*/
+	if (path->res_inst_id > 0) {
+		ret = put_begin_ri(out, path);
+	} else if (fd->t_pending) {
+		/* Name need to be add for each time serialized record */
+		ret = put_begin_r(out, path);
+	}
+
+	return ret;
+}
+
+static int put_value(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, int64_t value)
+{
+	zcbor_state_t *st;
+	int ret = put_name_nth_ri(out, path);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = stream_record_begin(out);
+	if (ret < 0) {
+		return ret;
+	}
+
+	st = LWM2M_OFD_CBOR(out)->states;
+
+	/* Write the value */
+	if (!zcbor_uint32_put(st, lwm2m_senml_cbor_key_vi) || !zcbor_int64_put(st, value)) {
+		return -ENOMEM;
+	}
+
+	return stream_record_end(out);
+}
+
+#else /* CONFIG_LWM2M_RW_SENML_CBOR_STREAMING */
+
 static int put_end(struct lwm2m_output_context *out, struct lwm2m_obj_path *path)
 {
 	size_t len;
@@ -378,6 +638,7 @@ static int put_value(struct lwm2m_output_context *out, struct lwm2m_obj_path *pa
 
 	return 0;
 }
+#endif /* CONFIG_LWM2M_RW_SENML_CBOR_STREAMING */
 
 static int put_s8(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, int8_t value)
 {
@@ -399,6 +660,155 @@ static int put_s64(struct lwm2m_output_context *out, struct lwm2m_obj_path *path
 	return put_value(out, path, value);
 }
 
+#if defined(CONFIG_LWM2M_RW_SENML_CBOR_STREAMING)
+
+static int put_time(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, time_t value)
+{
+	return put_value(out, path, (int64_t)value);
+}
+
+static int put_float(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, double *value)
+{
+	zcbor_state_t *st;
+	int ret = put_name_nth_ri(out, path);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = stream_record_begin(out);
+	if (ret < 0) {
+		return ret;
+	}
+
+	st = LWM2M_OFD_CBOR(out)->states;
+
+	/* Write the value */
+	if (!zcbor_uint32_put(st, lwm2m_senml_cbor_key_vf) || !zcbor_float64_put(st, *value)) {
+		return -ENOMEM;
+	}
+
+	return stream_record_end(out);
+}
+
+static int put_string(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, char *buf,
+		      size_t buflen)
+{
+	struct zcbor_string vs = { .value = (uint8_t *)buf, .len = buflen };
+	zcbor_state_t *st;
+	int ret = put_name_nth_ri(out, path);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = stream_record_begin(out);
+	if (ret < 0) {
+		return ret;
+	}
+
+	st = LWM2M_OFD_CBOR(out)->states;
+
+	/* Write the value */
+	if (!zcbor_uint32_put(st, lwm2m_senml_cbor_key_vs) || !zcbor_tstr_encode(st, &vs)) {
+		return -ENOMEM;
+	}
+
+	return stream_record_end(out);
+}
+
+static int put_bool(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, bool value)
+{
+	zcbor_state_t *st;
+	int ret = put_name_nth_ri(out, path);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = stream_record_begin(out);
+	if (ret < 0) {
+		return ret;
+	}
+
+	st = LWM2M_OFD_CBOR(out)->states;
+
+	/* Write the value */
+	if (!zcbor_uint32_put(st, lwm2m_senml_cbor_key_vb) || !zcbor_bool_put(st, value)) {
+		return -ENOMEM;
+	}
+
+	return stream_record_end(out);
+}
+
+static int put_opaque(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, char *buf,
+		      size_t buflen)
+{
+	struct zcbor_string vd = { .value = (uint8_t *)buf, .len = buflen };
+	zcbor_state_t *st;
+	int ret = put_name_nth_ri(out, path);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = stream_record_begin(out);
+	if (ret < 0) {
+		return ret;
+	}
+
+	st = LWM2M_OFD_CBOR(out)->states;
+
+	/* Write the value */
+	if (!zcbor_uint32_put(st, lwm2m_senml_cbor_key_vd) || !zcbor_bstr_encode(st, &vd)) {
+		return -ENOMEM;
+	}
+
+	return stream_record_end(out);
+}
+
+static int put_objlnk(struct lwm2m_output_context *out, struct lwm2m_obj_path *path,
+		      struct lwm2m_objlnk *value)
+{
+	char objlnk[sizeof("65535:65535")];
+	struct zcbor_string key = { .value = (uint8_t *)"vlo", .len = sizeof("vlo") - 1 };
+	struct zcbor_string vlo;
+	zcbor_state_t *st;
+	int ret;
+
+	/* Format object link */
+	int objlnk_len = snprintk(objlnk, sizeof(objlnk), "%u:%u", value->obj_id,
+				  value->obj_inst);
+	if (objlnk_len < 0) {
+		return -EINVAL;
+	}
+
+	ret = put_name_nth_ri(out, path);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = stream_record_begin(out);
+	if (ret < 0) {
+		return ret;
+	}
+
+	st = LWM2M_OFD_CBOR(out)->states;
+
+	/* Write the value */
+	vlo.value = (uint8_t *)objlnk;
+	vlo.len = objlnk_len;
+
+	if (!zcbor_tstr_encode(st, &key) || !zcbor_tstr_encode(st, &vlo)) {
+		return -ENOMEM;
+	}
+
+	return stream_record_end(out);
+}
+
+#else /* CONFIG_LWM2M_RW_SENML_CBOR_STREAMING */
+
 static int put_time(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, time_t value)
 {
 	int ret = put_name_nth_ri(out, path);
@@ -531,6 +941,7 @@ static int put_objlnk(struct lwm2m_output_context *out, struct lwm2m_obj_path *p
 
 	return 0;
 }
+#endif /* CONFIG_LWM2M_RW_SENML_CBOR_STREAMING */
 
 static int get_opaque(struct lwm2m_input_context *in,
 			 uint8_t *value, size_t buflen,
@@ -25,13 +25,61 @@ static void client_reset(struct mqtt_client *client)
 	client->internal.last_activity = 0U;
 	client->internal.rx_buf_datalen = 0U;
 	client->internal.remaining_payload = 0U;
+#if defined(CONFIG_MQTT_QOS0_TX_COALESCE)
+	client->internal.tx_pending = 0U;
+#endif
+}
+
+#if defined(CONFIG_MQTT_QOS0_TX_COALESCE)
+/** @brief Send any coalesced QoS 0 publishes queued in the tx buffer. */
+static int client_flush(struct mqtt_client *client)
+{
+	int err_code;
+
+	if (client->internal.tx_pending == 0U) {
+		return 0;
+	}
+
+	NET_DBG("[%p]: Flushing %u queued bytes.", client,
+		client->internal.tx_pending);
+
+	err_code = mqtt_transport_write(client, client->tx_buf,
+					client->internal.tx_pending);
+	client->internal.tx_pending = 0U;
+	if (err_code < 0) {
+		NET_ERR("Transport write failed, err_code = %d, "
+			 "closing connection", err_code);
+		mqtt_client_disconnect(client, err_code, true);
+		return err_code;
+	}
+
+	client->internal.last_activity = mqtt_sys_tick_in_ms_get();
+
+	return 0;
+}
+#else
+static int client_flush(struct mqtt_client *client)
+{
+	ARG_UNUSED(client);
+
+	return 0;
 }
+#endif /* CONFIG_MQTT_QOS0_TX_COALESCE */
 
 /** @brief Initialize tx buffer. */
 static void tx_buf_init(struct mqtt_client *client, struct buf_ctx *buf)
 {
-	memset(client->tx_buf, 0, client->tx_buf_size);
-	buf->cur = client->tx_buf;
+	uint32_t offset = 0U;
+
+#if defined(CONFIG_MQTT_QOS0_TX_COALESCE)
+	/* Encode past any coalesced QoS 0 publishes still queued in the
+	 * buffer; they are flushed before the newly encoded packet is sent.
+	 */
+	offset = client->internal.tx_pending;
+#endif
+
+	memset(client->tx_buf + offset, 0, client->tx_buf_size - offset);
+	buf->cur = client->tx_buf + offset;
 	buf->end = client->tx_buf + client->tx_buf_size;
 }
 
@@ -188,6 +236,11 @@ static int client_write(struct mqtt_client *client, const uint8_t *data,
 
 	NET_DBG("[%p]: Transport writing %d bytes.", client, datalen);
 
+	err_code = client_flush(client);
+	if (err_code < 0) {
+		return err_code;
+	}
+
 	err_code = mqtt_transport_write(client, data, datalen);
 	if (err_code < 0) {
 		NET_ERR("Transport write failed, err_code = %d, "
@@ -209,6 +262,11 @@ static int client_write_msg(struct mqtt_client *client,
 
 	NET_DBG("[%p]: Transport writing message.", client);
 
+	err_code = client_flush(client);
+	if (err_code < 0) {
+		return err_code;
+	}
+
 	err_code = mqtt_transport_write_msg(client, message);
 	if (err_code < 0) {
 		NET_ERR("Transport write failed, err_code = %d, "
@@ -319,10 +377,47 @@ int mqtt_publish(struct mqtt_client *client,
 	}
 
 	err_code = publish_encode(client, param, &packet);
+#if defined(CONFIG_MQTT_QOS0_TX_COALESCE)
+	if ((err_code == -ENOMEM) && (client->internal.tx_pending > 0U)) {
+		/* Make room by sending the queued publishes and retry. */
+		err_code = client_flush(client);
+		if (err_code < 0) {
+			goto error;
+		}
+
+		tx_buf_init(client, &packet);
+		err_code = publish_encode(client, param, &packet);
+	}
+#endif
 	if (err_code < 0) {
 		goto error;
 	}
 
+#if defined(CONFIG_MQTT_QOS0_TX_COALESCE)
+	if (param->message.topic.qos == MQTT_QOS_0_AT_MOST_ONCE) {
+		uint32_t pending = client->internal.tx_pending;
+		uint32_t hdr_len = packet.end - packet.cur;
+
+		if ((pending + hdr_len + param->message.payload.len) <=
+		    client->tx_buf_size) {
+			/* Queue the message for a later combined write
+			 * instead of sending it right away. The encoded
+			 * header is moved down to close the gap left by
+			 * the fixed header reservation.
+			 */
+			memmove(client->tx_buf + pending, packet.cur, hdr_len);
+			memcpy(client->tx_buf + pending + hdr_len,
+			       param->message.payload.data,
+			       param->message.payload.len);
+			client->internal.tx_pending =
+				pending + hdr_len + param->message.payload.len;
+
+			err_code = 0;
+			goto error;
+		}
+	}
+#endif
+
 	io_vector[0].iov_base = packet.cur;
 	io_vector[0].iov_len = packet.end - packet.cur;
 	io_vector[1].iov_base = param->message.payload.data;
@@ -711,6 +806,12 @@ int mqtt_live(struct mqtt_client *client)
 
 	mqtt_mutex_lock(client);
 
+	err_code = client_flush(client);
+	if (err_code < 0) {
+		mqtt_mutex_unlock(client);
+		return err_code;
+	}
+
 	elapsed_time = mqtt_elapsed_time_in_ms_get(
 				client->internal.last_activity);
 	if ((client->keepalive > 0) &&
@@ -757,7 +858,10 @@ int mqtt_input(struct mqtt_client *client)
 	NET_DBG("state:0x%08x", client->internal.state);
 
 	if (MQTT_HAS_STATE(client, MQTT_STATE_TCP_CONNECTED)) {
-		err_code = client_read(client);
+		err_code = client_flush(client);
+		if (err_code == 0) {
+			err_code = client_read(client);
+		}
 	} else {
 		err_code = -ENOTCONN;
 	}
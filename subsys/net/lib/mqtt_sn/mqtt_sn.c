@@ -57,6 +57,7 @@ struct mqtt_sn_topic {
 	sys_snode_t next;
 	char name[CONFIG_MQTT_SN_LIB_MAX_TOPIC_SIZE];
 	size_t namelen;
+	uint32_t name_hash;
 	uint16_t topic_id;
 	enum mqtt_sn_qos qos;
 	enum mqtt_sn_topic_type type;
@@ -105,15 +106,19 @@ static uint16_t next_msg_id(void)
 	return ++msg_id;
 }
 
-static int encode_and_send(struct mqtt_sn_client *client, struct mqtt_sn_param *p,
-			   uint8_t broadcast_radius)
+/**
+ * @brief Send the current content of the tx buffer and reset it.
+ *
+ * The buffer may hold several back-to-back messages: the MQTT-SN length
+ * prefix of each message delimits it within the datagram.
+ *
+ * @param client
+ * @param broadcast_radius Broadcast radius, or 0 for unicast to the gateway
+ * @return 0 or negative error code
+ */
+static int send_tx(struct mqtt_sn_client *client, uint8_t broadcast_radius)
 {
-	int err;
-
-	err = mqtt_sn_encode_msg(&client->tx, p);
-	if (err) {
-		goto end;
-	}
+	int err = 0;
 
 	LOG_HEXDUMP_DBG(client->tx.data, client->tx.len, "Send message");
 
@@ -154,6 +159,21 @@ end:
 	return err;
 }
 
+static int encode_and_send(struct mqtt_sn_client *client, struct mqtt_sn_param *p,
+			   uint8_t broadcast_radius)
+{
+	int err;
+
+	err = mqtt_sn_encode_msg(&client->tx, p);
+	if (err) {
+		LOG_ERR("Error during send: %d", err);
+		net_buf_simple_reset(&client->tx);
+		return err;
+	}
+
+	return send_tx(client, broadcast_radius);
+}
+
 static void mqtt_sn_con_init(struct mqtt_sn_confirmable *con)
 {
 	con->last_attempt = 0;
@@ -232,6 +252,29 @@ static struct mqtt_sn_publish *mqtt_sn_publish_find_by_topic(struct mqtt_sn_clie
 	return NULL;
 }
 
+/**
+ * @brief Hash a topic name (FNV-1a).
+ *
+ * Stored per topic so that lookups compare one word instead of the full
+ * name for every registered topic.
+ *
+ * @param data topic name
+ * @param sz topic name length
+ * @return 32-bit hash of the name
+ */
+static uint32_t mqtt_sn_topic_hash(const void *data, size_t sz)
+{
+	const uint8_t *bytes = data;
+	uint32_t hash = 0x811c9dc5;
+
+	for (size_t i = 0; i < sz; i++) {
+		hash ^= bytes[i];
+		hash *= 0x01000193;
+	}
+
+	return hash;
+}
+
 static struct mqtt_sn_topic *mqtt_sn_topic_create(struct mqtt_sn_data *name)
 {
 	struct mqtt_sn_topic *topic;
@@ -255,6 +298,7 @@ static struct mqtt_sn_topic *mqtt_sn_topic_create(struct mqtt_sn_data *name)
 
 	memcpy(topic->name, name->data, name->size);
 	topic->namelen = name->size;
+	topic->name_hash = mqtt_sn_topic_hash(name->data, name->size);
 
 	mqtt_sn_con_init(&topic->con);
 
@@ -265,9 +309,10 @@ static struct mqtt_sn_topic *mqtt_sn_topic_find_by_name(struct mqtt_sn_client *c
 							struct mqtt_sn_data *topic_name)
 {
 	struct mqtt_sn_topic *topic;
+	uint32_t name_hash = mqtt_sn_topic_hash(topic_name->data, topic_name->size);
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&client->topic, topic, next) {
-		if (topic->namelen == topic_name->size &&
+		if (topic->name_hash == name_hash && topic->namelen == topic_name->size &&
 		    memcmp(topic->name, topic_name->data, topic_name->size) == 0) {
 			return topic;
 		}
@@ -557,7 +602,40 @@ static void mqtt_sn_do_publish(struct mqtt_sn_client *client, struct mqtt_sn_pub
 	p.params.publish.qos = pub->qos;
 	p.params.publish.dup = dup;
 
+#if defined(CONFIG_MQTT_SN_LIB_AGGREGATE_PUBLISH)
+	/* On-wire size: length field + type + flags + topic ID + msg ID + data */
+	size_t msgsz = 6 + pub->datalen;
+
+	msgsz += (msgsz > 254) ? 3 : 1;
+
+	/* Flush the current datagram if this message does not fit behind it */
+	if (client->tx.len > 0 && net_buf_simple_tailroom(&client->tx) < msgsz) {
+		send_tx(client, 0);
+	}
+
+	int err = mqtt_sn_encode_msg(&client->tx, &p);
+
+	if (err) {
+		LOG_ERR("Error encoding publish: %d", err);
+	}
+#else
 	encode_and_send(client, &p, 0);
+#endif /* CONFIG_MQTT_SN_LIB_AGGREGATE_PUBLISH */
+}
+
+/**
+ * @brief Send any PUBLISH messages aggregated in the tx buffer.
+ *
+ * No-op unless @kconfig{CONFIG_MQTT_SN_LIB_AGGREGATE_PUBLISH} is enabled,
+ * as every other code path transmits its message immediately.
+ *
+ * @param client
+ */
+static void mqtt_sn_flush_pubs(struct mqtt_sn_client *client)
+{
+	if (IS_ENABLED(CONFIG_MQTT_SN_LIB_AGGREGATE_PUBLISH) && client->tx.len > 0) {
+		send_tx(client, 0);
+	}
 }
 
 /**
@@ -665,6 +743,7 @@ static int process_pubs(struct mqtt_sn_client *client, int64_t *next_cycle)
 			case MQTT_SN_TOPIC_STATE_SUBSCRIBED:
 				if (!pub->con.retries--) {
 					LOG_WRN("PUB ran out of retries, disconnecting");
+					mqtt_sn_flush_pubs(client);
 					mqtt_sn_disconnect_internal(client);
 					return -ETIMEDOUT;
 				}
@@ -691,6 +770,8 @@ static int process_pubs(struct mqtt_sn_client *client, int64_t *next_cycle)
 		}
 	}
 
+	mqtt_sn_flush_pubs(client);
+
 	LOG_DBG("next_cycle: %lld", *next_cycle);
 
 	return 0;
@@ -1256,7 +1337,21 @@ int mqtt_sn_publish(struct mqtt_sn_client *client, enum mqtt_sn_qos qos,
 
 	sys_slist_append(&client->publish, &pub->next);
 
+#if defined(CONFIG_MQTT_SN_LIB_AGGREGATE_PUBLISH)
+	/* Give bursts of publishes a chance to accumulate so they share one
+	 * datagram, but never delay processing beyond the flush deadline.
+	 */
+	if (!k_work_delayable_is_pending(&client->process_work) ||
+	    k_ticks_to_ms_floor32(k_work_delayable_remaining_get(&client->process_work)) >
+		    CONFIG_MQTT_SN_LIB_AGGREGATE_FLUSH_MS) {
+		err = k_work_reschedule(&client->process_work,
+					K_MSEC(CONFIG_MQTT_SN_LIB_AGGREGATE_FLUSH_MS));
+	} else {
+		err = 0;
+	}
+#else
 	err = k_work_reschedule(&client->process_work, K_NO_WAIT);
+#endif /* CONFIG_MQTT_SN_LIB_AGGREGATE_PUBLISH */
 	if (err < 0) {
 		return err;
 	}
@@ -140,6 +140,9 @@ __net_socket struct tls_context {
 	/** Information whether TLS handshake is currently in progress. */
 	bool handshake_in_progress : 1;
 
+	/** Information whether an asynchronous handshake is pending. */
+	bool async_handshake : 1;
+
 	/** Session ended at the TLS/DTLS level. */
 	bool session_closed : 1;
 
@@ -223,6 +226,25 @@ __net_socket struct tls_context {
 	socklen_t dtls_peer_addrlen;
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
+#if defined(CONFIG_NET_SOCKETS_TLS_ASYNC_HANDSHAKE)
+	/** Triggered work item advancing an asynchronous handshake. */
+	struct k_work_poll hs_work;
+
+	/** Poll event monitoring the underlying socket for hs_work. */
+	struct k_poll_event hs_event;
+
+	/** Deadline for an asynchronous handshake. */
+	k_timepoint_t hs_end;
+
+	/** Peer address, kept to update the session cache on handshake
+	 *  completion.
+	 */
+	struct sockaddr hs_peer_addr;
+
+	/** Peer address length. */
+	socklen_t hs_peer_addrlen;
+#endif /* CONFIG_NET_SOCKETS_TLS_ASYNC_HANDSHAKE */
+
 #if defined(CONFIG_MBEDTLS)
 	/** mbedTLS context. */
 	mbedtls_ssl_context ssl;
@@ -257,6 +279,13 @@ static mbedtls_ssl_cache_context server_cache;
 /* A mutex for protecting TLS context allocation. */
 static struct k_mutex context_lock;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_ASYNC_HANDSHAKE)
+/* A work queue advancing asynchronous TLS handshakes. */
+static struct k_work_q tls_handshake_work_q;
+static K_KERNEL_STACK_DEFINE(tls_handshake_stack,
+			     CONFIG_NET_SOCKETS_TLS_ASYNC_HANDSHAKE_STACK_SIZE);
+#endif
+
 /* Arbitrary delay value to wait if mbedTLS reports it cannot proceed for
  * reasons other than TX/RX block.
  */
@@ -373,6 +402,13 @@ static int tls_init(void)
 	mbedtls_ssl_cache_init(&server_cache);
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_TLS_ASYNC_HANDSHAKE)
+	k_work_queue_start(&tls_handshake_work_q, tls_handshake_stack,
+			   K_KERNEL_STACK_SIZEOF(tls_handshake_stack),
+			   CONFIG_NET_SOCKETS_TLS_ASYNC_HANDSHAKE_PRIO, NULL);
+	k_thread_name_set(&tls_handshake_work_q.thread, "tls_handshake");
+#endif
+
 	return 0;
 }
 
@@ -1285,6 +1321,143 @@ static int tls_mbedtls_handshake(struct tls_context *context,
 	return ret;
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_ASYNC_HANDSHAKE)
+/* Register the underlying socket for polling and submit the handshake work.
+ * The work is also woken periodically (TLS_WAIT_MS) to cover the cases where
+ * mbed TLS waits for TX rather than RX.
+ */
+static int tls_async_handshake_submit(struct tls_context *context)
+{
+	struct zsock_pollfd pfd = {
+		.fd = context->sock,
+		.events = ZSOCK_POLLIN,
+	};
+	struct k_poll_event *pev = &context->hs_event;
+	k_timeout_t timeout = K_MSEC(TLS_WAIT_MS);
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+	int ret;
+
+	obj = zvfs_get_fd_obj_and_vtable(
+		context->sock, (const struct fd_op_vtable **)&vtable, &lock);
+	if (obj == NULL) {
+		return -EBADF;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = zvfs_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_POLL_PREPARE,
+				      &pfd, &pev, pev + 1);
+	k_mutex_unlock(lock);
+
+	if (ret == -EALREADY) {
+		/* Underlying socket at EOF or in error state - run the work
+		 * immediately so that the handshake can report the failure.
+		 */
+		timeout = K_NO_WAIT;
+	} else if (ret != 0) {
+		return ret;
+	}
+
+	return k_work_poll_submit_to_queue(&tls_handshake_work_q,
+					   &context->hs_work,
+					   &context->hs_event, 1, timeout);
+}
+
+static void tls_handshake_work_handler(struct k_work *work)
+{
+	struct k_work_poll *hs_work =
+		CONTAINER_OF(work, struct k_work_poll, work);
+	struct tls_context *context =
+		CONTAINER_OF(hs_work, struct tls_context, hs_work);
+	int ret;
+
+	(void)k_mutex_lock(context->lock, K_FOREVER);
+
+	if (!context->async_handshake) {
+		/* Socket was closed while the work was pending. */
+		goto out;
+	}
+
+	ret = tls_mbedtls_handshake(context, K_NO_WAIT);
+	if (ret == -EAGAIN) {
+		if (!sys_timepoint_expired(context->hs_end) &&
+		    tls_async_handshake_submit(context) == 0) {
+			goto out;
+		}
+
+		NET_ERR("TLS handshake timeout");
+		(void)tls_mbedtls_reset(context);
+		context->error = ETIMEDOUT;
+	} else if (ret == 0) {
+		context->error = 0;
+		tls_session_store(context, &context->hs_peer_addr,
+				  context->hs_peer_addrlen);
+	}
+
+	/* On other errors tls_mbedtls_handshake() already set the error
+	 * code on the context; send()/recv() will report it.
+	 */
+
+	context->async_handshake = false;
+out:
+	k_mutex_unlock(context->lock);
+}
+
+/* Start an asynchronous handshake on a connected socket.
+ *
+ * @retval -EINPROGRESS Handshake started, it will be continued on the TLS
+ *                      handshake work queue.
+ * @retval -ENOTSUP The underlying socket cannot be monitored for events,
+ *                  the caller should fall back to a blocking handshake.
+ * @retval 0 Handshake completed right away (e. g. session resumption).
+ * @retval <0 other Handshake error.
+ */
+static int tls_async_handshake_start(struct tls_context *context,
+				     const struct sockaddr *addr,
+				     socklen_t addrlen)
+{
+	int ret;
+
+	ret = tls_mbedtls_handshake(context, K_NO_WAIT);
+	if (ret != -EAGAIN) {
+		return ret;
+	}
+
+	memcpy(&context->hs_peer_addr, addr,
+	       MIN(addrlen, sizeof(context->hs_peer_addr)));
+	context->hs_peer_addrlen = addrlen;
+	context->hs_end = sys_timepoint_calc(
+		K_MSEC(CONFIG_NET_SOCKETS_CONNECT_TIMEOUT));
+	context->async_handshake = true;
+
+	k_work_poll_init(&context->hs_work, tls_handshake_work_handler);
+
+	ret = tls_async_handshake_submit(context);
+	if (ret < 0) {
+		NET_DBG("Cannot submit async handshake (%d), falling back",
+			ret);
+		context->async_handshake = false;
+		return -ENOTSUP;
+	}
+
+	return -EINPROGRESS;
+}
+
+static void tls_async_handshake_abort(struct tls_context *context)
+{
+	if (!context->async_handshake) {
+		return;
+	}
+
+	/* If the work is already running it bails out once it observes the
+	 * cleared flag.
+	 */
+	(void)k_work_poll_cancel(&context->hs_work);
+	context->async_handshake = false;
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_ASYNC_HANDSHAKE */
+
 static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 {
 	int role, type, ret;
@@ -2112,6 +2285,10 @@ int ztls_close_ctx(struct tls_context *ctx, int sock)
 {
 	int ret, err = 0;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_ASYNC_HANDSHAKE)
+	tls_async_handshake_abort(ctx);
+#endif
+
 	/* Try to send close notification. */
 	ctx->flags = 0;
 
@@ -2184,6 +2361,25 @@ int ztls_connect_ctx(struct tls_context *ctx, const struct sockaddr *addr,
 
 		tls_session_restore(ctx, addr, addrlen);
 
+#if defined(CONFIG_NET_SOCKETS_TLS_ASYNC_HANDSHAKE)
+		if (is_non_block && ctx->type == SOCK_STREAM) {
+			ret = tls_async_handshake_start(ctx, addr, addrlen);
+			if (ret != -ENOTSUP) {
+				if (ret < 0) {
+					/* Pending handshake reports
+					 * -EINPROGRESS here.
+					 */
+					goto error;
+				}
+
+				tls_session_store(ctx, addr, addrlen);
+				return 0;
+			}
+
+			/* Fall back to a blocking handshake. */
+		}
+#endif /* CONFIG_NET_SOCKETS_TLS_ASYNC_HANDSHAKE */
+
 		/* TODO For simplicity, TLS handshake blocks the socket
 		 * even for non-blocking socket.
 		 */
@@ -3020,6 +3216,22 @@ static int ztls_poll_prepare_ctx(struct tls_context *ctx,
 		pfd->events &= ~ZSOCK_POLLIN;
 	}
 
+#if defined(CONFIG_NET_SOCKETS_TLS_ASYNC_HANDSHAKE)
+	/* While an asynchronous handshake is pending, wait for its
+	 * completion instead of polling the underlying socket for
+	 * writability.
+	 */
+	if ((pfd->events & ZSOCK_POLLOUT) && ctx->async_handshake) {
+		(*pev)->obj = &ctx->tls_established;
+		(*pev)->type = K_POLL_TYPE_SEM_AVAILABLE;
+		(*pev)->mode = K_POLL_MODE_NOTIFY_ONLY;
+		(*pev)->state = K_POLL_STATE_NOT_READY;
+		(*pev)++;
+
+		pfd->events &= ~ZSOCK_POLLOUT;
+	}
+#endif /* CONFIG_NET_SOCKETS_TLS_ASYNC_HANDSHAKE */
+
 	obj = zvfs_get_fd_obj_and_vtable(
 		ctx->sock, (const struct fd_op_vtable **)&vtable, &lock);
 	if (obj == NULL) {
@@ -3252,6 +3464,24 @@ static int ztls_poll_update_ctx(struct tls_context *ctx,
 		pfd->events &= ~ZSOCK_POLLIN;
 	}
 
+#if defined(CONFIG_NET_SOCKETS_TLS_ASYNC_HANDSHAKE)
+	if ((pfd->events & ZSOCK_POLLOUT) &&
+	    ((*pev)->obj == &ctx->tls_established)) {
+		if ((*pev)->state != K_POLL_STATE_NOT_READY) {
+			/* Asynchronous handshake completed. */
+			pfd->revents |= ZSOCK_POLLOUT;
+		} else if (!ctx->async_handshake) {
+			/* Handshake finished without establishing a session -
+			 * report the error condition.
+			 */
+			pfd->revents |= ZSOCK_POLLERR;
+		}
+
+		(*pev)++;
+		pfd->events &= ~ZSOCK_POLLOUT;
+	}
+#endif /* CONFIG_NET_SOCKETS_TLS_ASYNC_HANDSHAKE */
+
 	ret = zvfs_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_POLL_UPDATE,
 				   pfd, pev);
 	if (ret != 0) {
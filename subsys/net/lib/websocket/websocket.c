@@ -53,6 +53,10 @@ static struct k_sem contexts_lock;
 
 static const struct socket_op_vtable websocket_fd_op_vtable;
 
+#if defined(CONFIG_WEBSOCKET_TX_AGGREGATION) && !defined(CONFIG_NET_TEST)
+static void websocket_tx_flush_work(struct k_work *work);
+#endif /* CONFIG_WEBSOCKET_TX_AGGREGATION && !CONFIG_NET_TEST */
+
 #if defined(CONFIG_NET_TEST)
 int verify_sent_and_received_msg(struct msghdr *msg, bool split_msg);
 #endif
@@ -119,6 +123,14 @@ static struct websocket_context *websocket_get(void)
 		break;
 	}
 
+#if defined(CONFIG_WEBSOCKET_TX_AGGREGATION) && !defined(CONFIG_NET_TEST)
+	if (ctx != NULL) {
+		ctx->tx_buf_len = 0;
+		k_work_init_delayable(&ctx->tx_flush_work,
+				      websocket_tx_flush_work);
+	}
+#endif /* CONFIG_WEBSOCKET_TX_AGGREGATION && !CONFIG_NET_TEST */
+
 	k_sem_give(&contexts_lock);
 
 	return ctx;
@@ -421,6 +433,15 @@ static int websocket_interal_disconnect(struct websocket_context *ctx)
 
 	NET_DBG("[%p] Disconnecting", ctx);
 
+#if defined(CONFIG_WEBSOCKET_TX_AGGREGATION) && !defined(CONFIG_NET_TEST)
+	struct k_work_sync sync;
+
+	/* The CLOSE frame below flushes any still aggregated data before
+	 * it is sent, the pending flush is not needed anymore.
+	 */
+	(void)k_work_cancel_delayable_sync(&ctx->tx_flush_work, &sync);
+#endif /* CONFIG_WEBSOCKET_TX_AGGREGATION && !CONFIG_NET_TEST */
+
 	ret = websocket_send_msg(ctx->sock, NULL, 0, WEBSOCKET_OPCODE_CLOSE,
 				 ctx->is_client, true, SYS_FOREVER_MS);
 	if (ret < 0) {
@@ -600,6 +621,75 @@ static int sendmsg_all(int sock, const struct msghdr *message, int flags,
 
 	return total_len;
 }
+
+#if defined(CONFIG_WEBSOCKET_TX_AGGREGATION)
+static int websocket_tx_flush(struct websocket_context *ctx, int flags,
+			      k_timepoint_t req_end_timepoint)
+{
+	struct iovec io_vector[1];
+	struct msghdr msg;
+	int ret;
+
+	if (ctx->tx_buf_len == 0) {
+		return 0;
+	}
+
+	io_vector[0].iov_base = ctx->tx_buf;
+	io_vector[0].iov_len = ctx->tx_buf_len;
+
+	memset(&msg, 0, sizeof(msg));
+
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = ARRAY_SIZE(io_vector);
+
+	ret = sendmsg_all(ctx->real_sock, &msg, flags, req_end_timepoint);
+	ctx->tx_buf_len = 0;
+
+	return ret;
+}
+
+static void websocket_tx_flush_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct websocket_context *ctx =
+		CONTAINER_OF(dwork, struct websocket_context, tx_flush_work);
+	int ret;
+
+	k_mutex_lock(&ctx->lock, K_FOREVER);
+
+	if (ctx->tx_buf_len == 0) {
+		k_mutex_unlock(&ctx->lock);
+		return;
+	}
+
+	/* A stalled peer must not tie up the system work queue with
+	 * ctx->lock held, so send without blocking and keep whatever the
+	 * socket does not accept for another attempt after the
+	 * aggregation timeout.
+	 */
+	ret = zsock_send(ctx->real_sock, ctx->tx_buf, ctx->tx_buf_len,
+			 ZSOCK_MSG_DONTWAIT);
+	if (ret > 0) {
+		if ((size_t)ret < ctx->tx_buf_len) {
+			memmove(ctx->tx_buf, &ctx->tx_buf[ret],
+				ctx->tx_buf_len - (size_t)ret);
+		}
+
+		ctx->tx_buf_len -= (size_t)ret;
+	} else if (ret < 0 && errno != EAGAIN) {
+		NET_DBG("[%p] Cannot flush aggregated data (%d)", ctx, -errno);
+		ctx->tx_buf_len = 0;
+	}
+
+	if (ctx->tx_buf_len > 0) {
+		(void)k_work_reschedule(
+			&ctx->tx_flush_work,
+			K_MSEC(CONFIG_WEBSOCKET_TX_AGGREGATION_TIMEOUT_MS));
+	}
+
+	k_mutex_unlock(&ctx->lock);
+}
+#endif /* CONFIG_WEBSOCKET_TX_AGGREGATION */
 #endif /* !defined(CONFIG_NET_TEST) */
 
 static int websocket_prepare_and_send(struct websocket_context *ctx,
@@ -643,13 +733,116 @@ static int websocket_prepare_and_send(struct websocket_context *ctx,
 
 	k_timeout_t req_timeout = K_MSEC(timeout);
 	k_timepoint_t req_end_timepoint = sys_timepoint_calc(req_timeout);
+	int flags = K_TIMEOUT_EQ(tout, K_NO_WAIT) ? ZSOCK_MSG_DONTWAIT : 0;
+
+#if defined(CONFIG_WEBSOCKET_TX_AGGREGATION)
+	uint8_t opcode = header[0] & 0x0F;
+	bool data_frame = (opcode == WEBSOCKET_OPCODE_CONTINUE ||
+			   opcode == WEBSOCKET_OPCODE_DATA_TEXT ||
+			   opcode == WEBSOCKET_OPCODE_DATA_BINARY);
+	int ret;
 
-	return sendmsg_all(ctx->real_sock, &msg,
-			   K_TIMEOUT_EQ(tout, K_NO_WAIT) ? ZSOCK_MSG_DONTWAIT : 0,
-			   req_end_timepoint);
+	k_mutex_lock(&ctx->lock, K_FOREVER);
+
+	if (data_frame && header_len + payload_len <= sizeof(ctx->tx_buf)) {
+		if (header_len + payload_len >
+		    sizeof(ctx->tx_buf) - ctx->tx_buf_len) {
+			ret = websocket_tx_flush(ctx, flags, req_end_timepoint);
+			if (ret < 0) {
+				k_mutex_unlock(&ctx->lock);
+				return ret;
+			}
+		}
+
+		memcpy(&ctx->tx_buf[ctx->tx_buf_len], header, header_len);
+		ctx->tx_buf_len += header_len;
+
+		if (payload != NULL && payload_len > 0) {
+			memcpy(&ctx->tx_buf[ctx->tx_buf_len], payload,
+			       payload_len);
+			ctx->tx_buf_len += payload_len;
+		}
+
+		/* Count the flush deadline from the first message placed
+		 * in an empty buffer; scheduling is a no-op if the flush
+		 * is already pending.
+		 */
+		(void)k_work_schedule(
+			&ctx->tx_flush_work,
+			K_MSEC(CONFIG_WEBSOCKET_TX_AGGREGATION_TIMEOUT_MS));
+
+		k_mutex_unlock(&ctx->lock);
+
+		return header_len + payload_len;
+	}
+
+	/* Control frames and messages larger than the aggregation buffer
+	 * are sent directly. Flush pending data first to keep the frame
+	 * order on the wire.
+	 */
+	ret = websocket_tx_flush(ctx, flags, req_end_timepoint);
+	if (ret < 0) {
+		k_mutex_unlock(&ctx->lock);
+		return ret;
+	}
+
+	ret = sendmsg_all(ctx->real_sock, &msg, flags, req_end_timepoint);
+
+	k_mutex_unlock(&ctx->lock);
+
+	return ret;
+#else
+	return sendmsg_all(ctx->real_sock, &msg, flags, req_end_timepoint);
+#endif /* CONFIG_WEBSOCKET_TX_AGGREGATION */
 #endif /* CONFIG_NET_TEST */
 }
 
+/* Apply the masking value to the payload (RFC 6455 ch 5.3), starting at
+ * the given offset within the message. The masking key is rotated to
+ * match the offset and the buffer alignment, so the bulk of the payload
+ * is XORed a word at a time and only the unaligned head and tail bytes
+ * are handled individually.
+ */
+static void websocket_mask_payload(uint8_t *payload, size_t payload_len,
+				   uint32_t masking_value, size_t offset)
+{
+	uint8_t mask[sizeof(uint32_t)];
+	uint32_t mask_word;
+	size_t i = 0;
+
+	/* Head, until the buffer position is word aligned. */
+	while (i < payload_len &&
+	       ((uintptr_t)&payload[i] % sizeof(uint32_t)) != 0) {
+		payload[i++] ^= (uint8_t)(masking_value >> (8 * (3 - offset % 4)));
+		offset++;
+	}
+
+	if (payload_len - i >= sizeof(uint32_t)) {
+		/* Masking key rotated to the current offset, in memory
+		 * byte order, so that it applies to whole words as is.
+		 */
+		for (size_t j = 0; j < sizeof(mask); j++) {
+			mask[j] = (uint8_t)(masking_value >>
+					    (8 * (3 - (offset + j) % 4)));
+		}
+
+		memcpy(&mask_word, mask, sizeof(mask_word));
+
+		for (; payload_len - i >= sizeof(uint32_t); i += sizeof(uint32_t)) {
+			*(uint32_t *)&payload[i] ^= mask_word;
+		}
+
+		/* The word loop keeps offset % 4 unchanged, so the tail
+		 * below can continue with the unadjusted offset.
+		 */
+	}
+
+	/* Tail */
+	for (; i < payload_len; i++, offset++) {
+		payload[i] ^= (uint8_t)(masking_value >> (8 * (3 - offset % 4)));
+	}
+}
+
 int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		       enum websocket_opcode opcode, bool mask, bool final,
 		       int32_t timeout)
@@ -719,8 +912,6 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 	/* Add masking value if needed */
 	if (mask) {
-		int i;
-
 		ctx->masking_value = sys_rand32_get();
 
 		header[hdr_len++] |= ctx->masking_value >> 24;
@@ -736,9 +927,8 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 			memcpy(data_to_send, payload, payload_len);
 
-			for (i = 0; i < payload_len; i++) {
-				data_to_send[i] ^= ctx->masking_value >> (8 * (3 - i % 4));
-			}
+			websocket_mask_payload(data_to_send, payload_len,
+					       ctx->masking_value, 0);
 		}
 	}
 
@@ -1051,15 +1241,10 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 
 	/* Unmask the data */
 	if (ctx->masked) {
-		uint8_t *mask_as_bytes = (uint8_t *)&ctx->masking_value;
 		size_t data_buf_offset = ctx->message_len - ctx->parser_remaining - payload.count;
 
-		for (size_t i = 0; i < payload.count; i++) {
-			size_t m = data_buf_offset % 4;
-
-			payload.buf[i] ^= mask_as_bytes[3 - m];
-			data_buf_offset++;
-		}
+		websocket_mask_payload(payload.buf, payload.count,
+				       ctx->masking_value, data_buf_offset);
 	}
 
 	return payload.count;
@@ -1299,4 +1484,8 @@ void websocket_context_foreach(websocket_context_cb_t cb, void *user_data)
 void websocket_init(void)
 {
 	k_sem_init(&contexts_lock, 1, K_SEM_MAX_LIMIT);
+
+	ARRAY_FOR_EACH(contexts, i) {
+		k_mutex_init(&contexts[i].lock);
+	}
 }
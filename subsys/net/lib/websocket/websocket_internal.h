@@ -108,6 +108,17 @@ __net_socket struct websocket_context {
 	/** Parser state */
 	enum websocket_parser_state parser_state;
 
+#if defined(CONFIG_WEBSOCKET_TX_AGGREGATION)
+	/** Buffer for aggregating outgoing frames */
+	uint8_t tx_buf[CONFIG_WEBSOCKET_TX_AGGREGATION_BUFFER_SIZE];
+
+	/** Amount of data pending in the aggregation buffer */
+	size_t tx_buf_len;
+
+	/** Delayed work flushing the aggregation buffer */
+	struct k_work_delayable tx_flush_work;
+#endif /* CONFIG_WEBSOCKET_TX_AGGREGATION */
+
 	/** Is the message masked */
 	uint8_t masked : 1;
 
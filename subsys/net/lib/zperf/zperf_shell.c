@@ -941,6 +941,25 @@ static bool check_priority(const struct shell *sh, int priority)
 
 	return true;
 }
+
+static bool check_cpu(const struct shell *sh, int cpu)
+{
+	if (!IS_ENABLED(CONFIG_SCHED_CPU_MASK)) {
+		shell_fprintf(sh, SHELL_WARNING,
+			      "CONFIG_SCHED_CPU_MASK must be enabled to pin "
+			      "a session to a CPU\n");
+		return false;
+	}
+
+	if (cpu < 0 || cpu >= arch_num_cpus()) {
+		shell_fprintf(sh, SHELL_WARNING,
+			      "Invalid CPU: %d\nValid values are [0, %d]\n",
+			      cpu, arch_num_cpus() - 1);
+		return false;
+	}
+
+	return true;
+}
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 
 static int shell_cmd_upload(const struct shell *sh, size_t argc,
@@ -958,6 +977,9 @@ static int shell_cmd_upload(const struct shell *sh, size_t argc,
 	int seconds;
 
 	param.unix_offset_us = k_uptime_get() * USEC_PER_MSEC;
+#ifdef CONFIG_ZPERF_SESSION_PER_THREAD
+	param.options.thread_cpu = -1;
+#endif
 	param.options.priority = -1;
 	is_udp = proto == IPPROTO_UDP;
 
@@ -1013,6 +1035,17 @@ static int shell_cmd_upload(const struct shell *sh, size_t argc,
 			param.options.wait_for_start = true;
 			opt_cnt += 1;
 			break;
+
+		case 'c':
+			param.options.thread_cpu = parse_arg(&i, argc, argv);
+			if (!check_cpu(sh, param.options.thread_cpu)) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+			opt_cnt += 2;
+			async = true;
+			break;
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
@@ -1212,6 +1245,9 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 	int seconds;
 
 	param.unix_offset_us = k_uptime_get() * USEC_PER_MSEC;
+#ifdef CONFIG_ZPERF_SESSION_PER_THREAD
+	param.options.thread_cpu = -1;
+#endif
 	is_udp = proto == IPPROTO_UDP;
 
 	/* Parse options */
@@ -1266,6 +1302,17 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 			param.options.wait_for_start = true;
 			opt_cnt += 1;
 			break;
+
+		case 'c':
+			param.options.thread_cpu = parse_arg(&i, argc, argv);
+			if (!check_cpu(sh, param.options.thread_cpu)) {
+				shell_fprintf(sh, SHELL_WARNING,
+					      "Parse error: %s\n", argv[i]);
+				return -ENOEXEC;
+			}
+			opt_cnt += 2;
+			async = true;
+			break;
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
@@ -1898,6 +1945,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		  "-t: Specify custom thread priority\n"
 		  "-w: Wait for start signal before starting the tests\n"
+		  "-c: Pin the session thread to the given CPU "
+		  "(needs CONFIG_SCHED_CPU_MASK)\n"
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
@@ -1922,6 +1971,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		  "-t: Specify custom thread priority\n"
 		  "-w: Wait for start signal before starting the tests\n"
+		  "-c: Pin the session thread to the given CPU "
+		  "(needs CONFIG_SCHED_CPU_MASK)\n"
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
@@ -1975,6 +2026,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		  "-t: Specify custom thread priority\n"
 		  "-w: Wait for start signal before starting the tests\n"
+		  "-c: Pin the session thread to the given CPU "
+		  "(needs CONFIG_SCHED_CPU_MASK)\n"
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
@@ -2000,6 +2053,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 #ifdef CONFIG_ZPERF_SESSION_PER_THREAD
 		  "-t: Specify custom thread priority\n"
 		  "-w: Wait for start signal before starting the tests\n"
+		  "-c: Pin the session thread to the given CPU "
+		  "(needs CONFIG_SCHED_CPU_MASK)\n"
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
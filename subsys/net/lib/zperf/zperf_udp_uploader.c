@@ -437,6 +437,14 @@ int zperf_udp_upload_async(const struct zperf_upload_params *param,
 	tid = k_work_queue_thread_get(queue);
 	k_thread_priority_set(tid, ses->async_upload_ctx.param.options.thread_priority);
 
+#ifdef CONFIG_SCHED_CPU_MASK
+	if (ses->async_upload_ctx.param.options.thread_cpu >= 0 &&
+	    k_thread_cpu_pin(tid, ses->async_upload_ctx.param.options.thread_cpu) != 0) {
+		NET_WARN("[%d] cannot pin session thread to CPU %d", ses->id,
+			 ses->async_upload_ctx.param.options.thread_cpu);
+	}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
 	k_work_init(&ses->async_upload_ctx.work, udp_upload_async_work);
 
 	ses->start_time = k_uptime_ticks();
@@ -32,6 +32,13 @@ struct npf_rule_list npf_local_in_recv_rules = {
 };
 #endif /* CONFIG_NET_PKT_FILTER_LOCAL_IN_HOOK */
 
+#ifdef CONFIG_NET_PKT_FILTER_CAPTURE_HOOK
+struct npf_rule_list npf_capture_rules = {
+	.rule_head = SYS_SLIST_STATIC_INIT(&capture_rules.rule_head),
+	.lock = { },
+};
+#endif /* CONFIG_NET_PKT_FILTER_CAPTURE_HOOK */
+
 #ifdef CONFIG_NET_PKT_FILTER_IPV4_HOOK
 struct npf_rule_list npf_ipv4_recv_rules = {
 	.rule_head = SYS_SLIST_STATIC_INIT(&ipv4_recv_rules.rule_head),
@@ -154,6 +161,15 @@ bool net_pkt_filter_local_in_recv_ok(struct net_pkt *pkt)
 }
 #endif /* CONFIG_NET_PKT_FILTER_LOCAL_IN_HOOK */
 
+#ifdef CONFIG_NET_PKT_FILTER_CAPTURE_HOOK
+bool net_pkt_filter_capture_ok(struct net_pkt *pkt)
+{
+	enum net_verdict result = lock_evaluate(&npf_capture_rules, pkt);
+
+	return result == NET_OK;
+}
+#endif /* CONFIG_NET_PKT_FILTER_CAPTURE_HOOK */
+
 #if defined(CONFIG_NET_PKT_FILTER_IPV4_HOOK) || defined(CONFIG_NET_PKT_FILTER_IPV6_HOOK)
 bool net_pkt_filter_ip_recv_ok(struct net_pkt *pkt)
 {
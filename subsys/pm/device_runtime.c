@@ -274,6 +274,49 @@ end:
 	return ret;
 }
 
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC_GET
+static void runtime_get_work(struct k_work *work)
+{
+	struct pm_device *pm = CONTAINER_OF(work, struct pm_device, get_work);
+	int ret = pm_device_runtime_get(pm->dev);
+
+	pm->get_cb(pm->dev, ret, pm->get_cb_arg);
+}
+
+int pm_device_runtime_get_async(const struct device *dev,
+				void (*cb)(const struct device *dev,
+					   int status, void *user_data),
+				void *user_data)
+{
+	struct pm_device *pm = dev->pm;
+
+	if (cb == NULL) {
+		return -EINVAL;
+	}
+
+	/*
+	 * If the device has no PM support, runtime PM is not enabled, or we
+	 * cannot defer to the work queue yet, resolve the request in place.
+	 * pm_device_runtime_get() does not block in any of these cases.
+	 */
+	if ((pm == NULL) ||
+	    !atomic_test_bit(&pm->base.flags, PM_DEVICE_FLAG_RUNTIME_ENABLED) ||
+	    k_is_pre_kernel()) {
+		cb(dev, pm_device_runtime_get(dev), user_data);
+		return 0;
+	}
+
+	if (k_work_busy_get(&pm->get_work) != 0) {
+		return -EBUSY;
+	}
+
+	pm->get_cb = cb;
+	pm->get_cb_arg = user_data;
+	(void)k_work_submit(&pm->get_work);
+
+	return 0;
+}
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC_GET */
 
 static int put_sync_locked(const struct device *dev)
 {
@@ -330,6 +373,14 @@ int pm_device_runtime_put(const struct device *dev)
 		ret = put_sync_locked(dev);
 
 		k_spin_unlock(&pm_sync->lock, k);
+	} else if (!K_TIMEOUT_EQ(dev->pm->autosuspend_delay, K_NO_WAIT) &&
+		   !k_is_pre_kernel()) {
+		/*
+		 * With an autosuspend delay configured, defer the suspend so
+		 * that a get call arriving within the delay window simply
+		 * cancels it. The domain is put from the suspend work item.
+		 */
+		ret = runtime_suspend(dev, true, dev->pm->autosuspend_delay);
 	} else {
 		ret = runtime_suspend(dev, false, K_NO_WAIT);
 
@@ -370,6 +421,33 @@ int pm_device_runtime_put_async(const struct device *dev, k_timeout_t delay)
 	return ret;
 }
 
+int pm_device_runtime_autosuspend_delay_set(const struct device *dev,
+					    k_timeout_t delay)
+{
+	struct pm_device *pm = dev->pm;
+
+	if (pm == NULL) {
+		return -ENOTSUP;
+	}
+
+	/* ISR safe devices suspend from the put call itself, no deferral */
+	if (atomic_test_bit(&pm->base.flags, PM_DEVICE_FLAG_ISR_SAFE)) {
+		return -ENOTSUP;
+	}
+
+	if (!k_is_pre_kernel()) {
+		(void)k_sem_take(&pm->lock, K_FOREVER);
+	}
+
+	pm->autosuspend_delay = delay;
+
+	if (!k_is_pre_kernel()) {
+		k_sem_give(&pm->lock);
+	}
+
+	return 0;
+}
+
 __boot_func
 int pm_device_runtime_auto_enable(const struct device *dev)
 {
@@ -440,6 +518,9 @@ int pm_device_runtime_enable(const struct device *dev)
 	if (pm->dev == NULL) {
 		pm->dev = dev;
 		k_work_init_delayable(&pm->work, runtime_suspend_work);
+#ifdef CONFIG_PM_DEVICE_RUNTIME_ASYNC_GET
+		k_work_init(&pm->get_work, runtime_get_work);
+#endif /* CONFIG_PM_DEVICE_RUNTIME_ASYNC_GET */
 	}
 
 	if (pm->base.state == PM_DEVICE_STATE_ACTIVE) {
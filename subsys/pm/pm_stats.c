@@ -16,14 +16,40 @@ STATS_SECT_START(pm_stats)
 STATS_SECT_ENTRY32(state_count)
 STATS_SECT_ENTRY32(state_last_cycles)
 STATS_SECT_ENTRY32(state_total_cycles)
+#ifdef CONFIG_PM_STATS_RESIDENCY_HIST
+STATS_SECT_ENTRY32(residency_hist_0)
+STATS_SECT_ENTRY32(residency_hist_1)
+STATS_SECT_ENTRY32(residency_hist_2)
+STATS_SECT_ENTRY32(residency_hist_3)
+STATS_SECT_ENTRY32(residency_hist_4)
+STATS_SECT_ENTRY32(residency_hist_5)
+STATS_SECT_ENTRY32(residency_hist_6)
+STATS_SECT_ENTRY32(residency_hist_7)
+#endif /* CONFIG_PM_STATS_RESIDENCY_HIST */
 STATS_SECT_END;
 
 STATS_NAME_START(pm_stats)
 STATS_NAME(pm_stats, state_count)
 STATS_NAME(pm_stats, state_last_cycles)
 STATS_NAME(pm_stats, state_total_cycles)
+#ifdef CONFIG_PM_STATS_RESIDENCY_HIST
+STATS_NAME(pm_stats, residency_hist_0)
+STATS_NAME(pm_stats, residency_hist_1)
+STATS_NAME(pm_stats, residency_hist_2)
+STATS_NAME(pm_stats, residency_hist_3)
+STATS_NAME(pm_stats, residency_hist_4)
+STATS_NAME(pm_stats, residency_hist_5)
+STATS_NAME(pm_stats, residency_hist_6)
+STATS_NAME(pm_stats, residency_hist_7)
+#endif /* CONFIG_PM_STATS_RESIDENCY_HIST */
 STATS_NAME_END(pm_stats);
 
+#ifdef CONFIG_PM_STATS_RESIDENCY_HIST
+#define PM_STATS_NUM_ENTRIES 11U
+#else
+#define PM_STATS_NUM_ENTRIES 3U
+#endif
+
 static STATS_SECT_DECL(pm_stats) stats[CONFIG_MP_MAX_NUM_CPUS][PM_STATE_COUNT];
 
 #define PM_STAT_NAME_LEN sizeof("pm_cpu_XXX_state_X_stats")
@@ -40,7 +66,8 @@ static int pm_stats_init(void)
 		for (uint8_t j = 0U; j < PM_STATE_COUNT; j++) {
 			snprintk(names[i][j], PM_STAT_NAME_LEN,
 				 "pm_cpu_%03d_state_%1d_stats", i, j);
-			stats_init(&(stats[i][j].s_hdr), STATS_SIZE_32, 3U,
+			stats_init(&(stats[i][j].s_hdr), STATS_SIZE_32,
+				   PM_STATS_NUM_ENTRIES,
 				   STATS_NAME_INIT_PARMS(pm_stats));
 			stats_register(names[i][j], &(stats[i][j].s_hdr));
 		}
@@ -61,6 +88,45 @@ void pm_stats_stop(void)
 	time_stop[CPU_ID] = k_cycle_get_32();
 }
 
+#ifdef CONFIG_PM_STATS_RESIDENCY_HIST
+/* Bucket n counts residencies in the [2^(4n), 2^(4(n+1))) cycles range,
+ * the last bucket is unbounded.
+ */
+static void pm_stats_residency_hist_update(uint8_t cpu, enum pm_state state,
+					   uint32_t cycles)
+{
+	uint8_t bucket = (cycles == 0U) ? 0U :
+			 MIN(7U, (find_msb_set(cycles) - 1U) / 4U);
+
+	switch (bucket) {
+	case 0:
+		STATS_INC(stats[cpu][state], residency_hist_0);
+		break;
+	case 1:
+		STATS_INC(stats[cpu][state], residency_hist_1);
+		break;
+	case 2:
+		STATS_INC(stats[cpu][state], residency_hist_2);
+		break;
+	case 3:
+		STATS_INC(stats[cpu][state], residency_hist_3);
+		break;
+	case 4:
+		STATS_INC(stats[cpu][state], residency_hist_4);
+		break;
+	case 5:
+		STATS_INC(stats[cpu][state], residency_hist_5);
+		break;
+	case 6:
+		STATS_INC(stats[cpu][state], residency_hist_6);
+		break;
+	default:
+		STATS_INC(stats[cpu][state], residency_hist_7);
+		break;
+	}
+}
+#endif /* CONFIG_PM_STATS_RESIDENCY_HIST */
+
 void pm_stats_update(enum pm_state state)
 {
 	uint8_t cpu = CPU_ID;
@@ -69,4 +135,7 @@ void pm_stats_update(enum pm_state state)
 	STATS_INC(stats[cpu][state], state_count);
 	STATS_INCN(stats[cpu][state], state_total_cycles, time_total);
 	STATS_SET(stats[cpu][state], state_last_cycles, time_total);
+#ifdef CONFIG_PM_STATS_RESIDENCY_HIST
+	pm_stats_residency_hist_update(cpu, state, time_total);
+#endif
 }
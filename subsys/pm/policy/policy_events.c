@@ -20,13 +20,31 @@ static sys_slist_t events_list;
 /** Pointer to Next Event. */
 struct pm_policy_event *next_event;
 
+#ifdef CONFIG_PM_POLICY_EVENT_WAKEUP
+static void wakeup_timer_expiry(struct k_timer *timer);
+
+/** Timer covering the earliest wake-up event deadline. */
+static K_TIMER_DEFINE(wakeup_timer, wakeup_timer_expiry, NULL);
+/** Deadline the wake-up timer is armed for, -1 when not armed. */
+static int64_t wakeup_armed_ticks = -1;
+#endif
+
 static void update_next_event(void)
 {
 	struct pm_policy_event *evt;
+#ifdef CONFIG_PM_POLICY_EVENT_WAKEUP
+	struct pm_policy_event *wakeup = NULL;
+#endif
 
 	next_event = NULL;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&events_list, evt, node) {
+#ifdef CONFIG_PM_POLICY_EVENT_WAKEUP
+		if ((evt->cb != NULL) &&
+		    ((wakeup == NULL) || (evt->uptime_ticks < wakeup->uptime_ticks))) {
+			wakeup = evt;
+		}
+#endif
 		if (next_event == NULL) {
 			next_event = evt;
 			continue;
@@ -38,7 +56,68 @@ static void update_next_event(void)
 
 		next_event = evt;
 	}
+
+#ifdef CONFIG_PM_POLICY_EVENT_WAKEUP
+	if (wakeup == NULL) {
+		if (wakeup_armed_ticks >= 0) {
+			wakeup_armed_ticks = -1;
+			k_timer_stop(&wakeup_timer);
+		}
+	} else if (wakeup->uptime_ticks != wakeup_armed_ticks) {
+		wakeup_armed_ticks = wakeup->uptime_ticks;
+		k_timer_start(&wakeup_timer, K_TIMEOUT_ABS_TICKS(wakeup->uptime_ticks),
+			      K_NO_WAIT);
+	}
+#endif
+}
+
+#ifdef CONFIG_PM_POLICY_EVENT_WAKEUP
+static void wakeup_timer_expiry(struct k_timer *timer)
+{
+	sys_slist_t expired = SYS_SLIST_STATIC_INIT(&expired);
+	struct pm_policy_event *evt;
+	sys_snode_t *node;
+	int64_t horizon;
+
+	ARG_UNUSED(timer);
+
+	/* Serve every wake-up event falling within the coalescing window
+	 * with this comparator wake-up instead of re-arming for each of
+	 * them individually, at the cost of their callbacks running up to
+	 * the window ahead of the deadline.
+	 */
+	horizon = k_uptime_ticks() +
+		  k_us_to_ticks_ceil64(CONFIG_PM_POLICY_EVENT_WAKEUP_COALESCE_US);
+
+	K_SPINLOCK(&events_lock) {
+		sys_snode_t *prev = NULL;
+		sys_snode_t *next;
+
+		node = sys_slist_peek_head(&events_list);
+		while (node != NULL) {
+			next = sys_slist_peek_next(node);
+			evt = CONTAINER_OF(node, struct pm_policy_event, node);
+
+			if ((evt->cb != NULL) && (evt->uptime_ticks <= horizon)) {
+				sys_slist_remove(&events_list, prev, node);
+				sys_slist_append(&expired, node);
+			} else {
+				prev = node;
+			}
+
+			node = next;
+		}
+
+		wakeup_armed_ticks = -1;
+		update_next_event();
+	}
+
+	while ((node = sys_slist_get(&expired)) != NULL) {
+		evt = CONTAINER_OF(node, struct pm_policy_event, node);
+		evt->cb(evt);
+	}
 }
+#endif /* CONFIG_PM_POLICY_EVENT_WAKEUP */
 
 int64_t pm_policy_next_event_ticks(void)
 {
@@ -63,10 +142,26 @@ void pm_policy_event_register(struct pm_policy_event *evt, int64_t uptime_ticks)
 {
 	K_SPINLOCK(&events_lock) {
 		evt->uptime_ticks = uptime_ticks;
+#ifdef CONFIG_PM_POLICY_EVENT_WAKEUP
+		evt->cb = NULL;
+#endif
+		sys_slist_append(&events_list, &evt->node);
+		update_next_event();
+	}
+}
+
+#ifdef CONFIG_PM_POLICY_EVENT_WAKEUP
+void pm_policy_event_register_wakeup(struct pm_policy_event *evt, int64_t uptime_ticks,
+				     pm_policy_event_cb_t cb)
+{
+	K_SPINLOCK(&events_lock) {
+		evt->uptime_ticks = uptime_ticks;
+		evt->cb = cb;
 		sys_slist_append(&events_list, &evt->node);
 		update_next_event();
 	}
 }
+#endif
 
 void pm_policy_event_update(struct pm_policy_event *evt, int64_t uptime_ticks)
 {
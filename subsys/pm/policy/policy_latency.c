@@ -68,6 +68,14 @@ void pm_policy_latency_request_add(struct pm_policy_latency_request *req,
 void pm_policy_latency_request_update(struct pm_policy_latency_request *req,
 				      uint32_t value_us)
 {
+	/* Subsystems tightening and relaxing their budget on a hot path
+	 * (e.g. per frame) frequently post the value already in effect,
+	 * make that a lock-free no-op.
+	 */
+	if (req->value_us == value_us) {
+		return;
+	}
+
 	k_spinlock_key_t key = k_spin_lock(&latency_lock);
 
 	req->value_us = value_us;
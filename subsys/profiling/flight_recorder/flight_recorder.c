@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/profiling/flight_recorder.h>
+
+#if defined(CONFIG_DEBUG_COREDUMP)
+#include <zephyr/debug/coredump.h>
+#endif
+
+#define FR_RING_SIZE CONFIG_PROFILING_FLIGHT_RECORDER_BUFFER_SIZE
+#define FR_RING_MASK (FR_RING_SIZE - 1)
+
+/* Identifies the rings in a core dump */
+#define FR_RING_MAGIC 0x46523031 /* "FR01" */
+
+BUILD_ASSERT((FR_RING_SIZE & (FR_RING_SIZE - 1)) == 0,
+	     "Flight recorder buffer size must be a power of two");
+
+struct fr_event {
+	uint32_t cycle;
+	uint16_t id;
+	uint16_t _pad;
+	uint32_t arg;
+};
+
+struct fr_ring {
+	uint32_t magic;
+	uint32_t head;
+	struct fr_event evt[FR_RING_SIZE];
+};
+
+static struct fr_ring fr_ring[CONFIG_MP_MAX_NUM_CPUS] = {
+	[0 ... (CONFIG_MP_MAX_NUM_CPUS - 1)] = { .magic = FR_RING_MAGIC },
+};
+
+static bool fr_frozen;
+
+void sys_fr_record(uint16_t id, uint32_t arg)
+{
+	unsigned int key = arch_irq_lock();
+
+	if (!fr_frozen) {
+#if defined(CONFIG_SMP)
+		struct fr_ring *ring = &fr_ring[arch_curr_cpu()->id];
+#else
+		struct fr_ring *ring = &fr_ring[0];
+#endif
+		struct fr_event *evt = &ring->evt[ring->head & FR_RING_MASK];
+
+		evt->cycle = k_cycle_get_32();
+		evt->id = id;
+		evt->arg = arg;
+		ring->head++;
+	}
+
+	arch_irq_unlock(key);
+}
+
+void sys_fr_freeze(void)
+{
+	fr_frozen = true;
+}
+
+void sys_fr_resume(void)
+{
+	fr_frozen = false;
+}
+
+#if defined(CONFIG_DEBUG_COREDUMP)
+void sys_fr_coredump(void)
+{
+	sys_fr_freeze();
+
+	coredump_memory_dump(POINTER_TO_UINT(&fr_ring[0]),
+			     POINTER_TO_UINT(&fr_ring[0]) + sizeof(fr_ring));
+}
+#endif /* CONFIG_DEBUG_COREDUMP */
+
+#if defined(CONFIG_PROFILING_FLIGHT_RECORDER_TRACE_HOOKS)
+/* Non-weak overrides of the user tracing hooks */
+
+void sys_trace_thread_switched_in_user(void)
+{
+	sys_fr_record(SYS_FR_EVT_SWITCH_IN, (uint32_t)(uintptr_t)k_current_get());
+}
+
+void sys_trace_thread_switched_out_user(void)
+{
+	sys_fr_record(SYS_FR_EVT_SWITCH_OUT, (uint32_t)(uintptr_t)k_current_get());
+}
+
+void sys_trace_isr_enter_user(void)
+{
+	sys_fr_record(SYS_FR_EVT_ISR_ENTER, 0);
+}
+
+void sys_trace_isr_exit_user(void)
+{
+	sys_fr_record(SYS_FR_EVT_ISR_EXIT, 0);
+}
+
+void sys_trace_idle_user(void)
+{
+	sys_fr_record(SYS_FR_EVT_IDLE, 0);
+}
+#endif /* CONFIG_PROFILING_FLIGHT_RECORDER_TRACE_HOOKS */
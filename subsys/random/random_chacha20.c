@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Buffered ChaCha20-based random number generator.
+ *
+ * Each CPU keeps a small pool of pregenerated random bytes so that a
+ * typical request is just a copy from the pool, without touching the
+ * hardware entropy driver. When a pool runs dry it is refilled with
+ * ChaCha20 output and the pool key is immediately replaced with further
+ * generator output (fast key erasure), so bytes already handed out
+ * cannot be recomputed from a later state capture. The key is replaced
+ * with fresh hardware entropy after a configurable amount of output.
+ */
+
+#include <zephyr/init.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/entropy.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <string.h>
+
+#define CHACHA20_BLOCK_SIZE 64
+#define CHACHA20_KEY_SIZE   32
+
+#define POOL_SIZE CONFIG_CHACHA20_RANDOM_POOL_SIZE
+
+BUILD_ASSERT((POOL_SIZE % CHACHA20_BLOCK_SIZE) == 0,
+	     "pool size must be a multiple of the ChaCha20 block size");
+
+struct chacha20_pool {
+	/* ChaCha20 state: constants, key, counter, nonce */
+	uint32_t state[16];
+	/* Pregenerated bytes, consumed from the tail */
+	uint8_t buffer[POOL_SIZE];
+	/* Unconsumed bytes left in the buffer */
+	uint16_t avail;
+	/* True when the key came from the entropy driver */
+	bool strong;
+	/* Bytes generated since the last hardware reseed */
+	uint32_t generated;
+};
+
+static struct chacha20_pool pools[CONFIG_MP_MAX_NUM_CPUS];
+
+static const struct device *const entropy_dev =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_entropy));
+
+#if defined(CONFIG_SMP)
+#define POOL_CURRENT() (&pools[arch_curr_cpu()->id])
+#else
+#define POOL_CURRENT() (&pools[0])
+#endif
+
+#define QUARTER_ROUND(a, b, c, d)					\
+	do {								\
+		a += b; d ^= a; d = (d << 16) | (d >> 16);		\
+		c += d; b ^= c; b = (b << 12) | (b >> 20);		\
+		a += b; d ^= a; d = (d << 8) | (d >> 24);		\
+		c += d; b ^= c; b = (b << 7) | (b >> 25);		\
+	} while (false)
+
+static void chacha20_block(uint32_t state[16], uint8_t out[CHACHA20_BLOCK_SIZE])
+{
+	uint32_t x[16];
+
+	memcpy(x, state, sizeof(x));
+
+	for (int i = 0; i < 10; i++) {
+		QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+		QUARTER_ROUND(x[1], x[5], x[9], x[13]);
+		QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+		QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+		QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+		QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+		QUARTER_ROUND(x[2], x[7], x[8], x[13]);
+		QUARTER_ROUND(x[3], x[4], x[9], x[14]);
+	}
+
+	for (int i = 0; i < 16; i++) {
+		sys_put_le32(x[i] + state[i], &out[i * sizeof(uint32_t)]);
+	}
+
+	/* Block counter */
+	state[12]++;
+}
+
+static void chacha20_install_key(struct chacha20_pool *pool,
+				 const uint8_t key[CHACHA20_KEY_SIZE],
+				 bool strong)
+{
+	/* "expand 32-byte k" */
+	pool->state[0] = 0x61707865;
+	pool->state[1] = 0x3320646e;
+	pool->state[2] = 0x79622d32;
+	pool->state[3] = 0x6b206574;
+
+	for (int i = 0; i < (CHACHA20_KEY_SIZE / sizeof(uint32_t)); i++) {
+		pool->state[4 + i] = sys_get_le32(&key[i * sizeof(uint32_t)]);
+	}
+
+	pool->state[12] = 0U;
+	/* The nonce only needs to differ between the per-CPU pools */
+	pool->state[13] = (uint32_t)ARRAY_INDEX(pools, pool);
+	pool->state[14] = k_cycle_get_32();
+	pool->state[15] = 0U;
+
+	pool->avail = 0U;
+	pool->generated = 0U;
+	pool->strong = strong;
+}
+
+/* Key the pool of the CPU this ends up running on from the entropy
+ * driver. Called with interrupts unlocked as the driver may block.
+ */
+static int chacha20_pool_seed(bool require_entropy)
+{
+	uint8_t seed[CHACHA20_KEY_SIZE];
+	unsigned int key;
+	int rc = -ENODEV;
+
+	if (device_is_ready(entropy_dev)) {
+		rc = entropy_get_entropy(entropy_dev, seed, sizeof(seed));
+	}
+
+	if (rc != 0) {
+		if (require_entropy) {
+			return -EIO;
+		}
+
+		/* Degraded early-boot seed, as the entropy device may still
+		 * be gathering entropy. The pool is not marked strong, so
+		 * every later request retries the driver until it delivers.
+		 */
+		for (int i = 0; i < (int)sizeof(seed); i += sizeof(uint32_t)) {
+			sys_put_le32(k_cycle_get_32() ^ (0x9b64c2b0 >> i),
+				     &seed[i]);
+		}
+	}
+
+	key = arch_irq_lock();
+	chacha20_install_key(POOL_CURRENT(), seed, rc == 0);
+	arch_irq_unlock(key);
+
+	memset(seed, 0, sizeof(seed));
+
+	return 0;
+}
+
+static void chacha20_refill(struct chacha20_pool *pool)
+{
+	uint8_t rekey[CHACHA20_BLOCK_SIZE];
+
+	for (int off = 0; off < POOL_SIZE; off += CHACHA20_BLOCK_SIZE) {
+		chacha20_block(pool->state, &pool->buffer[off]);
+	}
+
+	/* Fast key erasure: replace the key with generator output so the
+	 * bytes above cannot be recomputed from the remaining state.
+	 */
+	chacha20_block(pool->state, rekey);
+	for (int i = 0; i < (CHACHA20_KEY_SIZE / sizeof(uint32_t)); i++) {
+		pool->state[4 + i] = sys_get_le32(&rekey[i * sizeof(uint32_t)]);
+	}
+	pool->state[12] = 0U;
+
+	pool->avail = POOL_SIZE;
+	pool->generated += POOL_SIZE;
+}
+
+static int chacha20_fill(uint8_t *dst, size_t outlen, bool csrand)
+{
+	struct chacha20_pool *pool;
+	unsigned int key;
+	size_t chunk;
+	int rc;
+
+	/* Reading the flag without the lock is fine: a stale false only
+	 * causes a redundant reseed attempt.
+	 */
+	if (unlikely(!POOL_CURRENT()->strong)) {
+		rc = chacha20_pool_seed(csrand);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	while (outlen > 0) {
+		key = arch_irq_lock();
+		pool = POOL_CURRENT();
+
+		if (pool->generated >= CONFIG_CHACHA20_RANDOM_RESEED_INTERVAL) {
+			arch_irq_unlock(key);
+
+			if (chacha20_pool_seed(true) < 0) {
+				if (csrand) {
+					return -EIO;
+				}
+
+				/* Keep the self-rekeyed state and back off
+				 * from the driver for another interval.
+				 */
+				key = arch_irq_lock();
+				POOL_CURRENT()->generated = 0U;
+				arch_irq_unlock(key);
+			}
+			continue;
+		}
+
+		if (pool->avail == 0U) {
+			chacha20_refill(pool);
+		}
+
+		chunk = MIN(outlen, (size_t)pool->avail);
+		memcpy(dst, &pool->buffer[POOL_SIZE - pool->avail], chunk);
+		pool->avail -= chunk;
+
+		arch_irq_unlock(key);
+
+		dst += chunk;
+		outlen -= chunk;
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_CHACHA20_RANDOM_GENERATOR)
+void z_impl_sys_rand_get(void *dst, size_t outlen)
+{
+	(void)chacha20_fill(dst, outlen, false);
+}
+#endif /* CONFIG_CHACHA20_RANDOM_GENERATOR */
+
+#if defined(CONFIG_CHACHA20_CSPRNG_GENERATOR)
+int z_impl_sys_csrand_get(void *dst, size_t outlen)
+{
+	return chacha20_fill(dst, outlen, true);
+}
+#endif /* CONFIG_CHACHA20_CSPRNG_GENERATOR */
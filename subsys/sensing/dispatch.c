@@ -113,7 +113,16 @@ static void dispatch_task(void *a, void *b, void *c)
 		    (uintptr_t)cqe.userdata < (uintptr_t)STRUCT_SECTION_END(sensing_sensor)) {
 			struct sensing_sensor *sensor = cqe.userdata;
 
+#ifdef CONFIG_SENSING_PIPELINE
+			/* run shared processing stages once per batch before
+			 * fanning the data out to the clients
+			 */
+			if (sensing_pipeline_process(sensor, data, data_len) == 0) {
+				send_data_to_clients(sensor, data);
+			}
+#else
 			send_data_to_clients(sensor, data);
+#endif
 		}
 
 		rtio_release_buffer(&sensing_rtio_ctx, data, data_len);
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2025 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/logging/log.h>
+#include <zephyr/sensing/sensing_pipeline.h>
+#include <zephyr/sensing/sensing_sensor.h>
+#include "sensor_mgmt.h"
+
+LOG_MODULE_DECLARE(sensing, CONFIG_SENSING_LOG_LEVEL);
+
+/* protects the stage lists against concurrent add/remove */
+static struct k_spinlock stage_list_lock;
+
+int sensing_pipeline_stage_add(const struct device *dev,
+			       struct sensing_pipeline_stage *stage)
+{
+	struct sensing_sensor *sensor = get_sensor_by_dev(dev);
+	k_spinlock_key_t key;
+
+	if (!sensor || !stage || !stage->process) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&stage_list_lock);
+	sys_slist_append(&sensor->stage_list, &stage->node);
+	k_spin_unlock(&stage_list_lock, key);
+
+	LOG_INF("sensor:%s add pipeline stage:%s", dev->name,
+		stage->name ? stage->name : "(unnamed)");
+
+	return 0;
+}
+
+int sensing_pipeline_stage_remove(const struct device *dev,
+				  struct sensing_pipeline_stage *stage)
+{
+	struct sensing_sensor *sensor = get_sensor_by_dev(dev);
+	k_spinlock_key_t key;
+	bool found;
+
+	if (!sensor || !stage) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&stage_list_lock);
+	found = sys_slist_find_and_remove(&sensor->stage_list, &stage->node);
+	k_spin_unlock(&stage_list_lock, key);
+
+	return found ? 0 : -ENOENT;
+}
+
+/* run the sensor's stages on one sample batch, called from dispatch thread */
+int sensing_pipeline_process(struct sensing_sensor *sensor, void *data, uint32_t len)
+{
+	struct sensing_pipeline_stage *stage;
+	int ret;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&sensor->stage_list, stage, node) {
+		ret = stage->process(stage, data, len);
+		if (ret) {
+			LOG_DBG("sensor:%s stage:%s dropped batch:%d",
+				sensor->dev->name,
+				stage->name ? stage->name : "(unnamed)", ret);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static int decimate_3d_process(struct sensing_pipeline_stage *stage,
+			       void *data, uint32_t len)
+{
+	struct sensing_pipeline_decimate_3d *decimate =
+		CONTAINER_OF(stage, struct sensing_pipeline_decimate_3d, stage);
+	struct sensing_sensor_value_3d_q31 *value = data;
+	uint16_t out = 0;
+
+	for (uint16_t i = 0; i < value->header.reading_count; i++) {
+		if (decimate->phase == 0) {
+			value->readings[out] = value->readings[i];
+			/* dropped readings contribute their timestamp delta
+			 * to the next kept reading, so kept readings retain
+			 * their original timestamps
+			 */
+			value->readings[out].timestamp_delta += decimate->dropped_delta;
+			decimate->dropped_delta = 0;
+			out++;
+		} else {
+			decimate->dropped_delta += value->readings[i].timestamp_delta;
+		}
+
+		if (++decimate->phase == decimate->factor) {
+			decimate->phase = 0;
+		}
+	}
+
+	value->header.reading_count = out;
+
+	return (out > 0) ? 0 : -ENODATA;
+}
+
+int sensing_pipeline_decimate_3d_init(struct sensing_pipeline_decimate_3d *decimate,
+				      uint32_t factor)
+{
+	if (!decimate || factor == 0) {
+		return -EINVAL;
+	}
+
+	decimate->stage.name = "decimate_3d";
+	decimate->stage.process = decimate_3d_process;
+	decimate->factor = factor;
+	decimate->phase = 0;
+	decimate->dropped_delta = 0;
+
+	return 0;
+}
+
+#ifdef CONFIG_SENSING_PIPELINE_LOWPASS
+
+static int lowpass_3d_process(struct sensing_pipeline_stage *stage,
+			      void *data, uint32_t len)
+{
+	struct sensing_pipeline_lowpass_3d *lowpass =
+		CONTAINER_OF(stage, struct sensing_pipeline_lowpass_3d, stage);
+	struct sensing_sensor_value_3d_q31 *value = data;
+	q31_t in[SENSING_PIPELINE_LOWPASS_BLOCK_SIZE];
+	q31_t out[SENSING_PIPELINE_LOWPASS_BLOCK_SIZE];
+	uint16_t count = value->header.reading_count;
+	uint16_t base = 0;
+
+	while (count > 0) {
+		uint16_t block = MIN(count, SENSING_PIPELINE_LOWPASS_BLOCK_SIZE);
+
+		/* readings are interleaved x/y/z, the filter kernel wants
+		 * one contiguous array per axis
+		 */
+		for (int axis = 0; axis < 3; axis++) {
+			for (uint16_t i = 0; i < block; i++) {
+				in[i] = value->readings[base + i].v[axis];
+			}
+
+			arm_biquad_cascade_df1_q31(&lowpass->inst[axis],
+						   in, out, block);
+
+			for (uint16_t i = 0; i < block; i++) {
+				value->readings[base + i].v[axis] = out[i];
+			}
+		}
+
+		base += block;
+		count -= block;
+	}
+
+	return 0;
+}
+
+int sensing_pipeline_lowpass_3d_init(struct sensing_pipeline_lowpass_3d *lowpass,
+				     const q31_t coeffs[5], int8_t post_shift)
+{
+	if (!lowpass || !coeffs) {
+		return -EINVAL;
+	}
+
+	lowpass->stage.name = "lowpass_3d";
+	lowpass->stage.process = lowpass_3d_process;
+	memcpy(lowpass->coeffs, coeffs, sizeof(lowpass->coeffs));
+
+	for (int axis = 0; axis < 3; axis++) {
+		arm_biquad_cascade_df1_init_q31(&lowpass->inst[axis], 1,
+						lowpass->coeffs,
+						lowpass->state[axis],
+						post_shift);
+	}
+
+	return 0;
+}
+
+#endif /* CONFIG_SENSING_PIPELINE_LOWPASS */
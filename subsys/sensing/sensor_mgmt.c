@@ -298,6 +298,9 @@ static int init_sensor(struct sensing_sensor *sensor)
 
 	k_timer_init(&sensor->timer, sensing_sensor_polling_timer, NULL);
 	sys_slist_init(&sensor->client_list);
+#ifdef CONFIG_SENSING_PIPELINE
+	sys_slist_init(&sensor->stage_list);
+#endif
 
 	for (i = 0; i < sensor->reporter_num; i++) {
 		conn = &sensor->conns[i];
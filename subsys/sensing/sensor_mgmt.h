@@ -49,6 +49,10 @@ struct sensing_context {
 	atomic_t event_flag;
 };
 
+#ifdef CONFIG_SENSING_PIPELINE
+int sensing_pipeline_process(struct sensing_sensor *sensor, void *data, uint32_t len);
+#endif
+
 int open_sensor(struct sensing_sensor *sensor, struct sensing_connection **conn);
 int close_sensor(struct sensing_connection **conn);
 int sensing_register_callback(struct sensing_connection *conn,
@@ -133,8 +133,14 @@ static int settings_nvs_load(struct settings_store *cs,
 
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 	uint16_t cached = 0;
+	bool full_load = (arg->subtree == NULL);
 
-	cf->loaded = false;
+	/* A subtree load does not visit every name, so only a full load may
+	 * rebuild the name cache.
+	 */
+	if (full_load) {
+		cf->loaded = false;
+	}
 #endif
 
 	name_id = cf->last_name_id + 1;
@@ -144,8 +150,10 @@ static int settings_nvs_load(struct settings_store *cs,
 		name_id--;
 		if (name_id == NVS_NAMECNT_ID) {
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
-			cf->loaded = true;
-			cf->cache_total = cached;
+			if (full_load) {
+				cf->loaded = true;
+				cf->cache_total = cached;
+			}
 #endif
 			break;
 		}
@@ -155,6 +163,20 @@ static int settings_nvs_load(struct settings_store *cs,
 		 * setting's value.
 		 */
 		rc1 = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name));
+
+		if (rc1 > 0) {
+			/* Found a name, this might not include a trailing \0 */
+			name[rc1] = '\0';
+
+			/* Skip the value entry lookup for keys outside the
+			 * requested subtree.
+			 */
+			if (arg->subtree != NULL &&
+			    !settings_name_steq(name, arg->subtree, NULL)) {
+				continue;
+			}
+		}
+
 		rc2 = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET,
 			       &buf, sizeof(buf));
 
@@ -191,14 +213,14 @@ static int settings_nvs_load(struct settings_store *cs,
 			continue;
 		}
 
-		/* Found a name, this might not include a trailing \0 */
-		name[rc1] = '\0';
 		read_fn_arg.fs = &cf->cf_nvs;
 		read_fn_arg.id = name_id + NVS_NAME_ID_OFFSET;
 
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
-		settings_nvs_cache_add(cf, name, name_id);
-		cached++;
+		if (full_load) {
+			settings_nvs_cache_add(cf, name, name_id);
+			cached++;
+		}
 #endif
 
 		ret = settings_call_set_handler(
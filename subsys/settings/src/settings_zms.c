@@ -172,6 +172,20 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 		 */
 		rc1 = zms_read(&cf->cf_zms, ZMS_NAME_ID_FROM_LL_NODE(ll_hash_id), &name,
 			       sizeof(name) - 1);
+
+		if (rc1 > 0) {
+			/* Found a name, this might not include a trailing \0 */
+			name[rc1] = '\0';
+
+			/* Skip the value entry lookup for keys outside the
+			 * requested subtree.
+			 */
+			if (arg->subtree != NULL &&
+			    !settings_name_steq(name, arg->subtree, NULL)) {
+				goto next_node;
+			}
+		}
+
 		/* get the length of data and verify that it exists */
 		rc2 = zms_get_data_length(&cf->cf_zms, ZMS_NAME_ID_FROM_LL_NODE(ll_hash_id) +
 							       ZMS_DATA_ID_OFFSET);
@@ -189,8 +203,6 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 			continue;
 		}
 
-		/* Found a name, this might not include a trailing \0 */
-		name[rc1] = '\0';
 		read_fn_arg.fs = &cf->cf_zms;
 		read_fn_arg.id = ZMS_NAME_ID_FROM_LL_NODE(ll_hash_id) + ZMS_DATA_ID_OFFSET;
 
@@ -200,6 +212,7 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 			break;
 		}
 
+next_node:
 		/* update next ll_hash_id */
 		ret = zms_read(&cf->cf_zms, ll_hash_id, &settings_element,
 			       sizeof(struct settings_hash_linked_list));
@@ -156,11 +156,55 @@ static int cmd_device_pm_toggle(const struct shell *sh,
 #define PM_SHELL_CMD
 #endif /* CONFIG_PM_DEVICE_RUNTIME  */
 
+#ifdef CONFIG_DEVICE_INIT_ON_DEMAND
+static int cmd_device_deferred(const struct shell *sh,
+			       size_t argc, char **argv)
+{
+	const struct device *devlist;
+	size_t devcnt = z_device_get_all_static(&devlist);
+	const struct device *devlist_end = devlist + devcnt;
+	const struct device *dev;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_fprintf(sh, SHELL_NORMAL, "deferred devices:\n");
+
+	for (dev = devlist; dev < devlist_end; dev++) {
+		char buf[20];
+		const char *name = get_device_name(dev, buf, sizeof(buf));
+
+		if ((dev->flags & DEVICE_FLAG_INIT_DEFERRED) == 0U) {
+			continue;
+		}
 
+		/* Peek at the state directly: device_is_ready() would
+		 * trigger the on-demand initialization itself.
+		 */
+		if (!dev->state->initialized) {
+			shell_fprintf(sh, SHELL_NORMAL, "- %s (pending)\n",
+				      name);
+		} else {
+			shell_fprintf(sh, SHELL_NORMAL,
+				      "- %s (res=%u, init took %u cycles)\n",
+				      name, dev->state->init_res,
+				      dev->state->init_cycles);
+		}
+	}
+
+	return 0;
+}
+#define DEFERRED_SHELL_CMD SHELL_CMD(deferred, NULL, \
+	"List deferred devices with their init status and timing", \
+	cmd_device_deferred),
+#else
+#define DEFERRED_SHELL_CMD
+#endif /* CONFIG_DEVICE_INIT_ON_DEMAND */
 
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_device,
 	SHELL_CMD(list, NULL, "List configured devices", cmd_device_list),
 	PM_SHELL_CMD
+	DEFERRED_SHELL_CMD
 	SHELL_SUBCMD_SET_END /* Array terminated. */
 );
 
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/sys/sys_heap.h>
+
+#define TOP_SITES 10
+
+static int cmd_kernel_heap_sites(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	size_t shown[TOP_SITES];
+	int nshown = 0;
+
+	shell_print(sh, "%-10s %10s %12s", "caller", "count", "bytes");
+
+	while (nshown < TOP_SITES) {
+		struct sys_heap_alloc_site site;
+		struct sys_heap_alloc_site best = { 0 };
+		size_t best_idx = 0;
+		bool found = false;
+
+		for (size_t i = 0; sys_heap_alloc_site_get(i, &site) == 0; i++) {
+			bool skip = site.count == 0;
+
+			for (int j = 0; j < nshown; j++) {
+				skip = skip || (shown[j] == i);
+			}
+			if (skip) {
+				continue;
+			}
+			if (!found || (site.bytes > best.bytes)) {
+				best = site;
+				best_idx = i;
+				found = true;
+			}
+		}
+		if (!found) {
+			break;
+		}
+		shown[nshown++] = best_idx;
+		shell_print(sh, "%-10p %10u %12zu%s", (void *)best.caller,
+			    best.count, best.bytes,
+			    best_idx == 0 ? " (overflow)" : "");
+	}
+
+	if (nshown == 0) {
+		shell_print(sh, "no live allocations");
+	}
+
+	return 0;
+}
+
+KERNEL_CMD_ADD(heap_sites, NULL, "Top heap allocation sites by live bytes.",
+	       cmd_kernel_heap_sites);
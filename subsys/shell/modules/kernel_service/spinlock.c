@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2025 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+
+static int cmd_kernel_spinlocks(const struct shell *sh, size_t argc, char **argv)
+{
+	size_t order[CONFIG_SPIN_LOCK_PROFILE_MAX_LOCKS];
+	uint64_t spin[CONFIG_SPIN_LOCK_PROFILE_MAX_LOCKS];
+	struct k_spin_lock_profile_stats stats;
+	struct k_spinlock *lock;
+	size_t count = 0;
+
+	if ((argc > 1) && (strcmp(argv[1], "reset") == 0)) {
+		k_spin_lock_profile_reset();
+		return 0;
+	}
+
+	for (size_t i = 0; i < CONFIG_SPIN_LOCK_PROFILE_MAX_LOCKS; i++) {
+		if (k_spin_lock_profile_stats_get(i, &lock, &stats) != 0) {
+			break;
+		}
+
+		/* Insertion sort by total spin time, most contended first */
+		size_t pos = count;
+
+		while ((pos > 0) && (spin[pos - 1] < stats.spin_cycles)) {
+			order[pos] = order[pos - 1];
+			spin[pos] = spin[pos - 1];
+			pos--;
+		}
+		order[pos] = i;
+		spin[pos] = stats.spin_cycles;
+		count++;
+	}
+
+	shell_print(sh, "%-10s %12s %14s %14s %12s",
+		    "lock", "acquired", "spin cycles", "hold cycles", "max hold");
+
+	for (size_t i = 0; i < count; i++) {
+		if (k_spin_lock_profile_stats_get(order[i], &lock, &stats) != 0) {
+			continue;
+		}
+
+		shell_print(sh, "%-10p %12llu %14llu %14llu %12u",
+			    lock, stats.count, stats.spin_cycles,
+			    stats.hold_cycles, stats.max_hold_cycles);
+	}
+
+	return 0;
+}
+
+KERNEL_CMD_ARG_ADD(spinlocks, NULL,
+		   "Spinlock profiling statistics.\n"
+		   "Usage: spinlocks [reset]",
+		   cmd_kernel_spinlocks, 1, 1);
@@ -89,6 +89,12 @@ static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
 	shell_print(sh, "\tcpu_mask: 0x%x", thread->base.cpu_mask);
 #endif /* CONFIG_SCHED_CPU_MASK */
 
+#ifdef CONFIG_FPU_SHARING_DEMOTION
+	shell_print(sh, "\tfpu: %u stackings, %u re-promotions%s",
+		    thread->arch.fpu_stack_count, thread->arch.fpu_trap_count,
+		    (thread->arch.fpu_demoted != 0U) ? " (demoted)" : "");
+#endif /* CONFIG_FPU_SHARING_DEMOTION */
+
 	IF_ENABLED(CONFIG_THREAD_RUNTIME_STATS, (rt_stats_dump(sh, thread)));
 
 	ret = k_thread_stack_space_get(thread, &unused);
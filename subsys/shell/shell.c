@@ -966,6 +966,184 @@ static inline int ascii_filter(const char data)
 	}
 }
 
+/* Process a single received character through the shell state machine.
+ * Returns true if the transport buffer shall be flushed afterwards.
+ */
+static bool state_process_char(const struct shell *sh, char data)
+{
+	switch (sh->ctx->receive_state) {
+	case SHELL_RECEIVE_DEFAULT:
+		if (process_nl(sh, data)) {
+			if (!sh->ctx->cmd_buff_len) {
+				history_mode_exit(sh);
+				z_cursor_next_line_move(sh);
+			} else {
+				/* Command execution */
+				sh->ctx->ret_val = execute(sh);
+			}
+			/* Function responsible for printing prompt
+			 * on received NL.
+			 */
+			state_set(sh, SHELL_STATE_ACTIVE);
+			return false;
+		}
+
+		switch (data) {
+		case SHELL_VT100_ASCII_ESC: /* ESCAPE */
+			receive_state_change(sh, SHELL_RECEIVE_ESC);
+			break;
+
+		case '\0':
+			break;
+
+		case '\t': /* TAB */
+			if (z_flag_echo_get(sh) &&
+			    IS_ENABLED(CONFIG_SHELL_TAB)) {
+				/* If the Tab key is pressed, "history
+				 * mode" must be terminated because
+				 * tab and history handlers are sharing
+				 * the same array: temp_buff.
+				 */
+				z_flag_history_exit_set(sh, true);
+				tab_handle(sh);
+			}
+			break;
+
+		case SHELL_VT100_ASCII_BSPACE: /* BACKSPACE */
+			if (z_flag_echo_get(sh)) {
+				z_flag_history_exit_set(sh, true);
+				z_shell_op_char_backspace(sh);
+			}
+			break;
+
+		case SHELL_VT100_ASCII_DEL: /* DELETE */
+			if (z_flag_echo_get(sh)) {
+				z_flag_history_exit_set(sh, true);
+				if (z_flag_mode_delete_get(sh)) {
+					z_shell_op_char_backspace(sh);
+
+				} else {
+					z_shell_op_char_delete(sh);
+				}
+			}
+			break;
+
+		default:
+			if (isprint((int) data) != 0) {
+				z_flag_history_exit_set(sh, true);
+				z_shell_op_char_insert(sh, data);
+			} else if (z_flag_echo_get(sh)) {
+				ctrl_metakeys_handle(sh, data);
+			}
+			break;
+		}
+		break;
+
+	case SHELL_RECEIVE_ESC:
+		if (data == '[') {
+			receive_state_change(sh,
+					SHELL_RECEIVE_ESC_SEQ);
+			break;
+		} else if (z_flag_echo_get(sh)) {
+			alt_metakeys_handle(sh, data);
+		}
+		receive_state_change(sh, SHELL_RECEIVE_DEFAULT);
+		break;
+
+	case SHELL_RECEIVE_ESC_SEQ:
+		receive_state_change(sh, SHELL_RECEIVE_DEFAULT);
+
+		if (!z_flag_echo_get(sh)) {
+			return false;
+		}
+
+		switch (data) {
+		case 'A': /* UP arrow */
+			history_handle(sh, true);
+			break;
+
+		case 'B': /* DOWN arrow */
+			history_handle(sh, false);
+			break;
+
+		case 'C': /* RIGHT arrow */
+			z_shell_op_right_arrow(sh);
+			break;
+
+		case 'D': /* LEFT arrow */
+			z_shell_op_left_arrow(sh);
+			break;
+
+		case '4': /* END Button in ESC[n~ mode */
+			receive_state_change(sh,
+					SHELL_RECEIVE_TILDE_EXP);
+			__fallthrough;
+		case 'F': /* END Button in VT100 mode */
+			z_shell_op_cursor_end_move(sh);
+			break;
+
+		case '1': /* HOME Button in ESC[n~ mode */
+			receive_state_change(sh,
+					SHELL_RECEIVE_TILDE_EXP);
+			__fallthrough;
+		case 'H': /* HOME Button in VT100 mode */
+			z_shell_op_cursor_home_move(sh);
+			break;
+
+		case '2': /* INSERT Button in ESC[n~ mode */
+			receive_state_change(sh,
+					SHELL_RECEIVE_TILDE_EXP);
+			__fallthrough;
+		case 'L': {/* INSERT Button in VT100 mode */
+			bool status = z_flag_insert_mode_get(sh);
+
+			z_flag_insert_mode_set(sh, !status);
+			break;
+		}
+
+		case '3':/* DELETE Button in ESC[n~ mode */
+			receive_state_change(sh,
+					SHELL_RECEIVE_TILDE_EXP);
+			if (z_flag_echo_get(sh)) {
+				z_shell_op_char_delete(sh);
+			}
+			break;
+
+		default:
+			break;
+		}
+		break;
+
+	case SHELL_RECEIVE_TILDE_EXP:
+		receive_state_change(sh, SHELL_RECEIVE_DEFAULT);
+		break;
+
+	default:
+		receive_state_change(sh, SHELL_RECEIVE_DEFAULT);
+		break;
+	}
+
+	return true;
+}
+
+#ifdef CONFIG_SHELL_BULK_RX
+/* Length of the initial run of plain printable characters which can be
+ * inserted into the command buffer in a single operation.
+ */
+static size_t plain_run_len(const uint8_t *data, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		if ((ascii_filter(data[i]) != 0) || (isprint((int)data[i]) == 0)) {
+			break;
+		}
+	}
+
+	return i;
+}
+#endif /* CONFIG_SHELL_BULK_RX */
+
 static void state_collect(const struct shell *sh)
 {
 	size_t count = 0;
@@ -998,169 +1176,79 @@ static void state_collect(const struct shell *sh)
 			return;
 		}
 
-		(void)sh->iface->api->read(sh->iface, &data,
-					      sizeof(data), &count);
+#ifdef CONFIG_SHELL_BULK_RX
+		uint8_t buf[CONFIG_SHELL_BULK_RX_BUF_SIZE];
+
+		(void)sh->iface->api->read(sh->iface, buf, sizeof(buf), &count);
 		if (count == 0) {
 			return;
 		}
 
-		if (ascii_filter(data) != 0) {
-			continue;
-		}
+		for (size_t i = 0; i < count; i++) {
+			data = buf[i];
 
-		switch (sh->ctx->receive_state) {
-		case SHELL_RECEIVE_DEFAULT:
-			if (process_nl(sh, data)) {
-				if (!sh->ctx->cmd_buff_len) {
-					history_mode_exit(sh);
-					z_cursor_next_line_move(sh);
-				} else {
-					/* Command execution */
-					sh->ctx->ret_val = execute(sh);
-				}
-				/* Function responsible for printing prompt
-				 * on received NL.
-				 */
-				state_set(sh, SHELL_STATE_ACTIVE);
+			if (ascii_filter(data) != 0) {
 				continue;
 			}
 
-			switch (data) {
-			case SHELL_VT100_ASCII_ESC: /* ESCAPE */
-				receive_state_change(sh, SHELL_RECEIVE_ESC);
-				break;
-
-			case '\0':
-				break;
+			if ((sh->ctx->receive_state == SHELL_RECEIVE_DEFAULT) &&
+			    !z_flag_insert_mode_get(sh)) {
+				size_t run = plain_run_len(&buf[i], count - i);
 
-			case '\t': /* TAB */
-				if (z_flag_echo_get(sh) &&
-				    IS_ENABLED(CONFIG_SHELL_TAB)) {
-					/* If the Tab key is pressed, "history
-					 * mode" must be terminated because
-					 * tab and history handlers are sharing
-					 * the same array: temp_buff.
+				if (run > 1) {
+					/* A run of plain characters cannot
+					 * complete a line or an escape
+					 * sequence; insert it into the command
+					 * buffer and echo it in a single
+					 * operation.
 					 */
+					z_flag_last_nl_set(sh, 0);
 					z_flag_history_exit_set(sh, true);
-					tab_handle(sh);
-				}
-				break;
-
-			case SHELL_VT100_ASCII_BSPACE: /* BACKSPACE */
-				if (z_flag_echo_get(sh)) {
-					z_flag_history_exit_set(sh, true);
-					z_shell_op_char_backspace(sh);
-				}
-				break;
-
-			case SHELL_VT100_ASCII_DEL: /* DELETE */
-				if (z_flag_echo_get(sh)) {
-					z_flag_history_exit_set(sh, true);
-					if (z_flag_mode_delete_get(sh)) {
-						z_shell_op_char_backspace(sh);
-
-					} else {
-						z_shell_op_char_delete(sh);
-					}
-				}
-				break;
-
-			default:
-				if (isprint((int) data) != 0) {
-					z_flag_history_exit_set(sh, true);
-					z_shell_op_char_insert(sh, data);
-				} else if (z_flag_echo_get(sh)) {
-					ctrl_metakeys_handle(sh, data);
+					z_shell_op_data_insert(sh,
+							(const char *)&buf[i],
+							run);
+					z_transport_buffer_flush(sh);
+					i += run - 1;
+					continue;
 				}
-				break;
 			}
-			break;
 
-		case SHELL_RECEIVE_ESC:
-			if (data == '[') {
-				receive_state_change(sh,
-						SHELL_RECEIVE_ESC_SEQ);
-				break;
-			} else if (z_flag_echo_get(sh)) {
-				alt_metakeys_handle(sh, data);
+			if (state_process_char(sh, data)) {
+				z_transport_buffer_flush(sh);
 			}
-			receive_state_change(sh, SHELL_RECEIVE_DEFAULT);
-			break;
 
-		case SHELL_RECEIVE_ESC_SEQ:
-			receive_state_change(sh, SHELL_RECEIVE_DEFAULT);
-
-			if (!z_flag_echo_get(sh)) {
-				continue;
-			}
-
-			switch (data) {
-			case 'A': /* UP arrow */
-				history_handle(sh, true);
-				break;
-
-			case 'B': /* DOWN arrow */
-				history_handle(sh, false);
-				break;
-
-			case 'C': /* RIGHT arrow */
-				z_shell_op_right_arrow(sh);
-				break;
-
-			case 'D': /* LEFT arrow */
-				z_shell_op_left_arrow(sh);
-				break;
-
-			case '4': /* END Button in ESC[n~ mode */
-				receive_state_change(sh,
-						SHELL_RECEIVE_TILDE_EXP);
-				__fallthrough;
-			case 'F': /* END Button in VT100 mode */
-				z_shell_op_cursor_end_move(sh);
-				break;
-
-			case '1': /* HOME Button in ESC[n~ mode */
-				receive_state_change(sh,
-						SHELL_RECEIVE_TILDE_EXP);
-				__fallthrough;
-			case 'H': /* HOME Button in VT100 mode */
-				z_shell_op_cursor_home_move(sh);
-				break;
-
-			case '2': /* INSERT Button in ESC[n~ mode */
-				receive_state_change(sh,
-						SHELL_RECEIVE_TILDE_EXP);
-				__fallthrough;
-			case 'L': {/* INSERT Button in VT100 mode */
-				bool status = z_flag_insert_mode_get(sh);
-
-				z_flag_insert_mode_set(sh, !status);
-				break;
-			}
-
-			case '3':/* DELETE Button in ESC[n~ mode */
-				receive_state_change(sh,
-						SHELL_RECEIVE_TILDE_EXP);
-				if (z_flag_echo_get(sh)) {
-					z_shell_op_char_delete(sh);
+			/* A command may have put the shell in bypass mode.
+			 * Hand the remaining bytes over to the bypass
+			 * callback as they are no longer in the transport.
+			 */
+			bypass = sh->ctx->bypass;
+			if (bypass != NULL) {
+				if ((i + 1) < count) {
+					z_flag_cmd_ctx_set(sh, true);
+					bypass(sh, &buf[i + 1], count - i - 1);
+					z_flag_cmd_ctx_set(sh, false);
+					if (!(volatile shell_bypass_cb_t *)sh->ctx->bypass) {
+						state_set(sh, SHELL_STATE_ACTIVE);
+					}
 				}
 				break;
-
-			default:
-				break;
 			}
-			break;
-
-		case SHELL_RECEIVE_TILDE_EXP:
-			receive_state_change(sh, SHELL_RECEIVE_DEFAULT);
-			break;
+		}
+#else
+		(void)sh->iface->api->read(sh->iface, &data,
+					      sizeof(data), &count);
+		if (count == 0) {
+			return;
+		}
 
-		default:
-			receive_state_change(sh, SHELL_RECEIVE_DEFAULT);
-			break;
+		if (ascii_filter(data) != 0) {
+			continue;
 		}
 
-		z_transport_buffer_flush(sh);
+		if (state_process_char(sh, data)) {
+			z_transport_buffer_flush(sh);
+		}
+#endif /* CONFIG_SHELL_BULK_RX */
 	}
 }
 
@@ -374,6 +374,12 @@ void z_shell_op_completion_insert(const struct shell *sh,
 	data_insert(sh, compl, compl_len);
 }
 
+void z_shell_op_data_insert(const struct shell *sh, const char *data,
+			    uint16_t len)
+{
+	data_insert(sh, data, len);
+}
+
 void z_shell_cmd_line_erase(const struct shell *sh)
 {
 	z_shell_multiline_data_calc(&sh->ctx->vt100_ctx.cons,
@@ -312,6 +312,10 @@ void z_shell_op_completion_insert(const struct shell *sh,
 				  const char *compl,
 				  uint16_t compl_len);
 
+/* Function inserts a block of characters at the current cursor position. */
+void z_shell_op_data_insert(const struct shell *sh, const char *data,
+			    uint16_t len);
+
 bool z_shell_cursor_in_empty_line(const struct shell *sh);
 
 void z_shell_cmd_line_erase(const struct shell *sh);
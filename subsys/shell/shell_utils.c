@@ -269,13 +269,24 @@ static inline uint32_t shell_root_cmd_count(void)
 /* Function returning pointer to parent command matching requested syntax. */
 const struct shell_static_entry *root_cmd_find(const char *syntax)
 {
-	const size_t cmd_count = shell_root_cmd_count();
-	const union shell_cmd_entry *cmd;
+	size_t low = 0;
+	size_t high = shell_root_cmd_count();
+
+	/* Entries in the shell_root_cmds section are sorted by name by the
+	 * linker (see ITERABLE_SECTION_ROM), so the command can be found
+	 * with a binary search.
+	 */
+	while (low < high) {
+		size_t mid = low + (high - low) / 2;
+		const union shell_cmd_entry *cmd = shell_root_cmd_get(mid);
+		int cmp = strcmp(syntax, cmd->entry->syntax);
 
-	for (size_t cmd_idx = 0; cmd_idx < cmd_count; ++cmd_idx) {
-		cmd = shell_root_cmd_get(cmd_idx);
-		if (strcmp(syntax, cmd->entry->syntax) == 0) {
+		if (cmp == 0) {
 			return cmd->entry;
+		} else if (cmp > 0) {
+			low = mid + 1;
+		} else {
+			high = mid;
 		}
 	}
 
@@ -343,16 +354,19 @@ const struct shell_static_entry *z_shell_find_cmd(
 	struct shell_static_entry parent_cpy;
 	size_t idx = 0;
 
+	/* Root commands are sorted, no need to iterate over all of them. */
+	if (parent == NULL) {
+		return root_cmd_find(cmd_str);
+	}
+
 	/* Dynamic command operates on shared memory. If we are processing two
 	 * dynamic commands at the same time (current and subcommand) they
 	 * will operate on the same memory region what can cause undefined
 	 * behaviour.
 	 * Hence we need a separate memory for each of them.
 	 */
-	if (parent) {
-		memcpy(&parent_cpy, parent, sizeof(struct shell_static_entry));
-		parent = &parent_cpy;
-	}
+	memcpy(&parent_cpy, parent, sizeof(struct shell_static_entry));
+	parent = &parent_cpy;
 
 	while ((entry = z_shell_cmd_get(parent, idx++, dloc)) != NULL) {
 		if (strcmp(cmd_str, entry->syntax) == 0) {
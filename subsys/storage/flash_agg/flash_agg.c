@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define LOG_MODULE_NAME FLASH_AGG
+#define LOG_LEVEL CONFIG_FLASH_AGG_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(LOG_MODULE_NAME, CONFIG_FLASH_AGG_LOG_LEVEL);
+
+#include <string.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/storage/flash_agg.h>
+
+int flash_agg_init(struct flash_agg_ctx *ctx, const struct device *fdev,
+		   uint8_t *buf, size_t buf_len)
+{
+	const struct flash_parameters *params;
+
+	if (!ctx || !fdev || !buf) {
+		return -EFAULT;
+	}
+
+	params = flash_get_parameters(fdev);
+
+	if (buf_len == 0 || buf_len % params->write_block_size) {
+		LOG_ERR("Buffer size is not aligned to minimal write-block-size");
+		return -EFAULT;
+	}
+
+	ctx->fdev = fdev;
+	ctx->buf = buf;
+	ctx->buf_len = buf_len;
+	ctx->page_start = -1;
+	ctx->dirty_start = buf_len;
+	ctx->dirty_end = 0U;
+	ctx->write_block_size = params->write_block_size;
+	ctx->erase_value = params->erase_value;
+
+	return 0;
+}
+
+int flash_agg_flush(struct flash_agg_ctx *ctx)
+{
+	size_t start;
+	size_t end;
+	int rc;
+
+	if (!ctx) {
+		return -EFAULT;
+	}
+
+	if (ctx->page_start < 0 || ctx->dirty_end <= ctx->dirty_start) {
+		return 0;
+	}
+
+	/* Padding bytes within the aligned range hold the erase value and
+	 * leave erased flash untouched.
+	 */
+	start = ROUND_DOWN(ctx->dirty_start, ctx->write_block_size);
+	end = ROUND_UP(ctx->dirty_end, ctx->write_block_size);
+
+	rc = flash_write(ctx->fdev, ctx->page_start + start, &ctx->buf[start],
+			 end - start);
+	if (rc != 0) {
+		LOG_ERR("flash_write error %d offset=0x%08lx", rc,
+			(long)(ctx->page_start + start));
+		return rc;
+	}
+
+	ctx->page_start = -1;
+	ctx->dirty_start = ctx->buf_len;
+	ctx->dirty_end = 0U;
+
+	return 0;
+}
+
+int flash_agg_write(struct flash_agg_ctx *ctx, off_t offset,
+		    const void *data, size_t len)
+{
+	const uint8_t *pos = data;
+	int rc;
+
+	if (!ctx || !data) {
+		return -EFAULT;
+	}
+
+	while (len > 0) {
+		off_t page_start = offset - (offset % ctx->buf_len);
+		size_t in_page = offset - page_start;
+		size_t chunk = MIN(len, ctx->buf_len - in_page);
+
+		if (ctx->page_start != page_start) {
+			rc = flash_agg_flush(ctx);
+			if (rc != 0) {
+				return rc;
+			}
+
+			ctx->page_start = page_start;
+
+			/* Bytes between separate writes to the same page are
+			 * programmed along with them, so they must hold the
+			 * erase value.
+			 */
+			memset(ctx->buf, ctx->erase_value, ctx->buf_len);
+		}
+
+		memcpy(&ctx->buf[in_page], pos, chunk);
+		ctx->dirty_start = MIN(ctx->dirty_start, in_page);
+		ctx->dirty_end = MAX(ctx->dirty_end, in_page + chunk);
+
+		/* Fully written page, no point in keeping it buffered */
+		if (ctx->dirty_start == 0 && ctx->dirty_end == ctx->buf_len) {
+			rc = flash_agg_flush(ctx);
+			if (rc != 0) {
+				return rc;
+			}
+		}
+
+		pos += chunk;
+		offset += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
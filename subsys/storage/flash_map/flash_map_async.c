@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/types.h>
+#include <stddef.h>
+#include <sys/types.h>
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/storage/flash_map.h>
+#include "flash_map_priv.h"
+
+K_THREAD_STACK_DEFINE(flash_area_work_queue_stack, CONFIG_FLASH_MAP_ASYNC_STACK_SIZE);
+
+static struct k_work_q flash_area_work_queue;
+
+static const struct k_work_queue_config flash_area_work_queue_config = {
+	.name = "flash_map_async",
+};
+
+static void flash_area_async_work_handler(struct k_work *work)
+{
+	struct flash_area_async_op *op =
+		CONTAINER_OF(work, struct flash_area_async_op, work);
+	int result;
+
+	if (op->src != NULL) {
+		result = flash_area_write(op->fa, op->off, op->src, op->len);
+	} else {
+		result = flash_area_erase(op->fa, op->off, op->len);
+	}
+
+	op->cb(op->fa, result, op->user_data);
+}
+
+static int flash_area_async_submit(const struct flash_area *fa, off_t off,
+				   const void *src, size_t len,
+				   struct flash_area_async_op *op,
+				   flash_area_async_cb_t cb, void *user_data)
+{
+	int rc;
+
+	if (cb == NULL || !is_in_flash_area_bounds(fa, off, len)) {
+		return -EINVAL;
+	}
+
+	op->fa = fa;
+	op->off = off;
+	op->len = len;
+	op->src = src;
+	op->cb = cb;
+	op->user_data = user_data;
+	k_work_init(&op->work, flash_area_async_work_handler);
+
+	rc = k_work_submit_to_queue(&flash_area_work_queue, &op->work);
+	if (rc < 0) {
+		return rc;
+	}
+
+	return 0;
+}
+
+int flash_area_write_async(const struct flash_area *fa, off_t off, const void *src,
+			   size_t len, struct flash_area_async_op *op,
+			   flash_area_async_cb_t cb, void *user_data)
+{
+	if (src == NULL) {
+		return -EINVAL;
+	}
+
+	return flash_area_async_submit(fa, off, src, len, op, cb, user_data);
+}
+
+int flash_area_erase_async(const struct flash_area *fa, off_t off, size_t len,
+			   struct flash_area_async_op *op,
+			   flash_area_async_cb_t cb, void *user_data)
+{
+	return flash_area_async_submit(fa, off, NULL, len, op, cb, user_data);
+}
+
+static int flash_area_async_init(void)
+{
+	k_work_queue_init(&flash_area_work_queue);
+
+	k_work_queue_start(&flash_area_work_queue, flash_area_work_queue_stack,
+			   K_THREAD_STACK_SIZEOF(flash_area_work_queue_stack),
+			   CONFIG_FLASH_MAP_ASYNC_THREAD_PRIO,
+			   &flash_area_work_queue_config);
+
+	return 0;
+}
+
+SYS_INIT(flash_area_async_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
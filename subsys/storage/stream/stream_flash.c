@@ -184,6 +184,88 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 
 #endif /* CONFIG_STREAM_FLASH_ERASE */
 
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+
+static void pipeline_work_handler(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx =
+		CONTAINER_OF(work, struct stream_flash_ctx, pipe_work);
+	int rc;
+
+	rc = flash_write(ctx->fdev, ctx->pipe_addr, ctx->pipe_buf, ctx->pipe_len);
+	if (rc != 0) {
+		LOG_ERR("flash_write error %d offset=0x%08zx", rc, ctx->pipe_addr);
+	}
+
+#if defined(CONFIG_STREAM_FLASH_POST_WRITE_CALLBACK)
+	if (rc == 0 && ctx->callback) {
+		/* Invert to ensure that caller is able to discover a faulty
+		 * flash_read() even if no error code is returned.
+		 */
+		for (int i = 0; i < ctx->pipe_buf_bytes; i++) {
+			ctx->pipe_buf[i] = ~ctx->pipe_buf[i];
+		}
+
+		rc = flash_read(ctx->fdev, ctx->pipe_addr, ctx->pipe_buf,
+				ctx->pipe_buf_bytes);
+		if (rc != 0) {
+			LOG_ERR("flash read failed: %d", rc);
+		} else {
+			rc = ctx->callback(ctx->pipe_buf, ctx->pipe_buf_bytes,
+					   ctx->pipe_addr);
+			if (rc != 0) {
+				LOG_ERR("callback failed: %d", rc);
+			}
+		}
+	}
+#endif
+
+	ctx->pipe_rc = rc;
+	k_sem_give(&ctx->pipe_sem);
+}
+
+/* Wait for a submitted write, if any, and collect its result. */
+static int pipeline_drain(struct stream_flash_ctx *ctx)
+{
+	if (!ctx->pipe_active) {
+		return 0;
+	}
+
+	k_sem_take(&ctx->pipe_sem, K_FOREVER);
+	ctx->pipe_active = false;
+
+	return ctx->pipe_rc;
+}
+
+int stream_flash_pipeline_init(struct stream_flash_ctx *ctx, uint8_t *buf)
+{
+	if (!ctx || !buf) {
+		return -EFAULT;
+	}
+
+	if (ctx->bytes_written != 0 || ctx->buf_bytes != 0) {
+		LOG_ERR("Pipelining must be enabled before writing data");
+		return -EFAULT;
+	}
+
+	ctx->alt_buf = buf;
+	ctx->pipe_active = false;
+	k_work_init(&ctx->pipe_work, pipeline_work_handler);
+	k_sem_init(&ctx->pipe_sem, 0, 1);
+
+	return 0;
+}
+
+#else
+
+static inline int pipeline_drain(struct stream_flash_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+	return 0;
+}
+
+#endif /* CONFIG_STREAM_FLASH_PIPELINE */
+
 static int flash_sync(struct stream_flash_ctx *ctx)
 {
 	int rc = 0;
@@ -197,6 +279,15 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		return 0;
 	}
 
+	/* The in-flight write must complete before erasing or submitting more
+	 * data, as flash drivers are not required to serialize concurrent
+	 * operations.
+	 */
+	rc = pipeline_drain(ctx);
+	if (rc != 0) {
+		return rc;
+	}
+
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
 
 		rc = stream_flash_erase_to_append(ctx, ctx->buf_bytes);
@@ -218,6 +309,29 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	}
 
 	buf_bytes_aligned = ctx->buf_bytes + fill_length;
+
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	if (ctx->alt_buf != NULL) {
+		/* Hand the full buffer to the work queue and keep filling the
+		 * other one; the result is collected by the next drain.
+		 */
+		ctx->pipe_buf = ctx->buf;
+		ctx->pipe_len = buf_bytes_aligned;
+		ctx->pipe_buf_bytes = ctx->buf_bytes;
+		ctx->pipe_addr = write_addr;
+		ctx->buf = ctx->alt_buf;
+		ctx->alt_buf = ctx->pipe_buf;
+
+		ctx->bytes_written += ctx->buf_bytes;
+		ctx->buf_bytes = 0U;
+
+		ctx->pipe_active = true;
+		k_work_submit(&ctx->pipe_work);
+
+		return 0;
+	}
+#endif /* CONFIG_STREAM_FLASH_PIPELINE */
+
 	rc = flash_write(ctx->fdev, write_addr, ctx->buf, buf_bytes_aligned);
 
 	if (rc != 0) {
@@ -299,6 +413,11 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		rc = flash_sync(ctx);
 	}
 
+	if (flush && rc == 0) {
+		/* Concluding the stream: all data must be on the device */
+		rc = pipeline_drain(ctx);
+	}
+
 	return rc;
 }
 
@@ -405,6 +524,10 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	ctx->erased_up_to = 0;
+#endif
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	ctx->alt_buf = NULL;
+	ctx->pipe_active = false;
 #endif
 	ctx->erase_value = params->erase_value;
 
@@ -118,6 +118,23 @@ static void task_wdt_trigger(struct k_timer *timer_id)
 		return;
 	}
 
+#ifdef CONFIG_TASK_WDT_DEFERRED_RESCHEDULE
+	/*
+	 * With deferred rescheduling the timer is not pushed out on every
+	 * feed, so it regularly fires for channels that are still healthy.
+	 * Only expire the channel if its deadline has actually passed.
+	 */
+	k_spinlock_key_t key = k_spin_lock(&channels_lock);
+	int64_t current_ticks = sys_clock_tick_get();
+
+	if (channels[channel_id].timeout_abs_ticks > current_ticks) {
+		schedule_next_timeout(current_ticks);
+		k_spin_unlock(&channels_lock, key);
+		return;
+	}
+	k_spin_unlock(&channels_lock, key);
+#endif /* CONFIG_TASK_WDT_DEFERRED_RESCHEDULE */
+
 	if (channels[channel_id].callback) {
 		channels[channel_id].callback(channel_id,
 			channels[channel_id].user_data);
@@ -192,8 +209,21 @@ int task_wdt_add(uint32_t reload_period, task_wdt_callback_t callback,
 				hw_wdt_started = true;
 			}
 #endif
+#ifdef CONFIG_TASK_WDT_DEFERRED_RESCHEDULE
+			/*
+			 * Feed the channel and arm the timer directly, as
+			 * task_wdt_feed() would deadlock on channels_lock.
+			 * Must happen after the hw wdt has been started.
+			 */
+			int64_t current_ticks = sys_clock_tick_get();
+
+			channels[id].timeout_abs_ticks = current_ticks +
+				k_ms_to_ticks_ceil64(reload_period);
+			schedule_next_timeout(current_ticks);
+#else
 			/* must be called after hw wdt has been started */
 			task_wdt_feed(id);
+#endif /* CONFIG_TASK_WDT_DEFERRED_RESCHEDULE */
 
 			k_spin_unlock(&channels_lock, key);
 
@@ -231,6 +261,23 @@ int task_wdt_feed(int channel_id)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_TASK_WDT_DEFERRED_RESCHEDULE
+	/*
+	 * Only move the deadline of this channel. The timer keeps firing at
+	 * the deadline it was armed with; task_wdt_trigger() notices that
+	 * the deadline has moved and rearms the timer instead of expiring
+	 * the channel. The spinlock only guards the 64-bit deadline store
+	 * against torn reads from the timer callback, so the critical
+	 * section is constant time regardless of the number of channels.
+	 */
+	k_spinlock_key_t key = k_spin_lock(&channels_lock);
+
+	current_ticks = sys_clock_tick_get();
+	channels[channel_id].timeout_abs_ticks = current_ticks +
+		k_ms_to_ticks_ceil64(channels[channel_id].reload_period);
+
+	k_spin_unlock(&channels_lock, key);
+#else
 	/*
 	 * We need a critical section instead of a mutex while updating the
 	 * channels array in order to prevent priority inversion. Otherwise,
@@ -248,6 +295,7 @@ int task_wdt_feed(int channel_id)
 	schedule_next_timeout(current_ticks);
 
 	k_sched_unlock();
+#endif /* CONFIG_TASK_WDT_DEFERRED_RESCHEDULE */
 
 	return 0;
 }
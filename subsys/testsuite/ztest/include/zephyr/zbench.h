@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Zephyr testing framework microbenchmark macros
+ */
+
+#ifndef TESTSUITE_ZTEST_INCLUDE_ZBENCH_H__
+#define TESTSUITE_ZTEST_INCLUDE_ZBENCH_H__
+
+#include <zephyr/sys/util.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup ztest_zbench Ztest microbenchmark macros
+ * @ingroup ztest
+ *
+ * This module provides repeatable on-target microbenchmarks when using
+ * Ztest. Each benchmark body is first warmed up, then the number of
+ * iterations per sample is calibrated so that one sample runs long
+ * enough for the cycle counter resolution not to matter, and finally a
+ * configurable number of samples is collected. Outlier samples are
+ * rejected based on their distance from the median and the result is
+ * reported as median and median absolute deviation (MAD) of the cycle
+ * cost per iteration.
+ *
+ * The results are emitted on the console using a single line per
+ * benchmark in a fixed format, so twister's console harness can capture
+ * them into the build recording with a "record" regex, e.g.:
+ *
+ *     harness: console
+ *     harness_config:
+ *       type: multi_line
+ *       regex:
+ *         - "zbench: all benchmarks completed"
+ *       record:
+ *         regex: "zbench: (?P<name>[a-z0-9_]+): median=(?P<median>[0-9]+) .*"
+ *
+ * @{
+ */
+
+/** @brief Statistics collected for one benchmark.
+ *
+ * All cycle values are counted in hardware cycles (see k_cycle_get_32())
+ * per benchmark iteration.
+ */
+struct zbench_stats {
+	/** Median cycle cost of one iteration */
+	uint64_t median;
+	/** Median absolute deviation of the cycle cost of one iteration */
+	uint64_t mad;
+	/** Smallest observed cycle cost of one iteration */
+	uint64_t min;
+	/** Largest observed cycle cost of one iteration */
+	uint64_t max;
+	/** Calibrated number of iterations executed per sample */
+	uint32_t iterations;
+	/** Number of samples remaining after outlier rejection */
+	uint32_t samples;
+	/** Number of samples rejected as outliers */
+	uint32_t rejected;
+};
+
+/** @brief Benchmark body function.
+ *
+ * The body must execute the measured operation @p iterations times,
+ * typically in a simple for loop, so that the loop overhead and not a
+ * function call per operation is included in the measurement.
+ *
+ * @param iterations Number of times to execute the measured operation.
+ */
+typedef void (*zbench_fn_t)(uint32_t iterations);
+
+/** @cond INTERNAL_HIDDEN */
+struct zbench_benchmark {
+	const char *name;
+	zbench_fn_t body;
+};
+/** @endcond */
+
+/**
+ * @brief Define a benchmark case.
+ *
+ * The benchmark is placed in an iterable section, similar to ZTEST(),
+ * and is picked up by zbench_run_all(). The macro is followed by the
+ * benchmark body which receives the iteration count to execute:
+ *
+ * @code
+ * ZBENCH(sem_give_take)
+ * {
+ *	for (uint32_t i = 0; i < iterations; i++) {
+ *		k_sem_give(&sem);
+ *		k_sem_take(&sem, K_NO_WAIT);
+ *	}
+ * }
+ * @endcode
+ *
+ * @param bench_name Benchmark name, also used in the reported record.
+ */
+#define ZBENCH(bench_name)                                                           \
+	static void zbench_body_##bench_name(uint32_t iterations);                   \
+	static const STRUCT_SECTION_ITERABLE(zbench_benchmark,                       \
+					     zbench_##bench_name) = {                \
+		.name = STRINGIFY(bench_name),                                       \
+		.body = zbench_body_##bench_name,                                    \
+	};                                                                           \
+	static void zbench_body_##bench_name(uint32_t iterations)
+
+/**
+ * @brief Run a single benchmark and collect its statistics.
+ *
+ * This performs the warm-up, iteration count calibration, sampling and
+ * outlier rejection for the given benchmark. It can be used directly
+ * from a ZTEST() case when the test wants to assert on the result,
+ * for example to fail on a known performance regression threshold.
+ *
+ * @param bench Benchmark to run.
+ * @param stats Location where the collected statistics are stored.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if too many samples were rejected to compute statistics.
+ */
+int zbench_run(const struct zbench_benchmark *bench, struct zbench_stats *stats);
+
+/**
+ * @brief Run all defined benchmarks and report their results.
+ *
+ * Every benchmark defined with ZBENCH() is run in turn and one result
+ * record line is printed per benchmark, followed by a final
+ * "zbench: all benchmarks completed" line.
+ */
+void zbench_run_all(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTSUITE_ZTEST_INCLUDE_ZBENCH_H__ */
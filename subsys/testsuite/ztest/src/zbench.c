@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/zbench.h>
+#include <zephyr/sys/printk.h>
+#include <string.h>
+
+/* Iteration count calibration gives up doubling at this point to keep
+ * one sample bounded even for extremely cheap benchmark bodies.
+ */
+#define MAX_ITERATIONS (UINT32_MAX / 2)
+
+static uint64_t cycles_now(void)
+{
+	if (IS_ENABLED(CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER)) {
+		return k_cycle_get_64();
+	}
+
+	return k_cycle_get_32();
+}
+
+static uint64_t measure(const struct zbench_benchmark *bench, uint32_t iterations)
+{
+	uint64_t start, end;
+
+	start = cycles_now();
+	bench->body(iterations);
+	end = cycles_now();
+
+	if (IS_ENABLED(CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER)) {
+		return end - start;
+	}
+
+	/* 32-bit counter may have wrapped during the sample */
+	return (uint32_t)(end - start);
+}
+
+/* Sort the values and return their median. Sample counts are small so
+ * insertion sort is good enough.
+ */
+static uint64_t sorted_median(uint64_t *values, uint32_t count)
+{
+	for (uint32_t i = 1; i < count; i++) {
+		uint64_t value = values[i];
+		uint32_t j = i;
+
+		while (j > 0 && values[j - 1] > value) {
+			values[j] = values[j - 1];
+			j--;
+		}
+
+		values[j] = value;
+	}
+
+	if ((count % 2) == 0) {
+		return (values[count / 2 - 1] + values[count / 2]) / 2;
+	}
+
+	return values[count / 2];
+}
+
+static uint64_t deviation(uint64_t value, uint64_t median)
+{
+	return (value > median) ? (value - median) : (median - value);
+}
+
+/* Double the iteration count until one sample runs long enough that
+ * the cycle counter resolution no longer matters.
+ */
+static uint32_t calibrate(const struct zbench_benchmark *bench)
+{
+	uint64_t target = (uint64_t)sys_clock_hw_cycles_per_sec() *
+			  CONFIG_ZBENCH_SAMPLE_TIME_US / USEC_PER_SEC;
+	uint32_t iterations = 1;
+
+	while (measure(bench, iterations) < target && iterations < MAX_ITERATIONS) {
+		iterations *= 2;
+	}
+
+	return iterations;
+}
+
+int zbench_run(const struct zbench_benchmark *bench, struct zbench_stats *stats)
+{
+	uint64_t samples[CONFIG_ZBENCH_SAMPLES];
+	uint64_t deviations[CONFIG_ZBENCH_SAMPLES];
+	uint64_t median, mad, limit;
+	uint32_t iterations;
+	uint32_t count = 0;
+
+	memset(stats, 0, sizeof(*stats));
+
+	bench->body(CONFIG_ZBENCH_WARMUP_ITERATIONS);
+
+	iterations = calibrate(bench);
+
+	for (uint32_t i = 0; i < ARRAY_SIZE(samples); i++) {
+		samples[i] = measure(bench, iterations) / iterations;
+	}
+
+	median = sorted_median(samples, ARRAY_SIZE(samples));
+
+	for (uint32_t i = 0; i < ARRAY_SIZE(samples); i++) {
+		deviations[i] = deviation(samples[i], median);
+	}
+
+	mad = sorted_median(deviations, ARRAY_SIZE(deviations));
+
+	/* Reject samples too far from the median. With a zero MAD, i.e.
+	 * at least half of the samples hitting the median exactly, any
+	 * deviating sample further than the limit alone is an outlier.
+	 */
+	limit = MAX(mad, 1) * CONFIG_ZBENCH_OUTLIER_MAD_LIMIT;
+
+	for (uint32_t i = 0; i < ARRAY_SIZE(samples); i++) {
+		if (deviation(samples[i], median) <= limit) {
+			samples[count++] = samples[i];
+		}
+	}
+
+	if (count < 3) {
+		return -EINVAL;
+	}
+
+	/* The accepted samples are still sorted after the compaction */
+	stats->min = samples[0];
+	stats->max = samples[count - 1];
+	stats->median = sorted_median(samples, count);
+
+	for (uint32_t i = 0; i < count; i++) {
+		deviations[i] = deviation(samples[i], stats->median);
+	}
+
+	stats->mad = sorted_median(deviations, count);
+	stats->iterations = iterations;
+	stats->samples = count;
+	stats->rejected = ARRAY_SIZE(samples) - count;
+
+	return 0;
+}
+
+void zbench_run_all(void)
+{
+	struct zbench_stats stats;
+	int ret;
+
+	STRUCT_SECTION_FOREACH(zbench_benchmark, bench) {
+		ret = zbench_run(bench, &stats);
+		if (ret < 0) {
+			printk("zbench: %s: failed (%d)\n", bench->name, ret);
+			continue;
+		}
+
+		printk("zbench: %s: median=%llu mad=%llu min=%llu max=%llu "
+		       "cycles/op (iterations=%u samples=%u rejected=%u)\n",
+		       bench->name, stats.median, stats.mad, stats.min,
+		       stats.max, stats.iterations, stats.samples,
+		       stats.rejected);
+	}
+
+	printk("zbench: all benchmarks completed\n");
+}
@@ -241,6 +241,8 @@ extern "C" {
 #define sys_port_trace_k_lifo_put_exit(lifo, data)
 #define sys_port_trace_k_lifo_alloc_put_enter(lifo, data)
 #define sys_port_trace_k_lifo_alloc_put_exit(lifo, data, ret)
+#define sys_port_trace_k_lifo_put_list_enter(lifo, head, tail)
+#define sys_port_trace_k_lifo_put_list_exit(lifo, head, tail)
 #define sys_port_trace_k_lifo_get_enter(lifo, timeout)
 #define sys_port_trace_k_lifo_get_exit(lifo, timeout, ret)
 
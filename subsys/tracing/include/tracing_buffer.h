@@ -104,6 +104,19 @@ int tracing_buffer_get_finish(uint32_t size);
  */
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size);
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+/**
+ * @brief Get the CPU whose buffer the consumer side is draining.
+ *
+ * The returned CPU owns the data claimed by the most recent
+ * tracing_buffer_get_claim() and stays valid until the matching
+ * tracing_buffer_get_finish().
+ *
+ * @return CPU number of the buffer being drained.
+ */
+uint8_t tracing_buffer_get_cpu(void);
+#endif
+
 /**
  * @brief Get buffer from tracing command buffer.
  *
@@ -489,6 +489,13 @@ void sys_trace_thread_info(struct k_thread *thread);
 #define sys_port_trace_k_lifo_alloc_put_exit(lifo, data, ret)                                      \
 	SEGGER_SYSVIEW_RecordEndCall(TID_LIFO_ALLOC_PUT)
 
+#define sys_port_trace_k_lifo_put_list_enter(lifo, head, tail)                                     \
+	SEGGER_SYSVIEW_RecordU32x3(TID_LIFO_PUT_LIST, (uint32_t)(uintptr_t)lifo,                   \
+				   (uint32_t)(uintptr_t)head, (uint32_t)(uintptr_t)tail)
+
+#define sys_port_trace_k_lifo_put_list_exit(lifo, head, tail)                                      \
+	SEGGER_SYSVIEW_RecordEndCall(TID_LIFO_PUT_LIST)
+
 #define sys_port_trace_k_lifo_get_enter(lifo, timeout)                                             \
 	SEGGER_SYSVIEW_RecordU32x2(TID_LIFO_GET, (uint32_t)(uintptr_t)lifo, (uint32_t)timeout.ticks)
 #define sys_port_trace_k_lifo_get_exit(lifo, timeout, ret)                                         \
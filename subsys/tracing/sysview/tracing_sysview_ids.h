@@ -158,6 +158,8 @@ extern "C" {
 
 #define TID_NAMED_EVENT (131u + TID_OFFSET)
 
+#define TID_LIFO_PUT_LIST (132u + TID_OFFSET)
+
 /* latest ID is 130 */
 
 #ifdef __cplusplus
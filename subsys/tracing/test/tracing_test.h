@@ -262,6 +262,12 @@
 #define sys_port_trace_k_lifo_alloc_put_exit(lifo, data, ret)                                      \
 	sys_trace_k_lifo_alloc_put_exit(lifo, data, ret)
 
+#define sys_port_trace_k_lifo_put_list_enter(lifo, head, tail)                                     \
+	sys_trace_k_lifo_put_list_enter(lifo, head, tail)
+
+#define sys_port_trace_k_lifo_put_list_exit(lifo, head, tail)                                      \
+	sys_trace_k_lifo_put_list_exit(lifo, head, tail)
+
 #define sys_port_trace_k_lifo_get_enter(lifo, timeout) sys_trace_k_lifo_get_enter(lifo, timeout)
 
 #define sys_port_trace_k_lifo_get_exit(lifo, timeout, ret)                                         \
@@ -604,6 +610,8 @@ void sys_trace_k_lifo_put_enter(struct k_lifo *lifo, void *data);
 void sys_trace_k_lifo_put_exit(struct k_lifo *lifo, void *data);
 void sys_trace_k_lifo_alloc_put_enter(struct k_lifo *lifo, void *data);
 void sys_trace_k_lifo_alloc_put_exit(struct k_lifo *lifo, void *data, int ret);
+void sys_trace_k_lifo_put_list_enter(struct k_lifo *lifo, void *head, void *tail);
+void sys_trace_k_lifo_put_list_exit(struct k_lifo *lifo, void *head, void *tail);
 void sys_trace_k_lifo_get_enter(struct k_lifo *lifo, k_timeout_t timeout);
 void sys_trace_k_lifo_get_exit(struct k_lifo *lifo, k_timeout_t timeout, void *ret);
 
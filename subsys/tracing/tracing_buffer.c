@@ -4,12 +4,69 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+/* Disable syscall tracing for all calls from this compilation unit to avoid
+ * undefined symbols as the macros are not expanded recursively
+ */
+#define DISABLE_SYSCALL_TRACING
+
+#include <zephyr/kernel.h>
 #include <zephyr/sys/ring_buffer.h>
 
-static struct ring_buf tracing_ring_buf;
-static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+#define TRACING_BUFFER_COUNT CONFIG_MP_MAX_NUM_CPUS
+#else
+#define TRACING_BUFFER_COUNT 1
+#endif
+
+static struct ring_buf tracing_ring_buf[TRACING_BUFFER_COUNT];
+static uint8_t tracing_buffer[TRACING_BUFFER_COUNT][CONFIG_TRACING_BUFFER_SIZE + 1];
 static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+/* CPU whose ring buffer the consumer side is currently draining */
+static uint8_t tracing_consumer_cpu;
+
+static struct ring_buf *tracing_producer_buf_get(void)
+{
+	return &tracing_ring_buf[arch_curr_cpu()->id];
+}
+
+/*
+ * Stick to the current CPU until its ring buffer is drained so that
+ * claimed data stays valid until tracing_buffer_get_finish(), then
+ * move on to the next CPU with pending data.
+ */
+static struct ring_buf *tracing_consumer_buf_get(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (!ring_buf_is_empty(&tracing_ring_buf[tracing_consumer_cpu])) {
+			break;
+		}
+
+		tracing_consumer_cpu = (tracing_consumer_cpu + 1) % num_cpus;
+	}
+
+	return &tracing_ring_buf[tracing_consumer_cpu];
+}
+
+uint8_t tracing_buffer_get_cpu(void)
+{
+	return tracing_consumer_cpu;
+}
+#else
+static struct ring_buf *tracing_producer_buf_get(void)
+{
+	return &tracing_ring_buf[0];
+}
+
+static struct ring_buf *tracing_consumer_buf_get(void)
+{
+	return &tracing_ring_buf[0];
+}
+#endif
+
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 {
 	*data = &tracing_cmd_buffer[0];
@@ -19,51 +76,59 @@ uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 
 uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_put_claim(&tracing_ring_buf, data, size);
+	return ring_buf_put_claim(tracing_producer_buf_get(), data, size);
 }
 
 int tracing_buffer_put_finish(uint32_t size)
 {
-	return ring_buf_put_finish(&tracing_ring_buf, size);
+	return ring_buf_put_finish(tracing_producer_buf_get(), size);
 }
 
 uint32_t tracing_buffer_put(uint8_t *data, uint32_t size)
 {
-	return ring_buf_put(&tracing_ring_buf, data, size);
+	return ring_buf_put(tracing_producer_buf_get(), data, size);
 }
 
 uint32_t tracing_buffer_get_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_get_claim(&tracing_ring_buf, data, size);
+	return ring_buf_get_claim(tracing_consumer_buf_get(), data, size);
 }
 
 int tracing_buffer_get_finish(uint32_t size)
 {
-	return ring_buf_get_finish(&tracing_ring_buf, size);
+	return ring_buf_get_finish(tracing_consumer_buf_get(), size);
 }
 
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size)
 {
-	return ring_buf_get(&tracing_ring_buf, data, size);
+	return ring_buf_get(tracing_consumer_buf_get(), data, size);
 }
 
 void tracing_buffer_init(void)
 {
-	ring_buf_init(&tracing_ring_buf,
-		      sizeof(tracing_buffer), tracing_buffer);
+	for (int i = 0; i < TRACING_BUFFER_COUNT; i++) {
+		ring_buf_init(&tracing_ring_buf[i],
+			      sizeof(tracing_buffer[i]), tracing_buffer[i]);
+	}
 }
 
 bool tracing_buffer_is_empty(void)
 {
-	return ring_buf_is_empty(&tracing_ring_buf);
+	for (int i = 0; i < TRACING_BUFFER_COUNT; i++) {
+		if (!ring_buf_is_empty(&tracing_ring_buf[i])) {
+			return false;
+		}
+	}
+
+	return true;
 }
 
 uint32_t tracing_buffer_capacity_get(void)
 {
-	return ring_buf_capacity_get(&tracing_ring_buf);
+	return ring_buf_capacity_get(&tracing_ring_buf[0]);
 }
 
 uint32_t tracing_buffer_space_get(void)
 {
-	return ring_buf_space_get(&tracing_ring_buf);
+	return ring_buf_space_get(tracing_producer_buf_get());
 }
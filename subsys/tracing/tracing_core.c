@@ -21,6 +21,10 @@
 #define TRACING_CMD_ENABLE  "enable"
 #define TRACING_CMD_DISABLE "disable"
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+#define TRACING_CHUNK_HDR_MARKER 0xC5
+#endif
+
 #ifdef CONFIG_TRACING_BACKEND_UART
 #define TRACING_BACKEND_NAME "tracing_backend_uart"
 #elif defined CONFIG_TRACING_BACKEND_USB
@@ -58,11 +62,19 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 {
 	uint8_t *transferring_buf;
 	uint32_t transferring_length, tracing_buffer_max_length;
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+	uint8_t chunk_hdr[4] = {TRACING_CHUNK_HDR_MARKER, 0, 0, 0};
+#endif
 
 	tracing_thread_tid = k_current_get();
 
 	tracing_buffer_max_length = tracing_buffer_capacity_get();
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+	/* Chunk length has to fit in the 16-bit header field */
+	tracing_buffer_max_length = MIN(tracing_buffer_max_length, UINT16_MAX);
+#endif
+
 	while (true) {
 		if (tracing_buffer_is_empty()) {
 			k_sem_take(&tracing_thread_sem, K_FOREVER);
@@ -71,6 +83,12 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 				tracing_buffer_get_claim(
 						&transferring_buf,
 						tracing_buffer_max_length);
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+			chunk_hdr[1] = tracing_buffer_get_cpu();
+			chunk_hdr[2] = transferring_length & 0xff;
+			chunk_hdr[3] = (transferring_length >> 8) & 0xff;
+			tracing_buffer_handle(chunk_hdr, sizeof(chunk_hdr));
+#endif
 			tracing_buffer_handle(transferring_buf,
 					      transferring_length);
 			tracing_buffer_get_finish(transferring_length);
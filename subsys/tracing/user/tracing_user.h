@@ -282,6 +282,8 @@ void sys_trace_gpio_fire_callback_user(const struct device *port, struct gpio_ca
 #define sys_port_trace_k_lifo_put_exit(lifo, data)
 #define sys_port_trace_k_lifo_alloc_put_enter(lifo, data)
 #define sys_port_trace_k_lifo_alloc_put_exit(lifo, data, ret)
+#define sys_port_trace_k_lifo_put_list_enter(lifo, head, tail)
+#define sys_port_trace_k_lifo_put_list_exit(lifo, head, tail)
 #define sys_port_trace_k_lifo_get_enter(lifo, timeout)
 #define sys_port_trace_k_lifo_get_exit(lifo, timeout, ret)
 
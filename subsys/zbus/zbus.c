@@ -148,6 +148,13 @@ static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 	}
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
+#if defined(CONFIG_ZBUS_EVENT_SUBSCRIBER)
+	case ZBUS_OBSERVER_EVENT_SUBSCRIBER_TYPE: {
+		k_event_post(obs->event, obs->event_mask);
+		break;
+	}
+#endif /* CONFIG_ZBUS_EVENT_SUBSCRIBER */
+
 	default:
 		_ZBUS_ASSERT(false, "Unreachable");
 	}
@@ -374,6 +381,35 @@ static inline void chan_unlock(const struct zbus_channel *chan, int prio)
 #endif /* CONFIG_ZBUS_PRIORITY_BOOST */
 }
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+
+/* Sequence counter write side. The caller must hold the channel semaphore. The counter is odd
+ * while the message is being updated, which makes concurrent lock-free readers retry.
+ */
+static inline void chan_seq_write_begin(const struct zbus_channel *chan)
+{
+	atomic_inc(&chan->data->seq);
+}
+
+static inline void chan_seq_write_end(const struct zbus_channel *chan)
+{
+	atomic_inc(&chan->data->seq);
+}
+
+#else
+
+static inline void chan_seq_write_begin(const struct zbus_channel *chan)
+{
+	ARG_UNUSED(chan);
+}
+
+static inline void chan_seq_write_end(const struct zbus_channel *chan)
+{
+	ARG_UNUSED(chan);
+}
+
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t timeout)
 {
 	int err;
@@ -405,8 +441,12 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 	chan->data->publish_count += 1;
 #endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
 
+	chan_seq_write_begin(chan);
+
 	memcpy(chan->message, msg, chan->message_size);
 
+	chan_seq_write_end(chan);
+
 	err = _zbus_vded_exec(chan, end_time);
 
 	chan_unlock(chan, context_priority);
@@ -425,6 +465,26 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 		timeout = K_NO_WAIT;
 	}
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+	for (int i = 0; i < CONFIG_ZBUS_CHANNEL_SEQLOCK_READ_RETRIES; ++i) {
+		atomic_val_t seq = atomic_get(&chan->data->seq);
+
+		if (seq & 1) {
+			/* A write is in progress, the snapshot would be torn */
+			continue;
+		}
+
+		memcpy(msg, chan->message, chan->message_size);
+
+		if (atomic_get(&chan->data->seq) == seq) {
+			return 0;
+		}
+	}
+	/* Writers kept interfering with the snapshot. Fall back to the semaphore so a reader
+	 * that preempted a writer mid-update cannot spin forever.
+	 */
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 	int err = k_sem_take(&chan->data->sem, timeout);
 	if (err) {
 		return err;
@@ -481,6 +541,11 @@ int zbus_chan_claim(const struct zbus_channel *chan, k_timeout_t timeout)
 		return err;
 	}
 
+	/* The claimer may change the message, so lock-free readers must retry until the channel
+	 * is finished.
+	 */
+	chan_seq_write_begin(chan);
+
 	return 0;
 }
 
@@ -488,6 +553,8 @@ int zbus_chan_finish(const struct zbus_channel *chan)
 {
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 
+	chan_seq_write_end(chan);
+
 	k_sem_give(&chan->data->sem);
 
 	return 0;
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * This file contains the log-linear histogram used to derive latency
+ * percentiles from the individual samples of the instrumented benchmarks.
+ */
+
+#include <zephyr/kernel.h>
+#include <string.h>
+
+#include "utils.h"
+#include "histogram.h"
+
+BENCH_BMEM struct latency_histogram bench_histogram;
+
+static uint32_t bucket_index(uint32_t value)
+{
+	uint32_t msb;
+
+	if (value < LATENCY_HISTOGRAM_SUB_BUCKETS) {
+		return value;
+	}
+
+	msb = find_msb_set(value) - 1;
+
+	return ((msb - LATENCY_HISTOGRAM_SUB_BITS + 1) << LATENCY_HISTOGRAM_SUB_BITS) +
+	       ((value >> (msb - LATENCY_HISTOGRAM_SUB_BITS)) &
+		(LATENCY_HISTOGRAM_SUB_BUCKETS - 1));
+}
+
+static uint32_t bucket_midpoint(uint32_t index)
+{
+	uint32_t group = index >> LATENCY_HISTOGRAM_SUB_BITS;
+	uint32_t sub = index & (LATENCY_HISTOGRAM_SUB_BUCKETS - 1);
+	uint32_t msb;
+	uint32_t width;
+
+	if (group == 0) {
+		return index;
+	}
+
+	msb = group + LATENCY_HISTOGRAM_SUB_BITS - 1;
+	width = BIT(msb - LATENCY_HISTOGRAM_SUB_BITS);
+
+	return BIT(msb) + (sub * width) + (width / 2);
+}
+
+void histogram_reset(struct latency_histogram *hist)
+{
+	memset(hist, 0, sizeof(*hist));
+	hist->min = UINT32_MAX;
+}
+
+void histogram_add(struct latency_histogram *hist, uint32_t cycles)
+{
+	hist->buckets[bucket_index(cycles)]++;
+	hist->count++;
+	hist->min = MIN(hist->min, cycles);
+	hist->max = MAX(hist->max, cycles);
+}
+
+static uint32_t histogram_percentile(struct latency_histogram *hist,
+				     uint32_t permille)
+{
+	uint64_t threshold = ((hist->count * permille) + 999ULL) / 1000ULL;
+	uint64_t seen = 0ULL;
+
+	for (uint32_t i = 0; i < LATENCY_HISTOGRAM_BUCKETS; i++) {
+		seen += hist->buckets[i];
+		if (seen >= threshold) {
+			return CLAMP(bucket_midpoint(i), hist->min, hist->max);
+		}
+	}
+
+	return hist->max;
+}
+
+void histogram_report(struct latency_histogram *hist, const char *tag)
+{
+	static const uint32_t permilles[] = {500, 900, 990, 999};
+	static const char *const names[] = {"p50", "p90", "p99", "p99.9"};
+	char metric[70];
+	char summary[120];
+
+	if (hist->count == 0ULL) {
+		return;
+	}
+
+	snprintf(metric, sizeof(metric), "%s.min", tag);
+	snprintf(summary, sizeof(summary), "%-40s - Latency minimum", metric);
+	PRINT_STATS(summary, hist->min, false, "");
+
+	for (size_t i = 0; i < ARRAY_SIZE(permilles); i++) {
+		snprintf(metric, sizeof(metric), "%s.%s", tag, names[i]);
+		snprintf(summary, sizeof(summary),
+			 "%-40s - Latency percentile", metric);
+		PRINT_STATS(summary, histogram_percentile(hist, permilles[i]),
+			    false, "");
+	}
+
+	snprintf(metric, sizeof(metric), "%s.max", tag);
+	snprintf(summary, sizeof(summary), "%-40s - Latency maximum", metric);
+	PRINT_STATS(summary, hist->max, false, "");
+}
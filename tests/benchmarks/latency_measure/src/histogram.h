@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025 Intel Corporation.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _LATENCY_MEASURE_HISTOGRAM_H
+#define _LATENCY_MEASURE_HISTOGRAM_H
+
+#include <zephyr/kernel.h>
+#include <stdint.h>
+
+/*
+ * Log-linear latency histogram. Samples are binned by their most
+ * significant bit with LATENCY_HISTOGRAM_SUB_BITS additional bits of
+ * linear resolution within each power-of-two range, which bounds the
+ * relative quantization error to 1 / 2^LATENCY_HISTOGRAM_SUB_BITS while
+ * covering the full 32-bit cycle range with a fixed size table.
+ */
+#define LATENCY_HISTOGRAM_SUB_BITS     3
+#define LATENCY_HISTOGRAM_SUB_BUCKETS  BIT(LATENCY_HISTOGRAM_SUB_BITS)
+#define LATENCY_HISTOGRAM_BUCKETS      \
+	((33 - LATENCY_HISTOGRAM_SUB_BITS) * LATENCY_HISTOGRAM_SUB_BUCKETS)
+
+struct latency_histogram {
+	uint32_t  buckets[LATENCY_HISTOGRAM_BUCKETS];
+	uint64_t  count;
+	uint32_t  min;
+	uint32_t  max;
+};
+
+/*
+ * Shared histogram instance. The benchmarks run sequentially, so the
+ * instrumented tests reset it before the measured loop and report it
+ * once the loop is done.
+ */
+extern struct latency_histogram bench_histogram;
+
+void histogram_reset(struct latency_histogram *hist);
+
+void histogram_add(struct latency_histogram *hist, uint32_t cycles);
+
+/**
+ * @brief Print min/max and the p50/p90/p99/p99.9 percentiles
+ *
+ * Output uses the benchmark's regular statistics line format so that
+ * the twister console harness records the values without changes.
+ */
+void histogram_report(struct latency_histogram *hist, const char *tag);
+
+#endif
@@ -25,6 +25,7 @@
 #include <zephyr/kernel.h>
 #include "utils.h"
 #include "timing_sc.h"
+#include "histogram.h"
 
 #include <zephyr/irq_offload.h>
 
@@ -65,7 +66,12 @@ static void int_to_interrupted_thread(uint32_t num_iterations, uint64_t *sum)
 		finish = timing_timestamp_get();
 		start = timestamp.sample;
 
-		*sum += timing_cycles_get(&start, &finish);
+		uint32_t elapsed = (uint32_t)timing_cycles_get(&start, &finish);
+
+		*sum += elapsed;
+#ifdef CONFIG_BENCHMARK_LATENCY_HISTOGRAM
+		histogram_add(&bench_histogram, elapsed);
+#endif
 	}
 }
 
@@ -96,7 +102,12 @@ static void start_thread_entry(void *p1, void *p2, void *p3)
 		finish = timing_timestamp_get();
 		start = timestamp.sample;
 
-		sum += timing_cycles_get(&start, &finish);
+		uint32_t elapsed = (uint32_t)timing_cycles_get(&start, &finish);
+
+		sum += elapsed;
+#ifdef CONFIG_BENCHMARK_LATENCY_HISTOGRAM
+		histogram_add(&bench_histogram, elapsed);
+#endif
 	}
 
 	timestamp.cycles = sum;
@@ -171,6 +182,10 @@ int int_to_thread(uint32_t num_iterations)
 	timing_start();
 	TICK_SYNCH();
 
+#ifdef CONFIG_BENCHMARK_LATENCY_HISTOGRAM
+	histogram_reset(&bench_histogram);
+#endif
+
 	int_to_interrupted_thread(num_iterations, &sum);
 
 	sum -= timestamp_overhead_adjustment(0, 0);
@@ -180,6 +195,11 @@ int int_to_thread(uint32_t num_iterations)
 		 "isr.resume.interrupted.thread.kernel");
 	PRINT_STATS_AVG(description, (uint32_t)sum, num_iterations, false, "");
 
+#ifdef CONFIG_BENCHMARK_LATENCY_HISTOGRAM
+	histogram_report(&bench_histogram, "isr.resume.interrupted.thread.kernel");
+	histogram_reset(&bench_histogram);
+#endif
+
 	/* ************** */
 
 	int_to_another_thread(num_iterations, &sum, 0);
@@ -191,6 +211,11 @@ int int_to_thread(uint32_t num_iterations)
 		 "isr.resume.different.thread.kernel");
 	PRINT_STATS_AVG(description, (uint32_t)sum, num_iterations, false, "");
 
+#ifdef CONFIG_BENCHMARK_LATENCY_HISTOGRAM
+	histogram_report(&bench_histogram, "isr.resume.different.thread.kernel");
+	histogram_reset(&bench_histogram);
+#endif
+
 	/* ************** */
 
 #if CONFIG_USERSPACE
@@ -202,6 +227,10 @@ int int_to_thread(uint32_t num_iterations)
 		 "%-40s - Return from ISR to another thread",
 		 "isr.resume.different.thread.user");
 	PRINT_STATS_AVG(description, (uint32_t)sum, num_iterations, false, "");
+
+#ifdef CONFIG_BENCHMARK_LATENCY_HISTOGRAM
+	histogram_report(&bench_histogram, "isr.resume.different.thread.user");
+#endif
 #endif
 
 	timing_stop();
@@ -24,6 +24,7 @@
 
 #include "utils.h"
 #include "timing_sc.h"
+#include "histogram.h"
 
 static void alt_thread_entry(void *p1, void *p2, void *p3)
 {
@@ -77,7 +78,12 @@ static void start_thread_entry(void *p1, void *p2, void *p3)
 
 		/* 6. Track the sum of elapsed times */
 
-		sum += timing_cycles_get(&start, &finish);
+		uint32_t elapsed = (uint32_t)timing_cycles_get(&start, &finish);
+
+		sum += elapsed;
+#ifdef CONFIG_BENCHMARK_LATENCY_HISTOGRAM
+		histogram_add(&bench_histogram, elapsed);
+#endif
 	}
 
 	/* Wait for <alt_thread> to complete */
@@ -119,6 +125,10 @@ static void thread_switch_yield_common(const char *description,
 		k_thread_access_grant(&start_thread, &alt_thread);
 	}
 
+#ifdef CONFIG_BENCHMARK_LATENCY_HISTOGRAM
+	histogram_reset(&bench_histogram);
+#endif
+
 	k_thread_start(&start_thread);
 
 	/* Wait until <start_thread> finishes */
@@ -139,6 +149,10 @@ static void thread_switch_yield_common(const char *description,
 		 "%-40s - Context switch via k_yield", tag);
 
 	PRINT_STATS_AVG(summary, (uint32_t)sum, num_iterations, 0, "");
+
+#ifdef CONFIG_BENCHMARK_LATENCY_HISTOGRAM
+	histogram_report(&bench_histogram, tag);
+#endif
 }
 
 void thread_switch_yield(uint32_t num_iterations, bool is_cooperative)
@@ -465,6 +465,41 @@ ZTEST(test_gatt, test_gatt_write)
 			  "Attribute write value don't match");
 }
 
+ZTEST(test_gatt, test_gatt_notify_prepare)
+{
+	struct bt_gatt_notify_prepared prepared;
+
+	/* Ensure our test service is registered */
+	bt_gatt_service_unregister(&test1_svc);
+	zassert_false(bt_gatt_service_register(&test1_svc),
+		     "Test service1 registration failed");
+
+	/* Prepare using the Characteristic Declaration */
+	zassert_false(bt_gatt_notify_prepare(&prepared, &test1_attrs[1]),
+		      "Notification prepare failed");
+	zassert_equal(prepared.attr, &test1_attrs[2],
+		      "Value attribute don't match");
+	zassert_equal(prepared.handle, test1_attrs[2].handle,
+		      "Value handle don't match");
+	zassert_equal(prepared.ccc, &test1_attrs[3],
+		      "CCC attribute don't match");
+
+	/* Prepare using the Characteristic Value */
+	zassert_false(bt_gatt_notify_prepare(&prepared, &test1_attrs[2]),
+		      "Notification prepare failed");
+	zassert_equal(prepared.handle, test1_attrs[2].handle,
+		      "Value handle don't match");
+	zassert_equal(prepared.ccc, &test1_attrs[3],
+		      "CCC attribute don't match");
+
+	/* Characteristic without notification support cannot be prepared */
+	bt_gatt_service_unregister(&test_svc);
+	zassert_false(bt_gatt_service_register(&test_svc),
+		     "Test service registration failed");
+	zassert_equal(bt_gatt_notify_prepare(&prepared, &test_attrs[1]),
+		      -EINVAL, "Notification prepare unexpected return");
+}
+
 ZTEST(test_gatt, test_bt_att_err_to_str)
 {
 	/* Test a couple of entries */
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_gpio.h"
+
+static struct gpio_pin_demux demux;
+static int demux_cnt[2];
+static int demux_marker;
+
+static void demux_handler_in(const struct device *dev, gpio_pin_t pin,
+			     void *user_data)
+{
+	zassert_equal(pin, PIN_IN, "handler invoked for wrong pin");
+	zassert_equal_ptr(user_data, &demux_marker,
+			  "handler invoked with wrong user data");
+	TC_PRINT("%s triggered: %d\n", __func__, ++demux_cnt[0]);
+}
+
+static void demux_handler_other(const struct device *dev, gpio_pin_t pin,
+				void *user_data)
+{
+	TC_PRINT("%s triggered: %d\n", __func__, ++demux_cnt[1]);
+}
+
+static void trigger_demux(const struct device *dev_in,
+			  const struct device *dev_out)
+{
+	gpio_pin_set(dev_out, PIN_OUT, 0);
+	k_sleep(K_MSEC(100));
+
+	demux_cnt[0] = 0;
+	demux_cnt[1] = 0;
+	gpio_pin_interrupt_configure(dev_in, PIN_IN, GPIO_INT_EDGE_RISING);
+	k_sleep(K_MSEC(100));
+	gpio_pin_set(dev_out, PIN_OUT, 1);
+	k_sleep(K_MSEC(1000));
+}
+
+ZTEST(gpio_port_cb_mgmt, test_gpio_pin_demux)
+{
+	const struct device *const dev_in = DEVICE_DT_GET(DEV_IN);
+	const struct device *const dev_out = DEVICE_DT_GET(DEV_OUT);
+	int rc;
+
+	/* SetUp: initialize environment */
+	rc = gpio_pin_interrupt_configure(dev_in, PIN_IN, GPIO_INT_DISABLE);
+	zassert_equal(rc, 0, "disable PIN_IN interrupt failed");
+	rc = gpio_pin_interrupt_configure(dev_out, PIN_OUT, GPIO_INT_DISABLE);
+	zassert_equal(rc, 0, "disable PIN_OUT interrupt failed");
+	rc = gpio_pin_configure(dev_out, PIN_OUT,
+				(GPIO_OUTPUT_LOW | PIN_OUT_FLAGS));
+	zassert_equal(rc, 0, "configure PIN_OUT failed");
+	rc = gpio_pin_configure(dev_in, PIN_IN, (GPIO_INPUT | PIN_IN_FLAGS));
+	zassert_equal(rc, 0, "configure PIN_IN failed");
+
+	gpio_pin_demux_init(&demux);
+
+	rc = gpio_pin_demux_add_handler(dev_in, &demux, GPIO_MAX_PINS_PER_PORT,
+					demux_handler_in, NULL);
+	zassert_equal(rc, -EINVAL, "invalid pin number not rejected");
+
+	rc = gpio_pin_demux_add_handler(dev_in, &demux, PIN_IN,
+					demux_handler_in, &demux_marker);
+	if (rc == -ENOSYS) {
+		TC_PRINT("%s not supported\n", __func__);
+		ztest_test_skip();
+	}
+	zassert_equal(rc, 0, "add handler for PIN_IN failed");
+
+	rc = gpio_pin_demux_add_handler(dev_in, &demux, PIN_IN,
+					demux_handler_in, &demux_marker);
+	zassert_equal(rc, -EBUSY, "duplicate handler not rejected");
+
+	/* The handler of an untriggered pin must not be selected. */
+	rc = gpio_pin_demux_add_handler(dev_in, &demux, PIN_OUT,
+					demux_handler_other, NULL);
+	zassert_equal(rc, 0, "add handler for PIN_OUT failed");
+
+	/* Trigger PIN_IN interrupt by operating PIN_OUT, only the PIN_IN
+	 * handler is expected to run.
+	 */
+	trigger_demux(dev_in, dev_out);
+	zassert_equal(demux_cnt[0], 1, "PIN_IN handler not triggered");
+	zassert_equal(demux_cnt[1], 0, "PIN_OUT handler triggered");
+
+	/* Removing the PIN_IN handler stops its dispatch. */
+	rc = gpio_pin_demux_remove_handler(dev_in, &demux, PIN_IN);
+	zassert_equal(rc, 0, "remove handler for PIN_IN failed");
+	rc = gpio_pin_demux_remove_handler(dev_in, &demux, PIN_IN);
+	zassert_equal(rc, -ENOENT, "removed handler not rejected");
+
+	trigger_demux(dev_in, dev_out);
+	zassert_equal(demux_cnt[0], 0, "removed PIN_IN handler triggered");
+	zassert_equal(demux_cnt[1], 0, "PIN_OUT handler triggered");
+
+	rc = gpio_pin_demux_remove_handler(dev_in, &demux, PIN_OUT);
+	zassert_equal(rc, 0, "remove handler for PIN_OUT failed");
+}
+
+ZTEST(gpio_port, test_gpio_port_configure)
+{
+	const struct device *const dev_in = DEVICE_DT_GET(DEV_IN);
+	const struct device *const dev_out = DEVICE_DT_GET(DEV_OUT);
+	int rc;
+
+	/* DEV_IN equals DEV_OUT (verified by the port tests), configure
+	 * both pins as inputs in one call and restore them afterwards.
+	 */
+	rc = gpio_port_configure(dev_in, BIT(PIN_IN) | BIT(PIN_OUT),
+				 GPIO_INPUT);
+	zassert_equal(rc, 0, "batched input configuration failed");
+
+	rc = gpio_pin_configure(dev_out, PIN_OUT,
+				(GPIO_OUTPUT_LOW | PIN_OUT_FLAGS));
+	zassert_equal(rc, 0, "restore PIN_OUT failed");
+	rc = gpio_pin_configure(dev_in, PIN_IN, (GPIO_INPUT | PIN_IN_FLAGS));
+	zassert_equal(rc, 0, "restore PIN_IN failed");
+}
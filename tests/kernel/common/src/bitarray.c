@@ -525,6 +525,88 @@ ZTEST(bitarray, test_bitarray_alloc_free)
 	alloc_and_free_interval();
 }
 
+/**
+ * @brief Test allocation of multiple scattered bits
+ *
+ * @see sys_bitarray_alloc_bits()
+ */
+ZTEST(bitarray, test_bitarray_alloc_bits)
+{
+	int ret;
+	size_t cnt;
+	size_t offsets[8];
+	size_t expected_popcnt, cur_popcnt;
+
+	SYS_BITARRAY_DEFINE(ba, 52);
+
+	/* Bitarrays have embedded spinlocks and can't on the stack. */
+	if (IS_ENABLED(CONFIG_KERNEL_COHERENCE)) {
+		ztest_test_skip();
+	}
+
+	/* Pre-populate the bits so that 4-bit already allocated,
+	 * then 4 free bits, and repeat.
+	 */
+	for (cnt = 0; cnt < ba.num_bundles; cnt++) {
+		ba.bundles[cnt] = 0x0F0F0F0F;
+	}
+	expected_popcnt = get_bitarray_popcnt(&ba);
+
+	/* Invalid arguments */
+	ret = sys_bitarray_alloc_bits(&ba, 0, offsets);
+	zassert_equal(ret, -EINVAL,
+		      "sys_bitarray_alloc_bits() returned %d instead of -EINVAL", ret);
+
+	ret = sys_bitarray_alloc_bits(&ba, ba.num_bits + 1, offsets);
+	zassert_equal(ret, -EINVAL,
+		      "sys_bitarray_alloc_bits() returned %d instead of -EINVAL", ret);
+
+	/* Allocate one batch, spanning the free runs of two bundles */
+	ret = sys_bitarray_alloc_bits(&ba, 8, offsets);
+	zassert_equal(ret, 0, "sys_bitarray_alloc_bits() failed (%d)", ret);
+
+	for (cnt = 0; cnt < 8; cnt++) {
+		/* Free bits were at offsets 4-7 and 12-15 */
+		size_t expected_offset = (cnt < 4) ? (cnt + 4) : (cnt + 8);
+
+		zassert_equal(offsets[cnt], expected_offset,
+			      "offset expected %u, got %u (cnt %u)",
+			      expected_offset, offsets[cnt], cnt);
+	}
+
+	expected_popcnt += 8;
+	cur_popcnt = get_bitarray_popcnt(&ba);
+	zassert_equal(cur_popcnt, expected_popcnt,
+		      "bit count expected %u, got %u",
+		      expected_popcnt, cur_popcnt);
+
+	/* Only 52 - 36 = 16 free bits remain, so this must fail
+	 * without modifying the bitarray.
+	 */
+	ret = sys_bitarray_alloc_bits(&ba, 24, offsets);
+	zassert_equal(ret, -ENOSPC,
+		      "sys_bitarray_alloc_bits() returned %d instead of -ENOSPC", ret);
+
+	cur_popcnt = get_bitarray_popcnt(&ba);
+	zassert_equal(cur_popcnt, expected_popcnt,
+		      "bit count expected %u, got %u",
+		      expected_popcnt, cur_popcnt);
+
+	/* Drain the remaining free bits and free them again */
+	ret = sys_bitarray_alloc_bits(&ba, 8, offsets);
+	zassert_equal(ret, 0, "sys_bitarray_alloc_bits() failed (%d)", ret);
+
+	ret = sys_bitarray_alloc_bits(&ba, 8, offsets);
+	zassert_equal(ret, 0, "sys_bitarray_alloc_bits() failed (%d)", ret);
+
+	for (cnt = 0; cnt < 8; cnt++) {
+		ret = sys_bitarray_free(&ba, 1, offsets[cnt]);
+		zassert_equal(ret, 0,
+			      "sys_bitarray_free() failed (%d) at bit %u",
+			      ret, offsets[cnt]);
+	}
+}
+
 ZTEST(bitarray, test_bitarray_popcount_region)
 {
 	int ret;
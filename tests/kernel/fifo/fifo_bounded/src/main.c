@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief Tests for the bounded FIFO kernel object
+ *
+ * Verify the lock-free bounded FIFO under different contexts
+ *
+ * - API coverage
+ *   -# k_fifo_bounded_init K_FIFO_BOUNDED_DEFINE
+ *   -# k_fifo_bounded_put k_fifo_bounded_get
+ *   -# k_fifo_bounded_is_empty
+ *   -# k_poll on K_POLL_TYPE_FIFO_BOUNDED_DATA_AVAILABLE
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
+
+#define FIFO_SIZE 4
+#define DATA_COUNT 8
+#define WAIT_MS 100
+
+K_FIFO_BOUNDED_DEFINE(static_fifo, FIFO_SIZE);
+
+static uint32_t data[DATA_COUNT];
+
+static void put_from_isr(const void *fifo)
+{
+	zassert_ok(k_fifo_bounded_put((struct k_fifo_bounded *)fifo,
+				      &data[0]));
+}
+
+ZTEST(fifo_bounded, test_fifo_bounded_order)
+{
+	static atomic_ptr_t buf[FIFO_SIZE];
+	struct k_fifo_bounded fifo;
+
+	k_fifo_bounded_init(&fifo, buf, FIFO_SIZE);
+
+	zassert_true(k_fifo_bounded_is_empty(&fifo));
+	zassert_is_null(k_fifo_bounded_get(&fifo, K_NO_WAIT));
+
+	for (int i = 0; i < FIFO_SIZE; i++) {
+		zassert_ok(k_fifo_bounded_put(&fifo, &data[i]));
+	}
+
+	/* The ring is full now */
+	zassert_equal(k_fifo_bounded_put(&fifo, &data[FIFO_SIZE]), -ENOMEM);
+
+	for (int i = 0; i < FIFO_SIZE; i++) {
+		zassert_equal(k_fifo_bounded_get(&fifo, K_NO_WAIT), &data[i]);
+	}
+
+	zassert_true(k_fifo_bounded_is_empty(&fifo));
+
+	/* Indices keep running over the ring boundary */
+	for (int i = 0; i < DATA_COUNT; i++) {
+		zassert_ok(k_fifo_bounded_put(&fifo, &data[i]));
+		zassert_equal(k_fifo_bounded_get(&fifo, K_NO_WAIT), &data[i]);
+	}
+}
+
+ZTEST(fifo_bounded, test_fifo_bounded_isr2thread)
+{
+	irq_offload(put_from_isr, &static_fifo);
+
+	zassert_false(k_fifo_bounded_is_empty(&static_fifo));
+	zassert_equal(k_fifo_bounded_get(&static_fifo, K_MSEC(WAIT_MS)),
+		      &data[0]);
+}
+
+ZTEST(fifo_bounded, test_fifo_bounded_timeout)
+{
+	int64_t start = k_uptime_get();
+
+	zassert_is_null(k_fifo_bounded_get(&static_fifo, K_MSEC(WAIT_MS)));
+	zassert_true(k_uptime_get() - start >= WAIT_MS);
+}
+
+ZTEST(fifo_bounded, test_fifo_bounded_poll)
+{
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_FIFO_BOUNDED_DATA_AVAILABLE,
+		K_POLL_MODE_NOTIFY_ONLY, &static_fifo);
+
+	zassert_equal(k_poll(&event, 1, K_MSEC(WAIT_MS)), -EAGAIN);
+
+	zassert_ok(k_fifo_bounded_put(&static_fifo, &data[1]));
+
+	event.state = K_POLL_STATE_NOT_READY;
+	zassert_ok(k_poll(&event, 1, K_MSEC(WAIT_MS)));
+	zassert_equal(event.state, K_POLL_STATE_FIFO_BOUNDED_DATA_AVAILABLE);
+
+	zassert_equal(k_fifo_bounded_get(&static_fifo, K_NO_WAIT), &data[1]);
+}
+
+ZTEST_SUITE(fifo_bounded, NULL, NULL, NULL, NULL, NULL);
@@ -119,6 +119,93 @@ ZTEST(k_pipe_basic, test_read_write_wrapp_around)
 		"Unexpected data received from pipe");
 }
 
+ZTEST(k_pipe_basic, test_claim_write_read)
+{
+	uint8_t buffer[10];
+	uint8_t input[10];
+	uint8_t *claimed;
+
+	mkrandom(input, sizeof(input));
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	zassert_true(k_pipe_write_claim(&pipe, &claimed, sizeof(input)) == sizeof(input),
+		"Failed to claim space in empty pipe");
+	memcpy(claimed, input, sizeof(input));
+	zassert_true(k_pipe_write_finish(&pipe, sizeof(input)) == 0,
+		"Failed to commit claimed space");
+	zassert_true(k_pipe_write_claim(&pipe, &claimed, 1) == 0,
+		"Should not be able to claim space in full pipe");
+
+	zassert_true(k_pipe_read_claim(&pipe, &claimed, sizeof(input)) == sizeof(input),
+		"Failed to claim data from full pipe");
+	zassert_true(memcmp(input, claimed, sizeof(input)) == 0,
+		"Unexpected data received from pipe");
+	zassert_true(k_pipe_read_finish(&pipe, sizeof(input)) == 0,
+		"Failed to release claimed data");
+	zassert_true(k_pipe_read_claim(&pipe, &claimed, 1) == 0,
+		"Should not be able to claim data from empty pipe");
+}
+
+ZTEST(k_pipe_basic, test_claim_wrap_around)
+{
+	uint8_t buffer[10];
+	uint8_t input[8];
+	uint8_t res[8];
+	uint8_t *claimed;
+	int claim_size;
+
+	mkrandom(input, sizeof(input));
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+
+	/* Move the ring buffer indexes near the end of the buffer */
+	zassert_true(k_pipe_write(&pipe, input, 6, K_NO_WAIT) == 6,
+		"Failed to write bytes to pipe");
+	zassert_true(k_pipe_read(&pipe, res, 6, K_NO_WAIT) == 6,
+		"Failed to read bytes from pipe");
+
+	/* A claim stops at the wrap point, a second claim returns the rest */
+	claim_size = k_pipe_write_claim(&pipe, &claimed, sizeof(input));
+	zassert_true(claim_size > 0 && claim_size < (int)sizeof(input),
+		"Claim should be truncated at the wrap point");
+	memcpy(claimed, input, claim_size);
+	zassert_true(k_pipe_write_finish(&pipe, claim_size) == 0,
+		"Failed to commit claimed space");
+	zassert_true(k_pipe_write_claim(&pipe, &claimed, sizeof(input) - claim_size) ==
+		sizeof(input) - claim_size, "Failed to claim space beyond the wrap point");
+	memcpy(claimed, &input[claim_size], sizeof(input) - claim_size);
+	zassert_true(k_pipe_write_finish(&pipe, sizeof(input) - claim_size) == 0,
+		"Failed to commit claimed space");
+
+	zassert_true(k_pipe_read(&pipe, res, sizeof(res), K_NO_WAIT) == sizeof(res),
+		"Failed to read bytes from pipe");
+	zassert_true(memcmp(input, res, sizeof(input)) == 0,
+		"Unexpected data received from pipe");
+}
+
+ZTEST(k_pipe_basic, test_claim_closed)
+{
+	uint8_t buffer[10];
+	uint8_t input[4];
+	uint8_t *claimed;
+
+	mkrandom(input, sizeof(input));
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	zassert_true(k_pipe_write(&pipe, input, sizeof(input), K_NO_WAIT) == sizeof(input),
+		"Failed to write bytes to pipe");
+	k_pipe_close(&pipe);
+
+	zassert_true(k_pipe_write_claim(&pipe, &claimed, 1) == -EPIPE,
+		"Should not be able to claim space in closed pipe");
+	zassert_true(k_pipe_read_claim(&pipe, &claimed, sizeof(input)) == sizeof(input),
+		"You should be able to claim remaining data from closed pipe");
+	zassert_true(memcmp(input, claimed, sizeof(input)) == 0,
+		"Unexpected data received from pipe");
+	zassert_true(k_pipe_read_finish(&pipe, sizeof(input)) == 0,
+		"Failed to release claimed data");
+	zassert_true(k_pipe_read_claim(&pipe, &claimed, 1) == -EPIPE,
+		"Closed and empty pipe should return -EPIPE");
+}
+
 ZTEST(k_pipe_basic, test_reset)
 {
 	uint8_t buffer[10];
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/syscall_batch.h>
+#include <zephyr/syscall_list.h>
+#include <zephyr/ztest.h>
+
+static K_SEM_DEFINE(batch_sem, 0, 8);
+
+/**
+ * @brief Verify batched system calls execute in order with results
+ *
+ * Submit a batch giving the semaphore twice, reading its count and
+ * taking it once, and check each operation's written-back result.
+ */
+ZTEST_USER(syscall_batch, test_batch_dispatch)
+{
+	struct k_syscall_batch_op ops[4] = {
+		{ .call_id = K_SYSCALL_K_SEM_GIVE,
+		  .args = { (uintptr_t)&batch_sem } },
+		{ .call_id = K_SYSCALL_K_SEM_GIVE,
+		  .args = { (uintptr_t)&batch_sem } },
+		{ .call_id = K_SYSCALL_K_SEM_COUNT_GET,
+		  .args = { (uintptr_t)&batch_sem } },
+		{ .call_id = K_SYSCALL_K_SEM_TAKE,
+		  .args = { (uintptr_t)&batch_sem, (uintptr_t)K_NO_WAIT.ticks } },
+	};
+
+	zassert_ok(k_syscall_batch(ops, ARRAY_SIZE(ops)));
+
+	zassert_equal(ops[2].result, 2, "unexpected count %lu",
+		      (unsigned long)ops[2].result);
+	zassert_equal((int)ops[3].result, 0, "k_sem_take failed");
+	zassert_equal(k_sem_count_get(&batch_sem), 1);
+
+	k_sem_reset(&batch_sem);
+}
+
+/**
+ * @brief Verify batch argument validation
+ *
+ * Bad sizes are rejected with -EINVAL, unknown call IDs and nested
+ * batches with -ENOSYS, and a rejected batch has no side effects.
+ */
+ZTEST_USER(syscall_batch, test_batch_validation)
+{
+	struct k_syscall_batch_op ops[2] = {
+		{ .call_id = K_SYSCALL_K_SEM_GIVE,
+		  .args = { (uintptr_t)&batch_sem } },
+		{ .call_id = K_SYSCALL_LIMIT },
+	};
+
+	zassert_equal(k_syscall_batch(ops, 0), -EINVAL);
+	zassert_equal(k_syscall_batch(ops, CONFIG_SYSCALL_BATCH_MAX_OPS + 1),
+		      -EINVAL);
+
+	zassert_equal(k_syscall_batch(ops, ARRAY_SIZE(ops)), -ENOSYS);
+
+	ops[1].call_id = K_SYSCALL_K_SYSCALL_BATCH;
+	zassert_equal(k_syscall_batch(ops, ARRAY_SIZE(ops)), -ENOSYS);
+
+	/* The first (valid) operation must not have run */
+	zassert_equal(k_sem_count_get(&batch_sem), 0);
+}
+
+/**
+ * @brief Verify batching is refused from supervisor mode
+ */
+ZTEST(syscall_batch, test_batch_supervisor)
+{
+	struct k_syscall_batch_op op = {
+		.call_id = K_SYSCALL_K_SEM_GIVE,
+		.args = { (uintptr_t)&batch_sem },
+	};
+
+	zassert_equal(k_syscall_batch(&op, 1), -ENOTSUP);
+}
+
+static void *syscall_batch_setup(void)
+{
+	k_thread_access_grant(k_current_get(), &batch_sem);
+
+	return NULL;
+}
+
+ZTEST_SUITE(syscall_batch, NULL, syscall_batch_setup, NULL, NULL, NULL);
@@ -630,6 +630,41 @@ ZTEST(work_1cpu, test_1cpu_delayed_cancel_sync)
 	zassert_equal(coophi_counter(), 0);
 }
 
+/* Single CPU bulk cancel before scheduled work items are queued should
+ * not wait.
+ */
+ZTEST(work_1cpu, test_1cpu_delayed_cancel_bulk)
+{
+	static struct k_work_delayable dwork2;
+	struct k_work_delayable *dworks[] = { &dwork, &dwork2 };
+	int rc;
+
+	/* Reset state and use the blocking handler */
+	reset_counters();
+	k_work_init_delayable(&dwork, rel_handler);
+	k_work_init_delayable(&dwork2, rel_handler);
+
+	/* Bulk-cancelling idle items should report nothing pending. */
+	zassert_equal(k_work_cancel_delayable_bulk(dworks, ARRAY_SIZE(dworks),
+						   &work_sync), 0);
+
+	/* Submit both to the cooperative queue. */
+	rc = k_work_schedule_for_queue(&coophi_queue, &dwork, K_MSEC(DELAY_MS));
+	zassert_equal(rc, 1);
+	rc = k_work_schedule_for_queue(&coophi_queue, &dwork2, K_MSEC(DELAY_MS));
+	zassert_equal(rc, 1);
+	zassert_equal(coophi_counter(), 0);
+
+	/* Cancellation should complete immediately, reporting both items
+	 * as pending.
+	 */
+	zassert_equal(k_work_cancel_delayable_bulk(dworks, ARRAY_SIZE(dworks),
+						   &work_sync), 2);
+
+	/* Neither should have run. */
+	zassert_equal(coophi_counter(), 0);
+}
+
 /* Single CPU cancel after delayable item starts should wait. */
 ZTEST(work_1cpu, test_1cpu_delayed_cancel_sync_wait)
 {
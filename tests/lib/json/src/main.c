@@ -2178,4 +2178,109 @@ ZTEST(lib_json_test, test_json_enums)
 		     "Enums not decoded correctly");
 }
 
+
+static char stream_trace[256];
+static size_t stream_trace_len;
+
+static int stream_trace_cb(enum json_stream_event event, const char *data,
+			   size_t len, void *user_data)
+{
+	static const char event_chars[] = {
+		[JSON_STREAM_OBJECT_START] = '{',
+		[JSON_STREAM_OBJECT_END] = '}',
+		[JSON_STREAM_ARRAY_START] = '[',
+		[JSON_STREAM_ARRAY_END] = ']',
+		[JSON_STREAM_KEY] = 'k',
+		[JSON_STREAM_STRING] = 's',
+		[JSON_STREAM_NUMBER] = 'n',
+		[JSON_STREAM_TRUE] = 't',
+		[JSON_STREAM_FALSE] = 'f',
+		[JSON_STREAM_NULL] = '0',
+	};
+
+	ARG_UNUSED(user_data);
+
+	zassert_true(stream_trace_len + len + 3 < sizeof(stream_trace),
+		     "Trace buffer too small");
+
+	stream_trace[stream_trace_len++] = event_chars[event];
+	if (data != NULL) {
+		stream_trace[stream_trace_len++] = '=';
+		memcpy(stream_trace + stream_trace_len, data, len);
+		stream_trace_len += len;
+		stream_trace[stream_trace_len++] = ';';
+	}
+	stream_trace[stream_trace_len] = '\0';
+
+	return 0;
+}
+
+ZTEST(lib_json_test, test_json_stream_parse)
+{
+	static const char encoded[] = "{\"name\":\"Zephyr\",\"nums\":[42,-3.5],"
+				      "\"ok\":true,\"nil\":null}";
+	static const char expected[] = "{k=name;s=Zephyr;k=nums;[n=42;n=-3.5;]"
+				       "k=ok;tk=nil;0}";
+	struct json_stream stream;
+	char scratch[16];
+	int ret;
+
+	/* Feed the document in every possible split into two chunks, so
+	 * each token gets cut at every position.
+	 */
+	for (size_t split = 0; split < sizeof(encoded) - 1; split++) {
+		json_stream_init(&stream, stream_trace_cb, NULL, scratch,
+				 sizeof(scratch));
+		stream_trace_len = 0;
+
+		ret = json_stream_feed(&stream, encoded, split);
+		zassert_equal(ret, 0, "Feed failed at split %zu", split);
+
+		ret = json_stream_feed(&stream, encoded + split,
+				       sizeof(encoded) - 1 - split);
+		zassert_equal(ret, 0, "Feed failed at split %zu", split);
+
+		zassert_equal(json_stream_finish(&stream), 0,
+			      "Document incomplete at split %zu", split);
+		zassert_str_equal(stream_trace, expected,
+				  "Unexpected events at split %zu", split);
+	}
+}
+
+ZTEST(lib_json_test, test_json_stream_parse_errors)
+{
+	static const char *invalid[] = {
+		"{\"key\"}",
+		"[1,]",
+		"{\"key\":1,}",
+		"truk",
+		"]",
+		"[1 2]",
+	};
+	struct json_stream stream;
+	char scratch[16];
+
+	for (size_t i = 0; i < ARRAY_SIZE(invalid); i++) {
+		json_stream_init(&stream, stream_trace_cb, NULL, scratch,
+				 sizeof(scratch));
+		stream_trace_len = 0;
+
+		zassert_equal(json_stream_feed(&stream, invalid[i],
+					       strlen(invalid[i])),
+			      -EINVAL, "Accepted \"%s\"", invalid[i]);
+	}
+
+	/* Incomplete document */
+	json_stream_init(&stream, stream_trace_cb, NULL, scratch, sizeof(scratch));
+	stream_trace_len = 0;
+	zassert_equal(json_stream_feed(&stream, "[1,", 3), 0);
+	zassert_equal(json_stream_finish(&stream), -EINVAL);
+
+	/* Token larger than the scratch buffer, split across chunks */
+	json_stream_init(&stream, stream_trace_cb, NULL, scratch, sizeof(scratch));
+	stream_trace_len = 0;
+	zassert_equal(json_stream_feed(&stream, "\"0123456789", 11), 0);
+	zassert_equal(json_stream_feed(&stream, "0123456789\"", 11), -ENOMEM);
+}
+
 ZTEST_SUITE(lib_json_test, NULL, NULL, NULL, NULL, NULL);
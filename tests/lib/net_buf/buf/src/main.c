@@ -21,6 +21,7 @@
 #define USER_DATA_FIXED	0
 #define USER_DATA_VAR	63
 #define FIXED_BUFFER_SIZE 128
+#define ALIGNED_POOL_ALIGN 64
 
 struct bt_data {
 	void *hci_sync;
@@ -71,6 +72,10 @@ static void var_destroy(struct net_buf *buf);
 NET_BUF_POOL_HEAP_DEFINE(bufs_pool, 10, USER_DATA_HEAP, buf_destroy);
 NET_BUF_POOL_FIXED_DEFINE(fixed_pool, 10, FIXED_BUFFER_SIZE, USER_DATA_FIXED, fixed_destroy);
 NET_BUF_POOL_VAR_DEFINE(var_pool, 10, 1024, USER_DATA_VAR, var_destroy);
+NET_BUF_POOL_ALIGNED_DEFINE(aligned_pool, 4, FIXED_BUFFER_SIZE, USER_DATA_FIXED,
+			    ALIGNED_POOL_ALIGN, NULL);
+NET_BUF_POOL_SEGMENTED_DEFINE(seg_pool, USER_DATA_FIXED, NULL,
+			      (64, 4), (256, 2));
 
 static void buf_destroy(struct net_buf *buf)
 {
@@ -506,6 +511,33 @@ ZTEST(net_buf_tests, test_net_buf_fixed_pool)
 	zassert_equal(destroy_called, 1, "Incorrect destroy callback count");
 }
 
+ZTEST(net_buf_tests, test_net_buf_aligned_pool)
+{
+	struct net_buf *bufs[4];
+	int i;
+
+	/* Verify that every buffer and its data chunk start on the
+	 * requested alignment boundary.
+	 */
+	for (i = 0; i < ARRAY_SIZE(bufs); i++) {
+		bufs[i] = net_buf_alloc(&aligned_pool, K_NO_WAIT);
+		zassert_not_null(bufs[i], "Failed to get buffer");
+		zassert_true(IS_ALIGNED(bufs[i], ALIGNED_POOL_ALIGN),
+			     "Misaligned buffer %p", bufs[i]);
+		zassert_true(IS_ALIGNED(bufs[i]->data, ALIGNED_POOL_ALIGN),
+			     "Misaligned buffer data %p", bufs[i]->data);
+		zassert_true(net_buf_tailroom(bufs[i]) >= FIXED_BUFFER_SIZE,
+			     "Invalid fixed buffer size");
+	}
+
+	zassert_is_null(net_buf_alloc(&aligned_pool, K_NO_WAIT),
+			"Got more buffers than expected");
+
+	for (i = 0; i < ARRAY_SIZE(bufs); i++) {
+		net_buf_unref(bufs[i]);
+	}
+}
+
 ZTEST(net_buf_tests, test_net_buf_var_pool)
 {
 	struct net_buf *buf1, *buf2, *buf3;
@@ -529,6 +561,50 @@ ZTEST(net_buf_tests, test_net_buf_var_pool)
 	zassert_equal(destroy_called, 3, "Incorrect destroy callback count");
 }
 
+ZTEST(net_buf_tests, test_net_buf_segmented_pool)
+{
+	struct net_buf *small[4], *big, *borrowed, *buf;
+
+	/* Small allocations are served from the small class */
+	for (int i = 0; i < ARRAY_SIZE(small); i++) {
+		small[i] = net_buf_alloc_len(&seg_pool, 10, K_NO_WAIT);
+		zassert_not_null(small[i], "Failed to get buffer");
+		zassert_equal(small[i]->size, 64, "Wrong size class");
+	}
+
+	/* Large allocations are served from the large class */
+	big = net_buf_alloc_len(&seg_pool, 100, K_NO_WAIT);
+	zassert_not_null(big, "Failed to get buffer");
+	zassert_equal(big->size, 256, "Wrong size class");
+
+	/* With the small class exhausted, a small allocation borrows a
+	 * chunk from the large class.
+	 */
+	borrowed = net_buf_alloc_len(&seg_pool, 10, K_NO_WAIT);
+	zassert_not_null(borrowed, "Failed to get buffer");
+	zassert_equal(borrowed->size, 256, "Expected borrowed chunk");
+
+	/* Now all chunks are in use */
+	buf = net_buf_alloc_len(&seg_pool, 10, K_NO_WAIT);
+	zassert_is_null(buf, "Expected allocation failure");
+
+	/* Freeing a small chunk makes the small class available again */
+	net_buf_unref(small[0]);
+	small[0] = net_buf_alloc_len(&seg_pool, 10, K_NO_WAIT);
+	zassert_not_null(small[0], "Failed to get buffer");
+	zassert_equal(small[0]->size, 64, "Wrong size class");
+
+	/* Requests that fit no class must fail */
+	buf = net_buf_alloc_len(&seg_pool, 300, K_NO_WAIT);
+	zassert_is_null(buf, "Expected allocation failure");
+
+	for (int i = 0; i < ARRAY_SIZE(small); i++) {
+		net_buf_unref(small[i]);
+	}
+	net_buf_unref(big);
+	net_buf_unref(borrowed);
+}
+
 ZTEST(net_buf_tests, test_net_buf_byte_order)
 {
 	struct net_buf *buf;
@@ -212,6 +212,35 @@ ZTEST(shared_multi_heap, test_shared_multi_heap)
 	/* Request a non-existent attribute */
 	block = shared_multi_heap_alloc(MAX_SHARED_MULTI_HEAP_ATTR, 0x100);
 	zassert_is_null(block, "wrong attribute accepted as valid");
+
+	/*
+	 * Known policies are accepted, unknown ones rejected
+	 */
+	ret = shared_multi_heap_policy_set(SMH_ALLOC_POLICY_PREFER_FAST);
+	zassert_equal(0, ret, "valid policy rejected");
+
+	ret = shared_multi_heap_policy_set(SMH_ALLOC_POLICY_FIRST_FIT);
+	zassert_equal(0, ret, "valid policy rejected");
+
+	ret = shared_multi_heap_policy_set(0xdead);
+	zassert_equal(-EINVAL, ret, "unknown policy accepted as valid");
+
+	/*
+	 * Migrate a block from a cacheable to a non-cacheable region
+	 */
+	block = shared_multi_heap_alloc(SMH_REG_ATTR_CACHEABLE, 0x40);
+	zassert_not_null(block, "failed to allocate the block to migrate");
+
+	memset(block, 0xa5, 0x40);
+
+	block = shared_multi_heap_migrate(block, SMH_REG_ATTR_NON_CACHEABLE);
+	reg_map = get_region_map(block);
+
+	zassert_equal(reg_map->p_addr, RES1_NOCACHE_ADDR, "block in the wrong memory region");
+	zassert_equal(reg_map->region.attr, SMH_REG_ATTR_NON_CACHEABLE, "wrong memory attribute");
+	zassert_equal(((uint8_t *)block)[0x3f], 0xa5, "block content not preserved");
+
+	shared_multi_heap_free(block);
 }
 
 ZTEST_SUITE(shared_multi_heap, NULL, NULL, NULL, NULL, NULL);
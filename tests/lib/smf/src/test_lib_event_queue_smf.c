@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/smf.h>
+
+/*
+ * Event Queue Test:
+ *
+ * Posts a batch of events to a state machine and verifies that one
+ * smf_run_events() call processes them all, in posting order, and that
+ * termination stops the processing of the remaining events.
+ */
+
+#define TEST_OBJECT(o) ((struct test_object *)o)
+
+#define TEST_EVENT_COUNT     4
+#define TEST_EVENT_TERMINATE UINT32_MAX
+#define TEST_TERMINATE_VALUE -1
+
+static struct test_object {
+	struct smf_ctx ctx;
+
+	/* Number of events processed by the run action */
+	uint32_t processed;
+} test_obj;
+
+static struct smf_event test_events[TEST_EVENT_COUNT];
+
+static void event_state_run(void *obj)
+{
+	struct test_object *o = TEST_OBJECT(obj);
+	const struct smf_event *event = SMF_CTX(obj)->event;
+
+	zassert_not_null(event, "No event to process");
+
+	if (event->id == TEST_EVENT_TERMINATE) {
+		smf_set_terminate(SMF_CTX(obj), TEST_TERMINATE_VALUE);
+		return;
+	}
+
+	/* Events are processed in posting order */
+	zassert_equal(event->id, o->processed, "Events processed out of order");
+
+	o->processed++;
+}
+
+static const struct smf_state event_state =
+	SMF_CREATE_STATE(NULL, event_state_run, NULL, NULL, NULL);
+
+ZTEST(smf_tests, test_smf_event_queue)
+{
+	test_obj.processed = 0;
+
+	smf_set_initial(SMF_CTX(&test_obj), &event_state);
+
+	/* Draining an empty queue processes nothing */
+	zassert_equal(smf_run_events(SMF_CTX(&test_obj)), 0,
+		      "Empty queue unexpected return");
+	zassert_equal(test_obj.processed, 0, "Processed events from empty queue");
+
+	/* Post a batch of events and drain it with a single call */
+	for (uint32_t i = 0; i < TEST_EVENT_COUNT; i++) {
+		test_events[i].id = i;
+		smf_event_post(SMF_CTX(&test_obj), &test_events[i]);
+	}
+
+	zassert_equal(smf_run_events(SMF_CTX(&test_obj)), 0,
+		      "Event processing unexpected return");
+	zassert_equal(test_obj.processed, TEST_EVENT_COUNT,
+		      "Incorrect number of events processed");
+	zassert_is_null(SMF_CTX(&test_obj)->event,
+			"Event not cleared after draining the queue");
+
+	/* Termination stops the processing of the remaining events */
+	test_obj.processed = 0;
+	test_events[0].id = TEST_EVENT_TERMINATE;
+	test_events[1].id = 0;
+	smf_event_post(SMF_CTX(&test_obj), &test_events[0]);
+	smf_event_post(SMF_CTX(&test_obj), &test_events[1]);
+
+	zassert_equal(smf_run_events(SMF_CTX(&test_obj)), TEST_TERMINATE_VALUE,
+		      "Termination value don't match");
+	zassert_equal(test_obj.processed, 0, "Processed events after termination");
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/spsc_ring_buf.h>
+
+#define RB_SIZE 64
+
+SPSC_RING_BUF_DECLARE(test_rb, RB_SIZE);
+
+static void test_rb_reset(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	spsc_ring_buf_reset(&test_rb);
+}
+
+ZTEST(spsc_ring_buf, test_capacity)
+{
+	zassert_equal(spsc_ring_buf_capacity_get(&test_rb), RB_SIZE);
+	zassert_equal(spsc_ring_buf_size_get(&test_rb), 0);
+	zassert_equal(spsc_ring_buf_space_get(&test_rb), RB_SIZE);
+}
+
+ZTEST(spsc_ring_buf, test_put_get)
+{
+	uint8_t outbuf[RB_SIZE];
+	uint8_t inbuf[RB_SIZE];
+
+	for (int i = 0; i < RB_SIZE; i++) {
+		inbuf[i] = (uint8_t)i;
+	}
+
+	/* Filling the buffer completely must be possible. */
+	zassert_equal(spsc_ring_buf_put(&test_rb, inbuf, RB_SIZE), RB_SIZE);
+	zassert_equal(spsc_ring_buf_space_get(&test_rb), 0);
+	zassert_equal(spsc_ring_buf_put(&test_rb, inbuf, 1), 0);
+
+	zassert_equal(spsc_ring_buf_get(&test_rb, outbuf, RB_SIZE), RB_SIZE);
+	zassert_mem_equal(outbuf, inbuf, RB_SIZE);
+	zassert_equal(spsc_ring_buf_get(&test_rb, outbuf, 1), 0);
+}
+
+ZTEST(spsc_ring_buf, test_claim_finish_wrap)
+{
+	uint8_t data[48];
+	uint8_t *ptr;
+	uint32_t len;
+
+	memset(data, 0xaa, sizeof(data));
+
+	/* Move the indices close to the end of the buffer, then claim a
+	 * range spanning the wrap-around: the first claim is limited to
+	 * the end of the buffer, a repeated claim returns the remainder.
+	 */
+	zassert_equal(spsc_ring_buf_put(&test_rb, data, 48), 48);
+	zassert_equal(spsc_ring_buf_get(&test_rb, data, 48), 48);
+
+	len = spsc_ring_buf_put_claim(&test_rb, &ptr, 32);
+	zassert_equal(len, 16);
+	memset(ptr, 0x11, len);
+
+	len = spsc_ring_buf_put_claim(&test_rb, &ptr, 16);
+	zassert_equal(len, 16);
+	memset(ptr, 0x22, len);
+
+	zassert_equal(spsc_ring_buf_put_finish(&test_rb, 40), -EINVAL);
+	zassert_equal(spsc_ring_buf_put_finish(&test_rb, 32), 0);
+	zassert_equal(spsc_ring_buf_size_get(&test_rb), 32);
+
+	len = spsc_ring_buf_get_claim(&test_rb, &ptr, 32);
+	zassert_equal(len, 16);
+	zassert_equal(ptr[0], 0x11);
+
+	len = spsc_ring_buf_get_claim(&test_rb, &ptr, 16);
+	zassert_equal(len, 16);
+	zassert_equal(ptr[0], 0x22);
+
+	zassert_equal(spsc_ring_buf_get_finish(&test_rb, 40), -EINVAL);
+	zassert_equal(spsc_ring_buf_get_finish(&test_rb, 32), 0);
+	zassert_equal(spsc_ring_buf_size_get(&test_rb), 0);
+}
+
+ZTEST(spsc_ring_buf, test_finish_partial)
+{
+	uint8_t data[8];
+	uint8_t *ptr;
+
+	/* Surplus claimed bytes are returned on finish. */
+	zassert_equal(spsc_ring_buf_put_claim(&test_rb, &ptr, 8), 8);
+	memset(ptr, 0x5a, 4);
+	zassert_equal(spsc_ring_buf_put_finish(&test_rb, 4), 0);
+	zassert_equal(spsc_ring_buf_size_get(&test_rb), 4);
+
+	zassert_equal(spsc_ring_buf_get_claim(&test_rb, &ptr, 8), 4);
+	zassert_equal(spsc_ring_buf_get_finish(&test_rb, 2), 0);
+	zassert_equal(spsc_ring_buf_size_get(&test_rb), 2);
+
+	zassert_equal(spsc_ring_buf_get(&test_rb, data, 8), 2);
+	zassert_equal(spsc_ring_buf_size_get(&test_rb), 0);
+}
+
+ZTEST(spsc_ring_buf, test_init)
+{
+	static uint8_t buffer[32];
+	struct spsc_ring_buf rb;
+
+	spsc_ring_buf_init(&rb, buffer, sizeof(buffer));
+	zassert_equal(spsc_ring_buf_capacity_get(&rb), sizeof(buffer));
+	zassert_equal(spsc_ring_buf_put(&rb, buffer, 8), 8);
+	zassert_equal(spsc_ring_buf_size_get(&rb), 8);
+
+	spsc_ring_buf_reset(&rb);
+	zassert_equal(spsc_ring_buf_size_get(&rb), 0);
+}
+
+#define STRESS_BYTES 16384
+
+static void producer_thread(void *p1, void *p2, void *p3)
+{
+	uint32_t sent = 0;
+	uint8_t val = 0;
+	uint8_t chunk[13];
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (sent < STRESS_BYTES) {
+		uint32_t len = MIN(sizeof(chunk), STRESS_BYTES - sent);
+
+		for (uint32_t i = 0; i < len; i++) {
+			chunk[i] = val + i;
+		}
+
+		len = spsc_ring_buf_put(&test_rb, chunk, len);
+		sent += len;
+		val += len;
+		if (len == 0) {
+			k_yield();
+		}
+	}
+}
+
+static K_THREAD_STACK_DEFINE(producer_stack, 1024);
+static struct k_thread producer;
+
+ZTEST(spsc_ring_buf, test_concurrent)
+{
+	uint32_t received = 0;
+	uint8_t val = 0;
+	uint8_t chunk[7];
+
+	k_thread_create(&producer, producer_stack, K_THREAD_STACK_SIZEOF(producer_stack),
+			producer_thread, NULL, NULL, NULL,
+			k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+
+	/* Byte stream arriving through the ring must be gapless. */
+	while (received < STRESS_BYTES) {
+		uint32_t len = spsc_ring_buf_get(&test_rb, chunk, sizeof(chunk));
+
+		for (uint32_t i = 0; i < len; i++) {
+			zassert_equal(chunk[i], (uint8_t)(val + i));
+		}
+		received += len;
+		val += len;
+		if (len == 0) {
+			k_yield();
+		}
+	}
+
+	zassert_ok(k_thread_join(&producer, K_SECONDS(10)));
+}
+
+ZTEST_SUITE(spsc_ring_buf, NULL, NULL, test_rb_reset, NULL, NULL);
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/thread_pool.h>
+
+#define NUM_THREADS 2
+#define STACK_SIZE 1024
+
+K_THREAD_POOL_DEFINE(pool, NUM_THREADS, STACK_SIZE, 5);
+
+static K_SEM_DEFINE(job_done, 0, NUM_THREADS);
+static K_SEM_DEFINE(job_release, 0, NUM_THREADS);
+
+static void simple_job(void *p1, void *p2, void *p3)
+{
+	zassert_equal(p1, (void *)1);
+	zassert_equal(p2, (void *)2);
+	zassert_equal(p3, (void *)3);
+
+	k_sem_give(&job_done);
+}
+
+static void blocking_job(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sem_take(&job_release, K_FOREVER);
+	k_sem_give(&job_done);
+}
+
+ZTEST(thread_pool, test_submit)
+{
+	int ret;
+
+	zassert_equal(k_thread_pool_idle_count(&pool), NUM_THREADS);
+
+	ret = k_thread_pool_submit(&pool, simple_job, (void *)1, (void *)2,
+				   (void *)3, K_NO_WAIT);
+	zassert_equal(ret, 0, "submit failed (%d)", ret);
+
+	ret = k_sem_take(&job_done, K_SECONDS(1));
+	zassert_equal(ret, 0, "job did not run");
+
+	/* Wait for the worker to park itself again */
+	k_sleep(K_MSEC(10));
+	zassert_equal(k_thread_pool_idle_count(&pool), NUM_THREADS);
+}
+
+ZTEST(thread_pool, test_pool_exhaustion)
+{
+	int ret;
+
+	/* Tie up every worker in the pool */
+	for (int i = 0; i < NUM_THREADS; i++) {
+		ret = k_thread_pool_submit(&pool, blocking_job, NULL, NULL,
+					   NULL, K_NO_WAIT);
+		zassert_equal(ret, 0, "submit %d failed (%d)", i, ret);
+	}
+
+	zassert_equal(k_thread_pool_idle_count(&pool), 0);
+
+	ret = k_thread_pool_submit(&pool, simple_job, (void *)1, (void *)2,
+				   (void *)3, K_NO_WAIT);
+	zassert_equal(ret, -EBUSY, "expected -EBUSY, got %d", ret);
+
+	ret = k_thread_pool_submit(&pool, simple_job, (void *)1, (void *)2,
+				   (void *)3, K_MSEC(10));
+	zassert_equal(ret, -EAGAIN, "expected -EAGAIN, got %d", ret);
+
+	/* Release one worker and submit with a timeout that allows it
+	 * to be reused.
+	 */
+	k_sem_give(&job_release);
+	ret = k_thread_pool_submit(&pool, simple_job, (void *)1, (void *)2,
+				   (void *)3, K_SECONDS(1));
+	zassert_equal(ret, 0, "submit after release failed (%d)", ret);
+
+	k_sem_give(&job_release);
+
+	for (int i = 0; i < NUM_THREADS + 1; i++) {
+		ret = k_sem_take(&job_done, K_SECONDS(1));
+		zassert_equal(ret, 0, "job %d did not finish", i);
+	}
+
+	k_sleep(K_MSEC(10));
+	zassert_equal(k_thread_pool_idle_count(&pool), NUM_THREADS);
+}
+
+ZTEST_SUITE(thread_pool, NULL, NULL, NULL, NULL, NULL);
@@ -494,4 +494,118 @@ ZTEST(http2_hpack, test_http2_hpack_literal_not_indexed_decode)
 				 ARRAY_SIZE(test_enc_literal_not_indexed_headers));
 }
 
+#if defined(CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE)
+static struct http_hpack_enc_table test_enc_table;
+
+ZTEST(http2_hpack, test_http2_hpack_dynamic_encode)
+{
+	struct http_hpack_header_buf hdr = {
+		.name = "server",
+		.value = "Zephyr",
+		.name_len = 6,
+		.value_len = 6,
+	};
+	int ret;
+
+	http_hpack_enc_table_init(&test_enc_table);
+
+	/* First occurrence, literal with incremental indexing, name from
+	 * the static table (index 54).
+	 */
+	ret = http_hpack_encode_header_dyn(test_buf, sizeof(test_buf), &hdr,
+					   &test_enc_table);
+	zassert_true(ret > 1, "Expected literal encoding");
+	zassert_equal(test_buf[0], 0x76, "Expected indexed name");
+
+	/* Repeated header, indexed from the dynamic table (index 62). */
+	ret = http_hpack_encode_header_dyn(test_buf, sizeof(test_buf), &hdr,
+					   &test_enc_table);
+	zassert_equal(ret, 1, "Expected indexed encoding");
+	zassert_equal(test_buf[0], 0xbe, "Wrong dynamic table index");
+
+	/* New value for the same name adds a new entry, pushing the old
+	 * one to index 63.
+	 */
+	hdr.value = "other";
+	hdr.value_len = 5;
+
+	ret = http_hpack_encode_header_dyn(test_buf, sizeof(test_buf), &hdr,
+					   &test_enc_table);
+	zassert_true(ret > 1, "Expected literal encoding");
+
+	ret = http_hpack_encode_header_dyn(test_buf, sizeof(test_buf), &hdr,
+					   &test_enc_table);
+	zassert_equal(ret, 1, "Expected indexed encoding");
+	zassert_equal(test_buf[0], 0xbe, "Wrong dynamic table index");
+
+	hdr.value = "Zephyr";
+	hdr.value_len = 6;
+
+	ret = http_hpack_encode_header_dyn(test_buf, sizeof(test_buf), &hdr,
+					   &test_enc_table);
+	zassert_equal(ret, 1, "Expected indexed encoding");
+	zassert_equal(test_buf[0], 0xbf, "Wrong dynamic table index");
+}
+
+ZTEST(http2_hpack, test_http2_hpack_dynamic_encode_no_static_name)
+{
+	struct http_hpack_header_buf hdr = {
+		.name = "custom-key",
+		.value = "custom-value",
+		.name_len = 10,
+		.value_len = 12,
+	};
+	int ret;
+
+	http_hpack_enc_table_init(&test_enc_table);
+
+	ret = http_hpack_encode_header_dyn(test_buf, sizeof(test_buf), &hdr,
+					   &test_enc_table);
+	zassert_true(ret > 1, "Expected literal encoding");
+	zassert_equal(test_buf[0], 0x40, "Expected literal name");
+
+	ret = http_hpack_encode_header_dyn(test_buf, sizeof(test_buf), &hdr,
+					   &test_enc_table);
+	zassert_equal(ret, 1, "Expected indexed encoding");
+	zassert_equal(test_buf[0], 0xbe, "Wrong dynamic table index");
+}
+
+ZTEST(http2_hpack, test_http2_hpack_dynamic_table_resize)
+{
+	struct http_hpack_header_buf hdr = {
+		.name = "server",
+		.value = "Zephyr",
+		.name_len = 6,
+		.value_len = 6,
+	};
+	/* Dynamic table size update to 64: 5-bit prefix 0x3f + 33. */
+	uint8_t size_update[] = { 0x3f, 0x21 };
+	int ret;
+
+	http_hpack_enc_table_init(&test_enc_table);
+
+	ret = http_hpack_encode_header_dyn(test_buf, sizeof(test_buf), &hdr,
+					   &test_enc_table);
+	zassert_true(ret > 1, "Expected literal encoding");
+
+	http_hpack_enc_table_resize(&test_enc_table, 64);
+
+	/* The resize must be signaled at the start of the next header
+	 * block, the previously indexed entry still fits in 64 bytes.
+	 */
+	ret = http_hpack_encode_header_dyn(test_buf, sizeof(test_buf), &hdr,
+					   &test_enc_table);
+	zassert_equal(ret, sizeof(size_update) + 1, "Wrong encoding length");
+	zassert_mem_equal(test_buf, size_update, sizeof(size_update),
+			  "Missing dynamic table size update");
+	zassert_equal(test_buf[sizeof(size_update)], 0xbe,
+		      "Wrong dynamic table index");
+
+	/* Resizing to zero evicts all entries. */
+	http_hpack_enc_table_resize(&test_enc_table, 0);
+	zassert_equal(test_enc_table.count, 0, "Expected empty table");
+	zassert_equal(test_enc_table.size, 0, "Expected empty table");
+}
+#endif /* CONFIG_HTTP_SERVER_HPACK_DYNAMIC_TABLE */
+
 ZTEST_SUITE(http2_hpack, NULL, NULL, NULL, NULL, NULL);
@@ -425,6 +425,50 @@ static ZTEST(mqtt_sn_client, test_mqtt_sn_publish_qos0)
 	zassert_false(sys_slist_is_empty(&mqtt_client->topic), "Topic empty");
 }
 
+#ifdef CONFIG_MQTT_SN_LIB_AGGREGATE_PUBLISH
+/* Test that two queued PUBLISH messages share one transport datagram */
+static ZTEST(mqtt_sn_client, test_mqtt_sn_publish_aggregate)
+{
+	struct mqtt_sn_data data = MQTT_SN_DATA_STRING_LITERAL("Hello, World!");
+	struct mqtt_sn_data topic = MQTT_SN_DATA_STRING_LITERAL("zephyr");
+	/* registration ack with topic ID 0x1A1B, msg ID 0x0001, return code accepted */
+	uint8_t regack[] = {7, 0x0B, 0x1A, 0x1B, 0x00, 0x01, 0};
+	int err;
+
+	mqtt_sn_connect_no_will(mqtt_client);
+	err = k_sem_take(&mqtt_sn_tx_sem, K_NO_WAIT);
+
+	/* Register the topic through a first publish */
+	err = mqtt_sn_publish(mqtt_client, MQTT_SN_QOS_0, &topic, false, &data);
+	zassert_equal(err, 0, "Unexpected error %d", err);
+
+	/* Expect a REGISTER to be sent */
+	err = k_sem_take(&mqtt_sn_tx_sem, K_SECONDS(10));
+	zassert_equal(err, 0, "Timed out waiting for callback.");
+	assert_msg_send(1, 12, &gw_addr);
+
+	/* Send REGACK in response - the pending PUBLISH goes out alone */
+	err = input(mqtt_client, regack, sizeof(regack), &gw_addr);
+	zassert_equal(err, 0, "unexpected error %d");
+	err = k_sem_take(&mqtt_sn_tx_sem, K_SECONDS(10));
+	zassert_equal(err, 0, "Timed out waiting for callback.");
+	assert_msg_send(1, 20, &gw_addr);
+
+	/* Two publishes within the flush deadline share one datagram */
+	err = mqtt_sn_publish(mqtt_client, MQTT_SN_QOS_0, &topic, false, &data);
+	zassert_equal(err, 0, "Unexpected error %d", err);
+	err = mqtt_sn_publish(mqtt_client, MQTT_SN_QOS_0, &topic, false, &data);
+	zassert_equal(err, 0, "Unexpected error %d", err);
+
+	err = k_sem_take(&mqtt_sn_tx_sem, K_SECONDS(10));
+	zassert_equal(err, 0, "Timed out waiting for callback.");
+	assert_msg_send(1, 40, &gw_addr);
+
+	/* Expect publishes to be empty - all done */
+	zassert_true(sys_slist_is_empty(&mqtt_client->publish), "Publish not empty");
+}
+#endif /* CONFIG_MQTT_SN_LIB_AGGREGATE_PUBLISH */
+
 /*
  * Test two PUBLISH messages
  *
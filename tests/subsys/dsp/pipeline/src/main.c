@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/dsp/dsp.h>
+#include <zephyr/dsp/pipeline.h>
+
+#define BLOCK_SIZE 16
+
+static q15_t scratch_a[BLOCK_SIZE];
+static q15_t scratch_b[BLOCK_SIZE];
+
+struct scale_q15_ctx {
+	q15_t fract;
+	int8_t shift;
+};
+
+static uint32_t stage_scale_q15(const void *src, void *dst, uint32_t block_size, void *ctx)
+{
+	const struct scale_q15_ctx *scale = ctx;
+
+	zdsp_scale_q15(src, scale->fract, scale->shift, dst, block_size);
+	return block_size;
+}
+
+static uint32_t stage_abs_q15(const void *src, void *dst, uint32_t block_size, void *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	zdsp_abs_q15(src, dst, block_size);
+	return block_size;
+}
+
+static uint32_t stage_decimate2_q15(const void *src, void *dst, uint32_t block_size, void *ctx)
+{
+	const q15_t *in = src;
+	q15_t *out = dst;
+
+	ARG_UNUSED(ctx);
+
+	for (uint32_t i = 0; i < block_size / 2; i++) {
+		out[i] = in[2 * i];
+	}
+	return block_size / 2;
+}
+
+ZTEST(zdsp_pipeline, test_single_stage)
+{
+	const struct zdsp_pipeline_stage stages[] = {
+		{.process = stage_abs_q15},
+	};
+	struct zdsp_pipeline pipeline;
+	q15_t input[BLOCK_SIZE];
+	q15_t output[BLOCK_SIZE];
+	uint32_t count;
+
+	for (int i = 0; i < BLOCK_SIZE; i++) {
+		input[i] = (q15_t)(-100 * i);
+	}
+
+	zdsp_pipeline_init(&pipeline, stages, ARRAY_SIZE(stages), NULL, NULL);
+	count = zdsp_pipeline_run(&pipeline, input, output, BLOCK_SIZE);
+
+	zassert_equal(count, BLOCK_SIZE);
+	for (int i = 0; i < BLOCK_SIZE; i++) {
+		zassert_equal(output[i], (q15_t)(100 * i), "index %d: %d", i, output[i]);
+	}
+}
+
+ZTEST(zdsp_pipeline, test_chain_ping_pong)
+{
+	struct scale_q15_ctx scale = {.fract = 0x4000 /* 0.5 in q15 */, .shift = 1};
+	const struct zdsp_pipeline_stage stages[] = {
+		{.process = stage_scale_q15, .ctx = &scale},
+		{.process = stage_abs_q15},
+		{.process = stage_scale_q15, .ctx = &scale},
+	};
+	struct zdsp_pipeline pipeline;
+	q15_t input[BLOCK_SIZE];
+	q15_t output[BLOCK_SIZE];
+	uint32_t count;
+
+	for (int i = 0; i < BLOCK_SIZE; i++) {
+		input[i] = (q15_t)(-16 * i);
+	}
+
+	zdsp_pipeline_init(&pipeline, stages, ARRAY_SIZE(stages), scratch_a, scratch_b);
+	count = zdsp_pipeline_run(&pipeline, input, output, BLOCK_SIZE);
+
+	/* scale by 1.0, abs, scale by 1.0: output is abs(input) */
+	zassert_equal(count, BLOCK_SIZE);
+	for (int i = 0; i < BLOCK_SIZE; i++) {
+		zassert_equal(output[i], (q15_t)(16 * i), "index %d: %d", i, output[i]);
+	}
+}
+
+ZTEST(zdsp_pipeline, test_rate_change)
+{
+	const struct zdsp_pipeline_stage stages[] = {
+		{.process = stage_abs_q15},
+		{.process = stage_decimate2_q15},
+		{.process = stage_decimate2_q15},
+	};
+	struct zdsp_pipeline pipeline;
+	q15_t input[BLOCK_SIZE];
+	q15_t output[BLOCK_SIZE / 4];
+	uint32_t count;
+
+	for (int i = 0; i < BLOCK_SIZE; i++) {
+		input[i] = (q15_t)(-i);
+	}
+
+	zdsp_pipeline_init(&pipeline, stages, ARRAY_SIZE(stages), scratch_a, scratch_b);
+	count = zdsp_pipeline_run(&pipeline, input, output, BLOCK_SIZE);
+
+	zassert_equal(count, BLOCK_SIZE / 4);
+	for (int i = 0; i < BLOCK_SIZE / 4; i++) {
+		zassert_equal(output[i], (q15_t)(4 * i), "index %d: %d", i, output[i]);
+	}
+}
+
+ZTEST_SUITE(zdsp_pipeline, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "fcb_test.h"
+
+#define BATCH_CNT 32
+
+static void test_fcb_append_batch(struct fcb *_fcb)
+{
+	static uint8_t test_datas[BATCH_CNT][BATCH_CNT];
+	static struct fcb_batch_entry batch[BATCH_CNT];
+	uint8_t work_buf[64];
+	int var_cnt;
+	int rc;
+	int i;
+	int j;
+
+	for (i = 0; i < BATCH_CNT; i++) {
+		for (j = 0; j < i; j++) {
+			test_datas[i][j] = fcb_test_append_data(i, j);
+		}
+		batch[i].data = test_datas[i];
+		batch[i].len = i;
+	}
+
+	rc = fcb_append_batch(_fcb, batch, BATCH_CNT, work_buf, sizeof(work_buf));
+	zassert_true(rc == 0, "fcb_append_batch call failure");
+
+	var_cnt = 0;
+	rc = fcb_walk(_fcb, 0, fcb_test_data_walk_cb, &var_cnt);
+	zassert_true(rc == 0, "fcb_walk call failure");
+	zassert_true(var_cnt == BATCH_CNT,
+		     "fetched entry count not match to wrote entry count");
+
+	/* A batch with an entry which does not fit in the work buffer is
+	 * rejected before anything is written.
+	 */
+	rc = fcb_append_batch(_fcb, batch, BATCH_CNT, work_buf, 8);
+	zassert_true(rc == -ENOMEM, "fcb_append_batch accepted too small work buffer");
+
+	var_cnt = 0;
+	rc = fcb_walk(_fcb, 0, fcb_test_data_walk_cb, &var_cnt);
+	zassert_true(rc == 0, "fcb_walk call failure");
+	zassert_true(var_cnt == BATCH_CNT,
+		     "rejected batch modified fcb contents");
+}
+
+ZTEST(fcb_test_with_2sectors_set, test_fcb_append_batch_2sectors)
+{
+	test_fcb_append_batch(&test_fcb);
+}
+
+ZTEST(fcb_test_crc_disabled, test_fcb_append_batch_crc_disabled)
+{
+	test_fcb_append_batch(&test_fcb_crc_disabled);
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "fcb_test.h"
+
+#if defined(CONFIG_FCB_ENTRY_CACHE)
+#define CACHE_TEST_ROUNDS 3
+#define CACHE_TEST_LENS 128
+
+static struct fcb_cache_entry cache_entries[CACHE_TEST_ROUNDS * CACHE_TEST_LENS];
+
+/* Verify entry data against the pattern written by the append loop and
+ * count the entries.
+ */
+static int entry_check_cb(struct fcb_entry_ctx *entry_ctx, void *arg)
+{
+	uint8_t test_data[CACHE_TEST_LENS];
+	int *cnt = (int *)arg;
+	uint16_t len;
+	int rc;
+	int i;
+
+	len = entry_ctx->loc.fe_data_len;
+	zassert_true(len < sizeof(test_data), "unexpected entry length");
+
+	rc = flash_area_read(entry_ctx->fap,
+			     FCB_ENTRY_FA_DATA_OFF(entry_ctx->loc),
+			     test_data, len);
+	zassert_true(rc == 0, "read call failure");
+
+	for (i = 0; i < len; i++) {
+		zassert_true(test_data[i] == fcb_test_append_data(len, i),
+			     "entry data readout misrepresentation");
+	}
+	(*cnt)++;
+	return 0;
+}
+#endif
+
+ZTEST(fcb_test_with_4sectors_set, test_fcb_entry_cache)
+{
+#if defined(CONFIG_FCB_ENTRY_CACHE)
+	struct fcb *_fcb = &test_fcb;
+	uint8_t test_data[CACHE_TEST_LENS];
+	struct fcb_entry loc;
+	int var_cnt;
+	int cnt;
+	int rc;
+	int i;
+	int j;
+	int len;
+
+	/* A third of the entries exists before the cache is attached and
+	 * is picked up by the initial scan, the rest is added to the cache
+	 * as the entries are appended. The amount of data spans multiple
+	 * sectors, so that rotation leaves entries behind.
+	 */
+	for (i = 0; i < CACHE_TEST_ROUNDS * CACHE_TEST_LENS; i++) {
+		if (i == CACHE_TEST_LENS) {
+			rc = fcb_cache_init(_fcb, cache_entries,
+					    ARRAY_SIZE(cache_entries));
+			zassert_true(rc == 0, "fcb_cache_init call failure");
+		}
+		len = i % CACHE_TEST_LENS;
+		for (j = 0; j < len; j++) {
+			test_data[j] = fcb_test_append_data(len, j);
+		}
+		rc = fcb_append(_fcb, len, &loc);
+		zassert_true(rc == 0, "fcb_append call failure");
+		rc = flash_area_write(_fcb->fap, FCB_ENTRY_FA_DATA_OFF(loc),
+				      test_data, len);
+		zassert_true(rc == 0, "flash_area_write call failure");
+		rc = fcb_append_finish(_fcb, &loc);
+		zassert_true(rc == 0, "fcb_append_finish call failure");
+	}
+
+	var_cnt = 0;
+	rc = fcb_walk(_fcb, 0, entry_check_cb, &var_cnt);
+	zassert_true(rc == 0, "fcb_walk call failure");
+	zassert_true(var_cnt == CACHE_TEST_ROUNDS * CACHE_TEST_LENS,
+		     "cached walk missed entries");
+
+	/* Rotating drops the oldest sector from the cache as well. Verify
+	 * every location the cache serves against the flash contents.
+	 */
+	rc = fcb_rotate(_fcb);
+	zassert_true(rc == 0, "fcb_rotate call failure");
+
+	(void)memset(&loc, 0, sizeof(loc));
+	var_cnt = 0;
+	while (fcb_getnext(_fcb, &loc) == 0) {
+		struct fcb_entry chk = loc;
+
+		rc = fcb_elem_info(_fcb, &chk);
+		zassert_true(rc == 0, "cached entry location invalid");
+		zassert_true(chk.fe_data_len == loc.fe_data_len,
+			     "cached entry length invalid");
+		var_cnt++;
+	}
+	zassert_true(var_cnt > 0 &&
+		     var_cnt < CACHE_TEST_ROUNDS * CACHE_TEST_LENS,
+		     "rotate not reflected in cache");
+
+	/* A cache too small for the stored entries is rejected and lookups
+	 * fall back to walking the flash contents.
+	 */
+	rc = fcb_cache_init(_fcb, cache_entries, 4);
+	zassert_true(rc == -ENOMEM, "undersized cache not rejected");
+
+	cnt = 0;
+	rc = fcb_walk(_fcb, 0, entry_check_cb, &cnt);
+	zassert_true(rc == 0, "fcb_walk call failure");
+	zassert_true(cnt == var_cnt, "fallback walk entry count mismatch");
+#else
+	ztest_test_skip();
+#endif
+}
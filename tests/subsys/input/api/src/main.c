@@ -84,6 +84,108 @@ ZTEST(input_api, test_sequence_thread)
 	zassert_equal(message_count_unfiltered, CONFIG_INPUT_QUEUE_MAX_MSGS + 1);
 }
 
+#ifdef CONFIG_INPUT_EVENT_FRAMES
+
+static const struct device fake_frame_dev;
+static struct input_event frame_events[CONFIG_INPUT_EVENT_FRAME_MAX_EVENTS];
+static uint16_t frame_event_count;
+static int frame_cb_calls;
+
+static K_SEM_DEFINE(frame_block, 1, 1);
+static K_SEM_DEFINE(frame_done, 0, 1);
+
+static void input_frame_cb(struct input_event *evts, uint16_t count,
+			   void *user_data)
+{
+	memcpy(frame_events, evts, count * sizeof(*evts));
+	frame_event_count = count;
+	frame_cb_calls++;
+
+	k_sem_give(&frame_done);
+}
+INPUT_FRAME_CALLBACK_DEFINE(&fake_frame_dev, input_frame_cb, NULL);
+
+/* Used to hold up the input thread so that the queue can back up. */
+static void input_cb_frame_blocker(struct input_event *evt, void *user_data)
+{
+	if (evt->dev == &fake_frame_dev) {
+		k_sem_take(&frame_block, K_FOREVER);
+		k_sem_give(&frame_block);
+	}
+}
+INPUT_CALLBACK_DEFINE(NULL, input_cb_frame_blocker, NULL);
+
+ZTEST(input_api, test_frame_delivery)
+{
+	int ret;
+
+	frame_cb_calls = 0;
+
+	ret = input_report_abs(&fake_frame_dev, INPUT_ABS_X, 10, false, K_FOREVER);
+	zassert_equal(ret, 0, "ret: %d", ret);
+	ret = input_report_abs(&fake_frame_dev, INPUT_ABS_Y, 20, false, K_FOREVER);
+	zassert_equal(ret, 0, "ret: %d", ret);
+	ret = input_report_abs(&fake_frame_dev, INPUT_ABS_Z, 30, true, K_FOREVER);
+	zassert_equal(ret, 0, "ret: %d", ret);
+
+	ret = k_sem_take(&frame_done, K_SECONDS(1));
+	zassert_equal(ret, 0, "ret: %d", ret);
+
+	zassert_equal(frame_cb_calls, 1);
+	zassert_equal(frame_event_count, 3);
+	zassert_equal(frame_events[0].code, INPUT_ABS_X);
+	zassert_equal(frame_events[0].value, 10);
+	zassert_equal(frame_events[0].sync, 0);
+	zassert_equal(frame_events[1].code, INPUT_ABS_Y);
+	zassert_equal(frame_events[1].value, 20);
+	zassert_equal(frame_events[1].sync, 0);
+	zassert_equal(frame_events[2].code, INPUT_ABS_Z);
+	zassert_equal(frame_events[2].value, 30);
+	zassert_equal(frame_events[2].sync, 1);
+}
+
+#ifdef CONFIG_INPUT_EVENT_FRAME_COALESCE
+
+ZTEST(input_api, test_frame_coalesce)
+{
+	int ret;
+
+	frame_cb_calls = 0;
+
+	/* Block the input thread on the first event so that both frames are
+	 * queued up before any of them is processed.
+	 */
+	k_sem_take(&frame_block, K_FOREVER);
+
+	ret = input_report_abs(&fake_frame_dev, INPUT_ABS_X, 1, false, K_FOREVER);
+	zassert_equal(ret, 0, "ret: %d", ret);
+	ret = input_report_abs(&fake_frame_dev, INPUT_ABS_Y, 2, true, K_FOREVER);
+	zassert_equal(ret, 0, "ret: %d", ret);
+	ret = input_report_abs(&fake_frame_dev, INPUT_ABS_X, 3, false, K_FOREVER);
+	zassert_equal(ret, 0, "ret: %d", ret);
+	ret = input_report_abs(&fake_frame_dev, INPUT_ABS_Y, 4, true, K_FOREVER);
+	zassert_equal(ret, 0, "ret: %d", ret);
+
+	k_sem_give(&frame_block);
+
+	ret = k_sem_take(&frame_done, K_SECONDS(1));
+	zassert_equal(ret, 0, "ret: %d", ret);
+
+	/* The first frame was stale by the time it completed, the values of
+	 * the second one coalesced into it.
+	 */
+	zassert_equal(frame_cb_calls, 1);
+	zassert_equal(frame_event_count, 2);
+	zassert_equal(frame_events[0].code, INPUT_ABS_X);
+	zassert_equal(frame_events[0].value, 3);
+	zassert_equal(frame_events[1].code, INPUT_ABS_Y);
+	zassert_equal(frame_events[1].value, 4);
+}
+
+#endif /* CONFIG_INPUT_EVENT_FRAME_COALESCE */
+
+#endif /* CONFIG_INPUT_EVENT_FRAMES */
+
 #else /* CONFIG_INPUT_MODE_THREAD */
 
 static void input_cb_filtered(struct input_event *evt, void *user_data)
@@ -106,6 +106,59 @@ ZTEST(test_pbuf, test_rw)
 	zassert_mem_equal(write_buf, read_buf, MPS);
 }
 
+ZTEST(test_pbuf, test_stage_commit)
+{
+	uint8_t read_buf[MEM_AREA_SZ] = {0};
+	uint8_t write_buf[MEM_AREA_SZ];
+	int ret;
+
+	/* TODO: Use PBUF_DEFINE().
+	 * The user should use PBUF_DEFINE() macro to define the buffer,
+	 * however for the purpose of this test PBUF_CFG_INIT() is used in
+	 * order to avoid clang complains about memory_area not being constant
+	 * expression.
+	 */
+	static PBUF_MAYBE_CONST struct pbuf_cfg cfg = PBUF_CFG_INIT(memory_area, MEM_AREA_SZ, 0, 0);
+
+	static struct pbuf pb = {
+		.cfg = &cfg,
+	};
+
+	for (size_t i = 0; i < MEM_AREA_SZ; i++) {
+		write_buf[i] = i+1;
+	}
+
+	zassert_equal(pbuf_tx_init(&pb), 0);
+
+	/* Staged packets are not visible to the reader. */
+	ret = pbuf_write_stage(&pb, write_buf, MSGA_SZ);
+	zassert_equal(ret, MSGA_SZ);
+	ret = pbuf_write_stage(&pb, write_buf+MSGA_SZ, MSGB_SZ);
+	zassert_equal(ret, MSGB_SZ);
+	ret = pbuf_read(&pb, NULL, 0);
+	zassert_equal(ret, 0);
+
+	/* A single commit publishes them all at once. */
+	zassert_equal(pbuf_write_commit(&pb), 0);
+	ret = pbuf_read(&pb, NULL, 0);
+	zassert_equal(ret, MSGA_SZ);
+	ret = pbuf_read(&pb, read_buf, ret);
+	zassert_equal(ret, MSGA_SZ);
+	zassert_mem_equal(read_buf, write_buf, ret);
+	ret = pbuf_read(&pb, NULL, 0);
+	zassert_equal(ret, MSGB_SZ);
+	ret = pbuf_read(&pb, read_buf, ret);
+	zassert_equal(ret, MSGB_SZ);
+	zassert_mem_equal(read_buf, write_buf+MSGA_SZ, ret);
+
+	/* Commit with nothing staged is a no-op. */
+	zassert_equal(pbuf_write_commit(&pb), 0);
+	zassert_equal(pbuf_read(&pb, NULL, 0), 0);
+
+	/* pbuf_write_commit incorrect params test. */
+	zassert_equal(pbuf_write_commit(NULL), -EINVAL);
+}
+
 /* API ret codes tests. */
 ZTEST(test_pbuf, test_retcodes)
 {
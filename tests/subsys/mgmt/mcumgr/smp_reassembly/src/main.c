@@ -40,17 +40,37 @@ ZTEST(smp_reassembly, test_first)
 
 	/** First fragment errors **/
 	/* Len longer than netbuf error */
-	zassert_equal(-ENOSR, smp_reassembly_collect(&smpt, buff, TRANSPORT_NETBUF_SIZE + 1),
-		      "Expected -ENOSR error");
+	if (IS_ENABLED(CONFIG_MCUMGR_TRANSPORT_REASSEMBLY_ARENA)) {
+		/* With the arena there is no hard fragment size limit and the fragment is
+		 * instead checked against the packet length from the header, which is 0 here.
+		 */
+		mh->nh_len = 0;
+		zassert_equal(-EOVERFLOW,
+			      smp_reassembly_collect(&smpt, buff, TRANSPORT_NETBUF_SIZE + 1),
+			      "Expected -EOVERFLOW error");
+	} else {
+		zassert_equal(-ENOSR,
+			      smp_reassembly_collect(&smpt, buff, TRANSPORT_NETBUF_SIZE + 1),
+			      "Expected -ENOSR error");
+	}
 	/* Len not enough to read expected size from header */
 	zassert_equal(-ENODATA,
 		      smp_reassembly_collect(&smpt, buff, sizeof(struct smp_hdr) - 1),
 		      "Expected -ENODATA error");
 	/* Length extracted from header, plus size of header, is bigger than buffer */
 	mh->nh_len = sys_cpu_to_be16(TRANSPORT_NETBUF_SIZE - sizeof(struct smp_hdr) + 1);
-	zassert_equal(-ENOSR,
-		      smp_reassembly_collect(&smpt, buff, sizeof(struct smp_hdr) + 1),
-		      "Expected -ENOSR error");
+	if (IS_ENABLED(CONFIG_MCUMGR_TRANSPORT_REASSEMBLY_ARENA)) {
+		/* Such a packet goes to the arena instead of being rejected */
+		expected = TRANSPORT_NETBUF_SIZE + 1 - (sizeof(struct smp_hdr) + 1);
+		ret = smp_reassembly_collect(&smpt, buff, sizeof(struct smp_hdr) + 1);
+		zassert_equal(expected, ret,
+			      "Expected is %d should be %d\n", ret, expected);
+		zassert_equal(0, smp_reassembly_drop(&smpt), "Expected successful drop");
+	} else {
+		zassert_equal(-ENOSR,
+			      smp_reassembly_collect(&smpt, buff, sizeof(struct smp_hdr) + 1),
+			      "Expected -ENOSR error");
+	}
 
 	/* Successfully alloc buffer */
 	mh->nh_len = sys_cpu_to_be16(TEST_FRAME_SIZE - sizeof(struct smp_hdr));
@@ -160,6 +180,68 @@ ZTEST(smp_reassembly, test_collection)
 	smp_packet_free(backup);
 }
 
+ZTEST(smp_reassembly, test_arena_collection)
+{
+#if defined(CONFIG_MCUMGR_TRANSPORT_REASSEMBLY_ARENA)
+	struct smp_hdr *mh = (struct smp_hdr *)buff;
+	int pkt_size = TRANSPORT_NETBUF_SIZE + 64;
+	int pkt_used;
+	int ret;
+	int expected;
+	int frag;
+
+	for (int i = 0; i < ARRAY_SIZE(buff); i++) {
+		buff[i] = (i % 255) + 1;
+	}
+
+	/* Packet length from the header is larger than the arena */
+	mh->nh_len = sys_cpu_to_be16(CONFIG_MCUMGR_TRANSPORT_REASSEMBLY_ARENA_SIZE);
+	zassert_equal(-ENOSR,
+		      smp_reassembly_collect(&smpt, buff, sizeof(struct smp_hdr) + 1),
+		      "Expected -ENOSR error");
+
+	/* Collect a packet too large for a regular buffer but fitting the arena */
+	mh->nh_len = sys_cpu_to_be16(pkt_size - sizeof(struct smp_hdr));
+	frag = 40;
+	ret = smp_reassembly_collect(&smpt, buff, frag);
+	expected = pkt_size - frag;
+	zassert_equal(expected, ret,
+		      "Expected is %d should be %d\n", ret, expected);
+	pkt_used = frag;
+
+	while (pkt_used < pkt_size) {
+		frag = MIN(frag, pkt_size - pkt_used);
+		ret = smp_reassembly_collect(&smpt, &buff[pkt_used % frag], frag);
+		pkt_used += frag;
+		expected = pkt_size - pkt_used;
+		zassert_equal(expected, ret,
+			      "Expected is %d should be %d\n", ret, expected);
+	}
+
+	ret = smp_reassembly_complete(&smpt, false);
+	zassert_equal(0, ret,
+		      "Expected 0 from complete, got %d\n", ret);
+
+	zassert_equal(pkt_size, backup->len,
+		      "Expected %d bytes in reassembled packet, got %d\n",
+		      pkt_size, backup->len);
+	zassert_mem_equal(backup->data, buff, 40, "Failed to assemble packet");
+
+	/* This will normally be done by packet processing and should not be done by hand:
+	 * release the buffer to the pool
+	 */
+	smp_packet_free(backup);
+
+	/* The arena can be claimed again after the packet was released */
+	ret = smp_reassembly_collect(&smpt, buff, 40);
+	zassert_equal(pkt_size - 40, ret,
+		      "Expected is %d should be %d\n", ret, pkt_size - 40);
+	zassert_equal(0, smp_reassembly_drop(&smpt), "Expected successful drop");
+#else
+	ztest_test_skip();
+#endif /* CONFIG_MCUMGR_TRANSPORT_REASSEMBLY_ARENA */
+}
+
 ZTEST(smp_reassembly, test_no_packet_started)
 {
 	int ret;
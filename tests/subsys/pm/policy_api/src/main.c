@@ -336,4 +336,44 @@ ZTEST(policy_api, test_pm_policy_events)
 	pm_policy_event_unregister(&evt2);
 }
 
+#ifdef CONFIG_PM_POLICY_EVENT_WAKEUP
+static K_SEM_DEFINE(wakeup_sem, 0, 2);
+
+static void wakeup_cb(struct pm_policy_event *evt)
+{
+	ARG_UNUSED(evt);
+
+	k_sem_give(&wakeup_sem);
+}
+
+/**
+ * @brief Test wake-up delivery for policy events.
+ *
+ * Expected behavior: callbacks of events with deadlines within the
+ * coalescing window of each other are both served, no earlier than the
+ * window ahead of the deadline, and the events are unregistered.
+ */
+ZTEST(policy_api, test_pm_policy_event_wakeup)
+{
+	struct pm_policy_event evt1;
+	struct pm_policy_event evt2;
+	int64_t deadline = k_uptime_ticks() + k_ms_to_ticks_ceil64(20);
+
+	pm_policy_event_register_wakeup(&evt1, deadline, wakeup_cb);
+	pm_policy_event_register_wakeup(&evt2, deadline + 1, wakeup_cb);
+
+	zassert_ok(k_sem_take(&wakeup_sem, K_MSEC(100)));
+	zassert_ok(k_sem_take(&wakeup_sem, K_MSEC(100)));
+
+	zassert_true(k_uptime_ticks() >=
+		     deadline - k_us_to_ticks_ceil64(CONFIG_PM_POLICY_EVENT_WAKEUP_COALESCE_US));
+	zassert_equal(pm_policy_next_event_ticks(), -1);
+}
+#else
+ZTEST(policy_api, test_pm_policy_event_wakeup)
+{
+	ztest_test_skip();
+}
+#endif /* CONFIG_PM_POLICY_EVENT_WAKEUP */
+
 ZTEST_SUITE(policy_api, NULL, NULL, NULL, NULL, NULL);
@@ -77,6 +77,43 @@ ZTEST(rtio_api, test_rtio_simple)
 	}
 }
 
+/**
+ * @brief Test batched consuming of completion events
+ *
+ * Ensures that a batch of completions can be consumed in a single call and
+ * that an empty completion queue results in an empty batch.
+ */
+ZTEST(rtio_api, test_rtio_consume_n)
+{
+	int res;
+	uintptr_t userdata[4] = {0, 1, 2, 3};
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqes[4];
+
+	rtio_iodev_test_init(&iodev_test_simple);
+
+	for (int i = 0; i < 4; i++) {
+		sqe = rtio_sqe_acquire(&r_simple);
+		zassert_not_null(sqe, "Expected a valid sqe");
+		rtio_sqe_prep_nop(sqe, (struct rtio_iodev *)&iodev_test_simple, &userdata[i]);
+	}
+
+	res = rtio_submit(&r_simple, 4);
+	zassert_ok(res, "Should return ok from rtio_execute");
+
+	res = rtio_cqe_consume_n(&r_simple, cqes, 4);
+	zassert_equal(4, res, "Expected 4 cqes");
+
+	for (int i = 0; i < 4; i++) {
+		zassert_ok(cqes[i]->result, "Result should be ok");
+		zassert_equal_ptr(cqes[i]->userdata, &userdata[i], "Expected in order completions");
+		rtio_cqe_release(&r_simple, cqes[i]);
+	}
+
+	res = rtio_cqe_consume_n(&r_simple, cqes, 4);
+	zassert_equal(0, res, "Expected an empty completion queue");
+}
+
 ZTEST(rtio_api, test_rtio_no_response)
 {
 	int res;
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/types.h>
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/flash.h>
+
+#include <zephyr/storage/flash_agg.h>
+
+#define MAX_PAGE_SIZE 0x1000 /* Max supported page size to run test on */
+#define SOC_NV_FLASH_NODE DT_INST(0, soc_nv_flash)
+#define FLASH_SIZE DT_REG_SIZE(SOC_NV_FLASH_NODE)
+
+/* so that we don't overwrite the application when running on hw */
+#define FLASH_BASE (128*1024)
+
+static const struct device *const fdev = DEVICE_DT_GET(DT_CHOSEN(zephyr_flash_controller));
+static struct flash_agg_ctx ctx;
+static size_t page_size;
+static uint8_t page_buf[MAX_PAGE_SIZE];
+static uint8_t read_buf[MAX_PAGE_SIZE];
+static uint8_t erase_value;
+
+static void erase_flash(void)
+{
+#if defined(CONFIG_FLASH_HAS_EXPLICIT_ERASE)
+	int rc = flash_erase(fdev, FLASH_BASE, page_size * 2);
+
+	zassert_equal(rc, 0, "should succeed");
+#endif
+}
+
+static void init_target(void)
+{
+	int rc = flash_agg_init(&ctx, fdev, page_buf, page_size);
+
+	zassert_equal(rc, 0, "expected success");
+
+	erase_flash();
+}
+
+ZTEST(lib_flash_agg, test_init)
+{
+	int rc;
+
+	init_target();
+
+	/* Null checks */
+	rc = flash_agg_init(NULL, fdev, page_buf, page_size);
+	zassert_equal(rc, -EFAULT, "expected failure");
+	rc = flash_agg_init(&ctx, NULL, page_buf, page_size);
+	zassert_equal(rc, -EFAULT, "expected failure");
+	rc = flash_agg_init(&ctx, fdev, NULL, page_size);
+	zassert_equal(rc, -EFAULT, "expected failure");
+
+	/* Size not aligned to write-block-size */
+	rc = flash_agg_init(&ctx, fdev, page_buf, page_size - 1);
+	zassert_equal(rc, -EFAULT, "expected failure");
+	rc = flash_agg_init(&ctx, fdev, page_buf, 0);
+	zassert_equal(rc, -EFAULT, "expected failure");
+}
+
+ZTEST(lib_flash_agg, test_flash_agg_write)
+{
+	int rc;
+	const uint8_t first[4] = {0x11, 0x22, 0x33, 0x44};
+	const uint8_t second[4] = {0x55, 0x66, 0x77, 0x88};
+
+	init_target();
+
+	rc = flash_agg_write(&ctx, FLASH_BASE, first, sizeof(first));
+	zassert_equal(rc, 0, "expected success");
+	rc = flash_agg_write(&ctx, FLASH_BASE + 16, second, sizeof(second));
+	zassert_equal(rc, 0, "expected success");
+
+	/* Nothing programmed until the buffer is flushed */
+	rc = flash_read(fdev, FLASH_BASE, read_buf, 20);
+	zassert_equal(rc, 0, "should succeed");
+	for (int i = 0; i < 20; i++) {
+		zassert_equal(read_buf[i], erase_value, "expected erased flash");
+	}
+
+	rc = flash_agg_flush(&ctx);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = flash_read(fdev, FLASH_BASE, read_buf, 20);
+	zassert_equal(rc, 0, "should succeed");
+	zassert_mem_equal(read_buf, first, sizeof(first), "expected written data");
+	zassert_mem_equal(&read_buf[16], second, sizeof(second),
+			  "expected written data");
+
+	/* The gap between the two writes holds the erase value */
+	for (int i = sizeof(first); i < 16; i++) {
+		zassert_equal(read_buf[i], erase_value, "expected erased flash");
+	}
+}
+
+ZTEST(lib_flash_agg, test_flash_agg_page_change)
+{
+	int rc;
+	const uint8_t data[4] = {0xaa, 0xbb, 0xcc, 0xdd};
+
+	init_target();
+
+	rc = flash_agg_write(&ctx, FLASH_BASE, data, sizeof(data));
+	zassert_equal(rc, 0, "expected success");
+
+	/* Writing to another page programs the buffered one */
+	rc = flash_agg_write(&ctx, FLASH_BASE + page_size, data, sizeof(data));
+	zassert_equal(rc, 0, "expected success");
+
+	rc = flash_read(fdev, FLASH_BASE, read_buf, sizeof(data));
+	zassert_equal(rc, 0, "should succeed");
+	zassert_mem_equal(read_buf, data, sizeof(data), "expected written data");
+
+	rc = flash_agg_flush(&ctx);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = flash_read(fdev, FLASH_BASE + page_size, read_buf, sizeof(data));
+	zassert_equal(rc, 0, "should succeed");
+	zassert_mem_equal(read_buf, data, sizeof(data), "expected written data");
+}
+
+ZTEST(lib_flash_agg, test_flash_agg_spanning_write)
+{
+	int rc;
+	static uint8_t data[MAX_PAGE_SIZE];
+
+	init_target();
+
+	memset(data, 0xab, sizeof(data));
+
+	/* Write crossing a page boundary is split and fully programmed as
+	 * the full pages are left behind.
+	 */
+	rc = flash_agg_write(&ctx, FLASH_BASE + page_size / 2, data, page_size);
+	zassert_equal(rc, 0, "expected success");
+	rc = flash_agg_flush(&ctx);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = flash_read(fdev, FLASH_BASE + page_size / 2, read_buf, page_size);
+	zassert_equal(rc, 0, "should succeed");
+	zassert_mem_equal(read_buf, data, page_size, "expected written data");
+}
+
+ZTEST(lib_flash_agg, test_flash_agg_flush_empty)
+{
+	int rc;
+
+	init_target();
+
+	/* Flushing an empty buffer is a no-op */
+	rc = flash_agg_flush(&ctx);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = flash_agg_flush(NULL);
+	zassert_equal(rc, -EFAULT, "expected failure");
+}
+
+static void *flash_agg_setup(void)
+{
+	struct flash_pages_info page;
+	const struct flash_parameters *params = flash_get_parameters(fdev);
+	int rc;
+
+	zassert_true(device_is_ready(fdev), "device not ready");
+
+	rc = flash_get_page_info_by_offs(fdev, FLASH_BASE, &page);
+	zassert_equal(rc, 0, "should succeed");
+
+	page_size = page.size;
+	erase_value = params->erase_value;
+
+	zassert_true(page_size <= MAX_PAGE_SIZE, "unsupported page size");
+
+	return NULL;
+}
+
+ZTEST_SUITE(lib_flash_agg, NULL, flash_agg_setup, NULL, NULL, NULL);
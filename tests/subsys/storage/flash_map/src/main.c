@@ -276,4 +276,48 @@ ZTEST(flash_map, test_parameter_overflows)
 	zassert_equal(rc, -EINVAL, "2: Overflow should have been detected");
 }
 
+#ifdef CONFIG_FLASH_MAP_ASYNC
+static K_SEM_DEFINE(async_done_sem, 0, 1);
+static int async_result;
+
+static void async_cb(const struct flash_area *fa, int result, void *user_data)
+{
+	async_result = result;
+	k_sem_give(user_data);
+}
+
+ZTEST(flash_map, test_flash_area_erase_write_async)
+{
+	const struct flash_area *fa;
+	struct flash_area_async_op op;
+	uint8_t src_buf[32], dst_buf[32];
+	int rc;
+
+	fa = FIXED_PARTITION(SLOT1_PARTITION);
+
+	rc = flash_area_erase_async(fa, 0, fa->fa_size, &op, async_cb,
+				    &async_done_sem);
+	zassert_true(rc == 0, "flash area erase queue fail");
+	zassert_ok(k_sem_take(&async_done_sem, K_SECONDS(10)));
+	zassert_true(async_result == 0, "flash area erase fail");
+
+	memset(src_buf, 0xAB, sizeof(src_buf));
+	rc = flash_area_write_async(fa, 0, src_buf, sizeof(src_buf), &op,
+				    async_cb, &async_done_sem);
+	zassert_true(rc == 0, "flash area write queue fail");
+	zassert_ok(k_sem_take(&async_done_sem, K_SECONDS(10)));
+	zassert_true(async_result == 0, "flash area write fail");
+
+	rc = flash_area_read(fa, 0, dst_buf, sizeof(dst_buf));
+	zassert_true(rc == 0, "flash area read fail");
+	zassert_mem_equal(src_buf, dst_buf, sizeof(dst_buf),
+			  "Data mismatch after async write");
+
+	/* Out of bounds operations must be rejected at submission already */
+	rc = flash_area_erase_async(fa, fa->fa_size, 1, &op, async_cb,
+				    &async_done_sem);
+	zassert_equal(rc, -EINVAL, "Out of bounds erase should have been rejected");
+}
+#endif /* CONFIG_FLASH_MAP_ASYNC */
+
 ZTEST_SUITE(flash_map, NULL, NULL, NULL, NULL, NULL);
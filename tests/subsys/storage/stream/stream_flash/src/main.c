@@ -35,7 +35,9 @@ static size_t cb_len;
 static size_t cb_offset;
 static int cb_ret;
 
+#ifdef CONFIG_STREAM_FLASH_PROGRESS
 static const char progress_key[] = "sf-test/progress";
+#endif
 
 static uint8_t generic_buf[BUF_LEN];
 static uint8_t read_buf[TESTBUF_SIZE];
@@ -426,6 +428,43 @@ ZTEST(lib_stream_flash, test_stream_flash_buffered_write_whole_page)
 }
 #endif
 
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+static uint8_t pipeline_buf[BUF_LEN];
+
+ZTEST(lib_stream_flash, test_stream_flash_pipeline)
+{
+	int rc;
+
+	init_target();
+
+	/* Test parameter validation */
+	rc = stream_flash_pipeline_init(NULL, pipeline_buf);
+	zassert_true(rc < 0, "expected error since ctx is NULL");
+
+	rc = stream_flash_pipeline_init(&ctx, NULL);
+	zassert_true(rc < 0, "expected error since buf is NULL");
+
+	rc = stream_flash_pipeline_init(&ctx, pipeline_buf);
+	zassert_equal(rc, 0, "expected success");
+
+	/* Fill two buffers back to back, then flush a partial third so that
+	 * both buffers get cycled through the pipelined write path.
+	 */
+	rc = stream_flash_buffered_write(&ctx, write_buf, BUF_LEN * 2, false);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = stream_flash_buffered_write(&ctx, write_buf + BUF_LEN * 2,
+					 BUF_LEN / 2, true);
+	zassert_equal(rc, 0, "expected success");
+
+	zassert_equal(stream_flash_bytes_written(&ctx), BUF_LEN * 2 + BUF_LEN / 2,
+		      "expected all bytes to be written");
+
+	VERIFY_WRITTEN(0, BUF_LEN * 2 + BUF_LEN / 2);
+}
+#endif /* CONFIG_STREAM_FLASH_PIPELINE */
+
+#ifdef CONFIG_STREAM_FLASH_PROGRESS
 static size_t write_and_save_progress(size_t bytes, const char *save_key)
 {
 	int rc;
@@ -601,6 +640,7 @@ ZTEST(lib_stream_flash, test_stream_flash_progress_clear)
 		      "expected erase offset to be unchanged");
 #endif
 }
+#endif /* CONFIG_STREAM_FLASH_PROGRESS */
 
 void lib_stream_flash_before(void *data)
 {